@@ -7,7 +7,7 @@
 #include "xs3_math_types.h"
 
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -98,6 +98,25 @@ headroom_t bfp_s32_headroom(
     bfp_s32_t* a);
 
 
+/**
+ * @brief Get the exact headroom of a 32-bit BFP vector, measuring it only if necessary.
+ * 
+ * If `b->hr_exact` is set, `b->hr` is already the exact headroom of `b` and is returned as-is. Otherwise `b->hr` is 
+ * only a lower bound on the headroom (see `XS3_BFP_LAZY_HEADROOM`), and this function behaves like 
+ * bfp_s32_headroom().
+ * 
+ * Functions which only need `b` to have some minimum headroom can use `b->hr` directly, whether or not it is exact.
+ *
+ * @param   b         BFP vector to get the headroom of
+ * 
+ * @returns    Headroom of BFP vector `b` 
+ * 
+ * @see bfp_s32_headroom
+ */
+headroom_t bfp_s32_headroom_exact(
+    bfp_s32_t* a);
+
+
 /** 
  * @brief Apply a left-shift to the mantissas of a 16-bit BFP vector.
  * 
@@ -375,6 +394,119 @@ void bfp_s32_scale(
     const float_s32_t alpha);
 
 
+/** 
+ * @brief Multiply one 16-bit BFP vector by another element-wise and add the result to an accumulator vector.
+ * 
+ * Multiply each element of input BFP vector @vector{B} by the corresponding element of input BFP vector @vector{C} 
+ * and add the results to the corresponding elements of accumulator BFP vector @vector{A}.
+ * 
+ * The products are added to the accumulators as they are computed, without first being stored, so no intermediate 
+ * vector is needed.
+ * 
+ * `acc`, `b` and `c` must have been initialized (see bfp_s16_init()), and must be the same length.
+ * 
+ * @bfp_op{16, @f$ 
+ *      A_k \leftarrow A_k + B_k \cdot C_k              \\
+ *          \qquad\text{for } k \in 0\ ...\ (N-1)       \\
+ *          \qquad\text{where } N \text{ is the length of } \bar{A}\text{, } \bar{B}\text{ and }\bar{C}
+ * @f$ }
+ * 
+ * @param[inout] acc    Input/Output accumulator BFP vector @vector{A}
+ * @param[in]    b      Input BFP vector @vector{B}
+ * @param[in]    c      Input BFP vector @vector{C}
+ */
+void bfp_s16_macc(
+    bfp_s16_t* acc, 
+    const bfp_s16_t* b, 
+    const bfp_s16_t* c);
+
+
+/** 
+ * @brief Multiply one 32-bit BFP vector by another element-wise and add the result to an accumulator vector.
+ * 
+ * Multiply each element of input BFP vector @vector{B} by the corresponding element of input BFP vector @vector{C} 
+ * and add the results to the corresponding elements of accumulator BFP vector @vector{A}.
+ * 
+ * The products are added to the accumulators as they are computed, without first being stored, so no intermediate 
+ * vector is needed.
+ * 
+ * `acc`, `b` and `c` must have been initialized (see bfp_s32_init()), and must be the same length.
+ * 
+ * @bfp_op{32, @f$ 
+ *      A_k \leftarrow A_k + B_k \cdot C_k              \\
+ *          \qquad\text{for } k \in 0\ ...\ (N-1)       \\
+ *          \qquad\text{where } N \text{ is the length of } \bar{A}\text{, } \bar{B}\text{ and }\bar{C}
+ * @f$ }
+ * 
+ * @param[inout] acc    Input/Output accumulator BFP vector @vector{A}
+ * @param[in]    b      Input BFP vector @vector{B}
+ * @param[in]    c      Input BFP vector @vector{C}
+ */
+void bfp_s32_macc(
+    bfp_s32_t* acc, 
+    const bfp_s32_t* b, 
+    const bfp_s32_t* c);
+
+
+/** 
+ * @brief Multiply one 32-bit BFP vector by another element-wise and subtract the result from an accumulator vector.
+ * 
+ * Multiply each element of input BFP vector @vector{B} by the corresponding element of input BFP vector @vector{C} 
+ * and subtract the results from the corresponding elements of accumulator BFP vector @vector{A}.
+ * 
+ * The products are subtracted from the accumulators as they are computed, without first being stored, so no 
+ * intermediate vector is needed.
+ * 
+ * `acc`, `b` and `c` must have been initialized (see bfp_s32_init()), and must be the same length.
+ * 
+ * @bfp_op{32, @f$ 
+ *      A_k \leftarrow A_k - B_k \cdot C_k              \\
+ *          \qquad\text{for } k \in 0\ ...\ (N-1)       \\
+ *          \qquad\text{where } N \text{ is the length of } \bar{A}\text{, } \bar{B}\text{ and }\bar{C}
+ * @f$ }
+ * 
+ * @param[inout] acc    Input/Output accumulator BFP vector @vector{A}
+ * @param[in]    b      Input BFP vector @vector{B}
+ * @param[in]    c      Input BFP vector @vector{C}
+ */
+void bfp_s32_nmacc(
+    bfp_s32_t* acc, 
+    const bfp_s32_t* b, 
+    const bfp_s32_t* c);
+
+
+/** 
+ * @brief Add a scaled 32-bit BFP vector to another 32-bit BFP vector.
+ * 
+ * Multiply input BFP vector @vector{C} by scalar @math{\alpha \cdot 2^{\alpha\_exp}}, add the result to input BFP 
+ * vector @vector{B} and store the sum in output BFP vector @vector{A}.
+ * 
+ * The scaled vector is added to @vector{B} as it is computed, without first being stored, so no intermediate vector 
+ * is needed.
+ * 
+ * `a`, `b` and `c` must have been initialized (see bfp_s32_init()), and must be the same length.
+ * 
+ * `alpha` represents the scalar @math{\alpha \cdot 2^{\alpha\_exp}}, where @math{\alpha} is `alpha.mant` and 
+ * @math{\alpha\_exp} is `alpha.exp`.
+ * 
+ * This operation can be performed safely in-place on `b` or `c`.
+ * 
+ * @bfp_op{32, @f$
+ *      \bar{A} \leftarrow \bar{B} + \bar{C} \cdot \left(\alpha \cdot 2^{\alpha\_exp}\right)
+ * @f$ }
+ * 
+ * @param[out] a            Output BFP vector @vector{A}
+ * @param[in]  b            Input BFP vector @vector{B}
+ * @param[in]  c            Input BFP vector @vector{C}
+ * @param[in]  alpha        Scalar by which @vector{C} is multiplied
+ */
+void bfp_s32_add_scaled(
+    bfp_s32_t* a, 
+    const bfp_s32_t* b,
+    const bfp_s32_t* c,
+    const float_s32_t alpha);
+
+
 /** 
  * @brief Get the absolute values of elements of a 16-bit BFP vector. 
  * 
@@ -1150,7 +1282,7 @@ unsigned bfp_s32_argmin(
     const bfp_s32_t* b);
 
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 }   //extern "C"
 #endif
 
@@ -0,0 +1,310 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#ifndef BFP_ARENA_H_
+#define BFP_ARENA_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "xs3_math_types.h"
+
+#if defined(__XC__) || defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/**
+ * Alignment (in bytes) of every block allocated from a `bfp_arena_t`.
+ *
+ * This is the stricter (double-word) of the two alignments described in @ref vector_alignment, so that any block may
+ * back any BFP vector, including those passed to the FFT functions.
+ */
+#define BFP_ARENA_ALIGN     (8)
+
+
+/**
+ * @brief A stack allocator for temporary BFP vectors.
+ *
+ * An arena hands out blocks from a single user-supplied buffer, in order, with no per-block bookkeeping. Blocks are not
+ * freed individually. Instead, bfp_arena_mark() records the current top of the arena, and bfp_arena_reset() releases
+ * every block allocated since that mark in constant time. Resetting to a mark taken right after initialization
+ * releases everything.
+ *
+ * The intended use is for the temporaries of a block of processing (e.g. one audio frame) to be allocated from an
+ * arena, and all released together at the end of the block.
+ *
+ * The arena also records the largest number of bytes ever in use at once, which can be read with
+ * bfp_arena_high_water() to size the arena's buffer.
+ *
+ * Arenas are created with bfp_arena_init(). The fields of this struct should not be modified directly.
+ *
+ * @par Example
+ * \code
+ *      uint64_t arena_buff[512];   // 4096 bytes
+ *      bfp_arena_t arena;
+ *      bfp_arena_init(&arena, arena_buff, sizeof(arena_buff));
+ *      ...
+ *      // For each frame
+ *      bfp_arena_mark_t frame_start = bfp_arena_mark(&arena);
+ *
+ *      bfp_s32_t tmp;
+ *      bfp_s32_init_from_arena(&tmp, &arena, 0, FRAME_SIZE);
+ *      bfp_s32_mul(&tmp, &x, &y);
+ *      ...
+ *      bfp_arena_reset(&arena, frame_start);
+ * \endcode
+ */
+typedef struct {
+    /** First (double-word-aligned) byte of the arena's buffer. */
+    uint8_t* base;
+    /** Usable size of the buffer in bytes. */
+    unsigned size;
+    /** Number of bytes currently allocated. */
+    unsigned used;
+    /** Largest value `used` has had since the arena was initialized. */
+    unsigned high_water;
+} bfp_arena_t;
+
+/**
+ * @brief A position in a `bfp_arena_t`, as returned by bfp_arena_mark().
+ */
+typedef unsigned bfp_arena_mark_t;
+
+
+/**
+ * @brief Initialize a BFP arena.
+ *
+ * `buffer` is the memory from which blocks will be allocated, and `size` is its size in bytes. Only the whole
+ * double words within the buffer are used, so it is best that `buffer` be double-word-aligned and `size` be a multiple
+ * of 8. The buffer must remain valid for as long as the arena (or any block allocated from it) is in use.
+ *
+ * @param[out] arena    Arena to initialize
+ * @param[in]  buffer   Memory to be managed by the arena
+ * @param[in]  size     Size of `buffer` in bytes
+ */
+void bfp_arena_init(
+    bfp_arena_t* arena,
+    void* buffer,
+    const unsigned size);
+
+/**
+ * @brief Allocate a block of memory from a BFP arena.
+ *
+ * The returned block is `size` bytes long, is aligned to `BFP_ARENA_ALIGN` bytes, and has unspecified contents. It
+ * remains allocated until the arena is reset to a mark taken before this call.
+ *
+ * If there is not enough free space in the arena, `NULL` is returned and the arena is unchanged.
+ *
+ * @param[inout] arena  Arena to allocate from
+ * @param[in]    size   Size of the block in bytes
+ *
+ * @return Address of the block, or `NULL`
+ */
+void* bfp_arena_alloc(
+    bfp_arena_t* arena,
+    const unsigned size);
+
+/**
+ * @brief Get the current position of a BFP arena.
+ *
+ * Passing the result to bfp_arena_reset() later releases every block allocated in the meantime.
+ *
+ * @param[in] arena     Arena
+ *
+ * @return The current position of `arena`
+ */
+bfp_arena_mark_t bfp_arena_mark(
+    const bfp_arena_t* arena);
+
+/**
+ * @brief Release all blocks allocated from a BFP arena since a mark was taken.
+ *
+ * `mark` must have been returned by bfp_arena_mark() on the same arena, and must not have been invalidated by a reset to
+ * an earlier mark. Marks may be nested, provided they are reset in the reverse of the order in which they were taken.
+ *
+ * @param[inout] arena  Arena
+ * @param[in]    mark   Position to which `arena` is reset
+ */
+void bfp_arena_reset(
+    bfp_arena_t* arena,
+    const bfp_arena_mark_t mark);
+
+/**
+ * @brief Get the number of bytes which can still be allocated from a BFP arena.
+ *
+ * @param[in] arena     Arena
+ *
+ * @return Number of free bytes in `arena`
+ */
+unsigned bfp_arena_available(
+    const bfp_arena_t* arena);
+
+/**
+ * @brief Get the largest number of bytes that have been allocated from a BFP arena at once.
+ *
+ * This includes any padding added for alignment, so a buffer of this size (plus up to `BFP_ARENA_ALIGN - 1` bytes if
+ * it is not double-word-aligned) would have sufficed for the allocations made so far.
+ *
+ * @param[in] arena     Arena
+ *
+ * @return The high-water mark of `arena`, in bytes
+ */
+unsigned bfp_arena_high_water(
+    const bfp_arena_t* arena);
+
+
+/**
+ * @brief Initialize an 8-bit BFP vector with data allocated from a BFP arena.
+ *
+ * This is equivalent to bfp_s8_init() (with `calc_hr` false), where the buffer backing the vector is `length`
+ * elements allocated from `arena`. The contents of the vector are unspecified.
+ *
+ * If there is not enough free space in `arena`, `a->data` is set to `NULL`.
+ *
+ * @param[out]   a        BFP vector to initialize
+ * @param[inout] arena    Arena from which the vector's data is allocated
+ * @param[in]    exp      Exponent of BFP vector
+ * @param[in]    length   Number of elements in the BFP vector
+ *
+ * @return `a->data`
+ */
+int8_t* bfp_s8_init_from_arena(
+    bfp_s8_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length);
+
+/**
+ * @brief Initialize a 16-bit BFP vector with data allocated from a BFP arena.
+ *
+ * This is equivalent to bfp_s16_init() (with `calc_hr` false), where the buffer backing the vector is `length`
+ * elements allocated from `arena`. The contents of the vector are unspecified.
+ *
+ * If there is not enough free space in `arena`, `a->data` is set to `NULL`.
+ *
+ * @param[out]   a        BFP vector to initialize
+ * @param[inout] arena    Arena from which the vector's data is allocated
+ * @param[in]    exp      Exponent of BFP vector
+ * @param[in]    length   Number of elements in the BFP vector
+ *
+ * @return `a->data`
+ */
+int16_t* bfp_s16_init_from_arena(
+    bfp_s16_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length);
+
+/**
+ * @brief Initialize a 32-bit BFP vector with data allocated from a BFP arena.
+ *
+ * This is equivalent to bfp_s32_init() (with `calc_hr` false), where the buffer backing the vector is `length`
+ * elements allocated from `arena`. The contents of the vector are unspecified.
+ *
+ * If there is not enough free space in `arena`, `a->data` is set to `NULL`.
+ *
+ * @param[out]   a        BFP vector to initialize
+ * @param[inout] arena    Arena from which the vector's data is allocated
+ * @param[in]    exp      Exponent of BFP vector
+ * @param[in]    length   Number of elements in the BFP vector
+ *
+ * @return `a->data`
+ */
+int32_t* bfp_s32_init_from_arena(
+    bfp_s32_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length);
+
+/**
+ * @brief Initialize a complex 16-bit BFP vector with data allocated from a BFP arena.
+ *
+ * This is equivalent to bfp_complex_s16_init() (with `calc_hr` false), where the real and imaginary buffers backing
+ * the vector are each `length` elements allocated from `arena`. The contents of the vector are unspecified.
+ *
+ * If there is not enough free space in `arena` for both buffers, `a->real` and `a->imag` are set to `NULL` and the
+ * arena is unchanged.
+ *
+ * @param[out]   a        BFP vector to initialize
+ * @param[inout] arena    Arena from which the vector's data is allocated
+ * @param[in]    exp      Exponent of BFP vector
+ * @param[in]    length   Number of elements in the BFP vector
+ *
+ * @return `a->real`
+ */
+int16_t* bfp_complex_s16_init_from_arena(
+    bfp_complex_s16_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length);
+
+/**
+ * @brief Initialize a complex 32-bit BFP vector with data allocated from a BFP arena.
+ *
+ * This is equivalent to bfp_complex_s32_init() (with `calc_hr` false), where the buffer backing the vector is
+ * `length` elements allocated from `arena`. The contents of the vector are unspecified.
+ *
+ * If there is not enough free space in `arena`, `a->data` is set to `NULL`.
+ *
+ * @param[out]   a        BFP vector to initialize
+ * @param[inout] arena    Arena from which the vector's data is allocated
+ * @param[in]    exp      Exponent of BFP vector
+ * @param[in]    length   Number of elements in the BFP vector
+ *
+ * @return `a->data`
+ */
+complex_s32_t* bfp_complex_s32_init_from_arena(
+    bfp_complex_s32_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length);
+
+/**
+ * @brief Initialize a 16-bit channel-pair BFP vector with data allocated from a BFP arena.
+ *
+ * This is equivalent to bfp_ch_pair_s16_init() (with `calc_hr` false), where the buffer backing the vector is
+ * `length` elements allocated from `arena`. The contents of the vector are unspecified.
+ *
+ * If there is not enough free space in `arena`, `a->data` is set to `NULL`.
+ *
+ * @param[out]   a        BFP vector to initialize
+ * @param[inout] arena    Arena from which the vector's data is allocated
+ * @param[in]    exp      Exponent of BFP vector
+ * @param[in]    length   Number of elements in the BFP vector
+ *
+ * @return `a->data`
+ */
+ch_pair_s16_t* bfp_ch_pair_s16_init_from_arena(
+    bfp_ch_pair_s16_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length);
+
+/**
+ * @brief Initialize a 32-bit channel-pair BFP vector with data allocated from a BFP arena.
+ *
+ * This is equivalent to bfp_ch_pair_s32_init() (with `calc_hr` false), where the buffer backing the vector is
+ * `length` elements allocated from `arena`. The contents of the vector are unspecified.
+ *
+ * If there is not enough free space in `arena`, `a->data` is set to `NULL`.
+ *
+ * @param[out]   a        BFP vector to initialize
+ * @param[inout] arena    Arena from which the vector's data is allocated
+ * @param[in]    exp      Exponent of BFP vector
+ * @param[in]    length   Number of elements in the BFP vector
+ *
+ * @return `a->data`
+ */
+ch_pair_s32_t* bfp_ch_pair_s32_init_from_arena(
+    bfp_ch_pair_s32_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length);
+
+
+#if defined(__XC__) || defined(__cplusplus)
+}   //extern "C"
+#endif
+
+#endif //BFP_ARENA_H_
@@ -7,7 +7,7 @@
 #include "xs3_math_types.h"
 
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -147,7 +147,7 @@ void bfp_ch_pair_s32_shl(
     const bfp_ch_pair_s32_t* b,
     const left_shift_t shl);
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 }   //extern "C"
 #endif
 
@@ -6,7 +6,7 @@
 
 #include "xs3_math_types.h"
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -88,6 +88,22 @@ headroom_t bfp_complex_s32_headroom(
     bfp_complex_s32_t* a);
 
 
+/**
+ * @brief Get the exact headroom of a complex 32-bit BFP vector, measuring it only if necessary.
+ * 
+ * If `b->hr_exact` is set, `b->hr` is already the exact headroom of `b` and is returned as-is. Otherwise this function 
+ * behaves like bfp_complex_s32_headroom().
+ *
+ * @param   b         complex BFP vector to get the headroom of
+ * 
+ * @returns    Headroom of complex BFP vector `b` 
+ * 
+ * @see bfp_s32_headroom_exact
+ */
+headroom_t bfp_complex_s32_headroom_exact(
+    bfp_complex_s32_t* a);
+
+
 /** 
  * @brief Apply a left-shift to the mantissas of a complex 16-bit BFP vector.
  * 
@@ -278,6 +294,34 @@ void bfp_complex_s32_mul(
     const bfp_complex_s32_t* b, 
     const bfp_complex_s32_t* c);
 
+
+/** 
+ * @brief Multiply one complex 32-bit BFP vector element-wise by another, and add the result to an accumulator vector.
+ * 
+ * Each complex element @math{A_k} of complex accumulator BFP vector @vector{A} is incremented by the complex product of
+ * @math{B_k} and @math{C_k}, the corresponding elements of complex input BFP vectors @vector{B} and @vector{C} 
+ * respectively.
+ * 
+ * The products are added to the accumulators as they are computed, without first being stored, so no intermediate 
+ * vector is needed.
+ * 
+ * `acc`, `b` and `c` must have been initialized (see bfp_complex_s32_init()), and must be the same length.
+ * 
+ * @bfp_op{32, @f$
+ *      A_k \leftarrow A_k + B_k \cdot C_k              \\
+ *          \qquad\text{for } k \in 0\ ...\ (N-1)       \\
+ *          \qquad\text{where } N \text{ is the length of } \bar{A}\text{, } \bar{B}\text{ and }\bar{C}
+ * @f$ }
+ * 
+ * @param[inout] acc    Input/Output accumulator complex BFP vector @vector{A}
+ * @param[in]    b      Input complex BFP vector @vector{B}
+ * @param[in]    c      Input complex BFP vector @vector{C}
+ */
+void bfp_complex_s32_macc(
+    bfp_complex_s32_t* acc, 
+    const bfp_complex_s32_t* b, 
+    const bfp_complex_s32_t* c);
+
 /** 
  * @brief Multiply one complex 16-bit BFP vector element-wise by the complex conjugate of another.
  * 
@@ -706,7 +750,7 @@ float_complex_s64_t bfp_complex_s32_sum(
     const bfp_complex_s32_t* b);
 
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 }   //extern "C"
 #endif
 
@@ -0,0 +1,633 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#ifndef BFP_EXPR_HPP_
+#define BFP_EXPR_HPP_
+
+#include "bfp_math.h"
+
+#include <assert.h>
+#include <type_traits>
+
+
+/**
+ * @page bfp_expressions BFP Expressions (C++)
+ *
+ * `bfp_expr.hpp` is an optional, header-only C++11 front end to the BFP API. It is not included by `bfp_math.h`.
+ *
+ * A chain of BFP operations written in C needs one API call, and (usually) one scratch vector, for each operation:
+ * \code
+ *      bfp_s32_mul(&T, &A, &B);
+ *      bfp_s32_add(&Y, &T, &C);
+ * \endcode
+ *
+ * Wrapping the BFP vectors in `bfp::vect_s32` (or `bfp::vect_s16` or `bfp::vect_complex_s32`) allows the same chain to
+ * be written as an expression:
+ * \code
+ *      bfp::vect_s32 y(Y), a(A), b(B), c(C);
+ *      y = (a * b + c) >> 3;
+ * \endcode
+ *
+ * The expression is not evaluated until it is assigned. At that point the exponent and shifts of each operation are
+ * selected, from the output of the operation below it, using the same prepare functions as the corresponding BFP
+ * functions (e.g. xs3_vect_s32_mul_prepare() for `*`). The whole expression is then evaluated in a single loop over
+ * the elements, with no temporary vectors, and the headroom of the result is found in the same loop.
+ *
+ * Because the intermediate results are never stored, their headroom can't be measured. It is instead tracked as a
+ * lower bound, which can cost a bit of precision in each operation compared to the separate BFP functions. Each
+ * intermediate result is still rounded and saturated exactly as the VPU would do it.
+ *
+ * The supported operations are:
+ *
+ * Expression | Meaning                                                     | Prepare function
+ * ---------- | ----------------------------------------------------------- | ----------------
+ * `x + y`    | Element-wise sum                                            | xs3_vect_add_sub_prepare()
+ * `x - y`    | Element-wise difference                                     | xs3_vect_add_sub_prepare()
+ * `x * y`    | Element-wise product                                        | e.g. xs3_vect_s32_mul_prepare()
+ * `x * s`    | Product with a scalar (`float_s32_t`, or `float_s16_t`)     | e.g. xs3_vect_s32_mul_prepare()
+ * `x >> n`   | Logical value divided by @math{2^n} (only the exponent)     |
+ * `x << n`   | Logical value multiplied by @math{2^n} (only the exponent)  |
+ *
+ * The operands of an expression must all have the same element type and length. Assigning an expression to a vector
+ * which is also one of its operands is safe.
+ *
+ * @note On xcore the VPU-accelerated BFP functions process several elements per instruction, whereas an expression is
+ * evaluated one element at a time. Fusing saves memory passes and scratch memory, but isn't necessarily faster there.
+ */
+
+
+namespace bfp {
+
+namespace detail {
+
+/*
+    Element operations, with the rounding and (symmetric) saturation of the VPU instructions they correspond to. See
+    xs3_vpu_scalar_ops.h.
+*/
+
+static inline int32_t sat32(
+    const int64_t x)
+{
+    return (x >= VPU_INT32_MAX)? (int32_t) VPU_INT32_MAX : (x <= VPU_INT32_MIN)? (int32_t) VPU_INT32_MIN : (int32_t) x;
+}
+
+static inline int16_t sat16(
+    const int32_t x)
+{
+    return (x >= VPU_INT16_MAX)? (int16_t) VPU_INT16_MAX : (x <= VPU_INT16_MIN)? (int16_t) VPU_INT16_MIN : (int16_t) x;
+}
+
+// VLASHR
+static inline int32_t ashr32(
+    const int32_t x,
+    const right_shift_t shr)
+{
+    if(shr <= -32)  return (x == 0)? 0 : (x > 0)? (int32_t) VPU_INT32_MAX : (int32_t) VPU_INT32_MIN;
+    else if(shr < 0) return sat32(((int64_t) x) * (((int64_t) 1) << (-shr)));
+    else             return sat32(x >> MIN(shr, 31));
+}
+
+static inline int16_t ashr16(
+    const int16_t x,
+    const right_shift_t shr)
+{
+    if(shr <= -16)  return (x == 0)? 0 : (x > 0)? (int16_t) VPU_INT16_MAX : (int16_t) VPU_INT16_MIN;
+    else if(shr < 0) return sat16(((int32_t) x) * (1 << (-shr)));
+    else             return sat16(x >> MIN(shr, 15));
+}
+
+// VLMUL
+static inline int32_t mul32(
+    const int32_t x,
+    const int32_t y)
+{
+    const int64_t p = ((int64_t) x) * y;
+    return sat32(((p >> 29) + 1) >> 1);
+}
+
+// VLMACC followed by VLSAT
+static inline int16_t mul16(
+    const int16_t x,
+    const int16_t y,
+    const right_shift_t sat)
+{
+    const int32_t p = ((int32_t) x) * y;
+    return sat16((sat > 0)? ((p >> (sat-1)) + 1) >> 1 : p);
+}
+
+// The headroom of a vector with headroom hr after it has been arithmetically right-shifted by shr bits
+static inline int shr_hr(
+    const headroom_t hr,
+    const right_shift_t shr)
+{
+    return MAX(0, (int) hr + shr);
+}
+
+static inline headroom_t clamp_hr(
+    const int hr,
+    const headroom_t max_hr)
+{
+    return (headroom_t) MIN(MAX(hr, 0), (int) max_hr);
+}
+
+} // namespace detail
+
+
+
+
+/**
+ * @brief Element operations and prepare functions for each type of BFP vector.
+ *
+ * For each operation `op`, `op_prepare()` selects the shifts and the output exponent (with the prepare function of
+ * the corresponding BFP operation) given the exponents and headroom of the operands, and also gives a lower bound on
+ * the headroom of the output. `op()` then applies the operation to one element.
+ */
+template <class V>
+struct traits;
+
+template <>
+struct traits<bfp_s32_t> {
+    typedef int32_t elem_t;
+    typedef float_s32_t scalar_t;
+
+    static const headroom_t max_hr = 31;
+
+    struct mul_plan {
+        right_shift_t b_shr;
+        right_shift_t c_shr;
+        int32_t alpha;
+    };
+
+    static elem_t* data(const bfp_s32_t& v)                 { return v.data; }
+    static headroom_t hr(const elem_t x)                     { return HR_S32(x); }
+    static elem_t shr(const elem_t x, const right_shift_t s) { return detail::ashr32(x, s); }
+    static elem_t add(const elem_t b, const elem_t c)        { return detail::sat32(((int64_t) b) + c); }
+    static elem_t sub(const elem_t b, const elem_t c)        { return detail::sat32(((int64_t) b) - c); }
+
+    static void set_hr(bfp_s32_t& v, const headroom_t hr)
+    {
+        v.hr = hr;
+        v.hr_exact = 1;
+    }
+
+    static headroom_t mul_prepare(exponent_t* a_exp, mul_plan* p, const exponent_t b_exp, const exponent_t c_exp,
+                                  const headroom_t b_hr, const headroom_t c_hr)
+    {
+        xs3_vect_s32_mul_prepare(a_exp, &p->b_shr, &p->c_shr, b_exp, c_exp, b_hr, c_hr);
+        return detail::clamp_hr(detail::shr_hr(b_hr, p->b_shr) + detail::shr_hr(c_hr, p->c_shr) - 2, max_hr);
+    }
+
+    static elem_t mul(const elem_t b, const elem_t c, const mul_plan& p)
+    {
+        return detail::mul32(shr(b, p.b_shr), shr(c, p.c_shr));
+    }
+
+    static headroom_t scale_prepare(exponent_t* a_exp, mul_plan* p, const exponent_t b_exp, const headroom_t b_hr,
+                                    const scalar_t alpha)
+    {
+        const headroom_t hr = mul_prepare(a_exp, p, b_exp, alpha.exp, b_hr, HR_S32(alpha.mant));
+        p->alpha = shr(alpha.mant, p->c_shr);
+        return hr;
+    }
+
+    static elem_t scale(const elem_t b, const mul_plan& p)
+    {
+        return detail::mul32(shr(b, p.b_shr), p.alpha);
+    }
+};
+
+template <>
+struct traits<bfp_s16_t> {
+    typedef int16_t elem_t;
+    typedef float_s16_t scalar_t;
+
+    static const headroom_t max_hr = 15;
+
+    struct mul_plan {
+        right_shift_t a_shr;
+        int16_t alpha;
+    };
+
+    static elem_t* data(const bfp_s16_t& v)                  { return v.data; }
+    static headroom_t hr(const elem_t x)                     { return HR_S16(x); }
+    static elem_t shr(const elem_t x, const right_shift_t s) { return detail::ashr16(x, s); }
+    static elem_t add(const elem_t b, const elem_t c)        { return detail::sat16(((int32_t) b) + c); }
+    static elem_t sub(const elem_t b, const elem_t c)        { return detail::sat16(((int32_t) b) - c); }
+
+    static void set_hr(bfp_s16_t& v, const headroom_t hr)
+    {
+        v.hr = hr;
+    }
+
+    static headroom_t mul_prepare(exponent_t* a_exp, mul_plan* p, const exponent_t b_exp, const exponent_t c_exp,
+                                  const headroom_t b_hr, const headroom_t c_hr)
+    {
+        xs3_vect_s16_mul_prepare(a_exp, &p->a_shr, b_exp, c_exp, b_hr, c_hr);
+        return detail::clamp_hr((int) b_hr + (int) c_hr + p->a_shr - 16, max_hr);
+    }
+
+    static elem_t mul(const elem_t b, const elem_t c, const mul_plan& p)
+    {
+        return detail::mul16(b, c, p.a_shr);
+    }
+
+    static headroom_t scale_prepare(exponent_t* a_exp, mul_plan* p, const exponent_t b_exp, const headroom_t b_hr,
+                                    const scalar_t alpha)
+    {
+        const headroom_t alpha_hr = HR_S16(alpha.mant);
+        xs3_vect_s16_scale_prepare(a_exp, &p->a_shr, b_exp, alpha.exp, b_hr, alpha_hr);
+        p->alpha = alpha.mant;
+        return detail::clamp_hr((int) b_hr + (int) alpha_hr + p->a_shr - 16, max_hr);
+    }
+
+    static elem_t scale(const elem_t b, const mul_plan& p)
+    {
+        return detail::mul16(b, p.alpha, p.a_shr);
+    }
+};
+
+template <>
+struct traits<bfp_complex_s32_t> {
+    typedef complex_s32_t elem_t;
+    typedef float_s32_t scalar_t;
+
+    static const headroom_t max_hr = 31;
+
+    typedef traits<bfp_s32_t>::mul_plan mul_plan;
+
+    static elem_t* data(const bfp_complex_s32_t& v)         { return v.data; }
+    static headroom_t hr(const elem_t x)                     { return MIN(HR_S32(x.re), HR_S32(x.im)); }
+
+    static elem_t shr(const elem_t x, const right_shift_t s)
+    {
+        elem_t a = { detail::ashr32(x.re, s), detail::ashr32(x.im, s) };
+        return a;
+    }
+
+    static elem_t add(const elem_t b, const elem_t c)
+    {
+        elem_t a = { detail::sat32(((int64_t) b.re) + c.re), detail::sat32(((int64_t) b.im) + c.im) };
+        return a;
+    }
+
+    static elem_t sub(const elem_t b, const elem_t c)
+    {
+        elem_t a = { detail::sat32(((int64_t) b.re) - c.re), detail::sat32(((int64_t) b.im) - c.im) };
+        return a;
+    }
+
+    static void set_hr(bfp_complex_s32_t& v, const headroom_t hr)
+    {
+        v.hr = hr;
+        v.hr_exact = 1;
+    }
+
+    static headroom_t mul_prepare(exponent_t* a_exp, mul_plan* p, const exponent_t b_exp, const exponent_t c_exp,
+                                  const headroom_t b_hr, const headroom_t c_hr)
+    {
+        xs3_vect_complex_s32_mul_prepare(a_exp, &p->b_shr, &p->c_shr, b_exp, c_exp, b_hr, c_hr);
+        // Each part of the product is the sum of two real products
+        return detail::clamp_hr(detail::shr_hr(b_hr, p->b_shr) + detail::shr_hr(c_hr, p->c_shr) - 3, max_hr);
+    }
+
+    // As xs3_vect_complex_s32_mul(), each real product is rounded before they are summed
+    static elem_t mul(const elem_t b, const elem_t c, const mul_plan& p)
+    {
+        const elem_t B = shr(b, p.b_shr);
+        const elem_t C = shr(c, p.c_shr);
+        const int64_t q1 = ((((int64_t) B.re) * C.re >> 29) + 1) >> 1;
+        const int64_t q2 = ((((int64_t) B.im) * C.im >> 29) + 1) >> 1;
+        const int64_t q3 = ((((int64_t) B.re) * C.im >> 29) + 1) >> 1;
+        const int64_t q4 = ((((int64_t) B.im) * C.re >> 29) + 1) >> 1;
+        elem_t a = { detail::sat32(q1 - q2), detail::sat32(q3 + q4) };
+        return a;
+    }
+
+    // Scaling by a real scalar, as bfp_complex_s32_real_scale()
+    static headroom_t scale_prepare(exponent_t* a_exp, mul_plan* p, const exponent_t b_exp, const headroom_t b_hr,
+                                    const scalar_t alpha)
+    {
+        return traits<bfp_s32_t>::scale_prepare(a_exp, p, b_exp, b_hr, alpha);
+    }
+
+    static elem_t scale(const elem_t b, const mul_plan& p)
+    {
+        elem_t a = { detail::mul32(detail::ashr32(b.re, p.b_shr), p.alpha),
+                     detail::mul32(detail::ashr32(b.im, p.b_shr), p.alpha) };
+        return a;
+    }
+};
+
+
+
+
+/**
+ * @brief Base class of all BFP expressions.
+ *
+ * Each expression type `E` derives from `expr<E>`, and provides:
+ *  - `vect_type`: the type of BFP vector the expression evaluates to
+ *  - `prepare()`: select the exponent and shifts of the expression (and its operands)
+ *  - `exp()` and `hr()`: the exponent and a lower bound on the headroom of the expression, once prepared
+ *  - `eval(k)`: the mantissa of element `k`, once prepared
+ *  - `length()`: the number of elements
+ */
+template <class E>
+struct expr {
+    const E& self() const { return static_cast<const E&>(*this); }
+};
+
+
+/**
+ * @brief A BFP vector, for use in expressions.
+ *
+ * This refers to (and does not own) a `bfp_s32_t`, `bfp_s16_t` or `bfp_complex_s32_t`. Assigning an expression to it
+ * evaluates the expression, updating the data, exponent and headroom of the underlying BFP vector. The length of the
+ * BFP vector must already match that of the expression.
+ */
+template <class V>
+class vect : public expr<vect<V>> {
+
+    V* v;
+
+public:
+    typedef V vect_type;
+    typedef typename traits<V>::elem_t elem_t;
+
+    vect(V& v) : v(&v) {}
+    vect(const vect& other) = default;
+
+    void prepare() {}
+    exponent_t exp() const          { return v->exp; }
+    headroom_t hr() const           { return v->hr; }
+    unsigned length() const         { return v->length; }
+    elem_t eval(const unsigned k) const { return traits<V>::data(*v)[k]; }
+
+    V& bfp() const { return *v; }
+
+    template <class E>
+    vect& operator=(const expr<E>& e)
+    {
+        static_assert(std::is_same<typename E::vect_type, V>::value, "Expression has a different element type.");
+
+        E plan(e.self());
+        plan.prepare();
+
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+        assert(plan.length() == v->length);
+        assert(v->length != 0);
+#endif
+
+        elem_t* data = traits<V>::data(*v);
+        headroom_t hr = traits<V>::max_hr;
+
+        for(unsigned k = 0; k < v->length; k++){
+            data[k] = plan.eval(k);
+            hr = MIN(hr, traits<V>::hr(data[k]));
+        }
+
+        v->exp = plan.exp();
+        traits<V>::set_hr(*v, hr);
+
+        return *this;
+    }
+
+    // Copies the elements, rather than the reference
+    vect& operator=(const vect& other)
+    {
+        return *this = static_cast<const expr<vect>&>(other);
+    }
+
+    template <class E>
+    vect& operator+=(const expr<E>& e);
+
+    template <class E>
+    vect& operator-=(const expr<E>& e);
+};
+
+typedef vect<bfp_s32_t>         vect_s32;
+typedef vect<bfp_s16_t>         vect_s16;
+typedef vect<bfp_complex_s32_t> vect_complex_s32;
+
+
+/**
+ * @brief The sum (or difference) of two BFP expressions.
+ */
+template <class L, class R, bool SUB>
+class add_expr : public expr<add_expr<L, R, SUB>> {
+
+    L b;
+    R c;
+    exponent_t a_exp;
+    headroom_t a_hr;
+    right_shift_t b_shr;
+    right_shift_t c_shr;
+
+public:
+    typedef typename L::vect_type vect_type;
+    typedef traits<vect_type> T;
+
+    add_expr(const L& b, const R& c) : b(b), c(c) {}
+
+    void prepare()
+    {
+        b.prepare();
+        c.prepare();
+        xs3_vect_add_sub_prepare(&a_exp, &b_shr, &c_shr, b.exp(), c.exp(), b.hr(), c.hr());
+        // The sum may need one more bit than the larger operand
+        a_hr = detail::clamp_hr(MIN(detail::shr_hr(b.hr(), b_shr), detail::shr_hr(c.hr(), c_shr)) - 1, T::max_hr);
+    }
+
+    exponent_t exp() const  { return a_exp; }
+    headroom_t hr() const   { return a_hr; }
+
+    unsigned length() const
+    {
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+        assert(b.length() == c.length());
+#endif
+        return b.length();
+    }
+
+    typename T::elem_t eval(const unsigned k) const
+    {
+        const typename T::elem_t B = T::shr(b.eval(k), b_shr);
+        const typename T::elem_t C = T::shr(c.eval(k), c_shr);
+        return SUB? T::sub(B, C) : T::add(B, C);
+    }
+};
+
+
+/**
+ * @brief The element-wise product of two BFP expressions.
+ */
+template <class L, class R>
+class mul_expr : public expr<mul_expr<L, R>> {
+
+    L b;
+    R c;
+    exponent_t a_exp;
+    headroom_t a_hr;
+    typename traits<typename L::vect_type>::mul_plan plan;
+
+public:
+    typedef typename L::vect_type vect_type;
+    typedef traits<vect_type> T;
+
+    mul_expr(const L& b, const R& c) : b(b), c(c) {}
+
+    void prepare()
+    {
+        b.prepare();
+        c.prepare();
+        a_hr = T::mul_prepare(&a_exp, &plan, b.exp(), c.exp(), b.hr(), c.hr());
+    }
+
+    exponent_t exp() const  { return a_exp; }
+    headroom_t hr() const   { return a_hr; }
+
+    unsigned length() const
+    {
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+        assert(b.length() == c.length());
+#endif
+        return b.length();
+    }
+
+    typename T::elem_t eval(const unsigned k) const
+    {
+        return T::mul(b.eval(k), c.eval(k), plan);
+    }
+};
+
+
+/**
+ * @brief The product of a BFP expression and a scalar.
+ */
+template <class E>
+class scale_expr : public expr<scale_expr<E>> {
+
+public:
+    typedef typename E::vect_type vect_type;
+    typedef traits<vect_type> T;
+
+private:
+    E b;
+    typename T::scalar_t alpha;
+    exponent_t a_exp;
+    headroom_t a_hr;
+    typename T::mul_plan plan;
+
+public:
+    scale_expr(const E& b, const typename T::scalar_t alpha) : b(b), alpha(alpha) {}
+
+    void prepare()
+    {
+        b.prepare();
+        a_hr = T::scale_prepare(&a_exp, &plan, b.exp(), b.hr(), alpha);
+    }
+
+    exponent_t exp() const      { return a_exp; }
+    headroom_t hr() const       { return a_hr; }
+    unsigned length() const     { return b.length(); }
+
+    typename T::elem_t eval(const unsigned k) const
+    {
+        return T::scale(b.eval(k), plan);
+    }
+};
+
+
+/**
+ * @brief A BFP expression with its logical value multiplied by @math{2^{shl}}.
+ *
+ * Only the exponent changes, so this costs nothing at evaluation.
+ */
+template <class E>
+class ldexp_expr : public expr<ldexp_expr<E>> {
+
+    E b;
+    left_shift_t shl;
+
+public:
+    typedef typename E::vect_type vect_type;
+    typedef traits<vect_type> T;
+
+    ldexp_expr(const E& b, const left_shift_t shl) : b(b), shl(shl) {}
+
+    void prepare()                  { b.prepare(); }
+    exponent_t exp() const          { return b.exp() + shl; }
+    headroom_t hr() const           { return b.hr(); }
+    unsigned length() const         { return b.length(); }
+
+    typename T::elem_t eval(const unsigned k) const
+    {
+        return b.eval(k);
+    }
+};
+
+
+
+
+template <class L, class R>
+add_expr<L, R, false> operator+(const expr<L>& b, const expr<R>& c)
+{
+    static_assert(std::is_same<typename L::vect_type, typename R::vect_type>::value, "Operands have different types.");
+    return add_expr<L, R, false>(b.self(), c.self());
+}
+
+template <class L, class R>
+add_expr<L, R, true> operator-(const expr<L>& b, const expr<R>& c)
+{
+    static_assert(std::is_same<typename L::vect_type, typename R::vect_type>::value, "Operands have different types.");
+    return add_expr<L, R, true>(b.self(), c.self());
+}
+
+template <class L, class R>
+mul_expr<L, R> operator*(const expr<L>& b, const expr<R>& c)
+{
+    static_assert(std::is_same<typename L::vect_type, typename R::vect_type>::value, "Operands have different types.");
+    return mul_expr<L, R>(b.self(), c.self());
+}
+
+template <class E>
+scale_expr<E> operator*(const expr<E>& b, const typename traits<typename E::vect_type>::scalar_t alpha)
+{
+    return scale_expr<E>(b.self(), alpha);
+}
+
+template <class E>
+scale_expr<E> operator*(const typename traits<typename E::vect_type>::scalar_t alpha, const expr<E>& b)
+{
+    return scale_expr<E>(b.self(), alpha);
+}
+
+template <class E>
+ldexp_expr<E> operator<<(const expr<E>& b, const left_shift_t shl)
+{
+    return ldexp_expr<E>(b.self(), shl);
+}
+
+template <class E>
+ldexp_expr<E> operator>>(const expr<E>& b, const right_shift_t shr)
+{
+    return ldexp_expr<E>(b.self(), -shr);
+}
+
+
+template <class V>
+template <class E>
+vect<V>& vect<V>::operator+=(const expr<E>& e)
+{
+    return *this = *this + e;
+}
+
+template <class V>
+template <class E>
+vect<V>& vect<V>::operator-=(const expr<E>& e)
+{
+    return *this = *this - e;
+}
+
+} // namespace bfp
+
+#endif //BFP_EXPR_HPP_
@@ -7,7 +7,7 @@
 
 #include "xs3_math_types.h"
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -28,7 +28,9 @@ extern "C" {
  * represented by the returned pointer.
  * 
  * The exponent, headroom, length and data contents of `x` are all updated by this function, though `x->data` will 
- * continue to point to the same address.
+ * continue to point to the same address. The headroom reported is the exact headroom of the spectrum, as reported by
+ * xs3_fft_mono_adjust(). With `XS3_BFP_LAZY_HEADROOM` it is instead the headroom left by the complex FFT less the one
+ * bit that the adjustment can use up, and `x->hr_exact` is cleared.
  * 
  * `x->length` must be a power of 2, and must be no larger than `(1<<MAX_DIT_FFT_LOG2)`.
  * 
@@ -340,7 +342,291 @@ void  bfp_fft_inverse_stereo(
     const bfp_complex_s32_t* b);
 
 
-#ifdef __XC__
+
+/** 
+ * @brief Performs a forward real Discrete Fourier Transform on a real 16-bit sequence.
+ * 
+ * Performs an @math{N}-point forward real DFT on the real 16-bit BFP vector `x`, where @math{N} is `x->length`. The 
+ * operation is performed in-place, resulting in an @math{N/2}-element complex 16-bit BFP vector `X`.
+ * 
+ * The operation performed is:
+ * @f[
+ *      X[f] = \sum_{n=0}^{N-1} \left( x[n]\cdot e^{-j2\pi fn/N} \right)
+ *      \text{ for } 0 \le f \le N/2
+ * @f]
+ * 
+ * The output BFP vector `X` need not have been initialized prior to calling this function. Upon completion 
+ * `X->real` points to `&x->data[0]` and `X->imag` points to `&x->data[N/2]`. The contents of `x` are modified (and
+ * should be considered corrupted) by this function.
+ * 
+ * `x->length` must be a power of 2, and must be no larger than `(1<<XS3_MATH_FFT_MAX_LOG2)`.
+ * 
+ * The spectrum is encoded in `X` as specified for real DFTs in @ref spectrum_packing. That is, `X->real[f]` and 
+ * `X->imag[f]` for `1 <= f < (X->length)` represent @math{X[f]} for @math{1 \le f \lt (N/2)}, `X->real[0]` represents
+ * @math{X[0]} and `X->imag[0]` represents @math{X[N/2]}.
+ * 
+ * Unlike the 32-bit FFTs, the 16-bit FFTs impose no headroom requirement on their input. The data are rescaled before 
+ * each stage of the FFT to keep as much precision as possible while avoiding saturation.
+ * 
+ * @par Example
+ * \code
+ *      int16_t buffer[N] = { ... };
+ *      bfp_s16_t samples;
+ *      bfp_s16_init(&samples, buffer, 0, N, 1);
+ *      {
+ *          bfp_complex_s16_t spectrum;
+ *          bfp_fft_forward_mono_s16(&spectrum, &samples);
+ *          // Operate on frequency domain data using `spectrum`
+ *          ...
+ *          bfp_fft_inverse_mono_s16(&samples, &spectrum);
+ *      }
+ * \endcode
+ * 
+ * @param[out]   X  Output spectrum @math{X[f]}.
+ * @param[inout] x  The BFP vector @math{x[n]} to be DFTed.
+ */
+void bfp_fft_forward_mono_s16(
+    bfp_complex_s16_t* X,
+    bfp_s16_t* x);
+
+/** 
+ * @brief Performs an inverse real Discrete Fourier Transform on a complex 16-bit sequence.
+ * 
+ * Performs an @math{N}-point inverse real DFT on the complex 16-bit BFP vector `X`, where @math{N} is `2*X->length`. 
+ * The operation is performed in-place, resulting in an @math{N}-element real 16-bit BFP vector `x`.
+ * 
+ * The operation performed is:
+ * @f[
+ *      x[n] = \sum_{f=0}^{N/2} \left( X[f]\cdot e^{j2\pi fn/N} \right)
+ *      \text{ for } 0 \le n \lt N
+ * @f]
+ * 
+ * The spectrum is interpreted as specified for bfp_fft_forward_mono_s16(). `X->imag` must point to 
+ * `&X->real[X->length]`, which is how the spectrum is left by bfp_fft_forward_mono_s16().
+ * 
+ * The output BFP vector `x` need not have been initialized prior to calling this function. Upon completion `x->data` 
+ * points to `X->real`.
+ * 
+ * `X->length` must be a power of 2, and must be no larger than `(1<<(XS3_MATH_FFT_MAX_LOG2-1))`.
+ * 
+ * @param[out]   x  Output BFP vector @math{x[n]}.
+ * @param[inout] X  The spectrum @math{X[f]} to be IDFTed.
+ */
+void bfp_fft_inverse_mono_s16(
+    bfp_s16_t* x,
+    bfp_complex_s16_t* X);
+
+/** 
+ * @brief Performs a forward complex Discrete Fourier Transform on a complex 16-bit sequence.
+ * 
+ * Performs an @math{N}-point forward complex DFT on the complex 16-bit BFP vector `x`, where @math{N} is `x->length`. 
+ * The operation is performed in-place.
+ * 
+ * The operation performed is:
+ * @f[
+ *      X[f] = \sum_{n=0}^{N-1} \left( x[n]\cdot e^{-j2\pi fn/N} \right)
+ *      \text{ for } 0 \le f \lt N
+ * @f]
+ * 
+ * The exponent, headroom and data contents of `x` are updated by this function. `x->real` and `x->imag` will continue
+ * to point to the same addresses.
+ * 
+ * `x->length` must be a power of 2, and must be no larger than `(1<<XS3_MATH_FFT_MAX_LOG2)`.
+ * 
+ * @param[inout] x  The BFP vector @math{x[n]} to be DFTed.
+ */
+void bfp_fft_forward_complex_s16(
+    bfp_complex_s16_t* x);
+
+/** 
+ * @brief Performs an inverse complex Discrete Fourier Transform on a complex 16-bit sequence.
+ * 
+ * Performs an @math{N}-point inverse complex DFT on the complex 16-bit BFP vector `x`, where @math{N} is `x->length`. 
+ * The operation is performed in-place.
+ * 
+ * The operation performed is:
+ * @f[
+ *      x[n] = \sum_{f=0}^{N-1} \left( X[f]\cdot e^{j2\pi fn/N} \right)
+ *      \text{ for } 0 \le f \lt N
+ * @f]
+ * 
+ * The exponent, headroom and data contents of `x` are updated by this function. `x->real` and `x->imag` will continue
+ * to point to the same addresses.
+ * 
+ * `x->length` must be a power of 2, and must be no larger than `(1<<XS3_MATH_FFT_MAX_LOG2)`.
+ * 
+ * @param[inout] x  The BFP vector @math{X[f]} to be IDFTed.
+ */
+void bfp_fft_inverse_complex_s16(
+    bfp_complex_s16_t* x);
+
+
+/** 
+ * @brief Performs a forward complex Discrete Fourier Transform of mixed-radix length on a complex 32-bit sequence.
+ * 
+ * This is equivalent to bfp_fft_forward_complex(), except that @math{N} (`x->length`) may be any supported 
+ * mixed-radix FFT length (@math{N = 2^a \cdot 3^b \cdot 5^c}, see xs3_fft_mixed_is_supported()), such as @math{480}. 
+ * The operation is performed in-place.
+ * 
+ * The exponent, headroom and data contents of `x` are updated by this function. `x->data` will continue to point to the
+ * same address. 
+ * 
+ * @param[inout] x  The BFP vector @math{x[n]} to be DFTed.
+ */
+void bfp_fft_forward_complex_mixed(
+    bfp_complex_s32_t* x);
+
+/** 
+ * @brief Performs an inverse complex Discrete Fourier Transform of mixed-radix length on a complex 32-bit sequence.
+ * 
+ * This is equivalent to bfp_fft_inverse_complex(), except that @math{N} (`x->length`) may be any supported 
+ * mixed-radix FFT length (see xs3_fft_mixed_is_supported()). The operation is performed in-place.
+ * 
+ * @param[inout] x  The BFP vector @math{X[f]} to be IDFTed.
+ */
+void bfp_fft_inverse_complex_mixed(
+    bfp_complex_s32_t* x);
+
+/** 
+ * @brief Performs a forward real Discrete Fourier Transform of mixed-radix length on a real 32-bit sequence.
+ * 
+ * This is equivalent to bfp_fft_forward_mono(), except that @math{N} (`x->length`) may be any even length such that 
+ * @math{N/2} is a supported mixed-radix FFT length (see xs3_fft_mixed_is_supported()), such as @math{480}. The 
+ * operation is performed in-place, and the spectrum is packed as for bfp_fft_forward_mono().
+ * 
+ * @param[inout] x  The BFP vector @math{x[n]} to be DFTed.
+ * 
+ * @return Address of input BFP vector `x`, cast as `bfp_complex_s32_t*`.
+ */
+bfp_complex_s32_t* bfp_fft_forward_mono_mixed(
+    bfp_s32_t* x);
+
+/** 
+ * @brief Performs an inverse real Discrete Fourier Transform of mixed-radix length on a complex 32-bit sequence.
+ * 
+ * This is equivalent to bfp_fft_inverse_mono(), except that @math{N} (`2*x->length`) may be any even length such that 
+ * @math{N/2} is a supported mixed-radix FFT length (see xs3_fft_mixed_is_supported()). The operation is performed 
+ * in-place.
+ * 
+ * @param[inout] x  The BFP vector @math{X[f]} to be IDFTed.
+ * 
+ * @return Address of input BFP vector `x`, cast as `bfp_s32_t*`.
+ */
+bfp_s32_t* bfp_fft_inverse_mono_mixed(
+    bfp_complex_s32_t* x);
+
+
+/**
+ * @brief A precomputed plan for 32-bit power-of-2 FFTs of a particular length.
+ *
+ * A plan holds state which depends only on the FFT length, so that it need not be recomputed for every frame. Plans are
+ * created with bfp_fft_plan_init() and used with bfp_fft_forward_mono_plan(), bfp_fft_inverse_mono_plan(),
+ * bfp_fft_forward_complex_plan() and bfp_fft_inverse_complex_plan(). A single plan may be shared by any number of
+ * channels and transforms of its length, and is not modified by them.
+ *
+ * With a plan, the pre-scaling applied to the input of a forward FFT (to give it the headroom the FFT requires) is
+ * applied during the index bit-reversal pass, rather than as a separate pass over the data.
+ *
+ * The functions without a plan argument (e.g. bfp_fft_forward_mono()) behave as though given a plan initialized
+ * without a bit-reversal buffer.
+ *
+ * The fields of this struct should not be modified directly.
+ */
+typedef struct {
+    /** Number of complex points in the FFT (@math{N/2} for a real @math{N}-point DFT). */
+    unsigned length;
+    /** Cached index bit-reversal permutation of `length` elements, or `NULL` to compute it as needed. */
+    const uint16_t* bitrev;
+} bfp_fft_plan_t;
+
+/**
+ * @brief Initializes a plan for 32-bit power-of-2 FFTs.
+ *
+ * `length` is the number of complex points in the FFT. For bfp_fft_forward_complex_plan() and
+ * bfp_fft_inverse_complex_plan() this is the DFT length @math{N}. For bfp_fft_forward_mono_plan() and
+ * bfp_fft_inverse_mono_plan() it is @math{N/2}, where @math{N} is the number of real samples.
+ *
+ * `bitrev_buff` is a buffer of `length` elements in which the index bit-reversal permutation is cached. It must remain
+ * valid for as long as the plan is in use. If `bitrev_buff` is `NULL` the permutation is not cached, and the plan's
+ * FFTs are equivalent to those of functions without a plan argument.
+ *
+ * `length` must be a power of 2, and must be no larger than `(1<<MAX_DIT_FFT_LOG2)`.
+ *
+ * @par Example
+ * \code
+ *      // Plan for 512-point real FFTs
+ *      uint16_t bitrev_buff[256];
+ *      bfp_fft_plan_t plan;
+ *      bfp_fft_plan_init(&plan, bitrev_buff, 256);
+ *      ...
+ *      // For each frame
+ *      bfp_complex_s32_t* spectrum = bfp_fft_forward_mono_plan(&plan, &samples);
+ *      ...
+ *      bfp_fft_inverse_mono_plan(&plan, spectrum);
+ * \endcode
+ *
+ * @param[out] plan         Plan to be initialized
+ * @param[in]  bitrev_buff  Buffer of `length` elements for the bit-reversal permutation, or `NULL`
+ * @param[in]  length       Number of complex points in the FFT
+ */
+void bfp_fft_plan_init(
+    bfp_fft_plan_t* plan,
+    uint16_t bitrev_buff[],
+    const unsigned length);
+
+/**
+ * @brief Performs a forward real Discrete Fourier Transform on a real 32-bit sequence, using a plan.
+ *
+ * This is equivalent to bfp_fft_forward_mono(), using precomputed plan `plan`. `plan->length` must be `x->length/2`.
+ *
+ * @param[in]    plan   FFT plan
+ * @param[inout] x      The BFP vector @math{x[n]} to be DFTed.
+ *
+ * @return Address of input BFP vector `x`, cast as `bfp_complex_s32_t*`.
+ */
+bfp_complex_s32_t* bfp_fft_forward_mono_plan(
+    const bfp_fft_plan_t* plan,
+    bfp_s32_t* x);
+
+/**
+ * @brief Performs an inverse real Discrete Fourier Transform on a complex 32-bit sequence, using a plan.
+ *
+ * This is equivalent to bfp_fft_inverse_mono(), using precomputed plan `plan`. `plan->length` must be `x->length`.
+ *
+ * @param[in]    plan   FFT plan
+ * @param[inout] x      The BFP vector @math{X[f]} to be IDFTed.
+ *
+ * @return Address of input BFP vector `x`, cast as `bfp_s32_t*`.
+ */
+bfp_s32_t* bfp_fft_inverse_mono_plan(
+    const bfp_fft_plan_t* plan,
+    bfp_complex_s32_t* x);
+
+/**
+ * @brief Performs a forward complex Discrete Fourier Transform on a complex 32-bit sequence, using a plan.
+ *
+ * This is equivalent to bfp_fft_forward_complex(), using precomputed plan `plan`. `plan->length` must be `x->length`.
+ *
+ * @param[in]    plan   FFT plan
+ * @param[inout] x      The BFP vector @math{x[n]} to be DFTed.
+ */
+void bfp_fft_forward_complex_plan(
+    const bfp_fft_plan_t* plan,
+    bfp_complex_s32_t* x);
+
+/**
+ * @brief Performs an inverse complex Discrete Fourier Transform on a complex 32-bit sequence, using a plan.
+ *
+ * This is equivalent to bfp_fft_inverse_complex(), using precomputed plan `plan`. `plan->length` must be `x->length`.
+ *
+ * @param[in]    plan   FFT plan
+ * @param[inout] x      The BFP vector @math{X[f]} to be IDFTed.
+ */
+void bfp_fft_inverse_complex_plan(
+    const bfp_fft_plan_t* plan,
+    bfp_complex_s32_t* x);
+
+#if defined(__XC__) || defined(__cplusplus)
 }   //extern "C"
 #endif
 
@@ -0,0 +1,567 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#ifndef BFP_FILTERS_H_
+#define BFP_FILTERS_H_
+
+#include "xs3_math_types.h"
+#include "vect/xs3_filters.h"
+
+#if defined(__XC__) || defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/**
+ * @brief FFT-based (overlap-save) block FIR filter.
+ *
+ * This struct holds the state of an @math{M}-tap FIR filter which is applied to blocks of @math{B} samples at a time
+ * using fast convolution. Each call to bfp_filter_ols_s32() consumes a block of @math{B} new input samples and
+ * produces the corresponding @math{B} output samples, as though each input sample had been processed by a direct-form
+ * FIR filter (see xs3_filter_fir_s32()) with the same coefficients.
+ *
+ * Internally, each block is appended to the @math{N-B} most recent input samples to form an @math{N}-sample frame,
+ * where @math{N} is the FFT length. The frame is DFTed, multiplied by the (pre-computed) spectrum of the zero-padded
+ * filter coefficients and inverse DFTed. The last @math{B} samples of the resulting circular convolution are the
+ * output samples. This requires @math{M + B - 1 \le N}.
+ *
+ * The cost per block is roughly that of one forward and one inverse @math{N}-point real FFT, rather than
+ * @math{M \cdot B} multiply-accumulates, so this is much cheaper than the direct form for long filters. The price is a
+ * latency of @math{B} samples and @math{2N + (N-B)} words of memory. A good choice is typically @math{N = 2M} and
+ * @math{B = N-M+1}.
+ *
+ * Input and output blocks are BFP vectors, and the exponent of each input block may differ from that of the previous
+ * block. The input history and the new block are brought to a common exponent (with no headroom) before each forward
+ * FFT, so the output's precision tracks the signal level.
+ *
+ * The fields of this struct should not be modified directly. Use bfp_filter_ols_s32_init() to initialize it.
+ */
+typedef struct {
+    /** FFT length @math{N} */
+    unsigned frame_length;
+    /** Block length @math{B} */
+    unsigned block_length;
+    /** Spectrum of the zero-padded filter coefficients, @math{N/2} elements */
+    bfp_complex_s32_t coef;
+    /** Frame buffer, @math{N} elements */
+    bfp_s32_t frame;
+    /** The @math{N-B} most recent input samples, oldest first */
+    int32_t* history;
+    /** Exponent of `history` */
+    exponent_t history_exp;
+    /** Headroom of `history` */
+    headroom_t history_hr;
+} bfp_filter_ols_s32_t;
+
+
+/**
+ * @brief Initialize an overlap-save block FIR filter.
+ *
+ * The filter's @math{M} = `coef->length` coefficients are zero-padded to the FFT length @math{N} = `frame_length` in
+ * `coef_buff[]` and DFTed in-place, so the coefficient spectrum is computed once here rather than with every block. The
+ * contents of `coef` are not modified, and it need not remain valid after this call.
+ *
+ * `coef_buff` and `frame_buff` must each have space for @math{N} elements and must be double-word-aligned, as required
+ * by the FFT. `history_buff` must have space for @math{N-B} elements, where @math{B} = `block_length`. The history is
+ * cleared to zero. The buffers must remain valid for as long as the filter is in use.
+ *
+ * `frame_length` must satisfy the same constraints as for bfp_fft_forward_mono(), and @math{M + B - 1 \le N}.
+ *
+ * @param[out] filter           Filter to be initialized
+ * @param[in]  coef_buff        Buffer for the coefficient spectrum, @math{N} elements
+ * @param[in]  frame_buff       Frame buffer, @math{N} elements
+ * @param[in]  history_buff     Input history buffer, @math{N-B} elements
+ * @param[in]  coef             Filter coefficients @math{b[k]}
+ * @param[in]  frame_length     FFT length @math{N}
+ * @param[in]  block_length     Block length @math{B}
+ */
+void bfp_filter_ols_s32_init(
+    bfp_filter_ols_s32_t* filter,
+    int32_t coef_buff[],
+    int32_t frame_buff[],
+    int32_t history_buff[],
+    const bfp_s32_t* coef,
+    const unsigned frame_length,
+    const unsigned block_length);
+
+
+/**
+ * @brief Filter a block of samples with an overlap-save block FIR filter.
+ *
+ * Consumes the @math{B} new input samples in `x` and places the @math{B} corresponding output samples in `y`.
+ *
+ * The operation performed is:
+ * @f[
+ *      y[n] = \sum_{k=0}^{M-1} b[k] \cdot x[n-k]  \text{ for each of the } B \text{ new samples } x[n]
+ * @f]
+ * where @math{x[n-k]} for @math{k \gt 0} may be samples from previous blocks.
+ *
+ * `y->data` must have space for @math{B} elements. The exponent, headroom and length of `y` are updated by this
+ * function. `y` must not share a buffer with the filter's frame buffer, but it may be `x`.
+ *
+ * @param[inout] filter     Filter state
+ * @param[out]   y          Output block, @math{B} elements
+ * @param[in]    x          Input block, @math{B} elements
+ */
+void bfp_filter_ols_s32(
+    bfp_filter_ols_s32_t* filter,
+    bfp_s32_t* y,
+    const bfp_s32_t* x);
+
+
+/**
+ * @brief Uniformly partitioned FFT-based block FIR filter.
+ *
+ * This struct holds the state of an @math{M}-tap FIR filter which is applied to blocks of @math{B} samples at a time,
+ * like bfp_filter_ols_s32_t, but with the impulse response split into @math{P = \lceil M/B \rceil} partitions of
+ * @math{B} taps each. Every partition is convolved using @math{N = 2B}-point FFTs, so the latency is @math{B} samples
+ * regardless of the length of the impulse response. This makes it suitable for long impulse responses (e.g. reverb or
+ * echo paths) which must be applied with low latency.
+ *
+ * Each call to bfp_filter_partitioned_s32() DFTs one frame made up of the previous and new input blocks and inserts its
+ * spectrum into a frequency-domain delay line (FDL) of the @math{P} most recent frame spectra. The output spectrum is
+ * then the sum over @math{p} of the product of the @math{p}th most recent frame spectrum with the spectrum of the
+ * @math{p}th partition of the impulse response. Only one inverse FFT is needed per block.
+ *
+ * The partition spectra and the FDL entries are each `bfp_complex_s32_t` vectors with their own exponent and headroom,
+ * so quiet tails of the impulse response and quiet past input frames lose no precision. The products are accumulated
+ * into a single accumulator whose exponent is chosen (before any product is computed) to hold the sum of all the
+ * products without saturating. Each product after the first is multiply-accumulated directly into the
+ * accumulator, so no scratch buffer is needed for it.
+ *
+ * Memory use is linear in the length of the impulse response: @math{2N} words per partition, plus @math{1.5N} words
+ * of working buffers.
+ *
+ * The fields of this struct should not be modified directly. Use bfp_filter_partitioned_s32_init() to initialize it.
+ */
+typedef struct {
+    /** Block length @math{B} */
+    unsigned block_length;
+    /** Number of partitions @math{P} */
+    unsigned partition_count;
+    /** Spectra of the impulse response partitions, @math{P} vectors of @math{N/2} elements */
+    bfp_complex_s32_t* coef;
+    /** Frequency-domain delay line, @math{P} vectors of @math{N/2} elements */
+    bfp_complex_s32_t* fdl;
+    /** Index in `fdl` of the most recent frame spectrum */
+    unsigned fdl_head;
+    /** Accumulator of the output spectrum, @math{N/2} elements */
+    bfp_complex_s32_t acc;
+    /** Scratch buffer used by bfp_filter_fdaf_s32(), @math{N/2} elements (`NULL` if not an FDAF) */
+    complex_s32_t* product;
+    /** The @math{B} most recent input samples */
+    int32_t* history;
+    /** Exponent of `history` */
+    exponent_t history_exp;
+    /** Headroom of `history` */
+    headroom_t history_hr;
+} bfp_filter_partitioned_s32_t;
+
+
+/**
+ * @brief Initialize a uniformly partitioned FFT-based block FIR filter.
+ *
+ * The @math{M} = `coef->length` coefficients are split into @math{P = \lceil M/B \rceil} partitions of
+ * @math{B} = `block_length` taps, and each partition is zero-padded to @math{N = 2B} and DFTed into `coef_buff[]`. The
+ * contents of `coef` are not modified, and it need not remain valid after this call.
+ *
+ * The caller supplies the following buffers, all of which must remain valid for as long as the filter is in use:
+ *  - `coef_parts[]` and `fdl_parts[]`: @math{P} BFP vectors each
+ *  - `coef_buff[]` and `fdl_buff[]`: @math{P \cdot N} words each, double-word-aligned
+ *  - `acc_buff[]`: @math{N} words, double-word-aligned
+ *  - `history_buff[]`: @math{B} words
+ *
+ * The input history and FDL are cleared to zero.
+ *
+ * @math{N = 2B} must satisfy the same constraints as the length for bfp_fft_forward_mono().
+ *
+ * @param[out] filter           Filter to be initialized
+ * @param[in]  coef_parts       BFP vectors for the partition spectra, @math{P} elements
+ * @param[in]  coef_buff        Buffer for the partition spectra, @math{P \cdot N} elements
+ * @param[in]  fdl_parts        BFP vectors for the frequency-domain delay line, @math{P} elements
+ * @param[in]  fdl_buff         Buffer for the frequency-domain delay line, @math{P \cdot N} elements
+ * @param[in]  acc_buff         Accumulator buffer, @math{N} elements
+ * @param[in]  history_buff     Input history buffer, @math{B} elements
+ * @param[in]  coef             Filter coefficients @math{b[k]}
+ * @param[in]  block_length     Block length @math{B}
+ */
+void bfp_filter_partitioned_s32_init(
+    bfp_filter_partitioned_s32_t* filter,
+    bfp_complex_s32_t coef_parts[],
+    int32_t coef_buff[],
+    bfp_complex_s32_t fdl_parts[],
+    int32_t fdl_buff[],
+    int32_t acc_buff[],
+    int32_t history_buff[],
+    const bfp_s32_t* coef,
+    const unsigned block_length);
+
+
+/**
+ * @brief Filter a block of samples with a uniformly partitioned FFT-based block FIR filter.
+ *
+ * Consumes the @math{B} new input samples in `x` and places the @math{B} corresponding output samples in `y`. The
+ * operation performed is the same as for bfp_filter_ols_s32().
+ *
+ * `y->data` must have space for @math{B} elements. The exponent, headroom and length of `y` are updated by this
+ * function. `y` may be `x`.
+ *
+ * @param[inout] filter     Filter state
+ * @param[out]   y          Output block, @math{B} elements
+ * @param[in]    x          Input block, @math{B} elements
+ */
+void bfp_filter_partitioned_s32(
+    bfp_filter_partitioned_s32_t* filter,
+    bfp_s32_t* y,
+    const bfp_s32_t* x);
+
+
+/**
+ * @brief Normalized least-mean-squares (NLMS) adaptive FIR filter.
+ *
+ * This struct holds the state of an @math{M}-tap adaptive FIR filter whose weights @math{w[k]} are adapted to minimize
+ * the error between the filter's output and a desired signal @math{d[n]}, as in echo or noise cancellation. For each
+ * input sample @math{x[n]} the filter computes
+ * @f[
+ *      y[n] = \sum_{k=0}^{M-1} w[k] \cdot x[n-k]   \\
+ *      e[n] = d[n] - y[n]
+ * @f]
+ * and the weights are then moved along the error gradient by a step normalized by the energy of the input:
+ * @f[
+ *      w[k] \leftarrow w[k] + \frac{\mu \cdot e[n]}{\delta + \sum_{j=0}^{M-1} x[n-j]^2} \cdot x[n-k]
+ * @f]
+ * where @math{\mu} is the step size and @math{\delta} is a small regularization term which keeps the step bounded when
+ * the input is quiet.
+ *
+ * Two update modes are available. bfp_filter_nlms_s32() updates the weights after every sample, as above.
+ * bfp_filter_nlms_s32_block() computes the outputs for a whole block of @math{L} samples with the same weights and then
+ * applies a single update with the gradient summed over the block,
+ * @f[
+ *      w[k] \leftarrow w[k] + \frac{\mu \cdot \sum_{n} e[n] \cdot x[n-k]}{\delta + \sum_{n} \sum_{j=0}^{M-1} x[n-j]^2}
+ * @f]
+ * where both sums over @math{n} are over the samples of the block. The block mode needs roughly half the work per
+ * sample, but (for the same @math{\mu}) converges about @math{L} times more slowly.
+ *
+ * The weights are a BFP vector, so they keep their precision as they adapt, and they may be read (e.g. to inspect the
+ * estimated impulse response) or replaced between calls. The input history is kept at a single exponent which follows
+ * the level of the signal in it.
+ *
+ * The fields of this struct should not be modified directly, except for `weights`, `step_size` and `regularization`.
+ * Use bfp_filter_nlms_s32_init() to initialize it.
+ */
+typedef struct {
+    /** Number of taps @math{M} */
+    unsigned tap_count;
+    /** Maximum number of samples per call @math{B} */
+    unsigned block_length;
+    /** Filter weights @math{w[k]}, @math{M} elements. `weights.data[k]` is applied to @math{x[n-k]}. */
+    bfp_s32_t weights;
+    /** Step size @math{\mu} */
+    float_s32_t step_size;
+    /** Regularization term @math{\delta} */
+    float_s32_t regularization;
+    /** Input history, newest sample first, @math{M+B-1} elements */
+    int32_t* history;
+    /** Exponent of `history` */
+    exponent_t history_exp;
+    /** Headroom of `history` */
+    headroom_t history_hr;
+    /** Scratch buffer, @math{M+B} elements */
+    int32_t* scratch;
+} bfp_filter_nlms_s32_t;
+
+
+/**
+ * @brief Initialize an NLMS adaptive FIR filter.
+ *
+ * The @math{M} = `tap_count` weights are cleared to zero, as is the input history.
+ *
+ * The caller supplies the following buffers, all of which must remain valid for as long as the filter is in use:
+ *  - `weight_buff[]`: @math{M} words
+ *  - `history_buff[]`: @math{M+B-1} words, where @math{B} = `block_length`
+ *  - `scratch_buff[]`: @math{M+B} words
+ *
+ * `block_length` is the largest number of samples which will be passed to bfp_filter_nlms_s32() or
+ * bfp_filter_nlms_s32_block() in one call.
+ *
+ * `step_size` is @math{\mu}, which should be between 0 and 2 (values near 1 adapt fastest). `regularization` is
+ * @math{\delta}, which should be positive and small compared with the expected energy of @math{M} input samples.
+ *
+ * @param[out] filter           Filter to be initialized
+ * @param[in]  weight_buff      Buffer for the weights, @math{M} elements
+ * @param[in]  history_buff     Input history buffer, @math{M+B-1} elements
+ * @param[in]  scratch_buff     Scratch buffer, @math{M+B} elements
+ * @param[in]  tap_count        Number of taps @math{M}
+ * @param[in]  block_length     Maximum block length @math{B}
+ * @param[in]  step_size        Step size @math{\mu}
+ * @param[in]  regularization   Regularization term @math{\delta}
+ */
+void bfp_filter_nlms_s32_init(
+    bfp_filter_nlms_s32_t* filter,
+    int32_t weight_buff[],
+    int32_t history_buff[],
+    int32_t scratch_buff[],
+    const unsigned tap_count,
+    const unsigned block_length,
+    const float_s32_t step_size,
+    const float_s32_t regularization);
+
+
+/**
+ * @brief Filter a block of samples with an NLMS adaptive filter, updating the weights after every sample.
+ *
+ * Consumes the @math{L} new input samples in `x` and the corresponding desired samples in `d`, and places the
+ * @math{L} error samples @math{e[n] = d[n] - y[n]} in `e`. Each output @math{y[n]} is computed with the weights as
+ * updated by all of the previous samples.
+ *
+ * `x` and `d` must have the same length @math{L}, which must not exceed the filter's block length. `e->data` must have
+ * space for @math{L} elements. The exponent, headroom and length of `e` are updated by this function. `e` may be `d`.
+ *
+ * @param[inout] filter     Filter state
+ * @param[out]   e          Error block, @math{L} elements
+ * @param[in]    x          Input block, @math{L} elements
+ * @param[in]    d          Desired block, @math{L} elements
+ */
+void bfp_filter_nlms_s32(
+    bfp_filter_nlms_s32_t* filter,
+    bfp_s32_t* e,
+    const bfp_s32_t* x,
+    const bfp_s32_t* d);
+
+
+/**
+ * @brief Filter a block of samples with an NLMS adaptive filter, updating the weights once per block.
+ *
+ * Consumes the @math{L} new input samples in `x` and the corresponding desired samples in `d`, and places the
+ * @math{L} error samples @math{e[n] = d[n] - y[n]} in `e`. All of the outputs are computed with the same weights, which
+ * are then updated once with the gradient summed over the block (see bfp_filter_nlms_s32_t).
+ *
+ * `x` and `d` must have the same length @math{L}, which must not exceed the filter's block length. `e->data` must have
+ * space for @math{L} elements. The exponent, headroom and length of `e` are updated by this function. `e` may be `d`.
+ *
+ * @param[inout] filter     Filter state
+ * @param[out]   e          Error block, @math{L} elements
+ * @param[in]    x          Input block, @math{L} elements
+ * @param[in]    d          Desired block, @math{L} elements
+ */
+void bfp_filter_nlms_s32_block(
+    bfp_filter_nlms_s32_t* filter,
+    bfp_s32_t* e,
+    const bfp_s32_t* x,
+    const bfp_s32_t* d);
+
+
+/**
+ * @brief Partitioned frequency-domain block adaptive filter.
+ *
+ * This struct holds the state of an @math{M}-tap adaptive FIR filter which, like bfp_filter_nlms_s32_t, adapts its
+ * weights to minimize the error @math{e[n] = d[n] - y[n]} between its output and a desired signal, but which does all
+ * of its filtering and adaptation in the frequency domain. It is intended for long filters (e.g. acoustic echo
+ * cancellation with thousands of taps), for which the time-domain NLMS filter is too expensive.
+ *
+ * The filter works on blocks of @math{B} samples. The weights are split into @math{P = \lceil M/B \rceil} partitions
+ * of @math{B} taps, and are held only as their @math{N = 2B}-point spectra @math{W_p[f]}, in the `coef` partitions of an
+ * embedded bfp_filter_partitioned_s32_t which computes the output @math{y[n]} (see bfp_filter_partitioned_s32()). With
+ * @math{X_p[f]} the spectrum of the @math{p}th most recent input frame in its FDL, each block then proceeds as follows:
+ *  - The error spectrum @math{E[f]} is the DFT of @math{B} zeros followed by the @math{B} error samples scaled by
+ *    @math{\mu / P}.
+ *  - The input power in each frequency bin is tracked as
+ *    @math{S[f] \leftarrow \beta \cdot S[f] + (1 - \beta) \cdot \left| X_0[f] \right|^2}.
+ *  - Each partition's weights are updated with
+ *    @math{W_p[f] \leftarrow W_p[f] + \frac{E[f] \cdot X_p[f]^*}{\max(S[f], \delta)}}.
+ *
+ * @math{\mu} is the step size, @math{\beta} the power smoothing factor and @math{\delta} a regularization floor on the
+ * power which keeps the step bounded in bins with little input. Dividing the step by @math{P} gives @math{\mu} the same
+ * useful range regardless of the filter length. To keep the inverse of the power precise in the loudest bins, the
+ * floor is also raised to at least @math{2^{-20}} times the largest power.
+ *
+ * If `constrained` is nonzero, the gradient constraint is applied to each partition's update: it is inverse
+ * transformed, its last @math{B} taps (which correspond to a circular rather than linear correlation) are zeroed, and
+ * it is transformed back. This costs two FFTs per partition per block, but gives the filter the same solution as a
+ * time-domain filter. Without it (the "unconstrained" filter) the adaptation is cheaper but converges to a biased
+ * solution.
+ *
+ * The error is scaled once per block in the time domain, and the step normalization is computed once per block and
+ * shared by all of the partitions, so each partition only needs one product and one sum (plus the two FFTs if
+ * constrained) per block, each of which aligns exponents once. The weight partitions and FDL entries each keep their
+ * own exponent and headroom.
+ *
+ * The fields of this struct should not be modified directly, except for `step_size`, `smoothing`, `regularization`
+ * and `constrained`. Use bfp_filter_fdaf_s32_init() to initialize it.
+ */
+typedef struct {
+    /** Partitioned filter which computes the output. Its `coef` partitions are the weight spectra @math{W_p[f]}. */
+    bfp_filter_partitioned_s32_t filter;
+    /** Number of taps @math{M} */
+    unsigned tap_count;
+    /** Smoothed input power per bin @math{S[f]}, @math{B+1} elements. Elements 0 and 1 are for DC and Nyquist, and
+        element @math{f+1} is for bin @math{f} for @math{0 < f < B}. */
+    bfp_s32_t power;
+    /** Scratch buffer for the normalized step, @math{B+1} elements */
+    int32_t* step;
+    /** Step size @math{\mu} */
+    float_s32_t step_size;
+    /** Power smoothing factor @math{\beta} */
+    float_s32_t smoothing;
+    /** Regularization floor @math{\delta} */
+    float_s32_t regularization;
+    /** Whether the gradient constraint is applied */
+    unsigned constrained;
+} bfp_filter_fdaf_s32_t;
+
+
+/**
+ * @brief Initialize a partitioned frequency-domain block adaptive filter.
+ *
+ * The @math{M} = `tap_count` weights are cleared to zero, as are the input history, the FDL and the power estimate.
+ *
+ * The caller supplies the following buffers, all of which must remain valid for as long as the filter is in use:
+ *  - `weight_parts[]` and `fdl_parts[]`: @math{P} BFP vectors each
+ *  - `weight_buff[]` and `fdl_buff[]`: @math{P \cdot N} words each, double-word-aligned
+ *  - `acc_buff[]` and `product_buff[]`: @math{N} words each, double-word-aligned
+ *  - `history_buff[]`: @math{B} words
+ *  - `power_buff[]` and `step_buff[]`: @math{B+1} words each
+ *
+ * `step_size` is @math{\mu}, which should be between 0 and 2 (values near 1 adapt fastest). `smoothing` is
+ * @math{\beta}, which should be between 0 and 1 (values near 1 give a smoother power estimate). `regularization` is
+ * @math{\delta}, which should be positive and small compared with the expected power of the input in one bin (about
+ * @math{N} times the mean square of the input samples, for white input).
+ *
+ * @math{N = 2B} must satisfy the same constraints as the length for bfp_fft_forward_mono().
+ *
+ * @param[out] fdaf             Filter to be initialized
+ * @param[in]  weight_parts     BFP vectors for the weight spectra, @math{P} elements
+ * @param[in]  weight_buff      Buffer for the weight spectra, @math{P \cdot N} elements
+ * @param[in]  fdl_parts        BFP vectors for the frequency-domain delay line, @math{P} elements
+ * @param[in]  fdl_buff         Buffer for the frequency-domain delay line, @math{P \cdot N} elements
+ * @param[in]  acc_buff         Accumulator buffer, @math{N} elements
+ * @param[in]  product_buff     Scratch buffer, @math{N} elements
+ * @param[in]  history_buff     Input history buffer, @math{B} elements
+ * @param[in]  power_buff       Buffer for the power estimate, @math{B+1} elements
+ * @param[in]  step_buff        Scratch buffer, @math{B+1} elements
+ * @param[in]  tap_count        Number of taps @math{M}
+ * @param[in]  block_length     Block length @math{B}
+ * @param[in]  step_size        Step size @math{\mu}
+ * @param[in]  smoothing        Power smoothing factor @math{\beta}
+ * @param[in]  regularization   Regularization floor @math{\delta}
+ * @param[in]  constrained      Whether to apply the gradient constraint
+ */
+void bfp_filter_fdaf_s32_init(
+    bfp_filter_fdaf_s32_t* fdaf,
+    bfp_complex_s32_t weight_parts[],
+    int32_t weight_buff[],
+    bfp_complex_s32_t fdl_parts[],
+    int32_t fdl_buff[],
+    int32_t acc_buff[],
+    int32_t product_buff[],
+    int32_t history_buff[],
+    int32_t power_buff[],
+    int32_t step_buff[],
+    const unsigned tap_count,
+    const unsigned block_length,
+    const float_s32_t step_size,
+    const float_s32_t smoothing,
+    const float_s32_t regularization,
+    const unsigned constrained);
+
+
+/**
+ * @brief Filter a block of samples with a partitioned frequency-domain adaptive filter, and update its weights.
+ *
+ * Consumes the @math{B} new input samples in `x` and the corresponding desired samples in `d`, and places the
+ * @math{B} error samples @math{e[n] = d[n] - y[n]} in `e`. All of the outputs are computed with the same weights, which
+ * are then updated once (see bfp_filter_fdaf_s32_t).
+ *
+ * `x` and `d` must each have length @math{B}. `e->data` must have space for @math{B} elements. The exponent, headroom
+ * and length of `e` are updated by this function. `e` may be `d`.
+ *
+ * @param[inout] fdaf       Filter state
+ * @param[out]   e          Error block, @math{B} elements
+ * @param[in]    x          Input block, @math{B} elements
+ * @param[in]    d          Desired block, @math{B} elements
+ */
+void bfp_filter_fdaf_s32(
+    bfp_filter_fdaf_s32_t* fdaf,
+    bfp_s32_t* e,
+    const bfp_s32_t* x,
+    const bfp_s32_t* d);
+
+
+/**
+ * @brief Decimate a block of packed PDM samples with a CIC decimator.
+ *
+ * The `length * R` 1-bit samples packed into `bits[]` are consumed, and the `length` output samples of
+ * xs3_filter_cic_s32_pdm() are placed in `y`. The PDM samples are taken to be @math{\pm 1}, so the exponent of `y` is
+ * the filter's output shift. This is the same for every block, which allows `y` to be passed directly to
+ * bfp_filter_decimator_s32(). The outputs include the filter's DC gain of @math{R^N}.
+ *
+ * `y->data` must have space for `length` elements. The exponent, headroom and length of `y` are updated by this
+ * function. `length * R` must be a multiple of 32.
+ *
+ * @param[inout] cic        CIC decimator
+ * @param[out]   y          Output block, `length` elements
+ * @param[in]    bits       Packed PDM samples, `length * R / 32` words
+ * @param[in]    length     Number of output samples
+ */
+void bfp_filter_cic_s32_pdm(
+    xs3_filter_cic_s32_t* cic,
+    bfp_s32_t* y,
+    const uint32_t bits[],
+    const unsigned length);
+
+
+/**
+ * @brief Decimate a block of samples with a CIC decimator.
+ *
+ * The @math{L} samples in `x` are consumed, and the @math{L/R} output samples of xs3_filter_cic_s32() are placed in
+ * `y`, with an exponent of `x->exp` plus the filter's output shift. The outputs include the filter's DC gain of
+ * @math{R^N}.
+ *
+ * The filter's state holds the integrals of past samples, so `x->exp` must be the same for every block, and (as
+ * for xs3_filter_cic_s32_init()) `x` must have at least `32 - input_bits` bits of headroom.
+ *
+ * `y->data` must have space for @math{L/R} elements. The exponent, headroom and length of `y` are updated by this
+ * function. @math{L} must be a multiple of @math{R}.
+ *
+ * @param[inout] cic        CIC decimator
+ * @param[out]   y          Output block, @math{L/R} elements
+ * @param[in]    x          Input block, @math{L} elements
+ */
+void bfp_filter_cic_s32(
+    xs3_filter_cic_s32_t* cic,
+    bfp_s32_t* y,
+    const bfp_s32_t* x);
+
+
+/**
+ * @brief Decimate a block of samples with an FIR decimator.
+ *
+ * The @math{L} samples in `x` are consumed, @math{R} at a time, by xs3_filter_decimator_s32(), and the @math{L/R}
+ * output samples are placed in `y`. If the decimator's coefficients have exponent `coef_exp`, the exponent of `y` is
+ * `x->exp + coef_exp + 30 + shift` (see xs3_filter_fir_s32_t).
+ *
+ * Used after bfp_filter_cic_s32_pdm() or bfp_filter_cic_s32(), this is the compensation and final decimation stage of
+ * a PDM front end. As with the CIC decimator, the filter's state holds past samples, so `x->exp` must be the same for
+ * every block.
+ *
+ * `y->data` must have space for @math{L/R} elements. The exponent, headroom and length of `y` are updated by this
+ * function. @math{L} must be a multiple of @math{R}.
+ *
+ * @param[inout] decimator  FIR decimator
+ * @param[out]   y          Output block, @math{L/R} elements
+ * @param[in]    x          Input block, @math{L} elements
+ * @param[in]    coef_exp   Exponent of the decimator's coefficients
+ */
+void bfp_filter_decimator_s32(
+    xs3_filter_decimator_s32_t* decimator,
+    bfp_s32_t* y,
+    const bfp_s32_t* x,
+    const exponent_t coef_exp);
+
+
+#if defined(__XC__) || defined(__cplusplus)
+}   //extern "C"
+#endif
+
+#endif //BFP_FILTERS_H_
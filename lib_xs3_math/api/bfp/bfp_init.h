@@ -9,10 +9,37 @@
 
 #include "xs3_math_types.h"
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
+/** 
+ * @brief Initialize an 8-bit BFP vector.
+ * 
+ * This function initializes each of the fields of BFP vector `a`.
+ * 
+ * `data` points to the memory buffer used to store elements of the vector, so it must be at least `length` bytes 
+ * long, and must begin at a word-aligned address.
+ * 
+ * `exp` is the exponent assigned to the BFP vector. The logical value associated with the `k`th element of the vector 
+ * after initialization is @math{ data_k \cdot 2^{exp} }.
+ * 
+ * If `calc_hr` is false, `a->hr` is initialized to 0. Otherwise, the headroom of the the BFP vector is calculated and 
+ * used to initialize `a->hr`.
+ * 
+ * @param[out] a        BFP vector to initialize
+ * @param[in] data      `int8_t` buffer used to back `a`
+ * @param[in] exp       Exponent of BFP vector
+ * @param[in] length    Number of elements in the BFP vector
+ * @param[in] calc_hr   Boolean indicating whether the HR of the BFP vector should be calculated
+ */
+void bfp_s8_init(
+    bfp_s8_t* a, 
+    int8_t* data, 
+    const exponent_t exp, 
+    const unsigned length,
+    const unsigned calc_hr);
+
 /** 
  * @brief Initialize a 16-bit BFP vector.
  * 
@@ -51,8 +78,8 @@ void bfp_s16_init(
  * `exp` is the exponent assigned to the BFP vector. The logical value associated with the `k`th element of the vector 
  * after initialization is @math{ data_k \cdot 2^{exp} }.
  * 
- * If `calc_hr` is false, `a->hr` is initialized to 0. Otherwise, the headroom of the the BFP vector is calculated and 
- * used to initialize `a->hr`.
+ * If `calc_hr` is false, `a->hr` is initialized to 0 and `a->hr_exact` is cleared. Otherwise, the headroom of the the 
+ * BFP vector is calculated and used to initialize `a->hr`.
  * 
  * @param[out] a         BFP vector to initialize
  * @param[in]  data      `int32_t` buffer used to back `a`
@@ -114,8 +141,8 @@ void bfp_complex_s16_init(
  * `exp` is the exponent assigned to the BFP vector. The logical value associated with the `k`th complex
  * element of the vector after initialization will be @f$ \left(data_{2k} + i\cdot data_{2k+1} \right)\cdot2^{exp} @f$.
  * 
- * If `calc_hr` is false, `a->hr` is initialized to 0. Otherwise, the headroom of the the BFP vector 
- * is calculated and used to initialize `a->hr`.
+ * If `calc_hr` is false, `a->hr` is initialized to 0 and `a->hr_exact` is cleared. Otherwise, the headroom of the the 
+ * BFP vector is calculated and used to initialize `a->hr`.
  * 
  * @param[out] a         BFP vector struct to initialize
  * @param[in]  data      `complex_s32_t` buffer used to back `a`
@@ -307,7 +334,7 @@ void bfp_ch_pair_s32_set(
 
     
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 }   //extern "C"
 #endif
 
@@ -0,0 +1,302 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#ifndef BFP_S8_H_
+#define BFP_S8_H_
+
+#include "xs3_math_types.h"
+
+#if defined(__XC__) || defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+    8-bit BFP vectors trade precision for memory. An 8-bit vector needs a quarter of the memory of the equivalent 32-bit
+    vector. The underlying xs3_vect_s8 functions are plain C on every platform, so they are not faster than the 16-bit
+    or 32-bit functions.
+
+    Representable mantissa range:
+     8-bit:     (-127, 127)
+*/
+
+
+/**
+ * @brief Get the headroom of an 8-bit BFP vector.
+ * 
+ * The headroom of a vector is the number of bits its elements can be left-shifted without losing any information. It
+ * conveys information about the range of values that vector may contain, which is useful for determining how best to
+ * preserve precision in potentially lossy block floating-point operations.
+ * 
+ * In a BFP context, headroom applies to mantissas only, not exponents.
+ * 
+ * In particular, if the 8-bit mantissa vector @vector{x} has @math{N} bits of headroom, then for any element
+ * @math{x_k} of @vector{x}
+ * 
+ * @math{-2^{7-N} \le x_k \lt 2^{7-N}}
+ * 
+ * This function determines the headroom of `b`, updates `b->hr` with that value, and then returns `b->hr`.
+ * 
+ * @param   b         BFP vector to get the headroom of
+ * 
+ * @returns    Headroom of BFP vector `b`
+ */
+headroom_t bfp_s8_headroom(
+    bfp_s8_t* b);
+
+
+/**
+ * @brief Apply a left-shift to the mantissas of an 8-bit BFP vector.
+ * 
+ * Each mantissa of input BFP vector @vector{B} is left-shifted `b_shl` bits and stored in the corresponding element of
+ * output BFP vector @vector{A}.
+ * 
+ * This operation can be used to add or remove headroom from a BFP vector.
+ * 
+ * `b_shl` is the number of bits that each mantissa will be left-shifted. This shift is signed and arithmetic, so
+ * negative values for `b_shl` will right-shift the mantissas.
+ * 
+ * `a` and `b` must have been initialized (see bfp_s8_init()), and must be the same length.
+ * 
+ * This operation can be performed safely in-place on `b`.
+ * 
+ * Note that this operation bypasses the logic protecting the caller from saturation or underflows. Output values
+ * saturate to the symmetric 8-bit range (the open interval @math{(-2^7, 2^7)}).
+ * 
+ * @bfp_op{8, @f$
+ *      a_k \leftarrow sat_{8}( \lfloor b_k \cdot 2^{b\_shl} \rfloor )  \\
+ *          \qquad\text{for }k \in 0\ ...\ (N-1)                        \\
+ *          \qquad\text{where } a_k \text{ and } b_k \text{ are the mantissas of } A_k \text{ and } B_k
+ * @f$ }
+ * 
+ * @param[out] a        Output BFP vector @vector{A}
+ * @param[in]  b        Input BFP vector @vector{B}
+ * @param[in]  b_shl    Signed arithmetic left-shift to be applied to mantissas of @vector{B}.
+ */
+void bfp_s8_shl(
+    bfp_s8_t* a,
+    const bfp_s8_t* b,
+    const left_shift_t b_shl);
+
+
+/**
+ * @brief Add two 8-bit BFP vectors together.
+ * 
+ * Add together two input BFP vectors @vector{B} and @vector{C} and store the result
+ * in BFP vector @vector{A}.
+ * 
+ * `a`, `b` and `c` must have been initialized (see bfp_s8_init()), and must be the same length.
+ * 
+ * This operation can be performed safely in-place on `b` or `c`.
+ * 
+ * @bfp_op{8, @f$
+ *      \bar{A} \leftarrow \bar{B} + \bar{C}
+ * @f$ }
+ * 
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ * @param[in]  c     Input BFP vector @vector{C}
+ */
+void bfp_s8_add(
+    bfp_s8_t* a,
+    const bfp_s8_t* b,
+    const bfp_s8_t* c);
+
+
+/**
+ * @brief Subtract one 8-bit BFP vector from another.
+ * 
+ * Subtract input BFP vector @vector{C} from input BFP vector @vector{B} and store the result in BFP vector @vector{A}.
+ * 
+ * `a`, `b` and `c` must have been initialized (see bfp_s8_init()), and must be the same length.
+ * 
+ * This operation can be performed safely in-place on `b` or `c`.
+ * 
+ * @bfp_op{8, @f$
+ *      \bar{A} \leftarrow \bar{B} - \bar{C}
+ * @f$ }
+ * 
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ * @param[in]  c     Input BFP vector @vector{C}
+ */
+void bfp_s8_sub(
+    bfp_s8_t* a,
+    const bfp_s8_t* b,
+    const bfp_s8_t* c);
+
+
+/**
+ * @brief Multiply one 8-bit BFP vector by another element-wise.
+ * 
+ * Multiply each element of input BFP vector @vector{B} by the corresponding element of input BFP vector @vector{C}
+ * and store the results in output BFP vector @vector{A}.
+ * 
+ * `a`, `b` and `c` must have been initialized (see bfp_s8_init()), and must be the same length.
+ * 
+ * This operation can be performed safely in-place on `b` or `c`.
+ * 
+ * @bfp_op{8, @f$
+ *      A_k \leftarrow B_k \cdot C_k                    \\
+ *          \qquad\text{for } k \in 0\ ...\ (N-1)       \\
+ *          \qquad\text{where } N \text{ is the length of } \bar{B}\text{ and }\bar{C}
+ * @f$ }
+ * 
+ * @param a     Output BFP vector @vector{A}
+ * @param b     Input BFP vector @vector{B}
+ * @param c     Input BFP vector @vector{C}
+ */
+void bfp_s8_mul(
+    bfp_s8_t* a,
+    const bfp_s8_t* b,
+    const bfp_s8_t* c);
+
+
+/**
+ * @brief Multiply an 8-bit BFP vector by a scalar.
+ * 
+ * Multiply input BFP vector @vector{B} by scalar @math{\alpha \cdot 2^{\alpha\_exp}} and store the result in output
+ * BFP vector @vector{A}.
+ * 
+ * `a` and `b` must have been initialized (see bfp_s8_init()), and must be the same length.
+ * 
+ * `alpha` represents the scalar @math{\alpha \cdot 2^{\alpha\_exp}}, where @math{\alpha} is `alpha.mant` and
+ * @math{\alpha\_exp} is `alpha.exp`. Only the 8 most significant bits of @math{\alpha} (after removing its headroom)
+ * are used.
+ * 
+ * This operation can be performed safely in-place on `b`.
+ * 
+ * @bfp_op{8, @f$
+ *      \bar{A} \leftarrow \bar{B} \cdot \left(\alpha \cdot 2^{\alpha\_exp}\right)
+ * @f$ }
+ * 
+ * @param[out] a            Output BFP vector @vector{A}
+ * @param[in]  b            Input BFP vector @vector{B}
+ * @param[in]  alpha        Scalar by which @vector{B} is multiplied
+ */
+void bfp_s8_scale(
+    bfp_s8_t* a,
+    const bfp_s8_t* b,
+    const float_s16_t alpha);
+
+
+/**
+ * @brief Compute the inner product of two 8-bit BFP vectors.
+ * 
+ * Adds together the element-wise products of input BFP vectors @vector{B} and @vector{C} for a result
+ * @math{A = a \cdot 2^{a\_exp}}, where @math{a} is the 64-bit mantissa of the result and @math{a\_exp} is its
+ * associated exponent. @math{A} is returned.
+ * 
+ * `b` and `c` must have been initialized (see bfp_s8_init()), and must be the same length.
+ * 
+ * @bfp_op{8, @f$
+ *      a \cdot 2^{a\_exp} \leftarrow \sum_{k=0}^{N-1} \left( B_k \cdot C_k \right)     \\
+ *          \qquad\text{where } N \text{ is the length of } \bar{B}\text{ and }\bar{C}
+ * @f$ }
+ * 
+ * @param[in]  b        Input BFP vector @vector{B}
+ * @param[in]  c        Input BFP vector @vector{C}
+ * 
+ * @returns     @math{A}, the inner product of vectors @vector{B} and @vector{C}
+ */
+float_s64_t bfp_s8_dot(
+    const bfp_s8_t* b,
+    const bfp_s8_t* c);
+
+
+/**
+ * @brief Convert a 16-bit BFP vector into an 8-bit BFP vector.
+ * 
+ * Reduces the bit-depth of each 16-bit element @math{B_k} of input BFP vector @vector{B} to 8 bits, and stores the
+ * 8-bit result in the corresponding element @math{A_k} of output BFP vector @vector{A}.
+ * 
+ * `a` and `b` must have been initialized (see bfp_s16_init() and bfp_s8_init()), and must be the same length.
+ * 
+ * As much precision as possible will be retained.
+ * 
+ * @bfp_op{16, @f$
+ *      A_k \overset{8-bit}{\longleftarrow} B_k         \\
+ *          \qquad\text{for } k \in 0\ ...\ (N-1)       \\
+ *          \qquad\text{where } N \text{ is the length of } \bar{B}
+ * @f$ }
+ * 
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ **/
+void bfp_s16_to_s8(
+    bfp_s8_t* a,
+    const bfp_s16_t* b);
+
+
+/**
+ * @brief Convert a 32-bit BFP vector into an 8-bit BFP vector.
+ * 
+ * Reduces the bit-depth of each 32-bit element @math{B_k} of input BFP vector @vector{B} to 8 bits, and stores the
+ * 8-bit result in the corresponding element @math{A_k} of output BFP vector @vector{A}.
+ * 
+ * `a` and `b` must have been initialized (see bfp_s32_init() and bfp_s8_init()), and must be the same length.
+ * 
+ * As much precision as possible will be retained.
+ * 
+ * @bfp_op{32, @f$
+ *      A_k \overset{8-bit}{\longleftarrow} B_k         \\
+ *          \qquad\text{for } k \in 0\ ...\ (N-1)       \\
+ *          \qquad\text{where } N \text{ is the length of } \bar{B}
+ * @f$ }
+ * 
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ **/
+void bfp_s32_to_s8(
+    bfp_s8_t* a,
+    const bfp_s32_t* b);
+
+
+/**
+ * @brief Convert an 8-bit BFP vector into a 16-bit BFP vector.
+ * 
+ * Increases the bit-depth of each 8-bit element @math{B_k} of input BFP vector @vector{B} to 16 bits, and stores the
+ * 16-bit result in the corresponding element @math{A_k} of output BFP vector @vector{A}.
+ * 
+ * `a` and `b` must have been initialized (see bfp_s8_init() and bfp_s16_init()), and must be the same length.
+ * 
+ * @bfp_op{8, @f$
+ *      A_k \overset{16-bit}{\longleftarrow} B_k        \\
+ *          \qquad\text{for } k \in 0\ ...\ (N-1)       \\
+ *          \qquad\text{where } N \text{ is the length of } \bar{B}
+ * @f$ }
+ * 
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ **/
+void bfp_s8_to_s16(
+    bfp_s16_t* a,
+    const bfp_s8_t* b);
+
+
+/**
+ * @brief Convert an 8-bit BFP vector into a 32-bit BFP vector.
+ * 
+ * Increases the bit-depth of each 8-bit element @math{B_k} of input BFP vector @vector{B} to 32 bits, and stores the
+ * 32-bit result in the corresponding element @math{A_k} of output BFP vector @vector{A}.
+ * 
+ * `a` and `b` must have been initialized (see bfp_s8_init() and bfp_s32_init()), and must be the same length.
+ * 
+ * @bfp_op{8, @f$
+ *      A_k \overset{32-bit}{\longleftarrow} B_k        \\
+ *          \qquad\text{for } k \in 0\ ...\ (N-1)       \\
+ *          \qquad\text{where } N \text{ is the length of } \bar{B}
+ * @f$ }
+ * 
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ **/
+void bfp_s8_to_s32(
+    bfp_s32_t* a,
+    const bfp_s8_t* b);
+
+
+#if defined(__XC__) || defined(__cplusplus)
+}   //extern "C"
+#endif
+
+#endif //BFP_S8_H_
@@ -0,0 +1,143 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#ifndef BFP_STFT_H_
+#define BFP_STFT_H_
+
+#include "xs3_math_types.h"
+
+#if defined(__XC__) || defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/**
+ * @brief Streaming Short-Time Fourier Transform (STFT) and inverse STFT.
+ *
+ * This struct holds the state of a streaming STFT with frame length @math{N} and hop size @math{H}. Each call to
+ * bfp_stft_forward() consumes a block of @math{H} new time-domain samples and returns the (real) DFT of the most recent
+ * @math{N} samples, multiplied by the analysis window. Each call to bfp_stft_inverse() consumes such a spectrum
+ * (possibly modified), inverse-DFTs it, applies the synthesis window and overlap-adds the result with previous frames,
+ * returning a block of @math{H} time-domain samples.
+ *
+ * The input and output sample blocks are plain `int32_t` arrays whose samples all have the exponent `sample_exp` given
+ * when the STFT is initialized (e.g. @math{-31} for Q1.31 audio). Internally, frames and the overlap-add tail are kept
+ * in block floating-point, and each is brought to the appropriate exponent as it is combined.
+ *
+ * The @math{N-H} samples of input history and the overlap-add tail are each kept in a ring buffer, so they are never
+ * shifted along. The FFTs are performed in-place in the frame buffer, and the spectrum returned by bfp_stft_forward()
+ * points into that buffer.
+ *
+ * The analysis and synthesis windows are Q2.30 (i.e. @math{1.0} is `0x40000000`). Either may be `NULL`, which is
+ * equivalent to a rectangular window. For the output of the inverse STFT to reconstruct the input (with a delay of
+ * @math{N-H} samples), the product of the windows, summed over all frames overlapping each sample, should be
+ * @math{1}. For example, with @math{H = N/2}, both windows may be the square root of a periodic Hann window.
+ *
+ * `H` must be no larger than @math{N/2}, and `N` must satisfy the same constraints as for bfp_fft_forward_mono().
+ *
+ * The fields of this struct should not be modified directly. Use bfp_stft_init() to initialize it.
+ */
+typedef struct {
+    /** Frame length (FFT length) @math{N} */
+    unsigned frame_length;
+    /** Hop size @math{H} */
+    unsigned hop;
+    /** Exponent of the input and output sample blocks */
+    exponent_t sample_exp;
+    /** Analysis window (Q2.30, @math{N} elements), or `NULL` */
+    const int32_t* analysis_window;
+    /** Synthesis window (Q2.30, @math{N} elements), or `NULL` */
+    const int32_t* synthesis_window;
+    /** Frame buffer, @math{N} elements */
+    bfp_s32_t frame;
+    /** Ring buffer of the @math{N-H} most recent input samples */
+    int32_t* history;
+    /** Index of the oldest sample in `history` */
+    unsigned history_head;
+    /** Ring buffer of the @math{N-H}-sample overlap-add tail */
+    int32_t* overlap;
+    /** Index of the oldest sample in `overlap` */
+    unsigned overlap_head;
+    /** Exponent of `overlap` */
+    exponent_t overlap_exp;
+    /** Headroom of `overlap` */
+    headroom_t overlap_hr;
+} bfp_stft_t;
+
+
+/**
+ * @brief Initialize a streaming STFT.
+ *
+ * `frame_buff` must have space for @math{N} = `frame_length` elements, and `history_buff` and `overlap_buff` must each
+ * have space for @math{N-H} elements (where @math{H} = `hop`). The buffers and windows must remain valid for as long as
+ * the STFT is in use. The history and overlap-add tail are cleared to zero.
+ *
+ * `frame_buff` must be double-word-aligned, as required by the FFT.
+ *
+ * @param[out] stft             STFT to be initialized
+ * @param[in]  frame_buff       Frame buffer, @math{N} elements
+ * @param[in]  history_buff     Input history buffer, @math{N-H} elements
+ * @param[in]  overlap_buff     Overlap-add buffer, @math{N-H} elements
+ * @param[in]  analysis_window  Q2.30 analysis window, @math{N} elements, or `NULL`
+ * @param[in]  synthesis_window Q2.30 synthesis window, @math{N} elements, or `NULL`
+ * @param[in]  frame_length     Frame length @math{N}
+ * @param[in]  hop              Hop size @math{H}
+ * @param[in]  sample_exp       Exponent of input and output sample blocks
+ */
+void bfp_stft_init(
+    bfp_stft_t* stft,
+    int32_t frame_buff[],
+    int32_t history_buff[],
+    int32_t overlap_buff[],
+    const int32_t analysis_window[],
+    const int32_t synthesis_window[],
+    const unsigned frame_length,
+    const unsigned hop,
+    const exponent_t sample_exp);
+
+
+/**
+ * @brief Perform one step of a streaming STFT.
+ *
+ * Consumes @math{H} new samples `samples[]` (with exponent `stft->sample_exp`) and returns the DFT of the windowed
+ * frame made up of the @math{N} most recent samples. The spectrum is encoded as for bfp_fft_forward_mono().
+ *
+ * The returned spectrum lives in the STFT's frame buffer. It remains valid (and may be modified in-place) until the
+ * next call to bfp_stft_forward() or bfp_stft_inverse().
+ *
+ * @param[inout] stft       STFT state
+ * @param[in]    samples    @math{H} new input samples
+ *
+ * @return The spectrum of the new frame, @math{N/2} complex elements
+ */
+bfp_complex_s32_t* bfp_stft_forward(
+    bfp_stft_t* stft,
+    const int32_t samples[]);
+
+
+/**
+ * @brief Perform one step of a streaming inverse STFT.
+ *
+ * Inverse-DFTs the spectrum `X` (encoded as for bfp_fft_inverse_mono(), with length @math{N/2}), applies the synthesis
+ * window and overlap-adds the resulting frame with those before it. The @math{H} completed output samples are written
+ * to `samples_out[]` with exponent `stft->sample_exp`, saturating if necessary.
+ *
+ * The inverse DFT is performed in-place, so `X` is destroyed. `X` will typically be (and need not be other than) the
+ * spectrum returned by the preceding call to bfp_stft_forward().
+ *
+ * @param[inout] stft           STFT state
+ * @param[out]   samples_out    @math{H} output samples
+ * @param[inout] X              Spectrum of the frame to be synthesized
+ */
+void bfp_stft_inverse(
+    bfp_stft_t* stft,
+    int32_t samples_out[],
+    bfp_complex_s32_t* X);
+
+
+#if defined(__XC__) || defined(__cplusplus)
+}   //extern "C"
+#endif
+
+#endif //BFP_STFT_H_
@@ -14,10 +14,14 @@
 #include "xs3_math.h"
 
 #include "bfp/bfp_init.h"
+#include "bfp/bfp_arena.h"
 #include "bfp/bfp.h"
+#include "bfp/bfp_s8.h"
 #include "bfp/bfp_complex.h"
 #include "bfp/bfp_ch_pair.h"
 #include "bfp/bfp_fft.h"
+#include "bfp/bfp_stft.h"
+#include "bfp/bfp_filters.h"
 
 
 #endif //BFP_MATH_H_
\ No newline at end of file
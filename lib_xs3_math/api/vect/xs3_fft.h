@@ -6,7 +6,7 @@
 
 // #include "xs3_fft_lut.h"
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -40,6 +40,48 @@ void xs3_fft_index_bit_reversal(
     complex_s32_t x[],
     const unsigned length);
 
+/**
+ * @brief Computes the index bit-reversal permutation for an FFT.
+ *
+ * On return, `bitrev[k]` is the bit-reversal of `k` (considering the @math{log2(length)} least significant bits), for
+ * @math{0 \le k \lt length}. The table can be passed to xs3_fft_index_bit_reversal_shr() to avoid recomputing the
+ * permutation on every FFT.
+ *
+ * `length` must be a power of 2, no larger than @math{2^{16}}.
+ *
+ * @param[out] bitrev   Output permutation table, `length` elements
+ * @param[in]  length   FFT length
+ */
+void xs3_fft_bit_reversal_table(
+    uint16_t bitrev[],
+    const unsigned length);
+
+/**
+ * @brief Applies the index bit-reversal required for FFTs, together with an arithmetic right-shift.
+ *
+ * This is equivalent to calling xs3_vect_s32_shl() with a shift of `-shr` on the `2*length` words of `x`, followed by
+ * xs3_fft_index_bit_reversal(), except that both operations happen in a single pass over `x`. This saves a full pass
+ * over the data when the input to an FFT must be scaled to obtain the headroom the FFT requires.
+ *
+ * `bitrev` is the permutation table computed by xs3_fft_bit_reversal_table() for `length`.
+ *
+ * As with xs3_vect_s32_shl(), a negative `shr` is a (saturating) left-shift.
+ *
+ * `x` is updated in-place.
+ *
+ * @param[inout] x      The vector to be shifted and have its elements reordered.
+ * @param[in]    length The length of `x` (element count).
+ * @param[in]    shr    Arithmetic right-shift applied to each element
+ * @param[in]    bitrev Bit-reversal permutation table for `length`
+ *
+ * @return The headroom of the resulting vector `x`
+ */
+headroom_t xs3_fft_index_bit_reversal_shr(
+    complex_s32_t x[],
+    const unsigned length,
+    const right_shift_t shr,
+    const uint16_t bitrev[]);
+
 /**
  * @brief Splits the merged spectrum that results from DFTing a pair of real signals together.
  * 
@@ -153,11 +195,15 @@ headroom_t xs3_fft_spectra_merge(
  * 
  * `inverse` should be `1` if the inverse DFT is being computed, and `0` otherwise.
  * 
+ * The adjustment can use up a bit of the spectrum's headroom, so its headroom afterwards is returned.
+ * 
  * @param[in] x         The spectrum @math{X[f]} to be modified.
  * @param[in] length    The size of the DFT to be computed. Twice the length of `x` (in elements).
  * @param[in] inverse   Flag indicating whether the inverse DFT is being computed.
+ * 
+ * @returns     Headroom of the adjusted spectrum
  */
-void xs3_fft_mono_adjust(
+headroom_t xs3_fft_mono_adjust(
     complex_s32_t x[],
     const unsigned length,
     const unsigned inverse);
@@ -303,7 +349,325 @@ void xs3_fft_dif_inverse (
     exponent_t* exp);
 
 
-#ifdef __XC__
+
+/**
+ * @brief Applies the index bit-reversal required for 16-bit FFTs.
+ * 
+ * This is the 16-bit equivalent of xs3_fft_index_bit_reversal(), and operates on a single array of 16-bit values. To
+ * reorder a complex vector stored as separate real and imaginary arrays (as in `bfp_complex_s16_t`), apply it to each
+ * array.
+ * 
+ * `x` is updated in-place.
+ * 
+ * `length` must be a power of 2.
+ * 
+ * @param[inout] x      The vector to have its elements reordered.
+ * @param[in] length    The length of `x` (element count).
+ */
+void xs3_fft_index_bit_reversal_s16(
+    int16_t x[],
+    const unsigned length);
+
+/**
+ * @brief Compute a forward DFT of a 16-bit complex vector using the decimation-in-time FFT algorithm.
+ * 
+ * This function computes the `N`-point forward DFT of a complex input signal, represented by the 16-bit arrays 
+ * `real[]` and `imag[]`, using the decimation-in-time FFT algorithm. The result is computed in-place. The input must
+ * be in bit-reversed order (see xs3_fft_index_bit_reversal_s16()).
+ * 
+ * Conceptually, the operation performed is the following:
+ * 
+ * \f[
+ *      X[f] = \frac{1}{2^{\alpha}} \sum_{n=0}^{N-1} \left( x[n]\cdot e^{-j2\pi fn/N} \right)
+ *      \text{ for } 0 \le f \lt N
+ * \f]
+ * 
+ * `real[]` and `imag[]` are interpreted to be a block floating-point vector with shared exponent `*exp` and with `*hr`
+ * bits of headroom. Before each stage of the FFT the data is scaled to have 2 bits of headroom (the scaling being 
+ * applied with rounding as the results of the previous stage are stored), so the input may have any amount of 
+ * headroom and saturation cannot occur. In the equation above, @math{\alpha} represents the (net) number of bits that
+ * the data was right-shifted by.
+ * 
+ * Upon completion, `*hr` is updated with the final headroom in the data, and the exponent `*exp` is incremented by 
+ * @math{\alpha}.
+ * 
+ * The twiddle factors are 16-bit (Q14) values taken from a quarter-wave sine table. `N` must be a power of 2, no 
+ * larger than `(1<<XS3_MATH_FFT_MAX_LOG2)`.
+ * 
+ * @note There is no VPU kernel for the 16-bit FFTs; they are implemented in C on every platform. Each butterfly is
+ *       four 16x16-bit multiplies with 32-bit intermediate results, and the twiddle factors are looked up once per
+ *       twiddle (`N-1` lookups per transform) rather than once per butterfly. Where speed matters more than memory,
+ *       xs3_fft_dit_forward() on 32-bit data is faster.
+ * 
+ * @param[inout]  real  The real parts of the `N`-element complex input vector.
+ * @param[inout]  imag  The imaginary parts of the `N`-element complex input vector.
+ * @param[in]     N     The size of the DFT to be performed.
+ * @param[inout]  hr    Pointer to the initial headroom in the input vector.
+ * @param[inout]  exp   Pointer to the initial exponent associated with the input vector.
+ */
+void xs3_fft_dit_forward_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp);
+
+/**
+ * @brief Compute an inverse DFT of a 16-bit complex vector using the decimation-in-time IFFT algorithm.
+ * 
+ * This is the inverse of xs3_fft_dit_forward_s16(). The input must be in bit-reversed order.
+ * 
+ * Conceptually, the operation performed is the following:
+ * 
+ * \f[
+ *      x[n] = \frac{1}{2^{\alpha}} \sum_{f=0}^{N-1} \left( X[f]\cdot e^{j2\pi fn/N} \right)
+ *      \text{ for } 0 \le n \lt N
+ * \f]
+ * 
+ * See xs3_fft_dit_forward_s16() for details of the scaling, headroom and length requirements.
+ * 
+ * @param[inout]  real  The real parts of the `N`-element complex input vector.
+ * @param[inout]  imag  The imaginary parts of the `N`-element complex input vector.
+ * @param[in]     N     The size of the inverse DFT to be performed.
+ * @param[inout]  hr    Pointer to the initial headroom in the input vector.
+ * @param[inout]  exp   Pointer to the initial exponent associated with the input vector.
+ */
+void xs3_fft_dit_inverse_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp);
+
+/**
+ * @brief Compute a forward DFT of a 16-bit complex vector using the decimation-in-frequency FFT algorithm.
+ * 
+ * This function computes the same transform as xs3_fft_dit_forward_s16(), except that the input is in natural order
+ * and the output is left in bit-reversed order.
+ * 
+ * See xs3_fft_dit_forward_s16() for details of the scaling, headroom and length requirements.
+ * 
+ * @param[inout]  real  The real parts of the `N`-element complex input vector.
+ * @param[inout]  imag  The imaginary parts of the `N`-element complex input vector.
+ * @param[in]     N     The size of the DFT to be performed.
+ * @param[inout]  hr    Pointer to the initial headroom in the input vector.
+ * @param[inout]  exp   Pointer to the initial exponent associated with the input vector.
+ */
+void xs3_fft_dif_forward_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp);
+
+/**
+ * @brief Compute an inverse DFT of a 16-bit complex vector using the decimation-in-frequency IFFT algorithm.
+ * 
+ * This function computes the same transform as xs3_fft_dit_inverse_s16(), except that the input is in natural order
+ * and the output is left in bit-reversed order.
+ * 
+ * See xs3_fft_dit_forward_s16() for details of the scaling, headroom and length requirements.
+ * 
+ * @param[inout]  real  The real parts of the `N`-element complex input vector.
+ * @param[inout]  imag  The imaginary parts of the `N`-element complex input vector.
+ * @param[in]     N     The size of the inverse DFT to be performed.
+ * @param[inout]  hr    Pointer to the initial headroom in the input vector.
+ * @param[inout]  exp   Pointer to the initial exponent associated with the input vector.
+ */
+void xs3_fft_dif_inverse_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp);
+
+/**
+ * @brief Makes the adjustments required when performing a 16-bit mono DFT or IDFT.
+ * 
+ * This is the 16-bit equivalent of xs3_fft_mono_adjust(). The @math{N/2}-element complex vector to be adjusted is
+ * represented by the arrays `real[]` and `imag[]`. 
+ * 
+ * To perform the @math{N}-point forward DFT on a real signal `x[n]`:
+ * \code
+ *      int16_t x[N] = { ... };
+ *      exponent_t x_exp = ...;
+ *      headroom_t hr = xs3_vect_s16_headroom(x, N);
+ *      xs3_fft_index_bit_reversal_s16(x, N);
+ *      xs3_fft_dit_forward_s16(&x[0], &x[N/2], N/2, &hr, &x_exp);
+ *      xs3_fft_mono_adjust_s16(&x[0], &x[N/2], N, 0, &hr, &x_exp);
+ * \endcode
+ * 
+ * To perform the @math{N}-point inverse DFT on the spectrum `X[n]` of a real signal `x[n]`:
+ * \code
+ *      int16_t x[N] = { ... }; // Real parts of X[f] followed by imaginary parts of X[f]
+ *      exponent_t x_exp = ...;
+ *      headroom_t hr = xs3_vect_s16_headroom(x, N);
+ *      xs3_fft_mono_adjust_s16(&x[0], &x[N/2], N, 1, &hr, &x_exp);
+ *      xs3_fft_dif_inverse_s16(&x[0], &x[N/2], N/2, &hr, &x_exp);
+ *      xs3_fft_index_bit_reversal_s16(x, N);
+ * \endcode
+ * 
+ * The spectrum is packed as specified for real DFTs in @ref spectrum_packing, with `real[0]` holding @math{X[0]} and 
+ * `imag[0]` holding @math{X[N/2]}.
+ * 
+ * Like the 16-bit FFTs, this function scales the data to avoid saturation, updating `*hr` and `*exp` accordingly.
+ * 
+ * @param[inout] real       The real parts of the spectrum to be modified.
+ * @param[inout] imag       The imaginary parts of the spectrum to be modified.
+ * @param[in]    length     The size of the DFT to be computed. Twice the length of `real` (in elements).
+ * @param[in]    inverse    Flag indicating whether the inverse DFT is being computed.
+ * @param[inout] hr         Pointer to the initial headroom in the spectrum.
+ * @param[inout] exp        Pointer to the initial exponent associated with the spectrum.
+ */
+void xs3_fft_mono_adjust_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned length,
+    const unsigned inverse,
+    headroom_t* hr,
+    exponent_t* exp);
+
+
+/**
+ * @brief Check whether an FFT length is supported by the mixed-radix FFT.
+ * 
+ * The mixed-radix FFT (xs3_fft_mixed_forward() and xs3_fft_mixed_inverse()) supports lengths @math{N \ge 2} of the 
+ * form @math{N = 2^a \cdot 3^b \cdot 5^c}, up to @math{2^{17}}. For example, @math{240}, @math{480} and @math{960} 
+ * (5, 10 and 20 ms frames at 48 kHz) are all supported.
+ * 
+ * @param[in] N   The FFT length.
+ * 
+ * @returns Non-zero iff `N` is a supported mixed-radix FFT length.
+ */
+unsigned xs3_fft_mixed_is_supported(
+    const unsigned N);
+
+/**
+ * @brief Applies the index digit-reversal required for the mixed-radix FFT.
+ * 
+ * This is the mixed-radix equivalent of xs3_fft_index_bit_reversal(). It rearranges the elements of `x[]` into the
+ * (mixed-radix) digit-reversed order required by xs3_fft_mixed_forward() and xs3_fft_mixed_inverse(). The radices used
+ * (and therefore the ordering) depend only on `N`.
+ * 
+ * `x` is updated in-place, and no extra memory is needed. Each element is moved once, one cycle of the permutation at
+ * a time. Each cycle is applied from its smallest index, which is found by walking the cycle, so the index arithmetic
+ * costs a few times that of moving the elements.
+ * 
+ * `N` must be a supported mixed-radix FFT length (see xs3_fft_mixed_is_supported()).
+ * 
+ * @param[inout] x  The vector to have its elements reordered.
+ * @param[in]    N  The length of `x` (element count).
+ */
+void xs3_fft_index_digit_reversal(
+    complex_s32_t x[],
+    const unsigned N);
+
+/**
+ * @brief Compute a forward DFT of any length @math{N = 2^a \cdot 3^b \cdot 5^c} using a mixed-radix FFT.
+ * 
+ * This function computes the `N`-point forward DFT of a complex input signal using a decimation-in-time FFT built from
+ * radix-4, radix-2, radix-3 and radix-5 stages. The result is computed in-place. The input must first have been put 
+ * into digit-reversed order using xs3_fft_index_digit_reversal().
+ * 
+ * Conceptually, the operation performed is the following:
+ * 
+ * \f[
+ *      X[f] = \frac{1}{2^{\alpha}} \sum_{n=0}^{N-1} \left( x[n]\cdot e^{-j2\pi fn/N} \right)
+ *      \text{ for } 0 \le f \lt N
+ * \f]
+ * 
+ * `x[]` is interpreted to be a block floating-point vector with shared exponent `*exp` and with `*hr` bits of headroom
+ * initially in `x[]`. As with xs3_fft_dit_forward(), the headroom of the data is monitored from stage to stage, and 
+ * the data is shifted up or down as appropriate to avoid overflows and underflows. Unlike xs3_fft_dit_forward(), no 
+ * particular initial headroom is required. In the equation above, @math{\alpha} represents the (net) number of bits 
+ * that the data was right-shifted by.
+ * 
+ * Upon completion, `*hr` is updated with the final headroom in `x[]`, and the exponent `*exp` is incremented by 
+ * @math{\alpha}.
+ * 
+ * The twiddle factors are computed as they are needed rather than taken from the FFT look-up tables, so this function
+ * is slower than xs3_fft_dit_forward() for power-of-2 lengths.
+ * 
+ * @param[inout]  x     The `N`-element complex input vector to be transformed.
+ * @param[in]     N     The size of the DFT to be performed. See xs3_fft_mixed_is_supported().
+ * @param[inout]  hr    Pointer to the initial headroom in `x[]`.
+ * @param[inout]  exp   Pointer to the initial exponent associated with `x[]`.
+ */
+void xs3_fft_mixed_forward(
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp);
+
+/**
+ * @brief Compute an inverse DFT of any length @math{N = 2^a \cdot 3^b \cdot 5^c} using a mixed-radix IFFT.
+ * 
+ * This is the inverse of xs3_fft_mixed_forward(). The input must first have been put into digit-reversed order using
+ * xs3_fft_index_digit_reversal().
+ * 
+ * Conceptually, the operation performed is the following:
+ * 
+ * \f[
+ *      x[n] = \frac{1}{2^{\alpha}} \sum_{f=0}^{N-1} \left( X[f]\cdot e^{j2\pi fn/N} \right)
+ *      \text{ for } 0 \le n \lt N
+ * \f]
+ * 
+ * See xs3_fft_mixed_forward() for details of the scaling and length requirements.
+ * 
+ * @param[inout]  x     The `N`-element complex input vector to be transformed.
+ * @param[in]     N     The size of the inverse DFT to be performed. See xs3_fft_mixed_is_supported().
+ * @param[inout]  hr    Pointer to the initial headroom in `x[]`.
+ * @param[inout]  exp   Pointer to the initial exponent associated with `x[]`.
+ */
+void xs3_fft_mixed_inverse(
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp);
+
+/**
+ * @brief Makes the adjustments required when performing a mixed-radix mono DFT or IDFT.
+ * 
+ * This is the equivalent of xs3_fft_mono_adjust() for use with the mixed-radix FFT, for any even `length` whose half is
+ * a supported mixed-radix FFT length. Unlike xs3_fft_mono_adjust(), this function requires no particular headroom in 
+ * `x[]`; it scales the data as needed to avoid saturation, updating `*hr` and `*exp` accordingly.
+ * 
+ * To perform the @math{N}-point forward DFT on a real signal `x[n]`:
+ * \code
+ *      int32_t x[N] = { ... };
+ *      complex_s32_t* X = (complex_s32_t*)x;
+ *      exponent_t x_exp = ...;
+ *      headroom_t hr = xs3_vect_s32_headroom(x, N);
+ *      xs3_fft_index_digit_reversal(X, N/2);
+ *      xs3_fft_mixed_forward(X, N/2, &hr, &x_exp);
+ *      xs3_fft_mono_adjust_mixed(X, N, 0, &hr, &x_exp);
+ * \endcode
+ * 
+ * To perform the @math{N}-point inverse DFT on the spectrum `X[n]` of a real signal `x[n]`:
+ * \code
+ *      complex_s32_t X[N/2] = { ... };
+ *      int32_t* x = (int32_t*)X;
+ *      exponent_t X_exp = ...;
+ *      headroom_t hr = xs3_vect_s32_headroom(x, N);
+ *      xs3_fft_mono_adjust_mixed(X, N, 1, &hr, &X_exp);
+ *      xs3_fft_index_digit_reversal(X, N/2);
+ *      xs3_fft_mixed_inverse(X, N/2, &hr, &X_exp);
+ * \endcode
+ * 
+ * @param[inout] x          The spectrum to be modified.
+ * @param[in]    length     The size of the DFT to be computed. Twice the length of `x` (in elements).
+ * @param[in]    inverse    Flag indicating whether the inverse DFT is being computed.
+ * @param[inout] hr         Pointer to the initial headroom in `x[]`.
+ * @param[inout] exp        Pointer to the initial exponent associated with `x[]`.
+ */
+void xs3_fft_mono_adjust_mixed(
+    complex_s32_t x[],
+    const unsigned length,
+    const unsigned inverse,
+    headroom_t* hr,
+    exponent_t* exp);
+
+#if defined(__XC__) || defined(__cplusplus)
 }   //extern "C"
 #endif
 
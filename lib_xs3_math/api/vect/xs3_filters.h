@@ -6,7 +6,7 @@
 
 #include "xs3_math_types.h"
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -80,6 +80,9 @@ extern "C" {
  * 
  * **Process Sample**: To process a new input sample and produce a new output sample, use xs3_filter_fir_s32().  
  * 
+ * **Process Block**: To process a block of new input samples and produce a block of output samples, use 
+ * xs3_filter_fir_s32_block(). The outputs are the same as with repeated calls to xs3_filter_fir_s32().
+ * 
  * @par Fields
  * 
  * After initialization via xs3_filter_fir_s32_init(), the contents of the `xs3_filter_fir_s32_t` struct are considered
@@ -297,6 +300,36 @@ int32_t xs3_filter_fir_s32(
     const int32_t new_sample);
 
 
+/**
+ * @brief Process a block of samples with a 32-bit FIR filter.
+ * 
+ * The `length` new input samples `new_samples[]` are added to this filter's state in order, and the `length` 
+ * corresponding output samples are placed in `output[]`. `output[k]` is exactly the value which would have been 
+ * returned by xs3_filter_fir_s32() for input sample `new_samples[k]`.
+ * 
+ * This is a convenience wrapper. On xcore it calls xs3_filter_fir_s32() once per sample, so it is no faster than doing 
+ * so directly.
+ * 
+ * @note There is no xcore kernel which computes several outputs per coefficient load. The reference (C) build 
+ *       register-blocks over outputs, but the xcore build does not.
+ * 
+ * `output[]` may not overlap `new_samples[]` unless they are the same array.
+ * 
+ * @param[inout]    filter          Filter to be processed
+ * @param[out]      output          Output samples, `length` elements
+ * @param[in]       new_samples     New input samples, `length` elements
+ * @param[in]       length          Number of samples to process
+ * 
+ * @see xs3_filter_fir_s32_t
+ * @see xs3_filter_fir_s32()
+ */
+void xs3_filter_fir_s32_block(
+    xs3_filter_fir_s32_t* filter,
+    int32_t output[],
+    const int32_t new_samples[],
+    const unsigned length);
+
+
 /**
  * @brief 16-bit Discrete-Time Finite Impulse Response (FIR) Filter
  * 
@@ -354,14 +387,20 @@ int32_t xs3_filter_fir_s32(
  * supplies information about the filter, including the number of taps and pointers the coefficients and a state buffer. 
  * It is typically recommended that the state buffer be cleared to all `0`s before initializing.
  * 
+ * **Initialize (circular)**: Alternatively, a filter can be initialized with xs3_filter_fir_s16_init_circular(), in 
+ * which case the state buffer is used as a circular buffer (see Circular State below).
+ * 
  * **Add Sample**: To add a new input sample without computing a new output sample, use 
- * xs3_filter_fir_s16_add_sample(). Unlike xs3_filter_fir_s32_add_sample(), this is not a constant-time operation, and 
- * does depend on the number of filter taps. Nevertheless, this is faster than computing output samples, and may be 
- * useful in some situations, for example, to moer quickly pre-load the filter's state buffer with multiple samples, 
- * without incurring the cost of computing an output with each added sample.
+ * xs3_filter_fir_s16_add_sample(). Unless the filter was initialized with xs3_filter_fir_s16_init_circular(), this is 
+ * not a constant-time operation, and does depend on the number of filter taps. Nevertheless, this is faster than 
+ * computing output samples, and may be useful in some situations, for example, to moer quickly pre-load the filter's 
+ * state buffer with multiple samples, without incurring the cost of computing an output with each added sample.
  * 
  * **Process Sample**: To process a new input sample and produce a new output sample, use xs3_filter_fir_s16().
  * 
+ * **Process Block**: To process a block of new input samples and produce a block of output samples, use 
+ * xs3_filter_fir_s16_block(). The outputs are the same as with repeated calls to xs3_filter_fir_s16().
+ * 
  * @par Fields
  * 
  * After initialization via xs3_filter_fir_s16_init(), the contents of the `xs3_filter_fir_s16_t` struct are considered
@@ -383,6 +422,24 @@ int32_t xs3_filter_fir_s32(
  * `state` is a pointer to a buffer (supplied by the user at initialization) containing the state data -- a history of
  * the `num_taps` most recent input samples. `state` must begin at a word-aligned address.
  * 
+ * `circular` is nonzero if the filter was initialized with xs3_filter_fir_s16_init_circular(), and `head` is then the
+ * position in the circular buffer of the most recent input sample.
+ * 
+ * `window` points to the `num_taps` most recent input samples, newest first, as a contiguous word-aligned vector. This is
+ * the vector whose inner product with `coef` gives the filter output. Unless `circular` is nonzero, it is just `state`.
+ * 
+ * @par Circular State
+ * 
+ * By default, each new input sample is added to the state by moving every sample in the state buffer up by one
+ * element, which costs time proportional to `num_taps`. With xs3_filter_fir_s16_init_circular(), the state is instead
+ * kept in a circular buffer, and adding a sample costs the same regardless of the number of taps.
+ * 
+ * The circular buffer is mirrored: every sample is stored both at position `head` and at `head + num_taps`, so that
+ * the `num_taps` most recent samples always form a single contiguous vector starting at `head`. Because the VPU needs
+ * that vector to be word-aligned, the state buffer actually holds two such mirrored buffers of `2*num_taps` elements,
+ * the second storing each sample one position further along than the first. Whichever of them has its window at an
+ * even index is used. The state buffer must therefore be `4*num_taps` elements long.
+ * 
  * 
  * @par Coefficient Scaling
  * 
@@ -417,9 +474,24 @@ typedef struct {
     int16_t* coef;
 
     /**
-     * Pointer to a circular buffer containing the previous input samples. Must point to word-aligned address.
+     * Pointer to a buffer containing the previous input samples. Must point to word-aligned address.
      */
     int16_t* state;
+
+    /**
+     * Nonzero if `state` is a (mirrored) circular buffer.
+     */
+    unsigned circular;
+
+    /**
+     * Position of the most recent input sample in the circular buffer. Only used if `circular` is nonzero.
+     */
+    unsigned head;
+
+    /**
+     * Pointer to the `num_taps` most recent input samples, newest first. Always word-aligned.
+     */
+    int16_t* window;
 } xs3_filter_fir_s16_t;
 
 /**
@@ -438,6 +510,31 @@ void xs3_filter_fir_s16_init(
     const int16_t* coefficients,
     const right_shift_t shift);
 
+/**
+ * @brief Initialize a 16-bit FIR filter with circular state.
+ * 
+ * This is the same as xs3_filter_fir_s16_init(), except that the filter keeps its state in a circular buffer, so that 
+ * adding a sample to the filter is a constant-time operation (see `xs3_filter_fir_s16_t`).
+ * 
+ * `sample_buffer` must be at least `4 * tap_count` elements long, and aligned to a 4-byte (word) boundary. It is 
+ * cleared to all `0`s by this function.
+ * 
+ * @param[out] filter           Filter struct to be initialized
+ * @param[in]  sample_buffer    Buffer used by the `filter` to contain state information. Must be `4*tap_count` 
+ *                              elements.
+ * @param[in]  tap_count        Order of the FIR filter; number of filter taps
+ * @param[in]  coefficients     Array containing filter coefficients
+ * @param[in]  shift            Unsigned arithmetic right-shift applied to accumulator to get filter output sample
+ * 
+ * @see xs3_filter_fir_s16_t
+ */
+void xs3_filter_fir_s16_init_circular(
+    xs3_filter_fir_s16_t* filter,
+    int16_t* sample_buffer,
+    const unsigned tap_count,
+    const int16_t* coefficients,
+    const right_shift_t shift);
+
 /**
  * @brief
  * 
@@ -463,6 +560,834 @@ int16_t xs3_filter_fir_s16(
     const int16_t new_sample);
 
 
+/**
+ * @brief Process a block of samples with a 16-bit FIR filter.
+ * 
+ * The `length` new input samples `new_samples[]` are added to this filter's state in order, and the `length` 
+ * corresponding output samples are placed in `output[]`. `output[k]` is exactly the value which would have been 
+ * returned by xs3_filter_fir_s16() for input sample `new_samples[k]`.
+ * 
+ * This is a convenience wrapper. On xcore it calls xs3_filter_fir_s16() once per sample, so it is no faster than doing 
+ * so directly.
+ * 
+ * @note There is no xcore kernel which computes several outputs per coefficient load. The reference (C) build 
+ *       register-blocks over outputs, but the xcore build does not.
+ * 
+ * `output[]` may not overlap `new_samples[]` unless they are the same array.
+ * 
+ * @param[inout]    filter          Filter to be processed
+ * @param[out]      output          Output samples, `length` elements
+ * @param[in]       new_samples     New input samples, `length` elements
+ * @param[in]       length          Number of samples to process
+ * 
+ * @see xs3_filter_fir_s16_t
+ * @see xs3_filter_fir_s16()
+ */
+void xs3_filter_fir_s16_block(
+    xs3_filter_fir_s16_t* filter,
+    int16_t output[],
+    const int16_t new_samples[],
+    const unsigned length);
+
+
+/**
+ * @brief Number of elements needed in the sample buffer of a symmetric 32-bit FIR filter.
+ * 
+ * @see xs3_filter_fir_sym_s32_init()
+ */
+#define XS3_FILTER_FIR_SYM_S32_STATE_LEN(TAP_COUNT)     (2*(TAP_COUNT) + ((TAP_COUNT) + 1) / 2)
+
+
+/**
+ * @brief Symmetric (linear-phase) 32-bit FIR filter.
+ * 
+ * This is an `N`-tap FIR filter whose coefficients are symmetric, i.e. @math{b[k] = b[N-1-k]}, as is the case for any
+ * linear-phase FIR filter. Only the first `M = ceil(N/2)` coefficients are stored. For each output, the two input
+ * samples which share a coefficient are added together first, and then only `M` multiply-accumulates are needed:
+ * 
+ * @f$
+ *      acc = \sum_{k=0}^{M-1} b[k] \cdot (x[t-k] + x[t-(N-1-k)])
+ * @f$
+ * 
+ * where for odd `N` the middle sample @math{x[t-(M-1)]} is not doubled. This halves the coefficient memory and the 
+ * number of multiply-accumulates relative to `xs3_filter_fir_s32_t`. The pairs are added in a separate vector pass 
+ * over `N-M` elements before the `M`-element inner product, so the time per sample is reduced by less than half.
+ * 
+ * The coefficients and `shift` have the same meaning as for `xs3_filter_fir_s32_t`, and the result is the same as 
+ * that of a full `xs3_filter_fir_s32_t` with the mirrored coefficients, except for rounding: the full form rounds each
+ * of the two products separately, whereas here the sum is multiplied and rounded once. The accumulator therefore 
+ * differs from that of the full form by at most one LSb per coefficient pair, and typically much less. Input samples 
+ * should have at least 1 bit of headroom, so that the pre-added pairs do not saturate.
+ * 
+ * To keep adding a sample a constant-time operation, the state holds two mirrored circular buffers: the newest `M` 
+ * samples in newest-first order, and the oldest `N-M` samples in oldest-first order. The sample buffer therefore needs
+ * `XS3_FILTER_FIR_SYM_S32_STATE_LEN(N)` elements, including space for the pre-added pairs.
+ * 
+ * @see xs3_filter_fir_sym_s32_init()
+ * @see xs3_filter_fir_sym_s32_add_sample()
+ * @see xs3_filter_fir_sym_s32()
+ */
+typedef struct {
+    /**
+     * The number of taps `N` in the FIR filter.
+     */
+    unsigned num_taps;
+
+    /**
+     * Unsigned arithmetic rounding right-shift applied to accumulator when computing filter output.
+     */
+    right_shift_t shift;
+
+    /**
+     * Pointer to a buffer containing the first `ceil(N/2)` filter coefficients.
+     */
+    int32_t* coef;
+
+    /**
+     * Pointer to the sample buffer.
+     */
+    int32_t* state;
+
+    /**
+     * Position of the newest sample in the newest-first buffer.
+     */
+    unsigned head;
+
+    /**
+     * Position of the oldest sample in the oldest-first buffer.
+     */
+    unsigned tail;
+} xs3_filter_fir_sym_s32_t;
+
+
+/**
+ * @brief Initialize a symmetric 32-bit FIR filter.
+ * 
+ * `coefficients` holds the first `(tap_count+1)/2` coefficients @math{b[k]} of the filter. `sample_buffer` must be at
+ * least `XS3_FILTER_FIR_SYM_S32_STATE_LEN(tap_count)` elements long. It is cleared to all `0`s by this function. Both 
+ * must be aligned to a 4-byte (word) boundary.
+ * 
+ * @param[out] filter           Filter struct to be initialized
+ * @param[in]  sample_buffer    Buffer used by the filter to contain state information
+ * @param[in]  tap_count        Order of the FIR filter; number of filter taps `N`
+ * @param[in]  coefficients     Array containing the first `ceil(N/2)` filter coefficients
+ * @param[in]  shift            Unsigned arithmetic right-shift applied to accumulator to get filter output sample
+ * 
+ * @see xs3_filter_fir_sym_s32_t
+ */
+void xs3_filter_fir_sym_s32_init(
+    xs3_filter_fir_sym_s32_t* filter,
+    int32_t* sample_buffer,
+    const unsigned tap_count,
+    const int32_t* coefficients,
+    const right_shift_t shift);
+
+
+/**
+ * @brief Add a new input sample to a symmetric 32-bit FIR filter without processing an output sample.
+ * 
+ * This is a constant-time operation.
+ * 
+ * @param[inout] filter         Filter struct to have the sample added
+ * @param[in]    new_sample     Sample to be added to `filter`'s history
+ * 
+ * @see xs3_filter_fir_sym_s32_t
+ */
+void xs3_filter_fir_sym_s32_add_sample(
+    xs3_filter_fir_sym_s32_t* filter,
+    const int32_t new_sample);
+
+
+/**
+ * @brief Process a new sample with a symmetric 32-bit FIR filter.
+ * 
+ * The new input sample `new_sample` is added to this filter's state, and a new output sample is computed and returned
+ * as specified in `xs3_filter_fir_sym_s32_t`.
+ * 
+ * @param[inout]    filter          Filter to be processed
+ * @param[in]       new_sample      New input sample to be processed by `filter`
+ * 
+ * @returns     Next filtered output sample
+ * 
+ * @see xs3_filter_fir_sym_s32_t
+ */
+int32_t xs3_filter_fir_sym_s32(
+    xs3_filter_fir_sym_s32_t* filter,
+    const int32_t new_sample);
+
+
+/**
+ * @brief Number of elements needed in the sample buffer of a symmetric 16-bit FIR filter.
+ * 
+ * @see xs3_filter_fir_sym_s16_init()
+ */
+#define XS3_FILTER_FIR_SYM_S16_STATE_LEN(TAP_COUNT)     (4*(TAP_COUNT) + ((TAP_COUNT) + 1) / 2)
+
+
+/**
+ * @brief Symmetric (linear-phase) 16-bit FIR filter.
+ * 
+ * This is the 16-bit equivalent of `xs3_filter_fir_sym_s32_t`. The coefficients and `shift` have the same meaning as 
+ * for `xs3_filter_fir_s16_t`. The 16-bit filter has no per-product rounding, so its output is bit-exact with that of a 
+ * full `xs3_filter_fir_s16_t` with the mirrored coefficients, provided the input samples have at least 1 bit of 
+ * headroom so that the pre-added pairs do not saturate.
+ * 
+ * As for `xs3_filter_fir_sym_s32_t`, the newest `M` samples are kept newest-first and the oldest `N-M` samples 
+ * oldest-first in mirrored circular buffers, so adding a sample is a constant-time operation. As with 
+ * xs3_filter_fir_s16_init_circular(), the VPU needs each window to be word-aligned, so each of the two is held in two
+ * mirrored buffers, one sample apart, and whichever has its window at an even index is used. The sample buffer 
+ * therefore needs `XS3_FILTER_FIR_SYM_S16_STATE_LEN(N)` elements, including space for the pre-added pairs.
+ * 
+ * @see xs3_filter_fir_sym_s16_init()
+ * @see xs3_filter_fir_sym_s16_add_sample()
+ * @see xs3_filter_fir_sym_s16()
+ */
+typedef struct {
+    /**
+     * The number of taps `N` in the FIR filter.
+     */
+    unsigned num_taps;
+
+    /**
+     * Unsigned arithmetic rounding right-shift applied to accumulator when computing filter output.
+     */
+    right_shift_t shift;
+
+    /**
+     * Pointer to a buffer containing the first `ceil(N/2)` filter coefficients. Must point to word-aligned address.
+     */
+    int16_t* coef;
+
+    /**
+     * Pointer to the sample buffer. Must point to word-aligned address.
+     */
+    int16_t* state;
+
+    /**
+     * Position of the newest sample in the first newest-first buffer.
+     */
+    unsigned head;
+
+    /**
+     * Position of the oldest sample in the first oldest-first buffer.
+     */
+    unsigned tail;
+
+    /**
+     * Pointer to the `M` newest samples, newest first. Always word-aligned.
+     */
+    int16_t* newest;
+
+    /**
+     * Pointer to the `N-M` oldest samples, oldest first. Always word-aligned.
+     */
+    int16_t* oldest;
+} xs3_filter_fir_sym_s16_t;
+
+
+/**
+ * @brief Initialize a symmetric 16-bit FIR filter.
+ * 
+ * `coefficients` holds the first `(tap_count+1)/2` coefficients @math{b[k]} of the filter. `sample_buffer` must be at
+ * least `XS3_FILTER_FIR_SYM_S16_STATE_LEN(tap_count)` elements long. It is cleared to all `0`s by this function. Both 
+ * must be aligned to a 4-byte (word) boundary.
+ * 
+ * @param[out] filter           Filter struct to be initialized
+ * @param[in]  sample_buffer    Buffer used by the filter to contain state information
+ * @param[in]  tap_count        Order of the FIR filter; number of filter taps `N`
+ * @param[in]  coefficients     Array containing the first `ceil(N/2)` filter coefficients
+ * @param[in]  shift            Unsigned arithmetic right-shift applied to accumulator to get filter output sample
+ * 
+ * @see xs3_filter_fir_sym_s16_t
+ */
+void xs3_filter_fir_sym_s16_init(
+    xs3_filter_fir_sym_s16_t* filter,
+    int16_t* sample_buffer,
+    const unsigned tap_count,
+    const int16_t* coefficients,
+    const right_shift_t shift);
+
+
+/**
+ * @brief Add a new input sample to a symmetric 16-bit FIR filter without processing an output sample.
+ * 
+ * This is a constant-time operation.
+ * 
+ * @param[inout] filter         Filter struct to have the sample added
+ * @param[in]    new_sample     Sample to be added to `filter`'s history
+ * 
+ * @see xs3_filter_fir_sym_s16_t
+ */
+void xs3_filter_fir_sym_s16_add_sample(
+    xs3_filter_fir_sym_s16_t* filter,
+    const int16_t new_sample);
+
+
+/**
+ * @brief Process a new sample with a symmetric 16-bit FIR filter.
+ * 
+ * The new input sample `new_sample` is added to this filter's state, and a new output sample is computed and returned
+ * as specified in `xs3_filter_fir_sym_s16_t`.
+ * 
+ * @param[inout]    filter          Filter to be processed
+ * @param[in]       new_sample      New input sample to be processed by `filter`
+ * 
+ * @returns     Next filtered output sample
+ * 
+ * @see xs3_filter_fir_sym_s16_t
+ */
+int16_t xs3_filter_fir_sym_s16(
+    xs3_filter_fir_sym_s16_t* filter,
+    const int16_t new_sample);
+
+
+/**
+ * @brief Number of taps in each phase of a polyphase interpolator.
+ * 
+ * An interpolator with an `TAP_COUNT`-tap prototype filter and an interpolation factor of `FACTOR` splits the prototype
+ * into `FACTOR` phases of this many taps each. This is `TAP_COUNT / FACTOR` rounded up to an even number, so that each 
+ * phase's 16-bit coefficients start on a word boundary.
+ * 
+ * This determines the sizes of the buffers given to xs3_filter_interpolator_s32_init() and 
+ * xs3_filter_interpolator_s16_init().
+ */
+#define XS3_FILTER_POLYPHASE_TAPS(TAP_COUNT, FACTOR)     \
+    (((((TAP_COUNT) + (FACTOR) - 1) / (FACTOR)) + 1) & ~1u)
+
+
+/**
+ * @brief 32-bit FIR decimator.
+ * 
+ * A decimator filters its input with an `N`-tap FIR filter and keeps only every `factor`th output sample. Each call to
+ * xs3_filter_decimator_s32() consumes `factor` input samples and produces one output sample. The output is the sample
+ * which xs3_filter_fir_s32() would have produced for the last of those input samples.
+ * 
+ * The other `factor-1` input samples are only added to the filter's state, so the discarded outputs are never 
+ * computed. This needs `N` multiply-accumulates per output sample, or `N/factor` per input sample, which is the same 
+ * cost as a polyphase decomposition of the filter.
+ * 
+ * The coefficients and `shift` have exactly the same meaning as for `xs3_filter_fir_s32_t`. The filter's 
+ * coefficients should include whatever anti-aliasing is required.
+ * 
+ * @see xs3_filter_decimator_s32_init()
+ * @see xs3_filter_decimator_s32()
+ */
+typedef struct {
+    /**
+     * The underlying FIR filter.
+     */
+    xs3_filter_fir_s32_t filter;
+
+    /**
+     * Decimation factor.
+     */
+    unsigned factor;
+} xs3_filter_decimator_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit FIR decimator.
+ * 
+ * `sample_buffer` and `coefficients` must be at least `tap_count` elements long, and aligned to a 4-byte (word) 
+ * boundary, as for xs3_filter_fir_s32_init().
+ * 
+ * @param[out] decimator        Decimator to be initialized
+ * @param[in]  sample_buffer    Buffer used to contain state information. Must be at least `tap_count` elements long
+ * @param[in]  tap_count        Number of filter taps
+ * @param[in]  coefficients     Array containing filter coefficients
+ * @param[in]  shift            Unsigned arithmetic right-shift applied to accumulator to get filter output sample
+ * @param[in]  factor           Decimation factor
+ * 
+ * @see xs3_filter_decimator_s32_t
+ */
+void xs3_filter_decimator_s32_init(
+    xs3_filter_decimator_s32_t* decimator,
+    int32_t* sample_buffer,
+    const unsigned tap_count,
+    const int32_t* coefficients,
+    const right_shift_t shift,
+    const unsigned factor);
+
+
+/**
+ * @brief Process input samples with a 32-bit FIR decimator.
+ * 
+ * The `factor` input samples in `new_samples[]`, oldest first, are added to the decimator's state and the next output
+ * sample is returned.
+ * 
+ * @param[inout] decimator      Decimator to be processed
+ * @param[in]    new_samples    New input samples, `factor` elements
+ * 
+ * @returns     Next output sample
+ * 
+ * @see xs3_filter_decimator_s32_t
+ */
+int32_t xs3_filter_decimator_s32(
+    xs3_filter_decimator_s32_t* decimator,
+    const int32_t new_samples[]);
+
+
+/**
+ * @brief 16-bit FIR decimator.
+ * 
+ * This is the 16-bit equivalent of `xs3_filter_decimator_s32_t`. The coefficients and `shift` have the same meaning as 
+ * for `xs3_filter_fir_s16_t`. The underlying filter keeps its state in a circular buffer (see 
+ * xs3_filter_fir_s16_init_circular()) so that the discarded input samples are added in constant time.
+ * 
+ * @see xs3_filter_decimator_s16_init()
+ * @see xs3_filter_decimator_s16()
+ */
+typedef struct {
+    /**
+     * The underlying FIR filter.
+     */
+    xs3_filter_fir_s16_t filter;
+
+    /**
+     * Decimation factor.
+     */
+    unsigned factor;
+} xs3_filter_decimator_s16_t;
+
+
+/**
+ * @brief Initialize a 16-bit FIR decimator.
+ * 
+ * `sample_buffer` must be at least `4 * tap_count` elements long and `coefficients` at least `tap_count` elements 
+ * long. Both must be aligned to a 4-byte (word) boundary. `sample_buffer` is cleared to all `0`s by this function.
+ * 
+ * @param[out] decimator        Decimator to be initialized
+ * @param[in]  sample_buffer    Buffer used to contain state information. Must be `4*tap_count` elements
+ * @param[in]  tap_count        Number of filter taps
+ * @param[in]  coefficients     Array containing filter coefficients
+ * @param[in]  shift            Unsigned arithmetic right-shift applied to accumulator to get filter output sample
+ * @param[in]  factor           Decimation factor
+ * 
+ * @see xs3_filter_decimator_s16_t
+ */
+void xs3_filter_decimator_s16_init(
+    xs3_filter_decimator_s16_t* decimator,
+    int16_t* sample_buffer,
+    const unsigned tap_count,
+    const int16_t* coefficients,
+    const right_shift_t shift,
+    const unsigned factor);
+
+
+/**
+ * @brief Process input samples with a 16-bit FIR decimator.
+ * 
+ * The `factor` input samples in `new_samples[]`, oldest first, are added to the decimator's state and the next output
+ * sample is returned.
+ * 
+ * @param[inout] decimator      Decimator to be processed
+ * @param[in]    new_samples    New input samples, `factor` elements
+ * 
+ * @returns     Next output sample
+ * 
+ * @see xs3_filter_decimator_s16_t
+ */
+int16_t xs3_filter_decimator_s16(
+    xs3_filter_decimator_s16_t* decimator,
+    const int16_t new_samples[]);
+
+
+/**
+ * @brief 32-bit polyphase FIR interpolator.
+ * 
+ * An interpolator conceptually inserts `factor-1` zeros after each input sample and filters the result with an 
+ * `N`-tap FIR (prototype) filter `b[]`. Each call to xs3_filter_interpolator_s32() consumes one input sample and 
+ * produces `factor` output samples.
+ * 
+ * Only one in every `factor` of the samples seen by the prototype filter is nonzero, so output sample `p` of each call
+ * only depends on the prototype coefficients `b[p]`, `b[p + factor]`, `b[p + 2*factor]` and so on. These form phase 
+ * `p` of the filter, which is applied to the input samples (without the zeros) as an ordinary FIR filter. Each output 
+ * therefore costs `M` = `XS3_FILTER_POLYPHASE_TAPS(N, factor)` multiply-accumulates rather than `N`.
+ * 
+ * All phases share a single state buffer of the `M` most recent input samples. The coefficients and `shift` have 
+ * exactly the same meaning as for `xs3_filter_fir_s32_t`. Note that the zeros reduce the output level by a factor of 
+ * `factor`, which is normally compensated for in the prototype filter's gain.
+ * 
+ * @see xs3_filter_interpolator_s32_init()
+ * @see xs3_filter_interpolator_s32()
+ */
+typedef struct {
+    /**
+     * The underlying FIR filter, with `M` taps. Its coefficients are those of the phase being processed.
+     */
+    xs3_filter_fir_s32_t filter;
+
+    /**
+     * Interpolation factor. This is also the number of phases.
+     */
+    unsigned factor;
+
+    /**
+     * The coefficients of each phase, with phase `p` beginning at `coef[p*M]`.
+     */
+    int32_t* coef;
+} xs3_filter_interpolator_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit polyphase FIR interpolator.
+ * 
+ * The `tap_count` prototype filter `coefficients` are rearranged into `factor` phases of 
+ * `M` = `XS3_FILTER_POLYPHASE_TAPS(tap_count, factor)` taps each in `coef_buffer`, with zeros after the end of the 
+ * prototype. `coefficients` is not modified, and need not remain valid after this call.
+ * 
+ * `sample_buffer` must be at least `M` elements long and `coef_buffer` at least `factor * M` elements long. Both must
+ * be aligned to a 4-byte (word) boundary. `sample_buffer` is cleared to all `0`s by this function.
+ * 
+ * @param[out] interpolator     Interpolator to be initialized
+ * @param[in]  sample_buffer    Buffer used to contain state information. Must be at least `M` elements long
+ * @param[in]  coef_buffer      Buffer for the phase coefficients. Must be at least `factor * M` elements long
+ * @param[in]  tap_count        Number of prototype filter taps
+ * @param[in]  coefficients     Array containing the prototype filter coefficients
+ * @param[in]  shift            Unsigned arithmetic right-shift applied to accumulator to get filter output sample
+ * @param[in]  factor           Interpolation factor
+ * 
+ * @see xs3_filter_interpolator_s32_t
+ */
+void xs3_filter_interpolator_s32_init(
+    xs3_filter_interpolator_s32_t* interpolator,
+    int32_t* sample_buffer,
+    int32_t* coef_buffer,
+    const unsigned tap_count,
+    const int32_t* coefficients,
+    const right_shift_t shift,
+    const unsigned factor);
+
+
+/**
+ * @brief Process an input sample with a 32-bit polyphase FIR interpolator.
+ * 
+ * `new_sample` is added to the interpolator's state and the `factor` corresponding output samples are placed in 
+ * `output[]`, oldest first.
+ * 
+ * @param[inout] interpolator   Interpolator to be processed
+ * @param[out]   output         Output samples, `factor` elements
+ * @param[in]    new_sample     New input sample
+ * 
+ * @see xs3_filter_interpolator_s32_t
+ */
+void xs3_filter_interpolator_s32(
+    xs3_filter_interpolator_s32_t* interpolator,
+    int32_t output[],
+    const int32_t new_sample);
+
+
+/**
+ * @brief 16-bit polyphase FIR interpolator.
+ * 
+ * This is the 16-bit equivalent of `xs3_filter_interpolator_s32_t`. The coefficients and `shift` have the same meaning
+ * as for `xs3_filter_fir_s16_t`. The underlying filter keeps its state in a circular buffer (see 
+ * xs3_filter_fir_s16_init_circular()).
+ * 
+ * @see xs3_filter_interpolator_s16_init()
+ * @see xs3_filter_interpolator_s16()
+ */
+typedef struct {
+    /**
+     * The underlying FIR filter, with `M` taps. Its coefficients are those of the phase being processed.
+     */
+    xs3_filter_fir_s16_t filter;
+
+    /**
+     * Interpolation factor. This is also the number of phases.
+     */
+    unsigned factor;
+
+    /**
+     * The coefficients of each phase, with phase `p` beginning at `coef[p*M]`.
+     */
+    int16_t* coef;
+} xs3_filter_interpolator_s16_t;
+
+
+/**
+ * @brief Initialize a 16-bit polyphase FIR interpolator.
+ * 
+ * The `tap_count` prototype filter `coefficients` are rearranged into `factor` phases of 
+ * `M` = `XS3_FILTER_POLYPHASE_TAPS(tap_count, factor)` taps each in `coef_buffer`, with zeros after the end of the 
+ * prototype. `coefficients` is not modified, and need not remain valid after this call.
+ * 
+ * `sample_buffer` must be at least `4 * M` elements long and `coef_buffer` at least `factor * M` elements long. Both 
+ * must be aligned to a 4-byte (word) boundary. `sample_buffer` is cleared to all `0`s by this function.
+ * 
+ * @param[out] interpolator     Interpolator to be initialized
+ * @param[in]  sample_buffer    Buffer used to contain state information. Must be at least `4 * M` elements long
+ * @param[in]  coef_buffer      Buffer for the phase coefficients. Must be at least `factor * M` elements long
+ * @param[in]  tap_count        Number of prototype filter taps
+ * @param[in]  coefficients     Array containing the prototype filter coefficients
+ * @param[in]  shift            Unsigned arithmetic right-shift applied to accumulator to get filter output sample
+ * @param[in]  factor           Interpolation factor
+ * 
+ * @see xs3_filter_interpolator_s16_t
+ */
+void xs3_filter_interpolator_s16_init(
+    xs3_filter_interpolator_s16_t* interpolator,
+    int16_t* sample_buffer,
+    int16_t* coef_buffer,
+    const unsigned tap_count,
+    const int16_t* coefficients,
+    const right_shift_t shift,
+    const unsigned factor);
+
+
+/**
+ * @brief Process an input sample with a 16-bit polyphase FIR interpolator.
+ * 
+ * `new_sample` is added to the interpolator's state and the `factor` corresponding output samples are placed in 
+ * `output[]`, oldest first.
+ * 
+ * @param[inout] interpolator   Interpolator to be processed
+ * @param[out]   output         Output samples, `factor` elements
+ * @param[in]    new_sample     New input sample
+ * 
+ * @see xs3_filter_interpolator_s16_t
+ */
+void xs3_filter_interpolator_s16(
+    xs3_filter_interpolator_s16_t* interpolator,
+    int16_t output[],
+    const int16_t new_sample);
+
+
+/**
+ * @brief 32-bit rational-ratio polyphase sample rate converter.
+ * 
+ * A sample rate converter (SRC) changes the sample rate of a signal by a factor of `L/M`, where `L` and `M` are 
+ * (usually coprime) positive integers. For example, `L = 160` and `M = 147` converts 44.1 kHz to 48 kHz.
+ * 
+ * Conceptually, the input is first interpolated by `L` with an `N`-tap FIR (prototype) filter, exactly as by 
+ * `xs3_filter_interpolator_s32_t`, and then only every `M`th sample of the result is kept. Only the kept samples are 
+ * computed: each one is the output of a single phase of the prototype filter, so it costs 
+ * `XS3_FILTER_POLYPHASE_TAPS(N, L)` multiply-accumulates using the same kernel as xs3_filter_fir_s32(). The phases are
+ * visited in turn, `M` phases apart, wrapping around to the next input sample after phase `L-1`.
+ * 
+ * The prototype filter must have a cut-off frequency below both the input and the output Nyquist frequencies. Its 
+ * coefficients and `shift` have exactly the same meaning as for `xs3_filter_fir_s32_t`. 
+ * 
+ * The input is processed in blocks with xs3_filter_src_s32(). The number of output samples produced from each block 
+ * depends on the position of the converter within its cycle of phases, and is never more than 
+ * `(input_length * L + M - 1) / M`.
+ * 
+ * @see xs3_filter_src_s32_init()
+ * @see xs3_filter_src_s32()
+ */
+typedef struct {
+    /**
+     * The underlying interpolator, with `factor` equal to `L`.
+     */
+    xs3_filter_interpolator_s32_t interpolator;
+
+    /**
+     * Decimation factor `M`.
+     */
+    unsigned down;
+
+    /**
+     * Phase of the next output sample, relative to the next input sample.
+     */
+    unsigned phase;
+} xs3_filter_src_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit rational-ratio sample rate converter.
+ * 
+ * The arguments have the same meaning and requirements as for xs3_filter_interpolator_s32_init(), with `up` being the
+ * interpolation factor `L`, and `down` the decimation factor `M`. The first output sample corresponds to the first
+ * input sample.
+ * 
+ * @param[out] src              Sample rate converter to be initialized
+ * @param[in]  sample_buffer    Buffer used to contain state information. Must be at least 
+ *                              `XS3_FILTER_POLYPHASE_TAPS(tap_count, up)` elements long
+ * @param[in]  coef_buffer      Buffer for the phase coefficients. Must be at least 
+ *                              `up * XS3_FILTER_POLYPHASE_TAPS(tap_count, up)` elements long
+ * @param[in]  tap_count        Number of prototype filter taps
+ * @param[in]  coefficients     Array containing the prototype filter coefficients
+ * @param[in]  shift            Unsigned arithmetic right-shift applied to accumulator to get filter output sample
+ * @param[in]  up               Interpolation factor `L`
+ * @param[in]  down             Decimation factor `M`
+ * 
+ * @see xs3_filter_src_s32_t
+ */
+void xs3_filter_src_s32_init(
+    xs3_filter_src_s32_t* src,
+    int32_t* sample_buffer,
+    int32_t* coef_buffer,
+    const unsigned tap_count,
+    const int32_t* coefficients,
+    const right_shift_t shift,
+    const unsigned up,
+    const unsigned down);
+
+
+/**
+ * @brief Process a block of samples with a 32-bit rational-ratio sample rate converter.
+ * 
+ * The `input_length` samples in `input[]` are consumed, and the output samples which become available are placed in 
+ * `output[]`. The number of output samples is written to `output_length`. `output[]` must have space for 
+ * `(input_length * L + M - 1) / M` elements, and must not overlap `input[]`.
+ * 
+ * @param[inout] src            Sample rate converter to be processed
+ * @param[out]   output         Output samples
+ * @param[out]   output_length  Number of output samples produced
+ * @param[in]    input          Input samples
+ * @param[in]    input_length   Number of input samples
+ * 
+ * @returns     Headroom of the output samples
+ * 
+ * @see xs3_filter_src_s32_t
+ */
+headroom_t xs3_filter_src_s32(
+    xs3_filter_src_s32_t* src,
+    int32_t output[],
+    unsigned* output_length,
+    const int32_t input[],
+    const unsigned input_length);
+
+
+/**
+ * @brief Maximum order (number of integrator and comb stages) of a CIC decimator.
+ */
+#define XS3_FILTER_CIC_MAX_ORDER    (8)
+
+
+/**
+ * @brief 32-bit cascaded integrator-comb (CIC) decimator.
+ * 
+ * A CIC decimator of order `N` and ratio `R` is a cascade of `N` integrators running at the input rate, followed by
+ * decimation by `R` and a cascade of `N` combs (first differences) running at the output rate. It is equivalent to
+ * filtering with `N` cascaded `R`-tap moving sums and keeping every `R`th output, but needs no multiplications, so it
+ * is typically used as the first decimation stage of a PDM microphone front end.
+ * 
+ * Each output sample is the sample the equivalent filter would produce for the last of its `R` input samples:
+ * 
+ * @f$
+ *      y[n] = round \left( \left( \sum_{k=0}^{N(R-1)} h[k] \cdot x[nR + R - 1 - k] \right) \cdot 2^{-shift} \right)  \\
+ *          \qquad\text{where } h \text{ is the } N\text{-fold convolution of } R \text{ ones with itself}
+ * @f$
+ * 
+ * The DC gain of the filter is `R^N`, which grows the input by `G = ceil(log2(R^N))` bits. The integrators and combs
+ * use 64-bit wrapping arithmetic, which gives exact results as long as the output fits, so the inputs may have up to 
+ * `64 - G` significant bits. The rounding right-shift `shift` is chosen by xs3_filter_cic_s32_init() so that the 
+ * outputs always have at least one bit of headroom, and the output samples are the filter's outputs with an exponent
+ * `shift` greater than that of the input.
+ * 
+ * The input can be given either as 32-bit samples with xs3_filter_cic_s32(), or as a packed 1-bit PDM stream with
+ * xs3_filter_cic_s32_pdm(). In a PDM stream, each bit is one sample, with the same convention as the `VDEPTH1` 
+ * instruction (see vdepth1_32()): a `0` bit is `+1` and a `1` bit is `-1`, and the earliest sample is in the least
+ * significant bit of the first word. When the outputs fit in 32 bits (`R^N < 2^31`), xs3_filter_cic_s32_pdm() works in
+ * 32-bit wrapping arithmetic, which is just as exact, and adds each aligned byte of samples to the integrators at once
+ * using look-up tables. The states are then only kept modulo `2^32`, so a decimator should be used with only one of 
+ * xs3_filter_cic_s32() and xs3_filter_cic_s32_pdm().
+ * 
+ * The output of a CIC decimator has a `sinc^N` droop across its passband, and is usually followed by an FIR decimator
+ * (see xs3_filter_decimator_s32_t) whose coefficients compensate for it. bfp_filter_cic_s32_pdm(), 
+ * bfp_filter_cic_s32() and bfp_filter_decimator_s32() wrap these stages with BFP vectors.
+ * 
+ * @see xs3_filter_cic_s32_init()
+ * @see xs3_filter_cic_s32()
+ * @see xs3_filter_cic_s32_pdm()
+ */
+typedef struct {
+    /**
+     * Order `N` of the filter.
+     */
+    unsigned order;
+
+    /**
+     * Decimation ratio `R`.
+     */
+    unsigned ratio;
+
+    /**
+     * Unsigned arithmetic rounding right-shift applied to the comb output to get the filter output sample.
+     */
+    right_shift_t shift;
+
+    /**
+     * Integrator states, in wrapping 64-bit arithmetic.
+     */
+    uint64_t integrator[XS3_FILTER_CIC_MAX_ORDER];
+
+    /**
+     * Previous comb inputs, in wrapping 64-bit arithmetic.
+     */
+    uint64_t comb[XS3_FILTER_CIC_MAX_ORDER];
+} xs3_filter_cic_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit CIC decimator.
+ * 
+ * `input_bits` is the number of significant bits (including the sign bit) of the input samples, so that the magnitude
+ * of every input sample is at most `2^(input_bits - 1)`. It is `32` for unconstrained 32-bit samples, and `1` for a 
+ * PDM stream. The output shift is then `max(0, G + input_bits - 31)`, where `G = ceil(log2(R^N))`, and `G + input_bits`
+ * must not be greater than `64`.
+ * 
+ * The filter's state is cleared.
+ * 
+ * @param[out] cic              CIC decimator to be initialized
+ * @param[in]  order            Order `N`, between `1` and `XS3_FILTER_CIC_MAX_ORDER`
+ * @param[in]  ratio            Decimation ratio `R`, at least `1`
+ * @param[in]  input_bits       Number of significant bits of the input samples
+ * 
+ * @see xs3_filter_cic_s32_t
+ */
+void xs3_filter_cic_s32_init(
+    xs3_filter_cic_s32_t* cic,
+    const unsigned order,
+    const unsigned ratio,
+    const unsigned input_bits);
+
+
+/**
+ * @brief Process a block of samples with a 32-bit CIC decimator.
+ * 
+ * The `length * R` samples in `input[]`, oldest first, are consumed and `length` output samples are placed in 
+ * `output[]`. 
+ * 
+ * @param[inout] cic        CIC decimator to be processed
+ * @param[out]   output     Output samples, `length` elements
+ * @param[in]    input      Input samples, `length * R` elements
+ * @param[in]    length     Number of output samples
+ * 
+ * @returns     Headroom of the output samples
+ * 
+ * @see xs3_filter_cic_s32_t
+ */
+headroom_t xs3_filter_cic_s32(
+    xs3_filter_cic_s32_t* cic,
+    int32_t output[],
+    const int32_t input[],
+    const unsigned length);
+
+
+/**
+ * @brief Process a block of packed PDM samples with a 32-bit CIC decimator.
+ * 
+ * The `length * R` 1-bit samples packed into `input[]` (see xs3_filter_cic_s32_t) are consumed and `length` output 
+ * samples are placed in `output[]`. `length * R` must be a multiple of `32`, so that whole words are consumed.
+ * 
+ * @param[inout] cic        CIC decimator to be processed
+ * @param[out]   output     Output samples, `length` elements
+ * @param[in]    input      Packed input samples, `length * R / 32` words
+ * @param[in]    length     Number of output samples
+ * 
+ * @returns     Headroom of the output samples
+ * 
+ * @see xs3_filter_cic_s32_t
+ */
+headroom_t xs3_filter_cic_s32_pdm(
+    xs3_filter_cic_s32_t* cic,
+    int32_t output[],
+    const uint32_t input[],
+    const unsigned length);
+
+
 /**
  * @brief A biquad filter block
  * 
@@ -470,7 +1395,9 @@ int16_t xs3_filter_fir_s16(
  * 
  * To process a new input sample, xs3_filter_biquad_s32() can be used with a pointer to one of these structs.
  * 
- * For longer cascades, an array of `xs3_biquad_filter_s32_t` structs can be used with xs3_filter_biquads_s32().
+ * For longer cascades, an array of `xs3_biquad_filter_s32_t` structs can be used with xs3_filter_biquads_s32(). A 
+ * cascade of any number of sections can be initialized with xs3_filter_biquads_s32_init(), and a block of samples can
+ * be run through a cascade with xs3_filter_biquads_s32_block().
  */
 typedef struct {
     /**
@@ -525,7 +1452,159 @@ int32_t xs3_filter_biquads_s32(
 
 
 
-#ifdef __XC__
+/**
+ * @brief Number of biquad filter blocks needed for a cascade of biquad sections.
+ * 
+ * Each `xs3_biquad_filter_s32_t` holds up to 8 sections, so a cascade of `SECTIONS` sections needs this many blocks.
+ */
+#define XS3_BIQUAD_BLOCK_COUNT(SECTIONS)     (((SECTIONS) + 7) / 8)
+
+
+/**
+ * @brief Initialize a cascade of biquad filter sections.
+ * 
+ * The `section_count` sections are packed, in order, into the `XS3_BIQUAD_BLOCK_COUNT(section_count)` blocks of 
+ * `biquads[]`. Every block except the last holds 8 sections, and the last block holds the remaining sections, so no 
+ * more blocks are used than necessary. The coefficients of unused sections in the last block are zeroed, and the state
+ * of every block is cleared.
+ * 
+ * `coef[k]` holds the coefficients of the `k`th section, in the same order as `xs3_biquad_filter_s32_t::coef`, i.e. 
+ * @math{b_0}, @math{b_1}, @math{b_2}, @math{-a_1} and @math{-a_2}.
+ * 
+ * @param[out] biquads          Biquad filter blocks, `XS3_BIQUAD_BLOCK_COUNT(section_count)` elements
+ * @param[in]  coef             Coefficients of each section
+ * @param[in]  section_count    Number of biquad sections
+ * 
+ * @returns     Number of biquad filter blocks used
+ */
+unsigned xs3_filter_biquads_s32_init(
+    xs3_biquad_filter_s32_t biquads[],
+    const int32_t coef[][5],
+    const unsigned section_count);
+
+
+/**
+ * @brief Process a block of samples with a cascade of biquad filter blocks.
+ * 
+ * The `length` input samples `input[]` are run through the `block_count` biquad filter blocks of `biquads[]` in order,
+ * and the output samples are placed in `output[]`. The result is the same as calling xs3_filter_biquads_s32() for each 
+ * sample in turn.
+ * 
+ * This is a convenience wrapper which calls xs3_filter_biquad_s32() once per sample for each biquad filter block, 
+ * running the whole block of samples through each biquad filter block before moving on to the next. Every call reloads 
+ * that block's coefficients, so it is no faster than calling xs3_filter_biquads_s32() once per sample.
+ * 
+ * @note There is no kernel which keeps a biquad filter block's coefficients resident across samples.
+ * 
+ * `output[]` may not overlap `input[]` unless they are the same array.
+ * 
+ * @param[inout] biquads        Biquad filter blocks, `block_count` elements
+ * @param[in]    block_count    Number of biquad filter blocks
+ * @param[out]   output         Output samples, `length` elements
+ * @param[in]    input          Input samples, `length` elements
+ * @param[in]    length         Number of samples to process
+ */
+void xs3_filter_biquads_s32_block(
+    xs3_biquad_filter_s32_t biquads[],
+    const unsigned block_count,
+    int32_t output[],
+    const int32_t input[],
+    const unsigned length);
+
+
+
+/**
+ * @brief A bank of multichannel biquad filter cascades.
+ * 
+ * Where `xs3_biquad_filter_s32_t` places up to 8 sections of a single channel's cascade in the 8 lanes of the VPU, this
+ * struct places up to 8 _channels_ in the lanes, with each channel running its own cascade of `stage_count` biquad 
+ * sections. Every channel's cascade has the same number of stages, but each channel has its own coefficients.
+ * 
+ * There is no dependency between the lanes within a stage, so the layout suits a VPU implementation in which each 
+ * stage is a single set of vector operations across all channels. There is currently no such kernel, and 
+ * xs3_filter_biquad_bank_s32() is implemented in C on every platform, processing only the `channel_count` used lanes.
+ * 
+ * For each channel, each stage computes exactly what one section of xs3_filter_biquad_s32() computes, so a channel's 
+ * output is bit-exact with running its sections through xs3_filter_biquad_s32().
+ * 
+ * The coefficient and state buffers are supplied by the caller (see xs3_filter_biquad_bank_s32_init()). They are laid
+ * out with the channel as the fastest-changing index, so that each row of 8 words is loaded as one vector:
+ * 
+ *  - `coef` holds `stage_count` blocks of `int32_t[5][8]`. Element `[s][j][c]` is coefficient `j` (@math{b_0}, 
+ *    @math{b_1}, @math{b_2}, @math{-a_1} or @math{-a_2}) of stage `s` for channel `c`.
+ *  - `state` holds `stage_count+1` blocks of `int32_t[2][8]`. Element `[s][j][c]` is @math{x_s[n-1-j]}, where 
+ *    @math{x_s} is the input to stage `s` of channel `c`. Block `stage_count` holds the previous outputs.
+ * 
+ * @see xs3_filter_biquad_bank_s32_init()
+ * @see xs3_filter_biquad_bank_s32()
+ */
+typedef struct {
+    /**
+     * The number of channels in the bank, from 1 to 8.
+     */
+    unsigned channel_count;
+
+    /**
+     * The number of biquad stages in each channel's cascade.
+     */
+    unsigned stage_count;
+
+    /**
+     * Pointer to the coefficients, `stage_count` blocks of `int32_t[5][8]`. Must be word-aligned.
+     */
+    int32_t* coef;
+
+    /**
+     * Pointer to the filter state, `stage_count+1` blocks of `int32_t[2][8]`. Must be word-aligned.
+     */
+    int32_t* state;
+} xs3_filter_biquad_bank_s32_t;
+
+
+/**
+ * @brief Initialize a bank of multichannel biquad filter cascades.
+ * 
+ * `coef[s][j][c]` is coefficient `j` of stage `s` for channel `c`, in the order @math{b_0}, @math{b_1}, @math{b_2}, 
+ * @math{-a_1}, @math{-a_2}. Coefficients for unused channels (`c >= channel_count`) should be zero. The coefficients
+ * are used in-place, so `coef` must remain valid for as long as the bank is in use.
+ * 
+ * `state_buffer` must have `stage_count+1` elements. It is cleared to all `0`s by this function.
+ * 
+ * @param[out] bank             Bank to be initialized
+ * @param[in]  state_buffer     Buffer used to contain state information, `stage_count+1` elements
+ * @param[in]  coef             Coefficients, `stage_count` elements
+ * @param[in]  stage_count      Number of biquad stages in each channel's cascade
+ * @param[in]  channel_count    Number of channels, from 1 to 8
+ * 
+ * @see xs3_filter_biquad_bank_s32_t
+ */
+void xs3_filter_biquad_bank_s32_init(
+    xs3_filter_biquad_bank_s32_t* bank,
+    int32_t state_buffer[][2][8],
+    const int32_t coef[][5][8],
+    const unsigned stage_count,
+    const unsigned channel_count);
+
+
+/**
+ * @brief Process one sample of each channel with a bank of multichannel biquad filter cascades.
+ * 
+ * `input[c]` is the new input sample for channel `c`, and the new output sample for channel `c` is placed in 
+ * `output[c]`. Both arrays have `channel_count` elements, must be word-aligned and may be the same array.
+ * 
+ * @param[inout] bank       Bank to be processed
+ * @param[out]   output     New output samples, `channel_count` elements
+ * @param[in]    input      New input samples, `channel_count` elements
+ * 
+ * @see xs3_filter_biquad_bank_s32_t
+ */
+void xs3_filter_biquad_bank_s32(
+    xs3_filter_biquad_bank_s32_t* bank,
+    int32_t output[],
+    const int32_t input[]);
+
+
+#if defined(__XC__) || defined(__cplusplus)
 }   //extern "C"
 #endif
 
@@ -7,7 +7,7 @@
 #include "xs3_math_types.h"
 #include "xs3_util.h"
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -1702,6 +1702,113 @@ void xs3_vect_s16_mul_prepare(
     const headroom_t c_hr);
 
 
+/**
+ * @brief Multiply one 16-bit vector element-wise by another, and add the result to an accumulator vector.
+ * 
+ * `acc[]` represents the 16-bit accumulator mantissa vector @vector{a}. Each @math{a_k} uses `acc[k]` as both input 
+ * and output.
+ * 
+ * `b[]` and `c[]` represent the 16-bit input mantissa vectors @vector{b} and @vector{c}, where each @math{b_k} is 
+ * `b[k]` and each @math{c_k} is `c[k]`.
+ * 
+ * Each of the vectors must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `acc_shr` is the signed arithmetic right-shift applied to the accumulators @math{a_k}.
+ * 
+ * `bc_sat` is the unsigned arithmetic right-shift applied to the 32-bit product of @math{b_k} and @math{c_k} before it
+ * is added to the shifted accumulator.
+ * 
+ * \low_op{16, @f$
+ *      v_k \leftarrow sat_{16}( round( b_k \cdot c_k \cdot 2^{-bc\_sat} ) )      \\
+ *      \hat{a}_k \leftarrow sat_{16}( a_k \cdot 2^{-acc\_shr} )                 \\
+ *      a_k \leftarrow sat_{16}( \hat{a}_k + v_k )                               \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If inputs @vector{b} and @vector{c} are the mantissas of BFP vectors @math{\bar{b} \cdot 2^{b\_exp}} and 
+ * @math{\bar{c} \cdot 2^{c\_exp}}, and input @vector{a} is the accumulator BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, 
+ * then the output values of @vector{a} have the exponent @math{2^{a\_exp + acc\_shr}}.
+ * 
+ * For accumulation to make sense mathematically, @math{bc\_sat} must be chosen such that 
+ * @math{ a\_exp + acc\_shr = b\_exp + c\_exp + bc\_sat }.
+ * 
+ * The function xs3_vect_s16_macc_prepare() can be used to obtain values for @math{acc\_shr} and @math{bc\_sat} based 
+ * on the input exponents @math{a\_exp}, @math{b\_exp} and @math{c\_exp} and the input headrooms @math{a\_hr}, 
+ * @math{b\_hr} and @math{c\_hr}. 
+ * 
+ * @param[inout]  acc       Input/Output accumulator vector @vector{a}
+ * @param[in]     b         Input vector @vector{b}
+ * @param[in]     c         Input vector @vector{c}
+ * @param[in]     length    Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]     acc_shr   Signed arithmetic right-shift applied to accumulator elements.
+ * @param[in]     bc_sat    Unsigned arithmetic right-shift applied to the products of elements @math{b_k} and 
+ *                          @math{c_k}
+ * 
+ * @returns  Headroom of the output vector @vector{a}
+ * 
+ * @see xs3_vect_s16_macc_prepare
+ */
+headroom_t xs3_vect_s16_macc(
+    int16_t acc[],
+    const int16_t b[],
+    const int16_t c[],
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t bc_sat);
+
+
+/**
+ * @brief Obtain the output exponent and shifts used by xs3_vect_s16_macc().
+ * 
+ * This function is used in conjunction with xs3_vect_s16_macc() to perform an element-wise multiply-accumulate of 
+ * 16-bit BFP vectors.
+ * 
+ * This function computes `new_acc_exp`, `acc_shr` and `bc_sat`, which are chosen together so that neither the shifted
+ * accumulator nor the product can saturate, and so that their sum fits in 16 bits.
+ * 
+ * `new_acc_exp` is the exponent associated with the accumulator vector @vector{a} after the operation. It is the 
+ * smallest exponent for which both the shifted accumulator and the product have at least one bit of headroom.
+ * 
+ * `acc_shr` is the shift applied to the accumulator, and `bc_sat` is the shift applied to the 32-bit products of 
+ * @vector{b} and @vector{c}, such that @math{new\_acc\_exp = acc\_exp + acc\_shr = b\_exp + c\_exp + bc\_sat}.
+ * 
+ * `acc_exp`, `b_exp` and `c_exp` are the exponents associated with the accumulator vector and the input vectors 
+ * @vector{b} and @vector{c} respectively.
+ * 
+ * `acc_hr`, `b_hr` and `c_hr` are the headroom of the accumulator vector and the input vectors @vector{b} and 
+ * @vector{c} respectively. If the headroom of a vector is unknown, it can be obtained by calling 
+ * xs3_vect_s16_headroom(). Alternatively, the value `0` can always be safely used (but may result in reduced 
+ * precision).
+ * 
+ * @param[out]  new_acc_exp     Exponent of the accumulator vector after the operation
+ * @param[out]  acc_shr         Signed arithmetic right-shift to be applied to accumulator elements
+ * @param[out]  bc_sat          Unsigned arithmetic right-shift to be applied to the products of @vector{b} and 
+ *                              @vector{c}
+ * @param[in]   acc_exp         Exponent of the accumulator vector before the operation
+ * @param[in]   b_exp           Exponent of @vector{b}
+ * @param[in]   c_exp           Exponent of @vector{c}
+ * @param[in]   acc_hr          Headroom of the accumulator vector before the operation
+ * @param[in]   b_hr            Headroom of @vector{b}
+ * @param[in]   c_hr            Headroom of @vector{c}
+ * 
+ * @see xs3_vect_s16_macc
+ */
+void xs3_vect_s16_macc_prepare(
+    exponent_t* new_acc_exp,
+    right_shift_t* acc_shr,
+    right_shift_t* bc_sat,
+    const exponent_t acc_exp,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t acc_hr,
+    const headroom_t b_hr,
+    const headroom_t c_hr);
+
+
 /** 
  * @brief Rectify the elements of a 16-bit vector.
  * 
@@ -2181,7 +2288,7 @@ void xs3_vect_s16_to_s32(
 
 
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 }   //extern "C"
 #endif
 
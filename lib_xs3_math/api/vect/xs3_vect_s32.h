@@ -7,7 +7,7 @@
 #include "xs3_math_types.h"
 #include "xs3_util.h"
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -698,6 +698,106 @@ void xs3_vect_complex_s32_mul_prepare(
     const headroom_t c_hr);
 
 
+/**
+ * @brief Multiply one complex 32-bit vector element-wise by another, and add the result to an accumulator vector.
+ * 
+ * `acc[]` represents the complex 32-bit accumulator mantissa vector @vector{a}. Each @math{a_k} uses `acc[k]` as both
+ * input and output.
+ * 
+ * `b[]` and `c[]` represent the complex 32-bit input mantissa vectors @vector{b} and @vector{c}, where each 
+ * @math{b_k} is `b[k]` and each @math{c_k} is `c[k]`.
+ * 
+ * Each of the vectors must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `acc_shr` is the signed arithmetic right-shift applied to the accumulators @math{a_k}.
+ * 
+ * `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to the input elements @math{b_k} and @math{c_k}.
+ * 
+ * The complex product of @math{b_k} and @math{c_k} is added directly to the shifted accumulator, without being stored.
+ * 
+ * \low_op{32, @f$
+ *      \tilde{b}_k \leftarrow sat_{32}( b_k \cdot 2^{-b\_shr} )                    \\
+ *      \tilde{c}_k \leftarrow sat_{32}( c_k \cdot 2^{-c\_shr} )                    \\
+ *      \tilde{a}_k \leftarrow sat_{32}( a_k \cdot 2^{-acc\_shr} )                  \\
+ *      v_k \leftarrow \tilde{b}_k \cdot \tilde{c}_k \cdot 2^{-30}                  \\
+ *      Re\\{a_k\\} \leftarrow sat_{32}( Re\\{\tilde{a}_k\\} + round( Re\\{v_k\\} ) )  \\
+ *      Im\\{a_k\\} \leftarrow sat_{32}( Im\\{\tilde{a}_k\\} + round( Im\\{v_k\\} ) )  \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If inputs @vector{b} and @vector{c} are the mantissas of complex BFP vectors @math{\bar{b} \cdot 2^{b\_exp}} and 
+ * @math{\bar{c} \cdot 2^{c\_exp}}, and input @vector{a} is the accumulator BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, 
+ * then the output values of @vector{a} have the exponent @math{2^{a\_exp + acc\_shr}}.
+ * 
+ * For accumulation to make sense mathematically, the shifts must be chosen such that 
+ * @math{ a\_exp + acc\_shr = b\_exp + c\_exp + b\_shr + c\_shr + 30 }.
+ * 
+ * The function xs3_vect_complex_s32_macc_prepare() can be used to obtain values for @math{acc\_shr}, @math{b\_shr} 
+ * and @math{c\_shr} based on the input exponents @math{a\_exp}, @math{b\_exp} and @math{c\_exp} and the input 
+ * headrooms @math{a\_hr}, @math{b\_hr} and @math{c\_hr}. 
+ * 
+ * @param[inout]  acc       Input/Output complex accumulator vector @vector{a}
+ * @param[in]     b         Complex input vector @vector{b}
+ * @param[in]     c         Complex input vector @vector{c}
+ * @param[in]     length    Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]     acc_shr   Signed arithmetic right-shift applied to accumulator elements.
+ * @param[in]     b_shr     Signed arithmetic right-shift applied to elements of @vector{b}
+ * @param[in]     c_shr     Signed arithmetic right-shift applied to elements of @vector{c}
+ * 
+ * @returns  Headroom of the output vector @vector{a}
+ * 
+ * @see xs3_vect_complex_s32_macc_prepare
+ */
+headroom_t xs3_vect_complex_s32_macc(
+    complex_s32_t acc[],
+    const complex_s32_t b[],
+    const complex_s32_t c[],
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Obtain the output exponent and shifts used by xs3_vect_complex_s32_macc().
+ * 
+ * This function is used in conjunction with xs3_vect_complex_s32_macc() to perform an element-wise complex 
+ * multiply-accumulate of complex 32-bit BFP vectors.
+ * 
+ * This function computes `new_acc_exp`, `acc_shr`, `b_shr` and `c_shr` in the same way as 
+ * xs3_vect_s32_macc_prepare(), except that one more bit of growth is allowed for the complex product, whose real and 
+ * imaginary parts are each the sum or difference of two real products.
+ * 
+ * @param[out]  new_acc_exp     Exponent of the accumulator vector after the operation
+ * @param[out]  acc_shr         Signed arithmetic right-shift to be applied to accumulator elements
+ * @param[out]  b_shr           Signed arithmetic right-shift to be applied to elements of @vector{b}
+ * @param[out]  c_shr           Signed arithmetic right-shift to be applied to elements of @vector{c}
+ * @param[in]   acc_exp         Exponent of the accumulator vector before the operation
+ * @param[in]   b_exp           Exponent of @vector{b}
+ * @param[in]   c_exp           Exponent of @vector{c}
+ * @param[in]   acc_hr          Headroom of the accumulator vector before the operation
+ * @param[in]   b_hr            Headroom of @vector{b}
+ * @param[in]   c_hr            Headroom of @vector{c}
+ * 
+ * @see xs3_vect_complex_s32_macc
+ */
+void xs3_vect_complex_s32_macc_prepare(
+    exponent_t* new_acc_exp,
+    right_shift_t* acc_shr,
+    right_shift_t* b_shr,
+    right_shift_t* c_shr,
+    const exponent_t acc_exp,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t acc_hr,
+    const headroom_t b_hr,
+    const headroom_t c_hr);
+
+
 /**
  * @brief Multiply a complex 32-bit vector element-wise by a real 32-bit vector.
  * 
@@ -2163,6 +2263,226 @@ void xs3_vect_s32_mul_prepare(
     const headroom_t c_hr);
 
 
+/**
+ * @brief Multiply one 32-bit vector element-wise by another, and add the result to an accumulator vector.
+ * 
+ * `acc[]` represents the 32-bit accumulator mantissa vector @vector{a}. Each @math{a_k} uses `acc[k]` as both input 
+ * and output.
+ * 
+ * `b[]` and `c[]` represent the 32-bit input mantissa vectors @vector{b} and @vector{c}, where each @math{b_k} is 
+ * `b[k]` and each @math{c_k} is `c[k]`.
+ * 
+ * Each of the vectors must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `acc_shr` is the signed arithmetic right-shift applied to the accumulators @math{a_k}.
+ * 
+ * `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to the input elements @math{b_k} and @math{c_k}.
+ * 
+ * The product of @math{b_k} and @math{c_k} is added directly to the shifted accumulator, without being stored.
+ * 
+ * \low_op{32, @f$
+ *      \tilde{b}_k \leftarrow sat_{32}( b_k \cdot 2^{-b\_shr} )                    \\
+ *      \tilde{c}_k \leftarrow sat_{32}( c_k \cdot 2^{-c\_shr} )                    \\
+ *      \tilde{a}_k \leftarrow sat_{32}( a_k \cdot 2^{-acc\_shr} )                  \\
+ *      v_k \leftarrow sat_{32}( round( \tilde{b}_k \cdot \tilde{c}_k \cdot 2^{-30} ) )   \\
+ *      a_k \leftarrow sat_{32}( \tilde{a}_k + v_k )                                \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If inputs @vector{b} and @vector{c} are the mantissas of BFP vectors @math{\bar{b} \cdot 2^{b\_exp}} and 
+ * @math{\bar{c} \cdot 2^{c\_exp}}, and input @vector{a} is the accumulator BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, 
+ * then the output values of @vector{a} have the exponent @math{2^{a\_exp + acc\_shr}}.
+ * 
+ * For accumulation to make sense mathematically, the shifts must be chosen such that 
+ * @math{ a\_exp + acc\_shr = b\_exp + c\_exp + b\_shr + c\_shr + 30 }.
+ * 
+ * The function xs3_vect_s32_macc_prepare() can be used to obtain values for @math{acc\_shr}, @math{b\_shr} and 
+ * @math{c\_shr} based on the input exponents @math{a\_exp}, @math{b\_exp} and @math{c\_exp} and the input headrooms 
+ * @math{a\_hr}, @math{b\_hr} and @math{c\_hr}. 
+ * 
+ * @param[inout]  acc       Input/Output accumulator vector @vector{a}
+ * @param[in]     b         Input vector @vector{b}
+ * @param[in]     c         Input vector @vector{c}
+ * @param[in]     length    Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]     acc_shr   Signed arithmetic right-shift applied to accumulator elements.
+ * @param[in]     b_shr     Signed arithmetic right-shift applied to elements of @vector{b}
+ * @param[in]     c_shr     Signed arithmetic right-shift applied to elements of @vector{c}
+ * 
+ * @returns  Headroom of the output vector @vector{a}
+ * 
+ * @see xs3_vect_s32_macc_prepare
+ */
+headroom_t xs3_vect_s32_macc(
+    int32_t acc[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Multiply one 32-bit vector element-wise by another, and subtract the result from an accumulator vector.
+ * 
+ * This function is identical to xs3_vect_s32_macc(), except that the product of @math{b_k} and @math{c_k} is 
+ * subtracted from the shifted accumulator rather than added to it.
+ * 
+ * \low_op{32, @f$
+ *      \tilde{b}_k \leftarrow sat_{32}( b_k \cdot 2^{-b\_shr} )                    \\
+ *      \tilde{c}_k \leftarrow sat_{32}( c_k \cdot 2^{-c\_shr} )                    \\
+ *      \tilde{a}_k \leftarrow sat_{32}( a_k \cdot 2^{-acc\_shr} )                  \\
+ *      v_k \leftarrow sat_{32}( round( \tilde{b}_k \cdot \tilde{c}_k \cdot 2^{-30} ) )   \\
+ *      a_k \leftarrow sat_{32}( \tilde{a}_k - v_k )                                \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * The function xs3_vect_s32_macc_prepare() can be used to obtain values for @math{acc\_shr}, @math{b\_shr} and 
+ * @math{c\_shr}.
+ * 
+ * @param[inout]  acc       Input/Output accumulator vector @vector{a}
+ * @param[in]     b         Input vector @vector{b}
+ * @param[in]     c         Input vector @vector{c}
+ * @param[in]     length    Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]     acc_shr   Signed arithmetic right-shift applied to accumulator elements.
+ * @param[in]     b_shr     Signed arithmetic right-shift applied to elements of @vector{b}
+ * @param[in]     c_shr     Signed arithmetic right-shift applied to elements of @vector{c}
+ * 
+ * @returns  Headroom of the output vector @vector{a}
+ * 
+ * @see xs3_vect_s32_macc
+ * @see xs3_vect_s32_macc_prepare
+ */
+headroom_t xs3_vect_s32_nmacc(
+    int32_t acc[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Add a scaled 32-bit vector to another 32-bit vector.
+ * 
+ * `a[]`, `b[]` and `c[]` represent the 32-bit mantissa vectors @vector{a}, @vector{b} and @vector{c} respectively. 
+ * Each must begin at a word-aligned address. This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `alpha` is the 32-bit scalar @math{\alpha} by which each element of @vector{c} is multiplied.
+ * 
+ * `b_shr`, `c_shr` and `alpha_shr` are the signed arithmetic right-shifts applied to each element of @vector{b}, to 
+ * each element of @vector{c} and to @math{\alpha} respectively.
+ * 
+ * \low_op{32, @f$
+ *      \tilde{b}_k \leftarrow sat_{32}( b_k \cdot 2^{-b\_shr} )                    \\
+ *      \tilde{c}_k \leftarrow sat_{32}( c_k \cdot 2^{-c\_shr} )                    \\
+ *      \tilde{\alpha} \leftarrow sat_{32}( \alpha \cdot 2^{-alpha\_shr} )          \\
+ *      a_k \leftarrow sat_{32}( \tilde{b}_k + round( \tilde{c}_k \cdot \tilde{\alpha} \cdot 2^{-30} ) )  \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} and @vector{c} are the mantissas of BFP vectors @math{\bar{b} \cdot 2^{b\_exp}} and 
+ * @math{\bar{c} \cdot 2^{c\_exp}}, and @math{\alpha} is the mantissa of floating-point value 
+ * @math{\alpha \cdot 2^{alpha\_exp}}, then the resulting vector @vector{a} are the mantissas of BFP vector 
+ * @math{\bar{a} \cdot 2^{a\_exp}}, where @math{a\_exp = b\_exp + b\_shr}. The shifts must be chosen such that 
+ * @math{a\_exp = c\_exp + alpha\_exp + c\_shr + alpha\_shr + 30}.
+ * 
+ * The function xs3_vect_s32_macc_prepare() can be used to obtain values for @math{a\_exp}, @math{b\_shr}, 
+ * @math{c\_shr} and @math{alpha\_shr}, with @vector{b} in the role of the accumulator and @math{\alpha} in the role of 
+ * a vector whose headroom is that of @math{\alpha}.
+ * 
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   c           Input vector @vector{c}
+ * @param[in]   length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]   alpha       Scalar by which elements of @vector{c} are multiplied
+ * @param[in]   b_shr       Signed arithmetic right-shift applied to elements of @vector{b}
+ * @param[in]   c_shr       Signed arithmetic right-shift applied to elements of @vector{c}
+ * @param[in]   alpha_shr   Signed arithmetic right-shift applied to @math{\alpha}
+ * 
+ * @returns  Headroom of the output vector @vector{a}
+ * 
+ * @see xs3_vect_s32_macc_prepare
+ */
+headroom_t xs3_vect_s32_add_scaled(
+    int32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const int32_t alpha,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr,
+    const right_shift_t alpha_shr);
+
+
+/**
+ * @brief Obtain the output exponent and shifts used by xs3_vect_s32_macc() and xs3_vect_s32_nmacc().
+ * 
+ * This function is used in conjunction with xs3_vect_s32_macc() or xs3_vect_s32_nmacc() to perform an element-wise 
+ * multiply-accumulate of 32-bit BFP vectors.
+ * 
+ * This function computes `new_acc_exp`, `acc_shr`, `b_shr` and `c_shr`, which are chosen together so that neither the
+ * shifted accumulator nor the product can saturate, and so that their sum (or difference) fits in 32 bits.
+ * 
+ * `new_acc_exp` is the exponent associated with the accumulator vector @vector{a} after the operation. It is the 
+ * smallest exponent for which both the shifted accumulator and the product have at least one bit of headroom.
+ * 
+ * `acc_shr` is the shift applied to the accumulator, and `b_shr` and `c_shr` are the shifts applied to @vector{b} and 
+ * @vector{c}, such that @math{new\_acc\_exp = acc\_exp + acc\_shr = b\_exp + c\_exp + b\_shr + c\_shr + 30}.
+ * 
+ * `acc_exp`, `b_exp` and `c_exp` are the exponents associated with the accumulator vector and the input vectors 
+ * @vector{b} and @vector{c} respectively.
+ * 
+ * `acc_hr`, `b_hr` and `c_hr` are the headroom of the accumulator vector and the input vectors @vector{b} and 
+ * @vector{c} respectively. If the headroom of a vector is unknown, it can be obtained by calling 
+ * xs3_vect_s32_headroom(). Alternatively, the value `0` can always be safely used (but may result in reduced 
+ * precision).
+ * 
+ * This function can also be used with xs3_vect_s32_add_scaled(), in which case @vector{b} is the accumulator, and 
+ * @vector{c} and @math{\alpha} are the factors of the product.
+ * 
+ * @par Notes
+ * 
+ * * An output mantissa which would otherwise be `INT32_MIN` will instead saturate to `-INT32_MAX`. This can only 
+ *   happen if both the accumulator and the product are negative powers of 2 and results in 1 LSb of error.
+ * 
+ * @param[out]  new_acc_exp     Exponent of the accumulator vector after the operation
+ * @param[out]  acc_shr         Signed arithmetic right-shift to be applied to accumulator elements
+ * @param[out]  b_shr           Signed arithmetic right-shift to be applied to elements of @vector{b}
+ * @param[out]  c_shr           Signed arithmetic right-shift to be applied to elements of @vector{c}
+ * @param[in]   acc_exp         Exponent of the accumulator vector before the operation
+ * @param[in]   b_exp           Exponent of @vector{b}
+ * @param[in]   c_exp           Exponent of @vector{c}
+ * @param[in]   acc_hr          Headroom of the accumulator vector before the operation
+ * @param[in]   b_hr            Headroom of @vector{b}
+ * @param[in]   c_hr            Headroom of @vector{c}
+ * 
+ * @see xs3_vect_s32_macc
+ * @see xs3_vect_s32_nmacc
+ * @see xs3_vect_s32_add_scaled
+ */
+void xs3_vect_s32_macc_prepare(
+    exponent_t* new_acc_exp,
+    right_shift_t* acc_shr,
+    right_shift_t* b_shr,
+    right_shift_t* c_shr,
+    const exponent_t acc_exp,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t acc_hr,
+    const headroom_t b_hr,
+    const headroom_t c_hr);
+
+
 /** 
  * @brief Rectify the elements of a 32-bit vector.
  * 
@@ -2594,7 +2914,7 @@ void xs3_vect_s32_to_s16(
 
 
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 }   //extern "C"
 #endif
 
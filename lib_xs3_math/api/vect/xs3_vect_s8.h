@@ -0,0 +1,594 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+#ifndef XS3_VECT_S8_H_
+#define XS3_VECT_S8_H_
+
+#include "xs3_math_conf.h"
+#include "xs3_math_types.h"
+#include "xs3_util.h"
+
+#if defined(__XC__) || defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/**
+ * @page vector_functions8 8-bit Vector Functions
+ * 
+ * Below is a listing of the low-level API functions provided by this library that operate on 8-bit data.
+ * 
+ * An 8-bit vector occupies a quarter of the memory of the equivalent 32-bit vector. These functions are currently
+ * implemented in C on every platform, one element at a time using the VPU scalar operations, so they are not faster
+ * than their 16-bit or 32-bit counterparts.
+ */
+
+
+/**
+ * @brief Convert a 16-bit vector to an 8-bit vector.
+ * 
+ * This function converts a 16-bit mantissa vector @vector{b} into an 8-bit mantissa vector @vector{a}. Conceptually,
+ * the output BFP vector @math{\bar{a}\cdot 2^{a\_exp}} represents the same value as the input BFP vector
+ * @math{\bar{b}\cdot 2^{b\_exp}}, only with a reduced bit-depth.
+ * 
+ * In most cases @math{b\_shr} should be @math{8 - b\_hr}, where @math{b\_hr} is the headroom of the 16-bit input
+ * mantissa vector @vector{b}. The output exponent @math{a\_exp} will then be given by
+ * 
+ * @math{ a\_exp = b\_exp + b\_shr }
+ * 
+ * @par Parameter Details
+ * 
+ * `a[]` represents the 8-bit output mantissa vector @vector{a}.
+ * 
+ * `b[]` represents the 16-bit input mantissa vector @vector{b}.
+ * 
+ * `a[]` and `b[]` must each begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{b}.
+ * 
+ * \low_op{16, @f$
+ *      a_k \leftarrow sat_{8}(round(b_k \cdot 2^{-b\_shr}))      \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} are the 16-bit mantissas of a BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the resulting
+ * vector @vector{a} are the 8-bit mantissas of BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, where
+ * @math{a\_exp = b\_exp + b\_shr}.
+ * 
+ * @param[out]  a        Output vector @vector{a}
+ * @param[in]   b        Input vector @vector{b}
+ * @param[in]   length   Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shr    Right-shift appled to @vector{b}
+ * 
+ * @see xs3_vect_s8_to_s16
+ */
+void xs3_vect_s16_to_s8(
+    int8_t a[],
+    const int16_t b[],
+    const unsigned length,
+    const right_shift_t b_shr);
+
+
+/**
+ * @brief Convert a 32-bit vector to an 8-bit vector.
+ * 
+ * This function converts a 32-bit mantissa vector @vector{b} into an 8-bit mantissa vector @vector{a}. Conceptually,
+ * the output BFP vector @math{\bar{a}\cdot 2^{a\_exp}} represents the same value as the input BFP vector
+ * @math{\bar{b}\cdot 2^{b\_exp}}, only with a reduced bit-depth.
+ * 
+ * In most cases @math{b\_shr} should be @math{24 - b\_hr}, where @math{b\_hr} is the headroom of the 32-bit input
+ * mantissa vector @vector{b}. The output exponent @math{a\_exp} will then be given by
+ * 
+ * @math{ a\_exp = b\_exp + b\_shr }
+ * 
+ * @par Parameter Details
+ * 
+ * `a[]` represents the 8-bit output mantissa vector @vector{a}.
+ * 
+ * `b[]` represents the 32-bit input mantissa vector @vector{b}.
+ * 
+ * `a[]` and `b[]` must each begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{b}.
+ * 
+ * \low_op{32, @f$
+ *      a_k \leftarrow sat_{8}(round(b_k \cdot 2^{-b\_shr}))      \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} are the 32-bit mantissas of a BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the resulting
+ * vector @vector{a} are the 8-bit mantissas of BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, where
+ * @math{a\_exp = b\_exp + b\_shr}.
+ * 
+ * @param[out]  a        Output vector @vector{a}
+ * @param[in]   b        Input vector @vector{b}
+ * @param[in]   length   Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shr    Right-shift appled to @vector{b}
+ * 
+ * @see xs3_vect_s8_to_s32
+ */
+void xs3_vect_s32_to_s8(
+    int8_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr);
+
+
+/**
+ * @brief Add together two 8-bit vectors.
+ * 
+ * `a[]`, `b[]` and `c[]` represent the 8-bit vectors @vector{a}, @vector{b} and @vector{c} respectively. Each must
+ * begin at a word-aligned address. This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to each element of @vector{b} and @vector{c}
+ * respectively.
+ * 
+ * @low_op{8, @f$
+ *      b_k' = sat_{8}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)   \\
+ *      c_k' = sat_{8}(\lfloor c_k \cdot 2^{-c\_shr} \rfloor)   \\
+ *      a_k \leftarrow sat_{8}\!\left( b_k' + c_k' \right)      \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} and @vector{c} are the mantissas of BFP vectors @math{ \bar{b} \cdot 2^{b\_exp} } and
+ * @math{\bar{c} \cdot 2^{c\_exp}}, then the resulting vector @vector{a} are the mantissas of BFP vector
+ * @math{\bar{a} \cdot 2^{a\_exp}}.
+ * 
+ * In this case, @math{b\_shr} and @math{c\_shr} **must** be chosen so that
+ * @math{a\_exp = b\_exp + b\_shr = c\_exp + c\_shr}. Adding or subtracting mantissas only makes sense if they
+ * are associated with the same exponent.
+ * 
+ * The function xs3_vect_add_sub_prepare() can be used to obtain values for @math{a\_exp}, @math{b\_shr} and
+ * @math{c\_shr} based on the input exponents @math{b\_exp} and @math{c\_exp} and the input headrooms @math{b\_hr} and
+ * @math{c\_hr}.
+ * 
+ * @param[out]      a           Output vector @vector{a}
+ * @param[in]       b           Input vector @vector{b}
+ * @param[in]       c           Input vector @vector{c}
+ * @param[in]       length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]       b_shr       Right-shift appled to @vector{b}
+ * @param[in]       c_shr       Right-shift appled to @vector{c}
+ * 
+ * @returns     Headroom of the output vector @vector{a}.
+ * 
+ * @see xs3_vect_add_sub_prepare
+ */
+headroom_t xs3_vect_s8_add(
+    int8_t a[],
+    const int8_t b[],
+    const int8_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Compute the inner product of two 8-bit vectors.
+ * 
+ * `b[]` and `c[]` represent the 8-bit vectors @vector{b} and @vector{c} respectively. Each must begin at a
+ * word-aligned address.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * \low_op{8, @f$
+ *      a \leftarrow \sum_{k=0}^{length-1}\left( b_k \cdot c_k \right)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} and @vector{c} are the mantissas of the BFP vectors @math{ \bar{b} \cdot 2^{b\_exp} } and
+ * @math{\bar{c}\cdot 2^{c\_exp}, then result @math{a} is the mantissa of the result @math{a \cdot 2^{a\_exp}}, where
+ * @math{a\_exp = b\_exp + c\_exp}.
+ * 
+ * @par Notes
+ * 
+ * The sum @math{a} is accumulated exactly. No overflow or saturation of the resulting sum is possible.
+ * 
+ * @param[in] b             Input vector @vector{b}
+ * @param[in] c             Input vector @vector{c}
+ * @param[in] length        Number of elements in vectors @vector{b} and @vector{c}
+ * 
+ * @returns @math{a}, the inner product of vectors @vector{b} and @vector{c}.
+ */
+int64_t xs3_vect_s8_dot(
+    const int8_t b[],
+    const int8_t c[],
+    const unsigned length);
+
+
+/**
+ * @brief Calculate the headroom of an 8-bit vector.
+ * 
+ * The headroom of an N-bit integer is the number of bits that the integer's value may be left-shifted
+ * without any information being lost. Equivalently, it is one less than the number of leading sign bits.
+ * 
+ * The headroom of an `int8_t` array is the minimum of the headroom of each of its `int8_t` elements.
+ * 
+ * This function efficiently traverses the elements of `b[]` to determine its headroom.
+ * 
+ * `b[]` represents the 8-bit vector @vector{b}. `b[]` must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in `b[]`.
+ * 
+ * @low_op{8, @f$
+ *      a \leftarrow min\!\\{ HR_{8}\left(x_0\right), HR_{8}\left(x_1\right), ...,
+ *              HR_{8}\left(x_{length-1}\right) \\}
+ * @f$ }
+ * 
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      The number of elements in vector @vector{b}
+ * 
+ * @returns     Headroom of vector @vector{b}
+ * 
+ * @see xs3_vect_s16_headroom
+ * @see xs3_vect_s32_headroom
+ */
+headroom_t xs3_vect_s8_headroom(
+    const int8_t b[],
+    const unsigned length);
+
+
+/**
+ * @brief Multiply one 8-bit vector element-wise by another.
+ * 
+ * `a[]`, `b[]` and `c[]` represent the 8-bit vectors @vector{a}, @vector{b} and @vector{c} respectively. Each must
+ * begin at a word-aligned address. This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to each element of @vector{b} and @vector{c}
+ * respectively.
+ * 
+ * \low_op{8, @f$
+ *      b_k' \leftarrow sat_{8}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)     \\
+ *      c_k' \leftarrow sat_{8}(\lfloor c_k \cdot 2^{-c\_shr} \rfloor)     \\
+ *      a_k \leftarrow sat_{8}(round(b_k' \cdot c_k' \cdot 2^{-6}))         \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} and @vector{c} are the mantissas of BFP vectors @math{ \bar{b} \cdot 2^{b\_exp} } and
+ * @math{\bar{c} \cdot 2^{c\_exp}}, then the resulting vector @vector{a} are the mantissas of BFP vector
+ * @math{\bar{a} \cdot 2^{a\_exp}}, where @math{a\_exp = b\_exp + c\_exp + b\_shr + c\_shr + 6}.
+ * 
+ * The function xs3_vect_s8_mul_prepare() can be used to obtain values for @math{a\_exp}, @math{b\_shr} and
+ * @math{c\_shr} based on the input exponents @math{b\_exp} and @math{c\_exp} and the input headrooms @math{b\_hr} and
+ * @math{c\_hr}.
+ * 
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   c           Input vector @vector{c}
+ * @param[in]   length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]   b_shr       Right-shift appled to @vector{b}
+ * @param[in]   c_shr       Right-shift appled to @vector{c}
+ * 
+ * @returns  Headroom of output vector @vector{a}
+ * 
+ * @see xs3_vect_s8_mul_prepare
+ */
+headroom_t xs3_vect_s8_mul(
+    int8_t a[],
+    const int8_t b[],
+    const int8_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Obtain the output exponent and input shifts used by xs3_vect_s8_mul() and xs3_vect_s8_scale().
+ * 
+ * This function is used in conjunction with xs3_vect_s8_mul() to perform an element-wise multiplication of two 8-bit
+ * BFP vectors, or with xs3_vect_s8_scale() to multiply an 8-bit BFP vector by an 8-bit scalar.
+ * 
+ * This function computes `a_exp`, `b_shr` and `c_shr`.
+ * 
+ * `a_exp` is the exponent associated with mantissa vector @vector{a}, and must be chosen to be large enough to avoid
+ * overflow when elements of @vector{a} are computed. To maximize precision, this function chooses `a_exp` to be the
+ * smallest exponent known to avoid saturation. The `a_exp` chosen by this function is derived from the exponents and
+ * headrooms associated with the input vectors.
+ * 
+ * `b_shr` and `c_shr` are the shifts applied to the mantissas of @vector{b} and @vector{c} (or scalar @math{c}) before
+ * they are multiplied.
+ * 
+ * `b_exp` and `c_exp` are the exponents associated with the inputs @vector{b} and @vector{c} respectively.
+ * 
+ * `b_hr` and `c_hr` are the headroom of @vector{b} and @vector{c} respectively. If the headroom of @vector{b} or
+ * @vector{c} is unknown, they can be obtained by calling xs3_vect_s8_headroom(). Alternatively, the value `0` can
+ * always be safely used (but may result in reduced precision).
+ * 
+ * @par Notes
+ * 
+ * * Using the outputs of this function, an output mantissa which would otherwise be `INT8_MIN` will instead saturate
+ *   to `-INT8_MAX`. This is due to the symmetric saturation logic employed by the VPU and is a hardware feature. This
+ *   is a corner case which is usually unlikely and results in 1 LSb of error when it occurs.
+ * 
+ * @param[out]  a_exp       Exponent of output elements of xs3_vect_s8_mul()
+ * @param[out]  b_shr       Signed arithmetic right-shift to be applied to elements of @vector{b}
+ * @param[out]  c_shr       Signed arithmetic right-shift to be applied to elements of @vector{c}
+ * @param[in]   b_exp       Exponent associated with @vector{b}
+ * @param[in]   c_exp       Exponent associated with @vector{c}
+ * @param[in]   b_hr        Headroom of @vector{b}
+ * @param[in]   c_hr        Headroom of @vector{c}
+ * 
+ * @see xs3_vect_s8_mul
+ * @see xs3_vect_s8_scale
+ */
+void xs3_vect_s8_mul_prepare(
+    exponent_t* a_exp,
+    right_shift_t* b_shr,
+    right_shift_t* c_shr,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t b_hr,
+    const headroom_t c_hr);
+
+
+/**
+ * @brief Multiply an 8-bit vector by an 8-bit scalar.
+ * 
+ * `a[]` and `b[]` represent the 8-bit vectors @vector{a} and @vector{b} respectively. Each must begin at a
+ * word-aligned address. This operation can be performed safely in-place on `b[]`.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `c` is the 8-bit scalar @math{c} by which each element of @vector{b} is multiplied.
+ * 
+ * `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to each element of @vector{b} and to @math{c}.
+ * 
+ * \low_op{8, @f$
+ *      b_k' \leftarrow sat_{8}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)     \\
+ *      c' \leftarrow sat_{8}(\lfloor c \cdot 2^{-c\_shr} \rfloor)         \\
+ *      a_k \leftarrow sat_{8}(round(c' \cdot b_k' \cdot 2^{-6}))           \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} are the mantissas of a BFP vector @math{ \bar{b} \cdot 2^{b\_exp} } and @math{c} is the mantissa of
+ * floating-point value @math{c \cdot 2^{c\_exp}, then the resulting vector @vector{a} are the mantissas of BFP vector
+ * @math{\bar{a} \cdot 2^{a\_exp}}, where @math{a\_exp = b\_exp + c\_exp + b\_shr + c\_shr + 6}.
+ * 
+ * The function xs3_vect_s8_mul_prepare() can be used to obtain values for @math{a\_exp}, @math{b\_shr} and
+ * @math{c\_shr} based on the input exponents @math{b\_exp} and @math{c\_exp} and the input headrooms @math{b\_hr} and
+ * @math{c\_hr}.
+ * 
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   c           Scalar to be multiplied by elements of @vector{b}
+ * @param[in]   b_shr       Right-shift appled to @vector{b}
+ * @param[in]   c_shr       Right-shift applied to @math{c}
+ * 
+ * @returns  Headroom of output vector @vector{a}
+ * 
+ * @see xs3_vect_s8_mul_prepare
+ */
+headroom_t xs3_vect_s8_scale(
+    int8_t a[],
+    const int8_t b[],
+    const unsigned length,
+    const int8_t c,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Left-shift the elements of an 8-bit vector by a specified number of bits.
+ * 
+ * `a[]` and `b[]` represent the 8-bit vectors @vector{a} and @vector{b} respectively. Each must begin at a
+ * word-aligned address. This operation can be performed safely in-place on `b[]`.
+ * 
+ * `length` is the number of elements in vectors @vector{a} and @vector{b}.
+ * 
+ * `b_shl` is the signed arithmetic left-shift applied to each element of @vector{b}.
+ * 
+ * @low_op{8, @f$
+ *      a_k \leftarrow sat_{8}(\lfloor b_k \cdot 2^{b\_shl} \rfloor)        \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} are the mantissas of a BFP vector @math{ \bar{b} \cdot 2^{b\_exp} }, then the resulting vector
+ * @vector{a} are the mantissas of BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, where
+ * @math{\bar{a} = \bar{b} \cdot 2^{b\_shl}} and @math{a\_exp = b\_exp}.
+ * 
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shl       Arithmetic left-shift applied to elements of @vector{b}
+ * 
+ * @returns     Headroom of output vector @vector{a}
+ */
+headroom_t xs3_vect_s8_shl(
+    int8_t a[],
+    const int8_t b[],
+    const unsigned length,
+    const left_shift_t b_shl);
+
+
+/**
+ * @brief Right-shift the elements of an 8-bit vector by a specified number of bits.
+ * 
+ * `a[]` and `b[]` represent the 8-bit vectors @vector{a} and @vector{b} respectively. Each must begin at a
+ * word-aligned address. This operation can be performed safely in-place on `b[]`.
+ * 
+ * `length` is the number of elements in vectors @vector{a} and @vector{b}.
+ * 
+ * `b_shr` is the signed arithmetic right-shift applied to each element of @vector{b}.
+ * 
+ * @low_op{8, @f$
+ *      a_k \leftarrow sat_{8}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)       \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} are the mantissas of a BFP vector @math{ \bar{b} \cdot 2^{b\_exp} }, then the resulting vector
+ * @vector{a} are the mantissas of BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, where
+ * @math{\bar{a} = \bar{b} \cdot 2^{-b\_shr}} and @math{a\_exp = b\_exp}.
+ * 
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shr       Arithmetic right-shift applied to elements of @vector{b}
+ * 
+ * @returns     Headroom of output vector @vector{a}
+ */
+headroom_t xs3_vect_s8_shr(
+    int8_t a[],
+    const int8_t b[],
+    const unsigned length,
+    const right_shift_t b_shr);
+
+
+/**
+ * @brief Subtract one 8-bit vector from another.
+ * 
+ * `a[]`, `b[]` and `c[]` represent the 8-bit vectors @vector{a}, @vector{b} and @vector{c} respectively. Each must
+ * begin at a word-aligned address. This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to each element of @vector{b} and @vector{c}
+ * respectively.
+ * 
+ * @low_op{8, @f$
+ *      b_k' = sat_{8}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)   \\
+ *      c_k' = sat_{8}(\lfloor c_k \cdot 2^{-c\_shr} \rfloor)   \\
+ *      a_k \leftarrow sat_{8}\!\left( b_k' - c_k' \right)      \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} and @vector{c} are the mantissas of BFP vectors @math{ \bar{b} \cdot 2^{b\_exp} } and
+ * @math{\bar{c} \cdot 2^{c\_exp}}, then the resulting vector @vector{a} are the mantissas of BFP vector
+ * @math{\bar{a} \cdot 2^{a\_exp}}.
+ * 
+ * In this case, @math{b\_shr} and @math{c\_shr} **must** be chosen so that
+ * @math{a\_exp = b\_exp + b\_shr = c\_exp + c\_shr}. Adding or subtracting mantissas only makes sense if they
+ * are associated with the same exponent.
+ * 
+ * The function xs3_vect_add_sub_prepare() can be used to obtain values for @math{a\_exp}, @math{b\_shr} and
+ * @math{c\_shr} based on the input exponents @math{b\_exp} and @math{c\_exp} and the input headrooms @math{b\_hr} and
+ * @math{c\_hr}.
+ * 
+ * @param[out]      a           Output vector @vector{a}
+ * @param[in]       b           Input vector @vector{b}
+ * @param[in]       c           Input vector @vector{c}
+ * @param[in]       length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]       b_shr       Right-shift appled to @vector{b}
+ * @param[in]       c_shr       Right-shift appled to @vector{c}
+ * 
+ * @returns     Headroom of the output vector @vector{a}.
+ * 
+ * @see xs3_vect_add_sub_prepare
+ */
+headroom_t xs3_vect_s8_sub(
+    int8_t a[],
+    const int8_t b[],
+    const int8_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Convert an 8-bit vector to a 16-bit vector.
+ * 
+ * `a[]` represents the 16-bit output vector @vector{a}.
+ * 
+ * `b[]` represents the 8-bit input vector @vector{b}.
+ * 
+ * Each vector must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * @low_op{8, @f$
+ *      a_k \leftarrow b_k \cdot 2^{8}                  \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} are the mantissas of BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the resulting vector @vector{a}
+ * are the 16-bit mantissas of BFP vector @math{\bar{a} \cdot 2^{a\_exp}}. If @math{a\_exp = b\_exp - 8}, then this
+ * operation has effectively not changed the values represented.
+ * 
+ * @par Notes
+ * * The multiplication by @math{2^8} means that the headroom of output vector @vector{a} is the same as the headroom
+ *   of the input, so it is not returned by this function. This is the inverse of xs3_vect_s16_to_s8() with a `b_shr`
+ *   of 8.
+ * 
+ * @param[out]  a           16-bit output vector @vector{a}
+ * @param[in]   b           8-bit input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @see xs3_vect_s16_to_s8
+ */
+void xs3_vect_s8_to_s16(
+    int16_t a[],
+    const int8_t b[],
+    const unsigned length);
+
+
+/**
+ * @brief Convert an 8-bit vector to a 32-bit vector.
+ * 
+ * `a[]` represents the 32-bit output vector @vector{a}.
+ * 
+ * `b[]` represents the 8-bit input vector @vector{b}.
+ * 
+ * Each vector must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * @low_op{8, @f$
+ *      a_k \leftarrow b_k \cdot 2^{24}                 \\
+ *          \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * @f$ }
+ * 
+ * @par Block Floating-Point
+ * 
+ * If @vector{b} are the mantissas of BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the resulting vector @vector{a}
+ * are the 32-bit mantissas of BFP vector @math{\bar{a} \cdot 2^{a\_exp}}. If @math{a\_exp = b\_exp - 24}, then this
+ * operation has effectively not changed the values represented.
+ * 
+ * @par Notes
+ * * The multiplication by @math{2^{24}} means that the headroom of output vector @vector{a} is the same as the
+ *   headroom of the input, so it is not returned by this function. This is the inverse of xs3_vect_s32_to_s8() with a
+ *   `b_shr` of 24.
+ * 
+ * @param[out]  a           32-bit output vector @vector{a}
+ * @param[in]   b           8-bit input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @see xs3_vect_s32_to_s8
+ */
+void xs3_vect_s8_to_s32(
+    int32_t a[],
+    const int8_t b[],
+    const unsigned length);
+
+
+
+
+#if defined(__XC__) || defined(__cplusplus)
+}   //extern "C"
+#endif
+
+#endif //XS3_VECT_S8_H_
@@ -18,6 +18,7 @@
 
 #include "vect/xs3_vect_s32.h"
 #include "vect/xs3_vect_s16.h"
+#include "vect/xs3_vect_s8.h"
 #include "vect/xs3_fft.h"
 #include "vect/xs3_filters.h"
 #include "xs3_util.h"
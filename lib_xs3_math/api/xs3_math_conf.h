@@ -136,4 +136,146 @@
 
 
 
+/**
+ * @page compile_time_options Compile Time Options
+ *
+ * @par Maximum FFT Length
+ *
+ *     XS3_MATH_FFT_MAX_LOG2
+ *
+ * The base-2 logarithm of the largest FFT supported by the FFT functions (xs3_fft_dit_forward(),
+ * xs3_fft_dif_forward(), bfp_fft_forward_mono(), etc). Both real and complex FFTs of up to
+ * `(1<<XS3_MATH_FFT_MAX_LOG2)` points are supported.
+ *
+ * The twiddle factors for FFTs up to `(1<<XS3_MATH_FFT_LUT_MAX_LOG2)` points are read from look-up tables. The
+ * twiddle factors for any larger FFT stages are generated on the fly (see `XS3_MATH_FFT_LUT_MAX_LOG2` below).
+ *
+ * May not exceed the size for which the look-up tables were generated (`14` for the tables shipped with this library;
+ * see @ref fft_length_support).
+ *
+ * Defaults to `10` (1024-point FFTs).
+ *
+ * @see fft_length_support
+ */
+#ifndef XS3_MATH_FFT_MAX_LOG2
+
+/**
+ * See @ref compile_time_options for details.
+ */
+#define XS3_MATH_FFT_MAX_LOG2 (10)
+#endif
+
+
+
+/**
+ * @page compile_time_options Compile Time Options
+ *
+ * @par Compact FFT Twiddle Factors
+ *
+ *     XS3_MATH_FFT_COMPACT_TWIDDLES
+ *
+ * Iff true, the FFT functions obtain their twiddle factors from a single quarter-wave sine table 
+ * (`xs3_fft_sine_lut[]`), shared by the decimation-in-time and decimation-in-frequency FFTs, rather than from the 
+ * expanded per-stage look-up tables (`xs3_dit_fft_lut[]` and `xs3_dif_fft_lut[]`).
+ *
+ * The sine table occupies @math{4\cdot(2^{p-2}+1)} bytes, where @math{p} is `XS3_MATH_FFT_MAX_LOG2` (1028 bytes for 
+ * 1024-point FFTs, compared to 16320 bytes for the two expanded tables). In this mode `XS3_MATH_FFT_LUT_MAX_LOG2` 
+ * defaults to `4`, so the expanded tables only cover 16-point FFTs, and the twiddle factors for all larger FFT stages 
+ * are computed from the sine table as they are needed.
+ *
+ * This has a significant speed cost. Only the 16-point stages run in the optimized FFT kernels; every larger stage is
+ * computed in C as a sequence of 16-element vector operations, with twiddle factors read one at a time from the sine
+ * table. For an @math{N}-point FFT, @math{\log_2(N)-4} of the @math{\log_2(N)} stages take this slower path (6 of 10
+ * stages at 1024 points), and each of them is slower than a kernel stage because it lacks the kernels' fused
+ * butterflies and makes a function call per 16 elements. Setting
+ * `XS3_MATH_FFT_LUT_MAX_LOG2` to a larger value keeps more stages in the kernels, at @math{8\cdot(2^{p}-4)} bytes per
+ * table. The `test_xs3_fft_twiddle_layout` benchmark in the FFT unit tests reports the time per transform of both 
+ * layouts, and their ratio, on the target, and checks that they compute the same results.
+ *
+ * Defaults to false (`0`).
+ *
+ * @see fft_length_support
+ */
+#ifndef XS3_MATH_FFT_COMPACT_TWIDDLES
+
+/**
+ * See @ref compile_time_options for details.
+ */
+#define XS3_MATH_FFT_COMPACT_TWIDDLES (0)
+#endif
+
+
+
+/**
+ * @page compile_time_options Compile Time Options
+ *
+ * @par FFT Look-up Table Size
+ *
+ *     XS3_MATH_FFT_LUT_MAX_LOG2
+ *
+ * The base-2 logarithm of the largest FFT whose twiddle factors are stored in the FFT look-up tables
+ * (`xs3_dit_fft_lut[]` and `xs3_dif_fft_lut[]`). Each table occupies @math{8\cdot(2^{p}-4)} bytes, where @math{p} is
+ * the value of this option.
+ *
+ * When this is smaller than `XS3_MATH_FFT_MAX_LOG2`, FFTs larger than `(1<<XS3_MATH_FFT_LUT_MAX_LOG2)` points are
+ * computed by performing `(1<<XS3_MATH_FFT_LUT_MAX_LOG2)`-point FFTs with the look-up tables, and then computing the
+ * remaining stages with twiddle factors generated on the fly from a small seed table (or from the quarter-wave sine
+ * table, if `XS3_MATH_FFT_COMPACT_TWIDDLES` is enabled). This trades some speed for a
+ * substantially smaller memory footprint.
+ *
+ * When this is equal to `XS3_MATH_FFT_MAX_LOG2` all twiddle factors are read from the look-up tables. Setting both
+ * options to a smaller value reduces the memory footprint for applications that only require short FFTs.
+ *
+ * Must be at least `4` and no larger than `XS3_MATH_FFT_MAX_LOG2`.
+ *
+ * Defaults to `XS3_MATH_FFT_MAX_LOG2`, or to `4` if `XS3_MATH_FFT_COMPACT_TWIDDLES` is enabled.
+ *
+ * @see fft_length_support
+ */
+#ifndef XS3_MATH_FFT_LUT_MAX_LOG2
+
+/**
+ * See @ref compile_time_options for details.
+ */
+#if (XS3_MATH_FFT_COMPACT_TWIDDLES)
+# define XS3_MATH_FFT_LUT_MAX_LOG2 (4)
+#else
+# define XS3_MATH_FFT_LUT_MAX_LOG2 (XS3_MATH_FFT_MAX_LOG2)
+#endif
+#endif
+
+
+
+/**
+ * @page compile_time_options Compile Time Options
+ *
+ * @par Lazy BFP Headroom
+ *
+ *     XS3_BFP_LAZY_HEADROOM
+ *
+ * Iff true, BFP functions which would otherwise need an extra pass over their output just to measure its headroom
+ * (for example the block outputs of the overlap-save and partitioned filters) instead set the `hr` field to a 
+ * conservative lower bound derived from the headroom of their inputs, and clear the vector's `hr_exact` flag. 
+ * Headroom which the VPU computes as a side effect of the operation itself is always exact, and the BFP functions which
+ * report it set `hr_exact`.
+ *
+ * A lower bound on headroom never causes saturation, but it can cost precision. Operations which normalize their
+ * input, such as the FFT (which shifts its input to exactly 2 bits of headroom), lose as many bits as the headroom was
+ * under-reported by. Where that matters, the consumer can call bfp_s32_headroom_exact() or 
+ * bfp_complex_s32_headroom_exact(), which measure the headroom only if `hr_exact` is clear.
+ *
+ * Defaults to false (`0`).
+ *
+ * @see bfp_s32_headroom_exact
+ */
+#ifndef XS3_BFP_LAZY_HEADROOM
+
+/**
+ * See @ref compile_time_options for details.
+ */
+#define XS3_BFP_LAZY_HEADROOM (0)
+#endif
+
+
+
 #endif //XS3_MATH_CONF_H_
\ No newline at end of file
@@ -7,7 +7,7 @@
 #include <stdint.h>
 
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -202,7 +202,8 @@ typedef struct {
  *      where the multiplication and exponentiation are using real (non-modular) arithmetic.
  * 
  * The BFP API keeps the ``hr`` field up-to-date with the current headroom of ``data[]`` so as to
- * minimize precision loss as elements become small.
+ * minimize precision loss as elements become small. Where ``hr_exact`` is clear, ``hr`` is only an estimate of the
+ * headroom, usually a lower bound (see ``XS3_BFP_LAZY_HEADROOM``).
  */
 //! [bfp_s32_t]
 typedef struct {
@@ -214,6 +215,8 @@ typedef struct {
     headroom_t hr;
     /** Current size of ``data[]``, expressed in elements */
     unsigned length;
+    /** Non-zero iff ``hr`` is known to be the exact headroom of ``data[]``, rather than a lower bound on it */
+    unsigned hr_exact;
 } bfp_s32_t;
 //! [bfp_s32_t]
 
@@ -245,6 +248,32 @@ typedef struct {
 } bfp_s16_t;
 //! [bfp_s16_t]
 
+
+/**
+ * @brief A block floating-point vector of 8-bit elements.
+ * 
+ * Initialized with the ``bfp_s8_init()`` function.
+ * 
+ * The logical quantity represented by each element of this vector is:
+ *      ``data[i] * 2^(exp)``
+ *      where the multiplication and exponentiation are using real (non-modular) arithmetic.
+ * 
+ * The BFP API keeps the ``hr`` field up-to-date with the current headroom of ``data[]`` so as to
+ * minimize precision loss as elements become small.
+ */
+//! [bfp_s8_t]
+typedef struct {
+    /** Pointer to the underlying element buffer.*/
+    int8_t* data;
+    /** Exponent associated with the vector. */
+    exponent_t exp;
+    /** Current headroom in the ``data[]`` */
+    headroom_t hr;
+    /** Current size of ``data[]``, expressed in elements */
+    unsigned length;
+} bfp_s8_t;
+//! [bfp_s8_t]
+
 /**
  * @brief A block floating-point vector of complex 32-bit elements.
  * 
@@ -256,7 +285,8 @@ typedef struct {
  *      i is sqrt(-1)
  * 
  * The BFP API keeps the ``hr`` field up-to-date with the current headroom of ``data[]`` so as to
- * minimize precision loss as elements become small.
+ * minimize precision loss as elements become small. Where ``hr_exact`` is clear, ``hr`` is only an estimate of the
+ * headroom, usually a lower bound (see ``XS3_BFP_LAZY_HEADROOM``).
  */
 //! [bfp_complex_s32_t]
 typedef struct {
@@ -268,6 +298,8 @@ typedef struct {
     headroom_t hr;
     /** Current size of ``data[]``, expressed in elements */
     unsigned length;
+    /** Non-zero iff ``hr`` is known to be the exact headroom of ``data[]``, rather than a lower bound on it */
+    unsigned hr_exact;
 } bfp_complex_s32_t;
 //! [bfp_complex_s32_t]
 
@@ -395,7 +427,7 @@ typedef struct {
     double ch_b;    ///< Channel B
 } ch_pair_double_t;
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 }   //extern "C"
 #endif
 
@@ -11,7 +11,7 @@
 #include <assert.h>
 #include <math.h>
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -30,6 +30,11 @@ extern "C" {
 #define MIN(A,B) (((A) <= (B))? (A) : (B))
 
 
+/**
+ * @brief Count leading sign bits of an `int8_t`.
+ */
+#define CLS_S8(X)       (cls(X) - 24)
+
 /**
  * @brief Count leading sign bits of an `int16_t`.
  */
@@ -84,6 +89,11 @@ extern "C" {
  */
 #define HR_S16(X)   (CLS_S16(((int16_t)X))-1)
 
+/**
+ * @brief Get the headroom of an `int8_t`.
+ */
+#define HR_S8(X)    (CLS_S8(((int8_t)X))-1)
+
 /**
  * @brief Get the headroom of a `complex_s32_t`.
  */
@@ -255,7 +265,7 @@ static inline unsigned ceil_log2(
     
     return 32-cls(N-1);
 }
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 } // extern "C" 
 #endif
 
@@ -20,8 +20,9 @@ def main():
     parser.add_argument(
         "--max_fft_log2",
         type=int,
-        default=5,
-        help="Log2 of the maximum FFT size supported. (default: 5)",
+        default=14,
+        help="Log2 of the maximum FFT size supported. Smaller tables can be selected at build time using "
+        "XS3_MATH_FFT_LUT_MAX_LOG2. (default: 14)",
     )
     parser.add_argument(
         "-v",
@@ -60,23 +61,40 @@ def main():
     with open(os.path.join(args.out_dir, source_filename), "w+") as source_file:
         with open(os.path.join(args.out_dir, header_filename), "w+") as header_file:
 
-            header_file.write(
-                "// Copyright 2021 XMOS LIMITED. This Software is subject to the terms of the\n"
+            copyright = (
+                "// Copyright 2020-2021 XMOS LIMITED.\n"
+                "// This Software is subject to the terms of the XMOS Public Licence: Version 1.\n"
             )
-            header_file.write("// XMOS Public License: Version 1\n")
+
+            header_file.write(copyright + "\n")
             header_file.write("#pragma once\n")
             header_file.write('#include "xs3_math.h"\n\n')
 
+            source_file.write(copyright)
             source_file.write(f'#include "{header_filename}"\n\n')
 
-            # header.write("#ifndef %s\n"%(header_define))
-            # header.write("#define %s\n"%(header_define))
+            header_file.write(
+                "\n/** @brief Maximum FFT length (log2) for which twiddle factors have been generated. */\n"
+            )
+            header_file.write(f"#define XS3_FFT_LUT_GENERATED_LOG2 {args.max_fft_log2}\n\n")
+            header_file.write(
+                "#if (XS3_MATH_FFT_MAX_LOG2 > XS3_FFT_LUT_GENERATED_LOG2)\n"
+                "# error XS3_MATH_FFT_MAX_LOG2 exceeds the FFT length for which the look-up tables were generated.\n"
+                "#endif\n\n"
+                "#if (XS3_MATH_FFT_LUT_MAX_LOG2 > XS3_MATH_FFT_MAX_LOG2) || (XS3_MATH_FFT_LUT_MAX_LOG2 < 4)\n"
+                "# error XS3_MATH_FFT_LUT_MAX_LOG2 must be between 4 and XS3_MATH_FFT_MAX_LOG2.\n"
+                "#endif\n\n"
+            )
 
             if args.dit:
                 header_file.write(
                     "\n/** @brief Maximum FFT length (log2) that can be performed using decimation-in-time. */\n"
                 )
-                header_file.write(f"#define MAX_DIT_FFT_LOG2 {args.max_fft_log2}\n")
+                header_file.write("#define MAX_DIT_FFT_LOG2 (XS3_MATH_FFT_MAX_LOG2)\n")
+                header_file.write(
+                    "\n/** @brief Maximum FFT length (log2) with decimation-in-time twiddle factors in `xs3_dit_fft_lut[]`. */\n"
+                )
+                header_file.write("#define MAX_DIT_FFT_LUT_LOG2 (XS3_MATH_FFT_LUT_MAX_LOG2)\n")
                 header_file.write(
                     "\n/** @brief Convenience macro to index into the decimation-in-time FFT look-up table. \n\n"
                 )
@@ -84,7 +102,6 @@ def main():
                     "\tThis will return the address at which the coefficients for the final pass of the real DIT\n"
                 )
                 header_file.write("\tFFT algorithm begin. \n\n")
-                # header_file.write("\t\n")
                 header_file.write("\t@param N\tThe FFT length.\n*/\n")
                 header_file.write(
                     "#define XS3_DIT_REAL_FFT_LUT(N) &xs3_dit_fft_lut[(N)-8]\n\n"
@@ -93,7 +110,11 @@ def main():
                 header_file.write(
                     "\n/** @brief Maximum FFT length (log2) that can be performed using decimation-in-frequency. */\n"
                 )
-                header_file.write(f"#define MAX_DIF_FFT_LOG2 {args.max_fft_log2}\n")
+                header_file.write("#define MAX_DIF_FFT_LOG2 (XS3_MATH_FFT_MAX_LOG2)\n")
+                header_file.write(
+                    "\n/** @brief Maximum FFT length (log2) with decimation-in-frequency twiddle factors in `xs3_dif_fft_lut[]`. */\n"
+                )
+                header_file.write("#define MAX_DIF_FFT_LUT_LOG2 (XS3_MATH_FFT_LUT_MAX_LOG2)\n")
                 header_file.write(
                     "\n/** @brief Convenience macro to index into the decimation-in-frequency FFT look-up table. \n\n"
                 )
@@ -105,7 +126,7 @@ def main():
                 )
                 header_file.write("\t@param N\tThe FFT length.\n*/\n")
                 header_file.write(
-                    "#define XS3_DIF_FFT_LUT(N) &xs3_dif_fft_lut[(1<<(MAX_DIF_FFT_LOG2)) - (N)]\n\n"
+                    "#define XS3_DIF_FFT_LUT(N) &xs3_dif_fft_lut[(1<<(MAX_DIF_FFT_LUT_LOG2)) - (N)]\n\n"
                 )
 
             if args.dit:
@@ -126,6 +147,11 @@ def main():
                     args.max_fft_log2, header_file, source_file, args, M=32
                 )
 
+            if args.dit:
+                generate_twiddle_seed(args.max_fft_log2, header_file, source_file)
+
+            generate_sine_table(args.max_fft_log2, header_file, source_file)
+
 
 # N #number of rounds
 # M #bytes per load
@@ -144,9 +170,8 @@ def generate_DIT_FFT(N, header_file, source_file, args, M=8 * 4):
 
     table_name = "xs3_dit_fft_lut"
 
-    total_bytes = 4 * twiddle_factor_count * 8
     header_file.write(
-        f"extern const complex_s32_t {table_name}[{4*twiddle_factor_count}]; // {total_bytes} bytes\n"
+        f"extern const complex_s32_t {table_name}[(1<<MAX_DIT_FFT_LUT_LOG2)-4];\n"
     )
 
     # a_min = M*2**(N-3) >> (N-2)
@@ -200,20 +225,10 @@ def generate_DIT_FFT(N, header_file, source_file, args, M=8 * 4):
 
     twiddle_factors_int = np.reshape(twiddle_factors_int, (twiddle_factor_count * 4, 2))
 
-    source_file.write(
-        f"const complex_s32_t {table_name}[{4*twiddle_factor_count}] = \n\t{{\n\t"
-    )
-
-    for t in range(len(twiddle_factors_int)):
-        source_file.write(
-            "{%11d, %11d}, " % (twiddle_factors_int[t][0], twiddle_factors_int[t][1])
-        )
-        if (t + 1) % 4 == 0:
-            source_file.write("\n\t")
-
-    source_file.write("};\n\n")
-
-    source_file.write(f"const uint32_t {table_name}_size = sizeof({table_name});\n\n")
+    # The table for the largest FFT is the table for the next smaller FFT followed by
+    # the twiddle factors for its final stage.
+    stage_log2 = [k + 3 for k in range(N - 2)]
+    write_table(source_file, table_name, "MAX_DIT_FFT_LUT_LOG2", twiddle_factors_int, stage_log2)
 
     return table_name
 
@@ -231,10 +246,8 @@ def generate_DIF_FFT(N, header_file, source_file, args, M=8 * 4):
 
     table_name = "xs3_dif_fft_lut"
 
-    total_bytes = 4 * twiddle_factor_count * 8
-
     header_file.write(
-        f"extern const complex_s32_t {table_name}[{4*twiddle_factor_count}]; // {total_bytes} bytes\n"
+        f"extern const complex_s32_t {table_name}[(1<<MAX_DIF_FFT_LUT_LOG2)-4];\n"
     )
 
     for i in range(N - 2):
@@ -288,22 +301,159 @@ def generate_DIF_FFT(N, header_file, source_file, args, M=8 * 4):
     # Let's make them negative to invert the loading order in asm
     twiddle_factors_int = -twiddle_factors_int
 
+    # The table for the largest FFT is the twiddle factors for its first stage followed by
+    # the table for the next smaller FFT.
+    stage_log2 = [N - k for k in range(N - 2)]
+    write_table(source_file, table_name, "MAX_DIF_FFT_LUT_LOG2", twiddle_factors_int, stage_log2)
+
+    return table_name
+
+
+def write_table(source_file, table_name, lut_log2_macro, twiddle_factors_int, stage_log2):
+    """Write a twiddle factor table, one stage at a time.
+
+    Each stage's twiddle factors are wrapped in a preprocessor guard so that the table only contains
+    the stages needed for FFTs up to (1<<lut_log2_macro) points. The stage for 8-point FFTs (the
+    smallest FFT which needs twiddle factors) is always included.
+    """
+
     source_file.write(
-        f"const complex_s32_t {table_name}[{4*twiddle_factor_count}] = \n\t{{\n\t"
+        f"const complex_s32_t {table_name}[(1<<{lut_log2_macro})-4] = \n\t{{\n"
     )
 
-    for t in range(len(twiddle_factors_int)):
-        source_file.write(
-            "{%11d, %11d}, " % (twiddle_factors_int[t][0], twiddle_factors_int[t][1])
-        )
-        if (t + 1) % 4 == 0:
-            source_file.write("\n\t")
+    t = 0
+    for log2 in stage_log2:
+        count = 2 ** (log2 - 1)
+        guarded = log2 > 3
+        if guarded:
+            source_file.write(f"#if ({lut_log2_macro} >= {log2})\n")
+        source_file.write("\t")
+        for k in range(count):
+            source_file.write(
+                "{%11d, %11d}, " % (twiddle_factors_int[t][0], twiddle_factors_int[t][1])
+            )
+            t += 1
+            if (k + 1) % 4 == 0 and (k + 1) != count:
+                source_file.write("\n\t")
+        source_file.write("\n")
+        if guarded:
+            source_file.write("#endif\n")
 
-    source_file.write("};\n\n")
+    source_file.write("\t};\n\n")
 
     source_file.write(f"const uint32_t {table_name}_size = sizeof({table_name});\n\n")
 
-    return table_name
+
+def generate_twiddle_seed(N, header_file, source_file):
+    """Write the table of principal roots of unity used to generate twiddle factors on the fly.
+
+    Entry p is exp(-2j*pi / 2**p) for 0 <= p <= N, in Q30 format.
+    """
+
+    table_name = "xs3_fft_twiddle_seed"
+
+    header_file.write(
+        "\n/** @brief Principal roots of unity (@math{e^{-j2\\pi/2^p}}, Q30) used to generate twiddle factors for FFT\n"
+        "\tstages which are not covered by the look-up tables. */\n"
+    )
+    header_file.write("#if (MAX_DIT_FFT_LUT_LOG2 < MAX_DIT_FFT_LOG2) && !(XS3_MATH_FFT_COMPACT_TWIDDLES)\n")
+    header_file.write(f"extern const complex_s32_t {table_name}[{N+1}];\n")
+    header_file.write("#endif\n")
+
+    roots = np.exp(-2.0j * np.pi / (2.0 ** np.arange(N + 1)))
+    r = roots.view(np.float64).flatten()
+    roots_int = np.reshape(np.asarray(np.rint(r * 2 ** 30), dtype=np.int32), (N + 1, 2))
+
+    source_file.write("#if (MAX_DIT_FFT_LUT_LOG2 < MAX_DIT_FFT_LOG2) && !(XS3_MATH_FFT_COMPACT_TWIDDLES)\n")
+    source_file.write(f"const complex_s32_t {table_name}[{N+1}] = \n\t{{\n\t")
+    for p in range(N + 1):
+        source_file.write("{%11d, %11d}, " % (roots_int[p][0], roots_int[p][1]))
+        if (p + 1) % 4 == 0 and (p + 1) != (N + 1):
+            source_file.write("\n\t")
+    source_file.write("\n\t};\n")
+    source_file.write("#endif\n\n")
+
+
+def generate_sine_table(N, header_file, source_file):
+    """Write the quarter-wave sine tables.
+
+    The 32-bit (Q30) table is used (by both the DIT and DIF FFTs) when XS3_MATH_FFT_COMPACT_TWIDDLES is enabled. The
+    16-bit (Q14) table holds the twiddle factors for the 16-bit FFTs.
+
+    Each table holds sin(2*pi*i / 2**N) for 0 <= i <= 2**(N-2), ordered so that the table for a smaller maximum FFT
+    length is a prefix of the table for a larger one. Entries 0 and 1 are sin(0) and sin(pi/2). Entries 2**(l-3)+1
+    through 2**(l-2) hold sin(2*pi*m / 2**l) for the odd values 0 < m < 2**(l-2), in ascending order.
+    """
+
+    header_file.write(
+        "\n/** @brief Number of elements in the quarter-wave sine tables. */\n"
+        "#define XS3_FFT_SINE_LUT_SIZE ((1<<(XS3_MATH_FFT_MAX_LOG2-2))+1)\n"
+    )
+    header_file.write(
+        "\n/** @brief Get the index of @math{sin(2\\pi i/2^P)}, for @math{0 \\le i \\le 2^{P-2}}, within a quarter-wave sine\n"
+        "\ttable (`xs3_fft_sine_lut[]` or `xs3_fft_sine_lut_s16[]`). See gen_fft_table.py for the table layout. */\n"
+        "static inline unsigned xs3_fft_sine_lut_index(\n"
+        "    unsigned i,\n"
+        "    unsigned P)\n"
+        "{\n"
+        "    if(i == 0)\n"
+        "        return 0;\n"
+        "\n"
+        "    // Reduce i/2^P to lowest terms\n"
+        "    while(!(i & 1)){\n"
+        "        i >>= 1;\n"
+        "        P--;\n"
+        "    }\n"
+        "\n"
+        "    return (P == 2)? 1 : (1 << (P-3)) + 1 + (i >> 1);\n"
+        "}\n"
+    )
+
+    header_file.write(
+        "\n/** @brief Quarter-wave sine table (Q30) from which the twiddle factors of FFT stages not covered by the look-up\n"
+        "\ttables are computed when `XS3_MATH_FFT_COMPACT_TWIDDLES` is enabled. */\n"
+    )
+    header_file.write("#if (XS3_MATH_FFT_COMPACT_TWIDDLES)\n")
+    header_file.write("extern const int32_t xs3_fft_sine_lut[XS3_FFT_SINE_LUT_SIZE];\n")
+    header_file.write("#endif\n")
+
+    header_file.write(
+        "\n/** @brief Quarter-wave sine table (Q14) from which the twiddle factors of the 16-bit FFTs are computed. */\n"
+    )
+    header_file.write("extern const int16_t xs3_fft_sine_lut_s16[XS3_FFT_SINE_LUT_SIZE];\n")
+
+    source_file.write("#if (XS3_MATH_FFT_COMPACT_TWIDDLES)\n")
+    write_sine_table(N, source_file, "xs3_fft_sine_lut", "int32_t", 30, 11, 8)
+    source_file.write("#endif\n\n")
+
+    write_sine_table(N, source_file, "xs3_fft_sine_lut_s16", "int16_t", 14, 6, 16)
+    source_file.write("\n")
+
+
+def write_sine_table(N, source_file, table_name, elm_type, q_format, width, per_line):
+    """Write a quarter-wave sine table, one FFT length at a time. See generate_sine_table()."""
+
+    to_fixed = lambda v: int(np.rint(v * 2 ** q_format))
+    fmt = f"%{width}d, "
+
+    source_file.write(f"const {elm_type} {table_name}[XS3_FFT_SINE_LUT_SIZE] = \n\t{{\n")
+    source_file.write("\t" + (fmt % to_fixed(0.0)) + (fmt % to_fixed(1.0)) + "\n")
+
+    for log2 in range(3, N + 1):
+        guarded = log2 > 3
+        if guarded:
+            source_file.write(f"#if (XS3_MATH_FFT_MAX_LOG2 >= {log2})\n")
+        source_file.write("\t")
+        odd = list(range(1, 2 ** (log2 - 2), 2))
+        for k, m in enumerate(odd):
+            source_file.write(fmt % to_fixed(np.sin(2.0 * np.pi * m / 2 ** log2)))
+            if (k + 1) % per_line == 0 and (k + 1) != len(odd):
+                source_file.write("\n\t")
+        source_file.write("\n")
+        if guarded:
+            source_file.write("#endif\n")
+
+    source_file.write("\t};\n")
 
 
 if __name__ == "__main__":
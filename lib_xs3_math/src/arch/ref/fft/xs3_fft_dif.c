@@ -7,6 +7,7 @@
 #include "xs3_math.h"
 #include "../../../vect/vpu_helper.h"
 #include "../../../vect/xs3_fft_lut.h"
+#include "../../../vect/xs3_fft_ext.h"
 
 //load 4 complex 32-bit values into a buffer
 static void load_vec(
@@ -18,6 +19,18 @@ static void load_vec(
     }
 }
 
+//accumulate 4 complex 32-bit values into a headroom mask
+static unsigned hrmask_vec(
+    unsigned hr_mask,
+    const complex_s32_t v[])
+{
+    for(int i = 0; i < 4; i++){
+        hr_mask = HRMASK_ADD(hr_mask, v[i].re);
+        hr_mask = HRMASK_ADD(hr_mask, v[i].im);
+    }
+    return hr_mask;
+}
+
 static void vftff(
     complex_s32_t vR[],
     const right_shift_t shift_mode)
@@ -76,7 +89,7 @@ static void vftfb(
 
 
 
-void xs3_fft_dif_forward (
+void XS3_FFT_LUT_KERNEL(xs3_fft_dif_forward)(
     complex_s32_t x[], 
     const unsigned N, 
     headroom_t* hr, 
@@ -90,6 +103,7 @@ void xs3_fft_dif_forward (
     right_shift_t shift_mode = 0;
 
     complex_s32_t vD[4] = {{0}}, vR[4] = {{0}}, vC[4] = {{0}};
+    unsigned hr_mask = 0;
 
     shift_mode = (*hr == 3)? 0 : (*hr < 3)? 1 : -1;
     exp_modifier += shift_mode;
@@ -120,15 +134,18 @@ void xs3_fft_dif_forward (
                     }
 
                     load_vec(&x[s], vR);
+                    hr_mask = hrmask_vec(hr_mask, vR);
 
                     xs3_vect_complex_s32_mul(vR, vD, vC, 4, 0, 0);
 
                     load_vec(&x[s+b], vR);
+                    hr_mask = hrmask_vec(hr_mask, vR);
                     
                 };
             }
             
-            const headroom_t cur_hr = xs3_vect_complex_s32_headroom(x, N);
+            const headroom_t cur_hr = hr_from_mask(hr_mask);
+            hr_mask = 0;
             
             shift_mode = (cur_hr == 3)? 0 : (cur_hr < 3)? 1 : -1;
             exp_modifier += shift_mode;
@@ -141,16 +158,17 @@ void xs3_fft_dif_forward (
         load_vec(vR, &x[4*j]);
         vftff(vR, shift_mode);
         load_vec(&x[4*j], vR);
+        hr_mask = hrmask_vec(hr_mask, vR);
     }
 
-    *hr = xs3_vect_complex_s32_headroom(x, N);
+    *hr = hr_from_mask(hr_mask);
     *exp = *exp + exp_modifier;
 }
 
 
 
 
-void xs3_fft_dif_inverse (
+void XS3_FFT_LUT_KERNEL(xs3_fft_dif_inverse)(
     complex_s32_t x[], 
     const unsigned N, 
     headroom_t* hr, 
@@ -164,6 +182,7 @@ void xs3_fft_dif_inverse (
     right_shift_t shift_mode = 0;
 
     complex_s32_t vD[4] = {{0}}, vR[4] = {{0}}, vC[4] = {{0}};
+    unsigned hr_mask = 0;
 
     shift_mode = (*hr == 3)? 0 : (*hr < 3)? 1 : -1;
     exp_modifier += shift_mode;
@@ -194,15 +213,18 @@ void xs3_fft_dif_inverse (
                     }
 
                     load_vec(&x[s], vR);
+                    hr_mask = hrmask_vec(hr_mask, vR);
 
                     xs3_vect_complex_s32_conj_mul(vR, vD, vC, 4, 0, 0);
 
                     load_vec(&x[s+b], vR);
+                    hr_mask = hrmask_vec(hr_mask, vR);
                     
                 };
             }
             
-            const headroom_t cur_hr = xs3_vect_complex_s32_headroom(x, N);
+            const headroom_t cur_hr = hr_from_mask(hr_mask);
+            hr_mask = 0;
             
             shift_mode = (cur_hr == 3)? 0 : (cur_hr < 3)? 1 : -1;
             exp_modifier += shift_mode;
@@ -215,8 +237,9 @@ void xs3_fft_dif_inverse (
         load_vec(vR, &x[4*j]);
         vftfb(vR, shift_mode);
         load_vec(&x[4*j], vR);
+        hr_mask = hrmask_vec(hr_mask, vR);
     }
 
-    *hr = xs3_vect_complex_s32_headroom(x, N);
+    *hr = hr_from_mask(hr_mask);
     *exp = *exp + exp_modifier;
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "xs3_math.h"
 #include "../../../vect/vpu_helper.h"
 #include "../../../vect/xs3_fft_lut.h"
+#include "../../../vect/xs3_fft_ext.h"
 
 //load 4 complex 32-bit values into a buffer
 static void load_vec(
@@ -18,6 +19,18 @@ static void load_vec(
     }
 }
 
+//accumulate 4 complex 32-bit values into a headroom mask
+static unsigned hrmask_vec(
+    unsigned hr_mask,
+    const complex_s32_t v[])
+{
+    for(int i = 0; i < 4; i++){
+        hr_mask = HRMASK_ADD(hr_mask, v[i].re);
+        hr_mask = HRMASK_ADD(hr_mask, v[i].im);
+    }
+    return hr_mask;
+}
+
 static void vfttf(
     complex_s32_t vD[],
     const right_shift_t shift_mode)
@@ -76,7 +89,7 @@ static void vfttb(
 
 
 
-void xs3_fft_dit_forward (
+void XS3_FFT_LUT_KERNEL(xs3_fft_dit_forward)(
     complex_s32_t x[], 
     const unsigned N, 
     headroom_t* hr, 
@@ -96,10 +109,13 @@ void xs3_fft_dit_forward (
     exp_modifier += shift_mode;
 
 
+    unsigned hr_mask = 0;
+
     for(int j = 0; j < (N>>2); j++){
         load_vec(vD, &x[4*j]);
         vfttf(vD, shift_mode);
         load_vec(&x[4*j], vD);
+        hr_mask = hrmask_vec(hr_mask, vD);
     }
 
     if(N != 4){
@@ -111,7 +127,8 @@ void xs3_fft_dit_forward (
             int b = 1<<(n+2);
             int a = 1<<((FFT_N_LOG2-3)-n);
 
-            headroom_t cur_hr = xs3_vect_complex_s32_headroom(x, N);
+            headroom_t cur_hr = hr_from_mask(hr_mask);
+            hr_mask = 0;
 
             shift_mode = (cur_hr == 3)? 0 : (cur_hr < 3)? 1 : -1;
             exp_modifier += shift_mode;
@@ -137,20 +154,22 @@ void xs3_fft_dit_forward (
 
                     load_vec(&x[s], vR);
                     load_vec(&x[s+b], vD);
+                    hr_mask = hrmask_vec(hr_mask, vR);
+                    hr_mask = hrmask_vec(hr_mask, vD);
                     s += 2*b;
                 };
             }
         }
     }
 
-    *hr = xs3_vect_complex_s32_headroom(x, N);
+    *hr = hr_from_mask(hr_mask);
     *exp = *exp + exp_modifier;
 }
 
 
 
 
-void xs3_fft_dit_inverse (
+void XS3_FFT_LUT_KERNEL(xs3_fft_dit_inverse)(
     complex_s32_t x[], 
     const unsigned N, 
     headroom_t* hr, 
@@ -170,10 +189,13 @@ void xs3_fft_dit_inverse (
     exp_modifier += shift_mode;
     exp_modifier += -2;
 
+    unsigned hr_mask = 0;
+
     for(int j = 0; j < (N>>2); j++){
         load_vec(vD, &x[4*j]);
         vfttb(vD, shift_mode);
         load_vec(&x[4*j], vD);
+        hr_mask = hrmask_vec(hr_mask, vD);
     }
 
     if(N != 4){
@@ -183,7 +205,8 @@ void xs3_fft_dit_inverse (
             int b = 1<<(n+2);
             int a = 1<<((FFT_N_LOG2-3)-n);
 
-            headroom_t cur_hr = xs3_vect_complex_s32_headroom(x, N);
+            headroom_t cur_hr = hr_from_mask(hr_mask);
+            hr_mask = 0;
 
             shift_mode = (cur_hr == 3)? 0 : (cur_hr < 3)? 1 : -1;
             exp_modifier += shift_mode;
@@ -210,12 +233,14 @@ void xs3_fft_dit_inverse (
 
                     load_vec(&x[s], vR);
                     load_vec(&x[s+b], vD);
+                    hr_mask = hrmask_vec(hr_mask, vR);
+                    hr_mask = hrmask_vec(hr_mask, vD);
                     s += 2*b;
                 };
             }
         }
     }
 
-    *hr = xs3_vect_complex_s32_headroom(x, N);
+    *hr = hr_from_mask(hr_mask);
     *exp = *exp + exp_modifier;
 }
@@ -5,6 +5,7 @@
 #include "../../../vect/vpu_helper.h"
 #include "../../../vect/vpu_const_vects.h"
 #include "../../../vect/xs3_fft_lut.h"
+#include "../../../vect/xs3_fft_ext.h"
 
 static unsigned bitrev(unsigned index, size_t bit_width)
 {
@@ -165,7 +166,7 @@ headroom_t xs3_fft_spectra_merge(
 }
 
 
-void xs3_fft_mono_adjust(
+headroom_t XS3_FFT_LUT_KERNEL(xs3_fft_mono_adjust)(
     complex_s32_t x[],
     const unsigned FFT_N,
     const unsigned inverse)
@@ -192,6 +193,10 @@ void xs3_fft_mono_adjust(
         p_X_lo = tmp;
     }
 
+    // The first vector of each half holds the DC and Nyquist elements, which are fixed after the loop, so the
+    // headroom of the others is measured after the loop instead
+    headroom_t hr = 31;
+
     for(int k = 0; k < (FFT_N/4); k+=4){
 
         complex_s32_t X_lo[VEC_ELMS], X_hi[VEC_ELMS], tmp[VEC_ELMS], A[VEC_ELMS], B[VEC_ELMS];
@@ -224,13 +229,16 @@ void xs3_fft_mono_adjust(
         // new_X_lo = A*X_lo + B*conjugate(X_hi)
         xs3_vect_complex_s32_mul(p_X_lo, A, X_lo, VEC_ELMS, 0, 0);
         xs3_vect_complex_s32_conj_mul(tmp, B, X_hi, VEC_ELMS, 0, 0);
-        xs3_vect_complex_s32_add(p_X_lo, p_X_lo, tmp, VEC_ELMS, 0, 0);
+        const headroom_t lo_hr = xs3_vect_complex_s32_add(p_X_lo, p_X_lo, tmp, VEC_ELMS, 0, 0);
 
         // new_X_hi = conjugate(A)*X_hi + conjugate(B)*conjugate(X_lo)
         xs3_vect_complex_s32_conj_mul(p_X_hi, X_hi, A, VEC_ELMS, 0, 0);
         xs3_vect_s32_mul((int32_t*)B,(int32_t*)B,(int32_t*)vpu_vec_complex_conj_op, 2*VEC_ELMS, 0, 0);
         xs3_vect_complex_s32_conj_mul(tmp, B, X_lo, VEC_ELMS, 0, 0);
-        xs3_vect_complex_s32_add(p_X_hi, p_X_hi, tmp, VEC_ELMS, 0, 0);
+        const headroom_t hi_hr = xs3_vect_complex_s32_add(p_X_hi, p_X_hi, tmp, VEC_ELMS, 0, 0);
+
+        if(k != 0)
+            hr = MIN(hr, MIN(lo_hr, hi_hr));
 
         W = &W[-VEC_ELMS];
         p_X_lo = &p_X_lo[VEC_ELMS];
@@ -247,8 +255,17 @@ void xs3_fft_mono_adjust(
     x[0].im = X0.re - X0.im;
     x[FFT_N/4].re =  XQ.re;
     x[FFT_N/4].im = -XQ.im;
+
+    for(int i = 0; i < VEC_ELMS; i++){
+        hr = MIN(hr, HR_S32(x[i].re));
+        hr = MIN(hr, HR_S32(x[i].im));
+        hr = MIN(hr, HR_S32(x[FFT_N/4 + i].re));
+        hr = MIN(hr, HR_S32(x[FFT_N/4 + i].im));
+    }
     
     xs3_vect_complex_s32_tail_reverse(&x[FFT_N/4], FFT_N/4);
+
+    return hr;
 }
 
 
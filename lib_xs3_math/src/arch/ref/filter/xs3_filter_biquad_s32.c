@@ -19,22 +19,24 @@ int32_t xs3_filter_biquad_s32(
     const int32_t new_sample)
 {
 
+    // Only the first biquad_count lanes hold active sections
+    const unsigned N = filter->biquad_count;
     int64_t accs[8] = { 0 };
 
     // -a2 * y[n-2]
-    for(int i = 0; i < 8; i++)
+    for(int i = 0; i < N; i++)
         accs[i] += MUL32(filter->state[1][i+1], filter->coef[4][i]);
     
     // -a1 * y[n-1]
-    for(int i = 0; i < 8; i++)
+    for(int i = 0; i < N; i++)
         accs[i] += MUL32(filter->state[0][i+1], filter->coef[3][i]);
         
     // b2 * x[n-2]
-    for(int i = 0; i < 8; i++)
+    for(int i = 0; i < N; i++)
         accs[i] += MUL32(filter->state[1][i], filter->coef[2][i]);
 
     // b1 * x[n-1]
-    for(int i = 0; i < 8; i++)
+    for(int i = 0; i < N; i++)
         accs[i] += MUL32(filter->state[0][i], filter->coef[1][i]);
 
     //Before dealing with b0 * x[n], we need to move some memory around.
@@ -43,12 +45,12 @@ int32_t xs3_filter_biquad_s32(
 
     // And calculate each new output
     filter->state[0][0] = new_sample;
-    for(int i = 0; i < filter->biquad_count; i++){
+    for(int i = 0; i < N; i++){
         accs[i] += MUL32(filter->state[0][i], filter->coef[0][i]);
         
         // The output is the input to the next biquad
         filter->state[0][i+1] = (int32_t) accs[i];
     }
     
-    return filter->state[0][filter->biquad_count];
+    return filter->state[0][N];
 }
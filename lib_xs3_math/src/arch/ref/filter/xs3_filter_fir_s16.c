@@ -36,6 +36,21 @@ void xs3_push_sample_down_s16(
 
 
 
+// Number of output samples computed together by xs3_filter_fir_s16_block()
+#define FIR_S16_BLOCK_OUTPUTS   (4)
+
+
+static int16_t fir_s16_finish(
+    int32_t sum,
+    const right_shift_t shift)
+{
+    if(shift > 0)   sum = (sum + (1<<(shift-1))) >> shift;
+    else            sum <<= -shift;
+
+    return (int16_t) sum;
+}
+
+
 int16_t xs3_filter_fir_s16(
     xs3_filter_fir_s16_t* filter,
     const int16_t new_sample)
@@ -45,11 +60,52 @@ int16_t xs3_filter_fir_s16(
     int32_t sum = 0;
 
     for(int i = 0; i < filter->num_taps; i++){
-        sum += filter->state[i] * filter->coef[i];
+        sum += filter->window[i] * filter->coef[i];
     }
 
-    if(filter->shift >= 0)  sum = (sum + (1<<(filter->shift-1))) >> filter->shift;
-    else                    sum <<= -filter->shift;
+    return fir_s16_finish(sum, filter->shift);
+}
+
 
-    return (int16_t) sum;
+void xs3_filter_fir_s16_block(
+    xs3_filter_fir_s16_t* filter,
+    int16_t output[],
+    const int16_t new_samples[],
+    const unsigned length)
+{
+    const unsigned N = filter->num_taps;
+
+    for(unsigned n = 0; n < length; n += FIR_S16_BLOCK_OUTPUTS){
+
+        const unsigned G = MIN(FIR_S16_BLOCK_OUTPUTS, length - n);
+        const int16_t* x = &new_samples[n];
+        const int16_t* window = filter->window;
+
+        int32_t sum[FIR_S16_BLOCK_OUTPUTS] = {0};
+        int16_t smp[FIR_S16_BLOCK_OUTPUTS] = {0};
+
+        // Output j pairs coefficient k with new sample x[j-k] if k <= j, or otherwise with window[k-j-1] from before
+        // any of the G new samples were added. As with xs3_filter_fir_s32_block(), the samples slide through smp[].
+        for(unsigned j = 0; j < G; j++)
+            smp[j] = x[j];
+
+        for(unsigned k = 0; k < N; k++){
+            const int16_t coef = filter->coef[k];
+
+            for(unsigned j = 0; j < FIR_S16_BLOCK_OUTPUTS; j++)
+                sum[j] += smp[j] * coef;
+
+            for(unsigned j = FIR_S16_BLOCK_OUTPUTS-1; j > 0; j--)
+                smp[j] = smp[j-1];
+
+            smp[0] = window[k];
+        }
+
+        // The new samples are added before the outputs are written in case output[] is new_samples[]
+        for(unsigned j = 0; j < G; j++)
+            xs3_filter_fir_s16_add_sample(filter, x[j]);
+
+        for(unsigned j = 0; j < G; j++)
+            output[n+j] = fir_s16_finish(sum[j], filter->shift);
+    }
 }
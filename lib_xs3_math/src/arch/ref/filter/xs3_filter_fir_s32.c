@@ -12,6 +12,25 @@
 
 
 
+// Number of output samples computed together by xs3_filter_fir_s32_block()
+#define FIR_S32_BLOCK_OUTPUTS   (4)
+
+
+static int32_t fir_s32_finish(
+    vpu_int32_acc_t acc,
+    const right_shift_t shift)
+{
+    if(shift > 0){
+        acc += (1 << (shift-1));
+        acc = acc >> shift;
+    } else {
+        acc = acc << (-shift);
+    }
+
+    return SAT(32)(acc);
+}
+
+
 int32_t xs3_filter_fir_s32(
     xs3_filter_fir_s32_t* filter,
     const int32_t new_sample)
@@ -31,14 +50,55 @@ int32_t xs3_filter_fir_s32(
     for(int i = 0; i < N_B; i++)
         acc = vlmacc32(acc, filter->state[i], filter->coef[N_A + i]);
 
+    return fir_s32_finish(acc, filter->shift);
+}
 
-    if(filter->shift >= 0){
-        acc += (1 << (filter->shift-1));
-        acc = acc >> filter->shift;
-    } else {
-        acc = acc << (-filter->shift);
-    }
 
-    return SAT(32)(acc);
+void xs3_filter_fir_s32_block(
+    xs3_filter_fir_s32_t* filter,
+    int32_t output[],
+    const int32_t new_samples[],
+    const unsigned length)
+{
+    const unsigned N = filter->num_taps;
+
+    for(unsigned n = 0; n < length; n += FIR_S32_BLOCK_OUTPUTS){
+
+        const unsigned G = MIN(FIR_S32_BLOCK_OUTPUTS, length - n);
+        const int32_t* x = &new_samples[n];
+        const unsigned head = filter->head;
+
+        vpu_int32_acc_t acc[FIR_S32_BLOCK_OUTPUTS] = {0};
+        int32_t smp[FIR_S32_BLOCK_OUTPUTS] = {0};
+
+        // Output j pairs coefficient k with new sample x[j-k] if k <= j, or otherwise with the sample in the state
+        // buffer at (head + k - j), which is not overwritten by any of x[0..j]. The sample for output j at tap k+1 is
+        // the one for output j-1 at tap k, so the samples slide through smp[] and each tap needs only one coefficient
+        // load and one sample load for all the outputs. The taps are accumulated in the same order as by 
+        // xs3_filter_fir_s32(), so the results are identical.
+        for(unsigned j = 0; j < G; j++)
+            smp[j] = x[j];
+
+        unsigned idx = head;
 
+        for(unsigned k = 0; k < N; k++){
+            const int32_t coef = filter->coef[k];
+
+            for(unsigned j = 0; j < FIR_S32_BLOCK_OUTPUTS; j++)
+                acc[j] = vlmacc32(acc[j], smp[j], coef);
+
+            for(unsigned j = FIR_S32_BLOCK_OUTPUTS-1; j > 0; j--)
+                smp[j] = smp[j-1];
+
+            if(++idx == N) idx = 0;
+            smp[0] = filter->state[idx];
+        }
+
+        // The new samples are added before the outputs are written in case output[] is new_samples[]
+        for(unsigned j = 0; j < G; j++)
+            xs3_filter_fir_s32_add_sample(filter, x[j]);
+
+        for(unsigned j = 0; j < G; j++)
+            output[n+j] = fir_s32_finish(acc[j], filter->shift);
+    }
 }
\ No newline at end of file
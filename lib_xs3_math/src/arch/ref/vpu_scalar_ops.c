@@ -50,7 +50,7 @@ int8_t vlashr8(
 {
     if((shr <= -8) && (x != 0) )    return (x >= 0)? VPU_INT8_MAX : VPU_INT8_MIN;
     else if(shr < 0)                return SAT(8)(((int32_t)x) << (-shr));
-    else                            return SAT(8)(x >> shr);
+    else                            return SAT(8)(x >> MIN(shr, 7));
 }
 
 
@@ -150,7 +150,7 @@ int16_t vlashr16(
 {
     if((shr <= -16) && (x != 0) )   return (x >= 0)? VPU_INT16_MAX : VPU_INT16_MIN;
     else if(shr < 0)                return SAT(16)(((int32_t)x) << (-shr));
-    else                            return SAT(16)(x >> shr);
+    else                            return SAT(16)(x >> MIN(shr, 15));
 }
 
 
@@ -271,7 +271,7 @@ int32_t vlashr32(
 {
     if((shr <= -32) && (x != 0) )   return (x >= 0)? VPU_INT32_MAX : VPU_INT32_MIN;
     else if(shr < 0)                return SAT(32)(((int64_t)x) << (-shr));
-    else                            return SAT(32)(x >> shr);
+    else                            return SAT(32)(x >> MIN(shr, 31));
 }
 
 
@@ -0,0 +1,34 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <stdint.h>
+
+#include "xs3_math.h"
+
+
+// Convenience wrappers which process each block of samples by calling the per-sample kernels once per sample. This
+// gives results identical to xs3_filter_fir_s32() and xs3_filter_fir_s16(), at the same cost per sample. There is no
+// register-blocked VPU kernel for these.
+
+
+void xs3_filter_fir_s32_block(
+    xs3_filter_fir_s32_t* filter,
+    int32_t output[],
+    const int32_t new_samples[],
+    const unsigned length)
+{
+    for(unsigned n = 0; n < length; n++)
+        output[n] = xs3_filter_fir_s32(filter, new_samples[n]);
+}
+
+
+void xs3_filter_fir_s16_block(
+    xs3_filter_fir_s16_t* filter,
+    int16_t output[],
+    const int16_t new_samples[],
+    const unsigned length)
+{
+    for(unsigned n = 0; n < length; n++)
+        output[n] = xs3_filter_fir_s16(filter, new_samples[n]);
+}
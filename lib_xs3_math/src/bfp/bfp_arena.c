@@ -0,0 +1,170 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <stdio.h>
+#include <assert.h>
+
+#include "bfp_math.h"
+
+
+// Number of bytes needed to round n up to a multiple of BFP_ARENA_ALIGN
+#define ALIGN_PAD(N)    ((BFP_ARENA_ALIGN - ((N) % BFP_ARENA_ALIGN)) % BFP_ARENA_ALIGN)
+
+
+void bfp_arena_init(
+    bfp_arena_t* arena,
+    void* buffer,
+    const unsigned size)
+{
+    const unsigned pad = ALIGN_PAD((uintptr_t) buffer);
+
+    arena->base = ((uint8_t*) buffer) + pad;
+    // Only whole aligned blocks are usable, so that arena->used stays aligned
+    arena->size = (size > pad)? (size - pad) - ((size - pad) % BFP_ARENA_ALIGN) : 0;
+    arena->used = 0;
+    arena->high_water = 0;
+}
+
+
+void* bfp_arena_alloc(
+    bfp_arena_t* arena,
+    const unsigned size)
+{
+    // arena->used and arena->size are always multiples of BFP_ARENA_ALIGN, so only the block's size needs to be padded
+    const unsigned avail = arena->size - arena->used;
+
+    if(size > avail)
+        return NULL;
+
+    void* block = &arena->base[arena->used];
+
+    arena->used += size + ALIGN_PAD(size);
+    arena->high_water = MAX(arena->high_water, arena->used);
+
+    return block;
+}
+
+
+bfp_arena_mark_t bfp_arena_mark(
+    const bfp_arena_t* arena)
+{
+    return arena->used;
+}
+
+
+void bfp_arena_reset(
+    bfp_arena_t* arena,
+    const bfp_arena_mark_t mark)
+{
+    assert(mark <= arena->used);
+
+    arena->used = mark;
+}
+
+
+unsigned bfp_arena_available(
+    const bfp_arena_t* arena)
+{
+    return arena->size - arena->used;
+}
+
+
+unsigned bfp_arena_high_water(
+    const bfp_arena_t* arena)
+{
+    return arena->high_water;
+}
+
+
+int8_t* bfp_s8_init_from_arena(
+    bfp_s8_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length)
+{
+    int8_t* data = (int8_t*) bfp_arena_alloc(arena, length * sizeof(int8_t));
+    bfp_s8_init(a, data, exp, length, 0);
+    return data;
+}
+
+
+int16_t* bfp_s16_init_from_arena(
+    bfp_s16_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length)
+{
+    int16_t* data = (int16_t*) bfp_arena_alloc(arena, length * sizeof(int16_t));
+    bfp_s16_init(a, data, exp, length, 0);
+    return data;
+}
+
+
+int32_t* bfp_s32_init_from_arena(
+    bfp_s32_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length)
+{
+    int32_t* data = (int32_t*) bfp_arena_alloc(arena, length * sizeof(int32_t));
+    bfp_s32_init(a, data, exp, length, 0);
+    return data;
+}
+
+
+int16_t* bfp_complex_s16_init_from_arena(
+    bfp_complex_s16_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length)
+{
+    const bfp_arena_mark_t mark = bfp_arena_mark(arena);
+
+    int16_t* real = (int16_t*) bfp_arena_alloc(arena, length * sizeof(int16_t));
+    int16_t* imag = (int16_t*) bfp_arena_alloc(arena, length * sizeof(int16_t));
+
+    if(real == NULL || imag == NULL){
+        bfp_arena_reset(arena, mark);
+        real = imag = NULL;
+    }
+
+    bfp_complex_s16_init(a, real, imag, exp, length, 0);
+    return real;
+}
+
+
+complex_s32_t* bfp_complex_s32_init_from_arena(
+    bfp_complex_s32_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length)
+{
+    complex_s32_t* data = (complex_s32_t*) bfp_arena_alloc(arena, length * sizeof(complex_s32_t));
+    bfp_complex_s32_init(a, data, exp, length, 0);
+    return data;
+}
+
+
+ch_pair_s16_t* bfp_ch_pair_s16_init_from_arena(
+    bfp_ch_pair_s16_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length)
+{
+    ch_pair_s16_t* data = (ch_pair_s16_t*) bfp_arena_alloc(arena, length * sizeof(ch_pair_s16_t));
+    bfp_ch_pair_s16_init(a, data, exp, length, 0);
+    return data;
+}
+
+
+ch_pair_s32_t* bfp_ch_pair_s32_init_from_arena(
+    bfp_ch_pair_s32_t* a,
+    bfp_arena_t* arena,
+    const exponent_t exp,
+    const unsigned length)
+{
+    ch_pair_s32_t* data = (ch_pair_s32_t*) bfp_arena_alloc(arena, length * sizeof(ch_pair_s32_t));
+    bfp_ch_pair_s32_init(a, data, exp, length, 0);
+    return data;
+}
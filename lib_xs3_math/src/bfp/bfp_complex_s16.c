@@ -255,4 +255,5 @@ void bfp_complex_s16_to_complex_s32(
     
     a->exp = b->exp;
     a->hr = b->hr + 16;
+    a->hr_exact = 0;
 }
\ No newline at end of file
@@ -21,6 +21,17 @@ headroom_t bfp_complex_s32_headroom(
 #endif
 
     a->hr = xs3_vect_s32_headroom((int32_t*)a->data, 2 * a->length);
+    a->hr_exact = 1;
+    return a->hr;
+}
+
+
+headroom_t bfp_complex_s32_headroom_exact(
+    bfp_complex_s32_t* a)
+{
+    if(!a->hr_exact)
+        bfp_complex_s32_headroom(a);
+
     return a->hr;
 }
 
@@ -37,6 +48,7 @@ void bfp_complex_s32_shl(
 
     a->exp = b->exp;
     a->hr = xs3_vect_s32_shl((int32_t*) a->data, (int32_t*) b->data, 2*b->length, shl);
+    a->hr_exact = 1;
 }
 
 
@@ -56,6 +68,7 @@ void bfp_complex_s32_add(
     xs3_vect_add_sub_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
 
     a->hr = xs3_vect_complex_s32_add(a->data, b->data, c->data, b->length, b_shr, c_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -75,6 +88,7 @@ void bfp_complex_s32_sub(
     xs3_vect_add_sub_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
 
     a->hr = xs3_vect_complex_s32_sub(a->data, b->data, c->data, b->length, b_shr, c_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -97,6 +111,7 @@ void bfp_complex_s32_real_mul(
     a->exp = a_exp;
 
     a->hr = xs3_vect_complex_s32_real_mul(a->data, b->data, c->data, b->length, b_shr, c_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -118,6 +133,28 @@ void bfp_complex_s32_mul(
 
     a->exp = a_exp;
     a->hr = xs3_vect_complex_s32_mul(a->data, b->data, c->data, b->length, b_shr, c_shr);
+    a->hr_exact = 1;
+}
+
+
+void bfp_complex_s32_macc(
+    bfp_complex_s32_t* acc, 
+    const bfp_complex_s32_t* b, 
+    const bfp_complex_s32_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == acc->length);
+    assert(b->length == c->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t acc_shr, b_shr, c_shr;
+
+    xs3_vect_complex_s32_macc_prepare(&acc->exp, &acc_shr, &b_shr, &c_shr, 
+                                      acc->exp, b->exp, c->exp, acc->hr, b->hr, c->hr);
+
+    acc->hr = xs3_vect_complex_s32_macc(acc->data, b->data, c->data, b->length, acc_shr, b_shr, c_shr);
+    acc->hr_exact = 1;
 }
 
 
@@ -140,6 +177,7 @@ void bfp_complex_s32_conj_mul(
     a->exp = a_exp;
     a->hr = xs3_vect_complex_s32_conj_mul(a->data, b->data, c->data, 
                                                   b->length, b_shr, c_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -161,6 +199,7 @@ void bfp_complex_s32_real_scale(
     xs3_vect_s32_mul_prepare(&a->exp, &b_shr, &c_shr, b->exp, c.exp, b->hr, c_hr);
 
     a->hr = xs3_vect_complex_s32_real_scale( a->data, b->data, c.mant, b->length, b_shr, c_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -180,6 +219,7 @@ void bfp_complex_s32_scale(
     xs3_vect_complex_s32_scale_prepare(&a->exp, &b_shr, &c_shr, b->exp, c.exp, b->hr, c_hr);
     
     a->hr = xs3_vect_complex_s32_scale(a->data, b->data, c.mant.re, c.mant.im, b->length, b_shr, c_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -197,6 +237,7 @@ void bfp_complex_s32_squared_mag(
     xs3_vect_complex_s32_squared_mag_prepare(&a->exp, &b_shr, b->exp, b->hr);
 
     a->hr = xs3_vect_complex_s32_squared_mag(a->data, b->data, b->length, b_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -215,6 +256,7 @@ void bfp_complex_s32_mag(
 
     a->hr = xs3_vect_complex_s32_mag(a->data, b->data, b->length, 
                                      b_shr, (complex_s32_t*) rot_table32, rot_table32_rows);
+    a->hr_exact = 1;
 }
 
 
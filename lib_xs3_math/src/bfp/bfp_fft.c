@@ -3,6 +3,7 @@
 
 
 #include "bfp_math.h"
+#include "../vect/vpu_helper.h"
 #include "../vect/xs3_fft_lut.h"
 
 #include <assert.h>
@@ -11,7 +12,51 @@
 
 
 
-bfp_complex_s32_t* bfp_fft_forward_mono(
+void bfp_fft_plan_init(
+    bfp_fft_plan_t* plan,
+    uint16_t bitrev_buff[],
+    const unsigned length)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(length != 0);
+    assert(cls(length - 1) > cls(length)); 
+#endif
+
+    plan->length = length;
+    plan->bitrev = bitrev_buff;
+
+    if(bitrev_buff != NULL)
+        xs3_fft_bit_reversal_table(bitrev_buff, length);
+}
+
+
+
+
+
+// Scale x by 2^-shr and apply the index bit-reversal, in one pass if the plan allows it
+static void bfp_fft_bit_reversal_shr(
+    const bfp_fft_plan_t* plan,
+    bfp_complex_s32_t* x,
+    const right_shift_t shr)
+{
+    x->exp += shr;
+
+    if(plan->bitrev != NULL){
+        x->hr = xs3_fft_index_bit_reversal_shr(x->data, x->length, shr, plan->bitrev);
+        return;
+    }
+
+    if(shr)
+        x->hr = xs3_vect_s32_shl((int32_t*) x->data, (int32_t*) x->data, 2*x->length, -shr);
+    xs3_fft_index_bit_reversal(x->data, x->length);
+}
+
+
+
+
+
+bfp_complex_s32_t* bfp_fft_forward_mono_plan(
+    const bfp_fft_plan_t* plan,
     bfp_s32_t* x)
 {
 #if (XS3_BFP_DEBUG_CHECK_LENGTHS)
@@ -19,6 +64,8 @@ bfp_complex_s32_t* bfp_fft_forward_mono(
     assert(x->length != 0);
     // for a positive power of 2, subtracting 1 should increase its headroom.
     assert(cls(x->length - 1) > cls(x->length)); 
+    assert(x->length <= (1<<XS3_MATH_FFT_MAX_LOG2));
+    assert(plan->length == x->length/2);
 #endif
 
     bfp_complex_s32_t* X = (bfp_complex_s32_t*) x;
@@ -27,16 +74,20 @@ bfp_complex_s32_t* bfp_fft_forward_mono(
 
     right_shift_t x_shr = 2 - x->hr;
 
-    xs3_vect_s32_shl(x->data, x->data, x->length, -x_shr);
-
-    x->hr  = x->hr  + x_shr;
-    x->exp = x->exp + x_shr;
     x->length = FFT_N/2;
 
-    xs3_fft_index_bit_reversal(X->data, X->length);
+    bfp_fft_bit_reversal_shr(plan, X, x_shr);
     xs3_fft_dit_forward(X->data, X->length, &X->hr, &X->exp);
 
+    // The mono adjustment can use up a bit of headroom
+#if (XS3_BFP_LAZY_HEADROOM) // See xs3_math_conf.h
     xs3_fft_mono_adjust(X->data, FFT_N, 0);
+    X->hr = (X->hr == 0)? 0 : X->hr - 1;
+    X->hr_exact = 0;
+#else
+    X->hr = xs3_fft_mono_adjust(X->data, FFT_N, 0);
+    X->hr_exact = 1;
+#endif
 
     return X;
 }
@@ -45,29 +96,37 @@ bfp_complex_s32_t* bfp_fft_forward_mono(
 
 
 
-bfp_s32_t* bfp_fft_inverse_mono(
+bfp_s32_t* bfp_fft_inverse_mono_plan(
+    const bfp_fft_plan_t* plan,
     bfp_complex_s32_t* X)
 {
 #if (XS3_BFP_DEBUG_CHECK_LENGTHS)
     assert(X->length != 0);
     assert(cls(X->length - 1) > cls(X->length)); 
+    assert(X->length <= (1<<(XS3_MATH_FFT_MAX_LOG2-1)));
+    assert(plan->length == X->length);
 #endif
 
     const unsigned FFT_N = 2*X->length;
     bfp_s32_t* x = (bfp_s32_t*)X;
     
+    // The scaling can't be deferred to the bit-reversal here, as the mono adjustment comes first
     right_shift_t X_shr = 2 - X->hr;
     xs3_vect_s32_shl((int32_t*) X->data, (int32_t*) X->data, FFT_N, -X_shr);
     
     X->hr  = X->hr  + X_shr;
     X->exp = X->exp + X_shr;
-    X->length = FFT_N;
 
-    xs3_fft_mono_adjust(X->data, FFT_N, 1);
+    // The IFFT must be given the headroom left by the mono adjustment, which can be less than it was given. Even with
+    // lazy headroom this is the exact headroom, as a lower bound would cost the IFFT a bit of precision.
+    X->hr = xs3_fft_mono_adjust(X->data, FFT_N, 1);
 
-    xs3_fft_index_bit_reversal(X->data, FFT_N/2);
+    bfp_fft_bit_reversal_shr(plan, X, 0);
     xs3_fft_dit_inverse(X->data, FFT_N/2, &x->hr, &x->exp);
 
+    x->length = FFT_N;
+    x->hr_exact = 1;
+
     return x;
 }
 
@@ -75,63 +134,91 @@ bfp_s32_t* bfp_fft_inverse_mono(
 
 
 
-
-
-
-
-
-
-
-void bfp_fft_forward_complex(
+void bfp_fft_forward_complex_plan(
+    const bfp_fft_plan_t* plan,
     bfp_complex_s32_t* samples)
 {
 #if (XS3_BFP_DEBUG_CHECK_LENGTHS)
     assert(samples->length != 0);
     assert(cls(samples->length - 1) > cls(samples->length)); 
+    assert(samples->length <= (1<<XS3_MATH_FFT_MAX_LOG2));
+    assert(plan->length == samples->length);
 #endif
 
     //The FFT implementation unfortunately requires 2 bits of headroom to avoid saturation.
-    if(samples->hr < 2){
-        left_shift_t shl = samples->hr - 2;
-        samples->hr = xs3_vect_s32_shl((int32_t*) samples->data,(int32_t*)  samples->data, 2*samples->length, shl);
-        samples->exp -= shl;
-    }
+    right_shift_t shr = (samples->hr < 2)? (2 - samples->hr) : 0;
 
-    xs3_fft_index_bit_reversal(samples->data, samples->length);
+    bfp_fft_bit_reversal_shr(plan, samples, shr);
     xs3_fft_dit_forward(samples->data, samples->length, &samples->hr, &samples->exp);
+    samples->hr_exact = 1;
 }
 
 
 
 
 
-void bfp_fft_inverse_complex(
+void bfp_fft_inverse_complex_plan(
+    const bfp_fft_plan_t* plan,
     bfp_complex_s32_t* spectrum)
 {
 #if (XS3_BFP_DEBUG_CHECK_LENGTHS)
     assert(spectrum->length != 0);
     assert(cls(spectrum->length - 1) > cls(spectrum->length)); 
+    assert(spectrum->length <= (1<<XS3_MATH_FFT_MAX_LOG2));
+    assert(plan->length == spectrum->length);
 #endif
 
     //The FFT implementation unfortunately requires 2 bits of headroom to avoid saturation.
-    if(spectrum->hr < 2){
-        left_shift_t shl = spectrum->hr - 2;
-        spectrum->hr = xs3_vect_s32_shl((int32_t*) spectrum->data,(int32_t*)  spectrum->data, 2*spectrum->length, shl);
-        spectrum->exp -= shl;
-    }   
+    right_shift_t shr = (spectrum->hr < 2)? (2 - spectrum->hr) : 0;
 
-    xs3_fft_index_bit_reversal(spectrum->data, spectrum->length);
+    bfp_fft_bit_reversal_shr(plan, spectrum, shr);
     xs3_fft_dit_inverse(spectrum->data, spectrum->length, &spectrum->hr, &spectrum->exp);
+    spectrum->hr_exact = 1;
+}
+
+
+
+
+
+bfp_complex_s32_t* bfp_fft_forward_mono(
+    bfp_s32_t* x)
+{
+    const bfp_fft_plan_t plan = { x->length/2, NULL };
+    return bfp_fft_forward_mono_plan(&plan, x);
 }
 
 
 
 
 
+bfp_s32_t* bfp_fft_inverse_mono(
+    bfp_complex_s32_t* X)
+{
+    const bfp_fft_plan_t plan = { X->length, NULL };
+    return bfp_fft_inverse_mono_plan(&plan, X);
+}
+
 
 
 
 
+void bfp_fft_forward_complex(
+    bfp_complex_s32_t* samples)
+{
+    const bfp_fft_plan_t plan = { samples->length, NULL };
+    bfp_fft_forward_complex_plan(&plan, samples);
+}
+
+
+
+
+
+void bfp_fft_inverse_complex(
+    bfp_complex_s32_t* spectrum)
+{
+    const bfp_fft_plan_t plan = { spectrum->length, NULL };
+    bfp_fft_inverse_complex_plan(&plan, spectrum);
+}
 
 
 
@@ -164,6 +251,7 @@ void bfp_fft_forward_stereo(
     //a and b might actually have different headroom, but the function can only compute them together. In any case, it
     // will be the lesser of the two
     b->hr = a->hr;
+    a->hr_exact = b->hr_exact = 0;
 
     a->length = b->length = input->length / 2;
     a->exp = b->exp = input->exp;
@@ -213,8 +301,189 @@ void  bfp_fft_inverse_stereo(
     x->length = a->length;
     x->hr = MIN(a->hr + a_shr, b->hr + b_shr);
 
-    xs3_fft_spectra_merge((complex_s32_t*) x->data, FFT_N);
+    x->hr = xs3_fft_spectra_merge((complex_s32_t*) x->data, FFT_N);
     xs3_fft_index_bit_reversal((complex_s32_t*) x->data, FFT_N);
     xs3_fft_dit_inverse((complex_s32_t*) x->data, FFT_N, &x->hr, &x->exp);
     
-}
\ No newline at end of file
+}
+
+
+
+
+
+
+void bfp_fft_forward_mono_s16(
+    bfp_complex_s16_t* X,
+    bfp_s16_t* x)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(x->length != 0);
+    assert(cls(x->length - 1) > cls(x->length)); 
+    assert(x->length <= (1<<XS3_MATH_FFT_MAX_LOG2));
+#endif
+
+    const unsigned FFT_N = x->length;
+
+    // Bit-reversing the whole real sequence leaves the even samples in the first half and the odd samples in the
+    // second half, each bit-reversed as required by the DIT FFT.
+    xs3_fft_index_bit_reversal_s16(x->data, FFT_N);
+
+    X->real = &x->data[0];
+    X->imag = &x->data[FFT_N/2];
+    X->length = FFT_N/2;
+    X->exp = x->exp;
+    X->hr = x->hr;
+
+    xs3_fft_dit_forward_s16(X->real, X->imag, X->length, &X->hr, &X->exp);
+    xs3_fft_mono_adjust_s16(X->real, X->imag, FFT_N, 0, &X->hr, &X->exp);
+}
+
+
+
+
+
+void bfp_fft_inverse_mono_s16(
+    bfp_s16_t* x,
+    bfp_complex_s16_t* X)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(X->length != 0);
+    assert(cls(X->length - 1) > cls(X->length)); 
+    assert(X->length <= (1<<(XS3_MATH_FFT_MAX_LOG2-1)));
+    assert(X->imag == &X->real[X->length]);
+#endif
+
+    const unsigned FFT_N = 2*X->length;
+
+    xs3_fft_mono_adjust_s16(X->real, X->imag, FFT_N, 1, &X->hr, &X->exp);
+
+    // The DIF IFFT leaves the even and odd output samples each bit-reversed in the two halves of the buffer, which
+    // the bit-reversal of the whole buffer interleaves back into natural order.
+    xs3_fft_dif_inverse_s16(X->real, X->imag, X->length, &X->hr, &X->exp);
+
+    x->data = X->real;
+    x->length = FFT_N;
+    x->exp = X->exp;
+    x->hr = X->hr;
+
+    xs3_fft_index_bit_reversal_s16(x->data, FFT_N);
+}
+
+
+
+
+
+void bfp_fft_forward_complex_s16(
+    bfp_complex_s16_t* x)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(x->length != 0);
+    assert(cls(x->length - 1) > cls(x->length)); 
+    assert(x->length <= (1<<XS3_MATH_FFT_MAX_LOG2));
+#endif
+
+    xs3_fft_index_bit_reversal_s16(x->real, x->length);
+    xs3_fft_index_bit_reversal_s16(x->imag, x->length);
+    xs3_fft_dit_forward_s16(x->real, x->imag, x->length, &x->hr, &x->exp);
+}
+
+
+
+
+
+void bfp_fft_inverse_complex_s16(
+    bfp_complex_s16_t* x)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(x->length != 0);
+    assert(cls(x->length - 1) > cls(x->length)); 
+    assert(x->length <= (1<<XS3_MATH_FFT_MAX_LOG2));
+#endif
+
+    xs3_fft_index_bit_reversal_s16(x->real, x->length);
+    xs3_fft_index_bit_reversal_s16(x->imag, x->length);
+    xs3_fft_dit_inverse_s16(x->real, x->imag, x->length, &x->hr, &x->exp);
+}
+
+
+
+
+
+
+void bfp_fft_forward_complex_mixed(
+    bfp_complex_s32_t* x)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(xs3_fft_mixed_is_supported(x->length));
+#endif
+
+    xs3_fft_index_digit_reversal(x->data, x->length);
+    xs3_fft_mixed_forward(x->data, x->length, &x->hr, &x->exp);
+    x->hr_exact = 1;
+}
+
+
+
+
+
+void bfp_fft_inverse_complex_mixed(
+    bfp_complex_s32_t* x)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(xs3_fft_mixed_is_supported(x->length));
+#endif
+
+    xs3_fft_index_digit_reversal(x->data, x->length);
+    xs3_fft_mixed_inverse(x->data, x->length, &x->hr, &x->exp);
+    x->hr_exact = 1;
+}
+
+
+
+
+
+bfp_complex_s32_t* bfp_fft_forward_mono_mixed(
+    bfp_s32_t* x)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(!(x->length & 1));
+    assert(xs3_fft_mixed_is_supported(x->length/2));
+#endif
+
+    bfp_complex_s32_t* X = (bfp_complex_s32_t*) x;
+
+    const unsigned FFT_N = x->length;
+
+    X->length = FFT_N/2;
+
+    xs3_fft_index_digit_reversal(X->data, X->length);
+    xs3_fft_mixed_forward(X->data, X->length, &X->hr, &X->exp);
+    xs3_fft_mono_adjust_mixed(X->data, FFT_N, 0, &X->hr, &X->exp);
+    X->hr_exact = 1;
+
+    return X;
+}
+
+
+
+
+
+bfp_s32_t* bfp_fft_inverse_mono_mixed(
+    bfp_complex_s32_t* X)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(xs3_fft_mixed_is_supported(X->length));
+#endif
+
+    const unsigned FFT_N = 2*X->length;
+    bfp_s32_t* x = (bfp_s32_t*) X;
+
+    xs3_fft_mono_adjust_mixed(X->data, FFT_N, 1, &X->hr, &X->exp);
+    xs3_fft_index_digit_reversal(X->data, FFT_N/2);
+    xs3_fft_mixed_inverse(X->data, FFT_N/2, &X->hr, &X->exp);
+
+    X->length = FFT_N;
+    X->hr_exact = 1;
+
+    return x;
+}
@@ -0,0 +1,1148 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "bfp_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+#include <assert.h>
+#include <string.h>
+
+
+/*
+    Compute a[] = b[] * c[] for real spectra b[] and c[], packed as for bfp_fft_forward_mono(), with the shifts and
+    output exponent as for xs3_vect_complex_s32_mul(). Element 0 holds two unrelated real values (DC and Nyquist) which
+    must be multiplied element-wise rather than as a complex number. This can be performed in-place on b[] or c[].
+*/
+static headroom_t filter_spectrum_mul(
+    complex_s32_t a[],
+    const complex_s32_t b[],
+    const complex_s32_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    // The real products need no more headroom than the complex ones, so the same shifts can be used for both
+    headroom_t hr_dc = xs3_vect_s32_mul((int32_t*) &a[0], (int32_t*) &b[0], (int32_t*) &c[0], 2, b_shr, c_shr);
+    headroom_t hr = xs3_vect_complex_s32_mul(&a[1], &b[1], &c[1], length - 1, b_shr, c_shr);
+
+    return MIN(hr, hr_dc);
+}
+
+
+/*
+    Compute a[] += b[] * c[] for real spectra b[] and c[], packed as for bfp_fft_forward_mono(), with the shifts as for
+    filter_spectrum_mul(). The accumulator is not shifted, so the products must already be at its exponent.
+*/
+static headroom_t filter_spectrum_macc(
+    complex_s32_t a[],
+    const complex_s32_t b[],
+    const complex_s32_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    headroom_t hr_dc = xs3_vect_s32_macc((int32_t*) &a[0], (int32_t*) &b[0], (int32_t*) &c[0], 2, 0, b_shr, c_shr);
+    headroom_t hr = xs3_vect_complex_s32_macc(&a[1], &b[1], &c[1], length - 1, 0, b_shr, c_shr);
+
+    return MIN(hr, hr_dc);
+}
+
+
+/*
+    Compute a[] = b[] * conj(c[]) for real spectra b[] and c[], packed as for bfp_fft_forward_mono(), with the shifts and
+    output exponent as for xs3_vect_complex_s32_conj_mul(). As for filter_spectrum_mul(), element 0 is multiplied
+    element-wise. This can be performed in-place on b[] or c[].
+*/
+static headroom_t filter_spectrum_conj_mul(
+    complex_s32_t a[],
+    const complex_s32_t b[],
+    const complex_s32_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    headroom_t hr_dc = xs3_vect_s32_mul((int32_t*) &a[0], (int32_t*) &b[0], (int32_t*) &c[0], 2, b_shr, c_shr);
+    headroom_t hr = xs3_vect_complex_s32_conj_mul(&a[1], &b[1], &c[1], length - 1, b_shr, c_shr);
+
+    return MIN(hr, hr_dc);
+}
+
+
+/*
+    Compute a[] = b[] * c[] for a real spectrum b[], packed as for bfp_fft_forward_mono(), and real gains c[], with the
+    shifts and output exponent as for xs3_vect_complex_s32_real_mul(). c[] has length+1 elements: the gains for DC and
+    Nyquist, followed by those for the other bins in order. This can be performed in-place on b[].
+*/
+static headroom_t filter_spectrum_real_mul(
+    complex_s32_t a[],
+    const complex_s32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    headroom_t hr_dc = xs3_vect_s32_mul((int32_t*) &a[0], (int32_t*) &b[0], &c[0], 2, b_shr, c_shr);
+    headroom_t hr = xs3_vect_complex_s32_real_mul(&a[1], &b[1], &c[2], length - 1, b_shr, c_shr);
+
+    return MIN(hr, hr_dc);
+}
+
+
+/*
+    Get the smallest exponent at which both the history (with exponent history_exp and headroom history_hr) and the new
+    samples in x can be represented. An all-zero vector (headroom 31) doesn't constrain the exponent, which keeps the
+    exponent from drifting while the input is silent.
+*/
+static exponent_t filter_history_exp(
+    const exponent_t history_exp,
+    const headroom_t history_hr,
+    const bfp_s32_t* x)
+{
+    if(x->hr == 31 && history_hr == 31)
+        return x->exp;
+    else if(x->hr == 31)
+        return history_exp - history_hr;
+    else if(history_hr == 31)
+        return x->exp - x->hr;
+    else
+        return MAX(history_exp - history_hr, x->exp - x->hr);
+}
+
+
+/*
+    Fill the N-sample frame[] with the L samples of history[] followed by the N-L new samples of x, bringing both to a
+    common exponent with no headroom, and return that exponent. The frame's (exact) headroom is the lesser of the two
+    parts', which the shifts report. The last L samples of the frame then replace the history.
+*/
+static exponent_t filter_frame_load(
+    int32_t frame[],
+    headroom_t* frame_hr,
+    int32_t history[],
+    exponent_t* history_exp,
+    headroom_t* history_hr,
+    const unsigned L,
+    const bfp_s32_t* x)
+{
+    const unsigned B = x->length;
+    const unsigned N = L + B;
+
+    const exponent_t frame_exp = filter_history_exp(*history_exp, *history_hr, x);
+
+    const headroom_t old_hr = xs3_vect_s32_shl(&frame[0], history, L, *history_exp - frame_exp);
+    const headroom_t new_hr = xs3_vect_s32_shl(&frame[L], x->data, B, x->exp - frame_exp);
+
+    memcpy(history, &frame[N-L], L * sizeof(int32_t));
+    *history_exp = frame_exp;
+    *frame_hr = MIN(old_hr, new_hr);
+
+    // If the new samples make up the whole history, its headroom is theirs
+    if(B == L){
+        *history_hr = new_hr;
+    } else {
+#if (XS3_BFP_LAZY_HEADROOM) // See xs3_math_conf.h
+        // Otherwise the history is a part of the new samples, or else of the frame
+        *history_hr = (B > L)? new_hr : *frame_hr;
+#else
+        *history_hr = xs3_vect_s32_headroom(history, L);
+#endif
+    }
+
+    return frame_exp;
+}
+
+
+/*
+    Update the headroom of y, a block of samples copied out of frame. With lazy headroom the frame's headroom is used
+    as a lower bound on it, saving a pass over the block.
+*/
+static void filter_block_headroom(
+    bfp_s32_t* y,
+    const bfp_s32_t* frame)
+{
+#if (XS3_BFP_LAZY_HEADROOM) // See xs3_math_conf.h
+    y->hr = frame->hr;
+    y->hr_exact = 0;
+#else
+    bfp_s32_headroom(y);
+#endif
+}
+
+
+void bfp_filter_ols_s32_init(
+    bfp_filter_ols_s32_t* filter,
+    int32_t coef_buff[],
+    int32_t frame_buff[],
+    int32_t history_buff[],
+    const bfp_s32_t* coef,
+    const unsigned frame_length,
+    const unsigned block_length)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(frame_length != 0);
+    assert(cls(frame_length - 1) > cls(frame_length));
+    assert(block_length != 0);
+    assert(coef->length != 0);
+    assert(coef->length + block_length - 1 <= frame_length);
+#endif
+
+    const unsigned N = frame_length;
+    const unsigned B = block_length;
+
+    filter->frame_length = N;
+    filter->block_length = B;
+
+    // Zero-pad the coefficients and transform them
+    bfp_s32_t coef_frame;
+    memcpy(coef_buff, coef->data, coef->length * sizeof(int32_t));
+    memset(&coef_buff[coef->length], 0, (N - coef->length) * sizeof(int32_t));
+    bfp_s32_init(&coef_frame, coef_buff, coef->exp, N, 0);
+    coef_frame.hr = coef->hr;
+
+    filter->coef = *bfp_fft_forward_mono(&coef_frame);
+
+    bfp_s32_init(&filter->frame, frame_buff, 0, N, 0);
+
+    memset(history_buff, 0, (N - B) * sizeof(int32_t));
+    filter->history = history_buff;
+    filter->history_exp = coef->exp;
+    filter->history_hr = 31;
+}
+
+
+void bfp_filter_ols_s32(
+    bfp_filter_ols_s32_t* filter,
+    bfp_s32_t* y,
+    const bfp_s32_t* x)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(x->length == filter->block_length);
+#endif
+
+    const unsigned N = filter->frame_length;
+    const unsigned B = filter->block_length;
+    const unsigned L = N - B;
+
+    filter->frame.exp = filter_frame_load(filter->frame.data, &filter->frame.hr, filter->history, &filter->history_exp,
+                                          &filter->history_hr, L, x);
+    filter->frame.length = N;
+
+    bfp_complex_s32_t* X = bfp_fft_forward_mono(&filter->frame);
+    const bfp_complex_s32_t* H = &filter->coef;
+
+    exponent_t a_exp;
+    right_shift_t b_shr, c_shr;
+    xs3_vect_complex_s32_mul_prepare(&a_exp, &b_shr, &c_shr, X->exp, H->exp, X->hr, H->hr);
+
+    X->hr = filter_spectrum_mul(X->data, X->data, H->data, X->length, b_shr, c_shr);
+    X->exp = a_exp;
+
+    bfp_s32_t* frame_out = bfp_fft_inverse_mono(X);
+
+    // The first N-B outputs of the circular convolution are wrapped around, and the last B are the new output block
+    memcpy(y->data, &frame_out->data[L], B * sizeof(int32_t));
+    y->length = B;
+    y->exp = frame_out->exp;
+    filter_block_headroom(y, frame_out);
+}
+
+
+/*
+    Get the output exponent and shifts for the product of partition spectrum H with frame spectrum X. Returns 0 if
+    either is all zeros, in which case the product may be skipped.
+*/
+static unsigned filter_partition_prepare(
+    exponent_t* a_exp,
+    right_shift_t* b_shr,
+    right_shift_t* c_shr,
+    const bfp_complex_s32_t* X,
+    const bfp_complex_s32_t* H)
+{
+    if(X->hr == 31 || H->hr == 31)
+        return 0;
+
+    xs3_vect_complex_s32_mul_prepare(a_exp, b_shr, c_shr, X->exp, H->exp, X->hr, H->hr);
+    return 1;
+}
+
+
+/*
+    Set up the buffers of a partitioned filter with P partitions of block length B, with the FDL and input history
+    cleared to zero. The partition spectra are left to the caller.
+*/
+static void filter_partitioned_setup(
+    bfp_filter_partitioned_s32_t* filter,
+    bfp_complex_s32_t coef_parts[],
+    bfp_complex_s32_t fdl_parts[],
+    int32_t fdl_buff[],
+    int32_t acc_buff[],
+    int32_t product_buff[],
+    int32_t history_buff[],
+    const unsigned block_length,
+    const unsigned partition_count,
+    const exponent_t history_exp)
+{
+    const unsigned B = block_length;
+    const unsigned N = 2*B;
+    const unsigned P = partition_count;
+
+    filter->block_length = B;
+    filter->partition_count = P;
+    filter->coef = coef_parts;
+    filter->fdl = fdl_parts;
+    filter->fdl_head = 0;
+
+    for(unsigned p = 0; p < P; p++){
+        memset(&fdl_buff[p*N], 0, N * sizeof(int32_t));
+        bfp_complex_s32_init(&fdl_parts[p], (complex_s32_t*) &fdl_buff[p*N], 0, B, 0);
+        fdl_parts[p].hr = 31;
+    }
+
+    bfp_complex_s32_init(&filter->acc, (complex_s32_t*) acc_buff, 0, B, 0);
+    filter->product = (complex_s32_t*) product_buff;
+
+    memset(history_buff, 0, B * sizeof(int32_t));
+    filter->history = history_buff;
+    filter->history_exp = history_exp;
+    filter->history_hr = 31;
+}
+
+
+void bfp_filter_partitioned_s32_init(
+    bfp_filter_partitioned_s32_t* filter,
+    bfp_complex_s32_t coef_parts[],
+    int32_t coef_buff[],
+    bfp_complex_s32_t fdl_parts[],
+    int32_t fdl_buff[],
+    int32_t acc_buff[],
+    int32_t history_buff[],
+    const bfp_s32_t* coef,
+    const unsigned block_length)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(block_length != 0);
+    assert(cls(block_length - 1) > cls(block_length));
+    assert(coef->length != 0);
+#endif
+
+    const unsigned B = block_length;
+    const unsigned N = 2*B;
+    const unsigned P = (coef->length + B - 1) / B;
+
+    filter_partitioned_setup(filter, coef_parts, fdl_parts, fdl_buff, acc_buff, NULL, history_buff, B, P,
+                             coef->exp);
+
+    for(unsigned p = 0; p < P; p++){
+        int32_t* buff = &coef_buff[p*N];
+        const unsigned taps = MIN(B, coef->length - p*B);
+
+        // Zero-pad the partition's coefficients and transform them
+        bfp_s32_t part;
+        memcpy(buff, &coef->data[p*B], taps * sizeof(int32_t));
+        memset(&buff[taps], 0, (N - taps) * sizeof(int32_t));
+        bfp_s32_init(&part, buff, coef->exp, N, 1);
+
+        coef_parts[p] = *bfp_fft_forward_mono(&part);
+    }
+}
+
+
+/*
+    DFT a frame made up of the previous input block and the new one in x, and insert its spectrum into the filter's
+    FDL in place of the oldest one.
+*/
+static void filter_partitioned_push(
+    bfp_filter_partitioned_s32_t* filter,
+    const bfp_s32_t* x)
+{
+    const unsigned B = filter->block_length;
+    const unsigned N = 2*B;
+    const unsigned P = filter->partition_count;
+
+    // The newest frame spectrum replaces the oldest in the FDL, and is computed in-place in its buffer
+    const unsigned head = (filter->fdl_head == 0)? P-1 : filter->fdl_head - 1;
+    filter->fdl_head = head;
+
+    bfp_s32_t frame;
+    bfp_s32_init(&frame, (int32_t*) filter->fdl[head].data, 0, N, 0);
+    frame.exp = filter_frame_load(frame.data, &frame.hr, filter->history, &filter->history_exp, &filter->history_hr,
+                                  B, x);
+
+    filter->fdl[head] = *bfp_fft_forward_mono(&frame);
+}
+
+
+/*
+    Compute the B output samples y of the partitioned filter from the spectra in its FDL. If the output is silent its
+    exponent is zero_exp.
+*/
+static void filter_partitioned_apply(
+    bfp_filter_partitioned_s32_t* filter,
+    bfp_s32_t* y,
+    const exponent_t zero_exp)
+{
+    const unsigned B = filter->block_length;
+    const unsigned P = filter->partition_count;
+    const unsigned head = filter->fdl_head;
+
+    /*
+        Choose the accumulator exponent so that the sum of the products can't saturate. Each product computed with the
+        shifts from xs3_vect_complex_s32_mul_prepare() has magnitude less than 2^(31 + a_exp) for its own output
+        exponent a_exp, so the sum is bounded by the sum of those bounds. The bounds are summed (rounding up) as
+        multiples of 2^(max_exp - 24), where max_exp is the largest of the exponents. With a decaying impulse response
+        this needs fewer bits of headroom than the worst case of ceil(log2(P)).
+        Products of all-zero vectors are skipped.
+    */
+    exponent_t acc_exp = INT32_MIN;
+
+    for(unsigned p = 0; p < P; p++){
+        exponent_t a_exp;
+        right_shift_t b_shr, c_shr;
+        if(filter_partition_prepare(&a_exp, &b_shr, &c_shr, &filter->fdl[(head + p) % P], &filter->coef[p]))
+            acc_exp = MAX(acc_exp, a_exp);
+    }
+
+    bfp_complex_s32_t* acc = &filter->acc;
+    acc->length = B;
+
+    if(acc_exp == INT32_MIN){
+        // Silence in, silence out
+        memset(y->data, 0, B * sizeof(int32_t));
+        y->length = B;
+        y->exp = zero_exp;
+        y->hr = 31;
+        return;
+    }
+
+    uint64_t bound = 0;
+
+    for(unsigned p = 0; p < P; p++){
+        exponent_t a_exp;
+        right_shift_t b_shr, c_shr;
+        if(filter_partition_prepare(&a_exp, &b_shr, &c_shr, &filter->fdl[(head + p) % P], &filter->coef[p]))
+            bound += (acc_exp - a_exp >= 24)? 1 : (((uint64_t) 1) << (24 - (acc_exp - a_exp)));
+    }
+
+    unsigned bound_log2 = 24;
+    while((((uint64_t) 1) << bound_log2) < bound)
+        bound_log2++;
+
+    acc_exp += bound_log2 - 24;
+
+    unsigned first = 1;
+
+    for(unsigned p = 0; p < P; p++){
+        const bfp_complex_s32_t* X = &filter->fdl[(head + p) % P];
+        const bfp_complex_s32_t* H = &filter->coef[p];
+
+        exponent_t a_exp;
+        right_shift_t b_shr, c_shr;
+        if(!filter_partition_prepare(&a_exp, &b_shr, &c_shr, X, H))
+            continue;
+
+        // Any extra shift needed to reach the accumulator exponent is split between the operands
+        const right_shift_t extra = acc_exp - a_exp;
+        b_shr += extra - (extra >> 1);
+        c_shr += (extra >> 1);
+
+        if(first){
+            acc->hr = filter_spectrum_mul(acc->data, X->data, H->data, B, b_shr, c_shr);
+            first = 0;
+        } else {
+            acc->hr = filter_spectrum_macc(acc->data, X->data, H->data, B, b_shr, c_shr);
+        }
+    }
+
+    acc->exp = acc_exp;
+
+    bfp_s32_t* frame_out = bfp_fft_inverse_mono(acc);
+
+    // The first B outputs of the circular convolution are wrapped around, and the last B are the new output block
+    memcpy(y->data, &frame_out->data[B], B * sizeof(int32_t));
+    y->length = B;
+    y->exp = frame_out->exp;
+    filter_block_headroom(y, frame_out);
+}
+
+
+void bfp_filter_partitioned_s32(
+    bfp_filter_partitioned_s32_t* filter,
+    bfp_s32_t* y,
+    const bfp_s32_t* x)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(x->length == filter->block_length);
+#endif
+
+    filter_partitioned_push(filter, x);
+    filter_partitioned_apply(filter, y, x->exp);
+}
+
+
+/*
+    Compute b + c, or b - c if negate_c is nonzero, for floating-point scalars b and c.
+*/
+static float_s32_t filter_float_s32_add(
+    const float_s32_t b,
+    const float_s32_t c,
+    const unsigned negate_c)
+{
+    // Align both mantissas to an exponent at which neither needs more than 62 bits. A zero doesn't constrain it.
+    const exponent_t b_exp = (b.mant == 0)? c.exp : b.exp;
+    const exponent_t c_exp = (c.mant == 0)? b.exp : c.exp;
+    const exponent_t exp = MAX(MIN(b_exp, c_exp), MAX(b_exp, c_exp) - 30);
+
+    const int64_t b64 = (b_exp >= exp)? ((int64_t) b.mant) << (b_exp - exp)
+                                      : ((int64_t) b.mant) >> MIN(exp - b_exp, 63);
+    const int64_t c64 = (c_exp >= exp)? ((int64_t) c.mant) << (c_exp - exp)
+                                      : ((int64_t) c.mant) >> MIN(exp - c_exp, 63);
+
+    float_s32_t a;
+    a.mant = xs3_scalar_s64_to_s32(&a.exp, negate_c? (b64 - c64) : (b64 + c64), exp);
+    return a;
+}
+
+
+/*
+    Insert the new samples of x at the front of the NLMS filter's (newest first) history, bringing the retained samples
+    and the new ones to a common exponent with no headroom.
+*/
+static void filter_nlms_history_load(
+    bfp_filter_nlms_s32_t* filter,
+    const bfp_s32_t* x)
+{
+    const unsigned L = x->length;
+    const unsigned R = filter->tap_count - 1;
+    int32_t* history = filter->history;
+
+    // The history's headroom also covers the samples being dropped, so it's a lower bound on that of the retained ones
+    const exponent_t exp = filter_history_exp(filter->history_exp, filter->history_hr, x);
+
+    memmove(&history[L], &history[0], R * sizeof(int32_t));
+
+    // The shifts report the exact headroom of what they shift, but the headroom of retained samples which aren't
+    // shifted is only known to be at least the old history's
+    headroom_t hr = (R != 0)? filter->history_hr : 31;
+
+    if(R != 0 && exp != filter->history_exp)
+        hr = xs3_vect_s32_shl(&history[L], &history[L], R, filter->history_exp - exp);
+
+    hr = MIN(hr, xs3_vect_s32_shl(&history[0], x->data, L, x->exp - exp));
+
+    for(unsigned n = 0; n < L/2; n++){
+        const int32_t tmp = history[n];
+        history[n] = history[L-1-n];
+        history[L-1-n] = tmp;
+    }
+
+#if !(XS3_BFP_LAZY_HEADROOM) // See xs3_math_conf.h
+    if(R != 0 && exp == filter->history_exp)
+        hr = xs3_vect_s32_headroom(history, R + L);
+#endif
+
+    filter->history_exp = exp;
+    filter->history_hr = hr;
+}
+
+
+/*
+    Bring the L error samples in e->data[], each of which has its own exponent in e_exp[], to a common exponent.
+*/
+static void filter_nlms_error_pack(
+    bfp_s32_t* e,
+    const int32_t e_exp[],
+    const unsigned L,
+    const exponent_t zero_exp)
+{
+    exponent_t exp = INT32_MIN;
+
+    for(unsigned n = 0; n < L; n++)
+        if(e->data[n] != 0)
+            exp = MAX(exp, e_exp[n]);
+
+    e->length = L;
+
+    if(exp == INT32_MIN){
+        e->exp = zero_exp;
+        e->hr = 31;
+        return;
+    }
+
+    for(unsigned n = 0; n < L; n++){
+        const right_shift_t shr = exp - e_exp[n];
+        e->data[n] = (shr > 31)? 0 : (e->data[n] >> shr);
+    }
+
+    e->exp = exp;
+    e->hr = xs3_vect_s32_headroom(e->data, L);
+}
+
+
+/*
+    Get the normalized step mu / (delta + energy), or zero if the denominator is zero.
+*/
+static float_s32_t filter_nlms_step(
+    const bfp_filter_nlms_s32_t* filter,
+    const float_s64_t energy)
+{
+    float_s32_t den;
+    den.mant = xs3_scalar_s64_to_s32(&den.exp, energy.mant, energy.exp);
+    den = filter_float_s32_add(den, filter->regularization, 0);
+
+    float_s32_t step = {0, 0};
+
+    if(den.mant <= 0)
+        return step;
+
+    exponent_t inv_exp;
+    const int32_t inv = xs3_inverse_s32(&inv_exp, den.mant);
+
+    step.mant = xs3_mul_s32(&step.exp, filter->step_size.mant, inv, filter->step_size.exp, inv_exp - den.exp);
+    return step;
+}
+
+
+/*
+    Get the sum of the energies of the L windows of M history samples which end at each of the L newest samples. The
+    newest window's energy is computed with the VPU, and each older window's from that of the next newer one by adding
+    the square of the sample which enters it and subtracting that of the sample which leaves it.
+*/
+static float_s64_t filter_nlms_block_energy(
+    const bfp_filter_nlms_s32_t* filter,
+    const unsigned L)
+{
+    const unsigned M = filter->tap_count;
+    const int32_t* history = filter->history;
+
+    float_s64_t energy;
+    right_shift_t shr;
+    xs3_vect_s32_energy_prepare(&energy.exp, &shr, M + L - 1, filter->history_exp, filter->history_hr);
+
+    int64_t window = xs3_vect_s32_energy(history, M, shr);
+    energy.mant = window;
+
+    for(unsigned n = 1; n < L; n++){
+        const int64_t enter = vlashr32(history[n+M-1], shr);
+        const int64_t leave = vlashr32(history[n-1], shr);
+        window += ((enter * enter) >> 30) - ((leave * leave) >> 30);
+        energy.mant += MAX(window, 0);
+    }
+
+    return energy;
+}
+
+
+/*
+    Update the NLMS filter's weights with w[k] += g * v[k], where v[] has M elements. v[] may be the filter's scratch
+    buffer.
+*/
+static void filter_nlms_update(
+    bfp_filter_nlms_s32_t* filter,
+    const int32_t v[],
+    const exponent_t v_exp,
+    const headroom_t v_hr,
+    const float_s32_t g)
+{
+    if(g.mant == 0 || v_hr == 31)
+        return;
+
+    const unsigned M = filter->tap_count;
+    bfp_s32_t* w = &filter->weights;
+
+    bfp_s32_t V;
+    bfp_s32_init(&V, (int32_t*) v, v_exp, M, 0);
+    V.hr = v_hr;
+
+    // All-zero weights would otherwise constrain the exponent of the sum
+    if(w->hr == 31)
+        bfp_s32_scale(w, &V, g);
+    else
+        bfp_s32_add_scaled(w, w, &V, g);
+}
+
+
+/*
+    Compute e[n] = d[n] - y[n] for an output y[n] with 64-bit mantissa y and exponent y_exp, storing the mantissa of
+    e[n] in e->data[n] and its exponent in e_exp[n].
+*/
+static void filter_nlms_error(
+    bfp_s32_t* e,
+    int32_t e_exp[],
+    const unsigned n,
+    const float_s32_t d,
+    const int64_t y,
+    const exponent_t y_exp)
+{
+    float_s32_t y32;
+    y32.mant = xs3_scalar_s64_to_s32(&y32.exp, y, y_exp);
+
+    const float_s32_t err = filter_float_s32_add(d, y32, 1);
+    e->data[n] = err.mant;
+    e_exp[n] = err.exp;
+}
+
+
+void bfp_filter_nlms_s32_init(
+    bfp_filter_nlms_s32_t* filter,
+    int32_t weight_buff[],
+    int32_t history_buff[],
+    int32_t scratch_buff[],
+    const unsigned tap_count,
+    const unsigned block_length,
+    const float_s32_t step_size,
+    const float_s32_t regularization)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(tap_count != 0);
+    assert(block_length != 0);
+#endif
+
+    const unsigned M = tap_count;
+    const unsigned B = block_length;
+
+    filter->tap_count = M;
+    filter->block_length = B;
+    filter->step_size = step_size;
+    filter->regularization = regularization;
+
+    memset(weight_buff, 0, M * sizeof(int32_t));
+    bfp_s32_init(&filter->weights, weight_buff, 0, M, 0);
+    filter->weights.hr = 31;
+
+    memset(history_buff, 0, (M + B - 1) * sizeof(int32_t));
+    filter->history = history_buff;
+    filter->history_exp = 0;
+    filter->history_hr = 31;
+
+    filter->scratch = scratch_buff;
+}
+
+
+void bfp_filter_nlms_s32(
+    bfp_filter_nlms_s32_t* filter,
+    bfp_s32_t* e,
+    const bfp_s32_t* x,
+    const bfp_s32_t* d)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(x->length == d->length);
+    assert(x->length != 0);
+    assert(x->length <= filter->block_length);
+#endif
+
+    const unsigned M = filter->tap_count;
+    const unsigned L = x->length;
+    const exponent_t d_exp = d->exp;
+    const bfp_s32_t* w = &filter->weights;
+
+    // The first M words of scratch are used by the weight update
+    int32_t* e_exp = &filter->scratch[M];
+
+    filter_nlms_history_load(filter, x);
+
+    const exponent_t x_exp = filter->history_exp;
+    const headroom_t x_hr = filter->history_hr;
+
+    for(unsigned n = 0; n < L; n++){
+        const int32_t* window = &filter->history[L-1-n];
+        const float_s32_t d_n = {d->data[n], d_exp};
+
+        int64_t y = 0;
+        exponent_t y_exp = 0;
+
+        if(w->hr != 31 && x_hr != 31){
+            right_shift_t b_shr, c_shr;
+            xs3_vect_s32_dot_prepare(&y_exp, &b_shr, &c_shr, w->exp, x_exp, w->hr, x_hr, M);
+            y = xs3_vect_s32_dot(w->data, window, M, b_shr, c_shr);
+        }
+
+        filter_nlms_error(e, e_exp, n, d_n, y, y_exp);
+
+        if(e->data[n] == 0 || x_hr == 31)
+            continue;
+
+        float_s64_t energy;
+        right_shift_t x_shr;
+        xs3_vect_s32_energy_prepare(&energy.exp, &x_shr, M, x_exp, x_hr);
+        energy.mant = xs3_vect_s32_energy(window, M, x_shr);
+
+        const float_s32_t step = filter_nlms_step(filter, energy);
+
+        float_s32_t g;
+        g.mant = xs3_mul_s32(&g.exp, step.mant, e->data[n], step.exp, e_exp[n]);
+
+        filter_nlms_update(filter, window, x_exp, x_hr, g);
+    }
+
+    filter_nlms_error_pack(e, e_exp, L, d_exp);
+}
+
+
+void bfp_filter_nlms_s32_block(
+    bfp_filter_nlms_s32_t* filter,
+    bfp_s32_t* e,
+    const bfp_s32_t* x,
+    const bfp_s32_t* d)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(x->length == d->length);
+    assert(x->length != 0);
+    assert(x->length <= filter->block_length);
+#endif
+
+    const unsigned M = filter->tap_count;
+    const unsigned L = x->length;
+    const exponent_t d_exp = d->exp;
+    const bfp_s32_t* w = &filter->weights;
+
+    // The first M words of scratch hold the gradient, and the remaining L are used for the error block
+    int32_t* gradient = &filter->scratch[0];
+    int32_t* e_scratch = &filter->scratch[M];
+
+    filter_nlms_history_load(filter, x);
+
+    const int32_t* history = filter->history;
+    const exponent_t x_exp = filter->history_exp;
+    const headroom_t x_hr = filter->history_hr;
+
+    // The weights don't change within the block, so neither do the shifts
+    const unsigned silent = (w->hr == 31 || x_hr == 31);
+    exponent_t y_exp = 0;
+    right_shift_t b_shr = 0, c_shr = 0;
+
+    if(!silent)
+        xs3_vect_s32_dot_prepare(&y_exp, &b_shr, &c_shr, w->exp, x_exp, w->hr, x_hr, M);
+
+    for(unsigned n = 0; n < L; n++){
+        const float_s32_t d_n = {d->data[n], d_exp};
+        const int64_t y = silent? 0 : xs3_vect_s32_dot(w->data, &history[L-1-n], M, b_shr, c_shr);
+
+        filter_nlms_error(e, e_scratch, n, d_n, y, y_exp);
+    }
+
+    filter_nlms_error_pack(e, e_scratch, L, d_exp);
+
+    if(e->hr == 31 || x_hr == 31)
+        return;
+
+    /*
+        The gradient g[k] = sum_n e[n] * x[n-k] is the inner product of the time-reversed error block with the L
+        history samples starting at x[m-k], where m is the newest sample. The shifts from xs3_vect_s32_dot_prepare()
+        keep each result below 2^39, so another 8 bits of right-shift fit it in 32 bits.
+    */
+    for(unsigned n = 0; n < L; n++)
+        e_scratch[n] = e->data[L-1-n];
+
+    exponent_t g_exp;
+    xs3_vect_s32_dot_prepare(&g_exp, &b_shr, &c_shr, e->exp, x_exp, e->hr, x_hr, L);
+
+    for(unsigned k = 0; k < M; k++)
+        gradient[k] = (int32_t) (xs3_vect_s32_dot(e_scratch, &history[k], L, b_shr, c_shr) >> 8);
+
+    g_exp += 8;
+
+    const float_s32_t step = filter_nlms_step(filter, filter_nlms_block_energy(filter, L));
+
+    filter_nlms_update(filter, gradient, g_exp, xs3_vect_s32_headroom(gradient, M), step);
+}
+
+
+/*
+    Update the FDAF's smoothed power estimate with the squared magnitude of the newest frame spectrum X. The squared
+    magnitudes are computed into the step buffer, with DC and Nyquist (squared element-wise with the same shifts, so at
+    the same exponent) in its first two elements.
+*/
+static void filter_fdaf_power_update(
+    bfp_filter_fdaf_s32_t* fdaf,
+    const bfp_complex_s32_t* X)
+{
+    const unsigned B = fdaf->filter.block_length;
+    bfp_s32_t* S = &fdaf->power;
+    const float_s32_t beta = fdaf->smoothing;
+
+    if(X->hr == 31){
+        if(S->hr != 31)
+            bfp_s32_scale(S, S, beta);
+        return;
+    }
+
+    bfp_s32_t Q;
+    right_shift_t shr;
+    bfp_s32_init(&Q, fdaf->step, 0, B+1, 0);
+    xs3_vect_complex_s32_squared_mag_prepare(&Q.exp, &shr, X->exp, X->hr);
+
+    headroom_t hr_dc = xs3_vect_s32_mul(&Q.data[0], (int32_t*) &X->data[0], (int32_t*) &X->data[0], 2, shr, shr);
+    headroom_t hr = xs3_vect_complex_s32_squared_mag(&Q.data[2], &X->data[1], B-1, shr);
+    Q.hr = MIN(hr, hr_dc);
+
+    const float_s32_t one = {0x40000000, -30};
+    const float_s32_t alpha = filter_float_s32_add(one, beta, 1);
+
+    if(S->hr == 31 || beta.mant == 0){
+        memcpy(S->data, Q.data, (B+1) * sizeof(int32_t));
+        S->exp = Q.exp;
+        S->hr = Q.hr;
+    } else if(alpha.mant == 0){
+        return;
+    } else {
+        // The new power is added as it is scaled, so only one exponent alignment is needed
+        bfp_s32_scale(S, S, beta);
+        bfp_s32_add_scaled(S, S, &Q, alpha);
+    }
+}
+
+
+/*
+    Compute the per-bin step normalization 1 / max(S[f], floor) into the FDAF's step buffer, where the floor is the
+    larger of the regularization term and 2^-20 times the largest possible power at the headroom of S. Returns 0 if the
+    power estimate is all zeros, in which case there is nothing to adapt.
+*/
+static unsigned filter_fdaf_step(
+    bfp_filter_fdaf_s32_t* fdaf,
+    bfp_s32_t* step)
+{
+    const unsigned B = fdaf->filter.block_length;
+    const bfp_s32_t* S = &fdaf->power;
+
+    if(S->hr == 31)
+        return 0;
+
+    // Elements of S are less than 2^(31-hr), so the relative floor is 2^(11-hr) at S's exponent
+    const float_s32_t rel_floor = {0x40000000, S->exp + 11 - S->hr - 30};
+    const float_s32_t floor = (filter_float_s32_add(fdaf->regularization, rel_floor, 1).mant > 0)?
+                                  fdaf->regularization : rel_floor;
+
+    // Round the floor up (so that it's at least 1) and saturate it at S's exponent
+    const int shl = floor.exp - S->exp;
+    int32_t lower;
+    if(shl >= 0){
+        const int64_t lower64 = ((int64_t) floor.mant) << MIN(shl, 32);
+        lower = (lower64 >= INT32_MAX)? INT32_MAX : (int32_t) lower64;
+    } else {
+        const int shr = MIN(-shl, 31);
+        lower = (int32_t) ((((int64_t) floor.mant) + (((int64_t) 1) << shr) - 1) >> shr);
+    }
+
+    bfp_s32_init(step, fdaf->step, 0, B+1, 0);
+    bfp_s32_clip(step, S, lower, INT32_MAX, S->exp);
+    bfp_s32_inverse(step, step);
+
+    return 1;
+}
+
+
+void bfp_filter_fdaf_s32_init(
+    bfp_filter_fdaf_s32_t* fdaf,
+    bfp_complex_s32_t weight_parts[],
+    int32_t weight_buff[],
+    bfp_complex_s32_t fdl_parts[],
+    int32_t fdl_buff[],
+    int32_t acc_buff[],
+    int32_t product_buff[],
+    int32_t history_buff[],
+    int32_t power_buff[],
+    int32_t step_buff[],
+    const unsigned tap_count,
+    const unsigned block_length,
+    const float_s32_t step_size,
+    const float_s32_t smoothing,
+    const float_s32_t regularization,
+    const unsigned constrained)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(block_length != 0);
+    assert(cls(block_length - 1) > cls(block_length));
+    assert(tap_count != 0);
+#endif
+
+    const unsigned B = block_length;
+    const unsigned N = 2*B;
+    const unsigned P = (tap_count + B - 1) / B;
+
+    filter_partitioned_setup(&fdaf->filter, weight_parts, fdl_parts, fdl_buff, acc_buff, product_buff, history_buff,
+                             B, P, 0);
+
+    for(unsigned p = 0; p < P; p++){
+        memset(&weight_buff[p*N], 0, N * sizeof(int32_t));
+        bfp_complex_s32_init(&weight_parts[p], (complex_s32_t*) &weight_buff[p*N], 0, B, 0);
+        weight_parts[p].hr = 31;
+        weight_parts[p].hr_exact = 1;
+    }
+
+    fdaf->tap_count = tap_count;
+
+    memset(power_buff, 0, (B+1) * sizeof(int32_t));
+    bfp_s32_init(&fdaf->power, power_buff, 0, B+1, 0);
+    fdaf->power.hr = 31;
+    fdaf->power.hr_exact = 1;
+
+    fdaf->step = step_buff;
+    fdaf->step_size = step_size;
+    fdaf->smoothing = smoothing;
+    fdaf->regularization = regularization;
+    fdaf->constrained = constrained;
+}
+
+
+void bfp_filter_fdaf_s32(
+    bfp_filter_fdaf_s32_t* fdaf,
+    bfp_s32_t* e,
+    const bfp_s32_t* x,
+    const bfp_s32_t* d)
+{
+    bfp_filter_partitioned_s32_t* filter = &fdaf->filter;
+
+    const unsigned B = filter->block_length;
+    const unsigned N = 2*B;
+    const unsigned P = filter->partition_count;
+
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(x->length == B);
+    assert(d->length == B);
+#endif
+
+    filter_partitioned_push(filter, x);
+
+    // The product buffer is free once the output has been computed
+    bfp_s32_t y;
+    y.data = (int32_t*) filter->product;
+    filter_partitioned_apply(filter, &y, d->exp);
+
+    e->length = B;
+    bfp_s32_sub(e, d, &y);
+
+    filter_fdaf_power_update(fdaf, &filter->fdl[filter->fdl_head]);
+
+    bfp_s32_t step;
+    if(e->hr == 31 || fdaf->step_size.mant == 0 || !filter_fdaf_step(fdaf, &step))
+        return;
+
+    // Error spectrum, in the accumulator buffer. The step size (divided by P) is applied to the B error samples rather
+    // than to the N/2 bins of their spectrum.
+    float_s32_t mu = fdaf->step_size;
+    if(P > 1){
+        exponent_t inv_exp;
+        const int32_t inv = xs3_inverse_s32(&inv_exp, P);
+        mu.mant = xs3_mul_s32(&mu.exp, mu.mant, inv, mu.exp, inv_exp);
+    }
+
+    bfp_s32_t frame, frame_err;
+    bfp_s32_init(&frame, (int32_t*) filter->acc.data, 0, N, 0);
+    bfp_s32_init(&frame_err, &frame.data[B], 0, B, 0);
+    memset(frame.data, 0, B * sizeof(int32_t));
+    bfp_s32_scale(&frame_err, e, mu);
+
+    if(frame_err.hr == 31)
+        return;
+
+    frame.exp = frame_err.exp;
+    frame.hr = frame_err.hr;
+
+    // Normalize the error spectrum once, for all of the partitions
+    bfp_complex_s32_t* E = bfp_fft_forward_mono(&frame);
+
+    exponent_t a_exp;
+    right_shift_t b_shr, c_shr;
+    xs3_vect_complex_s32_real_mul_prepare(&a_exp, &b_shr, &c_shr, E->exp, step.exp, E->hr, step.hr);
+    E->hr = filter_spectrum_real_mul(E->data, E->data, step.data, B, b_shr, c_shr);
+    E->exp = a_exp;
+
+    if(E->hr == 31)
+        return;
+
+    const unsigned head = filter->fdl_head;
+
+    for(unsigned p = 0; p < P; p++){
+        const bfp_complex_s32_t* X = &filter->fdl[(head + p) % P];
+        bfp_complex_s32_t* W = &filter->coef[p];
+
+        if(X->hr == 31)
+            continue;
+
+        bfp_complex_s32_t G;
+        bfp_complex_s32_init(&G, filter->product, 0, B, 0);
+        xs3_vect_complex_s32_mul_prepare(&G.exp, &b_shr, &c_shr, E->exp, X->exp, E->hr, X->hr);
+        G.hr = filter_spectrum_conj_mul(G.data, E->data, X->data, B, b_shr, c_shr);
+        G.hr_exact = 1;
+
+        if(G.hr == 31)
+            continue;
+
+        if(fdaf->constrained){
+            // Keep only the first B taps of the gradient, which are the linear (not circular) correlation
+            bfp_s32_t* g = bfp_fft_inverse_mono(&G);
+            memset(&g->data[B], 0, B * sizeof(int32_t));
+            // With lazy headroom the whole frame's headroom is kept as a lower bound, which is all the FFT needs
+#if !(XS3_BFP_LAZY_HEADROOM) // See xs3_math_conf.h
+            g->hr = xs3_vect_s32_headroom(g->data, B);
+#endif
+
+            if(g->hr == 31)
+                continue;
+
+            bfp_fft_forward_mono(g);
+        }
+
+        // All-zero weights would otherwise constrain the exponent of the sum
+        if(W->hr == 31){
+            memcpy(W->data, G.data, N * sizeof(int32_t));
+            W->exp = G.exp;
+            W->hr = G.hr;
+            W->hr_exact = G.hr_exact;
+        } else {
+            bfp_complex_s32_add(W, W, &G);
+        }
+    }
+}
+
+
+void bfp_filter_cic_s32_pdm(
+    xs3_filter_cic_s32_t* cic,
+    bfp_s32_t* y,
+    const uint32_t bits[],
+    const unsigned length)
+{
+    y->length = length;
+    y->exp = cic->shift;
+    y->hr = xs3_filter_cic_s32_pdm(cic, y->data, bits, length);
+}
+
+
+void bfp_filter_cic_s32(
+    xs3_filter_cic_s32_t* cic,
+    bfp_s32_t* y,
+    const bfp_s32_t* x)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert((x->length % cic->ratio) == 0);
+#endif
+
+    const unsigned length = x->length / cic->ratio;
+
+    y->length = length;
+    y->exp = x->exp + cic->shift;
+    y->hr = xs3_filter_cic_s32(cic, y->data, x->data, length);
+}
+
+
+void bfp_filter_decimator_s32(
+    xs3_filter_decimator_s32_t* decimator,
+    bfp_s32_t* y,
+    const bfp_s32_t* x,
+    const exponent_t coef_exp)
+{
+    const unsigned R = decimator->factor;
+
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert((x->length % R) == 0);
+#endif
+
+    const unsigned length = x->length / R;
+
+    for(unsigned n = 0; n < length; n++)
+        y->data[n] = xs3_filter_decimator_s32(decimator, &x->data[n*R]);
+
+    y->length = length;
+    y->exp = x->exp + coef_exp + 30 + decimator->filter.shift;
+    y->hr = xs3_vect_s32_headroom(y->data, length);
+}
@@ -10,6 +10,26 @@
 #include "vect/xs3_vect_s16.h"
 
 
+void bfp_s8_init(
+    bfp_s8_t* a, 
+    int8_t* data, 
+    const exponent_t exp, 
+    const unsigned length,
+    const unsigned calc_hr)
+{
+    a->data = data;
+    a->length = length;
+    a->exp = exp;
+
+    if(calc_hr){
+        bfp_s8_headroom(a);
+    } else {
+        a->hr = 0;
+    }
+}
+
+
+
 void bfp_s16_init(
     bfp_s16_t* a, 
     int16_t* data, 
@@ -44,7 +64,9 @@ void bfp_s32_init(
     if(calc_hr){
         bfp_s32_headroom(a);
     } else {
+        // Zero is a lower bound on any vector's headroom
         a->hr = 0;
+        a->hr_exact = 0;
     }
 }
 
@@ -85,6 +107,7 @@ void bfp_complex_s32_init(
         bfp_complex_s32_headroom(a);
     } else {
         a->hr = 0;
+        a->hr_exact = 0;
     }
 }
 
@@ -150,6 +173,7 @@ void bfp_s32_set(
 {
     a->exp = exp;
     a->hr = HR_S32(value);
+    a->hr_exact = 1;
 
     xs3_vect_s32_set(a->data, value, a->length);
 }
@@ -177,6 +201,7 @@ void bfp_complex_s32_set(
 {
     a->exp = exp;
     a->hr = HR_C32(value);
+    a->hr_exact = 1;
 
     xs3_vect_complex_s32_set( a->data, value.re, value.im, a->length);
 }
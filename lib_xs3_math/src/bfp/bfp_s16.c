@@ -118,6 +118,26 @@ void bfp_s16_scale(
 }
 
 
+void bfp_s16_macc(
+    bfp_s16_t* acc, 
+    const bfp_s16_t* b, 
+    const bfp_s16_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length == acc->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t acc_shr, bc_sat;
+
+    xs3_vect_s16_macc_prepare(&acc->exp, &acc_shr, &bc_sat, 
+                              acc->exp, b->exp, c->exp, acc->hr, b->hr, c->hr);
+
+    acc->hr = xs3_vect_s16_macc(acc->data, b->data, c->data, b->length, acc_shr, bc_sat);
+}
+
+
 void bfp_s16_abs(
     bfp_s16_t* a,
     const bfp_s16_t* b)
@@ -423,5 +443,6 @@ void bfp_s16_to_s32(
 
     a->exp = a_exp - 8;
     a->hr = b->hr + 8;
+    a->hr_exact = 0;
     xs3_vect_s16_to_s32(a->data, b->data, b->length);
 }
@@ -20,11 +20,22 @@ headroom_t bfp_s32_headroom(
 #endif
 
      a->hr = xs3_vect_s32_headroom(a->data, a->length);
+     a->hr_exact = 1;
 
      return a->hr;
 }
 
 
+headroom_t bfp_s32_headroom_exact(
+    bfp_s32_t* a)
+{
+    if(!a->hr_exact)
+        bfp_s32_headroom(a);
+
+    return a->hr;
+}
+
+
 void bfp_s32_shl(
     bfp_s32_t* a,
     const bfp_s32_t* b,
@@ -37,6 +48,7 @@ void bfp_s32_shl(
     a->length = b->length;
     a->exp = b->exp;
     a->hr = xs3_vect_s32_shl(a->data, b->data, b->length, shl);
+    a->hr_exact = 1;
 }
 
 
@@ -56,6 +68,7 @@ void bfp_s32_add(
     xs3_vect_add_sub_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
 
     a->hr = xs3_vect_s32_add(a->data, b->data, c->data, b->length, b_shr, c_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -75,6 +88,7 @@ void bfp_s32_sub(
     xs3_vect_add_sub_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
 
     a->hr = xs3_vect_s32_sub(a->data, b->data, c->data, b->length, b_shr, c_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -93,6 +107,7 @@ void bfp_s32_mul(
     xs3_vect_s32_mul_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr); 
 
     a->hr = xs3_vect_s32_mul(a->data, b->data, c->data, b->length, b_shr, c_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -113,6 +128,74 @@ void bfp_s32_scale(
     xs3_vect_s32_mul_prepare(&a->exp, &b_shr, &c_shr, b->exp, c.exp, b->hr, c_hr);
 
     a->hr = xs3_vect_s32_scale(a->data, b->data, b->length, c.mant, b_shr, c_shr);
+    a->hr_exact = 1;
+}
+
+
+void bfp_s32_macc(
+    bfp_s32_t* acc, 
+    const bfp_s32_t* b, 
+    const bfp_s32_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length == acc->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t acc_shr, b_shr, c_shr;
+
+    xs3_vect_s32_macc_prepare(&acc->exp, &acc_shr, &b_shr, &c_shr, 
+                              acc->exp, b->exp, c->exp, acc->hr, b->hr, c->hr);
+
+    acc->hr = xs3_vect_s32_macc(acc->data, b->data, c->data, b->length, acc_shr, b_shr, c_shr);
+    acc->hr_exact = 1;
+}
+
+
+void bfp_s32_nmacc(
+    bfp_s32_t* acc, 
+    const bfp_s32_t* b, 
+    const bfp_s32_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length == acc->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t acc_shr, b_shr, c_shr;
+
+    xs3_vect_s32_macc_prepare(&acc->exp, &acc_shr, &b_shr, &c_shr, 
+                              acc->exp, b->exp, c->exp, acc->hr, b->hr, c->hr);
+
+    acc->hr = xs3_vect_s32_nmacc(acc->data, b->data, c->data, b->length, acc_shr, b_shr, c_shr);
+    acc->hr_exact = 1;
+}
+
+
+void bfp_s32_add_scaled(
+    bfp_s32_t* a, 
+    const bfp_s32_t* b,
+    const bfp_s32_t* c,
+    const float_s32_t alpha)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr, c_shr, alpha_shr;
+
+    headroom_t alpha_hr = HR_S32(alpha.mant);
+
+    // b takes the role of the accumulator
+    xs3_vect_s32_macc_prepare(&a->exp, &b_shr, &c_shr, &alpha_shr, 
+                              b->exp, c->exp, alpha.exp, b->hr, c->hr, alpha_hr);
+
+    a->hr = xs3_vect_s32_add_scaled(a->data, b->data, c->data, b->length, alpha.mant, b_shr, c_shr, alpha_shr);
+    a->hr_exact = 1;
 }
 
 
@@ -127,6 +210,7 @@ void bfp_s32_abs(
 
     a->exp = b->exp;
     a->hr = xs3_vect_s32_abs(a->data, b->data, b->length);
+    a->hr_exact = 1;
 }
 
 
@@ -216,22 +300,26 @@ void bfp_s32_clip(
         /* upper bound must be smaller than any element of b, so set everything to that */
         a->exp = bound_exp;
         a->hr = HR_S32(upper_bound);
+        a->hr_exact = 1;
         xs3_vect_s32_set(a->data, upper_bound, b->length);
     } else if(lb == VPU_INT32_MAX){
         /* lower bound must be larger than any element of b, so set everything to that */
         a->exp = bound_exp;
         a->hr = HR_S32(lower_bound);
+        a->hr_exact = 1;
         xs3_vect_s32_set(a->data, lower_bound, b->length);
     } else if(ub == lb){
         /* upper and lower bounds are indistinguishable */
         a->exp = a_exp;
         a->hr = HR_S32(ub);
+        a->hr_exact = 1;
         xs3_vect_s32_set(a->data, ub, b->length);
 
     } else {
         /* some elements may be between bounds */
         a->exp = a_exp;
         a->hr = xs3_vect_s32_clip(a->data, b->data, b->length, lb, ub, b_shr);
+        a->hr_exact = 1;
     }
 }
 
@@ -247,6 +335,7 @@ void bfp_s32_rect(
 
     a->exp = b->exp;
     a->hr = xs3_vect_s32_rect(a->data, b->data, b->length);
+    a->hr_exact = 1;
 }
 
 
@@ -264,6 +353,7 @@ void bfp_s32_sqrt(
     xs3_vect_s32_sqrt_prepare(&a->exp, &b_shr, b->exp, b->hr);
 
     a->hr = xs3_vect_s32_sqrt(a->data, b->data, b->length, b_shr, XS3_BFP_SQRT_DEPTH_S32);
+    a->hr_exact = 1;
 }
 
 
@@ -281,6 +371,7 @@ void bfp_s32_inverse(
     xs3_vect_s32_inverse_prepare(&a->exp, &scale, b->data, b->exp, b->length);
 
     a->hr = xs3_vect_s32_inverse(a->data, b->data, b->length, scale);
+    a->hr_exact = 1;
 }
 
 
@@ -0,0 +1,203 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "bfp_math.h"
+
+#include "vect/xs3_vect_s32.h"
+#include "vect/xs3_vect_s16.h"
+#include "vect/xs3_vect_s8.h"
+
+#include <assert.h>
+
+
+
+headroom_t bfp_s8_headroom(
+    bfp_s8_t* a)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(a->length != 0);
+#endif
+
+     a->hr = xs3_vect_s8_headroom(a->data, a->length);
+
+     return a->hr;
+}
+
+
+void bfp_s8_shl(
+    bfp_s8_t* a,
+    const bfp_s8_t* b,
+    const left_shift_t shl)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(a->length == b->length);
+    assert(b->length != 0);
+#endif
+
+    a->exp = b->exp;
+    a->hr = xs3_vect_s8_shl(a->data, b->data, b->length, shl);
+}
+
+
+void bfp_s8_add(
+    bfp_s8_t* a,
+    const bfp_s8_t* b,
+    const bfp_s8_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr, c_shr;
+
+    xs3_vect_add_sub_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
+
+    a->hr = xs3_vect_s8_add(a->data, b->data, c->data, b->length, b_shr, c_shr);
+}
+
+
+void bfp_s8_sub(
+    bfp_s8_t* a,
+    const bfp_s8_t* b,
+    const bfp_s8_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr, c_shr;
+
+    xs3_vect_add_sub_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
+
+    a->hr = xs3_vect_s8_sub(a->data, b->data, c->data, b->length, b_shr, c_shr);
+}
+
+
+void bfp_s8_mul(
+    bfp_s8_t* a,
+    const bfp_s8_t* b,
+    const bfp_s8_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr, c_shr;
+
+    xs3_vect_s8_mul_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
+
+    a->hr = xs3_vect_s8_mul(a->data, b->data, c->data, b->length, b_shr, c_shr);
+}
+
+
+void bfp_s8_scale(
+    bfp_s8_t* a,
+    const bfp_s8_t* b,
+    const float_s16_t alpha)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    // Keep only the 8 most significant bits of alpha's mantissa
+    const right_shift_t alpha_shr = MAX(0, 8 - HR_S16(alpha.mant));
+    const int8_t c = alpha.mant >> alpha_shr;
+    const exponent_t c_exp = alpha.exp + alpha_shr;
+
+    right_shift_t b_shr, c_shr;
+
+    xs3_vect_s8_mul_prepare(&a->exp, &b_shr, &c_shr, b->exp, c_exp, b->hr, HR_S8(c));
+
+    a->hr = xs3_vect_s8_scale(a->data, b->data, b->length, c, b_shr, c_shr);
+}
+
+
+float_s64_t bfp_s8_dot(
+    const bfp_s8_t* b,
+    const bfp_s8_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length != 0);
+#endif
+
+    float_s64_t a;
+    a.mant = xs3_vect_s8_dot(b->data, c->data, b->length);
+    a.exp = b->exp + c->exp;
+    return a;
+}
+
+
+void bfp_s16_to_s8(
+    bfp_s8_t* a,
+    const bfp_s16_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr = 8 - b->hr;
+
+    a->exp = b->exp + b_shr;
+    a->hr = 0;
+
+    xs3_vect_s16_to_s8(a->data, b->data, b->length, b_shr);
+}
+
+
+void bfp_s32_to_s8(
+    bfp_s8_t* a,
+    const bfp_s32_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr = 24 - b->hr;
+
+    a->exp = b->exp + b_shr;
+    a->hr = 0;
+
+    xs3_vect_s32_to_s8(a->data, b->data, b->length, b_shr);
+}
+
+
+void bfp_s8_to_s16(
+    bfp_s16_t* a,
+    const bfp_s8_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    a->exp = b->exp - 8;
+    a->hr = b->hr;
+    xs3_vect_s8_to_s16(a->data, b->data, b->length);
+}
+
+
+void bfp_s8_to_s32(
+    bfp_s32_t* a,
+    const bfp_s8_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    a->exp = b->exp - 24;
+    a->hr = b->hr;
+    a->hr_exact = 0;
+    xs3_vect_s8_to_s32(a->data, b->data, b->length);
+}
@@ -0,0 +1,221 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "bfp_math.h"
+
+#include <assert.h>
+#include <string.h>
+
+
+/*
+    The input history and the overlap-add tail are both ring buffers of N-H elements. Any run of elements in a ring
+    buffer occupies at most two contiguous segments, and the helpers below apply the vector operations segment by
+    segment.
+*/
+
+// Copy `len` elements out of ring buffer `ring` (of `size` elements), starting at index `start`.
+static void stft_ring_read(
+    int32_t dst[],
+    const int32_t ring[],
+    const unsigned size,
+    const unsigned start,
+    const unsigned len)
+{
+    const unsigned first = MIN(len, size - start);
+    memcpy(&dst[0], &ring[start], first * sizeof(int32_t));
+    memcpy(&dst[first], &ring[0], (len - first) * sizeof(int32_t));
+}
+
+
+// Copy `len` elements into ring buffer `ring` (of `size` elements), starting at index `start`.
+static void stft_ring_write(
+    int32_t ring[],
+    const unsigned size,
+    const unsigned start,
+    const int32_t src[],
+    const unsigned len)
+{
+    const unsigned first = MIN(len, size - start);
+    memcpy(&ring[start], &src[0], first * sizeof(int32_t));
+    memcpy(&ring[0], &src[first], (len - first) * sizeof(int32_t));
+}
+
+
+// Compute a[] = (ring[] >> ring_shr) + (b[] >> b_shr) over `len` elements of ring buffer `ring`, starting at index
+// `start`. If `a` is NULL the result is written back into the ring buffer.
+static headroom_t stft_ring_add(
+    int32_t a[],
+    int32_t ring[],
+    const unsigned size,
+    unsigned start,
+    const int32_t b[],
+    const unsigned len,
+    const right_shift_t ring_shr,
+    const right_shift_t b_shr)
+{
+    headroom_t hr = 31;
+
+    for(unsigned done = 0; done < len; ){
+        const unsigned seg = MIN(len - done, size - start);
+        int32_t* dst = (a != NULL)? &a[done] : &ring[start];
+
+        headroom_t seg_hr = xs3_vect_s32_add(dst, &ring[start], &b[done], seg, ring_shr, b_shr);
+        hr = MIN(hr, seg_hr);
+
+        done += seg;
+        start = (start + seg) % size;
+    }
+
+    return hr;
+}
+
+
+// Compute ring[] = b[] >> b_shr over `len` elements of ring buffer `ring`, starting at index `start`.
+static headroom_t stft_ring_write_shr(
+    int32_t ring[],
+    const unsigned size,
+    unsigned start,
+    const int32_t b[],
+    const unsigned len,
+    const right_shift_t b_shr)
+{
+    headroom_t hr = 31;
+
+    for(unsigned done = 0; done < len; ){
+        const unsigned seg = MIN(len - done, size - start);
+
+        headroom_t seg_hr = xs3_vect_s32_shl(&ring[start], &b[done], seg, -b_shr);
+        hr = MIN(hr, seg_hr);
+
+        done += seg;
+        start = (start + seg) % size;
+    }
+
+    return hr;
+}
+
+
+
+
+
+void bfp_stft_init(
+    bfp_stft_t* stft,
+    int32_t frame_buff[],
+    int32_t history_buff[],
+    int32_t overlap_buff[],
+    const int32_t analysis_window[],
+    const int32_t synthesis_window[],
+    const unsigned frame_length,
+    const unsigned hop,
+    const exponent_t sample_exp)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(frame_length != 0);
+    assert(cls(frame_length - 1) > cls(frame_length));
+    assert(hop != 0);
+    assert(hop <= frame_length/2);
+#endif
+
+    const unsigned L = frame_length - hop;
+
+    stft->frame_length = frame_length;
+    stft->hop = hop;
+    stft->sample_exp = sample_exp;
+    stft->analysis_window = analysis_window;
+    stft->synthesis_window = synthesis_window;
+
+    bfp_s32_init(&stft->frame, frame_buff, sample_exp, frame_length, 0);
+
+    memset(history_buff, 0, L * sizeof(int32_t));
+    stft->history = history_buff;
+    stft->history_head = 0;
+
+    memset(overlap_buff, 0, L * sizeof(int32_t));
+    stft->overlap = overlap_buff;
+    stft->overlap_head = 0;
+    stft->overlap_exp = sample_exp;
+    stft->overlap_hr = 31;
+}
+
+
+
+
+
+bfp_complex_s32_t* bfp_stft_forward(
+    bfp_stft_t* stft,
+    const int32_t samples[])
+{
+    const unsigned N = stft->frame_length;
+    const unsigned H = stft->hop;
+    const unsigned L = N - H;
+
+    int32_t* frame = stft->frame.data;
+
+    // The frame is the input history (oldest first) followed by the new samples
+    stft_ring_read(&frame[0], stft->history, L, stft->history_head, L);
+    memcpy(&frame[L], samples, H * sizeof(int32_t));
+
+    // The new samples replace the oldest H samples of history
+    stft_ring_write(stft->history, L, stft->history_head, samples, H);
+    stft->history_head = (stft->history_head + H) % L;
+
+    stft->frame.length = N;
+    stft->frame.exp = stft->sample_exp;
+
+    // Multiplying by a Q2.30 window leaves the exponent unchanged
+    // The FFT shifts the frame to exactly the headroom it requires, so any headroom under-reported here would be lost
+    if(stft->analysis_window != NULL){
+        stft->frame.hr = xs3_vect_s32_mul(frame, frame, stft->analysis_window, N, 0, 0);
+        stft->frame.hr_exact = 1;
+    } else {
+        bfp_s32_headroom(&stft->frame);
+    }
+
+    return bfp_fft_forward_mono(&stft->frame);
+}
+
+
+
+
+
+void bfp_stft_inverse(
+    bfp_stft_t* stft,
+    int32_t samples_out[],
+    bfp_complex_s32_t* X)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(2*X->length == stft->frame_length);
+#endif
+
+    const unsigned N = stft->frame_length;
+    const unsigned H = stft->hop;
+    const unsigned L = N - H;
+    const unsigned head = stft->overlap_head;
+
+    bfp_s32_t* x = bfp_fft_inverse_mono(X);
+
+    if(stft->synthesis_window != NULL){
+        x->hr = xs3_vect_s32_mul(x->data, x->data, stft->synthesis_window, N, 0, 0);
+        x->hr_exact = 1;
+    }
+
+    // The oldest H samples of the tail are completed by the first H samples of the frame, and are output directly at
+    // the sample exponent
+    stft_ring_add(samples_out, stft->overlap, L, head, &x->data[0], H,
+                  stft->sample_exp - stft->overlap_exp, stft->sample_exp - x->exp);
+
+    // The rest of the tail is accumulated with the frame, and the last H samples of the frame take the place of the
+    // samples just output
+    exponent_t tail_exp;
+    right_shift_t tail_shr, frame_shr;
+
+    xs3_vect_add_sub_prepare(&tail_exp, &tail_shr, &frame_shr, stft->overlap_exp, x->exp, stft->overlap_hr, x->hr);
+
+    headroom_t hr = stft_ring_add(NULL, stft->overlap, L, (head + H) % L, &x->data[H], L - H, tail_shr, frame_shr);
+    headroom_t new_hr = stft_ring_write_shr(stft->overlap, L, head, &x->data[L], H, frame_shr);
+
+    stft->overlap_head = (head + H) % L;
+    stft->overlap_exp = tail_exp;
+    stft->overlap_hr = MIN(hr, new_hr);
+}
@@ -41,22 +41,30 @@
  * 
  * SHR may be negative or non-negative. If negative, VAL is cast to larger bit depth, 
  * left shift is applied, and saturation logic is applied. If non-negative, rounding
- * right shfit is applied.
+ * right shfit is applied. As on the VPU, a 32-bit right-shift of more than 31 bits is treated as a shift of 31 bits.
  */
 #define ASHR8(VAL, SHR_BITS)    ( SAT8(((SHR_BITS) >= 0)? SHR((VAL),(SHR_BITS)) : (SAT8(  ((int32_t)(VAL))<<(-(SHR_BITS)) ) )))
 #define ASHR16(VAL, SHR_BITS)   (SAT16(((SHR_BITS) >= 0)? SHR((VAL),(SHR_BITS)) : (SAT16( ((int32_t)(VAL))<<(-(SHR_BITS)) ) )))
-#define ASHR32(VAL, SHR_BITS)   (SAT32(((SHR_BITS) >= 0)? SHR((VAL),(SHR_BITS)) : (SAT32( ((int64_t)(VAL))<<(-(SHR_BITS)) ) )))
+#define ASHR32(VAL, SHR_BITS)   (SAT32(((SHR_BITS) >= 0)? SHR((VAL),MIN((SHR_BITS),31)) : (SAT32( ((int64_t)(VAL))<<(-(SHR_BITS)) ) )))
 #define ASHR(BITS)  ASHR##BITS
 
 /**
  * Accumulate a value into a headroom mask.
+ * 
+ * Negative values are accumulated as their one's complement, which has the same number of leading sign bits, so the
+ * headroom derived from the mask is exact (and `INT32_MIN` is handled correctly).
  */
-#define HRMASK_ADD(MASK, V)      (MASK|(((V) >= 0)? (V) : (-V)))
-
+#define HRMASK_ADD(MASK, V)      ((MASK)|(((V) >= 0)? (V) : ~(V)))
 
 
+/**
+ * Get the headroom of a set of 32-bit values from a headroom mask into which all of them were accumulated with
+ * HRMASK_ADD().
+ * 
+ * An empty mask (or one accumulated only from zeros) has a headroom of 31, consistent with xs3_vect_s32_headroom().
+ */
 static inline headroom_t hr_from_mask(unsigned hr_mask){
-    return 0;
+    return HR_S32((int32_t) hr_mask);
 }
 
 #endif //VPU_HELPER_H_
\ No newline at end of file
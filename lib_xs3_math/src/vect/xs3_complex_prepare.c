@@ -264,6 +264,39 @@ void xs3_vect_complex_s32_mul_prepare(
 }
 
 
+void xs3_vect_complex_s32_macc_prepare(
+    exponent_t* new_acc_exp,
+    right_shift_t* acc_shr,
+    right_shift_t* b_shr,
+    right_shift_t* c_shr,
+    const exponent_t acc_exp,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t acc_hr,
+    const headroom_t b_hr,
+    const headroom_t c_hr)
+{
+    /*
+        With the shifts from xs3_vect_complex_s32_mul_prepare() the parts of the product are at most 2^31 at p_exp, 
+        and the parts of the accumulator are at most 2^(31-acc_hr) at acc_exp. Their sum can't saturate if each is at
+        most 2^30 at the new exponent.
+    */
+    exponent_t p_exp;
+    xs3_vect_complex_s32_mul_prepare(&p_exp, b_shr, c_shr, b_exp, c_exp, b_hr, c_hr);
+
+    const exponent_t acc_min_exp = acc_exp - acc_hr;
+
+    *new_acc_exp = MAX(acc_min_exp, p_exp) + 1;
+
+    // Split any extra shift of the product between its two inputs
+    const right_shift_t extra = *new_acc_exp - p_exp;
+    *b_shr += (extra >> 1);
+    *c_shr += extra - (extra >> 1);
+
+    *acc_shr = *new_acc_exp - acc_exp;
+}
+
+
 void xs3_vect_complex_s32_scale_prepare(
     exponent_t* a_exp,
     right_shift_t* b_shr,
@@ -0,0 +1,67 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+
+
+void xs3_fft_bit_reversal_table(
+    uint16_t bitrev[],
+    const unsigned length)
+{
+    const unsigned logn = ceil_log2(length);
+
+    for(unsigned k = 0; k < length; k++){
+        unsigned rev = 0;
+        unsigned index = k;
+        for(unsigned i = 0; i < logn; i++, index >>= 1)
+            rev = (rev << 1) | (index & 0x1);
+        bitrev[k] = (uint16_t) rev;
+    }
+}
+
+
+static inline complex_s32_t fft_shr_complex(
+    const complex_s32_t x,
+    const right_shift_t shr)
+{
+    complex_s32_t res;
+    res.re = (int32_t) ASHR(32)((int64_t) x.re, shr);
+    res.im = (int32_t) ASHR(32)((int64_t) x.im, shr);
+    return res;
+}
+
+
+headroom_t xs3_fft_index_bit_reversal_shr(
+    complex_s32_t x[],
+    const unsigned length,
+    const right_shift_t shr,
+    const uint16_t bitrev[])
+{
+    unsigned hr_mask = 0;
+
+    for(unsigned k = 0; k < length; k++){
+
+        const unsigned rev = bitrev[k];
+
+        // Each swapped pair is handled when visiting its lower index
+        if(rev < k) continue;
+
+        const complex_s32_t a = fft_shr_complex(x[k], shr);
+
+        if(rev != k){
+            const complex_s32_t b = fft_shr_complex(x[rev], shr);
+            x[k] = b;
+            hr_mask = HRMASK_ADD(hr_mask, b.re);
+            hr_mask = HRMASK_ADD(hr_mask, b.im);
+        }
+
+        x[rev] = a;
+        hr_mask = HRMASK_ADD(hr_mask, a.re);
+        hr_mask = HRMASK_ADD(hr_mask, a.im);
+    }
+
+    return hr_from_mask(hr_mask);
+}
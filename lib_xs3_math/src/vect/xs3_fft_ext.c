@@ -0,0 +1,575 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <assert.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "vpu_const_vects.h"
+#include "xs3_fft_ext.h"
+
+/*
+    FFTs of up to FFT_LUT_N points are computed entirely by the (architecture-specific) FFT kernels, which read their
+    twiddle factors from the look-up tables.
+
+    For larger FFTs, the stages which operate within contiguous blocks of (at most) FFT_LUT_N elements are still
+    computed by the kernels (for the DIT FFT these are the first stages, for the DIF FFT the last), after which the
+    blocks are brought to a common exponent. The remaining stages are computed here, using twiddle factors generated
+    from the look-up table for the largest FFT it covers and the principal roots of unity in xs3_fft_twiddle_seed[] or,
+    if XS3_MATH_FFT_COMPACT_TWIDDLES is enabled, from the quarter-wave sine table xs3_fft_sine_lut[].
+
+    The extension functions xs3_fft_dit_ext() and xs3_fft_dif_ext() are compiled in every configuration so that the
+    FFT benchmarks can compare the twiddle factor layouts within a single build.
+*/
+
+#define FFT_LUT_N           (1<<MAX_DIT_FFT_LUT_LOG2)
+#define MIN_FFT_BLOCK_LOG2  (4)
+#define MAX_FFT_BLOCKS      (1<<(MAX_DIT_FFT_LOG2 - MIN_FFT_BLOCK_LOG2))
+
+// Number of twiddle factors generated at a time
+#define TWIDDLE_CHUNK       (16)
+
+// Non-zero iff xs3_fft_twiddle_seed[] is available
+#define FFT_TWIDDLE_SEEDS   ((XS3_FFT_TWIDDLE_GEN) && !(XS3_MATH_FFT_COMPACT_TWIDDLES))
+
+
+
+// Get sin(2*pi*i / 2^P), for 0 <= i <= 2^(P-2)
+static int32_t fft_sine(
+    const int32_t sine_lut[],
+    unsigned i,
+    unsigned P)
+{
+    return sine_lut[xs3_fft_sine_lut_index(i, P)];
+}
+
+
+/*
+    Get W_{2^P}^k = exp(-j*2*pi*k / 2^P), for 0 <= k < 2^(P-1), using quarter-wave symmetry.
+*/
+static complex_s32_t fft_twiddle_sine(
+    const int32_t sine_lut[],
+    const unsigned k,
+    const unsigned P)
+{
+    const unsigned Q = 1 << (P-2);
+
+    complex_s32_t W;
+
+    if(k <= Q){
+        W.re =  fft_sine(sine_lut, Q - k, P);
+        W.im = -fft_sine(sine_lut, k, P);
+    } else {
+        W.re = -fft_sine(sine_lut, k - Q, P);
+        W.im = -fft_sine(sine_lut, 2*Q - k, P);
+    }
+
+    return W;
+}
+
+
+#if (FFT_TWIDDLE_SEEDS)
+
+// Q30 complex multiplication
+static complex_s32_t twiddle_mul(
+    const complex_s32_t a,
+    const complex_s32_t b)
+{
+    const int64_t re = ((int64_t)a.re) * b.re - ((int64_t)a.im) * b.im;
+    const int64_t im = ((int64_t)a.re) * b.im + ((int64_t)a.im) * b.re;
+
+    complex_s32_t res = {
+        (int32_t) ROUND_SHR(re, 30),
+        (int32_t) ROUND_SHR(im, 30),
+    };
+
+    return res;
+}
+
+
+/*
+    Get W_{2^P}^k = exp(-j*2*pi*k / 2^P), for 0 <= k < 2^(P-1).
+
+    The look-up table holds W_{2^L}^q for 0 <= q < 2^(L-1), where L = MAX_DIT_FFT_LUT_LOG2. The stage with butterfly
+    span b begins at index (b-4) of xs3_dit_fft_lut[], with its twiddle factors in groups of 4, in reverse order.
+
+    Each of the low (P-L) bits of k that is set contributes a factor of W_{2^P}^{2^i} = xs3_fft_twiddle_seed[P-i].
+*/
+static complex_s32_t fft_twiddle_seed(
+    const unsigned k,
+    const unsigned P)
+{
+    const unsigned shr = (P > MAX_DIT_FFT_LUT_LOG2)? (P - MAX_DIT_FFT_LUT_LOG2) : 0;
+    const unsigned q = k >> shr;
+    const unsigned b = 1 << (P - shr - 1);
+
+    complex_s32_t W = xs3_dit_fft_lut[(b-4) + (b-4-(q & ~0x3)) + (q & 0x3)];
+
+    for(int i = 0; i < shr; i++){
+        if((k >> i) & 1)
+            W = twiddle_mul(W, xs3_fft_twiddle_seed[P-i]);
+    }
+
+    return W;
+}
+
+#endif // FFT_TWIDDLE_SEEDS
+
+
+/*
+    Get W_{2^P}^k, either from the quarter-wave sine table sine_lut[] or, if sine_lut is NULL, from the look-up table
+    and seed table.
+*/
+static complex_s32_t fft_twiddle(
+    const int32_t sine_lut[],
+    const unsigned k,
+    const unsigned P)
+{
+#if (FFT_TWIDDLE_SEEDS)
+    if(sine_lut == NULL)
+        return fft_twiddle_seed(k, P);
+#endif
+
+    assert(sine_lut != NULL);
+    return fft_twiddle_sine(sine_lut, k, P);
+}
+
+
+/*
+    W_fine[] <-- W_{2^P}^k  for 0 <= k < TWIDDLE_CHUNK
+*/
+static void fft_twiddle_chunk_init(
+    complex_s32_t W_fine[],
+    const int32_t sine_lut[],
+    const unsigned P)
+{
+    for(int k = 0; k < TWIDDLE_CHUNK; k++)
+        W_fine[k] = fft_twiddle(sine_lut, k, P);
+}
+
+
+/*
+    W[] <-- W_{2^P}^(k0+k)  for 0 <= k < length
+*/
+static void fft_twiddle_chunk(
+    complex_s32_t W[],
+    const complex_s32_t W_fine[],
+    const int32_t sine_lut[],
+    const unsigned k0,
+    const unsigned P,
+    const unsigned length)
+{
+    if(sine_lut != NULL){
+        // Reading each twiddle factor from the sine table avoids the rounding error of the multiplication
+        for(int k = 0; k < length; k++)
+            W[k] = fft_twiddle_sine(sine_lut, k0 + k, P);
+    } else {
+        const complex_s32_t W0 = fft_twiddle(sine_lut, k0, P);
+        xs3_vect_complex_s32_scale(W, W_fine, W0.re, W0.im, length, 0, 0);
+    }
+}
+
+
+/*
+    sum[] <-- (b[] + c[]) >> shr
+    diff[] <-- (b[] - c[]) >> shr
+
+    The shift is applied after the (64-bit) addition, as in the FFT kernels, rather than to each operand. Outputs may
+    alias the inputs. The outputs are accumulated into the headroom masks sum_mask and diff_mask (see HRMASK_ADD()), so
+    the stage's headroom is known without another pass over the vector.
+*/
+static void fft_sum_diff(
+    complex_s32_t sum[],
+    complex_s32_t diff[],
+    const complex_s32_t b[],
+    const complex_s32_t c[],
+    const right_shift_t shr,
+    unsigned* sum_mask,
+    unsigned* diff_mask)
+{
+    unsigned s_mask = *sum_mask;
+    unsigned d_mask = *diff_mask;
+
+    for(int i = 0; i < TWIDDLE_CHUNK; i++){
+        const complex_s32_t B = b[i];
+        const complex_s32_t C = c[i];
+        sum[i].re  = ASHR(32)(((int64_t)B.re) + C.re, shr);
+        sum[i].im  = ASHR(32)(((int64_t)B.im) + C.im, shr);
+        diff[i].re = ASHR(32)(((int64_t)B.re) - C.re, shr);
+        diff[i].im = ASHR(32)(((int64_t)B.im) - C.im, shr);
+
+        s_mask = HRMASK_ADD(HRMASK_ADD(s_mask, sum[i].re), sum[i].im);
+        d_mask = HRMASK_ADD(HRMASK_ADD(d_mask, diff[i].re), diff[i].im);
+    }
+
+    *sum_mask = s_mask;
+    *diff_mask = d_mask;
+}
+
+
+/*
+    One radix-2 DIT stage of an N-point FFT, with butterfly span 2^(P-1).
+*/
+static headroom_t fft_dit_stage(
+    complex_s32_t x[],
+    const unsigned N,
+    const unsigned P,
+    const int32_t sine_lut[],
+    const right_shift_t shift_mode,
+    const unsigned inverse)
+{
+    const unsigned b = 1 << (P-1);
+
+    complex_s32_t W_fine[TWIDDLE_CHUNK], W[TWIDDLE_CHUNK], tmp[TWIDDLE_CHUNK];
+
+    unsigned lo_mask = 0;
+    unsigned hi_mask = 0;
+
+    fft_twiddle_chunk_init(W_fine, sine_lut, P);
+
+    for(int k = 0; k < b; k += TWIDDLE_CHUNK){
+
+        fft_twiddle_chunk(W, W_fine, sine_lut, k, P, TWIDDLE_CHUNK);
+
+        for(int s = k; s < N; s += 2*b){
+            complex_s32_t* x_lo = &x[s];
+            complex_s32_t* x_hi = &x[s+b];
+
+            if(inverse)
+                xs3_vect_complex_s32_conj_mul(tmp, x_hi, W, TWIDDLE_CHUNK, 0, 0);
+            else
+                xs3_vect_complex_s32_mul(tmp, x_hi, W, TWIDDLE_CHUNK, 0, 0);
+
+            fft_sum_diff(x_lo, x_hi, x_lo, tmp, shift_mode, &lo_mask, &hi_mask);
+        }
+    }
+
+    return hr_from_mask(lo_mask | hi_mask);
+}
+
+
+/*
+    One radix-2 DIF stage of an N-point FFT, with butterfly span 2^(P-1).
+*/
+static headroom_t fft_dif_stage(
+    complex_s32_t x[],
+    const unsigned N,
+    const unsigned P,
+    const int32_t sine_lut[],
+    const right_shift_t shift_mode,
+    const unsigned inverse)
+{
+    const unsigned b = 1 << (P-1);
+
+    complex_s32_t W_fine[TWIDDLE_CHUNK], W[TWIDDLE_CHUNK], tmp[TWIDDLE_CHUNK];
+
+    unsigned lo_mask = 0;
+    unsigned tmp_mask = 0;
+    headroom_t hi_hr = 31;
+
+    fft_twiddle_chunk_init(W_fine, sine_lut, P);
+
+    for(int k = 0; k < b; k += TWIDDLE_CHUNK){
+
+        fft_twiddle_chunk(W, W_fine, sine_lut, k, P, TWIDDLE_CHUNK);
+
+        for(int s = k; s < N; s += 2*b){
+            complex_s32_t* x_lo = &x[s];
+            complex_s32_t* x_hi = &x[s+b];
+
+            fft_sum_diff(x_lo, tmp, x_lo, x_hi, shift_mode, &lo_mask, &tmp_mask);
+
+            const headroom_t hr = (inverse)?
+                xs3_vect_complex_s32_conj_mul(x_hi, tmp, W, TWIDDLE_CHUNK, 0, 0)
+              : xs3_vect_complex_s32_mul(x_hi, tmp, W, TWIDDLE_CHUNK, 0, 0);
+
+            hi_hr = MIN(hi_hr, hr);
+        }
+    }
+
+    return MIN(hr_from_mask(lo_mask), hi_hr);
+}
+
+
+/*
+    Bring each block_n-element block of x[] to the largest of the block exponents. Returns the headroom of x[].
+*/
+static headroom_t fft_blocks_align(
+    complex_s32_t x[],
+    const unsigned N,
+    const unsigned block_n,
+    const exponent_t block_exp[],
+    exponent_t* exp)
+{
+    const unsigned blocks = N / block_n;
+
+    exponent_t max_exp = block_exp[0];
+
+    for(int c = 1; c < blocks; c++)
+        max_exp = MAX(max_exp, block_exp[c]);
+
+    headroom_t hr = 31;
+
+    for(int c = 0; c < blocks; c++){
+        complex_s32_t* block = &x[c*block_n];
+        const headroom_t block_hr = xs3_vect_complex_s32_shr(block, block, block_n, max_exp - block_exp[c]);
+        hr = MIN(hr, block_hr);
+    }
+
+    *exp = max_exp;
+    return hr;
+}
+
+
+
+void xs3_fft_dit_ext(
+    complex_s32_t x[],
+    const unsigned N,
+    const unsigned block_log2,
+    const int32_t sine_lut[],
+    const unsigned inverse,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    assert(block_log2 >= MIN_FFT_BLOCK_LOG2 && block_log2 <= MAX_DIT_FFT_LUT_LOG2);
+
+    const unsigned block_n = 1 << block_log2;
+
+    if(N <= block_n){
+        if(inverse)
+            XS3_FFT_LUT_KERNEL(xs3_fft_dit_inverse)(x, N, hr, exp);
+        else
+            XS3_FFT_LUT_KERNEL(xs3_fft_dit_forward)(x, N, hr, exp);
+        return;
+    }
+
+    const unsigned FFT_N_LOG2 = 31 - CLS_S32(N);
+
+    exponent_t block_exp[MAX_FFT_BLOCKS] = { 0 };
+
+    for(int c = 0; c < N / block_n; c++){
+        headroom_t block_hr = *hr;
+
+        if(inverse)
+            XS3_FFT_LUT_KERNEL(xs3_fft_dit_inverse)(&x[c*block_n], block_n, &block_hr, &block_exp[c]);
+        else
+            XS3_FFT_LUT_KERNEL(xs3_fft_dit_forward)(&x[c*block_n], block_n, &block_hr, &block_exp[c]);
+    }
+
+    exponent_t exp_modifier;
+    headroom_t cur_hr = fft_blocks_align(x, N, block_n, block_exp, &exp_modifier);
+
+    for(int P = block_log2 + 1; P <= FFT_N_LOG2; P++){
+        const right_shift_t shift_mode = (cur_hr == 3)? 0 : (cur_hr < 3)? 1 : -1;
+        exp_modifier += shift_mode - (inverse? 1 : 0);
+
+        cur_hr = fft_dit_stage(x, N, P, sine_lut, shift_mode, inverse);
+    }
+
+    *hr = cur_hr;
+    *exp = *exp + exp_modifier;
+}
+
+
+
+void xs3_fft_dif_ext(
+    complex_s32_t x[],
+    const unsigned N,
+    const unsigned block_log2,
+    const int32_t sine_lut[],
+    const unsigned inverse,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    assert(block_log2 >= MIN_FFT_BLOCK_LOG2 && block_log2 <= MAX_DIF_FFT_LUT_LOG2);
+
+    const unsigned block_n = 1 << block_log2;
+
+    if(N <= block_n){
+        if(inverse)
+            XS3_FFT_LUT_KERNEL(xs3_fft_dif_inverse)(x, N, hr, exp);
+        else
+            XS3_FFT_LUT_KERNEL(xs3_fft_dif_forward)(x, N, hr, exp);
+        return;
+    }
+
+    const unsigned FFT_N_LOG2 = 31 - CLS_S32(N);
+
+    exponent_t exp_modifier = 0;
+    headroom_t cur_hr = *hr;
+
+    for(int P = FFT_N_LOG2; P > block_log2; P--){
+        const right_shift_t shift_mode = (cur_hr == 3)? 0 : (cur_hr < 3)? 1 : -1;
+        exp_modifier += shift_mode - (inverse? 1 : 0);
+
+        cur_hr = fft_dif_stage(x, N, P, sine_lut, shift_mode, inverse);
+    }
+
+    exponent_t block_exp[MAX_FFT_BLOCKS] = { 0 };
+
+    for(int c = 0; c < N / block_n; c++){
+        headroom_t block_hr = cur_hr;
+
+        if(inverse)
+            XS3_FFT_LUT_KERNEL(xs3_fft_dif_inverse)(&x[c*block_n], block_n, &block_hr, &block_exp[c]);
+        else
+            XS3_FFT_LUT_KERNEL(xs3_fft_dif_forward)(&x[c*block_n], block_n, &block_hr, &block_exp[c]);
+    }
+
+    exponent_t blocks_exp;
+    *hr = fft_blocks_align(x, N, block_n, block_exp, &blocks_exp);
+    *exp = *exp + exp_modifier + blocks_exp;
+}
+
+
+
+#if (XS3_FFT_TWIDDLE_GEN)
+
+#if (XS3_MATH_FFT_COMPACT_TWIDDLES)
+# define FFT_SINE_LUT   (xs3_fft_sine_lut)
+#else
+# define FFT_SINE_LUT   (NULL)
+#endif
+
+
+void xs3_fft_dit_forward (
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    xs3_fft_dit_ext(x, N, MAX_DIT_FFT_LUT_LOG2, FFT_SINE_LUT, 0, hr, exp);
+}
+
+
+
+void xs3_fft_dit_inverse (
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    xs3_fft_dit_ext(x, N, MAX_DIT_FFT_LUT_LOG2, FFT_SINE_LUT, 1, hr, exp);
+}
+
+
+
+void xs3_fft_dif_forward (
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    xs3_fft_dif_ext(x, N, MAX_DIF_FFT_LUT_LOG2, FFT_SINE_LUT, 0, hr, exp);
+}
+
+
+
+void xs3_fft_dif_inverse (
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    xs3_fft_dif_ext(x, N, MAX_DIF_FFT_LUT_LOG2, FFT_SINE_LUT, 1, hr, exp);
+}
+
+
+
+headroom_t xs3_fft_mono_adjust(
+    complex_s32_t x[],
+    const unsigned FFT_N,
+    const unsigned inverse)
+{
+    if(FFT_N <= FFT_LUT_N)
+        return xs3_fft_mono_adjust_lut(x, FFT_N, inverse);
+
+    const int VEC_ELMS = 4; //complex elements per vector
+    const unsigned FFT_N_LOG2 = 31 - CLS_S32(FFT_N);
+
+    complex_s32_t W_fine[TWIDDLE_CHUNK], W[TWIDDLE_CHUNK];
+
+    fft_twiddle_chunk_init(W_fine, FFT_SINE_LUT, FFT_N_LOG2);
+
+    // REMEMBER: The length of x[] is only FFT_N/2!
+    complex_s32_t X0 = x[0];
+    complex_s32_t XQ = x[FFT_N/4];
+
+    xs3_vect_complex_s32_tail_reverse(&x[FFT_N/4], FFT_N/4);
+
+    complex_s32_t* p_X_lo = &x[0];
+    complex_s32_t* p_X_hi = &x[FFT_N/4];
+
+    if(inverse){
+        complex_s32_t* tmp = p_X_hi;
+        p_X_hi = p_X_lo;
+        p_X_lo = tmp;
+    }
+
+    // The first vector of each half holds the DC and Nyquist elements, which are fixed after the loop, so the
+    // headroom of the others is measured after the loop instead
+    headroom_t hr = 31;
+
+    for(int k = 0; k < (FFT_N/4); k+=VEC_ELMS){
+
+        complex_s32_t X_lo[VEC_ELMS], X_hi[VEC_ELMS], tmp[VEC_ELMS], A[VEC_ELMS], B[VEC_ELMS];
+
+        if((k % TWIDDLE_CHUNK) == 0)
+            fft_twiddle_chunk(W, W_fine, FFT_SINE_LUT, k, FFT_N_LOG2, MIN(TWIDDLE_CHUNK, (FFT_N/4) - k));
+
+        for(int i = 0; i < VEC_ELMS; i++){
+            X_lo[i] = p_X_lo[i];
+            X_hi[i] = p_X_hi[i];
+        }
+
+        // tmp = j*W
+        xs3_vect_complex_s32_mul(tmp, &W[k % TWIDDLE_CHUNK], vpu_vec_complex_pos_j, VEC_ELMS, 0, 0);
+
+        // A = 0.5*(1 - j*W)
+        // B = 0.5*(1 + j*W)
+        xs3_vect_complex_s32_sub(A, vpu_vec_complex_ones, tmp, VEC_ELMS, 1, 1);
+        xs3_vect_complex_s32_add(B, vpu_vec_complex_ones, tmp, VEC_ELMS, 1, 1);
+
+        // new_X_lo = A*X_lo + B*conjugate(X_hi)
+        xs3_vect_complex_s32_mul(p_X_lo, A, X_lo, VEC_ELMS, 0, 0);
+        xs3_vect_complex_s32_conj_mul(tmp, B, X_hi, VEC_ELMS, 0, 0);
+        const headroom_t lo_hr = xs3_vect_complex_s32_add(p_X_lo, p_X_lo, tmp, VEC_ELMS, 0, 0);
+
+        // new_X_hi = conjugate(A)*X_hi + conjugate(B)*conjugate(X_lo)
+        xs3_vect_complex_s32_conj_mul(p_X_hi, X_hi, A, VEC_ELMS, 0, 0);
+        xs3_vect_s32_mul((int32_t*)B,(int32_t*)B,(int32_t*)vpu_vec_complex_conj_op, 2*VEC_ELMS, 0, 0);
+        xs3_vect_complex_s32_conj_mul(tmp, B, X_lo, VEC_ELMS, 0, 0);
+        const headroom_t hi_hr = xs3_vect_complex_s32_add(p_X_hi, p_X_hi, tmp, VEC_ELMS, 0, 0);
+
+        if(k != 0)
+            hr = MIN(hr, MIN(lo_hr, hi_hr));
+
+        p_X_lo = &p_X_lo[VEC_ELMS];
+        p_X_hi = &p_X_hi[VEC_ELMS];
+    }
+
+    if(inverse){
+        X0.re = ASHR(32)(X0.re, 1);
+        X0.im = ASHR(32)(X0.im, 1);
+    }
+
+    //Fix DC and Nyquist
+    x[0].re = X0.re + X0.im;
+    x[0].im = X0.re - X0.im;
+    x[FFT_N/4].re =  XQ.re;
+    x[FFT_N/4].im = -XQ.im;
+
+    for(int i = 0; i < VEC_ELMS; i++){
+        hr = MIN(hr, HR_S32(x[i].re));
+        hr = MIN(hr, HR_S32(x[i].im));
+        hr = MIN(hr, HR_S32(x[FFT_N/4 + i].re));
+        hr = MIN(hr, HR_S32(x[FFT_N/4 + i].im));
+    }
+
+    xs3_vect_complex_s32_tail_reverse(&x[FFT_N/4], FFT_N/4);
+
+    return hr;
+}
+
+#endif // XS3_FFT_TWIDDLE_GEN
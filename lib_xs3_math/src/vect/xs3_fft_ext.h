@@ -0,0 +1,99 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#pragma once
+
+#include "xs3_math.h"
+#include "xs3_fft_lut.h"
+
+
+/** @brief Non-zero iff FFTs larger than the look-up tables use twiddle factors generated on the fly.
+
+    @see XS3_MATH_FFT_LUT_MAX_LOG2
+*/
+#define XS3_FFT_TWIDDLE_GEN     (MAX_DIT_FFT_LUT_LOG2 < MAX_DIT_FFT_LOG2)
+
+
+#if (XS3_FFT_TWIDDLE_GEN)
+
+/** @brief Name of an FFT kernel which relies only on the FFT look-up tables.
+
+    When twiddle factor generation is enabled, the architecture-specific FFT kernels are compiled with a `_lut`
+    suffix. The public functions (see xs3_fft_ext.c) call the kernels directly for FFTs covered by the look-up tables,
+    and compute any additional stages of larger FFTs themselves.
+*/
+#define XS3_FFT_LUT_KERNEL(NAME)    NAME ## _lut
+
+void xs3_fft_dit_forward_lut(
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp);
+
+void xs3_fft_dit_inverse_lut(
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp);
+
+void xs3_fft_dif_forward_lut(
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp);
+
+void xs3_fft_dif_inverse_lut(
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp);
+
+headroom_t xs3_fft_mono_adjust_lut(
+    complex_s32_t x[],
+    const unsigned length,
+    const unsigned inverse);
+
+#else
+
+#define XS3_FFT_LUT_KERNEL(NAME)    NAME
+
+#endif
+
+
+
+/** @brief Compute an N-point DIT FFT (or IFFT) from @math{2^{block\_log2}}-point FFTs.
+
+    The FFT kernels compute the first `block_log2` stages on each contiguous block of @math{2^{block\_log2}} elements,
+    and the remaining radix-2 stages are computed in xs3_fft_ext.c with twiddle factors read from the quarter-wave sine
+    table `sine_lut[]` (laid out as `xs3_fft_sine_lut[]`, and covering at least `N`-point FFTs). If `sine_lut` is
+    `NULL` the twiddle factors are instead generated from the look-up table and `xs3_fft_twiddle_seed[]`, which is only
+    available when `XS3_MATH_FFT_LUT_MAX_LOG2 < XS3_MATH_FFT_MAX_LOG2` without compact twiddles.
+
+    `block_log2` must be between `4` and `MAX_DIT_FFT_LUT_LOG2`. The arguments and results are otherwise as for
+    xs3_fft_dit_forward() and xs3_fft_dit_inverse().
+
+    This is how FFTs larger than the look-up tables are computed, and it is also used by the FFT benchmarks to compare
+    the twiddle factor layouts.
+*/
+void xs3_fft_dit_ext(
+    complex_s32_t x[],
+    const unsigned N,
+    const unsigned block_log2,
+    const int32_t sine_lut[],
+    const unsigned inverse,
+    headroom_t* hr,
+    exponent_t* exp);
+
+/** @brief Compute an N-point DIF FFT (or IFFT) from @math{2^{block\_log2}}-point FFTs.
+
+    As xs3_fft_dit_ext(), except the generated stages are computed first, and the FFT kernels compute the last
+    `block_log2` stages.
+*/
+void xs3_fft_dif_ext(
+    complex_s32_t x[],
+    const unsigned N,
+    const unsigned block_log2,
+    const int32_t sine_lut[],
+    const unsigned inverse,
+    headroom_t* hr,
+    exponent_t* exp);
@@ -2,15 +2,20 @@
 // This Software is subject to the terms of the XMOS Public Licence: Version 1.
 #include "xs3_fft_lut.h"
 
-const complex_s32_t xs3_dit_fft_lut[1020] = 
+const complex_s32_t xs3_dit_fft_lut[(1<<MAX_DIT_FFT_LUT_LOG2)-4] = 
 	{
 	{ 1073741824,           0}, {  759250125,  -759250125}, {          0, -1073741824}, { -759250125,  -759250125}, 
+#if (MAX_DIT_FFT_LUT_LOG2 >= 4)
 	{          0, -1073741824}, { -410903207,  -992008094}, { -759250125,  -759250125}, { -992008094,  -410903207}, 
 	{ 1073741824,           0}, {  992008094,  -410903207}, {  759250125,  -759250125}, {  410903207,  -992008094}, 
+#endif
+#if (MAX_DIT_FFT_LUT_LOG2 >= 5)
 	{ -759250125,  -759250125}, { -892783698,  -596538995}, { -992008094,  -410903207}, {-1053110176,  -209476638}, 
 	{          0, -1073741824}, { -209476638, -1053110176}, { -410903207,  -992008094}, { -596538995,  -892783698}, 
 	{  759250125,  -759250125}, {  596538995,  -892783698}, {  410903207,  -992008094}, {  209476638, -1053110176}, 
 	{ 1073741824,           0}, { 1053110176,  -209476638}, {  992008094,  -410903207}, {  892783698,  -596538995}, 
+#endif
+#if (MAX_DIT_FFT_LUT_LOG2 >= 6)
 	{ -992008094,  -410903207}, {-1027506862,  -311690799}, {-1053110176,  -209476638}, {-1068571464,  -105245103}, 
 	{ -759250125,  -759250125}, { -830013654,  -681174602}, { -892783698,  -596538995}, { -946955747,  -506158392}, 
 	{ -410903207,  -992008094}, { -506158392,  -946955747}, { -596538995,  -892783698}, { -681174602,  -830013654}, 
@@ -19,6 +24,8 @@ const complex_s32_t xs3_dit_fft_lut[1020] =
 	{  759250125,  -759250125}, {  681174602,  -830013654}, {  596538995,  -892783698}, {  506158392,  -946955747}, 
 	{  992008094,  -410903207}, {  946955747,  -506158392}, {  892783698,  -596538995}, {  830013654,  -681174602}, 
 	{ 1073741824,           0}, { 1068571464,  -105245103}, { 1053110176,  -209476638}, { 1027506862,  -311690799}, 
+#endif
+#if (MAX_DIT_FFT_LUT_LOG2 >= 7)
 	{-1053110176,  -209476638}, {-1062120190,  -157550647}, {-1068571464,  -105245103}, {-1072448455,   -52686014}, 
 	{ -992008094,  -410903207}, {-1010975242,  -361732726}, {-1027506862,  -311690799}, {-1041563127,  -260897982}, 
 	{ -892783698,  -596538995}, { -920979082,  -552013618}, { -946955747,  -506158392}, { -970651112,  -459083786}, 
@@ -35,6 +42,8 @@ const complex_s32_t xs3_dit_fft_lut[1020] =
 	{  992008094,  -410903207}, {  970651112,  -459083786}, {  946955747,  -506158392}, {  920979082,  -552013618}, 
 	{ 1053110176,  -209476638}, { 1041563127,  -260897982}, { 1027506862,  -311690799}, { 1010975242,  -361732726}, 
 	{ 1073741824,           0}, { 1072448455,   -52686014}, { 1068571464,  -105245103}, { 1062120190,  -157550647}, 
+#endif
+#if (MAX_DIT_FFT_LUT_LOG2 >= 8)
 	{-1068571464,  -105245103}, {-1070832474,   -78989349}, {-1072448455,   -52686014}, {-1073418433,   -26350943}, 
 	{-1053110176,  -209476638}, {-1057933813,  -183568930}, {-1062120190,  -157550647}, {-1065666786,  -131437462}, 
 	{-1027506862,  -311690799}, {-1034846671,  -286380643}, {-1041563127,  -260897982}, {-1047652185,  -235258165}, 
@@ -67,6 +76,8 @@ const complex_s32_t xs3_dit_fft_lut[1020] =
 	{ 1053110176,  -209476638}, { 1047652185,  -235258165}, { 1041563127,  -260897982}, { 1034846671,  -286380643}, 
 	{ 1068571464,  -105245103}, { 1065666786,  -131437462}, { 1062120190,  -157550647}, { 1057933813,  -183568930}, 
 	{ 1073741824,           0}, { 1073418433,   -26350943}, { 1072448455,   -52686014}, { 1070832474,   -78989349}, 
+#endif
+#if (MAX_DIT_FFT_LUT_LOG2 >= 9)
 	{-1072448455,   -52686014}, {-1073014240,   -39521455}, {-1073418433,   -26350943}, {-1073660973,   -13176464}, 
 	{-1068571464,  -105245103}, {-1069782521,   -92124163}, {-1070832474,   -78989349}, {-1071721163,   -65842639}, 
 	{-1062120190,  -157550647}, {-1063973603,  -144504935}, {-1065666786,  -131437462}, {-1067199483,  -118350194}, 
@@ -131,6 +142,8 @@ const complex_s32_t xs3_dit_fft_lut[1020] =
 	{ 1068571464,  -105245103}, { 1067199483,  -118350194}, { 1065666786,  -131437462}, { 1063973603,  -144504935}, 
 	{ 1072448455,   -52686014}, { 1071721163,   -65842639}, { 1070832474,   -78989349}, { 1069782521,   -92124163}, 
 	{ 1073741824,           0}, { 1073660973,   -13176464}, { 1073418433,   -26350943}, { 1073014240,   -39521455}, 
+#endif
+#if (MAX_DIT_FFT_LUT_LOG2 >= 10)
 	{-1073418433,   -26350943}, {-1073559913,   -19764076}, {-1073660973,   -13176464}, {-1073721611,    -6588356}, 
 	{-1072448455,   -52686014}, {-1072751542,   -46104602}, {-1073014240,   -39521455}, {-1073236540,   -32936819}, 
 	{-1070832474,   -78989349}, {-1071296985,   -72417357}, {-1071721163,   -65842639}, {-1072104991,   -59265442}, 
@@ -259,13 +272,7710 @@ const complex_s32_t xs3_dit_fft_lut[1020] =
 	{ 1072448455,   -52686014}, { 1072104991,   -59265442}, { 1071721163,   -65842639}, { 1071296985,   -72417357}, 
 	{ 1073418433,   -26350943}, { 1073236540,   -32936819}, { 1073014240,   -39521455}, { 1072751542,   -46104602}, 
 	{ 1073741824,           0}, { 1073721611,    -6588356}, { 1073660973,   -13176464}, { 1073559913,   -19764076}, 
+#endif
+#if (MAX_DIT_FFT_LUT_LOG2 >= 11)
+	{-1073660973,   -13176464}, {-1073696345,    -9882456}, {-1073721611,    -6588356}, {-1073736771,    -3294193}, 
+	{-1073418433,   -26350943}, {-1073494225,   -23057618}, {-1073559913,   -19764076}, {-1073615496,   -16470347}, 
+	{-1073014240,   -39521455}, {-1073130440,   -36229307}, {-1073236540,   -32936819}, {-1073332538,   -29644021}, 
+	{-1072448455,   -52686014}, {-1072605046,   -49395541}, {-1072751542,   -46104602}, {-1072887940,   -42813230}, 
+	{-1071721163,   -65842639}, {-1071918122,   -62554335}, {-1072104991,   -59265442}, {-1072281769,   -55975992}, 
+	{-1070832474,   -78989349}, {-1071069770,   -75703709}, {-1071296985,   -72417357}, {-1071514117,   -69130324}, 
+	{-1069782521,   -92124163}, {-1070060120,   -88841683}, {-1070327646,   -85558366}, {-1070585099,   -82274245}, 
+	{-1068571464,  -105245103}, {-1068889322,  -101966277}, {-1069197120,   -98686491}, {-1069494854,   -95405776}, 
+	{-1067199483,  -118350194}, {-1067557554,  -115075515}, {-1067905576,  -111799753}, {-1068243547,  -108522939}, 
+	{-1065666786,  -131437462}, {-1066065015,  -128167423}, {-1066453210,  -124896179}, {-1066831367,  -121623759}, 
+	{-1063973603,  -144504935}, {-1064411931,  -141240030}, {-1064840240,  -137973796}, {-1065258526,  -134706263}, 
+	{-1062120190,  -157550647}, {-1062598550,  -154291367}, {-1063066909,  -151030634}, {-1063525261,  -147768480}, 
+	{-1060106826,  -170572633}, {-1060625146,  -167319468}, {-1061133483,  -164064728}, {-1061631833,  -160808445}, 
+	{-1057933813,  -183568930}, {-1058492016,  -180322371}, {-1059040255,  -177074115}, {-1059578527,  -173824192}, 
+	{-1055601479,  -196537583}, {-1056199480,  -193298119}, {-1056787540,  -190056834}, {-1057365653,  -186813762}, 
+	{-1053110176,  -209476638}, {-1053747885,  -206244756}, {-1054375676,  -203010932}, {-1054993543,  -199775198}, 
+	{-1050460278,  -222384147}, {-1051137599,  -219160334}, {-1051805027,  -215934457}, {-1052462555,  -212706549}, 
+	{-1047652185,  -235258165}, {-1048369016,  -232042906}, {-1049075980,  -228825464}, {-1049773069,  -225605867}, 
+	{-1044686319,  -248096755}, {-1045442553,  -244890535}, {-1046188946,  -241682010}, {-1046925492,  -238471210}, 
+	{-1041563127,  -260897982}, {-1042358649,  -257701283}, {-1043144360,  -254502159}, {-1043920252,  -251300640}, 
+	{-1038283080,  -273659918}, {-1039117770,  -270473223}, {-1039942680,  -267283981}, {-1040757802,  -264092224}, 
+	{-1034846671,  -286380643}, {-1035720404,  -283204430}, {-1036584389,  -280025552}, {-1037438617,  -276844038}, 
+	{-1031254418,  -299058239}, {-1032167062,  -295892988}, {-1033069992,  -292724951}, {-1033963197,  -289554160}, 
+	{-1027506862,  -311690799}, {-1028458280,  -308536985}, {-1029400018,  -305380268}, {-1030332067,  -302220676}, 
+	{-1023604567,  -324276419}, {-1024594615,  -321134518}, {-1025575020,  -317989595}, {-1026545772,  -314841679}, 
+	{-1019548121,  -336813204}, {-1020576651,  -333683689}, {-1021595575,  -330551034}, {-1022604883,  -327415267}, 
+	{-1015338134,  -349299266}, {-1016404991,  -346182609}, {-1017462281,  -343062693}, {-1018509994,  -339939549}, 
+	{-1010975242,  -361732726}, {-1012080264,  -358629395}, {-1013175761,  -355522689}, {-1014261721,  -352412636}, 
+	{-1006460100,  -374111709}, {-1007603122,  -371022173}, {-1008736660,  -367929144}, {-1009860704,  -364832652}, 
+	{-1001793390,  -386434353}, {-1002974239,  -383359076}, {-1004145648,  -380280190}, {-1005307605,  -377197725}, 
+	{ -996975812,  -398698801}, { -998194311,  -395638246}, { -999403415,  -392573967}, {-1000603111,  -389505993}, 
+	{ -992008094,  -410903207}, { -993264059,  -407857835}, { -994510675,  -404808624}, { -995747930,  -401755603}, 
+	{ -986890984,  -423045732}, { -988184225,  -420016002}, { -989468165,  -416982319}, { -990742793,  -413944711}, 
+	{ -981625251,  -435124548}, { -982955574,  -432110916}, { -984276646,  -429093217}, { -985588453,  -426071480}, 
+	{ -976211688,  -447137835}, { -977578894,  -444140756}, { -978936898,  -441139496}, { -980285688,  -438134084}, 
+	{ -970651112,  -459083786}, { -972054994,  -456103710}, { -973449725,  -453119340}, { -974835295,  -450130706}, 
+	{ -964944360,  -470960600}, { -966384706,  -467997976}, { -967815955,  -465030947}, { -969238095,  -462059541}, 
+	{ -959092290,  -482766489}, { -960568883,  -479821764}, { -962036435,  -476872522}, { -963494932,  -473918791}, 
+	{ -953095785,  -494499676}, { -954608403,  -491573292}, { -956112036,  -488642281}, { -957606670,  -485706671}, 
+	{ -946955747,  -506158392}, { -948504163,  -503250791}, { -950043650,  -500338453}, { -951574196,  -497421405}, 
+	{ -940673101,  -517740883}, { -942257081,  -514852502}, { -943832191,  -511959275}, { -945398418,  -509061229}, 
+	{ -934248793,  -529245404}, { -935868098,  -526376678}, { -937478595,  -523502998}, { -939080267,  -520624391}, 
+	{ -927683790,  -540670223}, { -929338177,  -537821584}, { -930983817,  -534967884}, { -932620694,  -532109148}, 
+	{ -920979082,  -552013618}, { -922668302,  -549185496}, { -924348837,  -546352205}, { -926020672,  -543513772}, 
+	{ -914135678,  -563273883}, { -915859476,  -560466703}, { -917574653,  -557654248}, { -919281194,  -554836544}, 
+	{ -907154608,  -574449320}, { -908912725,  -571663506}, { -910662286,  -568872310}, { -912403276,  -566075761}, 
+	{ -900036924,  -585538248}, { -901829095,  -582774218}, { -903612776,  -580004702}, { -905387953,  -577229728}, 
+	{ -892783698,  -596538995}, { -894609652,  -593797166}, { -896427186,  -591049748}, { -898236282,  -588296766}, 
+	{ -885396022,  -607449906}, { -887255485,  -604730691}, { -889106597,  -602005783}, { -890949341,  -599275210}, 
+	{ -877875009,  -618269338}, { -879767701,  -615573145}, { -881652112,  -612871159}, { -883528225,  -610163404}, 
+	{ -870221790,  -628995660}, { -872147426,  -626322897}, { -874064853,  -623644239}, { -875974054,  -620959711}, 
+	{ -862437520,  -639627258}, { -864395810,  -636978327}, { -866345964,  -634323400}, { -868287963,  -631662503}, 
+	{ -854523370,  -650162530}, { -856514019,  -647537830}, { -858496606,  -644907034}, { -860471112,  -642270169}, 
+	{ -846480531,  -660599890}, { -848503239,  -657999816}, { -850517961,  -655393548}, { -852524677,  -652781111}, 
+	{ -838310216,  -670937767}, { -840364679,  -668362709}, { -842411232,  -665781362}, { -844449856,  -663193747}, 
+	{ -830013654,  -681174602}, { -832099562,  -678624950}, { -834177638,  -676068911}, { -836247863,  -673506508}, 
+	{ -821592095,  -691308855}, { -823709135,  -688784993}, { -825818421,  -686254647}, { -827919934,  -683717842}, 
+	{ -813046808,  -701339000}, { -815194659,  -698841307}, { -817334838,  -696337036}, { -819467323,  -693826211}, 
+	{ -804379079,  -711263525}, { -806557419,  -708792378}, { -808728167,  -706314559}, { -810891304,  -703830092}, 
+	{ -795590213,  -721080937}, { -797798714,  -718636707}, { -799999706,  -716185713}, { -802193167,  -713727978}, 
+	{ -786681534,  -730789757}, { -788919863,  -728372813}, { -791150767,  -725949013}, { -793374223,  -723518380}, 
+	{ -777654384,  -740388522}, { -779922204,  -737999228}, { -782182683,  -735602987}, { -784435800,  -733199822}, 
+	{ -768510122,  -749875788}, { -770807092,  -747514503}, { -773096806,  -745146182}, { -775379244,  -742770848}, 
+	{ -759250125,  -759250125}, { -761575898,  -756917205}, { -763894504,  -754577161}, { -766205919,  -752230015}, 
+	{ -749875788,  -768510122}, { -752230015,  -766205919}, { -754577161,  -763894504}, { -756917205,  -761575898}, 
+	{ -740388522,  -777654384}, { -742770848,  -775379244}, { -745146182,  -773096806}, { -747514503,  -770807092}, 
+	{ -730789757,  -786681534}, { -733199822,  -784435800}, { -735602987,  -782182683}, { -737999228,  -779922204}, 
+	{ -721080937,  -795590213}, { -723518380,  -793374223}, { -725949013,  -791150767}, { -728372813,  -788919863}, 
+	{ -711263525,  -804379079}, { -713727978,  -802193167}, { -716185713,  -799999706}, { -718636707,  -797798714}, 
+	{ -701339000,  -813046808}, { -703830092,  -810891304}, { -706314559,  -808728167}, { -708792378,  -806557419}, 
+	{ -691308855,  -821592095}, { -693826211,  -819467323}, { -696337036,  -817334838}, { -698841307,  -815194659}, 
+	{ -681174602,  -830013654}, { -683717842,  -827919934}, { -686254647,  -825818421}, { -688784993,  -823709135}, 
+	{ -670937767,  -838310216}, { -673506508,  -836247863}, { -676068911,  -834177638}, { -678624950,  -832099562}, 
+	{ -660599890,  -846480531}, { -663193747,  -844449856}, { -665781362,  -842411232}, { -668362709,  -840364679}, 
+	{ -650162530,  -854523370}, { -652781111,  -852524677}, { -655393548,  -850517961}, { -657999816,  -848503239}, 
+	{ -639627258,  -862437520}, { -642270169,  -860471112}, { -644907034,  -858496606}, { -647537830,  -856514019}, 
+	{ -628995660,  -870221790}, { -631662503,  -868287963}, { -634323400,  -866345964}, { -636978327,  -864395810}, 
+	{ -618269338,  -877875009}, { -620959711,  -875974054}, { -623644239,  -874064853}, { -626322897,  -872147426}, 
+	{ -607449906,  -885396022}, { -610163404,  -883528225}, { -612871159,  -881652112}, { -615573145,  -879767701}, 
+	{ -596538995,  -892783698}, { -599275210,  -890949341}, { -602005783,  -889106597}, { -604730691,  -887255485}, 
+	{ -585538248,  -900036924}, { -588296766,  -898236282}, { -591049748,  -896427186}, { -593797166,  -894609652}, 
+	{ -574449320,  -907154608}, { -577229728,  -905387953}, { -580004702,  -903612776}, { -582774218,  -901829095}, 
+	{ -563273883,  -914135678}, { -566075761,  -912403276}, { -568872310,  -910662286}, { -571663506,  -908912725}, 
+	{ -552013618,  -920979082}, { -554836544,  -919281194}, { -557654248,  -917574653}, { -560466703,  -915859476}, 
+	{ -540670223,  -927683790}, { -543513772,  -926020672}, { -546352205,  -924348837}, { -549185496,  -922668302}, 
+	{ -529245404,  -934248793}, { -532109148,  -932620694}, { -534967884,  -930983817}, { -537821584,  -929338177}, 
+	{ -517740883,  -940673101}, { -520624391,  -939080267}, { -523502998,  -937478595}, { -526376678,  -935868098}, 
+	{ -506158392,  -946955747}, { -509061229,  -945398418}, { -511959275,  -943832191}, { -514852502,  -942257081}, 
+	{ -494499676,  -953095785}, { -497421405,  -951574196}, { -500338453,  -950043650}, { -503250791,  -948504163}, 
+	{ -482766489,  -959092290}, { -485706671,  -957606670}, { -488642281,  -956112036}, { -491573292,  -954608403}, 
+	{ -470960600,  -964944360}, { -473918791,  -963494932}, { -476872522,  -962036435}, { -479821764,  -960568883}, 
+	{ -459083786,  -970651112}, { -462059541,  -969238095}, { -465030947,  -967815955}, { -467997976,  -966384706}, 
+	{ -447137835,  -976211688}, { -450130706,  -974835295}, { -453119340,  -973449725}, { -456103710,  -972054994}, 
+	{ -435124548,  -981625251}, { -438134084,  -980285688}, { -441139496,  -978936898}, { -444140756,  -977578894}, 
+	{ -423045732,  -986890984}, { -426071480,  -985588453}, { -429093217,  -984276646}, { -432110916,  -982955574}, 
+	{ -410903207,  -992008094}, { -413944711,  -990742793}, { -416982319,  -989468165}, { -420016002,  -988184225}, 
+	{ -398698801,  -996975812}, { -401755603,  -995747930}, { -404808624,  -994510675}, { -407857835,  -993264059}, 
+	{ -386434353, -1001793390}, { -389505993, -1000603111}, { -392573967,  -999403415}, { -395638246,  -998194311}, 
+	{ -374111709, -1006460100}, { -377197725, -1005307605}, { -380280190, -1004145648}, { -383359076, -1002974239}, 
+	{ -361732726, -1010975242}, { -364832652, -1009860704}, { -367929144, -1008736660}, { -371022173, -1007603122}, 
+	{ -349299266, -1015338134}, { -352412636, -1014261721}, { -355522689, -1013175761}, { -358629395, -1012080264}, 
+	{ -336813204, -1019548121}, { -339939549, -1018509994}, { -343062693, -1017462281}, { -346182609, -1016404991}, 
+	{ -324276419, -1023604567}, { -327415267, -1022604883}, { -330551034, -1021595575}, { -333683689, -1020576651}, 
+	{ -311690799, -1027506862}, { -314841679, -1026545772}, { -317989595, -1025575020}, { -321134518, -1024594615}, 
+	{ -299058239, -1031254418}, { -302220676, -1030332067}, { -305380268, -1029400018}, { -308536985, -1028458280}, 
+	{ -286380643, -1034846671}, { -289554160, -1033963197}, { -292724951, -1033069992}, { -295892988, -1032167062}, 
+	{ -273659918, -1038283080}, { -276844038, -1037438617}, { -280025552, -1036584389}, { -283204430, -1035720404}, 
+	{ -260897982, -1041563127}, { -264092224, -1040757802}, { -267283981, -1039942680}, { -270473223, -1039117770}, 
+	{ -248096755, -1044686319}, { -251300640, -1043920252}, { -254502159, -1043144360}, { -257701283, -1042358649}, 
+	{ -235258165, -1047652185}, { -238471210, -1046925492}, { -241682010, -1046188946}, { -244890535, -1045442553}, 
+	{ -222384147, -1050460278}, { -225605867, -1049773069}, { -228825464, -1049075980}, { -232042906, -1048369016}, 
+	{ -209476638, -1053110176}, { -212706549, -1052462555}, { -215934457, -1051805027}, { -219160334, -1051137599}, 
+	{ -196537583, -1055601479}, { -199775198, -1054993543}, { -203010932, -1054375676}, { -206244756, -1053747885}, 
+	{ -183568930, -1057933813}, { -186813762, -1057365653}, { -190056834, -1056787540}, { -193298119, -1056199480}, 
+	{ -170572633, -1060106826}, { -173824192, -1059578527}, { -177074115, -1059040255}, { -180322371, -1058492016}, 
+	{ -157550647, -1062120190}, { -160808445, -1061631833}, { -164064728, -1061133483}, { -167319468, -1060625146}, 
+	{ -144504935, -1063973603}, { -147768480, -1063525261}, { -151030634, -1063066909}, { -154291367, -1062598550}, 
+	{ -131437462, -1065666786}, { -134706263, -1065258526}, { -137973796, -1064840240}, { -141240030, -1064411931}, 
+	{ -118350194, -1067199483}, { -121623759, -1066831367}, { -124896179, -1066453210}, { -128167423, -1066065015}, 
+	{ -105245103, -1068571464}, { -108522939, -1068243547}, { -111799753, -1067905576}, { -115075515, -1067557554}, 
+	{  -92124163, -1069782521}, {  -95405776, -1069494854}, {  -98686491, -1069197120}, { -101966277, -1068889322}, 
+	{  -78989349, -1070832474}, {  -82274245, -1070585099}, {  -85558366, -1070327646}, {  -88841683, -1070060120}, 
+	{  -65842639, -1071721163}, {  -69130324, -1071514117}, {  -72417357, -1071296985}, {  -75703709, -1071069770}, 
+	{  -52686014, -1072448455}, {  -55975992, -1072281769}, {  -59265442, -1072104991}, {  -62554335, -1071918122}, 
+	{  -39521455, -1073014240}, {  -42813230, -1072887940}, {  -46104602, -1072751542}, {  -49395541, -1072605046}, 
+	{  -26350943, -1073418433}, {  -29644021, -1073332538}, {  -32936819, -1073236540}, {  -36229307, -1073130440}, 
+	{  -13176464, -1073660973}, {  -16470347, -1073615496}, {  -19764076, -1073559913}, {  -23057618, -1073494225}, 
+	{          0, -1073741824}, {   -3294193, -1073736771}, {   -6588356, -1073721611}, {   -9882456, -1073696345}, 
+	{   13176464, -1073660973}, {    9882456, -1073696345}, {    6588356, -1073721611}, {    3294193, -1073736771}, 
+	{   26350943, -1073418433}, {   23057618, -1073494225}, {   19764076, -1073559913}, {   16470347, -1073615496}, 
+	{   39521455, -1073014240}, {   36229307, -1073130440}, {   32936819, -1073236540}, {   29644021, -1073332538}, 
+	{   52686014, -1072448455}, {   49395541, -1072605046}, {   46104602, -1072751542}, {   42813230, -1072887940}, 
+	{   65842639, -1071721163}, {   62554335, -1071918122}, {   59265442, -1072104991}, {   55975992, -1072281769}, 
+	{   78989349, -1070832474}, {   75703709, -1071069770}, {   72417357, -1071296985}, {   69130324, -1071514117}, 
+	{   92124163, -1069782521}, {   88841683, -1070060120}, {   85558366, -1070327646}, {   82274245, -1070585099}, 
+	{  105245103, -1068571464}, {  101966277, -1068889322}, {   98686491, -1069197120}, {   95405776, -1069494854}, 
+	{  118350194, -1067199483}, {  115075515, -1067557554}, {  111799753, -1067905576}, {  108522939, -1068243547}, 
+	{  131437462, -1065666786}, {  128167423, -1066065015}, {  124896179, -1066453210}, {  121623759, -1066831367}, 
+	{  144504935, -1063973603}, {  141240030, -1064411931}, {  137973796, -1064840240}, {  134706263, -1065258526}, 
+	{  157550647, -1062120190}, {  154291367, -1062598550}, {  151030634, -1063066909}, {  147768480, -1063525261}, 
+	{  170572633, -1060106826}, {  167319468, -1060625146}, {  164064728, -1061133483}, {  160808445, -1061631833}, 
+	{  183568930, -1057933813}, {  180322371, -1058492016}, {  177074115, -1059040255}, {  173824192, -1059578527}, 
+	{  196537583, -1055601479}, {  193298119, -1056199480}, {  190056834, -1056787540}, {  186813762, -1057365653}, 
+	{  209476638, -1053110176}, {  206244756, -1053747885}, {  203010932, -1054375676}, {  199775198, -1054993543}, 
+	{  222384147, -1050460278}, {  219160334, -1051137599}, {  215934457, -1051805027}, {  212706549, -1052462555}, 
+	{  235258165, -1047652185}, {  232042906, -1048369016}, {  228825464, -1049075980}, {  225605867, -1049773069}, 
+	{  248096755, -1044686319}, {  244890535, -1045442553}, {  241682010, -1046188946}, {  238471210, -1046925492}, 
+	{  260897982, -1041563127}, {  257701283, -1042358649}, {  254502159, -1043144360}, {  251300640, -1043920252}, 
+	{  273659918, -1038283080}, {  270473223, -1039117770}, {  267283981, -1039942680}, {  264092224, -1040757802}, 
+	{  286380643, -1034846671}, {  283204430, -1035720404}, {  280025552, -1036584389}, {  276844038, -1037438617}, 
+	{  299058239, -1031254418}, {  295892988, -1032167062}, {  292724951, -1033069992}, {  289554160, -1033963197}, 
+	{  311690799, -1027506862}, {  308536985, -1028458280}, {  305380268, -1029400018}, {  302220676, -1030332067}, 
+	{  324276419, -1023604567}, {  321134518, -1024594615}, {  317989595, -1025575020}, {  314841679, -1026545772}, 
+	{  336813204, -1019548121}, {  333683689, -1020576651}, {  330551034, -1021595575}, {  327415267, -1022604883}, 
+	{  349299266, -1015338134}, {  346182609, -1016404991}, {  343062693, -1017462281}, {  339939549, -1018509994}, 
+	{  361732726, -1010975242}, {  358629395, -1012080264}, {  355522689, -1013175761}, {  352412636, -1014261721}, 
+	{  374111709, -1006460100}, {  371022173, -1007603122}, {  367929144, -1008736660}, {  364832652, -1009860704}, 
+	{  386434353, -1001793390}, {  383359076, -1002974239}, {  380280190, -1004145648}, {  377197725, -1005307605}, 
+	{  398698801,  -996975812}, {  395638246,  -998194311}, {  392573967,  -999403415}, {  389505993, -1000603111}, 
+	{  410903207,  -992008094}, {  407857835,  -993264059}, {  404808624,  -994510675}, {  401755603,  -995747930}, 
+	{  423045732,  -986890984}, {  420016002,  -988184225}, {  416982319,  -989468165}, {  413944711,  -990742793}, 
+	{  435124548,  -981625251}, {  432110916,  -982955574}, {  429093217,  -984276646}, {  426071480,  -985588453}, 
+	{  447137835,  -976211688}, {  444140756,  -977578894}, {  441139496,  -978936898}, {  438134084,  -980285688}, 
+	{  459083786,  -970651112}, {  456103710,  -972054994}, {  453119340,  -973449725}, {  450130706,  -974835295}, 
+	{  470960600,  -964944360}, {  467997976,  -966384706}, {  465030947,  -967815955}, {  462059541,  -969238095}, 
+	{  482766489,  -959092290}, {  479821764,  -960568883}, {  476872522,  -962036435}, {  473918791,  -963494932}, 
+	{  494499676,  -953095785}, {  491573292,  -954608403}, {  488642281,  -956112036}, {  485706671,  -957606670}, 
+	{  506158392,  -946955747}, {  503250791,  -948504163}, {  500338453,  -950043650}, {  497421405,  -951574196}, 
+	{  517740883,  -940673101}, {  514852502,  -942257081}, {  511959275,  -943832191}, {  509061229,  -945398418}, 
+	{  529245404,  -934248793}, {  526376678,  -935868098}, {  523502998,  -937478595}, {  520624391,  -939080267}, 
+	{  540670223,  -927683790}, {  537821584,  -929338177}, {  534967884,  -930983817}, {  532109148,  -932620694}, 
+	{  552013618,  -920979082}, {  549185496,  -922668302}, {  546352205,  -924348837}, {  543513772,  -926020672}, 
+	{  563273883,  -914135678}, {  560466703,  -915859476}, {  557654248,  -917574653}, {  554836544,  -919281194}, 
+	{  574449320,  -907154608}, {  571663506,  -908912725}, {  568872310,  -910662286}, {  566075761,  -912403276}, 
+	{  585538248,  -900036924}, {  582774218,  -901829095}, {  580004702,  -903612776}, {  577229728,  -905387953}, 
+	{  596538995,  -892783698}, {  593797166,  -894609652}, {  591049748,  -896427186}, {  588296766,  -898236282}, 
+	{  607449906,  -885396022}, {  604730691,  -887255485}, {  602005783,  -889106597}, {  599275210,  -890949341}, 
+	{  618269338,  -877875009}, {  615573145,  -879767701}, {  612871159,  -881652112}, {  610163404,  -883528225}, 
+	{  628995660,  -870221790}, {  626322897,  -872147426}, {  623644239,  -874064853}, {  620959711,  -875974054}, 
+	{  639627258,  -862437520}, {  636978327,  -864395810}, {  634323400,  -866345964}, {  631662503,  -868287963}, 
+	{  650162530,  -854523370}, {  647537830,  -856514019}, {  644907034,  -858496606}, {  642270169,  -860471112}, 
+	{  660599890,  -846480531}, {  657999816,  -848503239}, {  655393548,  -850517961}, {  652781111,  -852524677}, 
+	{  670937767,  -838310216}, {  668362709,  -840364679}, {  665781362,  -842411232}, {  663193747,  -844449856}, 
+	{  681174602,  -830013654}, {  678624950,  -832099562}, {  676068911,  -834177638}, {  673506508,  -836247863}, 
+	{  691308855,  -821592095}, {  688784993,  -823709135}, {  686254647,  -825818421}, {  683717842,  -827919934}, 
+	{  701339000,  -813046808}, {  698841307,  -815194659}, {  696337036,  -817334838}, {  693826211,  -819467323}, 
+	{  711263525,  -804379079}, {  708792378,  -806557419}, {  706314559,  -808728167}, {  703830092,  -810891304}, 
+	{  721080937,  -795590213}, {  718636707,  -797798714}, {  716185713,  -799999706}, {  713727978,  -802193167}, 
+	{  730789757,  -786681534}, {  728372813,  -788919863}, {  725949013,  -791150767}, {  723518380,  -793374223}, 
+	{  740388522,  -777654384}, {  737999228,  -779922204}, {  735602987,  -782182683}, {  733199822,  -784435800}, 
+	{  749875788,  -768510122}, {  747514503,  -770807092}, {  745146182,  -773096806}, {  742770848,  -775379244}, 
+	{  759250125,  -759250125}, {  756917205,  -761575898}, {  754577161,  -763894504}, {  752230015,  -766205919}, 
+	{  768510122,  -749875788}, {  766205919,  -752230015}, {  763894504,  -754577161}, {  761575898,  -756917205}, 
+	{  777654384,  -740388522}, {  775379244,  -742770848}, {  773096806,  -745146182}, {  770807092,  -747514503}, 
+	{  786681534,  -730789757}, {  784435800,  -733199822}, {  782182683,  -735602987}, {  779922204,  -737999228}, 
+	{  795590213,  -721080937}, {  793374223,  -723518380}, {  791150767,  -725949013}, {  788919863,  -728372813}, 
+	{  804379079,  -711263525}, {  802193167,  -713727978}, {  799999706,  -716185713}, {  797798714,  -718636707}, 
+	{  813046808,  -701339000}, {  810891304,  -703830092}, {  808728167,  -706314559}, {  806557419,  -708792378}, 
+	{  821592095,  -691308855}, {  819467323,  -693826211}, {  817334838,  -696337036}, {  815194659,  -698841307}, 
+	{  830013654,  -681174602}, {  827919934,  -683717842}, {  825818421,  -686254647}, {  823709135,  -688784993}, 
+	{  838310216,  -670937767}, {  836247863,  -673506508}, {  834177638,  -676068911}, {  832099562,  -678624950}, 
+	{  846480531,  -660599890}, {  844449856,  -663193747}, {  842411232,  -665781362}, {  840364679,  -668362709}, 
+	{  854523370,  -650162530}, {  852524677,  -652781111}, {  850517961,  -655393548}, {  848503239,  -657999816}, 
+	{  862437520,  -639627258}, {  860471112,  -642270169}, {  858496606,  -644907034}, {  856514019,  -647537830}, 
+	{  870221790,  -628995660}, {  868287963,  -631662503}, {  866345964,  -634323400}, {  864395810,  -636978327}, 
+	{  877875009,  -618269338}, {  875974054,  -620959711}, {  874064853,  -623644239}, {  872147426,  -626322897}, 
+	{  885396022,  -607449906}, {  883528225,  -610163404}, {  881652112,  -612871159}, {  879767701,  -615573145}, 
+	{  892783698,  -596538995}, {  890949341,  -599275210}, {  889106597,  -602005783}, {  887255485,  -604730691}, 
+	{  900036924,  -585538248}, {  898236282,  -588296766}, {  896427186,  -591049748}, {  894609652,  -593797166}, 
+	{  907154608,  -574449320}, {  905387953,  -577229728}, {  903612776,  -580004702}, {  901829095,  -582774218}, 
+	{  914135678,  -563273883}, {  912403276,  -566075761}, {  910662286,  -568872310}, {  908912725,  -571663506}, 
+	{  920979082,  -552013618}, {  919281194,  -554836544}, {  917574653,  -557654248}, {  915859476,  -560466703}, 
+	{  927683790,  -540670223}, {  926020672,  -543513772}, {  924348837,  -546352205}, {  922668302,  -549185496}, 
+	{  934248793,  -529245404}, {  932620694,  -532109148}, {  930983817,  -534967884}, {  929338177,  -537821584}, 
+	{  940673101,  -517740883}, {  939080267,  -520624391}, {  937478595,  -523502998}, {  935868098,  -526376678}, 
+	{  946955747,  -506158392}, {  945398418,  -509061229}, {  943832191,  -511959275}, {  942257081,  -514852502}, 
+	{  953095785,  -494499676}, {  951574196,  -497421405}, {  950043650,  -500338453}, {  948504163,  -503250791}, 
+	{  959092290,  -482766489}, {  957606670,  -485706671}, {  956112036,  -488642281}, {  954608403,  -491573292}, 
+	{  964944360,  -470960600}, {  963494932,  -473918791}, {  962036435,  -476872522}, {  960568883,  -479821764}, 
+	{  970651112,  -459083786}, {  969238095,  -462059541}, {  967815955,  -465030947}, {  966384706,  -467997976}, 
+	{  976211688,  -447137835}, {  974835295,  -450130706}, {  973449725,  -453119340}, {  972054994,  -456103710}, 
+	{  981625251,  -435124548}, {  980285688,  -438134084}, {  978936898,  -441139496}, {  977578894,  -444140756}, 
+	{  986890984,  -423045732}, {  985588453,  -426071480}, {  984276646,  -429093217}, {  982955574,  -432110916}, 
+	{  992008094,  -410903207}, {  990742793,  -413944711}, {  989468165,  -416982319}, {  988184225,  -420016002}, 
+	{  996975812,  -398698801}, {  995747930,  -401755603}, {  994510675,  -404808624}, {  993264059,  -407857835}, 
+	{ 1001793390,  -386434353}, { 1000603111,  -389505993}, {  999403415,  -392573967}, {  998194311,  -395638246}, 
+	{ 1006460100,  -374111709}, { 1005307605,  -377197725}, { 1004145648,  -380280190}, { 1002974239,  -383359076}, 
+	{ 1010975242,  -361732726}, { 1009860704,  -364832652}, { 1008736660,  -367929144}, { 1007603122,  -371022173}, 
+	{ 1015338134,  -349299266}, { 1014261721,  -352412636}, { 1013175761,  -355522689}, { 1012080264,  -358629395}, 
+	{ 1019548121,  -336813204}, { 1018509994,  -339939549}, { 1017462281,  -343062693}, { 1016404991,  -346182609}, 
+	{ 1023604567,  -324276419}, { 1022604883,  -327415267}, { 1021595575,  -330551034}, { 1020576651,  -333683689}, 
+	{ 1027506862,  -311690799}, { 1026545772,  -314841679}, { 1025575020,  -317989595}, { 1024594615,  -321134518}, 
+	{ 1031254418,  -299058239}, { 1030332067,  -302220676}, { 1029400018,  -305380268}, { 1028458280,  -308536985}, 
+	{ 1034846671,  -286380643}, { 1033963197,  -289554160}, { 1033069992,  -292724951}, { 1032167062,  -295892988}, 
+	{ 1038283080,  -273659918}, { 1037438617,  -276844038}, { 1036584389,  -280025552}, { 1035720404,  -283204430}, 
+	{ 1041563127,  -260897982}, { 1040757802,  -264092224}, { 1039942680,  -267283981}, { 1039117770,  -270473223}, 
+	{ 1044686319,  -248096755}, { 1043920252,  -251300640}, { 1043144360,  -254502159}, { 1042358649,  -257701283}, 
+	{ 1047652185,  -235258165}, { 1046925492,  -238471210}, { 1046188946,  -241682010}, { 1045442553,  -244890535}, 
+	{ 1050460278,  -222384147}, { 1049773069,  -225605867}, { 1049075980,  -228825464}, { 1048369016,  -232042906}, 
+	{ 1053110176,  -209476638}, { 1052462555,  -212706549}, { 1051805027,  -215934457}, { 1051137599,  -219160334}, 
+	{ 1055601479,  -196537583}, { 1054993543,  -199775198}, { 1054375676,  -203010932}, { 1053747885,  -206244756}, 
+	{ 1057933813,  -183568930}, { 1057365653,  -186813762}, { 1056787540,  -190056834}, { 1056199480,  -193298119}, 
+	{ 1060106826,  -170572633}, { 1059578527,  -173824192}, { 1059040255,  -177074115}, { 1058492016,  -180322371}, 
+	{ 1062120190,  -157550647}, { 1061631833,  -160808445}, { 1061133483,  -164064728}, { 1060625146,  -167319468}, 
+	{ 1063973603,  -144504935}, { 1063525261,  -147768480}, { 1063066909,  -151030634}, { 1062598550,  -154291367}, 
+	{ 1065666786,  -131437462}, { 1065258526,  -134706263}, { 1064840240,  -137973796}, { 1064411931,  -141240030}, 
+	{ 1067199483,  -118350194}, { 1066831367,  -121623759}, { 1066453210,  -124896179}, { 1066065015,  -128167423}, 
+	{ 1068571464,  -105245103}, { 1068243547,  -108522939}, { 1067905576,  -111799753}, { 1067557554,  -115075515}, 
+	{ 1069782521,   -92124163}, { 1069494854,   -95405776}, { 1069197120,   -98686491}, { 1068889322,  -101966277}, 
+	{ 1070832474,   -78989349}, { 1070585099,   -82274245}, { 1070327646,   -85558366}, { 1070060120,   -88841683}, 
+	{ 1071721163,   -65842639}, { 1071514117,   -69130324}, { 1071296985,   -72417357}, { 1071069770,   -75703709}, 
+	{ 1072448455,   -52686014}, { 1072281769,   -55975992}, { 1072104991,   -59265442}, { 1071918122,   -62554335}, 
+	{ 1073014240,   -39521455}, { 1072887940,   -42813230}, { 1072751542,   -46104602}, { 1072605046,   -49395541}, 
+	{ 1073418433,   -26350943}, { 1073332538,   -29644021}, { 1073236540,   -32936819}, { 1073130440,   -36229307}, 
+	{ 1073660973,   -13176464}, { 1073615496,   -16470347}, { 1073559913,   -19764076}, { 1073494225,   -23057618}, 
+	{ 1073741824,           0}, { 1073736771,    -3294193}, { 1073721611,    -6588356}, { 1073696345,    -9882456}, 
+#endif
+#if (MAX_DIT_FFT_LUT_LOG2 >= 12)
+	{-1073721611,    -6588356}, {-1073730454,    -4941281}, {-1073736771,    -3294193}, {-1073740561,    -1647099}, 
+	{-1073660973,   -13176464}, {-1073679922,   -11529474}, {-1073696345,    -9882456}, {-1073710241,    -8235416}, 
+	{-1073559913,   -19764076}, {-1073588967,   -18117233}, {-1073615496,   -16470347}, {-1073639498,   -14823423}, 
+	{-1073418433,   -26350943}, {-1073457592,   -24704310}, {-1073494225,   -23057618}, {-1073528332,   -21410872}, 
+	{-1073236540,   -32936819}, {-1073285802,   -31290457}, {-1073332538,   -29644021}, {-1073376748,   -27997515}, 
+	{-1073014240,   -39521455}, {-1073073603,   -37875426}, {-1073130440,   -36229307}, {-1073184753,   -34583104}, 
+	{-1072751542,   -46104602}, {-1072821003,   -44458968}, {-1072887940,   -42813230}, {-1072952352,   -41167391}, 
+	{-1072448455,   -52686014}, {-1072528012,   -51040837}, {-1072605046,   -49395541}, {-1072679556,   -47750128}, 
+	{-1072104991,   -59265442}, {-1072194642,   -57620785}, {-1072281769,   -55975992}, {-1072366374,   -54331067}, 
+	{-1071721163,   -65842639}, {-1071820903,   -64198563}, {-1071918122,   -62554335}, {-1072012818,   -60909960}, 
+	{-1071296985,   -72417357}, {-1071406812,   -70773924}, {-1071514117,   -69130324}, {-1071618901,   -67486561}, 
+	{-1070832474,   -78989349}, {-1070952382,   -77346620}, {-1071069770,   -75703709}, {-1071184638,   -74060620}, 
+	{-1070327646,   -85558366}, {-1070457632,   -83916404}, {-1070585099,   -82274245}, {-1070710046,   -80631892}, 
+	{-1069782521,   -92124163}, {-1069922579,   -90483029}, {-1070060120,   -88841683}, {-1070195142,   -87200127}, 
+	{-1069197120,   -98686491}, {-1069347245,   -97046247}, {-1069494854,   -95405776}, {-1069639946,   -93765079}, 
+	{-1068571464,  -105245103}, {-1068731650,  -103605812}, {-1068889322,  -101966277}, {-1069044479,  -100326502}, 
+	{-1067905576,  -111799753}, {-1068075818,  -110161476}, {-1068243547,  -108522939}, {-1068408763,  -106884147}, 
+	{-1067199483,  -118350194}, {-1067379774,  -116712992}, {-1067557554,  -115075515}, {-1067732821,  -113437768}, 
+	{-1066453210,  -124896179}, {-1066643544,  -123260114}, {-1066831367,  -121623759}, {-1067016680,  -119987118}, 
+	{-1065666786,  -131437462}, {-1065867154,  -129802595}, {-1066065015,  -128167423}, {-1066260367,  -126531950}, 
+	{-1064840240,  -137973796}, {-1065050636,  -136340190}, {-1065258526,  -134706263}, {-1065463909,  -133072019}, 
+	{-1063973603,  -144504935}, {-1064194019,  -142872651}, {-1064411931,  -141240030}, {-1064627338,  -139607077}, 
+	{-1063066909,  -151030634}, {-1063297336,  -149399733}, {-1063525261,  -147768480}, {-1063750684,  -146136880}, 
+	{-1062120190,  -157550647}, {-1062360620,  -155921191}, {-1062598550,  -154291367}, {-1062833980,  -152661180}, 
+	{-1061133483,  -164064728}, {-1061383907,  -162436778}, {-1061631833,  -160808445}, {-1061877261,  -159179733}, 
+	{-1060106826,  -170572633}, {-1060367233,  -168946249}, {-1060625146,  -167319468}, {-1060880563,  -165692293}, 
+	{-1059040255,  -177074115}, {-1059310638,  -175449360}, {-1059578527,  -173824192}, {-1059843923,  -172198615}, 
+	{-1057933813,  -183568930}, {-1058214159,  -181945865}, {-1058492016,  -180322371}, {-1058767381,  -178698453}, 
+	{-1056787540,  -190056834}, {-1057077840,  -188435520}, {-1057365653,  -186813762}, {-1057650977,  -185191564}, 
+	{-1055601479,  -196537583}, {-1055901722,  -194918080}, {-1056199480,  -193298119}, {-1056494753,  -191677702}, 
+	{-1054375676,  -203010932}, {-1054685850,  -201393302}, {-1054993543,  -199775198}, {-1055298753,  -198156624}, 
+	{-1053110176,  -209476638}, {-1053430270,  -207860942}, {-1053747885,  -206244756}, {-1054063021,  -204628085}, 
+	{-1051805027,  -215934457}, {-1052135029,  -214320755}, {-1052462555,  -212706549}, {-1052787604,  -211091842}, 
+	{-1050460278,  -222384147}, {-1050800175,  -220772500}, {-1051137599,  -219160334}, {-1051472550,  -217547651}, 
+	{-1049075980,  -228825464}, {-1049425759,  -227215933}, {-1049773069,  -225605867}, {-1050117909,  -223995270}, 
+	{-1047652185,  -235258165}, {-1048011834,  -233650811}, {-1048369016,  -232042906}, {-1048723732,  -230434456}, 
+	{-1046188946,  -241682010}, {-1046558451,  -240076892}, {-1046925492,  -238471210}, {-1047290071,  -236864966}, 
+	{-1044686319,  -248096755}, {-1045065665,  -246493935}, {-1045442553,  -244890535}, {-1045816980,  -243286558}, 
+	{-1043144360,  -254502159}, {-1043533534,  -252901697}, {-1043920252,  -251300640}, {-1044304514,  -249698991}, 
+	{-1041563127,  -260897982}, {-1041962114,  -259299937}, {-1042358649,  -257701283}, {-1042752731,  -256102022}, 
+	{-1039942680,  -267283981}, {-1040351465,  -265688415}, {-1040757802,  -264092224}, {-1041161689,  -262495412}, 
+	{-1038283080,  -273659918}, {-1038701647,  -272066891}, {-1039117770,  -270473223}, {-1039531448,  -268878918}, 
+	{-1036584389,  -280025552}, {-1037012723,  -278435122}, {-1037438617,  -276844038}, {-1037862069,  -275252302}, 
+	{-1034846671,  -286380643}, {-1035284755,  -284792871}, {-1035720404,  -283204430}, {-1036153615,  -281615322}, 
+	{-1033069992,  -292724951}, {-1033517810,  -291139898}, {-1033963197,  -289554160}, {-1034406151,  -287967740}, 
+	{-1031254418,  -299058239}, {-1031711954,  -297475964}, {-1032167062,  -295892988}, {-1032619742,  -294309316}, 
+	{-1029400018,  -305380268}, {-1029867254,  -303800829}, {-1030332067,  -302220676}, {-1030794455,  -300639811}, 
+	{-1027506862,  -311690799}, {-1027983780,  -310114257}, {-1028458280,  -308536985}, {-1028930359,  -306958988}, 
+	{-1025575020,  -317989595}, {-1026061603,  -316416009}, {-1026545772,  -314841679}, {-1027027525,  -313266607}, 
+	{-1023604567,  -324276419}, {-1024100796,  -322705848}, {-1024594615,  -321134518}, {-1025086024,  -319562433}, 
+	{-1021595575,  -330551034}, {-1022101432,  -328983538}, {-1022604883,  -327415267}, {-1023105929,  -325846226}, 
+	{-1019548121,  -336813204}, {-1020063586,  -335248841}, {-1020576651,  -333683689}, {-1021087314,  -332117752}, 
+	{-1017462281,  -343062693}, {-1017987335,  -341501523}, {-1018509994,  -339939549}, {-1019030256,  -338376774}, 
+	{-1015338134,  -349299266}, {-1015872758,  -347741347}, {-1016404991,  -346182609}, {-1016934832,  -344623057}, 
+	{-1013175761,  -355522689}, {-1013719934,  -353968079}, {-1014261721,  -352412636}, {-1014801122,  -350856364}, 
+	{-1010975242,  -361732726}, {-1011528943,  -360181484}, {-1012080264,  -358629395}, {-1012629204,  -357076462}, 
+	{-1008736660,  -367929144}, {-1009299870,  -366381329}, {-1009860704,  -364832652}, {-1010419162,  -363283116}, 
+	{-1006460100,  -374111709}, {-1007032796,  -372567379}, {-1007603122,  -371022173}, {-1008171077,  -369476093}, 
+	{-1004145648,  -380280190}, {-1004727809,  -378739403}, {-1005307605,  -377197725}, {-1005885036,  -375655159}, 
+	{-1001793390,  -386434353}, {-1002384994,  -384897167}, {-1002974239,  -383359076}, {-1003561124,  -381820082}, 
+	{ -999403415,  -392573967}, {-1000004439,  -391040440}, {-1000603111,  -389505993}, {-1001199428,  -387970630}, 
+	{ -996975812,  -398698801}, { -997586236,  -397168991}, { -998194311,  -395638246}, { -998800038,  -394106570}, 
+	{ -994510675,  -404808624}, { -995130473,  -403282588}, { -995747930,  -401755603}, { -996363043,  -400227673}, 
+	{ -992008094,  -410903207}, { -992637245,  -409381002}, { -993264059,  -407857835}, { -993888536,  -406333708}, 
+	{ -989468165,  -416982319}, { -990106644,  -415464004}, { -990742793,  -413944711}, { -991376610,  -412424444}, 
+	{ -986890984,  -423045732}, { -987538766,  -421531363}, { -988184225,  -420016002}, { -988827359,  -418499653}, 
+	{ -984276646,  -429093217}, { -984933708,  -427582852}, { -985588453,  -426071480}, { -986240879,  -424559105}, 
+	{ -981625251,  -435124548}, { -982291568,  -433618242}, { -982955574,  -432110916}, { -983617267,  -430602573}, 
+	{ -978936898,  -441139496}, { -979612445,  -439637307}, { -980285688,  -438134084}, { -980956623,  -436629829}, 
+	{ -976211688,  -447137835}, { -976896441,  -445639820}, { -977578894,  -444140756}, { -978259047,  -442640647}, 
+	{ -973449725,  -453119340}, { -974143656,  -451625555}, { -974835295,  -450130706}, { -975524639,  -448634799}, 
+	{ -970651112,  -459083786}, { -971354196,  -457594286}, { -972054994,  -456103710}, { -972753504,  -454612060}, 
+	{ -967815955,  -465030947}, { -968528165,  -463545789}, { -969238095,  -462059541}, { -969945745,  -460572205}, 
+	{ -964944360,  -470960600}, { -965665669,  -469479840}, { -966384706,  -467997976}, { -967101468,  -466515010}, 
+	{ -962036435,  -476872522}, { -962766816,  -475396216}, { -963494932,  -473918791}, { -964220780,  -472440251}, 
+	{ -959092290,  -482766489}, { -959831716,  -481294693}, { -960568883,  -479821764}, { -961303790,  -478347705}, 
+	{ -956112036,  -488642281}, { -956860479,  -487175049}, { -957606670,  -485706671}, { -958350608,  -484237150}, 
+	{ -953095785,  -494499676}, { -953853216,  -493037064}, { -954608403,  -491573292}, { -955361344,  -490108363}, 
+	{ -950043650,  -500338453}, { -950810042,  -498880516}, { -951574196,  -497421405}, { -952336111,  -495961124}, 
+	{ -946955747,  -506158392}, { -947731070,  -504705185}, { -948504163,  -503250791}, { -949275023,  -501795212}, 
+	{ -943832191,  -511959275}, { -944616416,  -510510853}, { -945398418,  -509061229}, { -946178196,  -507610408}, 
+	{ -940673101,  -517740883}, { -941466198,  -516297300}, { -942257081,  -514852502}, { -943045745,  -513406493}, 
+	{ -937478595,  -523502998}, { -938280535,  -522064309}, { -939080267,  -520624391}, { -939877790,  -519183248}, 
+	{ -934248793,  -529245404}, { -935059546,  -527811662}, { -935868098,  -526376678}, { -936674448,  -524940456}, 
+	{ -930983817,  -534967884}, { -931803352,  -533539144}, { -932620694,  -532109148}, { -933435842,  -530677900}, 
+	{ -927683790,  -540670223}, { -928512076,  -539246538}, { -929338177,  -537821584}, { -930162092,  -536395365}, 
+	{ -924348837,  -546352205}, { -925185843,  -544933630}, { -926020672,  -543513772}, { -926853322,  -542092635}, 
+	{ -920979082,  -552013618}, { -921824777,  -550600205}, { -922668302,  -549185496}, { -923509656,  -547769495}, 
+	{ -917574653,  -557654248}, { -918429004,  -556246051}, { -919281194,  -554836544}, { -920131221,  -553425732}, 
+	{ -914135678,  -563273883}, { -914998653,  -561870954}, { -915859476,  -560466703}, { -916718143,  -559061133}, 
+	{ -910662286,  -568872310}, { -911533853,  -567474703}, { -912403276,  -566075761}, { -913270551,  -564675486}, 
+	{ -907154608,  -574449320}, { -908034735,  -573057087}, { -908912725,  -571663506}, { -909788576,  -570268579}, 
+	{ -903612776,  -580004702}, { -904501429,  -578617896}, { -905387953,  -577229728}, { -906272347,  -575840202}, 
+	{ -900036924,  -585538248}, { -900934069,  -584156920}, { -901829095,  -582774218}, { -902721998,  -581390144}, 
+	{ -896427186,  -591049748}, { -897332790,  -589673951}, { -898236282,  -588296766}, { -899137661,  -586918198}, 
+	{ -892783698,  -596538995}, { -893697727,  -595168781}, { -894609652,  -593797166}, { -895519473,  -592424154}, 
+	{ -889106597,  -602005783}, { -890029016,  -600641203}, { -890949341,  -599275210}, { -891867569,  -597907806}, 
+	{ -885396022,  -607449906}, { -886326796,  -606091012}, { -887255485,  -604730691}, { -888182086,  -603368947}, 
+	{ -881652112,  -612871159}, { -882591207,  -611518001}, { -883528225,  -610163404}, { -884463164,  -608807372}, 
+	{ -877875009,  -618269338}, { -878822389,  -616921967}, { -879767701,  -615573145}, { -880710943,  -614222875}, 
+	{ -874064853,  -623644239}, { -875020483,  -622302707}, { -875974054,  -620959711}, { -876925563,  -619615253}, 
+	{ -870221790,  -628995660}, { -871185633,  -627660017}, { -872147426,  -626322897}, { -873107167,  -624984303}, 
+	{ -866345964,  -634323400}, { -867317984,  -632993696}, { -868287963,  -631662503}, { -869255900,  -630329823}, 
+	{ -862437520,  -639627258}, { -863417681,  -638303543}, { -864395810,  -636978327}, { -865371905,  -635651611}, 
+	{ -858496606,  -644907034}, { -859484870,  -643589359}, { -860471112,  -642270169}, { -861455330,  -640949467}, 
+	{ -854523370,  -650162530}, { -855519701,  -648850943}, { -856514019,  -647537830}, { -857506321,  -646223192}, 
+	{ -850517961,  -655393548}, { -851522321,  -654088099}, { -852524677,  -652781111}, { -853525028,  -651472587}, 
+	{ -846480531,  -660599890}, { -847492882,  -659300629}, { -848503239,  -657999816}, { -849511600,  -656697454}, 
+	{ -842411232,  -665781362}, { -843431536,  -664488336}, { -844449856,  -663193747}, { -845466188,  -661897597}, 
+	{ -838310216,  -670937767}, { -839338435,  -669651026}, { -840364679,  -668362709}, { -841388945,  -667072820}, 
+	{ -834177638,  -676068911}, { -835213733,  -674788504}, { -836247863,  -673506508}, { -837280024,  -672222928}, 
+	{ -830013654,  -681174602}, { -831057586,  -679900576}, { -832099562,  -678624950}, { -833139580,  -677347728}, 
+	{ -825818421,  -686254647}, { -826870150,  -684987051}, { -827919934,  -683717842}, { -828967769,  -682447025}, 
+	{ -821592095,  -691308855}, { -822651583,  -690047736}, { -823709135,  -688784993}, { -824764748,  -687520629}, 
+	{ -817334838,  -696337036}, { -818402043,  -695082441}, { -819467323,  -693826211}, { -820530675,  -692568348}, 
+	{ -813046808,  -701339000}, { -814121692,  -700090977}, { -815194659,  -698841307}, { -816265709,  -697589992}, 
+	{ -808728167,  -706314559}, { -809810688,  -705073155}, { -810891304,  -703830092}, { -811970011,  -702585372}, 
+	{ -804379079,  -711263525}, { -805469196,  -710028787}, { -806557419,  -708792378}, { -807643743,  -707554301}, 
+	{ -799999706,  -716185713}, { -801097379,  -714957687}, { -802193167,  -713727978}, { -803287068,  -712496590}, 
+	{ -795590213,  -721080937}, { -796695401,  -719859669}, { -797798714,  -718636707}, { -798900150,  -717412054}, 
+	{ -791150767,  -725949013}, { -792263427,  -724734549}, { -793374223,  -723518380}, { -794483153,  -722300508}, 
+	{ -786681534,  -730789757}, { -787801625,  -729582143}, { -788919863,  -728372813}, { -790036244,  -727161768}, 
+	{ -782182683,  -735602987}, { -783310163,  -734402269}, { -784435800,  -733199822}, { -785559591,  -731995651}, 
+	{ -777654384,  -740388522}, { -778789210,  -739194745}, { -779922204,  -737999228}, { -781053363,  -736801974}, 
+	{ -773096806,  -745146182}, { -774238936,  -743959390}, { -775379244,  -742770848}, { -776517728,  -741580558}, 
+	{ -768510122,  -749875788}, { -769659512,  -748696026}, { -770807092,  -747514503}, { -771952857,  -746331221}, 
+	{ -763894504,  -754577161}, { -765051111,  -753404474}, { -766205919,  -752230015}, { -767358923,  -751053785}, 
+	{ -759250125,  -759250125}, { -760413906,  -758084557}, { -761575898,  -756917205}, { -762736098,  -755748072}, 
+	{ -754577161,  -763894504}, { -755748072,  -762736098}, { -756917205,  -761575898}, { -758084557,  -760413906}, 
+	{ -749875788,  -768510122}, { -751053785,  -767358923}, { -752230015,  -766205919}, { -753404474,  -765051111}, 
+	{ -745146182,  -773096806}, { -746331221,  -771952857}, { -747514503,  -770807092}, { -748696026,  -769659512}, 
+	{ -740388522,  -777654384}, { -741580558,  -776517728}, { -742770848,  -775379244}, { -743959390,  -774238936}, 
+	{ -735602987,  -782182683}, { -736801974,  -781053363}, { -737999228,  -779922204}, { -739194745,  -778789210}, 
+	{ -730789757,  -786681534}, { -731995651,  -785559591}, { -733199822,  -784435800}, { -734402269,  -783310163}, 
+	{ -725949013,  -791150767}, { -727161768,  -790036244}, { -728372813,  -788919863}, { -729582143,  -787801625}, 
+	{ -721080937,  -795590213}, { -722300508,  -794483153}, { -723518380,  -793374223}, { -724734549,  -792263427}, 
+	{ -716185713,  -799999706}, { -717412054,  -798900150}, { -718636707,  -797798714}, { -719859669,  -796695401}, 
+	{ -711263525,  -804379079}, { -712496590,  -803287068}, { -713727978,  -802193167}, { -714957687,  -801097379}, 
+	{ -706314559,  -808728167}, { -707554301,  -807643743}, { -708792378,  -806557419}, { -710028787,  -805469196}, 
+	{ -701339000,  -813046808}, { -702585372,  -811970011}, { -703830092,  -810891304}, { -705073155,  -809810688}, 
+	{ -696337036,  -817334838}, { -697589992,  -816265709}, { -698841307,  -815194659}, { -700090977,  -814121692}, 
+	{ -691308855,  -821592095}, { -692568348,  -820530675}, { -693826211,  -819467323}, { -695082441,  -818402043}, 
+	{ -686254647,  -825818421}, { -687520629,  -824764748}, { -688784993,  -823709135}, { -690047736,  -822651583}, 
+	{ -681174602,  -830013654}, { -682447025,  -828967769}, { -683717842,  -827919934}, { -684987051,  -826870150}, 
+	{ -676068911,  -834177638}, { -677347728,  -833139580}, { -678624950,  -832099562}, { -679900576,  -831057586}, 
+	{ -670937767,  -838310216}, { -672222928,  -837280024}, { -673506508,  -836247863}, { -674788504,  -835213733}, 
+	{ -665781362,  -842411232}, { -667072820,  -841388945}, { -668362709,  -840364679}, { -669651026,  -839338435}, 
+	{ -660599890,  -846480531}, { -661897597,  -845466188}, { -663193747,  -844449856}, { -664488336,  -843431536}, 
+	{ -655393548,  -850517961}, { -656697454,  -849511600}, { -657999816,  -848503239}, { -659300629,  -847492882}, 
+	{ -650162530,  -854523370}, { -651472587,  -853525028}, { -652781111,  -852524677}, { -654088099,  -851522321}, 
+	{ -644907034,  -858496606}, { -646223192,  -857506321}, { -647537830,  -856514019}, { -648850943,  -855519701}, 
+	{ -639627258,  -862437520}, { -640949467,  -861455330}, { -642270169,  -860471112}, { -643589359,  -859484870}, 
+	{ -634323400,  -866345964}, { -635651611,  -865371905}, { -636978327,  -864395810}, { -638303543,  -863417681}, 
+	{ -628995660,  -870221790}, { -630329823,  -869255900}, { -631662503,  -868287963}, { -632993696,  -867317984}, 
+	{ -623644239,  -874064853}, { -624984303,  -873107167}, { -626322897,  -872147426}, { -627660017,  -871185633}, 
+	{ -618269338,  -877875009}, { -619615253,  -876925563}, { -620959711,  -875974054}, { -622302707,  -875020483}, 
+	{ -612871159,  -881652112}, { -614222875,  -880710943}, { -615573145,  -879767701}, { -616921967,  -878822389}, 
+	{ -607449906,  -885396022}, { -608807372,  -884463164}, { -610163404,  -883528225}, { -611518001,  -882591207}, 
+	{ -602005783,  -889106597}, { -603368947,  -888182086}, { -604730691,  -887255485}, { -606091012,  -886326796}, 
+	{ -596538995,  -892783698}, { -597907806,  -891867569}, { -599275210,  -890949341}, { -600641203,  -890029016}, 
+	{ -591049748,  -896427186}, { -592424154,  -895519473}, { -593797166,  -894609652}, { -595168781,  -893697727}, 
+	{ -585538248,  -900036924}, { -586918198,  -899137661}, { -588296766,  -898236282}, { -589673951,  -897332790}, 
+	{ -580004702,  -903612776}, { -581390144,  -902721998}, { -582774218,  -901829095}, { -584156920,  -900934069}, 
+	{ -574449320,  -907154608}, { -575840202,  -906272347}, { -577229728,  -905387953}, { -578617896,  -904501429}, 
+	{ -568872310,  -910662286}, { -570268579,  -909788576}, { -571663506,  -908912725}, { -573057087,  -908034735}, 
+	{ -563273883,  -914135678}, { -564675486,  -913270551}, { -566075761,  -912403276}, { -567474703,  -911533853}, 
+	{ -557654248,  -917574653}, { -559061133,  -916718143}, { -560466703,  -915859476}, { -561870954,  -914998653}, 
+	{ -552013618,  -920979082}, { -553425732,  -920131221}, { -554836544,  -919281194}, { -556246051,  -918429004}, 
+	{ -546352205,  -924348837}, { -547769495,  -923509656}, { -549185496,  -922668302}, { -550600205,  -921824777}, 
+	{ -540670223,  -927683790}, { -542092635,  -926853322}, { -543513772,  -926020672}, { -544933630,  -925185843}, 
+	{ -534967884,  -930983817}, { -536395365,  -930162092}, { -537821584,  -929338177}, { -539246538,  -928512076}, 
+	{ -529245404,  -934248793}, { -530677900,  -933435842}, { -532109148,  -932620694}, { -533539144,  -931803352}, 
+	{ -523502998,  -937478595}, { -524940456,  -936674448}, { -526376678,  -935868098}, { -527811662,  -935059546}, 
+	{ -517740883,  -940673101}, { -519183248,  -939877790}, { -520624391,  -939080267}, { -522064309,  -938280535}, 
+	{ -511959275,  -943832191}, { -513406493,  -943045745}, { -514852502,  -942257081}, { -516297300,  -941466198}, 
+	{ -506158392,  -946955747}, { -507610408,  -946178196}, { -509061229,  -945398418}, { -510510853,  -944616416}, 
+	{ -500338453,  -950043650}, { -501795212,  -949275023}, { -503250791,  -948504163}, { -504705185,  -947731070}, 
+	{ -494499676,  -953095785}, { -495961124,  -952336111}, { -497421405,  -951574196}, { -498880516,  -950810042}, 
+	{ -488642281,  -956112036}, { -490108363,  -955361344}, { -491573292,  -954608403}, { -493037064,  -953853216}, 
+	{ -482766489,  -959092290}, { -484237150,  -958350608}, { -485706671,  -957606670}, { -487175049,  -956860479}, 
+	{ -476872522,  -962036435}, { -478347705,  -961303790}, { -479821764,  -960568883}, { -481294693,  -959831716}, 
+	{ -470960600,  -964944360}, { -472440251,  -964220780}, { -473918791,  -963494932}, { -475396216,  -962766816}, 
+	{ -465030947,  -967815955}, { -466515010,  -967101468}, { -467997976,  -966384706}, { -469479840,  -965665669}, 
+	{ -459083786,  -970651112}, { -460572205,  -969945745}, { -462059541,  -969238095}, { -463545789,  -968528165}, 
+	{ -453119340,  -973449725}, { -454612060,  -972753504}, { -456103710,  -972054994}, { -457594286,  -971354196}, 
+	{ -447137835,  -976211688}, { -448634799,  -975524639}, { -450130706,  -974835295}, { -451625555,  -974143656}, 
+	{ -441139496,  -978936898}, { -442640647,  -978259047}, { -444140756,  -977578894}, { -445639820,  -976896441}, 
+	{ -435124548,  -981625251}, { -436629829,  -980956623}, { -438134084,  -980285688}, { -439637307,  -979612445}, 
+	{ -429093217,  -984276646}, { -430602573,  -983617267}, { -432110916,  -982955574}, { -433618242,  -982291568}, 
+	{ -423045732,  -986890984}, { -424559105,  -986240879}, { -426071480,  -985588453}, { -427582852,  -984933708}, 
+	{ -416982319,  -989468165}, { -418499653,  -988827359}, { -420016002,  -988184225}, { -421531363,  -987538766}, 
+	{ -410903207,  -992008094}, { -412424444,  -991376610}, { -413944711,  -990742793}, { -415464004,  -990106644}, 
+	{ -404808624,  -994510675}, { -406333708,  -993888536}, { -407857835,  -993264059}, { -409381002,  -992637245}, 
+	{ -398698801,  -996975812}, { -400227673,  -996363043}, { -401755603,  -995747930}, { -403282588,  -995130473}, 
+	{ -392573967,  -999403415}, { -394106570,  -998800038}, { -395638246,  -998194311}, { -397168991,  -997586236}, 
+	{ -386434353, -1001793390}, { -387970630, -1001199428}, { -389505993, -1000603111}, { -391040440, -1000004439}, 
+	{ -380280190, -1004145648}, { -381820082, -1003561124}, { -383359076, -1002974239}, { -384897167, -1002384994}, 
+	{ -374111709, -1006460100}, { -375655159, -1005885036}, { -377197725, -1005307605}, { -378739403, -1004727809}, 
+	{ -367929144, -1008736660}, { -369476093, -1008171077}, { -371022173, -1007603122}, { -372567379, -1007032796}, 
+	{ -361732726, -1010975242}, { -363283116, -1010419162}, { -364832652, -1009860704}, { -366381329, -1009299870}, 
+	{ -355522689, -1013175761}, { -357076462, -1012629204}, { -358629395, -1012080264}, { -360181484, -1011528943}, 
+	{ -349299266, -1015338134}, { -350856364, -1014801122}, { -352412636, -1014261721}, { -353968079, -1013719934}, 
+	{ -343062693, -1017462281}, { -344623057, -1016934832}, { -346182609, -1016404991}, { -347741347, -1015872758}, 
+	{ -336813204, -1019548121}, { -338376774, -1019030256}, { -339939549, -1018509994}, { -341501523, -1017987335}, 
+	{ -330551034, -1021595575}, { -332117752, -1021087314}, { -333683689, -1020576651}, { -335248841, -1020063586}, 
+	{ -324276419, -1023604567}, { -325846226, -1023105929}, { -327415267, -1022604883}, { -328983538, -1022101432}, 
+	{ -317989595, -1025575020}, { -319562433, -1025086024}, { -321134518, -1024594615}, { -322705848, -1024100796}, 
+	{ -311690799, -1027506862}, { -313266607, -1027027525}, { -314841679, -1026545772}, { -316416009, -1026061603}, 
+	{ -305380268, -1029400018}, { -306958988, -1028930359}, { -308536985, -1028458280}, { -310114257, -1027983780}, 
+	{ -299058239, -1031254418}, { -300639811, -1030794455}, { -302220676, -1030332067}, { -303800829, -1029867254}, 
+	{ -292724951, -1033069992}, { -294309316, -1032619742}, { -295892988, -1032167062}, { -297475964, -1031711954}, 
+	{ -286380643, -1034846671}, { -287967740, -1034406151}, { -289554160, -1033963197}, { -291139898, -1033517810}, 
+	{ -280025552, -1036584389}, { -281615322, -1036153615}, { -283204430, -1035720404}, { -284792871, -1035284755}, 
+	{ -273659918, -1038283080}, { -275252302, -1037862069}, { -276844038, -1037438617}, { -278435122, -1037012723}, 
+	{ -267283981, -1039942680}, { -268878918, -1039531448}, { -270473223, -1039117770}, { -272066891, -1038701647}, 
+	{ -260897982, -1041563127}, { -262495412, -1041161689}, { -264092224, -1040757802}, { -265688415, -1040351465}, 
+	{ -254502159, -1043144360}, { -256102022, -1042752731}, { -257701283, -1042358649}, { -259299937, -1041962114}, 
+	{ -248096755, -1044686319}, { -249698991, -1044304514}, { -251300640, -1043920252}, { -252901697, -1043533534}, 
+	{ -241682010, -1046188946}, { -243286558, -1045816980}, { -244890535, -1045442553}, { -246493935, -1045065665}, 
+	{ -235258165, -1047652185}, { -236864966, -1047290071}, { -238471210, -1046925492}, { -240076892, -1046558451}, 
+	{ -228825464, -1049075980}, { -230434456, -1048723732}, { -232042906, -1048369016}, { -233650811, -1048011834}, 
+	{ -222384147, -1050460278}, { -223995270, -1050117909}, { -225605867, -1049773069}, { -227215933, -1049425759}, 
+	{ -215934457, -1051805027}, { -217547651, -1051472550}, { -219160334, -1051137599}, { -220772500, -1050800175}, 
+	{ -209476638, -1053110176}, { -211091842, -1052787604}, { -212706549, -1052462555}, { -214320755, -1052135029}, 
+	{ -203010932, -1054375676}, { -204628085, -1054063021}, { -206244756, -1053747885}, { -207860942, -1053430270}, 
+	{ -196537583, -1055601479}, { -198156624, -1055298753}, { -199775198, -1054993543}, { -201393302, -1054685850}, 
+	{ -190056834, -1056787540}, { -191677702, -1056494753}, { -193298119, -1056199480}, { -194918080, -1055901722}, 
+	{ -183568930, -1057933813}, { -185191564, -1057650977}, { -186813762, -1057365653}, { -188435520, -1057077840}, 
+	{ -177074115, -1059040255}, { -178698453, -1058767381}, { -180322371, -1058492016}, { -181945865, -1058214159}, 
+	{ -170572633, -1060106826}, { -172198615, -1059843923}, { -173824192, -1059578527}, { -175449360, -1059310638}, 
+	{ -164064728, -1061133483}, { -165692293, -1060880563}, { -167319468, -1060625146}, { -168946249, -1060367233}, 
+	{ -157550647, -1062120190}, { -159179733, -1061877261}, { -160808445, -1061631833}, { -162436778, -1061383907}, 
+	{ -151030634, -1063066909}, { -152661180, -1062833980}, { -154291367, -1062598550}, { -155921191, -1062360620}, 
+	{ -144504935, -1063973603}, { -146136880, -1063750684}, { -147768480, -1063525261}, { -149399733, -1063297336}, 
+	{ -137973796, -1064840240}, { -139607077, -1064627338}, { -141240030, -1064411931}, { -142872651, -1064194019}, 
+	{ -131437462, -1065666786}, { -133072019, -1065463909}, { -134706263, -1065258526}, { -136340190, -1065050636}, 
+	{ -124896179, -1066453210}, { -126531950, -1066260367}, { -128167423, -1066065015}, { -129802595, -1065867154}, 
+	{ -118350194, -1067199483}, { -119987118, -1067016680}, { -121623759, -1066831367}, { -123260114, -1066643544}, 
+	{ -111799753, -1067905576}, { -113437768, -1067732821}, { -115075515, -1067557554}, { -116712992, -1067379774}, 
+	{ -105245103, -1068571464}, { -106884147, -1068408763}, { -108522939, -1068243547}, { -110161476, -1068075818}, 
+	{  -98686491, -1069197120}, { -100326502, -1069044479}, { -101966277, -1068889322}, { -103605812, -1068731650}, 
+	{  -92124163, -1069782521}, {  -93765079, -1069639946}, {  -95405776, -1069494854}, {  -97046247, -1069347245}, 
+	{  -85558366, -1070327646}, {  -87200127, -1070195142}, {  -88841683, -1070060120}, {  -90483029, -1069922579}, 
+	{  -78989349, -1070832474}, {  -80631892, -1070710046}, {  -82274245, -1070585099}, {  -83916404, -1070457632}, 
+	{  -72417357, -1071296985}, {  -74060620, -1071184638}, {  -75703709, -1071069770}, {  -77346620, -1070952382}, 
+	{  -65842639, -1071721163}, {  -67486561, -1071618901}, {  -69130324, -1071514117}, {  -70773924, -1071406812}, 
+	{  -59265442, -1072104991}, {  -60909960, -1072012818}, {  -62554335, -1071918122}, {  -64198563, -1071820903}, 
+	{  -52686014, -1072448455}, {  -54331067, -1072366374}, {  -55975992, -1072281769}, {  -57620785, -1072194642}, 
+	{  -46104602, -1072751542}, {  -47750128, -1072679556}, {  -49395541, -1072605046}, {  -51040837, -1072528012}, 
+	{  -39521455, -1073014240}, {  -41167391, -1072952352}, {  -42813230, -1072887940}, {  -44458968, -1072821003}, 
+	{  -32936819, -1073236540}, {  -34583104, -1073184753}, {  -36229307, -1073130440}, {  -37875426, -1073073603}, 
+	{  -26350943, -1073418433}, {  -27997515, -1073376748}, {  -29644021, -1073332538}, {  -31290457, -1073285802}, 
+	{  -19764076, -1073559913}, {  -21410872, -1073528332}, {  -23057618, -1073494225}, {  -24704310, -1073457592}, 
+	{  -13176464, -1073660973}, {  -14823423, -1073639498}, {  -16470347, -1073615496}, {  -18117233, -1073588967}, 
+	{   -6588356, -1073721611}, {   -8235416, -1073710241}, {   -9882456, -1073696345}, {  -11529474, -1073679922}, 
+	{          0, -1073741824}, {   -1647099, -1073740561}, {   -3294193, -1073736771}, {   -4941281, -1073730454}, 
+	{    6588356, -1073721611}, {    4941281, -1073730454}, {    3294193, -1073736771}, {    1647099, -1073740561}, 
+	{   13176464, -1073660973}, {   11529474, -1073679922}, {    9882456, -1073696345}, {    8235416, -1073710241}, 
+	{   19764076, -1073559913}, {   18117233, -1073588967}, {   16470347, -1073615496}, {   14823423, -1073639498}, 
+	{   26350943, -1073418433}, {   24704310, -1073457592}, {   23057618, -1073494225}, {   21410872, -1073528332}, 
+	{   32936819, -1073236540}, {   31290457, -1073285802}, {   29644021, -1073332538}, {   27997515, -1073376748}, 
+	{   39521455, -1073014240}, {   37875426, -1073073603}, {   36229307, -1073130440}, {   34583104, -1073184753}, 
+	{   46104602, -1072751542}, {   44458968, -1072821003}, {   42813230, -1072887940}, {   41167391, -1072952352}, 
+	{   52686014, -1072448455}, {   51040837, -1072528012}, {   49395541, -1072605046}, {   47750128, -1072679556}, 
+	{   59265442, -1072104991}, {   57620785, -1072194642}, {   55975992, -1072281769}, {   54331067, -1072366374}, 
+	{   65842639, -1071721163}, {   64198563, -1071820903}, {   62554335, -1071918122}, {   60909960, -1072012818}, 
+	{   72417357, -1071296985}, {   70773924, -1071406812}, {   69130324, -1071514117}, {   67486561, -1071618901}, 
+	{   78989349, -1070832474}, {   77346620, -1070952382}, {   75703709, -1071069770}, {   74060620, -1071184638}, 
+	{   85558366, -1070327646}, {   83916404, -1070457632}, {   82274245, -1070585099}, {   80631892, -1070710046}, 
+	{   92124163, -1069782521}, {   90483029, -1069922579}, {   88841683, -1070060120}, {   87200127, -1070195142}, 
+	{   98686491, -1069197120}, {   97046247, -1069347245}, {   95405776, -1069494854}, {   93765079, -1069639946}, 
+	{  105245103, -1068571464}, {  103605812, -1068731650}, {  101966277, -1068889322}, {  100326502, -1069044479}, 
+	{  111799753, -1067905576}, {  110161476, -1068075818}, {  108522939, -1068243547}, {  106884147, -1068408763}, 
+	{  118350194, -1067199483}, {  116712992, -1067379774}, {  115075515, -1067557554}, {  113437768, -1067732821}, 
+	{  124896179, -1066453210}, {  123260114, -1066643544}, {  121623759, -1066831367}, {  119987118, -1067016680}, 
+	{  131437462, -1065666786}, {  129802595, -1065867154}, {  128167423, -1066065015}, {  126531950, -1066260367}, 
+	{  137973796, -1064840240}, {  136340190, -1065050636}, {  134706263, -1065258526}, {  133072019, -1065463909}, 
+	{  144504935, -1063973603}, {  142872651, -1064194019}, {  141240030, -1064411931}, {  139607077, -1064627338}, 
+	{  151030634, -1063066909}, {  149399733, -1063297336}, {  147768480, -1063525261}, {  146136880, -1063750684}, 
+	{  157550647, -1062120190}, {  155921191, -1062360620}, {  154291367, -1062598550}, {  152661180, -1062833980}, 
+	{  164064728, -1061133483}, {  162436778, -1061383907}, {  160808445, -1061631833}, {  159179733, -1061877261}, 
+	{  170572633, -1060106826}, {  168946249, -1060367233}, {  167319468, -1060625146}, {  165692293, -1060880563}, 
+	{  177074115, -1059040255}, {  175449360, -1059310638}, {  173824192, -1059578527}, {  172198615, -1059843923}, 
+	{  183568930, -1057933813}, {  181945865, -1058214159}, {  180322371, -1058492016}, {  178698453, -1058767381}, 
+	{  190056834, -1056787540}, {  188435520, -1057077840}, {  186813762, -1057365653}, {  185191564, -1057650977}, 
+	{  196537583, -1055601479}, {  194918080, -1055901722}, {  193298119, -1056199480}, {  191677702, -1056494753}, 
+	{  203010932, -1054375676}, {  201393302, -1054685850}, {  199775198, -1054993543}, {  198156624, -1055298753}, 
+	{  209476638, -1053110176}, {  207860942, -1053430270}, {  206244756, -1053747885}, {  204628085, -1054063021}, 
+	{  215934457, -1051805027}, {  214320755, -1052135029}, {  212706549, -1052462555}, {  211091842, -1052787604}, 
+	{  222384147, -1050460278}, {  220772500, -1050800175}, {  219160334, -1051137599}, {  217547651, -1051472550}, 
+	{  228825464, -1049075980}, {  227215933, -1049425759}, {  225605867, -1049773069}, {  223995270, -1050117909}, 
+	{  235258165, -1047652185}, {  233650811, -1048011834}, {  232042906, -1048369016}, {  230434456, -1048723732}, 
+	{  241682010, -1046188946}, {  240076892, -1046558451}, {  238471210, -1046925492}, {  236864966, -1047290071}, 
+	{  248096755, -1044686319}, {  246493935, -1045065665}, {  244890535, -1045442553}, {  243286558, -1045816980}, 
+	{  254502159, -1043144360}, {  252901697, -1043533534}, {  251300640, -1043920252}, {  249698991, -1044304514}, 
+	{  260897982, -1041563127}, {  259299937, -1041962114}, {  257701283, -1042358649}, {  256102022, -1042752731}, 
+	{  267283981, -1039942680}, {  265688415, -1040351465}, {  264092224, -1040757802}, {  262495412, -1041161689}, 
+	{  273659918, -1038283080}, {  272066891, -1038701647}, {  270473223, -1039117770}, {  268878918, -1039531448}, 
+	{  280025552, -1036584389}, {  278435122, -1037012723}, {  276844038, -1037438617}, {  275252302, -1037862069}, 
+	{  286380643, -1034846671}, {  284792871, -1035284755}, {  283204430, -1035720404}, {  281615322, -1036153615}, 
+	{  292724951, -1033069992}, {  291139898, -1033517810}, {  289554160, -1033963197}, {  287967740, -1034406151}, 
+	{  299058239, -1031254418}, {  297475964, -1031711954}, {  295892988, -1032167062}, {  294309316, -1032619742}, 
+	{  305380268, -1029400018}, {  303800829, -1029867254}, {  302220676, -1030332067}, {  300639811, -1030794455}, 
+	{  311690799, -1027506862}, {  310114257, -1027983780}, {  308536985, -1028458280}, {  306958988, -1028930359}, 
+	{  317989595, -1025575020}, {  316416009, -1026061603}, {  314841679, -1026545772}, {  313266607, -1027027525}, 
+	{  324276419, -1023604567}, {  322705848, -1024100796}, {  321134518, -1024594615}, {  319562433, -1025086024}, 
+	{  330551034, -1021595575}, {  328983538, -1022101432}, {  327415267, -1022604883}, {  325846226, -1023105929}, 
+	{  336813204, -1019548121}, {  335248841, -1020063586}, {  333683689, -1020576651}, {  332117752, -1021087314}, 
+	{  343062693, -1017462281}, {  341501523, -1017987335}, {  339939549, -1018509994}, {  338376774, -1019030256}, 
+	{  349299266, -1015338134}, {  347741347, -1015872758}, {  346182609, -1016404991}, {  344623057, -1016934832}, 
+	{  355522689, -1013175761}, {  353968079, -1013719934}, {  352412636, -1014261721}, {  350856364, -1014801122}, 
+	{  361732726, -1010975242}, {  360181484, -1011528943}, {  358629395, -1012080264}, {  357076462, -1012629204}, 
+	{  367929144, -1008736660}, {  366381329, -1009299870}, {  364832652, -1009860704}, {  363283116, -1010419162}, 
+	{  374111709, -1006460100}, {  372567379, -1007032796}, {  371022173, -1007603122}, {  369476093, -1008171077}, 
+	{  380280190, -1004145648}, {  378739403, -1004727809}, {  377197725, -1005307605}, {  375655159, -1005885036}, 
+	{  386434353, -1001793390}, {  384897167, -1002384994}, {  383359076, -1002974239}, {  381820082, -1003561124}, 
+	{  392573967,  -999403415}, {  391040440, -1000004439}, {  389505993, -1000603111}, {  387970630, -1001199428}, 
+	{  398698801,  -996975812}, {  397168991,  -997586236}, {  395638246,  -998194311}, {  394106570,  -998800038}, 
+	{  404808624,  -994510675}, {  403282588,  -995130473}, {  401755603,  -995747930}, {  400227673,  -996363043}, 
+	{  410903207,  -992008094}, {  409381002,  -992637245}, {  407857835,  -993264059}, {  406333708,  -993888536}, 
+	{  416982319,  -989468165}, {  415464004,  -990106644}, {  413944711,  -990742793}, {  412424444,  -991376610}, 
+	{  423045732,  -986890984}, {  421531363,  -987538766}, {  420016002,  -988184225}, {  418499653,  -988827359}, 
+	{  429093217,  -984276646}, {  427582852,  -984933708}, {  426071480,  -985588453}, {  424559105,  -986240879}, 
+	{  435124548,  -981625251}, {  433618242,  -982291568}, {  432110916,  -982955574}, {  430602573,  -983617267}, 
+	{  441139496,  -978936898}, {  439637307,  -979612445}, {  438134084,  -980285688}, {  436629829,  -980956623}, 
+	{  447137835,  -976211688}, {  445639820,  -976896441}, {  444140756,  -977578894}, {  442640647,  -978259047}, 
+	{  453119340,  -973449725}, {  451625555,  -974143656}, {  450130706,  -974835295}, {  448634799,  -975524639}, 
+	{  459083786,  -970651112}, {  457594286,  -971354196}, {  456103710,  -972054994}, {  454612060,  -972753504}, 
+	{  465030947,  -967815955}, {  463545789,  -968528165}, {  462059541,  -969238095}, {  460572205,  -969945745}, 
+	{  470960600,  -964944360}, {  469479840,  -965665669}, {  467997976,  -966384706}, {  466515010,  -967101468}, 
+	{  476872522,  -962036435}, {  475396216,  -962766816}, {  473918791,  -963494932}, {  472440251,  -964220780}, 
+	{  482766489,  -959092290}, {  481294693,  -959831716}, {  479821764,  -960568883}, {  478347705,  -961303790}, 
+	{  488642281,  -956112036}, {  487175049,  -956860479}, {  485706671,  -957606670}, {  484237150,  -958350608}, 
+	{  494499676,  -953095785}, {  493037064,  -953853216}, {  491573292,  -954608403}, {  490108363,  -955361344}, 
+	{  500338453,  -950043650}, {  498880516,  -950810042}, {  497421405,  -951574196}, {  495961124,  -952336111}, 
+	{  506158392,  -946955747}, {  504705185,  -947731070}, {  503250791,  -948504163}, {  501795212,  -949275023}, 
+	{  511959275,  -943832191}, {  510510853,  -944616416}, {  509061229,  -945398418}, {  507610408,  -946178196}, 
+	{  517740883,  -940673101}, {  516297300,  -941466198}, {  514852502,  -942257081}, {  513406493,  -943045745}, 
+	{  523502998,  -937478595}, {  522064309,  -938280535}, {  520624391,  -939080267}, {  519183248,  -939877790}, 
+	{  529245404,  -934248793}, {  527811662,  -935059546}, {  526376678,  -935868098}, {  524940456,  -936674448}, 
+	{  534967884,  -930983817}, {  533539144,  -931803352}, {  532109148,  -932620694}, {  530677900,  -933435842}, 
+	{  540670223,  -927683790}, {  539246538,  -928512076}, {  537821584,  -929338177}, {  536395365,  -930162092}, 
+	{  546352205,  -924348837}, {  544933630,  -925185843}, {  543513772,  -926020672}, {  542092635,  -926853322}, 
+	{  552013618,  -920979082}, {  550600205,  -921824777}, {  549185496,  -922668302}, {  547769495,  -923509656}, 
+	{  557654248,  -917574653}, {  556246051,  -918429004}, {  554836544,  -919281194}, {  553425732,  -920131221}, 
+	{  563273883,  -914135678}, {  561870954,  -914998653}, {  560466703,  -915859476}, {  559061133,  -916718143}, 
+	{  568872310,  -910662286}, {  567474703,  -911533853}, {  566075761,  -912403276}, {  564675486,  -913270551}, 
+	{  574449320,  -907154608}, {  573057087,  -908034735}, {  571663506,  -908912725}, {  570268579,  -909788576}, 
+	{  580004702,  -903612776}, {  578617896,  -904501429}, {  577229728,  -905387953}, {  575840202,  -906272347}, 
+	{  585538248,  -900036924}, {  584156920,  -900934069}, {  582774218,  -901829095}, {  581390144,  -902721998}, 
+	{  591049748,  -896427186}, {  589673951,  -897332790}, {  588296766,  -898236282}, {  586918198,  -899137661}, 
+	{  596538995,  -892783698}, {  595168781,  -893697727}, {  593797166,  -894609652}, {  592424154,  -895519473}, 
+	{  602005783,  -889106597}, {  600641203,  -890029016}, {  599275210,  -890949341}, {  597907806,  -891867569}, 
+	{  607449906,  -885396022}, {  606091012,  -886326796}, {  604730691,  -887255485}, {  603368947,  -888182086}, 
+	{  612871159,  -881652112}, {  611518001,  -882591207}, {  610163404,  -883528225}, {  608807372,  -884463164}, 
+	{  618269338,  -877875009}, {  616921967,  -878822389}, {  615573145,  -879767701}, {  614222875,  -880710943}, 
+	{  623644239,  -874064853}, {  622302707,  -875020483}, {  620959711,  -875974054}, {  619615253,  -876925563}, 
+	{  628995660,  -870221790}, {  627660017,  -871185633}, {  626322897,  -872147426}, {  624984303,  -873107167}, 
+	{  634323400,  -866345964}, {  632993696,  -867317984}, {  631662503,  -868287963}, {  630329823,  -869255900}, 
+	{  639627258,  -862437520}, {  638303543,  -863417681}, {  636978327,  -864395810}, {  635651611,  -865371905}, 
+	{  644907034,  -858496606}, {  643589359,  -859484870}, {  642270169,  -860471112}, {  640949467,  -861455330}, 
+	{  650162530,  -854523370}, {  648850943,  -855519701}, {  647537830,  -856514019}, {  646223192,  -857506321}, 
+	{  655393548,  -850517961}, {  654088099,  -851522321}, {  652781111,  -852524677}, {  651472587,  -853525028}, 
+	{  660599890,  -846480531}, {  659300629,  -847492882}, {  657999816,  -848503239}, {  656697454,  -849511600}, 
+	{  665781362,  -842411232}, {  664488336,  -843431536}, {  663193747,  -844449856}, {  661897597,  -845466188}, 
+	{  670937767,  -838310216}, {  669651026,  -839338435}, {  668362709,  -840364679}, {  667072820,  -841388945}, 
+	{  676068911,  -834177638}, {  674788504,  -835213733}, {  673506508,  -836247863}, {  672222928,  -837280024}, 
+	{  681174602,  -830013654}, {  679900576,  -831057586}, {  678624950,  -832099562}, {  677347728,  -833139580}, 
+	{  686254647,  -825818421}, {  684987051,  -826870150}, {  683717842,  -827919934}, {  682447025,  -828967769}, 
+	{  691308855,  -821592095}, {  690047736,  -822651583}, {  688784993,  -823709135}, {  687520629,  -824764748}, 
+	{  696337036,  -817334838}, {  695082441,  -818402043}, {  693826211,  -819467323}, {  692568348,  -820530675}, 
+	{  701339000,  -813046808}, {  700090977,  -814121692}, {  698841307,  -815194659}, {  697589992,  -816265709}, 
+	{  706314559,  -808728167}, {  705073155,  -809810688}, {  703830092,  -810891304}, {  702585372,  -811970011}, 
+	{  711263525,  -804379079}, {  710028787,  -805469196}, {  708792378,  -806557419}, {  707554301,  -807643743}, 
+	{  716185713,  -799999706}, {  714957687,  -801097379}, {  713727978,  -802193167}, {  712496590,  -803287068}, 
+	{  721080937,  -795590213}, {  719859669,  -796695401}, {  718636707,  -797798714}, {  717412054,  -798900150}, 
+	{  725949013,  -791150767}, {  724734549,  -792263427}, {  723518380,  -793374223}, {  722300508,  -794483153}, 
+	{  730789757,  -786681534}, {  729582143,  -787801625}, {  728372813,  -788919863}, {  727161768,  -790036244}, 
+	{  735602987,  -782182683}, {  734402269,  -783310163}, {  733199822,  -784435800}, {  731995651,  -785559591}, 
+	{  740388522,  -777654384}, {  739194745,  -778789210}, {  737999228,  -779922204}, {  736801974,  -781053363}, 
+	{  745146182,  -773096806}, {  743959390,  -774238936}, {  742770848,  -775379244}, {  741580558,  -776517728}, 
+	{  749875788,  -768510122}, {  748696026,  -769659512}, {  747514503,  -770807092}, {  746331221,  -771952857}, 
+	{  754577161,  -763894504}, {  753404474,  -765051111}, {  752230015,  -766205919}, {  751053785,  -767358923}, 
+	{  759250125,  -759250125}, {  758084557,  -760413906}, {  756917205,  -761575898}, {  755748072,  -762736098}, 
+	{  763894504,  -754577161}, {  762736098,  -755748072}, {  761575898,  -756917205}, {  760413906,  -758084557}, 
+	{  768510122,  -749875788}, {  767358923,  -751053785}, {  766205919,  -752230015}, {  765051111,  -753404474}, 
+	{  773096806,  -745146182}, {  771952857,  -746331221}, {  770807092,  -747514503}, {  769659512,  -748696026}, 
+	{  777654384,  -740388522}, {  776517728,  -741580558}, {  775379244,  -742770848}, {  774238936,  -743959390}, 
+	{  782182683,  -735602987}, {  781053363,  -736801974}, {  779922204,  -737999228}, {  778789210,  -739194745}, 
+	{  786681534,  -730789757}, {  785559591,  -731995651}, {  784435800,  -733199822}, {  783310163,  -734402269}, 
+	{  791150767,  -725949013}, {  790036244,  -727161768}, {  788919863,  -728372813}, {  787801625,  -729582143}, 
+	{  795590213,  -721080937}, {  794483153,  -722300508}, {  793374223,  -723518380}, {  792263427,  -724734549}, 
+	{  799999706,  -716185713}, {  798900150,  -717412054}, {  797798714,  -718636707}, {  796695401,  -719859669}, 
+	{  804379079,  -711263525}, {  803287068,  -712496590}, {  802193167,  -713727978}, {  801097379,  -714957687}, 
+	{  808728167,  -706314559}, {  807643743,  -707554301}, {  806557419,  -708792378}, {  805469196,  -710028787}, 
+	{  813046808,  -701339000}, {  811970011,  -702585372}, {  810891304,  -703830092}, {  809810688,  -705073155}, 
+	{  817334838,  -696337036}, {  816265709,  -697589992}, {  815194659,  -698841307}, {  814121692,  -700090977}, 
+	{  821592095,  -691308855}, {  820530675,  -692568348}, {  819467323,  -693826211}, {  818402043,  -695082441}, 
+	{  825818421,  -686254647}, {  824764748,  -687520629}, {  823709135,  -688784993}, {  822651583,  -690047736}, 
+	{  830013654,  -681174602}, {  828967769,  -682447025}, {  827919934,  -683717842}, {  826870150,  -684987051}, 
+	{  834177638,  -676068911}, {  833139580,  -677347728}, {  832099562,  -678624950}, {  831057586,  -679900576}, 
+	{  838310216,  -670937767}, {  837280024,  -672222928}, {  836247863,  -673506508}, {  835213733,  -674788504}, 
+	{  842411232,  -665781362}, {  841388945,  -667072820}, {  840364679,  -668362709}, {  839338435,  -669651026}, 
+	{  846480531,  -660599890}, {  845466188,  -661897597}, {  844449856,  -663193747}, {  843431536,  -664488336}, 
+	{  850517961,  -655393548}, {  849511600,  -656697454}, {  848503239,  -657999816}, {  847492882,  -659300629}, 
+	{  854523370,  -650162530}, {  853525028,  -651472587}, {  852524677,  -652781111}, {  851522321,  -654088099}, 
+	{  858496606,  -644907034}, {  857506321,  -646223192}, {  856514019,  -647537830}, {  855519701,  -648850943}, 
+	{  862437520,  -639627258}, {  861455330,  -640949467}, {  860471112,  -642270169}, {  859484870,  -643589359}, 
+	{  866345964,  -634323400}, {  865371905,  -635651611}, {  864395810,  -636978327}, {  863417681,  -638303543}, 
+	{  870221790,  -628995660}, {  869255900,  -630329823}, {  868287963,  -631662503}, {  867317984,  -632993696}, 
+	{  874064853,  -623644239}, {  873107167,  -624984303}, {  872147426,  -626322897}, {  871185633,  -627660017}, 
+	{  877875009,  -618269338}, {  876925563,  -619615253}, {  875974054,  -620959711}, {  875020483,  -622302707}, 
+	{  881652112,  -612871159}, {  880710943,  -614222875}, {  879767701,  -615573145}, {  878822389,  -616921967}, 
+	{  885396022,  -607449906}, {  884463164,  -608807372}, {  883528225,  -610163404}, {  882591207,  -611518001}, 
+	{  889106597,  -602005783}, {  888182086,  -603368947}, {  887255485,  -604730691}, {  886326796,  -606091012}, 
+	{  892783698,  -596538995}, {  891867569,  -597907806}, {  890949341,  -599275210}, {  890029016,  -600641203}, 
+	{  896427186,  -591049748}, {  895519473,  -592424154}, {  894609652,  -593797166}, {  893697727,  -595168781}, 
+	{  900036924,  -585538248}, {  899137661,  -586918198}, {  898236282,  -588296766}, {  897332790,  -589673951}, 
+	{  903612776,  -580004702}, {  902721998,  -581390144}, {  901829095,  -582774218}, {  900934069,  -584156920}, 
+	{  907154608,  -574449320}, {  906272347,  -575840202}, {  905387953,  -577229728}, {  904501429,  -578617896}, 
+	{  910662286,  -568872310}, {  909788576,  -570268579}, {  908912725,  -571663506}, {  908034735,  -573057087}, 
+	{  914135678,  -563273883}, {  913270551,  -564675486}, {  912403276,  -566075761}, {  911533853,  -567474703}, 
+	{  917574653,  -557654248}, {  916718143,  -559061133}, {  915859476,  -560466703}, {  914998653,  -561870954}, 
+	{  920979082,  -552013618}, {  920131221,  -553425732}, {  919281194,  -554836544}, {  918429004,  -556246051}, 
+	{  924348837,  -546352205}, {  923509656,  -547769495}, {  922668302,  -549185496}, {  921824777,  -550600205}, 
+	{  927683790,  -540670223}, {  926853322,  -542092635}, {  926020672,  -543513772}, {  925185843,  -544933630}, 
+	{  930983817,  -534967884}, {  930162092,  -536395365}, {  929338177,  -537821584}, {  928512076,  -539246538}, 
+	{  934248793,  -529245404}, {  933435842,  -530677900}, {  932620694,  -532109148}, {  931803352,  -533539144}, 
+	{  937478595,  -523502998}, {  936674448,  -524940456}, {  935868098,  -526376678}, {  935059546,  -527811662}, 
+	{  940673101,  -517740883}, {  939877790,  -519183248}, {  939080267,  -520624391}, {  938280535,  -522064309}, 
+	{  943832191,  -511959275}, {  943045745,  -513406493}, {  942257081,  -514852502}, {  941466198,  -516297300}, 
+	{  946955747,  -506158392}, {  946178196,  -507610408}, {  945398418,  -509061229}, {  944616416,  -510510853}, 
+	{  950043650,  -500338453}, {  949275023,  -501795212}, {  948504163,  -503250791}, {  947731070,  -504705185}, 
+	{  953095785,  -494499676}, {  952336111,  -495961124}, {  951574196,  -497421405}, {  950810042,  -498880516}, 
+	{  956112036,  -488642281}, {  955361344,  -490108363}, {  954608403,  -491573292}, {  953853216,  -493037064}, 
+	{  959092290,  -482766489}, {  958350608,  -484237150}, {  957606670,  -485706671}, {  956860479,  -487175049}, 
+	{  962036435,  -476872522}, {  961303790,  -478347705}, {  960568883,  -479821764}, {  959831716,  -481294693}, 
+	{  964944360,  -470960600}, {  964220780,  -472440251}, {  963494932,  -473918791}, {  962766816,  -475396216}, 
+	{  967815955,  -465030947}, {  967101468,  -466515010}, {  966384706,  -467997976}, {  965665669,  -469479840}, 
+	{  970651112,  -459083786}, {  969945745,  -460572205}, {  969238095,  -462059541}, {  968528165,  -463545789}, 
+	{  973449725,  -453119340}, {  972753504,  -454612060}, {  972054994,  -456103710}, {  971354196,  -457594286}, 
+	{  976211688,  -447137835}, {  975524639,  -448634799}, {  974835295,  -450130706}, {  974143656,  -451625555}, 
+	{  978936898,  -441139496}, {  978259047,  -442640647}, {  977578894,  -444140756}, {  976896441,  -445639820}, 
+	{  981625251,  -435124548}, {  980956623,  -436629829}, {  980285688,  -438134084}, {  979612445,  -439637307}, 
+	{  984276646,  -429093217}, {  983617267,  -430602573}, {  982955574,  -432110916}, {  982291568,  -433618242}, 
+	{  986890984,  -423045732}, {  986240879,  -424559105}, {  985588453,  -426071480}, {  984933708,  -427582852}, 
+	{  989468165,  -416982319}, {  988827359,  -418499653}, {  988184225,  -420016002}, {  987538766,  -421531363}, 
+	{  992008094,  -410903207}, {  991376610,  -412424444}, {  990742793,  -413944711}, {  990106644,  -415464004}, 
+	{  994510675,  -404808624}, {  993888536,  -406333708}, {  993264059,  -407857835}, {  992637245,  -409381002}, 
+	{  996975812,  -398698801}, {  996363043,  -400227673}, {  995747930,  -401755603}, {  995130473,  -403282588}, 
+	{  999403415,  -392573967}, {  998800038,  -394106570}, {  998194311,  -395638246}, {  997586236,  -397168991}, 
+	{ 1001793390,  -386434353}, { 1001199428,  -387970630}, { 1000603111,  -389505993}, { 1000004439,  -391040440}, 
+	{ 1004145648,  -380280190}, { 1003561124,  -381820082}, { 1002974239,  -383359076}, { 1002384994,  -384897167}, 
+	{ 1006460100,  -374111709}, { 1005885036,  -375655159}, { 1005307605,  -377197725}, { 1004727809,  -378739403}, 
+	{ 1008736660,  -367929144}, { 1008171077,  -369476093}, { 1007603122,  -371022173}, { 1007032796,  -372567379}, 
+	{ 1010975242,  -361732726}, { 1010419162,  -363283116}, { 1009860704,  -364832652}, { 1009299870,  -366381329}, 
+	{ 1013175761,  -355522689}, { 1012629204,  -357076462}, { 1012080264,  -358629395}, { 1011528943,  -360181484}, 
+	{ 1015338134,  -349299266}, { 1014801122,  -350856364}, { 1014261721,  -352412636}, { 1013719934,  -353968079}, 
+	{ 1017462281,  -343062693}, { 1016934832,  -344623057}, { 1016404991,  -346182609}, { 1015872758,  -347741347}, 
+	{ 1019548121,  -336813204}, { 1019030256,  -338376774}, { 1018509994,  -339939549}, { 1017987335,  -341501523}, 
+	{ 1021595575,  -330551034}, { 1021087314,  -332117752}, { 1020576651,  -333683689}, { 1020063586,  -335248841}, 
+	{ 1023604567,  -324276419}, { 1023105929,  -325846226}, { 1022604883,  -327415267}, { 1022101432,  -328983538}, 
+	{ 1025575020,  -317989595}, { 1025086024,  -319562433}, { 1024594615,  -321134518}, { 1024100796,  -322705848}, 
+	{ 1027506862,  -311690799}, { 1027027525,  -313266607}, { 1026545772,  -314841679}, { 1026061603,  -316416009}, 
+	{ 1029400018,  -305380268}, { 1028930359,  -306958988}, { 1028458280,  -308536985}, { 1027983780,  -310114257}, 
+	{ 1031254418,  -299058239}, { 1030794455,  -300639811}, { 1030332067,  -302220676}, { 1029867254,  -303800829}, 
+	{ 1033069992,  -292724951}, { 1032619742,  -294309316}, { 1032167062,  -295892988}, { 1031711954,  -297475964}, 
+	{ 1034846671,  -286380643}, { 1034406151,  -287967740}, { 1033963197,  -289554160}, { 1033517810,  -291139898}, 
+	{ 1036584389,  -280025552}, { 1036153615,  -281615322}, { 1035720404,  -283204430}, { 1035284755,  -284792871}, 
+	{ 1038283080,  -273659918}, { 1037862069,  -275252302}, { 1037438617,  -276844038}, { 1037012723,  -278435122}, 
+	{ 1039942680,  -267283981}, { 1039531448,  -268878918}, { 1039117770,  -270473223}, { 1038701647,  -272066891}, 
+	{ 1041563127,  -260897982}, { 1041161689,  -262495412}, { 1040757802,  -264092224}, { 1040351465,  -265688415}, 
+	{ 1043144360,  -254502159}, { 1042752731,  -256102022}, { 1042358649,  -257701283}, { 1041962114,  -259299937}, 
+	{ 1044686319,  -248096755}, { 1044304514,  -249698991}, { 1043920252,  -251300640}, { 1043533534,  -252901697}, 
+	{ 1046188946,  -241682010}, { 1045816980,  -243286558}, { 1045442553,  -244890535}, { 1045065665,  -246493935}, 
+	{ 1047652185,  -235258165}, { 1047290071,  -236864966}, { 1046925492,  -238471210}, { 1046558451,  -240076892}, 
+	{ 1049075980,  -228825464}, { 1048723732,  -230434456}, { 1048369016,  -232042906}, { 1048011834,  -233650811}, 
+	{ 1050460278,  -222384147}, { 1050117909,  -223995270}, { 1049773069,  -225605867}, { 1049425759,  -227215933}, 
+	{ 1051805027,  -215934457}, { 1051472550,  -217547651}, { 1051137599,  -219160334}, { 1050800175,  -220772500}, 
+	{ 1053110176,  -209476638}, { 1052787604,  -211091842}, { 1052462555,  -212706549}, { 1052135029,  -214320755}, 
+	{ 1054375676,  -203010932}, { 1054063021,  -204628085}, { 1053747885,  -206244756}, { 1053430270,  -207860942}, 
+	{ 1055601479,  -196537583}, { 1055298753,  -198156624}, { 1054993543,  -199775198}, { 1054685850,  -201393302}, 
+	{ 1056787540,  -190056834}, { 1056494753,  -191677702}, { 1056199480,  -193298119}, { 1055901722,  -194918080}, 
+	{ 1057933813,  -183568930}, { 1057650977,  -185191564}, { 1057365653,  -186813762}, { 1057077840,  -188435520}, 
+	{ 1059040255,  -177074115}, { 1058767381,  -178698453}, { 1058492016,  -180322371}, { 1058214159,  -181945865}, 
+	{ 1060106826,  -170572633}, { 1059843923,  -172198615}, { 1059578527,  -173824192}, { 1059310638,  -175449360}, 
+	{ 1061133483,  -164064728}, { 1060880563,  -165692293}, { 1060625146,  -167319468}, { 1060367233,  -168946249}, 
+	{ 1062120190,  -157550647}, { 1061877261,  -159179733}, { 1061631833,  -160808445}, { 1061383907,  -162436778}, 
+	{ 1063066909,  -151030634}, { 1062833980,  -152661180}, { 1062598550,  -154291367}, { 1062360620,  -155921191}, 
+	{ 1063973603,  -144504935}, { 1063750684,  -146136880}, { 1063525261,  -147768480}, { 1063297336,  -149399733}, 
+	{ 1064840240,  -137973796}, { 1064627338,  -139607077}, { 1064411931,  -141240030}, { 1064194019,  -142872651}, 
+	{ 1065666786,  -131437462}, { 1065463909,  -133072019}, { 1065258526,  -134706263}, { 1065050636,  -136340190}, 
+	{ 1066453210,  -124896179}, { 1066260367,  -126531950}, { 1066065015,  -128167423}, { 1065867154,  -129802595}, 
+	{ 1067199483,  -118350194}, { 1067016680,  -119987118}, { 1066831367,  -121623759}, { 1066643544,  -123260114}, 
+	{ 1067905576,  -111799753}, { 1067732821,  -113437768}, { 1067557554,  -115075515}, { 1067379774,  -116712992}, 
+	{ 1068571464,  -105245103}, { 1068408763,  -106884147}, { 1068243547,  -108522939}, { 1068075818,  -110161476}, 
+	{ 1069197120,   -98686491}, { 1069044479,  -100326502}, { 1068889322,  -101966277}, { 1068731650,  -103605812}, 
+	{ 1069782521,   -92124163}, { 1069639946,   -93765079}, { 1069494854,   -95405776}, { 1069347245,   -97046247}, 
+	{ 1070327646,   -85558366}, { 1070195142,   -87200127}, { 1070060120,   -88841683}, { 1069922579,   -90483029}, 
+	{ 1070832474,   -78989349}, { 1070710046,   -80631892}, { 1070585099,   -82274245}, { 1070457632,   -83916404}, 
+	{ 1071296985,   -72417357}, { 1071184638,   -74060620}, { 1071069770,   -75703709}, { 1070952382,   -77346620}, 
+	{ 1071721163,   -65842639}, { 1071618901,   -67486561}, { 1071514117,   -69130324}, { 1071406812,   -70773924}, 
+	{ 1072104991,   -59265442}, { 1072012818,   -60909960}, { 1071918122,   -62554335}, { 1071820903,   -64198563}, 
+	{ 1072448455,   -52686014}, { 1072366374,   -54331067}, { 1072281769,   -55975992}, { 1072194642,   -57620785}, 
+	{ 1072751542,   -46104602}, { 1072679556,   -47750128}, { 1072605046,   -49395541}, { 1072528012,   -51040837}, 
+	{ 1073014240,   -39521455}, { 1072952352,   -41167391}, { 1072887940,   -42813230}, { 1072821003,   -44458968}, 
+	{ 1073236540,   -32936819}, { 1073184753,   -34583104}, { 1073130440,   -36229307}, { 1073073603,   -37875426}, 
+	{ 1073418433,   -26350943}, { 1073376748,   -27997515}, { 1073332538,   -29644021}, { 1073285802,   -31290457}, 
+	{ 1073559913,   -19764076}, { 1073528332,   -21410872}, { 1073494225,   -23057618}, { 1073457592,   -24704310}, 
+	{ 1073660973,   -13176464}, { 1073639498,   -14823423}, { 1073615496,   -16470347}, { 1073588967,   -18117233}, 
+	{ 1073721611,    -6588356}, { 1073710241,    -8235416}, { 1073696345,    -9882456}, { 1073679922,   -11529474}, 
+	{ 1073741824,           0}, { 1073740561,    -1647099}, { 1073736771,    -3294193}, { 1073730454,    -4941281}, 
+#endif
+#if (MAX_DIT_FFT_LUT_LOG2 >= 13)
+	{-1073736771,    -3294193}, {-1073738982,    -2470647}, {-1073740561,    -1647099}, {-1073741508,     -823550}, 
+	{-1073721611,    -6588356}, {-1073726348,    -5764820}, {-1073730454,    -4941281}, {-1073733928,    -4117738}, 
+	{-1073696345,    -9882456}, {-1073703609,    -9058939}, {-1073710241,    -8235416}, {-1073716242,    -7411888}, 
+	{-1073660973,   -13176464}, {-1073670764,   -12352972}, {-1073679922,   -11529474}, {-1073688450,   -10705968}, 
+	{-1073615496,   -16470347}, {-1073627812,   -15646890}, {-1073639498,   -14823423}, {-1073650551,   -13999948}, 
+	{-1073559913,   -19764076}, {-1073574756,   -18940660}, {-1073588967,   -18117233}, {-1073602547,   -17293795}, 
+	{-1073494225,   -23057618}, {-1073511594,   -22234252}, {-1073528332,   -21410872}, {-1073544438,   -20587480}, 
+	{-1073418433,   -26350943}, {-1073438328,   -25527634}, {-1073457592,   -24704310}, {-1073476224,   -23880971}, 
+	{-1073332538,   -29644021}, {-1073354959,   -28820776}, {-1073376748,   -27997515}, {-1073397906,   -27174237}, 
+	{-1073236540,   -32936819}, {-1073261486,   -32113647}, {-1073285802,   -31290457}, {-1073309485,   -30467248}, 
+	{-1073130440,   -36229307}, {-1073157912,   -35406216}, {-1073184753,   -34583104}, {-1073210962,   -33759971}, 
+	{-1073014240,   -39521455}, {-1073044237,   -38698452}, {-1073073603,   -37875426}, {-1073102337,   -37052377}, 
+	{-1072887940,   -42813230}, {-1072920462,   -41990323}, {-1072952352,   -41167391}, {-1072983612,   -40344435}, 
+	{-1072751542,   -46104602}, {-1072786588,   -45281799}, {-1072821003,   -44458968}, {-1072854787,   -43636112}, 
+	{-1072605046,   -49395541}, {-1072642617,   -48572848}, {-1072679556,   -47750128}, {-1072715864,   -46927379}, 
+	{-1072448455,   -52686014}, {-1072488549,   -51863441}, {-1072528012,   -51040837}, {-1072566845,   -50218204}, 
+	{-1072281769,   -55975992}, {-1072324387,   -55153545}, {-1072366374,   -54331067}, {-1072407730,   -53508556}, 
+	{-1072104991,   -59265442}, {-1072150132,   -58443131}, {-1072194642,   -57620785}, {-1072238521,   -56798405}, 
+	{-1071918122,   -62554335}, {-1071965785,   -61732166}, {-1072012818,   -60909960}, {-1072059220,   -60087719}, 
+	{-1071721163,   -65842639}, {-1071771349,   -65020620}, {-1071820903,   -64198563}, {-1071869828,   -63376468}, 
+	{-1071514117,   -69130324}, {-1071566824,   -68308462}, {-1071618901,   -67486561}, {-1071670347,   -66664620}, 
+	{-1071296985,   -72417357}, {-1071352214,   -71595661}, {-1071406812,   -70773924}, {-1071460780,   -69952144}, 
+	{-1071069770,   -75703709}, {-1071127519,   -74882187}, {-1071184638,   -74060620}, {-1071241127,   -73239010}, 
+	{-1070832474,   -78989349}, {-1070892743,   -78168007}, {-1070952382,   -77346620}, {-1071011391,   -76525187}, 
+	{-1070585099,   -82274245}, {-1070647887,   -81453092}, {-1070710046,   -80631892}, {-1070771575,   -79810644}, 
+	{-1070327646,   -85558366}, {-1070392954,   -84737410}, {-1070457632,   -83916404}, {-1070521680,   -83095349}, 
+	{-1070060120,   -88841683}, {-1070127946,   -88020931}, {-1070195142,   -87200127}, {-1070261709,   -86379272}, 
+	{-1069782521,   -92124163}, {-1069852865,   -91303623}, {-1069922579,   -90483029}, {-1069991664,   -89662382}, 
+	{-1069494854,   -95405776}, {-1069567715,   -94585455}, {-1069639946,   -93765079}, {-1069711548,   -92944648}, 
+	{-1069197120,   -98686491}, {-1069272497,   -97866398}, {-1069347245,   -97046247}, {-1069421364,   -96226040}, 
+	{-1068889322,  -101966277}, {-1068967215,  -101146419}, {-1069044479,  -100326502}, {-1069121114,   -99506525}, 
+	{-1068571464,  -105245103}, {-1068651871,  -104425488}, {-1068731650,  -103605812}, {-1068810801,  -102786074}, 
+	{-1068243547,  -108522939}, {-1068326469,  -107703574}, {-1068408763,  -106884147}, {-1068490427,  -106064656}, 
+	{-1067905576,  -111799753}, {-1067991011,  -110980647}, {-1068075818,  -110161476}, {-1068159997,  -109342239}, 
+	{-1067557554,  -115075515}, {-1067645501,  -114256675}, {-1067732821,  -113437768}, {-1067819513,  -112618793}, 
+	{-1067199483,  -118350194}, {-1067289942,  -117531627}, {-1067379774,  -116712992}, {-1067468978,  -115894288}, 
+	{-1066831367,  -121623759}, {-1066924338,  -120805474}, {-1067016680,  -119987118}, {-1067108396,  -119168691}, 
+	{-1066453210,  -124896179}, {-1066548690,  -124078183}, {-1066643544,  -123260114}, {-1066737769,  -122441972}, 
+	{-1066065015,  -128167423}, {-1066163005,  -127349724}, {-1066260367,  -126531950}, {-1066357102,  -125714101}, 
+	{-1065666786,  -131437462}, {-1065767284,  -130620067}, {-1065867154,  -129802595}, {-1065966398,  -128985047}, 
+	{-1065258526,  -134706263}, {-1065361531,  -133889180}, {-1065463909,  -133072019}, {-1065565661,  -132254779}, 
+	{-1064840240,  -137973796}, {-1064945751,  -137157033}, {-1065050636,  -136340190}, {-1065154894,  -135523266}, 
+	{-1064411931,  -141240030}, {-1064519947,  -140423595}, {-1064627338,  -139607077}, {-1064734102,  -138790477}, 
+	{-1063973603,  -144504935}, {-1064084124,  -143688835}, {-1064194019,  -142872651}, {-1064303288,  -142056382}, 
+	{-1063525261,  -147768480}, {-1063638285,  -146952723}, {-1063750684,  -146136880}, {-1063862456,  -145320950}, 
+	{-1063066909,  -151030634}, {-1063182435,  -150215228}, {-1063297336,  -149399733}, {-1063411611,  -148584150}, 
+	{-1062598550,  -154291367}, {-1062716578,  -153476319}, {-1062833980,  -152661180}, {-1062950757,  -151845952}, 
+	{-1062120190,  -157550647}, {-1062240717,  -156735965}, {-1062360620,  -155921191}, {-1062479898,  -155106324}, 
+	{-1061631833,  -160808445}, {-1061754859,  -159994136}, {-1061877261,  -159179733}, {-1061999038,  -158365237}, 
+	{-1061133483,  -164064728}, {-1061259007,  -163250801}, {-1061383907,  -162436778}, {-1061508182,  -161622659}, 
+	{-1060625146,  -167319468}, {-1060753166,  -166505929}, {-1060880563,  -165692293}, {-1061007335,  -164878559}, 
+	{-1060106826,  -170572633}, {-1060237341,  -169759491}, {-1060367233,  -168946249}, {-1060496502,  -168132908}, 
+	{-1059578527,  -173824192}, {-1059711537,  -173011454}, {-1059843923,  -172198615}, {-1059975686,  -171385674}, 
+	{-1059040255,  -177074115}, {-1059175758,  -176261789}, {-1059310638,  -175449360}, {-1059444894,  -174636827}, 
+	{-1058492016,  -180322371}, {-1058630010,  -179510465}, {-1058767381,  -178698453}, {-1058904130,  -177886336}, 
+	{-1057933813,  -183568930}, {-1058074297,  -182757451}, {-1058214159,  -181945865}, {-1058353399,  -181134171}, 
+	{-1057365653,  -186813762}, {-1057508626,  -186002717}, {-1057650977,  -185191564}, {-1057792706,  -184380301}, 
+	{-1056787540,  -190056834}, {-1056933001,  -189246233}, {-1057077840,  -188435520}, {-1057222057,  -187624696}, 
+	{-1056199480,  -193298119}, {-1056347427,  -192487967}, {-1056494753,  -191677702}, {-1056641457,  -190867324}, 
+	{-1055601479,  -196537583}, {-1055751911,  -195727889}, {-1055901722,  -194918080}, {-1056050912,  -194108156}, 
+	{-1054993543,  -199775198}, {-1055146458,  -198965969}, {-1055298753,  -198156624}, {-1055450426,  -197347161}, 
+	{-1054375676,  -203010932}, {-1054531073,  -202202177}, {-1054685850,  -201393302}, {-1054840007,  -200584309}, 
+	{-1053747885,  -206244756}, {-1053905763,  -205436481}, {-1054063021,  -204628085}, {-1054219658,  -203819569}, 
+	{-1053110176,  -209476638}, {-1053270533,  -208668851}, {-1053430270,  -207860942}, {-1053589387,  -207052910}, 
+	{-1052462555,  -212706549}, {-1052625389,  -211899258}, {-1052787604,  -211091842}, {-1052949200,  -210284302}, 
+	{-1051805027,  -215934457}, {-1051970337,  -215127670}, {-1052135029,  -214320755}, {-1052299101,  -213513715}, 
+	{-1051137599,  -219160334}, {-1051305384,  -218354057}, {-1051472550,  -217547651}, {-1051639098,  -216741118}, 
+	{-1050460278,  -222384147}, {-1050630536,  -221578389}, {-1050800175,  -220772500}, {-1050969196,  -219966481}, 
+	{-1049773069,  -225605867}, {-1049945798,  -224800635}, {-1050117909,  -223995270}, {-1050289403,  -223189774}, 
+	{-1049075980,  -228825464}, {-1049251178,  -228020765}, {-1049425759,  -227215933}, {-1049599723,  -226410966}, 
+	{-1048369016,  -232042906}, {-1048546683,  -231238749}, {-1048723732,  -230434456}, {-1048900165,  -229630027}, 
+	{-1047652185,  -235258165}, {-1047832317,  -234454557}, {-1048011834,  -233650811}, {-1048190733,  -232846927}, 
+	{-1046925492,  -238471210}, {-1047108090,  -237668158}, {-1047290071,  -236864966}, {-1047471436,  -236061635}, 
+	{-1046188946,  -241682010}, {-1046374006,  -240879522}, {-1046558451,  -240076892}, {-1046742279,  -239274121}, 
+	{-1045442553,  -244890535}, {-1045630074,  -244088618}, {-1045816980,  -243286558}, {-1046003271,  -242484355}, 
+	{-1044686319,  -248096755}, {-1044876299,  -247295417}, {-1045065665,  -246493935}, {-1045254416,  -245692307}, 
+	{-1043920252,  -251300640}, {-1044112690,  -250499889}, {-1044304514,  -249698991}, {-1044495724,  -248897946}, 
+	{-1043144360,  -254502159}, {-1043339254,  -253702003}, {-1043533534,  -252901697}, {-1043727200,  -252101242}, 
+	{-1042358649,  -257701283}, {-1042555997,  -256901728}, {-1042752731,  -256102022}, {-1042948852,  -255302166}, 
+	{-1041563127,  -260897982}, {-1041762927,  -260099036}, {-1041962114,  -259299937}, {-1042160688,  -258500686}, 
+	{-1040757802,  -264092224}, {-1040960052,  -263293896}, {-1041161689,  -262495412}, {-1041362715,  -261696774}, 
+	{-1039942680,  -267283981}, {-1040147378,  -266486277}, {-1040351465,  -265688415}, {-1040554939,  -264890398}, 
+	{-1039117770,  -270473223}, {-1039324915,  -269676150}, {-1039531448,  -268878918}, {-1039737370,  -268081529}, 
+	{-1038283080,  -273659918}, {-1038492669,  -272863485}, {-1038701647,  -272066891}, {-1038910014,  -271270136}, 
+	{-1037438617,  -276844038}, {-1037650648,  -276048251}, {-1037862069,  -275252302}, {-1038072880,  -274456191}, 
+	{-1036584389,  -280025552}, {-1036798861,  -279230419}, {-1037012723,  -278435122}, {-1037225975,  -277639662}, 
+	{-1035720404,  -283204430}, {-1035937314,  -282409959}, {-1036153615,  -281615322}, {-1036369307,  -280820520}, 
+	{-1034846671,  -286380643}, {-1035066018,  -285586841}, {-1035284755,  -284792871}, {-1035502884,  -283998734}, 
+	{-1033963197,  -289554160}, {-1034184978,  -288761035}, {-1034406151,  -287967740}, {-1034626715,  -287174276}, 
+	{-1033069992,  -292724951}, {-1033294205,  -291932511}, {-1033517810,  -291139898}, {-1033740808,  -290347114}, 
+	{-1032167062,  -295892988}, {-1032393706,  -295101239}, {-1032619742,  -294309316}, {-1032845170,  -293517220}, 
+	{-1031254418,  -299058239}, {-1031483489,  -298267189}, {-1031711954,  -297475964}, {-1031939812,  -296684563}, 
+	{-1030332067,  -302220676}, {-1030563564,  -301430332}, {-1030794455,  -300639811}, {-1031024740,  -299849113}, 
+	{-1029400018,  -305380268}, {-1029633939,  -304590638}, {-1029867254,  -303800829}, {-1030099963,  -303010842}, 
+	{-1028458280,  -308536985}, {-1028694622,  -307748077}, {-1028930359,  -306958988}, {-1029165491,  -306169718}, 
+	{-1027506862,  -311690799}, {-1027745623,  -310902619}, {-1027983780,  -310114257}, {-1028221332,  -309325712}, 
+	{-1026545772,  -314841679}, {-1026786951,  -314054235}, {-1027027525,  -313266607}, {-1027267495,  -312478795}, 
+	{-1025575020,  -317989595}, {-1025818614,  -317202895}, {-1026061603,  -316416009}, {-1026303990,  -315628937}, 
+	{-1024594615,  -321134518}, {-1024840621,  -320348570}, {-1025086024,  -319562433}, {-1025330824,  -318776108}, 
+	{-1023604567,  -324276419}, {-1023852982,  -323491229}, {-1024100796,  -322705848}, {-1024348007,  -321920278}, 
+	{-1022604883,  -327415267}, {-1022855707,  -326630843}, {-1023105929,  -325846226}, {-1023355549,  -325061418}, 
+	{-1021595575,  -330551034}, {-1021848804,  -329767383}, {-1022101432,  -328983538}, {-1022353458,  -328199499}, 
+	{-1020576651,  -333683689}, {-1020832283,  -332900819}, {-1021087314,  -332117752}, {-1021341745,  -331334491}, 
+	{-1019548121,  -336813204}, {-1019806153,  -336031121}, {-1020063586,  -335248841}, {-1020320418,  -334466364}, 
+	{-1018509994,  -339939549}, {-1018770425,  -339158261}, {-1019030256,  -338376774}, {-1019289488,  -337595089}, 
+	{-1017462281,  -343062693}, {-1017725107,  -342282209}, {-1017987335,  -341501523}, {-1018248964,  -340720636}, 
+	{-1016404991,  -346182609}, {-1016670211,  -345402934}, {-1016934832,  -344623057}, {-1017198856,  -343842976}, 
+	{-1015338134,  -349299266}, {-1015605745,  -348520409}, {-1015872758,  -347741347}, {-1016139173,  -346962080}, 
+	{-1014261721,  -352412636}, {-1014531720,  -351634604}, {-1014801122,  -350856364}, {-1015069927,  -350077918}, 
+	{-1013175761,  -355522689}, {-1013448145,  -354745488}, {-1013719934,  -353968079}, {-1013991126,  -353190461}, 
+	{-1012080264,  -358629395}, {-1012355032,  -357853034}, {-1012629204,  -357076462}, {-1012902780,  -356299680}, 
+	{-1010975242,  -361732726}, {-1011252390,  -360957211}, {-1011528943,  -360181484}, {-1011804901,  -359405545}, 
+	{-1009860704,  -364832652}, {-1010140230,  -364057991}, {-1010419162,  -363283116}, {-1010697499,  -362508027}, 
+	{-1008736660,  -367929144}, {-1009018562,  -367155344}, {-1009299870,  -366381329}, {-1009580584,  -365607098}, 
+	{-1007603122,  -371022173}, {-1007887396,  -370249242}, {-1008171077,  -369476093}, {-1008454166,  -368702727}, 
+	{-1006460100,  -374111709}, {-1006746744,  -373339654}, {-1007032796,  -372567379}, {-1007318256,  -371794885}, 
+	{-1005307605,  -377197725}, {-1005596617,  -376426553}, {-1005885036,  -375655159}, {-1006172864,  -374883544}, 
+	{-1004145648,  -380280190}, {-1004437024,  -379509908}, {-1004727809,  -378739403}, {-1005018003,  -377968675}, 
+	{-1002974239,  -383359076}, {-1003267977,  -382589691}, {-1003561124,  -381820082}, {-1003853681,  -381050248}, 
+	{-1001793390,  -386434353}, {-1002089486,  -385665873}, {-1002384994,  -384897167}, {-1002679911,  -384128234}, 
+	{-1000603111,  -389505993}, {-1000901564,  -388738426}, {-1001199428,  -387970630}, {-1001496704,  -387202605}, 
+	{ -999403415,  -392573967}, { -999704221,  -391807319}, {-1000004439,  -391040440}, {-1000304069,  -390273331}, 
+	{ -998194311,  -395638246}, { -998497468,  -394872524}, { -998800038,  -394106570}, { -999102020,  -393340384}, 
+	{ -996975812,  -398698801}, { -997281317,  -397934013}, { -997586236,  -397168991}, { -997890567,  -396403735}, 
+	{ -995747930,  -401755603}, { -996055780,  -400991756}, { -996363043,  -400227673}, { -996669721,  -399463355}, 
+	{ -994510675,  -404808624}, { -994820867,  -404045725}, { -995130473,  -403282588}, { -995439494,  -402519214}, 
+	{ -993264059,  -407857835}, { -993576590,  -407095891}, { -993888536,  -406333708}, { -994199898,  -405571285}, 
+	{ -992008094,  -410903207}, { -992322961,  -410142225}, { -992637245,  -409381002}, { -992950944,  -408619539}, 
+	{ -990742793,  -413944711}, { -991059993,  -413184699}, { -991376610,  -412424444}, { -991692644,  -411663946}, 
+	{ -989468165,  -416982319}, { -989787696,  -416223284}, { -990106644,  -415464004}, { -990425010,  -414704479}, 
+	{ -988184225,  -420016002}, { -988506083,  -419257951}, { -988827359,  -418499653}, { -989148053,  -417741109}, 
+	{ -986890984,  -423045732}, { -987215165,  -422288671}, { -987538766,  -421531363}, { -987861786,  -420773806}, 
+	{ -985588453,  -426071480}, { -985914956,  -425315418}, { -986240879,  -424559105}, { -986566221,  -423802543}, 
+	{ -984276646,  -429093217}, { -984605467,  -428338160}, { -984933708,  -427582852}, { -985261370,  -426827291}, 
+	{ -982955574,  -432110916}, { -983286710,  -431356872}, { -983617267,  -430602573}, { -983947246,  -429848022}, 
+	{ -981625251,  -435124548}, { -981958698,  -434371523}, { -982291568,  -433618242}, { -982623860,  -432864706}, 
+	{ -980285688,  -438134084}, { -980621444,  -437382085}, { -980956623,  -436629829}, { -981291226,  -435877317}, 
+	{ -978936898,  -441139496}, { -979274960,  -440388531}, { -979612445,  -439637307}, { -979949355,  -438885824}, 
+	{ -977578894,  -444140756}, { -977919258,  -443390832}, { -978259047,  -442640647}, { -978598260,  -441890201}, 
+	{ -976211688,  -447137835}, { -976554352,  -446388959}, { -976896441,  -445639820}, { -977237955,  -444890419}, 
+	{ -974835295,  -450130706}, { -975180254,  -449382885}, { -975524639,  -448634799}, { -975868451,  -447886449}, 
+	{ -973449725,  -453119340}, { -973796977,  -452372581}, { -974143656,  -451625555}, { -974489762,  -450878263}, 
+	{ -972054994,  -456103710}, { -972404535,  -455358019}, { -972753504,  -454612060}, { -973101901,  -453865834}, 
+	{ -970651112,  -459083786}, { -971002940,  -458339171}, { -971354196,  -457594286}, { -971704881,  -456849132}, 
+	{ -969238095,  -462059541}, { -969592205,  -461316009}, { -969945745,  -460572205}, { -970298714,  -459828131}, 
+	{ -967815955,  -465030947}, { -968172345,  -464288505}, { -968528165,  -463545789}, { -968883415,  -462802801}, 
+	{ -966384706,  -467997976}, { -966743371,  -467256631}, { -967101468,  -466515010}, { -967458996,  -465773116}, 
+	{ -964944360,  -470960600}, { -965305298,  -470220358}, { -965665669,  -469479840}, { -966025471,  -468739046}, 
+	{ -963494932,  -473918791}, { -963858140,  -473179660}, { -964220780,  -472440251}, { -964582854,  -471700564}, 
+	{ -962036435,  -476872522}, { -962401909,  -476134509}, { -962766816,  -475396216}, { -963131157,  -474657643}, 
+	{ -960568883,  -479821764}, { -960936620,  -479084875}, { -961303790,  -478347705}, { -961670396,  -477610254}, 
+	{ -959092290,  -482766489}, { -959462286,  -482030733}, { -959831716,  -481294693}, { -960200582,  -480558369}, 
+	{ -957606670,  -485706671}, { -957978921,  -484972053}, { -958350608,  -484237150}, { -958721731,  -483501962}, 
+	{ -956112036,  -488642281}, { -956486539,  -487908809}, { -956860479,  -487175049}, { -957233856,  -486441003}, 
+	{ -954608403,  -491573292}, { -954985154,  -490840972}, { -955361344,  -490108363}, { -955736971,  -489375466}, 
+	{ -953095785,  -494499676}, { -953474781,  -493768515}, { -953853216,  -493037064}, { -954231090,  -492305322}, 
+	{ -951574196,  -497421405}, { -951955434,  -496691410}, { -952336111,  -495961124}, { -952716228,  -495230545}, 
+	{ -950043650,  -500338453}, { -950427126,  -499609631}, { -950810042,  -498880516}, { -951192399,  -498151107}, 
+	{ -948504163,  -503250791}, { -948889872,  -502523149}, { -949275023,  -501795212}, { -949659616,  -501066980}, 
+	{ -946955747,  -506158392}, { -947343687,  -505431937}, { -947731070,  -504705185}, { -948117895,  -503978136}, 
+	{ -945398418,  -509061229}, { -945788585,  -508335968}, { -946178196,  -507610408}, { -946567250,  -506884549}, 
+	{ -943832191,  -511959275}, { -944224582,  -511235214}, { -944616416,  -510510853}, { -945007695,  -509786191}, 
+	{ -942257081,  -514852502}, { -942651690,  -514129648}, { -943045745,  -513406493}, { -943439246,  -512683035}, 
+	{ -940673101,  -517740883}, { -941069926,  -517019243}, { -941466198,  -516297300}, { -941861917,  -515575053}, 
+	{ -939080267,  -520624391}, { -939479305,  -519903972}, { -939877790,  -519183248}, { -940275722,  -518462218}, 
+	{ -937478595,  -523502998}, { -937879841,  -522783807}, { -938280535,  -522064309}, { -938680677,  -521344503}, 
+	{ -935868098,  -526376678}, { -936271549,  -525658722}, { -936674448,  -524940456}, { -937076797,  -524221881}, 
+	{ -934248793,  -529245404}, { -934654444,  -528528689}, { -935059546,  -527811662}, { -935464097,  -527094325}, 
+	{ -932620694,  -532109148}, { -933028542,  -531393681}, { -933435842,  -530677900}, { -933842592,  -529961808}, 
+	{ -930983817,  -534967884}, { -931393859,  -534253671}, { -931803352,  -533539144}, { -932212297,  -532824303}, 
+	{ -929338177,  -537821584}, { -929750408,  -537108633}, { -930162092,  -536395365}, { -930573228,  -535681782}, 
+	{ -927683790,  -540670223}, { -928098206,  -539958539}, { -928512076,  -539246538}, { -928925400,  -538534220}, 
+	{ -926020672,  -543513772}, { -926437269,  -542803363}, { -926853322,  -542092635}, { -927268829,  -541381588}, 
+	{ -924348837,  -546352205}, { -924767612,  -545643078}, { -925185843,  -544933630}, { -925603530,  -544223861}, 
+	{ -922668302,  -549185496}, { -923089250,  -548477657}, { -923509656,  -547769495}, { -923929518,  -547061011}, 
+	{ -920979082,  -552013618}, { -921402200,  -551307074}, { -921824777,  -550600205}, { -922246810,  -549893013}, 
+	{ -919281194,  -554836544}, { -919706478,  -554131301}, { -920131221,  -553425732}, { -920555422,  -552719838}, 
+	{ -917574653,  -557654248}, { -918002099,  -556950313}, { -918429004,  -556246051}, { -918855369,  -555541461}, 
+	{ -915859476,  -560466703}, { -916289079,  -559764083}, { -916718143,  -559061133}, { -917146668,  -558357855}, 
+	{ -914135678,  -563273883}, { -914567435,  -562572584}, { -914998653,  -561870954}, { -915429334,  -561168994}, 
+	{ -912403276,  -566075761}, { -912837182,  -565375790}, { -913270551,  -564675486}, { -913703383,  -563974850}, 
+	{ -910662286,  -568872310}, { -911098338,  -568173674}, { -911533853,  -567474703}, { -911968833,  -566775399}, 
+	{ -908912725,  -571663506}, { -909350918,  -570966210}, { -909788576,  -570268579}, { -910225699,  -569570612}, 
+	{ -907154608,  -574449320}, { -907594938,  -573753372}, { -908034735,  -573057087}, { -908473997,  -572360465}, 
+	{ -905387953,  -577229728}, { -905830417,  -576535134}, { -906272347,  -575840202}, { -906713744,  -575144930}, 
+	{ -903612776,  -580004702}, { -904057369,  -579311470}, { -904501429,  -578617896}, { -904944957,  -577923982}, 
+	{ -901829095,  -582774218}, { -902275811,  -582082352}, { -902721998,  -581390144}, { -903167653,  -580697594}, 
+	{ -900036924,  -585538248}, { -900485762,  -584847756}, { -900934069,  -584156920}, { -901381847,  -583465740}, 
+	{ -898236282,  -588296766}, { -898687236,  -587607655}, { -899137661,  -586918198}, { -899587557,  -586228395}, 
+	{ -896427186,  -591049748}, { -896880252,  -590362023}, { -897332790,  -589673951}, { -897784800,  -588985532}, 
+	{ -894609652,  -593797166}, { -895064826,  -593110835}, { -895519473,  -592424154}, { -895973593,  -591737125}, 
+	{ -892783698,  -596538995}, { -893240975,  -595854063}, { -893697727,  -595168781}, { -894153953,  -594483148}, 
+	{ -890949341,  -599275210}, { -891408717,  -598591684}, { -891867569,  -597907806}, { -892325896,  -597223576}, 
+	{ -889106597,  -602005783}, { -889568068,  -601323670}, { -890029016,  -600641203}, { -890489440,  -599958383}, 
+	{ -887255485,  -604730691}, { -887719047,  -604049997}, { -888182086,  -603368947}, { -888644603,  -602687543}, 
+	{ -885396022,  -607449906}, { -885861670,  -606770638}, { -886326796,  -606091012}, { -886791402,  -605411029}, 
+	{ -883528225,  -610163404}, { -883995955,  -609485567}, { -884463164,  -608807372}, { -884929853,  -608128818}, 
+	{ -881652112,  -612871159}, { -882121919,  -612194760}, { -882591207,  -611518001}, { -883059976,  -610840882}, 
+	{ -879767701,  -615573145}, { -880239581,  -614898191}, { -880710943,  -614222875}, { -881181787,  -613547198}, 
+	{ -877875009,  -618269338}, { -878348957,  -617595834}, { -878822389,  -616921967}, { -879295303,  -616247738}, 
+	{ -875974054,  -620959711}, { -876450066,  -620287664}, { -876925563,  -619615253}, { -877400544,  -618942478}, 
+	{ -874064853,  -623644239}, { -874542925,  -622973656}, { -875020483,  -622302707}, { -875497526,  -621631392}, 
+	{ -872147426,  -626322897}, { -872627553,  -625653784}, { -873107167,  -624984303}, { -873586267,  -624314455}, 
+	{ -870221790,  -628995660}, { -870703968,  -628328023}, { -871185633,  -627660017}, { -871666786,  -626991641}, 
+	{ -868287963,  -631662503}, { -868772187,  -630996348}, { -869255900,  -630329823}, { -869739101,  -629662927}, 
+	{ -866345964,  -634323400}, { -866832229,  -633658734}, { -867317984,  -632993696}, { -867803229,  -632328285}, 
+	{ -864395810,  -636978327}, { -864884112,  -636315156}, { -865371905,  -635651611}, { -865859189,  -634987692}, 
+	{ -862437520,  -639627258}, { -862927854,  -638965588}, { -863417681,  -638303543}, { -863906999,  -637641122}, 
+	{ -860471112,  -642270169}, { -860963474,  -641610007}, { -861455330,  -640949467}, { -861946678,  -640288551}, 
+	{ -858496606,  -644907034}, { -858990991,  -644248386}, { -859484870,  -643589359}, { -859978244,  -642929953}, 
+	{ -856514019,  -647537830}, { -857010422,  -646880701}, { -857506321,  -646223192}, { -858001716,  -645565303}, 
+	{ -854523370,  -650162530}, { -855021787,  -649506928}, { -855519701,  -648850943}, { -856017111,  -648194577}, 
+	{ -852524677,  -652781111}, { -853025104,  -652127041}, { -853525028,  -651472587}, { -854024450,  -650817750}, 
+	{ -850517961,  -655393548}, { -851020391,  -654741016}, { -851522321,  -654088099}, { -852023750,  -653434797}, 
+	{ -848503239,  -657999816}, { -849007669,  -657348828}, { -849511600,  -656697454}, { -850015030,  -656045694}, 
+	{ -846480531,  -660599890}, { -846986956,  -659950454}, { -847492882,  -659300629}, { -847998310,  -658650416}, 
+	{ -844449856,  -663193747}, { -844958270,  -662545867}, { -845466188,  -661897597}, { -845973608,  -661248938}, 
+	{ -842411232,  -665781362}, { -842921632,  -665135044}, { -843431536,  -664488336}, { -843940944,  -663841237}, 
+	{ -840364679,  -668362709}, { -840877059,  -667717961}, { -841388945,  -667072820}, { -841900336,  -666427287}, 
+	{ -838310216,  -670937767}, { -838824572,  -670294593}, { -839338435,  -669651026}, { -839851804,  -669007064}, 
+	{ -836247863,  -673506508}, { -836764190,  -672864916}, { -837280024,  -672222928}, { -837795367,  -671580545}, 
+	{ -834177638,  -676068911}, { -834695931,  -675428906}, { -835213733,  -674788504}, { -835731044,  -674147704}, 
+	{ -832099562,  -678624950}, { -832619816,  -677986538}, { -833139580,  -677347728}, { -833658855,  -676708518}, 
+	{ -830013654,  -681174602}, { -830535864,  -680537789}, { -831057586,  -679900576}, { -831578819,  -679262963}, 
+	{ -827919934,  -683717842}, { -828444095,  -683082635}, { -828967769,  -682447025}, { -829490956,  -681811014}, 
+	{ -825818421,  -686254647}, { -826344528,  -685621051}, { -826870150,  -684987051}, { -827395285,  -684352648}, 
+	{ -823709135,  -688784993}, { -824237184,  -688153013}, { -824764748,  -687520629}, { -825291827,  -686887840}, 
+	{ -821592095,  -691308855}, { -822122081,  -690678499}, { -822651583,  -690047736}, { -823180601,  -689416567}, 
+	{ -819467323,  -693826211}, { -819999240,  -693197483}, { -820530675,  -692568348}, { -821061627,  -691938805}, 
+	{ -817334838,  -696337036}, { -817868681,  -695709943}, { -818402043,  -695082441}, { -818934924,  -694454530}, 
+	{ -815194659,  -698841307}, { -815730424,  -698215855}, { -816265709,  -697589992}, { -816800514,  -696963719}, 
+	{ -813046808,  -701339000}, { -813584489,  -700715194}, { -814121692,  -700090977}, { -814658415,  -699466348}, 
+	{ -810891304,  -703830092}, { -811430896,  -703207939}, { -811970011,  -702585372}, { -812508649,  -701962393}, 
+	{ -808728167,  -706314559}, { -809269666,  -705694064}, { -809810688,  -705073155}, { -810351235,  -704451830}, 
+	{ -806557419,  -708792378}, { -807100819,  -708173547}, { -807643743,  -707554301}, { -808186193,  -706934638}, 
+	{ -804379079,  -711263525}, { -804924374,  -710646365}, { -805469196,  -710028787}, { -806013545,  -709410791}, 
+	{ -802193167,  -713727978}, { -802740354,  -713112494}, { -803287068,  -712496590}, { -803833310,  -711880267}, 
+	{ -799999706,  -716185713}, { -800548778,  -715571910}, { -801097379,  -714957687}, { -801645509,  -714343043}, 
+	{ -797798714,  -718636707}, { -798349667,  -718024592}, { -798900150,  -717412054}, { -799450163,  -716799095}, 
+	{ -795590213,  -721080937}, { -796143041,  -720470515}, { -796695401,  -719859669}, { -797247292,  -719248400}, 
+	{ -793374223,  -723518380}, { -793928922,  -722909657}, { -794483153,  -722300508}, { -795036917,  -721690935}, 
+	{ -791150767,  -725949013}, { -791707330,  -725341994}, { -792263427,  -724734549}, { -792819059,  -724126677}, 
+	{ -788919863,  -728372813}, { -789478286,  -727767504}, { -790036244,  -727161768}, { -790593738,  -726555604}, 
+	{ -786681534,  -730789757}, { -787241811,  -730186165}, { -787801625,  -729582143}, { -788360976,  -728977692}, 
+	{ -784435800,  -733199822}, { -784997927,  -732597952}, { -785559591,  -731995651}, { -786120794,  -731392919}, 
+	{ -782182683,  -735602987}, { -782746654,  -735002844}, { -783310163,  -734402269}, { -783873212,  -733801261}, 
+	{ -779922204,  -737999228}, { -780488013,  -737400818}, { -781053363,  -736801974}, { -781618253,  -736202697}, 
+	{ -777654384,  -740388522}, { -778222026,  -739791851}, { -778789210,  -739194745}, { -779355936,  -738597203}, 
+	{ -775379244,  -742770848}, { -775948714,  -742175921}, { -776517728,  -741580558}, { -777086284,  -740984758}, 
+	{ -773096806,  -745146182}, { -773668099,  -744553005}, { -774238936,  -743959390}, { -774809318,  -743365338}, 
+	{ -770807092,  -747514503}, { -771380201,  -746923082}, { -771952857,  -746331221}, { -772525059,  -745738921}, 
+	{ -768510122,  -749875788}, { -769085043,  -749286127}, { -769659512,  -748696026}, { -770233528,  -748105485}, 
+	{ -766205919,  -752230015}, { -766782646,  -751642121}, { -767358923,  -751053785}, { -767934748,  -750465007}, 
+	{ -763894504,  -754577161}, { -764473032,  -753991040}, { -765051111,  -753404474}, { -765628740,  -752817466}, 
+	{ -761575898,  -756917205}, { -762156223,  -756332861}, { -762736098,  -755748072}, { -763315525,  -755162839}, 
+	{ -759250125,  -759250125}, { -759832239,  -758667564}, { -760413906,  -758084557}, { -760995126,  -757501104}, 
+	{ -756917205,  -761575898}, { -757501104,  -760995126}, { -758084557,  -760413906}, { -758667564,  -759832239}, 
+	{ -754577161,  -763894504}, { -755162839,  -763315525}, { -755748072,  -762736098}, { -756332861,  -762156223}, 
+	{ -752230015,  -766205919}, { -752817466,  -765628740}, { -753404474,  -765051111}, { -753991040,  -764473032}, 
+	{ -749875788,  -768510122}, { -750465007,  -767934748}, { -751053785,  -767358923}, { -751642121,  -766782646}, 
+	{ -747514503,  -770807092}, { -748105485,  -770233528}, { -748696026,  -769659512}, { -749286127,  -769085043}, 
+	{ -745146182,  -773096806}, { -745738921,  -772525059}, { -746331221,  -771952857}, { -746923082,  -771380201}, 
+	{ -742770848,  -775379244}, { -743365338,  -774809318}, { -743959390,  -774238936}, { -744553005,  -773668099}, 
+	{ -740388522,  -777654384}, { -740984758,  -777086284}, { -741580558,  -776517728}, { -742175921,  -775948714}, 
+	{ -737999228,  -779922204}, { -738597203,  -779355936}, { -739194745,  -778789210}, { -739791851,  -778222026}, 
+	{ -735602987,  -782182683}, { -736202697,  -781618253}, { -736801974,  -781053363}, { -737400818,  -780488013}, 
+	{ -733199822,  -784435800}, { -733801261,  -783873212}, { -734402269,  -783310163}, { -735002844,  -782746654}, 
+	{ -730789757,  -786681534}, { -731392919,  -786120794}, { -731995651,  -785559591}, { -732597952,  -784997927}, 
+	{ -728372813,  -788919863}, { -728977692,  -788360976}, { -729582143,  -787801625}, { -730186165,  -787241811}, 
+	{ -725949013,  -791150767}, { -726555604,  -790593738}, { -727161768,  -790036244}, { -727767504,  -789478286}, 
+	{ -723518380,  -793374223}, { -724126677,  -792819059}, { -724734549,  -792263427}, { -725341994,  -791707330}, 
+	{ -721080937,  -795590213}, { -721690935,  -795036917}, { -722300508,  -794483153}, { -722909657,  -793928922}, 
+	{ -718636707,  -797798714}, { -719248400,  -797247292}, { -719859669,  -796695401}, { -720470515,  -796143041}, 
+	{ -716185713,  -799999706}, { -716799095,  -799450163}, { -717412054,  -798900150}, { -718024592,  -798349667}, 
+	{ -713727978,  -802193167}, { -714343043,  -801645509}, { -714957687,  -801097379}, { -715571910,  -800548778}, 
+	{ -711263525,  -804379079}, { -711880267,  -803833310}, { -712496590,  -803287068}, { -713112494,  -802740354}, 
+	{ -708792378,  -806557419}, { -709410791,  -806013545}, { -710028787,  -805469196}, { -710646365,  -804924374}, 
+	{ -706314559,  -808728167}, { -706934638,  -808186193}, { -707554301,  -807643743}, { -708173547,  -807100819}, 
+	{ -703830092,  -810891304}, { -704451830,  -810351235}, { -705073155,  -809810688}, { -705694064,  -809269666}, 
+	{ -701339000,  -813046808}, { -701962393,  -812508649}, { -702585372,  -811970011}, { -703207939,  -811430896}, 
+	{ -698841307,  -815194659}, { -699466348,  -814658415}, { -700090977,  -814121692}, { -700715194,  -813584489}, 
+	{ -696337036,  -817334838}, { -696963719,  -816800514}, { -697589992,  -816265709}, { -698215855,  -815730424}, 
+	{ -693826211,  -819467323}, { -694454530,  -818934924}, { -695082441,  -818402043}, { -695709943,  -817868681}, 
+	{ -691308855,  -821592095}, { -691938805,  -821061627}, { -692568348,  -820530675}, { -693197483,  -819999240}, 
+	{ -688784993,  -823709135}, { -689416567,  -823180601}, { -690047736,  -822651583}, { -690678499,  -822122081}, 
+	{ -686254647,  -825818421}, { -686887840,  -825291827}, { -687520629,  -824764748}, { -688153013,  -824237184}, 
+	{ -683717842,  -827919934}, { -684352648,  -827395285}, { -684987051,  -826870150}, { -685621051,  -826344528}, 
+	{ -681174602,  -830013654}, { -681811014,  -829490956}, { -682447025,  -828967769}, { -683082635,  -828444095}, 
+	{ -678624950,  -832099562}, { -679262963,  -831578819}, { -679900576,  -831057586}, { -680537789,  -830535864}, 
+	{ -676068911,  -834177638}, { -676708518,  -833658855}, { -677347728,  -833139580}, { -677986538,  -832619816}, 
+	{ -673506508,  -836247863}, { -674147704,  -835731044}, { -674788504,  -835213733}, { -675428906,  -834695931}, 
+	{ -670937767,  -838310216}, { -671580545,  -837795367}, { -672222928,  -837280024}, { -672864916,  -836764190}, 
+	{ -668362709,  -840364679}, { -669007064,  -839851804}, { -669651026,  -839338435}, { -670294593,  -838824572}, 
+	{ -665781362,  -842411232}, { -666427287,  -841900336}, { -667072820,  -841388945}, { -667717961,  -840877059}, 
+	{ -663193747,  -844449856}, { -663841237,  -843940944}, { -664488336,  -843431536}, { -665135044,  -842921632}, 
+	{ -660599890,  -846480531}, { -661248938,  -845973608}, { -661897597,  -845466188}, { -662545867,  -844958270}, 
+	{ -657999816,  -848503239}, { -658650416,  -847998310}, { -659300629,  -847492882}, { -659950454,  -846986956}, 
+	{ -655393548,  -850517961}, { -656045694,  -850015030}, { -656697454,  -849511600}, { -657348828,  -849007669}, 
+	{ -652781111,  -852524677}, { -653434797,  -852023750}, { -654088099,  -851522321}, { -654741016,  -851020391}, 
+	{ -650162530,  -854523370}, { -650817750,  -854024450}, { -651472587,  -853525028}, { -652127041,  -853025104}, 
+	{ -647537830,  -856514019}, { -648194577,  -856017111}, { -648850943,  -855519701}, { -649506928,  -855021787}, 
+	{ -644907034,  -858496606}, { -645565303,  -858001716}, { -646223192,  -857506321}, { -646880701,  -857010422}, 
+	{ -642270169,  -860471112}, { -642929953,  -859978244}, { -643589359,  -859484870}, { -644248386,  -858990991}, 
+	{ -639627258,  -862437520}, { -640288551,  -861946678}, { -640949467,  -861455330}, { -641610007,  -860963474}, 
+	{ -636978327,  -864395810}, { -637641122,  -863906999}, { -638303543,  -863417681}, { -638965588,  -862927854}, 
+	{ -634323400,  -866345964}, { -634987692,  -865859189}, { -635651611,  -865371905}, { -636315156,  -864884112}, 
+	{ -631662503,  -868287963}, { -632328285,  -867803229}, { -632993696,  -867317984}, { -633658734,  -866832229}, 
+	{ -628995660,  -870221790}, { -629662927,  -869739101}, { -630329823,  -869255900}, { -630996348,  -868772187}, 
+	{ -626322897,  -872147426}, { -626991641,  -871666786}, { -627660017,  -871185633}, { -628328023,  -870703968}, 
+	{ -623644239,  -874064853}, { -624314455,  -873586267}, { -624984303,  -873107167}, { -625653784,  -872627553}, 
+	{ -620959711,  -875974054}, { -621631392,  -875497526}, { -622302707,  -875020483}, { -622973656,  -874542925}, 
+	{ -618269338,  -877875009}, { -618942478,  -877400544}, { -619615253,  -876925563}, { -620287664,  -876450066}, 
+	{ -615573145,  -879767701}, { -616247738,  -879295303}, { -616921967,  -878822389}, { -617595834,  -878348957}, 
+	{ -612871159,  -881652112}, { -613547198,  -881181787}, { -614222875,  -880710943}, { -614898191,  -880239581}, 
+	{ -610163404,  -883528225}, { -610840882,  -883059976}, { -611518001,  -882591207}, { -612194760,  -882121919}, 
+	{ -607449906,  -885396022}, { -608128818,  -884929853}, { -608807372,  -884463164}, { -609485567,  -883995955}, 
+	{ -604730691,  -887255485}, { -605411029,  -886791402}, { -606091012,  -886326796}, { -606770638,  -885861670}, 
+	{ -602005783,  -889106597}, { -602687543,  -888644603}, { -603368947,  -888182086}, { -604049997,  -887719047}, 
+	{ -599275210,  -890949341}, { -599958383,  -890489440}, { -600641203,  -890029016}, { -601323670,  -889568068}, 
+	{ -596538995,  -892783698}, { -597223576,  -892325896}, { -597907806,  -891867569}, { -598591684,  -891408717}, 
+	{ -593797166,  -894609652}, { -594483148,  -894153953}, { -595168781,  -893697727}, { -595854063,  -893240975}, 
+	{ -591049748,  -896427186}, { -591737125,  -895973593}, { -592424154,  -895519473}, { -593110835,  -895064826}, 
+	{ -588296766,  -898236282}, { -588985532,  -897784800}, { -589673951,  -897332790}, { -590362023,  -896880252}, 
+	{ -585538248,  -900036924}, { -586228395,  -899587557}, { -586918198,  -899137661}, { -587607655,  -898687236}, 
+	{ -582774218,  -901829095}, { -583465740,  -901381847}, { -584156920,  -900934069}, { -584847756,  -900485762}, 
+	{ -580004702,  -903612776}, { -580697594,  -903167653}, { -581390144,  -902721998}, { -582082352,  -902275811}, 
+	{ -577229728,  -905387953}, { -577923982,  -904944957}, { -578617896,  -904501429}, { -579311470,  -904057369}, 
+	{ -574449320,  -907154608}, { -575144930,  -906713744}, { -575840202,  -906272347}, { -576535134,  -905830417}, 
+	{ -571663506,  -908912725}, { -572360465,  -908473997}, { -573057087,  -908034735}, { -573753372,  -907594938}, 
+	{ -568872310,  -910662286}, { -569570612,  -910225699}, { -570268579,  -909788576}, { -570966210,  -909350918}, 
+	{ -566075761,  -912403276}, { -566775399,  -911968833}, { -567474703,  -911533853}, { -568173674,  -911098338}, 
+	{ -563273883,  -914135678}, { -563974850,  -913703383}, { -564675486,  -913270551}, { -565375790,  -912837182}, 
+	{ -560466703,  -915859476}, { -561168994,  -915429334}, { -561870954,  -914998653}, { -562572584,  -914567435}, 
+	{ -557654248,  -917574653}, { -558357855,  -917146668}, { -559061133,  -916718143}, { -559764083,  -916289079}, 
+	{ -554836544,  -919281194}, { -555541461,  -918855369}, { -556246051,  -918429004}, { -556950313,  -918002099}, 
+	{ -552013618,  -920979082}, { -552719838,  -920555422}, { -553425732,  -920131221}, { -554131301,  -919706478}, 
+	{ -549185496,  -922668302}, { -549893013,  -922246810}, { -550600205,  -921824777}, { -551307074,  -921402200}, 
+	{ -546352205,  -924348837}, { -547061011,  -923929518}, { -547769495,  -923509656}, { -548477657,  -923089250}, 
+	{ -543513772,  -926020672}, { -544223861,  -925603530}, { -544933630,  -925185843}, { -545643078,  -924767612}, 
+	{ -540670223,  -927683790}, { -541381588,  -927268829}, { -542092635,  -926853322}, { -542803363,  -926437269}, 
+	{ -537821584,  -929338177}, { -538534220,  -928925400}, { -539246538,  -928512076}, { -539958539,  -928098206}, 
+	{ -534967884,  -930983817}, { -535681782,  -930573228}, { -536395365,  -930162092}, { -537108633,  -929750408}, 
+	{ -532109148,  -932620694}, { -532824303,  -932212297}, { -533539144,  -931803352}, { -534253671,  -931393859}, 
+	{ -529245404,  -934248793}, { -529961808,  -933842592}, { -530677900,  -933435842}, { -531393681,  -933028542}, 
+	{ -526376678,  -935868098}, { -527094325,  -935464097}, { -527811662,  -935059546}, { -528528689,  -934654444}, 
+	{ -523502998,  -937478595}, { -524221881,  -937076797}, { -524940456,  -936674448}, { -525658722,  -936271549}, 
+	{ -520624391,  -939080267}, { -521344503,  -938680677}, { -522064309,  -938280535}, { -522783807,  -937879841}, 
+	{ -517740883,  -940673101}, { -518462218,  -940275722}, { -519183248,  -939877790}, { -519903972,  -939479305}, 
+	{ -514852502,  -942257081}, { -515575053,  -941861917}, { -516297300,  -941466198}, { -517019243,  -941069926}, 
+	{ -511959275,  -943832191}, { -512683035,  -943439246}, { -513406493,  -943045745}, { -514129648,  -942651690}, 
+	{ -509061229,  -945398418}, { -509786191,  -945007695}, { -510510853,  -944616416}, { -511235214,  -944224582}, 
+	{ -506158392,  -946955747}, { -506884549,  -946567250}, { -507610408,  -946178196}, { -508335968,  -945788585}, 
+	{ -503250791,  -948504163}, { -503978136,  -948117895}, { -504705185,  -947731070}, { -505431937,  -947343687}, 
+	{ -500338453,  -950043650}, { -501066980,  -949659616}, { -501795212,  -949275023}, { -502523149,  -948889872}, 
+	{ -497421405,  -951574196}, { -498151107,  -951192399}, { -498880516,  -950810042}, { -499609631,  -950427126}, 
+	{ -494499676,  -953095785}, { -495230545,  -952716228}, { -495961124,  -952336111}, { -496691410,  -951955434}, 
+	{ -491573292,  -954608403}, { -492305322,  -954231090}, { -493037064,  -953853216}, { -493768515,  -953474781}, 
+	{ -488642281,  -956112036}, { -489375466,  -955736971}, { -490108363,  -955361344}, { -490840972,  -954985154}, 
+	{ -485706671,  -957606670}, { -486441003,  -957233856}, { -487175049,  -956860479}, { -487908809,  -956486539}, 
+	{ -482766489,  -959092290}, { -483501962,  -958721731}, { -484237150,  -958350608}, { -484972053,  -957978921}, 
+	{ -479821764,  -960568883}, { -480558369,  -960200582}, { -481294693,  -959831716}, { -482030733,  -959462286}, 
+	{ -476872522,  -962036435}, { -477610254,  -961670396}, { -478347705,  -961303790}, { -479084875,  -960936620}, 
+	{ -473918791,  -963494932}, { -474657643,  -963131157}, { -475396216,  -962766816}, { -476134509,  -962401909}, 
+	{ -470960600,  -964944360}, { -471700564,  -964582854}, { -472440251,  -964220780}, { -473179660,  -963858140}, 
+	{ -467997976,  -966384706}, { -468739046,  -966025471}, { -469479840,  -965665669}, { -470220358,  -965305298}, 
+	{ -465030947,  -967815955}, { -465773116,  -967458996}, { -466515010,  -967101468}, { -467256631,  -966743371}, 
+	{ -462059541,  -969238095}, { -462802801,  -968883415}, { -463545789,  -968528165}, { -464288505,  -968172345}, 
+	{ -459083786,  -970651112}, { -459828131,  -970298714}, { -460572205,  -969945745}, { -461316009,  -969592205}, 
+	{ -456103710,  -972054994}, { -456849132,  -971704881}, { -457594286,  -971354196}, { -458339171,  -971002940}, 
+	{ -453119340,  -973449725}, { -453865834,  -973101901}, { -454612060,  -972753504}, { -455358019,  -972404535}, 
+	{ -450130706,  -974835295}, { -450878263,  -974489762}, { -451625555,  -974143656}, { -452372581,  -973796977}, 
+	{ -447137835,  -976211688}, { -447886449,  -975868451}, { -448634799,  -975524639}, { -449382885,  -975180254}, 
+	{ -444140756,  -977578894}, { -444890419,  -977237955}, { -445639820,  -976896441}, { -446388959,  -976554352}, 
+	{ -441139496,  -978936898}, { -441890201,  -978598260}, { -442640647,  -978259047}, { -443390832,  -977919258}, 
+	{ -438134084,  -980285688}, { -438885824,  -979949355}, { -439637307,  -979612445}, { -440388531,  -979274960}, 
+	{ -435124548,  -981625251}, { -435877317,  -981291226}, { -436629829,  -980956623}, { -437382085,  -980621444}, 
+	{ -432110916,  -982955574}, { -432864706,  -982623860}, { -433618242,  -982291568}, { -434371523,  -981958698}, 
+	{ -429093217,  -984276646}, { -429848022,  -983947246}, { -430602573,  -983617267}, { -431356872,  -983286710}, 
+	{ -426071480,  -985588453}, { -426827291,  -985261370}, { -427582852,  -984933708}, { -428338160,  -984605467}, 
+	{ -423045732,  -986890984}, { -423802543,  -986566221}, { -424559105,  -986240879}, { -425315418,  -985914956}, 
+	{ -420016002,  -988184225}, { -420773806,  -987861786}, { -421531363,  -987538766}, { -422288671,  -987215165}, 
+	{ -416982319,  -989468165}, { -417741109,  -989148053}, { -418499653,  -988827359}, { -419257951,  -988506083}, 
+	{ -413944711,  -990742793}, { -414704479,  -990425010}, { -415464004,  -990106644}, { -416223284,  -989787696}, 
+	{ -410903207,  -992008094}, { -411663946,  -991692644}, { -412424444,  -991376610}, { -413184699,  -991059993}, 
+	{ -407857835,  -993264059}, { -408619539,  -992950944}, { -409381002,  -992637245}, { -410142225,  -992322961}, 
+	{ -404808624,  -994510675}, { -405571285,  -994199898}, { -406333708,  -993888536}, { -407095891,  -993576590}, 
+	{ -401755603,  -995747930}, { -402519214,  -995439494}, { -403282588,  -995130473}, { -404045725,  -994820867}, 
+	{ -398698801,  -996975812}, { -399463355,  -996669721}, { -400227673,  -996363043}, { -400991756,  -996055780}, 
+	{ -395638246,  -998194311}, { -396403735,  -997890567}, { -397168991,  -997586236}, { -397934013,  -997281317}, 
+	{ -392573967,  -999403415}, { -393340384,  -999102020}, { -394106570,  -998800038}, { -394872524,  -998497468}, 
+	{ -389505993, -1000603111}, { -390273331, -1000304069}, { -391040440, -1000004439}, { -391807319,  -999704221}, 
+	{ -386434353, -1001793390}, { -387202605, -1001496704}, { -387970630, -1001199428}, { -388738426, -1000901564}, 
+	{ -383359076, -1002974239}, { -384128234, -1002679911}, { -384897167, -1002384994}, { -385665873, -1002089486}, 
+	{ -380280190, -1004145648}, { -381050248, -1003853681}, { -381820082, -1003561124}, { -382589691, -1003267977}, 
+	{ -377197725, -1005307605}, { -377968675, -1005018003}, { -378739403, -1004727809}, { -379509908, -1004437024}, 
+	{ -374111709, -1006460100}, { -374883544, -1006172864}, { -375655159, -1005885036}, { -376426553, -1005596617}, 
+	{ -371022173, -1007603122}, { -371794885, -1007318256}, { -372567379, -1007032796}, { -373339654, -1006746744}, 
+	{ -367929144, -1008736660}, { -368702727, -1008454166}, { -369476093, -1008171077}, { -370249242, -1007887396}, 
+	{ -364832652, -1009860704}, { -365607098, -1009580584}, { -366381329, -1009299870}, { -367155344, -1009018562}, 
+	{ -361732726, -1010975242}, { -362508027, -1010697499}, { -363283116, -1010419162}, { -364057991, -1010140230}, 
+	{ -358629395, -1012080264}, { -359405545, -1011804901}, { -360181484, -1011528943}, { -360957211, -1011252390}, 
+	{ -355522689, -1013175761}, { -356299680, -1012902780}, { -357076462, -1012629204}, { -357853034, -1012355032}, 
+	{ -352412636, -1014261721}, { -353190461, -1013991126}, { -353968079, -1013719934}, { -354745488, -1013448145}, 
+	{ -349299266, -1015338134}, { -350077918, -1015069927}, { -350856364, -1014801122}, { -351634604, -1014531720}, 
+	{ -346182609, -1016404991}, { -346962080, -1016139173}, { -347741347, -1015872758}, { -348520409, -1015605745}, 
+	{ -343062693, -1017462281}, { -343842976, -1017198856}, { -344623057, -1016934832}, { -345402934, -1016670211}, 
+	{ -339939549, -1018509994}, { -340720636, -1018248964}, { -341501523, -1017987335}, { -342282209, -1017725107}, 
+	{ -336813204, -1019548121}, { -337595089, -1019289488}, { -338376774, -1019030256}, { -339158261, -1018770425}, 
+	{ -333683689, -1020576651}, { -334466364, -1020320418}, { -335248841, -1020063586}, { -336031121, -1019806153}, 
+	{ -330551034, -1021595575}, { -331334491, -1021341745}, { -332117752, -1021087314}, { -332900819, -1020832283}, 
+	{ -327415267, -1022604883}, { -328199499, -1022353458}, { -328983538, -1022101432}, { -329767383, -1021848804}, 
+	{ -324276419, -1023604567}, { -325061418, -1023355549}, { -325846226, -1023105929}, { -326630843, -1022855707}, 
+	{ -321134518, -1024594615}, { -321920278, -1024348007}, { -322705848, -1024100796}, { -323491229, -1023852982}, 
+	{ -317989595, -1025575020}, { -318776108, -1025330824}, { -319562433, -1025086024}, { -320348570, -1024840621}, 
+	{ -314841679, -1026545772}, { -315628937, -1026303990}, { -316416009, -1026061603}, { -317202895, -1025818614}, 
+	{ -311690799, -1027506862}, { -312478795, -1027267495}, { -313266607, -1027027525}, { -314054235, -1026786951}, 
+	{ -308536985, -1028458280}, { -309325712, -1028221332}, { -310114257, -1027983780}, { -310902619, -1027745623}, 
+	{ -305380268, -1029400018}, { -306169718, -1029165491}, { -306958988, -1028930359}, { -307748077, -1028694622}, 
+	{ -302220676, -1030332067}, { -303010842, -1030099963}, { -303800829, -1029867254}, { -304590638, -1029633939}, 
+	{ -299058239, -1031254418}, { -299849113, -1031024740}, { -300639811, -1030794455}, { -301430332, -1030563564}, 
+	{ -295892988, -1032167062}, { -296684563, -1031939812}, { -297475964, -1031711954}, { -298267189, -1031483489}, 
+	{ -292724951, -1033069992}, { -293517220, -1032845170}, { -294309316, -1032619742}, { -295101239, -1032393706}, 
+	{ -289554160, -1033963197}, { -290347114, -1033740808}, { -291139898, -1033517810}, { -291932511, -1033294205}, 
+	{ -286380643, -1034846671}, { -287174276, -1034626715}, { -287967740, -1034406151}, { -288761035, -1034184978}, 
+	{ -283204430, -1035720404}, { -283998734, -1035502884}, { -284792871, -1035284755}, { -285586841, -1035066018}, 
+	{ -280025552, -1036584389}, { -280820520, -1036369307}, { -281615322, -1036153615}, { -282409959, -1035937314}, 
+	{ -276844038, -1037438617}, { -277639662, -1037225975}, { -278435122, -1037012723}, { -279230419, -1036798861}, 
+	{ -273659918, -1038283080}, { -274456191, -1038072880}, { -275252302, -1037862069}, { -276048251, -1037650648}, 
+	{ -270473223, -1039117770}, { -271270136, -1038910014}, { -272066891, -1038701647}, { -272863485, -1038492669}, 
+	{ -267283981, -1039942680}, { -268081529, -1039737370}, { -268878918, -1039531448}, { -269676150, -1039324915}, 
+	{ -264092224, -1040757802}, { -264890398, -1040554939}, { -265688415, -1040351465}, { -266486277, -1040147378}, 
+	{ -260897982, -1041563127}, { -261696774, -1041362715}, { -262495412, -1041161689}, { -263293896, -1040960052}, 
+	{ -257701283, -1042358649}, { -258500686, -1042160688}, { -259299937, -1041962114}, { -260099036, -1041762927}, 
+	{ -254502159, -1043144360}, { -255302166, -1042948852}, { -256102022, -1042752731}, { -256901728, -1042555997}, 
+	{ -251300640, -1043920252}, { -252101242, -1043727200}, { -252901697, -1043533534}, { -253702003, -1043339254}, 
+	{ -248096755, -1044686319}, { -248897946, -1044495724}, { -249698991, -1044304514}, { -250499889, -1044112690}, 
+	{ -244890535, -1045442553}, { -245692307, -1045254416}, { -246493935, -1045065665}, { -247295417, -1044876299}, 
+	{ -241682010, -1046188946}, { -242484355, -1046003271}, { -243286558, -1045816980}, { -244088618, -1045630074}, 
+	{ -238471210, -1046925492}, { -239274121, -1046742279}, { -240076892, -1046558451}, { -240879522, -1046374006}, 
+	{ -235258165, -1047652185}, { -236061635, -1047471436}, { -236864966, -1047290071}, { -237668158, -1047108090}, 
+	{ -232042906, -1048369016}, { -232846927, -1048190733}, { -233650811, -1048011834}, { -234454557, -1047832317}, 
+	{ -228825464, -1049075980}, { -229630027, -1048900165}, { -230434456, -1048723732}, { -231238749, -1048546683}, 
+	{ -225605867, -1049773069}, { -226410966, -1049599723}, { -227215933, -1049425759}, { -228020765, -1049251178}, 
+	{ -222384147, -1050460278}, { -223189774, -1050289403}, { -223995270, -1050117909}, { -224800635, -1049945798}, 
+	{ -219160334, -1051137599}, { -219966481, -1050969196}, { -220772500, -1050800175}, { -221578389, -1050630536}, 
+	{ -215934457, -1051805027}, { -216741118, -1051639098}, { -217547651, -1051472550}, { -218354057, -1051305384}, 
+	{ -212706549, -1052462555}, { -213513715, -1052299101}, { -214320755, -1052135029}, { -215127670, -1051970337}, 
+	{ -209476638, -1053110176}, { -210284302, -1052949200}, { -211091842, -1052787604}, { -211899258, -1052625389}, 
+	{ -206244756, -1053747885}, { -207052910, -1053589387}, { -207860942, -1053430270}, { -208668851, -1053270533}, 
+	{ -203010932, -1054375676}, { -203819569, -1054219658}, { -204628085, -1054063021}, { -205436481, -1053905763}, 
+	{ -199775198, -1054993543}, { -200584309, -1054840007}, { -201393302, -1054685850}, { -202202177, -1054531073}, 
+	{ -196537583, -1055601479}, { -197347161, -1055450426}, { -198156624, -1055298753}, { -198965969, -1055146458}, 
+	{ -193298119, -1056199480}, { -194108156, -1056050912}, { -194918080, -1055901722}, { -195727889, -1055751911}, 
+	{ -190056834, -1056787540}, { -190867324, -1056641457}, { -191677702, -1056494753}, { -192487967, -1056347427}, 
+	{ -186813762, -1057365653}, { -187624696, -1057222057}, { -188435520, -1057077840}, { -189246233, -1056933001}, 
+	{ -183568930, -1057933813}, { -184380301, -1057792706}, { -185191564, -1057650977}, { -186002717, -1057508626}, 
+	{ -180322371, -1058492016}, { -181134171, -1058353399}, { -181945865, -1058214159}, { -182757451, -1058074297}, 
+	{ -177074115, -1059040255}, { -177886336, -1058904130}, { -178698453, -1058767381}, { -179510465, -1058630010}, 
+	{ -173824192, -1059578527}, { -174636827, -1059444894}, { -175449360, -1059310638}, { -176261789, -1059175758}, 
+	{ -170572633, -1060106826}, { -171385674, -1059975686}, { -172198615, -1059843923}, { -173011454, -1059711537}, 
+	{ -167319468, -1060625146}, { -168132908, -1060496502}, { -168946249, -1060367233}, { -169759491, -1060237341}, 
+	{ -164064728, -1061133483}, { -164878559, -1061007335}, { -165692293, -1060880563}, { -166505929, -1060753166}, 
+	{ -160808445, -1061631833}, { -161622659, -1061508182}, { -162436778, -1061383907}, { -163250801, -1061259007}, 
+	{ -157550647, -1062120190}, { -158365237, -1061999038}, { -159179733, -1061877261}, { -159994136, -1061754859}, 
+	{ -154291367, -1062598550}, { -155106324, -1062479898}, { -155921191, -1062360620}, { -156735965, -1062240717}, 
+	{ -151030634, -1063066909}, { -151845952, -1062950757}, { -152661180, -1062833980}, { -153476319, -1062716578}, 
+	{ -147768480, -1063525261}, { -148584150, -1063411611}, { -149399733, -1063297336}, { -150215228, -1063182435}, 
+	{ -144504935, -1063973603}, { -145320950, -1063862456}, { -146136880, -1063750684}, { -146952723, -1063638285}, 
+	{ -141240030, -1064411931}, { -142056382, -1064303288}, { -142872651, -1064194019}, { -143688835, -1064084124}, 
+	{ -137973796, -1064840240}, { -138790477, -1064734102}, { -139607077, -1064627338}, { -140423595, -1064519947}, 
+	{ -134706263, -1065258526}, { -135523266, -1065154894}, { -136340190, -1065050636}, { -137157033, -1064945751}, 
+	{ -131437462, -1065666786}, { -132254779, -1065565661}, { -133072019, -1065463909}, { -133889180, -1065361531}, 
+	{ -128167423, -1066065015}, { -128985047, -1065966398}, { -129802595, -1065867154}, { -130620067, -1065767284}, 
+	{ -124896179, -1066453210}, { -125714101, -1066357102}, { -126531950, -1066260367}, { -127349724, -1066163005}, 
+	{ -121623759, -1066831367}, { -122441972, -1066737769}, { -123260114, -1066643544}, { -124078183, -1066548690}, 
+	{ -118350194, -1067199483}, { -119168691, -1067108396}, { -119987118, -1067016680}, { -120805474, -1066924338}, 
+	{ -115075515, -1067557554}, { -115894288, -1067468978}, { -116712992, -1067379774}, { -117531627, -1067289942}, 
+	{ -111799753, -1067905576}, { -112618793, -1067819513}, { -113437768, -1067732821}, { -114256675, -1067645501}, 
+	{ -108522939, -1068243547}, { -109342239, -1068159997}, { -110161476, -1068075818}, { -110980647, -1067991011}, 
+	{ -105245103, -1068571464}, { -106064656, -1068490427}, { -106884147, -1068408763}, { -107703574, -1068326469}, 
+	{ -101966277, -1068889322}, { -102786074, -1068810801}, { -103605812, -1068731650}, { -104425488, -1068651871}, 
+	{  -98686491, -1069197120}, {  -99506525, -1069121114}, { -100326502, -1069044479}, { -101146419, -1068967215}, 
+	{  -95405776, -1069494854}, {  -96226040, -1069421364}, {  -97046247, -1069347245}, {  -97866398, -1069272497}, 
+	{  -92124163, -1069782521}, {  -92944648, -1069711548}, {  -93765079, -1069639946}, {  -94585455, -1069567715}, 
+	{  -88841683, -1070060120}, {  -89662382, -1069991664}, {  -90483029, -1069922579}, {  -91303623, -1069852865}, 
+	{  -85558366, -1070327646}, {  -86379272, -1070261709}, {  -87200127, -1070195142}, {  -88020931, -1070127946}, 
+	{  -82274245, -1070585099}, {  -83095349, -1070521680}, {  -83916404, -1070457632}, {  -84737410, -1070392954}, 
+	{  -78989349, -1070832474}, {  -79810644, -1070771575}, {  -80631892, -1070710046}, {  -81453092, -1070647887}, 
+	{  -75703709, -1071069770}, {  -76525187, -1071011391}, {  -77346620, -1070952382}, {  -78168007, -1070892743}, 
+	{  -72417357, -1071296985}, {  -73239010, -1071241127}, {  -74060620, -1071184638}, {  -74882187, -1071127519}, 
+	{  -69130324, -1071514117}, {  -69952144, -1071460780}, {  -70773924, -1071406812}, {  -71595661, -1071352214}, 
+	{  -65842639, -1071721163}, {  -66664620, -1071670347}, {  -67486561, -1071618901}, {  -68308462, -1071566824}, 
+	{  -62554335, -1071918122}, {  -63376468, -1071869828}, {  -64198563, -1071820903}, {  -65020620, -1071771349}, 
+	{  -59265442, -1072104991}, {  -60087719, -1072059220}, {  -60909960, -1072012818}, {  -61732166, -1071965785}, 
+	{  -55975992, -1072281769}, {  -56798405, -1072238521}, {  -57620785, -1072194642}, {  -58443131, -1072150132}, 
+	{  -52686014, -1072448455}, {  -53508556, -1072407730}, {  -54331067, -1072366374}, {  -55153545, -1072324387}, 
+	{  -49395541, -1072605046}, {  -50218204, -1072566845}, {  -51040837, -1072528012}, {  -51863441, -1072488549}, 
+	{  -46104602, -1072751542}, {  -46927379, -1072715864}, {  -47750128, -1072679556}, {  -48572848, -1072642617}, 
+	{  -42813230, -1072887940}, {  -43636112, -1072854787}, {  -44458968, -1072821003}, {  -45281799, -1072786588}, 
+	{  -39521455, -1073014240}, {  -40344435, -1072983612}, {  -41167391, -1072952352}, {  -41990323, -1072920462}, 
+	{  -36229307, -1073130440}, {  -37052377, -1073102337}, {  -37875426, -1073073603}, {  -38698452, -1073044237}, 
+	{  -32936819, -1073236540}, {  -33759971, -1073210962}, {  -34583104, -1073184753}, {  -35406216, -1073157912}, 
+	{  -29644021, -1073332538}, {  -30467248, -1073309485}, {  -31290457, -1073285802}, {  -32113647, -1073261486}, 
+	{  -26350943, -1073418433}, {  -27174237, -1073397906}, {  -27997515, -1073376748}, {  -28820776, -1073354959}, 
+	{  -23057618, -1073494225}, {  -23880971, -1073476224}, {  -24704310, -1073457592}, {  -25527634, -1073438328}, 
+	{  -19764076, -1073559913}, {  -20587480, -1073544438}, {  -21410872, -1073528332}, {  -22234252, -1073511594}, 
+	{  -16470347, -1073615496}, {  -17293795, -1073602547}, {  -18117233, -1073588967}, {  -18940660, -1073574756}, 
+	{  -13176464, -1073660973}, {  -13999948, -1073650551}, {  -14823423, -1073639498}, {  -15646890, -1073627812}, 
+	{   -9882456, -1073696345}, {  -10705968, -1073688450}, {  -11529474, -1073679922}, {  -12352972, -1073670764}, 
+	{   -6588356, -1073721611}, {   -7411888, -1073716242}, {   -8235416, -1073710241}, {   -9058939, -1073703609}, 
+	{   -3294193, -1073736771}, {   -4117738, -1073733928}, {   -4941281, -1073730454}, {   -5764820, -1073726348}, 
+	{          0, -1073741824}, {    -823550, -1073741508}, {   -1647099, -1073740561}, {   -2470647, -1073738982}, 
+	{    3294193, -1073736771}, {    2470647, -1073738982}, {    1647099, -1073740561}, {     823550, -1073741508}, 
+	{    6588356, -1073721611}, {    5764820, -1073726348}, {    4941281, -1073730454}, {    4117738, -1073733928}, 
+	{    9882456, -1073696345}, {    9058939, -1073703609}, {    8235416, -1073710241}, {    7411888, -1073716242}, 
+	{   13176464, -1073660973}, {   12352972, -1073670764}, {   11529474, -1073679922}, {   10705968, -1073688450}, 
+	{   16470347, -1073615496}, {   15646890, -1073627812}, {   14823423, -1073639498}, {   13999948, -1073650551}, 
+	{   19764076, -1073559913}, {   18940660, -1073574756}, {   18117233, -1073588967}, {   17293795, -1073602547}, 
+	{   23057618, -1073494225}, {   22234252, -1073511594}, {   21410872, -1073528332}, {   20587480, -1073544438}, 
+	{   26350943, -1073418433}, {   25527634, -1073438328}, {   24704310, -1073457592}, {   23880971, -1073476224}, 
+	{   29644021, -1073332538}, {   28820776, -1073354959}, {   27997515, -1073376748}, {   27174237, -1073397906}, 
+	{   32936819, -1073236540}, {   32113647, -1073261486}, {   31290457, -1073285802}, {   30467248, -1073309485}, 
+	{   36229307, -1073130440}, {   35406216, -1073157912}, {   34583104, -1073184753}, {   33759971, -1073210962}, 
+	{   39521455, -1073014240}, {   38698452, -1073044237}, {   37875426, -1073073603}, {   37052377, -1073102337}, 
+	{   42813230, -1072887940}, {   41990323, -1072920462}, {   41167391, -1072952352}, {   40344435, -1072983612}, 
+	{   46104602, -1072751542}, {   45281799, -1072786588}, {   44458968, -1072821003}, {   43636112, -1072854787}, 
+	{   49395541, -1072605046}, {   48572848, -1072642617}, {   47750128, -1072679556}, {   46927379, -1072715864}, 
+	{   52686014, -1072448455}, {   51863441, -1072488549}, {   51040837, -1072528012}, {   50218204, -1072566845}, 
+	{   55975992, -1072281769}, {   55153545, -1072324387}, {   54331067, -1072366374}, {   53508556, -1072407730}, 
+	{   59265442, -1072104991}, {   58443131, -1072150132}, {   57620785, -1072194642}, {   56798405, -1072238521}, 
+	{   62554335, -1071918122}, {   61732166, -1071965785}, {   60909960, -1072012818}, {   60087719, -1072059220}, 
+	{   65842639, -1071721163}, {   65020620, -1071771349}, {   64198563, -1071820903}, {   63376468, -1071869828}, 
+	{   69130324, -1071514117}, {   68308462, -1071566824}, {   67486561, -1071618901}, {   66664620, -1071670347}, 
+	{   72417357, -1071296985}, {   71595661, -1071352214}, {   70773924, -1071406812}, {   69952144, -1071460780}, 
+	{   75703709, -1071069770}, {   74882187, -1071127519}, {   74060620, -1071184638}, {   73239010, -1071241127}, 
+	{   78989349, -1070832474}, {   78168007, -1070892743}, {   77346620, -1070952382}, {   76525187, -1071011391}, 
+	{   82274245, -1070585099}, {   81453092, -1070647887}, {   80631892, -1070710046}, {   79810644, -1070771575}, 
+	{   85558366, -1070327646}, {   84737410, -1070392954}, {   83916404, -1070457632}, {   83095349, -1070521680}, 
+	{   88841683, -1070060120}, {   88020931, -1070127946}, {   87200127, -1070195142}, {   86379272, -1070261709}, 
+	{   92124163, -1069782521}, {   91303623, -1069852865}, {   90483029, -1069922579}, {   89662382, -1069991664}, 
+	{   95405776, -1069494854}, {   94585455, -1069567715}, {   93765079, -1069639946}, {   92944648, -1069711548}, 
+	{   98686491, -1069197120}, {   97866398, -1069272497}, {   97046247, -1069347245}, {   96226040, -1069421364}, 
+	{  101966277, -1068889322}, {  101146419, -1068967215}, {  100326502, -1069044479}, {   99506525, -1069121114}, 
+	{  105245103, -1068571464}, {  104425488, -1068651871}, {  103605812, -1068731650}, {  102786074, -1068810801}, 
+	{  108522939, -1068243547}, {  107703574, -1068326469}, {  106884147, -1068408763}, {  106064656, -1068490427}, 
+	{  111799753, -1067905576}, {  110980647, -1067991011}, {  110161476, -1068075818}, {  109342239, -1068159997}, 
+	{  115075515, -1067557554}, {  114256675, -1067645501}, {  113437768, -1067732821}, {  112618793, -1067819513}, 
+	{  118350194, -1067199483}, {  117531627, -1067289942}, {  116712992, -1067379774}, {  115894288, -1067468978}, 
+	{  121623759, -1066831367}, {  120805474, -1066924338}, {  119987118, -1067016680}, {  119168691, -1067108396}, 
+	{  124896179, -1066453210}, {  124078183, -1066548690}, {  123260114, -1066643544}, {  122441972, -1066737769}, 
+	{  128167423, -1066065015}, {  127349724, -1066163005}, {  126531950, -1066260367}, {  125714101, -1066357102}, 
+	{  131437462, -1065666786}, {  130620067, -1065767284}, {  129802595, -1065867154}, {  128985047, -1065966398}, 
+	{  134706263, -1065258526}, {  133889180, -1065361531}, {  133072019, -1065463909}, {  132254779, -1065565661}, 
+	{  137973796, -1064840240}, {  137157033, -1064945751}, {  136340190, -1065050636}, {  135523266, -1065154894}, 
+	{  141240030, -1064411931}, {  140423595, -1064519947}, {  139607077, -1064627338}, {  138790477, -1064734102}, 
+	{  144504935, -1063973603}, {  143688835, -1064084124}, {  142872651, -1064194019}, {  142056382, -1064303288}, 
+	{  147768480, -1063525261}, {  146952723, -1063638285}, {  146136880, -1063750684}, {  145320950, -1063862456}, 
+	{  151030634, -1063066909}, {  150215228, -1063182435}, {  149399733, -1063297336}, {  148584150, -1063411611}, 
+	{  154291367, -1062598550}, {  153476319, -1062716578}, {  152661180, -1062833980}, {  151845952, -1062950757}, 
+	{  157550647, -1062120190}, {  156735965, -1062240717}, {  155921191, -1062360620}, {  155106324, -1062479898}, 
+	{  160808445, -1061631833}, {  159994136, -1061754859}, {  159179733, -1061877261}, {  158365237, -1061999038}, 
+	{  164064728, -1061133483}, {  163250801, -1061259007}, {  162436778, -1061383907}, {  161622659, -1061508182}, 
+	{  167319468, -1060625146}, {  166505929, -1060753166}, {  165692293, -1060880563}, {  164878559, -1061007335}, 
+	{  170572633, -1060106826}, {  169759491, -1060237341}, {  168946249, -1060367233}, {  168132908, -1060496502}, 
+	{  173824192, -1059578527}, {  173011454, -1059711537}, {  172198615, -1059843923}, {  171385674, -1059975686}, 
+	{  177074115, -1059040255}, {  176261789, -1059175758}, {  175449360, -1059310638}, {  174636827, -1059444894}, 
+	{  180322371, -1058492016}, {  179510465, -1058630010}, {  178698453, -1058767381}, {  177886336, -1058904130}, 
+	{  183568930, -1057933813}, {  182757451, -1058074297}, {  181945865, -1058214159}, {  181134171, -1058353399}, 
+	{  186813762, -1057365653}, {  186002717, -1057508626}, {  185191564, -1057650977}, {  184380301, -1057792706}, 
+	{  190056834, -1056787540}, {  189246233, -1056933001}, {  188435520, -1057077840}, {  187624696, -1057222057}, 
+	{  193298119, -1056199480}, {  192487967, -1056347427}, {  191677702, -1056494753}, {  190867324, -1056641457}, 
+	{  196537583, -1055601479}, {  195727889, -1055751911}, {  194918080, -1055901722}, {  194108156, -1056050912}, 
+	{  199775198, -1054993543}, {  198965969, -1055146458}, {  198156624, -1055298753}, {  197347161, -1055450426}, 
+	{  203010932, -1054375676}, {  202202177, -1054531073}, {  201393302, -1054685850}, {  200584309, -1054840007}, 
+	{  206244756, -1053747885}, {  205436481, -1053905763}, {  204628085, -1054063021}, {  203819569, -1054219658}, 
+	{  209476638, -1053110176}, {  208668851, -1053270533}, {  207860942, -1053430270}, {  207052910, -1053589387}, 
+	{  212706549, -1052462555}, {  211899258, -1052625389}, {  211091842, -1052787604}, {  210284302, -1052949200}, 
+	{  215934457, -1051805027}, {  215127670, -1051970337}, {  214320755, -1052135029}, {  213513715, -1052299101}, 
+	{  219160334, -1051137599}, {  218354057, -1051305384}, {  217547651, -1051472550}, {  216741118, -1051639098}, 
+	{  222384147, -1050460278}, {  221578389, -1050630536}, {  220772500, -1050800175}, {  219966481, -1050969196}, 
+	{  225605867, -1049773069}, {  224800635, -1049945798}, {  223995270, -1050117909}, {  223189774, -1050289403}, 
+	{  228825464, -1049075980}, {  228020765, -1049251178}, {  227215933, -1049425759}, {  226410966, -1049599723}, 
+	{  232042906, -1048369016}, {  231238749, -1048546683}, {  230434456, -1048723732}, {  229630027, -1048900165}, 
+	{  235258165, -1047652185}, {  234454557, -1047832317}, {  233650811, -1048011834}, {  232846927, -1048190733}, 
+	{  238471210, -1046925492}, {  237668158, -1047108090}, {  236864966, -1047290071}, {  236061635, -1047471436}, 
+	{  241682010, -1046188946}, {  240879522, -1046374006}, {  240076892, -1046558451}, {  239274121, -1046742279}, 
+	{  244890535, -1045442553}, {  244088618, -1045630074}, {  243286558, -1045816980}, {  242484355, -1046003271}, 
+	{  248096755, -1044686319}, {  247295417, -1044876299}, {  246493935, -1045065665}, {  245692307, -1045254416}, 
+	{  251300640, -1043920252}, {  250499889, -1044112690}, {  249698991, -1044304514}, {  248897946, -1044495724}, 
+	{  254502159, -1043144360}, {  253702003, -1043339254}, {  252901697, -1043533534}, {  252101242, -1043727200}, 
+	{  257701283, -1042358649}, {  256901728, -1042555997}, {  256102022, -1042752731}, {  255302166, -1042948852}, 
+	{  260897982, -1041563127}, {  260099036, -1041762927}, {  259299937, -1041962114}, {  258500686, -1042160688}, 
+	{  264092224, -1040757802}, {  263293896, -1040960052}, {  262495412, -1041161689}, {  261696774, -1041362715}, 
+	{  267283981, -1039942680}, {  266486277, -1040147378}, {  265688415, -1040351465}, {  264890398, -1040554939}, 
+	{  270473223, -1039117770}, {  269676150, -1039324915}, {  268878918, -1039531448}, {  268081529, -1039737370}, 
+	{  273659918, -1038283080}, {  272863485, -1038492669}, {  272066891, -1038701647}, {  271270136, -1038910014}, 
+	{  276844038, -1037438617}, {  276048251, -1037650648}, {  275252302, -1037862069}, {  274456191, -1038072880}, 
+	{  280025552, -1036584389}, {  279230419, -1036798861}, {  278435122, -1037012723}, {  277639662, -1037225975}, 
+	{  283204430, -1035720404}, {  282409959, -1035937314}, {  281615322, -1036153615}, {  280820520, -1036369307}, 
+	{  286380643, -1034846671}, {  285586841, -1035066018}, {  284792871, -1035284755}, {  283998734, -1035502884}, 
+	{  289554160, -1033963197}, {  288761035, -1034184978}, {  287967740, -1034406151}, {  287174276, -1034626715}, 
+	{  292724951, -1033069992}, {  291932511, -1033294205}, {  291139898, -1033517810}, {  290347114, -1033740808}, 
+	{  295892988, -1032167062}, {  295101239, -1032393706}, {  294309316, -1032619742}, {  293517220, -1032845170}, 
+	{  299058239, -1031254418}, {  298267189, -1031483489}, {  297475964, -1031711954}, {  296684563, -1031939812}, 
+	{  302220676, -1030332067}, {  301430332, -1030563564}, {  300639811, -1030794455}, {  299849113, -1031024740}, 
+	{  305380268, -1029400018}, {  304590638, -1029633939}, {  303800829, -1029867254}, {  303010842, -1030099963}, 
+	{  308536985, -1028458280}, {  307748077, -1028694622}, {  306958988, -1028930359}, {  306169718, -1029165491}, 
+	{  311690799, -1027506862}, {  310902619, -1027745623}, {  310114257, -1027983780}, {  309325712, -1028221332}, 
+	{  314841679, -1026545772}, {  314054235, -1026786951}, {  313266607, -1027027525}, {  312478795, -1027267495}, 
+	{  317989595, -1025575020}, {  317202895, -1025818614}, {  316416009, -1026061603}, {  315628937, -1026303990}, 
+	{  321134518, -1024594615}, {  320348570, -1024840621}, {  319562433, -1025086024}, {  318776108, -1025330824}, 
+	{  324276419, -1023604567}, {  323491229, -1023852982}, {  322705848, -1024100796}, {  321920278, -1024348007}, 
+	{  327415267, -1022604883}, {  326630843, -1022855707}, {  325846226, -1023105929}, {  325061418, -1023355549}, 
+	{  330551034, -1021595575}, {  329767383, -1021848804}, {  328983538, -1022101432}, {  328199499, -1022353458}, 
+	{  333683689, -1020576651}, {  332900819, -1020832283}, {  332117752, -1021087314}, {  331334491, -1021341745}, 
+	{  336813204, -1019548121}, {  336031121, -1019806153}, {  335248841, -1020063586}, {  334466364, -1020320418}, 
+	{  339939549, -1018509994}, {  339158261, -1018770425}, {  338376774, -1019030256}, {  337595089, -1019289488}, 
+	{  343062693, -1017462281}, {  342282209, -1017725107}, {  341501523, -1017987335}, {  340720636, -1018248964}, 
+	{  346182609, -1016404991}, {  345402934, -1016670211}, {  344623057, -1016934832}, {  343842976, -1017198856}, 
+	{  349299266, -1015338134}, {  348520409, -1015605745}, {  347741347, -1015872758}, {  346962080, -1016139173}, 
+	{  352412636, -1014261721}, {  351634604, -1014531720}, {  350856364, -1014801122}, {  350077918, -1015069927}, 
+	{  355522689, -1013175761}, {  354745488, -1013448145}, {  353968079, -1013719934}, {  353190461, -1013991126}, 
+	{  358629395, -1012080264}, {  357853034, -1012355032}, {  357076462, -1012629204}, {  356299680, -1012902780}, 
+	{  361732726, -1010975242}, {  360957211, -1011252390}, {  360181484, -1011528943}, {  359405545, -1011804901}, 
+	{  364832652, -1009860704}, {  364057991, -1010140230}, {  363283116, -1010419162}, {  362508027, -1010697499}, 
+	{  367929144, -1008736660}, {  367155344, -1009018562}, {  366381329, -1009299870}, {  365607098, -1009580584}, 
+	{  371022173, -1007603122}, {  370249242, -1007887396}, {  369476093, -1008171077}, {  368702727, -1008454166}, 
+	{  374111709, -1006460100}, {  373339654, -1006746744}, {  372567379, -1007032796}, {  371794885, -1007318256}, 
+	{  377197725, -1005307605}, {  376426553, -1005596617}, {  375655159, -1005885036}, {  374883544, -1006172864}, 
+	{  380280190, -1004145648}, {  379509908, -1004437024}, {  378739403, -1004727809}, {  377968675, -1005018003}, 
+	{  383359076, -1002974239}, {  382589691, -1003267977}, {  381820082, -1003561124}, {  381050248, -1003853681}, 
+	{  386434353, -1001793390}, {  385665873, -1002089486}, {  384897167, -1002384994}, {  384128234, -1002679911}, 
+	{  389505993, -1000603111}, {  388738426, -1000901564}, {  387970630, -1001199428}, {  387202605, -1001496704}, 
+	{  392573967,  -999403415}, {  391807319,  -999704221}, {  391040440, -1000004439}, {  390273331, -1000304069}, 
+	{  395638246,  -998194311}, {  394872524,  -998497468}, {  394106570,  -998800038}, {  393340384,  -999102020}, 
+	{  398698801,  -996975812}, {  397934013,  -997281317}, {  397168991,  -997586236}, {  396403735,  -997890567}, 
+	{  401755603,  -995747930}, {  400991756,  -996055780}, {  400227673,  -996363043}, {  399463355,  -996669721}, 
+	{  404808624,  -994510675}, {  404045725,  -994820867}, {  403282588,  -995130473}, {  402519214,  -995439494}, 
+	{  407857835,  -993264059}, {  407095891,  -993576590}, {  406333708,  -993888536}, {  405571285,  -994199898}, 
+	{  410903207,  -992008094}, {  410142225,  -992322961}, {  409381002,  -992637245}, {  408619539,  -992950944}, 
+	{  413944711,  -990742793}, {  413184699,  -991059993}, {  412424444,  -991376610}, {  411663946,  -991692644}, 
+	{  416982319,  -989468165}, {  416223284,  -989787696}, {  415464004,  -990106644}, {  414704479,  -990425010}, 
+	{  420016002,  -988184225}, {  419257951,  -988506083}, {  418499653,  -988827359}, {  417741109,  -989148053}, 
+	{  423045732,  -986890984}, {  422288671,  -987215165}, {  421531363,  -987538766}, {  420773806,  -987861786}, 
+	{  426071480,  -985588453}, {  425315418,  -985914956}, {  424559105,  -986240879}, {  423802543,  -986566221}, 
+	{  429093217,  -984276646}, {  428338160,  -984605467}, {  427582852,  -984933708}, {  426827291,  -985261370}, 
+	{  432110916,  -982955574}, {  431356872,  -983286710}, {  430602573,  -983617267}, {  429848022,  -983947246}, 
+	{  435124548,  -981625251}, {  434371523,  -981958698}, {  433618242,  -982291568}, {  432864706,  -982623860}, 
+	{  438134084,  -980285688}, {  437382085,  -980621444}, {  436629829,  -980956623}, {  435877317,  -981291226}, 
+	{  441139496,  -978936898}, {  440388531,  -979274960}, {  439637307,  -979612445}, {  438885824,  -979949355}, 
+	{  444140756,  -977578894}, {  443390832,  -977919258}, {  442640647,  -978259047}, {  441890201,  -978598260}, 
+	{  447137835,  -976211688}, {  446388959,  -976554352}, {  445639820,  -976896441}, {  444890419,  -977237955}, 
+	{  450130706,  -974835295}, {  449382885,  -975180254}, {  448634799,  -975524639}, {  447886449,  -975868451}, 
+	{  453119340,  -973449725}, {  452372581,  -973796977}, {  451625555,  -974143656}, {  450878263,  -974489762}, 
+	{  456103710,  -972054994}, {  455358019,  -972404535}, {  454612060,  -972753504}, {  453865834,  -973101901}, 
+	{  459083786,  -970651112}, {  458339171,  -971002940}, {  457594286,  -971354196}, {  456849132,  -971704881}, 
+	{  462059541,  -969238095}, {  461316009,  -969592205}, {  460572205,  -969945745}, {  459828131,  -970298714}, 
+	{  465030947,  -967815955}, {  464288505,  -968172345}, {  463545789,  -968528165}, {  462802801,  -968883415}, 
+	{  467997976,  -966384706}, {  467256631,  -966743371}, {  466515010,  -967101468}, {  465773116,  -967458996}, 
+	{  470960600,  -964944360}, {  470220358,  -965305298}, {  469479840,  -965665669}, {  468739046,  -966025471}, 
+	{  473918791,  -963494932}, {  473179660,  -963858140}, {  472440251,  -964220780}, {  471700564,  -964582854}, 
+	{  476872522,  -962036435}, {  476134509,  -962401909}, {  475396216,  -962766816}, {  474657643,  -963131157}, 
+	{  479821764,  -960568883}, {  479084875,  -960936620}, {  478347705,  -961303790}, {  477610254,  -961670396}, 
+	{  482766489,  -959092290}, {  482030733,  -959462286}, {  481294693,  -959831716}, {  480558369,  -960200582}, 
+	{  485706671,  -957606670}, {  484972053,  -957978921}, {  484237150,  -958350608}, {  483501962,  -958721731}, 
+	{  488642281,  -956112036}, {  487908809,  -956486539}, {  487175049,  -956860479}, {  486441003,  -957233856}, 
+	{  491573292,  -954608403}, {  490840972,  -954985154}, {  490108363,  -955361344}, {  489375466,  -955736971}, 
+	{  494499676,  -953095785}, {  493768515,  -953474781}, {  493037064,  -953853216}, {  492305322,  -954231090}, 
+	{  497421405,  -951574196}, {  496691410,  -951955434}, {  495961124,  -952336111}, {  495230545,  -952716228}, 
+	{  500338453,  -950043650}, {  499609631,  -950427126}, {  498880516,  -950810042}, {  498151107,  -951192399}, 
+	{  503250791,  -948504163}, {  502523149,  -948889872}, {  501795212,  -949275023}, {  501066980,  -949659616}, 
+	{  506158392,  -946955747}, {  505431937,  -947343687}, {  504705185,  -947731070}, {  503978136,  -948117895}, 
+	{  509061229,  -945398418}, {  508335968,  -945788585}, {  507610408,  -946178196}, {  506884549,  -946567250}, 
+	{  511959275,  -943832191}, {  511235214,  -944224582}, {  510510853,  -944616416}, {  509786191,  -945007695}, 
+	{  514852502,  -942257081}, {  514129648,  -942651690}, {  513406493,  -943045745}, {  512683035,  -943439246}, 
+	{  517740883,  -940673101}, {  517019243,  -941069926}, {  516297300,  -941466198}, {  515575053,  -941861917}, 
+	{  520624391,  -939080267}, {  519903972,  -939479305}, {  519183248,  -939877790}, {  518462218,  -940275722}, 
+	{  523502998,  -937478595}, {  522783807,  -937879841}, {  522064309,  -938280535}, {  521344503,  -938680677}, 
+	{  526376678,  -935868098}, {  525658722,  -936271549}, {  524940456,  -936674448}, {  524221881,  -937076797}, 
+	{  529245404,  -934248793}, {  528528689,  -934654444}, {  527811662,  -935059546}, {  527094325,  -935464097}, 
+	{  532109148,  -932620694}, {  531393681,  -933028542}, {  530677900,  -933435842}, {  529961808,  -933842592}, 
+	{  534967884,  -930983817}, {  534253671,  -931393859}, {  533539144,  -931803352}, {  532824303,  -932212297}, 
+	{  537821584,  -929338177}, {  537108633,  -929750408}, {  536395365,  -930162092}, {  535681782,  -930573228}, 
+	{  540670223,  -927683790}, {  539958539,  -928098206}, {  539246538,  -928512076}, {  538534220,  -928925400}, 
+	{  543513772,  -926020672}, {  542803363,  -926437269}, {  542092635,  -926853322}, {  541381588,  -927268829}, 
+	{  546352205,  -924348837}, {  545643078,  -924767612}, {  544933630,  -925185843}, {  544223861,  -925603530}, 
+	{  549185496,  -922668302}, {  548477657,  -923089250}, {  547769495,  -923509656}, {  547061011,  -923929518}, 
+	{  552013618,  -920979082}, {  551307074,  -921402200}, {  550600205,  -921824777}, {  549893013,  -922246810}, 
+	{  554836544,  -919281194}, {  554131301,  -919706478}, {  553425732,  -920131221}, {  552719838,  -920555422}, 
+	{  557654248,  -917574653}, {  556950313,  -918002099}, {  556246051,  -918429004}, {  555541461,  -918855369}, 
+	{  560466703,  -915859476}, {  559764083,  -916289079}, {  559061133,  -916718143}, {  558357855,  -917146668}, 
+	{  563273883,  -914135678}, {  562572584,  -914567435}, {  561870954,  -914998653}, {  561168994,  -915429334}, 
+	{  566075761,  -912403276}, {  565375790,  -912837182}, {  564675486,  -913270551}, {  563974850,  -913703383}, 
+	{  568872310,  -910662286}, {  568173674,  -911098338}, {  567474703,  -911533853}, {  566775399,  -911968833}, 
+	{  571663506,  -908912725}, {  570966210,  -909350918}, {  570268579,  -909788576}, {  569570612,  -910225699}, 
+	{  574449320,  -907154608}, {  573753372,  -907594938}, {  573057087,  -908034735}, {  572360465,  -908473997}, 
+	{  577229728,  -905387953}, {  576535134,  -905830417}, {  575840202,  -906272347}, {  575144930,  -906713744}, 
+	{  580004702,  -903612776}, {  579311470,  -904057369}, {  578617896,  -904501429}, {  577923982,  -904944957}, 
+	{  582774218,  -901829095}, {  582082352,  -902275811}, {  581390144,  -902721998}, {  580697594,  -903167653}, 
+	{  585538248,  -900036924}, {  584847756,  -900485762}, {  584156920,  -900934069}, {  583465740,  -901381847}, 
+	{  588296766,  -898236282}, {  587607655,  -898687236}, {  586918198,  -899137661}, {  586228395,  -899587557}, 
+	{  591049748,  -896427186}, {  590362023,  -896880252}, {  589673951,  -897332790}, {  588985532,  -897784800}, 
+	{  593797166,  -894609652}, {  593110835,  -895064826}, {  592424154,  -895519473}, {  591737125,  -895973593}, 
+	{  596538995,  -892783698}, {  595854063,  -893240975}, {  595168781,  -893697727}, {  594483148,  -894153953}, 
+	{  599275210,  -890949341}, {  598591684,  -891408717}, {  597907806,  -891867569}, {  597223576,  -892325896}, 
+	{  602005783,  -889106597}, {  601323670,  -889568068}, {  600641203,  -890029016}, {  599958383,  -890489440}, 
+	{  604730691,  -887255485}, {  604049997,  -887719047}, {  603368947,  -888182086}, {  602687543,  -888644603}, 
+	{  607449906,  -885396022}, {  606770638,  -885861670}, {  606091012,  -886326796}, {  605411029,  -886791402}, 
+	{  610163404,  -883528225}, {  609485567,  -883995955}, {  608807372,  -884463164}, {  608128818,  -884929853}, 
+	{  612871159,  -881652112}, {  612194760,  -882121919}, {  611518001,  -882591207}, {  610840882,  -883059976}, 
+	{  615573145,  -879767701}, {  614898191,  -880239581}, {  614222875,  -880710943}, {  613547198,  -881181787}, 
+	{  618269338,  -877875009}, {  617595834,  -878348957}, {  616921967,  -878822389}, {  616247738,  -879295303}, 
+	{  620959711,  -875974054}, {  620287664,  -876450066}, {  619615253,  -876925563}, {  618942478,  -877400544}, 
+	{  623644239,  -874064853}, {  622973656,  -874542925}, {  622302707,  -875020483}, {  621631392,  -875497526}, 
+	{  626322897,  -872147426}, {  625653784,  -872627553}, {  624984303,  -873107167}, {  624314455,  -873586267}, 
+	{  628995660,  -870221790}, {  628328023,  -870703968}, {  627660017,  -871185633}, {  626991641,  -871666786}, 
+	{  631662503,  -868287963}, {  630996348,  -868772187}, {  630329823,  -869255900}, {  629662927,  -869739101}, 
+	{  634323400,  -866345964}, {  633658734,  -866832229}, {  632993696,  -867317984}, {  632328285,  -867803229}, 
+	{  636978327,  -864395810}, {  636315156,  -864884112}, {  635651611,  -865371905}, {  634987692,  -865859189}, 
+	{  639627258,  -862437520}, {  638965588,  -862927854}, {  638303543,  -863417681}, {  637641122,  -863906999}, 
+	{  642270169,  -860471112}, {  641610007,  -860963474}, {  640949467,  -861455330}, {  640288551,  -861946678}, 
+	{  644907034,  -858496606}, {  644248386,  -858990991}, {  643589359,  -859484870}, {  642929953,  -859978244}, 
+	{  647537830,  -856514019}, {  646880701,  -857010422}, {  646223192,  -857506321}, {  645565303,  -858001716}, 
+	{  650162530,  -854523370}, {  649506928,  -855021787}, {  648850943,  -855519701}, {  648194577,  -856017111}, 
+	{  652781111,  -852524677}, {  652127041,  -853025104}, {  651472587,  -853525028}, {  650817750,  -854024450}, 
+	{  655393548,  -850517961}, {  654741016,  -851020391}, {  654088099,  -851522321}, {  653434797,  -852023750}, 
+	{  657999816,  -848503239}, {  657348828,  -849007669}, {  656697454,  -849511600}, {  656045694,  -850015030}, 
+	{  660599890,  -846480531}, {  659950454,  -846986956}, {  659300629,  -847492882}, {  658650416,  -847998310}, 
+	{  663193747,  -844449856}, {  662545867,  -844958270}, {  661897597,  -845466188}, {  661248938,  -845973608}, 
+	{  665781362,  -842411232}, {  665135044,  -842921632}, {  664488336,  -843431536}, {  663841237,  -843940944}, 
+	{  668362709,  -840364679}, {  667717961,  -840877059}, {  667072820,  -841388945}, {  666427287,  -841900336}, 
+	{  670937767,  -838310216}, {  670294593,  -838824572}, {  669651026,  -839338435}, {  669007064,  -839851804}, 
+	{  673506508,  -836247863}, {  672864916,  -836764190}, {  672222928,  -837280024}, {  671580545,  -837795367}, 
+	{  676068911,  -834177638}, {  675428906,  -834695931}, {  674788504,  -835213733}, {  674147704,  -835731044}, 
+	{  678624950,  -832099562}, {  677986538,  -832619816}, {  677347728,  -833139580}, {  676708518,  -833658855}, 
+	{  681174602,  -830013654}, {  680537789,  -830535864}, {  679900576,  -831057586}, {  679262963,  -831578819}, 
+	{  683717842,  -827919934}, {  683082635,  -828444095}, {  682447025,  -828967769}, {  681811014,  -829490956}, 
+	{  686254647,  -825818421}, {  685621051,  -826344528}, {  684987051,  -826870150}, {  684352648,  -827395285}, 
+	{  688784993,  -823709135}, {  688153013,  -824237184}, {  687520629,  -824764748}, {  686887840,  -825291827}, 
+	{  691308855,  -821592095}, {  690678499,  -822122081}, {  690047736,  -822651583}, {  689416567,  -823180601}, 
+	{  693826211,  -819467323}, {  693197483,  -819999240}, {  692568348,  -820530675}, {  691938805,  -821061627}, 
+	{  696337036,  -817334838}, {  695709943,  -817868681}, {  695082441,  -818402043}, {  694454530,  -818934924}, 
+	{  698841307,  -815194659}, {  698215855,  -815730424}, {  697589992,  -816265709}, {  696963719,  -816800514}, 
+	{  701339000,  -813046808}, {  700715194,  -813584489}, {  700090977,  -814121692}, {  699466348,  -814658415}, 
+	{  703830092,  -810891304}, {  703207939,  -811430896}, {  702585372,  -811970011}, {  701962393,  -812508649}, 
+	{  706314559,  -808728167}, {  705694064,  -809269666}, {  705073155,  -809810688}, {  704451830,  -810351235}, 
+	{  708792378,  -806557419}, {  708173547,  -807100819}, {  707554301,  -807643743}, {  706934638,  -808186193}, 
+	{  711263525,  -804379079}, {  710646365,  -804924374}, {  710028787,  -805469196}, {  709410791,  -806013545}, 
+	{  713727978,  -802193167}, {  713112494,  -802740354}, {  712496590,  -803287068}, {  711880267,  -803833310}, 
+	{  716185713,  -799999706}, {  715571910,  -800548778}, {  714957687,  -801097379}, {  714343043,  -801645509}, 
+	{  718636707,  -797798714}, {  718024592,  -798349667}, {  717412054,  -798900150}, {  716799095,  -799450163}, 
+	{  721080937,  -795590213}, {  720470515,  -796143041}, {  719859669,  -796695401}, {  719248400,  -797247292}, 
+	{  723518380,  -793374223}, {  722909657,  -793928922}, {  722300508,  -794483153}, {  721690935,  -795036917}, 
+	{  725949013,  -791150767}, {  725341994,  -791707330}, {  724734549,  -792263427}, {  724126677,  -792819059}, 
+	{  728372813,  -788919863}, {  727767504,  -789478286}, {  727161768,  -790036244}, {  726555604,  -790593738}, 
+	{  730789757,  -786681534}, {  730186165,  -787241811}, {  729582143,  -787801625}, {  728977692,  -788360976}, 
+	{  733199822,  -784435800}, {  732597952,  -784997927}, {  731995651,  -785559591}, {  731392919,  -786120794}, 
+	{  735602987,  -782182683}, {  735002844,  -782746654}, {  734402269,  -783310163}, {  733801261,  -783873212}, 
+	{  737999228,  -779922204}, {  737400818,  -780488013}, {  736801974,  -781053363}, {  736202697,  -781618253}, 
+	{  740388522,  -777654384}, {  739791851,  -778222026}, {  739194745,  -778789210}, {  738597203,  -779355936}, 
+	{  742770848,  -775379244}, {  742175921,  -775948714}, {  741580558,  -776517728}, {  740984758,  -777086284}, 
+	{  745146182,  -773096806}, {  744553005,  -773668099}, {  743959390,  -774238936}, {  743365338,  -774809318}, 
+	{  747514503,  -770807092}, {  746923082,  -771380201}, {  746331221,  -771952857}, {  745738921,  -772525059}, 
+	{  749875788,  -768510122}, {  749286127,  -769085043}, {  748696026,  -769659512}, {  748105485,  -770233528}, 
+	{  752230015,  -766205919}, {  751642121,  -766782646}, {  751053785,  -767358923}, {  750465007,  -767934748}, 
+	{  754577161,  -763894504}, {  753991040,  -764473032}, {  753404474,  -765051111}, {  752817466,  -765628740}, 
+	{  756917205,  -761575898}, {  756332861,  -762156223}, {  755748072,  -762736098}, {  755162839,  -763315525}, 
+	{  759250125,  -759250125}, {  758667564,  -759832239}, {  758084557,  -760413906}, {  757501104,  -760995126}, 
+	{  761575898,  -756917205}, {  760995126,  -757501104}, {  760413906,  -758084557}, {  759832239,  -758667564}, 
+	{  763894504,  -754577161}, {  763315525,  -755162839}, {  762736098,  -755748072}, {  762156223,  -756332861}, 
+	{  766205919,  -752230015}, {  765628740,  -752817466}, {  765051111,  -753404474}, {  764473032,  -753991040}, 
+	{  768510122,  -749875788}, {  767934748,  -750465007}, {  767358923,  -751053785}, {  766782646,  -751642121}, 
+	{  770807092,  -747514503}, {  770233528,  -748105485}, {  769659512,  -748696026}, {  769085043,  -749286127}, 
+	{  773096806,  -745146182}, {  772525059,  -745738921}, {  771952857,  -746331221}, {  771380201,  -746923082}, 
+	{  775379244,  -742770848}, {  774809318,  -743365338}, {  774238936,  -743959390}, {  773668099,  -744553005}, 
+	{  777654384,  -740388522}, {  777086284,  -740984758}, {  776517728,  -741580558}, {  775948714,  -742175921}, 
+	{  779922204,  -737999228}, {  779355936,  -738597203}, {  778789210,  -739194745}, {  778222026,  -739791851}, 
+	{  782182683,  -735602987}, {  781618253,  -736202697}, {  781053363,  -736801974}, {  780488013,  -737400818}, 
+	{  784435800,  -733199822}, {  783873212,  -733801261}, {  783310163,  -734402269}, {  782746654,  -735002844}, 
+	{  786681534,  -730789757}, {  786120794,  -731392919}, {  785559591,  -731995651}, {  784997927,  -732597952}, 
+	{  788919863,  -728372813}, {  788360976,  -728977692}, {  787801625,  -729582143}, {  787241811,  -730186165}, 
+	{  791150767,  -725949013}, {  790593738,  -726555604}, {  790036244,  -727161768}, {  789478286,  -727767504}, 
+	{  793374223,  -723518380}, {  792819059,  -724126677}, {  792263427,  -724734549}, {  791707330,  -725341994}, 
+	{  795590213,  -721080937}, {  795036917,  -721690935}, {  794483153,  -722300508}, {  793928922,  -722909657}, 
+	{  797798714,  -718636707}, {  797247292,  -719248400}, {  796695401,  -719859669}, {  796143041,  -720470515}, 
+	{  799999706,  -716185713}, {  799450163,  -716799095}, {  798900150,  -717412054}, {  798349667,  -718024592}, 
+	{  802193167,  -713727978}, {  801645509,  -714343043}, {  801097379,  -714957687}, {  800548778,  -715571910}, 
+	{  804379079,  -711263525}, {  803833310,  -711880267}, {  803287068,  -712496590}, {  802740354,  -713112494}, 
+	{  806557419,  -708792378}, {  806013545,  -709410791}, {  805469196,  -710028787}, {  804924374,  -710646365}, 
+	{  808728167,  -706314559}, {  808186193,  -706934638}, {  807643743,  -707554301}, {  807100819,  -708173547}, 
+	{  810891304,  -703830092}, {  810351235,  -704451830}, {  809810688,  -705073155}, {  809269666,  -705694064}, 
+	{  813046808,  -701339000}, {  812508649,  -701962393}, {  811970011,  -702585372}, {  811430896,  -703207939}, 
+	{  815194659,  -698841307}, {  814658415,  -699466348}, {  814121692,  -700090977}, {  813584489,  -700715194}, 
+	{  817334838,  -696337036}, {  816800514,  -696963719}, {  816265709,  -697589992}, {  815730424,  -698215855}, 
+	{  819467323,  -693826211}, {  818934924,  -694454530}, {  818402043,  -695082441}, {  817868681,  -695709943}, 
+	{  821592095,  -691308855}, {  821061627,  -691938805}, {  820530675,  -692568348}, {  819999240,  -693197483}, 
+	{  823709135,  -688784993}, {  823180601,  -689416567}, {  822651583,  -690047736}, {  822122081,  -690678499}, 
+	{  825818421,  -686254647}, {  825291827,  -686887840}, {  824764748,  -687520629}, {  824237184,  -688153013}, 
+	{  827919934,  -683717842}, {  827395285,  -684352648}, {  826870150,  -684987051}, {  826344528,  -685621051}, 
+	{  830013654,  -681174602}, {  829490956,  -681811014}, {  828967769,  -682447025}, {  828444095,  -683082635}, 
+	{  832099562,  -678624950}, {  831578819,  -679262963}, {  831057586,  -679900576}, {  830535864,  -680537789}, 
+	{  834177638,  -676068911}, {  833658855,  -676708518}, {  833139580,  -677347728}, {  832619816,  -677986538}, 
+	{  836247863,  -673506508}, {  835731044,  -674147704}, {  835213733,  -674788504}, {  834695931,  -675428906}, 
+	{  838310216,  -670937767}, {  837795367,  -671580545}, {  837280024,  -672222928}, {  836764190,  -672864916}, 
+	{  840364679,  -668362709}, {  839851804,  -669007064}, {  839338435,  -669651026}, {  838824572,  -670294593}, 
+	{  842411232,  -665781362}, {  841900336,  -666427287}, {  841388945,  -667072820}, {  840877059,  -667717961}, 
+	{  844449856,  -663193747}, {  843940944,  -663841237}, {  843431536,  -664488336}, {  842921632,  -665135044}, 
+	{  846480531,  -660599890}, {  845973608,  -661248938}, {  845466188,  -661897597}, {  844958270,  -662545867}, 
+	{  848503239,  -657999816}, {  847998310,  -658650416}, {  847492882,  -659300629}, {  846986956,  -659950454}, 
+	{  850517961,  -655393548}, {  850015030,  -656045694}, {  849511600,  -656697454}, {  849007669,  -657348828}, 
+	{  852524677,  -652781111}, {  852023750,  -653434797}, {  851522321,  -654088099}, {  851020391,  -654741016}, 
+	{  854523370,  -650162530}, {  854024450,  -650817750}, {  853525028,  -651472587}, {  853025104,  -652127041}, 
+	{  856514019,  -647537830}, {  856017111,  -648194577}, {  855519701,  -648850943}, {  855021787,  -649506928}, 
+	{  858496606,  -644907034}, {  858001716,  -645565303}, {  857506321,  -646223192}, {  857010422,  -646880701}, 
+	{  860471112,  -642270169}, {  859978244,  -642929953}, {  859484870,  -643589359}, {  858990991,  -644248386}, 
+	{  862437520,  -639627258}, {  861946678,  -640288551}, {  861455330,  -640949467}, {  860963474,  -641610007}, 
+	{  864395810,  -636978327}, {  863906999,  -637641122}, {  863417681,  -638303543}, {  862927854,  -638965588}, 
+	{  866345964,  -634323400}, {  865859189,  -634987692}, {  865371905,  -635651611}, {  864884112,  -636315156}, 
+	{  868287963,  -631662503}, {  867803229,  -632328285}, {  867317984,  -632993696}, {  866832229,  -633658734}, 
+	{  870221790,  -628995660}, {  869739101,  -629662927}, {  869255900,  -630329823}, {  868772187,  -630996348}, 
+	{  872147426,  -626322897}, {  871666786,  -626991641}, {  871185633,  -627660017}, {  870703968,  -628328023}, 
+	{  874064853,  -623644239}, {  873586267,  -624314455}, {  873107167,  -624984303}, {  872627553,  -625653784}, 
+	{  875974054,  -620959711}, {  875497526,  -621631392}, {  875020483,  -622302707}, {  874542925,  -622973656}, 
+	{  877875009,  -618269338}, {  877400544,  -618942478}, {  876925563,  -619615253}, {  876450066,  -620287664}, 
+	{  879767701,  -615573145}, {  879295303,  -616247738}, {  878822389,  -616921967}, {  878348957,  -617595834}, 
+	{  881652112,  -612871159}, {  881181787,  -613547198}, {  880710943,  -614222875}, {  880239581,  -614898191}, 
+	{  883528225,  -610163404}, {  883059976,  -610840882}, {  882591207,  -611518001}, {  882121919,  -612194760}, 
+	{  885396022,  -607449906}, {  884929853,  -608128818}, {  884463164,  -608807372}, {  883995955,  -609485567}, 
+	{  887255485,  -604730691}, {  886791402,  -605411029}, {  886326796,  -606091012}, {  885861670,  -606770638}, 
+	{  889106597,  -602005783}, {  888644603,  -602687543}, {  888182086,  -603368947}, {  887719047,  -604049997}, 
+	{  890949341,  -599275210}, {  890489440,  -599958383}, {  890029016,  -600641203}, {  889568068,  -601323670}, 
+	{  892783698,  -596538995}, {  892325896,  -597223576}, {  891867569,  -597907806}, {  891408717,  -598591684}, 
+	{  894609652,  -593797166}, {  894153953,  -594483148}, {  893697727,  -595168781}, {  893240975,  -595854063}, 
+	{  896427186,  -591049748}, {  895973593,  -591737125}, {  895519473,  -592424154}, {  895064826,  -593110835}, 
+	{  898236282,  -588296766}, {  897784800,  -588985532}, {  897332790,  -589673951}, {  896880252,  -590362023}, 
+	{  900036924,  -585538248}, {  899587557,  -586228395}, {  899137661,  -586918198}, {  898687236,  -587607655}, 
+	{  901829095,  -582774218}, {  901381847,  -583465740}, {  900934069,  -584156920}, {  900485762,  -584847756}, 
+	{  903612776,  -580004702}, {  903167653,  -580697594}, {  902721998,  -581390144}, {  902275811,  -582082352}, 
+	{  905387953,  -577229728}, {  904944957,  -577923982}, {  904501429,  -578617896}, {  904057369,  -579311470}, 
+	{  907154608,  -574449320}, {  906713744,  -575144930}, {  906272347,  -575840202}, {  905830417,  -576535134}, 
+	{  908912725,  -571663506}, {  908473997,  -572360465}, {  908034735,  -573057087}, {  907594938,  -573753372}, 
+	{  910662286,  -568872310}, {  910225699,  -569570612}, {  909788576,  -570268579}, {  909350918,  -570966210}, 
+	{  912403276,  -566075761}, {  911968833,  -566775399}, {  911533853,  -567474703}, {  911098338,  -568173674}, 
+	{  914135678,  -563273883}, {  913703383,  -563974850}, {  913270551,  -564675486}, {  912837182,  -565375790}, 
+	{  915859476,  -560466703}, {  915429334,  -561168994}, {  914998653,  -561870954}, {  914567435,  -562572584}, 
+	{  917574653,  -557654248}, {  917146668,  -558357855}, {  916718143,  -559061133}, {  916289079,  -559764083}, 
+	{  919281194,  -554836544}, {  918855369,  -555541461}, {  918429004,  -556246051}, {  918002099,  -556950313}, 
+	{  920979082,  -552013618}, {  920555422,  -552719838}, {  920131221,  -553425732}, {  919706478,  -554131301}, 
+	{  922668302,  -549185496}, {  922246810,  -549893013}, {  921824777,  -550600205}, {  921402200,  -551307074}, 
+	{  924348837,  -546352205}, {  923929518,  -547061011}, {  923509656,  -547769495}, {  923089250,  -548477657}, 
+	{  926020672,  -543513772}, {  925603530,  -544223861}, {  925185843,  -544933630}, {  924767612,  -545643078}, 
+	{  927683790,  -540670223}, {  927268829,  -541381588}, {  926853322,  -542092635}, {  926437269,  -542803363}, 
+	{  929338177,  -537821584}, {  928925400,  -538534220}, {  928512076,  -539246538}, {  928098206,  -539958539}, 
+	{  930983817,  -534967884}, {  930573228,  -535681782}, {  930162092,  -536395365}, {  929750408,  -537108633}, 
+	{  932620694,  -532109148}, {  932212297,  -532824303}, {  931803352,  -533539144}, {  931393859,  -534253671}, 
+	{  934248793,  -529245404}, {  933842592,  -529961808}, {  933435842,  -530677900}, {  933028542,  -531393681}, 
+	{  935868098,  -526376678}, {  935464097,  -527094325}, {  935059546,  -527811662}, {  934654444,  -528528689}, 
+	{  937478595,  -523502998}, {  937076797,  -524221881}, {  936674448,  -524940456}, {  936271549,  -525658722}, 
+	{  939080267,  -520624391}, {  938680677,  -521344503}, {  938280535,  -522064309}, {  937879841,  -522783807}, 
+	{  940673101,  -517740883}, {  940275722,  -518462218}, {  939877790,  -519183248}, {  939479305,  -519903972}, 
+	{  942257081,  -514852502}, {  941861917,  -515575053}, {  941466198,  -516297300}, {  941069926,  -517019243}, 
+	{  943832191,  -511959275}, {  943439246,  -512683035}, {  943045745,  -513406493}, {  942651690,  -514129648}, 
+	{  945398418,  -509061229}, {  945007695,  -509786191}, {  944616416,  -510510853}, {  944224582,  -511235214}, 
+	{  946955747,  -506158392}, {  946567250,  -506884549}, {  946178196,  -507610408}, {  945788585,  -508335968}, 
+	{  948504163,  -503250791}, {  948117895,  -503978136}, {  947731070,  -504705185}, {  947343687,  -505431937}, 
+	{  950043650,  -500338453}, {  949659616,  -501066980}, {  949275023,  -501795212}, {  948889872,  -502523149}, 
+	{  951574196,  -497421405}, {  951192399,  -498151107}, {  950810042,  -498880516}, {  950427126,  -499609631}, 
+	{  953095785,  -494499676}, {  952716228,  -495230545}, {  952336111,  -495961124}, {  951955434,  -496691410}, 
+	{  954608403,  -491573292}, {  954231090,  -492305322}, {  953853216,  -493037064}, {  953474781,  -493768515}, 
+	{  956112036,  -488642281}, {  955736971,  -489375466}, {  955361344,  -490108363}, {  954985154,  -490840972}, 
+	{  957606670,  -485706671}, {  957233856,  -486441003}, {  956860479,  -487175049}, {  956486539,  -487908809}, 
+	{  959092290,  -482766489}, {  958721731,  -483501962}, {  958350608,  -484237150}, {  957978921,  -484972053}, 
+	{  960568883,  -479821764}, {  960200582,  -480558369}, {  959831716,  -481294693}, {  959462286,  -482030733}, 
+	{  962036435,  -476872522}, {  961670396,  -477610254}, {  961303790,  -478347705}, {  960936620,  -479084875}, 
+	{  963494932,  -473918791}, {  963131157,  -474657643}, {  962766816,  -475396216}, {  962401909,  -476134509}, 
+	{  964944360,  -470960600}, {  964582854,  -471700564}, {  964220780,  -472440251}, {  963858140,  -473179660}, 
+	{  966384706,  -467997976}, {  966025471,  -468739046}, {  965665669,  -469479840}, {  965305298,  -470220358}, 
+	{  967815955,  -465030947}, {  967458996,  -465773116}, {  967101468,  -466515010}, {  966743371,  -467256631}, 
+	{  969238095,  -462059541}, {  968883415,  -462802801}, {  968528165,  -463545789}, {  968172345,  -464288505}, 
+	{  970651112,  -459083786}, {  970298714,  -459828131}, {  969945745,  -460572205}, {  969592205,  -461316009}, 
+	{  972054994,  -456103710}, {  971704881,  -456849132}, {  971354196,  -457594286}, {  971002940,  -458339171}, 
+	{  973449725,  -453119340}, {  973101901,  -453865834}, {  972753504,  -454612060}, {  972404535,  -455358019}, 
+	{  974835295,  -450130706}, {  974489762,  -450878263}, {  974143656,  -451625555}, {  973796977,  -452372581}, 
+	{  976211688,  -447137835}, {  975868451,  -447886449}, {  975524639,  -448634799}, {  975180254,  -449382885}, 
+	{  977578894,  -444140756}, {  977237955,  -444890419}, {  976896441,  -445639820}, {  976554352,  -446388959}, 
+	{  978936898,  -441139496}, {  978598260,  -441890201}, {  978259047,  -442640647}, {  977919258,  -443390832}, 
+	{  980285688,  -438134084}, {  979949355,  -438885824}, {  979612445,  -439637307}, {  979274960,  -440388531}, 
+	{  981625251,  -435124548}, {  981291226,  -435877317}, {  980956623,  -436629829}, {  980621444,  -437382085}, 
+	{  982955574,  -432110916}, {  982623860,  -432864706}, {  982291568,  -433618242}, {  981958698,  -434371523}, 
+	{  984276646,  -429093217}, {  983947246,  -429848022}, {  983617267,  -430602573}, {  983286710,  -431356872}, 
+	{  985588453,  -426071480}, {  985261370,  -426827291}, {  984933708,  -427582852}, {  984605467,  -428338160}, 
+	{  986890984,  -423045732}, {  986566221,  -423802543}, {  986240879,  -424559105}, {  985914956,  -425315418}, 
+	{  988184225,  -420016002}, {  987861786,  -420773806}, {  987538766,  -421531363}, {  987215165,  -422288671}, 
+	{  989468165,  -416982319}, {  989148053,  -417741109}, {  988827359,  -418499653}, {  988506083,  -419257951}, 
+	{  990742793,  -413944711}, {  990425010,  -414704479}, {  990106644,  -415464004}, {  989787696,  -416223284}, 
+	{  992008094,  -410903207}, {  991692644,  -411663946}, {  991376610,  -412424444}, {  991059993,  -413184699}, 
+	{  993264059,  -407857835}, {  992950944,  -408619539}, {  992637245,  -409381002}, {  992322961,  -410142225}, 
+	{  994510675,  -404808624}, {  994199898,  -405571285}, {  993888536,  -406333708}, {  993576590,  -407095891}, 
+	{  995747930,  -401755603}, {  995439494,  -402519214}, {  995130473,  -403282588}, {  994820867,  -404045725}, 
+	{  996975812,  -398698801}, {  996669721,  -399463355}, {  996363043,  -400227673}, {  996055780,  -400991756}, 
+	{  998194311,  -395638246}, {  997890567,  -396403735}, {  997586236,  -397168991}, {  997281317,  -397934013}, 
+	{  999403415,  -392573967}, {  999102020,  -393340384}, {  998800038,  -394106570}, {  998497468,  -394872524}, 
+	{ 1000603111,  -389505993}, { 1000304069,  -390273331}, { 1000004439,  -391040440}, {  999704221,  -391807319}, 
+	{ 1001793390,  -386434353}, { 1001496704,  -387202605}, { 1001199428,  -387970630}, { 1000901564,  -388738426}, 
+	{ 1002974239,  -383359076}, { 1002679911,  -384128234}, { 1002384994,  -384897167}, { 1002089486,  -385665873}, 
+	{ 1004145648,  -380280190}, { 1003853681,  -381050248}, { 1003561124,  -381820082}, { 1003267977,  -382589691}, 
+	{ 1005307605,  -377197725}, { 1005018003,  -377968675}, { 1004727809,  -378739403}, { 1004437024,  -379509908}, 
+	{ 1006460100,  -374111709}, { 1006172864,  -374883544}, { 1005885036,  -375655159}, { 1005596617,  -376426553}, 
+	{ 1007603122,  -371022173}, { 1007318256,  -371794885}, { 1007032796,  -372567379}, { 1006746744,  -373339654}, 
+	{ 1008736660,  -367929144}, { 1008454166,  -368702727}, { 1008171077,  -369476093}, { 1007887396,  -370249242}, 
+	{ 1009860704,  -364832652}, { 1009580584,  -365607098}, { 1009299870,  -366381329}, { 1009018562,  -367155344}, 
+	{ 1010975242,  -361732726}, { 1010697499,  -362508027}, { 1010419162,  -363283116}, { 1010140230,  -364057991}, 
+	{ 1012080264,  -358629395}, { 1011804901,  -359405545}, { 1011528943,  -360181484}, { 1011252390,  -360957211}, 
+	{ 1013175761,  -355522689}, { 1012902780,  -356299680}, { 1012629204,  -357076462}, { 1012355032,  -357853034}, 
+	{ 1014261721,  -352412636}, { 1013991126,  -353190461}, { 1013719934,  -353968079}, { 1013448145,  -354745488}, 
+	{ 1015338134,  -349299266}, { 1015069927,  -350077918}, { 1014801122,  -350856364}, { 1014531720,  -351634604}, 
+	{ 1016404991,  -346182609}, { 1016139173,  -346962080}, { 1015872758,  -347741347}, { 1015605745,  -348520409}, 
+	{ 1017462281,  -343062693}, { 1017198856,  -343842976}, { 1016934832,  -344623057}, { 1016670211,  -345402934}, 
+	{ 1018509994,  -339939549}, { 1018248964,  -340720636}, { 1017987335,  -341501523}, { 1017725107,  -342282209}, 
+	{ 1019548121,  -336813204}, { 1019289488,  -337595089}, { 1019030256,  -338376774}, { 1018770425,  -339158261}, 
+	{ 1020576651,  -333683689}, { 1020320418,  -334466364}, { 1020063586,  -335248841}, { 1019806153,  -336031121}, 
+	{ 1021595575,  -330551034}, { 1021341745,  -331334491}, { 1021087314,  -332117752}, { 1020832283,  -332900819}, 
+	{ 1022604883,  -327415267}, { 1022353458,  -328199499}, { 1022101432,  -328983538}, { 1021848804,  -329767383}, 
+	{ 1023604567,  -324276419}, { 1023355549,  -325061418}, { 1023105929,  -325846226}, { 1022855707,  -326630843}, 
+	{ 1024594615,  -321134518}, { 1024348007,  -321920278}, { 1024100796,  -322705848}, { 1023852982,  -323491229}, 
+	{ 1025575020,  -317989595}, { 1025330824,  -318776108}, { 1025086024,  -319562433}, { 1024840621,  -320348570}, 
+	{ 1026545772,  -314841679}, { 1026303990,  -315628937}, { 1026061603,  -316416009}, { 1025818614,  -317202895}, 
+	{ 1027506862,  -311690799}, { 1027267495,  -312478795}, { 1027027525,  -313266607}, { 1026786951,  -314054235}, 
+	{ 1028458280,  -308536985}, { 1028221332,  -309325712}, { 1027983780,  -310114257}, { 1027745623,  -310902619}, 
+	{ 1029400018,  -305380268}, { 1029165491,  -306169718}, { 1028930359,  -306958988}, { 1028694622,  -307748077}, 
+	{ 1030332067,  -302220676}, { 1030099963,  -303010842}, { 1029867254,  -303800829}, { 1029633939,  -304590638}, 
+	{ 1031254418,  -299058239}, { 1031024740,  -299849113}, { 1030794455,  -300639811}, { 1030563564,  -301430332}, 
+	{ 1032167062,  -295892988}, { 1031939812,  -296684563}, { 1031711954,  -297475964}, { 1031483489,  -298267189}, 
+	{ 1033069992,  -292724951}, { 1032845170,  -293517220}, { 1032619742,  -294309316}, { 1032393706,  -295101239}, 
+	{ 1033963197,  -289554160}, { 1033740808,  -290347114}, { 1033517810,  -291139898}, { 1033294205,  -291932511}, 
+	{ 1034846671,  -286380643}, { 1034626715,  -287174276}, { 1034406151,  -287967740}, { 1034184978,  -288761035}, 
+	{ 1035720404,  -283204430}, { 1035502884,  -283998734}, { 1035284755,  -284792871}, { 1035066018,  -285586841}, 
+	{ 1036584389,  -280025552}, { 1036369307,  -280820520}, { 1036153615,  -281615322}, { 1035937314,  -282409959}, 
+	{ 1037438617,  -276844038}, { 1037225975,  -277639662}, { 1037012723,  -278435122}, { 1036798861,  -279230419}, 
+	{ 1038283080,  -273659918}, { 1038072880,  -274456191}, { 1037862069,  -275252302}, { 1037650648,  -276048251}, 
+	{ 1039117770,  -270473223}, { 1038910014,  -271270136}, { 1038701647,  -272066891}, { 1038492669,  -272863485}, 
+	{ 1039942680,  -267283981}, { 1039737370,  -268081529}, { 1039531448,  -268878918}, { 1039324915,  -269676150}, 
+	{ 1040757802,  -264092224}, { 1040554939,  -264890398}, { 1040351465,  -265688415}, { 1040147378,  -266486277}, 
+	{ 1041563127,  -260897982}, { 1041362715,  -261696774}, { 1041161689,  -262495412}, { 1040960052,  -263293896}, 
+	{ 1042358649,  -257701283}, { 1042160688,  -258500686}, { 1041962114,  -259299937}, { 1041762927,  -260099036}, 
+	{ 1043144360,  -254502159}, { 1042948852,  -255302166}, { 1042752731,  -256102022}, { 1042555997,  -256901728}, 
+	{ 1043920252,  -251300640}, { 1043727200,  -252101242}, { 1043533534,  -252901697}, { 1043339254,  -253702003}, 
+	{ 1044686319,  -248096755}, { 1044495724,  -248897946}, { 1044304514,  -249698991}, { 1044112690,  -250499889}, 
+	{ 1045442553,  -244890535}, { 1045254416,  -245692307}, { 1045065665,  -246493935}, { 1044876299,  -247295417}, 
+	{ 1046188946,  -241682010}, { 1046003271,  -242484355}, { 1045816980,  -243286558}, { 1045630074,  -244088618}, 
+	{ 1046925492,  -238471210}, { 1046742279,  -239274121}, { 1046558451,  -240076892}, { 1046374006,  -240879522}, 
+	{ 1047652185,  -235258165}, { 1047471436,  -236061635}, { 1047290071,  -236864966}, { 1047108090,  -237668158}, 
+	{ 1048369016,  -232042906}, { 1048190733,  -232846927}, { 1048011834,  -233650811}, { 1047832317,  -234454557}, 
+	{ 1049075980,  -228825464}, { 1048900165,  -229630027}, { 1048723732,  -230434456}, { 1048546683,  -231238749}, 
+	{ 1049773069,  -225605867}, { 1049599723,  -226410966}, { 1049425759,  -227215933}, { 1049251178,  -228020765}, 
+	{ 1050460278,  -222384147}, { 1050289403,  -223189774}, { 1050117909,  -223995270}, { 1049945798,  -224800635}, 
+	{ 1051137599,  -219160334}, { 1050969196,  -219966481}, { 1050800175,  -220772500}, { 1050630536,  -221578389}, 
+	{ 1051805027,  -215934457}, { 1051639098,  -216741118}, { 1051472550,  -217547651}, { 1051305384,  -218354057}, 
+	{ 1052462555,  -212706549}, { 1052299101,  -213513715}, { 1052135029,  -214320755}, { 1051970337,  -215127670}, 
+	{ 1053110176,  -209476638}, { 1052949200,  -210284302}, { 1052787604,  -211091842}, { 1052625389,  -211899258}, 
+	{ 1053747885,  -206244756}, { 1053589387,  -207052910}, { 1053430270,  -207860942}, { 1053270533,  -208668851}, 
+	{ 1054375676,  -203010932}, { 1054219658,  -203819569}, { 1054063021,  -204628085}, { 1053905763,  -205436481}, 
+	{ 1054993543,  -199775198}, { 1054840007,  -200584309}, { 1054685850,  -201393302}, { 1054531073,  -202202177}, 
+	{ 1055601479,  -196537583}, { 1055450426,  -197347161}, { 1055298753,  -198156624}, { 1055146458,  -198965969}, 
+	{ 1056199480,  -193298119}, { 1056050912,  -194108156}, { 1055901722,  -194918080}, { 1055751911,  -195727889}, 
+	{ 1056787540,  -190056834}, { 1056641457,  -190867324}, { 1056494753,  -191677702}, { 1056347427,  -192487967}, 
+	{ 1057365653,  -186813762}, { 1057222057,  -187624696}, { 1057077840,  -188435520}, { 1056933001,  -189246233}, 
+	{ 1057933813,  -183568930}, { 1057792706,  -184380301}, { 1057650977,  -185191564}, { 1057508626,  -186002717}, 
+	{ 1058492016,  -180322371}, { 1058353399,  -181134171}, { 1058214159,  -181945865}, { 1058074297,  -182757451}, 
+	{ 1059040255,  -177074115}, { 1058904130,  -177886336}, { 1058767381,  -178698453}, { 1058630010,  -179510465}, 
+	{ 1059578527,  -173824192}, { 1059444894,  -174636827}, { 1059310638,  -175449360}, { 1059175758,  -176261789}, 
+	{ 1060106826,  -170572633}, { 1059975686,  -171385674}, { 1059843923,  -172198615}, { 1059711537,  -173011454}, 
+	{ 1060625146,  -167319468}, { 1060496502,  -168132908}, { 1060367233,  -168946249}, { 1060237341,  -169759491}, 
+	{ 1061133483,  -164064728}, { 1061007335,  -164878559}, { 1060880563,  -165692293}, { 1060753166,  -166505929}, 
+	{ 1061631833,  -160808445}, { 1061508182,  -161622659}, { 1061383907,  -162436778}, { 1061259007,  -163250801}, 
+	{ 1062120190,  -157550647}, { 1061999038,  -158365237}, { 1061877261,  -159179733}, { 1061754859,  -159994136}, 
+	{ 1062598550,  -154291367}, { 1062479898,  -155106324}, { 1062360620,  -155921191}, { 1062240717,  -156735965}, 
+	{ 1063066909,  -151030634}, { 1062950757,  -151845952}, { 1062833980,  -152661180}, { 1062716578,  -153476319}, 
+	{ 1063525261,  -147768480}, { 1063411611,  -148584150}, { 1063297336,  -149399733}, { 1063182435,  -150215228}, 
+	{ 1063973603,  -144504935}, { 1063862456,  -145320950}, { 1063750684,  -146136880}, { 1063638285,  -146952723}, 
+	{ 1064411931,  -141240030}, { 1064303288,  -142056382}, { 1064194019,  -142872651}, { 1064084124,  -143688835}, 
+	{ 1064840240,  -137973796}, { 1064734102,  -138790477}, { 1064627338,  -139607077}, { 1064519947,  -140423595}, 
+	{ 1065258526,  -134706263}, { 1065154894,  -135523266}, { 1065050636,  -136340190}, { 1064945751,  -137157033}, 
+	{ 1065666786,  -131437462}, { 1065565661,  -132254779}, { 1065463909,  -133072019}, { 1065361531,  -133889180}, 
+	{ 1066065015,  -128167423}, { 1065966398,  -128985047}, { 1065867154,  -129802595}, { 1065767284,  -130620067}, 
+	{ 1066453210,  -124896179}, { 1066357102,  -125714101}, { 1066260367,  -126531950}, { 1066163005,  -127349724}, 
+	{ 1066831367,  -121623759}, { 1066737769,  -122441972}, { 1066643544,  -123260114}, { 1066548690,  -124078183}, 
+	{ 1067199483,  -118350194}, { 1067108396,  -119168691}, { 1067016680,  -119987118}, { 1066924338,  -120805474}, 
+	{ 1067557554,  -115075515}, { 1067468978,  -115894288}, { 1067379774,  -116712992}, { 1067289942,  -117531627}, 
+	{ 1067905576,  -111799753}, { 1067819513,  -112618793}, { 1067732821,  -113437768}, { 1067645501,  -114256675}, 
+	{ 1068243547,  -108522939}, { 1068159997,  -109342239}, { 1068075818,  -110161476}, { 1067991011,  -110980647}, 
+	{ 1068571464,  -105245103}, { 1068490427,  -106064656}, { 1068408763,  -106884147}, { 1068326469,  -107703574}, 
+	{ 1068889322,  -101966277}, { 1068810801,  -102786074}, { 1068731650,  -103605812}, { 1068651871,  -104425488}, 
+	{ 1069197120,   -98686491}, { 1069121114,   -99506525}, { 1069044479,  -100326502}, { 1068967215,  -101146419}, 
+	{ 1069494854,   -95405776}, { 1069421364,   -96226040}, { 1069347245,   -97046247}, { 1069272497,   -97866398}, 
+	{ 1069782521,   -92124163}, { 1069711548,   -92944648}, { 1069639946,   -93765079}, { 1069567715,   -94585455}, 
+	{ 1070060120,   -88841683}, { 1069991664,   -89662382}, { 1069922579,   -90483029}, { 1069852865,   -91303623}, 
+	{ 1070327646,   -85558366}, { 1070261709,   -86379272}, { 1070195142,   -87200127}, { 1070127946,   -88020931}, 
+	{ 1070585099,   -82274245}, { 1070521680,   -83095349}, { 1070457632,   -83916404}, { 1070392954,   -84737410}, 
+	{ 1070832474,   -78989349}, { 1070771575,   -79810644}, { 1070710046,   -80631892}, { 1070647887,   -81453092}, 
+	{ 1071069770,   -75703709}, { 1071011391,   -76525187}, { 1070952382,   -77346620}, { 1070892743,   -78168007}, 
+	{ 1071296985,   -72417357}, { 1071241127,   -73239010}, { 1071184638,   -74060620}, { 1071127519,   -74882187}, 
+	{ 1071514117,   -69130324}, { 1071460780,   -69952144}, { 1071406812,   -70773924}, { 1071352214,   -71595661}, 
+	{ 1071721163,   -65842639}, { 1071670347,   -66664620}, { 1071618901,   -67486561}, { 1071566824,   -68308462}, 
+	{ 1071918122,   -62554335}, { 1071869828,   -63376468}, { 1071820903,   -64198563}, { 1071771349,   -65020620}, 
+	{ 1072104991,   -59265442}, { 1072059220,   -60087719}, { 1072012818,   -60909960}, { 1071965785,   -61732166}, 
+	{ 1072281769,   -55975992}, { 1072238521,   -56798405}, { 1072194642,   -57620785}, { 1072150132,   -58443131}, 
+	{ 1072448455,   -52686014}, { 1072407730,   -53508556}, { 1072366374,   -54331067}, { 1072324387,   -55153545}, 
+	{ 1072605046,   -49395541}, { 1072566845,   -50218204}, { 1072528012,   -51040837}, { 1072488549,   -51863441}, 
+	{ 1072751542,   -46104602}, { 1072715864,   -46927379}, { 1072679556,   -47750128}, { 1072642617,   -48572848}, 
+	{ 1072887940,   -42813230}, { 1072854787,   -43636112}, { 1072821003,   -44458968}, { 1072786588,   -45281799}, 
+	{ 1073014240,   -39521455}, { 1072983612,   -40344435}, { 1072952352,   -41167391}, { 1072920462,   -41990323}, 
+	{ 1073130440,   -36229307}, { 1073102337,   -37052377}, { 1073073603,   -37875426}, { 1073044237,   -38698452}, 
+	{ 1073236540,   -32936819}, { 1073210962,   -33759971}, { 1073184753,   -34583104}, { 1073157912,   -35406216}, 
+	{ 1073332538,   -29644021}, { 1073309485,   -30467248}, { 1073285802,   -31290457}, { 1073261486,   -32113647}, 
+	{ 1073418433,   -26350943}, { 1073397906,   -27174237}, { 1073376748,   -27997515}, { 1073354959,   -28820776}, 
+	{ 1073494225,   -23057618}, { 1073476224,   -23880971}, { 1073457592,   -24704310}, { 1073438328,   -25527634}, 
+	{ 1073559913,   -19764076}, { 1073544438,   -20587480}, { 1073528332,   -21410872}, { 1073511594,   -22234252}, 
+	{ 1073615496,   -16470347}, { 1073602547,   -17293795}, { 1073588967,   -18117233}, { 1073574756,   -18940660}, 
+	{ 1073660973,   -13176464}, { 1073650551,   -13999948}, { 1073639498,   -14823423}, { 1073627812,   -15646890}, 
+	{ 1073696345,    -9882456}, { 1073688450,   -10705968}, { 1073679922,   -11529474}, { 1073670764,   -12352972}, 
+	{ 1073721611,    -6588356}, { 1073716242,    -7411888}, { 1073710241,    -8235416}, { 1073703609,    -9058939}, 
+	{ 1073736771,    -3294193}, { 1073733928,    -4117738}, { 1073730454,    -4941281}, { 1073726348,    -5764820}, 
+	{ 1073741824,           0}, { 1073741508,     -823550}, { 1073740561,    -1647099}, { 1073738982,    -2470647}, 
+#endif
+#if (MAX_DIT_FFT_LUT_LOG2 >= 14)
+	{-1073740561,    -1647099}, {-1073741113,    -1235324}, {-1073741508,     -823550}, {-1073741745,     -411775}, 
+	{-1073736771,    -3294193}, {-1073737955,    -2882420}, {-1073738982,    -2470647}, {-1073739850,    -2058873}, 
+	{-1073730454,    -4941281}, {-1073732270,    -4529510}, {-1073733928,    -4117738}, {-1073735429,    -3705966}, 
+	{-1073721611,    -6588356}, {-1073724059,    -6176588}, {-1073726348,    -5764820}, {-1073728480,    -5353051}, 
+	{-1073710241,    -8235416}, {-1073713321,    -7823653}, {-1073716242,    -7411888}, {-1073719006,    -7000123}, 
+	{-1073696345,    -9882456}, {-1073700056,    -9470698}, {-1073703609,    -9058939}, {-1073707004,    -8647178}, 
+	{-1073679922,   -11529474}, {-1073684265,   -11117722}, {-1073688450,   -10705968}, {-1073692476,   -10294213}, 
+	{-1073660973,   -13176464}, {-1073665947,   -12764719}, {-1073670764,   -12352972}, {-1073675422,   -11941224}, 
+	{-1073639498,   -14823423}, {-1073645103,   -14411686}, {-1073650551,   -13999948}, {-1073655841,   -13588207}, 
+	{-1073615496,   -16470347}, {-1073621733,   -16058620}, {-1073627812,   -15646890}, {-1073633734,   -15235158}, 
+	{-1073588967,   -18117233}, {-1073595836,   -17705515}, {-1073602547,   -17293795}, {-1073609100,   -16882072}, 
+	{-1073559913,   -19764076}, {-1073567413,   -19352369}, {-1073574756,   -18940660}, {-1073581940,   -18528948}, 
+	{-1073528332,   -21410872}, {-1073536464,   -20999178}, {-1073544438,   -20587480}, {-1073552254,   -20175779}, 
+	{-1073494225,   -23057618}, {-1073502988,   -22645937}, {-1073511594,   -22234252}, {-1073520042,   -21822563}, 
+	{-1073457592,   -24704310}, {-1073466987,   -24292642}, {-1073476224,   -23880971}, {-1073485303,   -23469296}, 
+	{-1073418433,   -26350943}, {-1073428460,   -25939291}, {-1073438328,   -25527634}, {-1073448039,   -25115974}, 
+	{-1073376748,   -27997515}, {-1073387406,   -27585878}, {-1073397906,   -27174237}, {-1073408249,   -26762592}, 
+	{-1073332538,   -29644021}, {-1073343827,   -29232401}, {-1073354959,   -28820776}, {-1073365932,   -28409148}, 
+	{-1073285802,   -31290457}, {-1073297722,   -30878855}, {-1073309485,   -30467248}, {-1073321091,   -30055636}, 
+	{-1073236540,   -32936819}, {-1073249092,   -32525236}, {-1073261486,   -32113647}, {-1073273723,   -31702054}, 
+	{-1073184753,   -34583104}, {-1073197936,   -34171540}, {-1073210962,   -33759971}, {-1073223830,   -33348398}, 
+	{-1073130440,   -36229307}, {-1073144255,   -35817764}, {-1073157912,   -35406216}, {-1073171411,   -34994663}, 
+	{-1073073603,   -37875426}, {-1073088049,   -37463904}, {-1073102337,   -37052377}, {-1073116468,   -36640845}, 
+	{-1073014240,   -39521455}, {-1073029317,   -39109956}, {-1073044237,   -38698452}, {-1073058999,   -38286941}, 
+	{-1072952352,   -41167391}, {-1072968061,   -40755916}, {-1072983612,   -40344435}, {-1072999005,   -39932948}, 
+	{-1072887940,   -42813230}, {-1072904280,   -42401779}, {-1072920462,   -41990323}, {-1072936486,   -41578860}, 
+	{-1072821003,   -44458968}, {-1072837974,   -44047544}, {-1072854787,   -43636112}, {-1072871443,   -43224674}, 
+	{-1072751542,   -46104602}, {-1072769144,   -45693204}, {-1072786588,   -45281799}, {-1072803874,   -44870387}, 
+	{-1072679556,   -47750128}, {-1072697789,   -47338757}, {-1072715864,   -46927379}, {-1072733782,   -46515994}, 
+	{-1072605046,   -49395541}, {-1072623910,   -48984198}, {-1072642617,   -48572848}, {-1072661165,   -48161492}, 
+	{-1072528012,   -51040837}, {-1072547508,   -50629524}, {-1072566845,   -50218204}, {-1072586024,   -49806876}, 
+	{-1072448455,   -52686014}, {-1072468581,   -52274731}, {-1072488549,   -51863441}, {-1072508360,   -51452143}, 
+	{-1072366374,   -54331067}, {-1072387131,   -53919815}, {-1072407730,   -53508556}, {-1072428171,   -53097289}, 
+	{-1072281769,   -55975992}, {-1072303157,   -55564773}, {-1072324387,   -55153545}, {-1072345459,   -54742310}, 
+	{-1072194642,   -57620785}, {-1072216660,   -57209599}, {-1072238521,   -56798405}, {-1072260224,   -56387202}, 
+	{-1072104991,   -59265442}, {-1072127640,   -58854291}, {-1072150132,   -58443131}, {-1072172466,   -58031962}, 
+	{-1072012818,   -60909960}, {-1072036098,   -60498844}, {-1072059220,   -60087719}, {-1072082184,   -59676585}, 
+	{-1071918122,   -62554335}, {-1071942032,   -62143255}, {-1071965785,   -61732166}, {-1071989380,   -61321068}, 
+	{-1071820903,   -64198563}, {-1071845445,   -63787520}, {-1071869828,   -63376468}, {-1071894054,   -62965406}, 
+	{-1071721163,   -65842639}, {-1071746335,   -65431634}, {-1071771349,   -65020620}, {-1071796205,   -64609596}, 
+	{-1071618901,   -67486561}, {-1071644703,   -67075595}, {-1071670347,   -66664620}, {-1071695834,   -66253634}, 
+	{-1071514117,   -69130324}, {-1071540549,   -68719398}, {-1071566824,   -68308462}, {-1071592941,   -67897517}, 
+	{-1071406812,   -70773924}, {-1071433874,   -70363039}, {-1071460780,   -69952144}, {-1071487527,   -69541239}, 
+	{-1071296985,   -72417357}, {-1071324678,   -72006515}, {-1071352214,   -71595661}, {-1071379592,   -71184798}, 
+	{-1071184638,   -74060620}, {-1071212961,   -73649821}, {-1071241127,   -73239010}, {-1071269135,   -72828189}, 
+	{-1071069770,   -75703709}, {-1071098724,   -75292954}, {-1071127519,   -74882187}, {-1071156158,   -74471409}, 
+	{-1070952382,   -77346620}, {-1070981966,   -76935909}, {-1071011391,   -76525187}, {-1071040660,   -76114454}, 
+	{-1070832474,   -78989349}, {-1070862687,   -78578684}, {-1070892743,   -78168007}, {-1070922641,   -77757319}, 
+	{-1070710046,   -80631892}, {-1070740889,   -80221273}, {-1070771575,   -79810644}, {-1070802103,   -79400002}, 
+	{-1070585099,   -82274245}, {-1070616572,   -81863674}, {-1070647887,   -81453092}, {-1070679045,   -81042498}, 
+	{-1070457632,   -83916404}, {-1070489735,   -83505883}, {-1070521680,   -83095349}, {-1070553468,   -82684803}, 
+	{-1070327646,   -85558366}, {-1070360379,   -85147894}, {-1070392954,   -84737410}, {-1070425372,   -84326913}, 
+	{-1070195142,   -87200127}, {-1070228504,   -86789706}, {-1070261709,   -86379272}, {-1070294756,   -85968825}, 
+	{-1070060120,   -88841683}, {-1070094111,   -88431313}, {-1070127946,   -88020931}, {-1070161623,   -87610535}, 
+	{-1069922579,   -90483029}, {-1069957201,   -90072712}, {-1069991664,   -89662382}, {-1070025971,   -89252039}, 
+	{-1069782521,   -92124163}, {-1069817772,   -91713899}, {-1069852865,   -91303623}, {-1069887801,   -90893333}, 
+	{-1069639946,   -93765079}, {-1069675826,   -93354871}, {-1069711548,   -92944648}, {-1069747114,   -92534412}, 
+	{-1069494854,   -95405776}, {-1069531363,   -94995622}, {-1069567715,   -94585455}, {-1069603909,   -94175274}, 
+	{-1069347245,   -97046247}, {-1069384383,   -96636151}, {-1069421364,   -96226040}, {-1069458188,   -95815915}, 
+	{-1069197120,   -98686491}, {-1069234887,   -98276451}, {-1069272497,   -97866398}, {-1069309950,   -97456330}, 
+	{-1069044479,  -100326502}, {-1069082875,   -99916521}, {-1069121114,   -99506525}, {-1069159195,   -99096515}, 
+	{-1068889322,  -101966277}, {-1068928347,  -101556355}, {-1068967215,  -101146419}, {-1069005925,  -100736468}, 
+	{-1068731650,  -103605812}, {-1068771304,  -103195951}, {-1068810801,  -102786074}, {-1068850140,  -102376183}, 
+	{-1068571464,  -105245103}, {-1068611746,  -104835303}, {-1068651871,  -104425488}, {-1068691839,  -104015658}, 
+	{-1068408763,  -106884147}, {-1068449673,  -106474409}, {-1068490427,  -106064656}, {-1068531024,  -105654887}, 
+	{-1068243547,  -108522939}, {-1068285087,  -108113265}, {-1068326469,  -107703574}, {-1068367694,  -107293868}, 
+	{-1068075818,  -110161476}, {-1068117986,  -109751866}, {-1068159997,  -109342239}, {-1068201851,  -108932597}, 
+	{-1067905576,  -111799753}, {-1067948372,  -111390208}, {-1067991011,  -110980647}, {-1068033493,  -110571069}, 
+	{-1067732821,  -113437768}, {-1067776246,  -113028289}, {-1067819513,  -112618793}, {-1067862623,  -112209281}, 
+	{-1067557554,  -115075515}, {-1067601606,  -114666103}, {-1067645501,  -114256675}, {-1067689240,  -113847230}, 
+	{-1067379774,  -116712992}, {-1067424454,  -116303648}, {-1067468978,  -115894288}, {-1067513344,  -115484910}, 
+	{-1067199483,  -118350194}, {-1067244791,  -117940919}, {-1067289942,  -117531627}, {-1067334937,  -117122318}, 
+	{-1067016680,  -119987118}, {-1067062616,  -119577913}, {-1067108396,  -119168691}, {-1067154018,  -118759451}, 
+	{-1066831367,  -121623759}, {-1066877931,  -121214625}, {-1066924338,  -120805474}, {-1066970587,  -120396304}, 
+	{-1066643544,  -123260114}, {-1066690735,  -122851052}, {-1066737769,  -122441972}, {-1066784647,  -122032875}, 
+	{-1066453210,  -124896179}, {-1066501029,  -124487190}, {-1066548690,  -124078183}, {-1066596195,  -123669157}, 
+	{-1066260367,  -126531950}, {-1066308813,  -126123035}, {-1066357102,  -125714101}, {-1066405234,  -125305149}, 
+	{-1066065015,  -128167423}, {-1066114088,  -127758583}, {-1066163005,  -127349724}, {-1066211764,  -126940846}, 
+	{-1065867154,  -129802595}, {-1065916855,  -129393831}, {-1065966398,  -128985047}, {-1066015785,  -128576245}, 
+	{-1065666786,  -131437462}, {-1065717113,  -131028774}, {-1065767284,  -130620067}, {-1065817297,  -130211341}, 
+	{-1065463909,  -133072019}, {-1065514864,  -132663409}, {-1065565661,  -132254779}, {-1065616302,  -131846130}, 
+	{-1065258526,  -134706263}, {-1065310107,  -134297731}, {-1065361531,  -133889180}, {-1065412799,  -133480609}, 
+	{-1065050636,  -136340190}, {-1065102844,  -135931738}, {-1065154894,  -135523266}, {-1065206789,  -135114774}, 
+	{-1064840240,  -137973796}, {-1064893074,  -137565425}, {-1064945751,  -137157033}, {-1064998272,  -136748621}, 
+	{-1064627338,  -139607077}, {-1064680798,  -139198788}, {-1064734102,  -138790477}, {-1064787249,  -138382147}, 
+	{-1064411931,  -141240030}, {-1064466017,  -140831823}, {-1064519947,  -140423595}, {-1064573721,  -140015347}, 
+	{-1064194019,  -142872651}, {-1064248732,  -142464527}, {-1064303288,  -142056382}, {-1064357688,  -141648217}, 
+	{-1063973603,  -144504935}, {-1064028942,  -144096896}, {-1064084124,  -143688835}, {-1064139150,  -143280754}, 
+	{-1063750684,  -146136880}, {-1063806648,  -145728926}, {-1063862456,  -145320950}, {-1063918108,  -144912954}, 
+	{-1063525261,  -147768480}, {-1063581851,  -147360613}, {-1063638285,  -146952723}, {-1063694563,  -146544812}, 
+	{-1063297336,  -149399733}, {-1063354552,  -148991953}, {-1063411611,  -148584150}, {-1063468514,  -148176326}, 
+	{-1063066909,  -151030634}, {-1063124750,  -150622942}, {-1063182435,  -150215228}, {-1063239964,  -149807492}, 
+	{-1062833980,  -152661180}, {-1062892446,  -152253577}, {-1062950757,  -151845952}, {-1063008911,  -151438304}, 
+	{-1062598550,  -154291367}, {-1062657642,  -153883854}, {-1062716578,  -153476319}, {-1062775357,  -153068761}, 
+	{-1062360620,  -155921191}, {-1062420337,  -155513769}, {-1062479898,  -155106324}, {-1062539302,  -154698857}, 
+	{-1062120190,  -157550647}, {-1062180532,  -157143318}, {-1062240717,  -156735965}, {-1062300747,  -156328589}, 
+	{-1061877261,  -159179733}, {-1061938227,  -158772497}, {-1061999038,  -158365237}, {-1062059692,  -157957954}, 
+	{-1061631833,  -160808445}, {-1061693424,  -160401302}, {-1061754859,  -159994136}, {-1061816138,  -159586946}, 
+	{-1061383907,  -162436778}, {-1061446123,  -162029730}, {-1061508182,  -161622659}, {-1061570086,  -161215564}, 
+	{-1061133483,  -164064728}, {-1061196323,  -163657777}, {-1061259007,  -163250801}, {-1061321535,  -162843801}, 
+	{-1060880563,  -165692293}, {-1060944027,  -165285438}, {-1061007335,  -164878559}, {-1061070487,  -164471656}, 
+	{-1060625146,  -167319468}, {-1060689234,  -166912711}, {-1060753166,  -166505929}, {-1060816943,  -166099124}, 
+	{-1060367233,  -168946249}, {-1060431945,  -168539591}, {-1060496502,  -168132908}, {-1060560902,  -167726200}, 
+	{-1060106826,  -170572633}, {-1060172161,  -170166074}, {-1060237341,  -169759491}, {-1060302365,  -169352882}, 
+	{-1059843923,  -172198615}, {-1059909883,  -171792157}, {-1059975686,  -171385674}, {-1060041334,  -170979166}, 
+	{-1059578527,  -173824192}, {-1059645110,  -173417836}, {-1059711537,  -173011454}, {-1059777808,  -172605047}, 
+	{-1059310638,  -175449360}, {-1059377844,  -175043106}, {-1059444894,  -174636827}, {-1059511788,  -174230522}, 
+	{-1059040255,  -177074115}, {-1059108085,  -176667965}, {-1059175758,  -176261789}, {-1059243276,  -175855587}, 
+	{-1058767381,  -178698453}, {-1058835833,  -178292408}, {-1058904130,  -177886336}, {-1058972270,  -177480239}, 
+	{-1058492016,  -180322371}, {-1058561091,  -179916431}, {-1058630010,  -179510465}, {-1058698773,  -179104472}, 
+	{-1058214159,  -181945865}, {-1058283857,  -181540031}, {-1058353399,  -181134171}, {-1058422785,  -180728284}, 
+	{-1057933813,  -183568930}, {-1058004133,  -183163204}, {-1058074297,  -182757451}, {-1058144306,  -182351671}, 
+	{-1057650977,  -185191564}, {-1057721919,  -184785946}, {-1057792706,  -184380301}, {-1057863337,  -183974629}, 
+	{-1057365653,  -186813762}, {-1057437217,  -186408253}, {-1057508626,  -186002717}, {-1057579879,  -185597154}, 
+	{-1057077840,  -188435520}, {-1057150026,  -188030122}, {-1057222057,  -187624696}, {-1057293933,  -187219242}, 
+	{-1056787540,  -190056834}, {-1056860348,  -189651548}, {-1056933001,  -189246233}, {-1057005498,  -188840890}, 
+	{-1056494753,  -191677702}, {-1056568183,  -191272527}, {-1056641457,  -190867324}, {-1056714576,  -190462093}, 
+	{-1056199480,  -193298119}, {-1056273531,  -192893057}, {-1056347427,  -192487967}, {-1056421168,  -192082849}, 
+	{-1055901722,  -194918080}, {-1055976395,  -194513133}, {-1056050912,  -194108156}, {-1056125274,  -193703152}, 
+	{-1055601479,  -196537583}, {-1055676773,  -196132751}, {-1055751911,  -195727889}, {-1055826894,  -195322999}, 
+	{-1055298753,  -198156624}, {-1055374667,  -197751907}, {-1055450426,  -197347161}, {-1055526030,  -196942387}, 
+	{-1054993543,  -199775198}, {-1055070078,  -199370598}, {-1055146458,  -198965969}, {-1055222683,  -198561311}, 
+	{-1054685850,  -201393302}, {-1054763006,  -200988820}, {-1054840007,  -200584309}, {-1054916852,  -200179768}, 
+	{-1054375676,  -203010932}, {-1054453452,  -202606569}, {-1054531073,  -202202177}, {-1054608539,  -201797754}, 
+	{-1054063021,  -204628085}, {-1054141417,  -204223842}, {-1054219658,  -203819569}, {-1054297745,  -203415265}, 
+	{-1053747885,  -206244756}, {-1053826901,  -205840633}, {-1053905763,  -205436481}, {-1053984469,  -205032298}, 
+	{-1053430270,  -207860942}, {-1053509906,  -207456941}, {-1053589387,  -207052910}, {-1053668714,  -206648848}, 
+	{-1053110176,  -209476638}, {-1053190432,  -209072760}, {-1053270533,  -208668851}, {-1053350479,  -208264912}, 
+	{-1052787604,  -211091842}, {-1052868479,  -210688087}, {-1052949200,  -210284302}, {-1053029765,  -209880485}, 
+	{-1052462555,  -212706549}, {-1052544049,  -212302919}, {-1052625389,  -211899258}, {-1052706574,  -211495565}, 
+	{-1052135029,  -214320755}, {-1052217142,  -213917251}, {-1052299101,  -213513715}, {-1052380905,  -213110148}, 
+	{-1051805027,  -215934457}, {-1051887759,  -215531079}, {-1051970337,  -215127670}, {-1052052760,  -214724228}, 
+	{-1051472550,  -217547651}, {-1051555901,  -217144401}, {-1051639098,  -216741118}, {-1051722140,  -216337804}, 
+	{-1051137599,  -219160334}, {-1051221569,  -218757211}, {-1051305384,  -218354057}, {-1051389044,  -217950870}, 
+	{-1050800175,  -220772500}, {-1050884763,  -220369507}, {-1050969196,  -219966481}, {-1051053475,  -219563424}, 
+	{-1050460278,  -222384147}, {-1050545484,  -221981284}, {-1050630536,  -221578389}, {-1050715433,  -221175461}, 
+	{-1050117909,  -223995270}, {-1050203733,  -223592539}, {-1050289403,  -223189774}, {-1050374918,  -222786977}, 
+	{-1049773069,  -225605867}, {-1049859511,  -225203267}, {-1049945798,  -224800635}, {-1050031931,  -224397969}, 
+	{-1049425759,  -227215933}, {-1049512818,  -226813466}, {-1049599723,  -226410966}, {-1049686474,  -226008433}, 
+	{-1049075980,  -228825464}, {-1049163656,  -228423131}, {-1049251178,  -228020765}, {-1049338546,  -227618366}, 
+	{-1048723732,  -230434456}, {-1048812025,  -230032259}, {-1048900165,  -229630027}, {-1048988149,  -229227762}, 
+	{-1048369016,  -232042906}, {-1048457926,  -231640845}, {-1048546683,  -231238749}, {-1048635284,  -230836620}, 
+	{-1048011834,  -233650811}, {-1048101360,  -233248886}, {-1048190733,  -232846927}, {-1048279952,  -232444934}, 
+	{-1047652185,  -235258165}, {-1047742328,  -234856378}, {-1047832317,  -234454557}, {-1047922153,  -234052701}, 
+	{-1047290071,  -236864966}, {-1047380830,  -236463318}, {-1047471436,  -236061635}, {-1047561887,  -235659918}, 
+	{-1046925492,  -238471210}, {-1047016868,  -238069701}, {-1047108090,  -237668158}, {-1047199157,  -237266579}, 
+	{-1046558451,  -240076892}, {-1046650442,  -239675524}, {-1046742279,  -239274121}, {-1046833963,  -238872683}, 
+	{-1046188946,  -241682010}, {-1046281553,  -241280783}, {-1046374006,  -240879522}, {-1046466305,  -240478225}, 
+	{-1045816980,  -243286558}, {-1045910202,  -242885475}, {-1046003271,  -242484355}, {-1046096185,  -242083200}, 
+	{-1045442553,  -244890535}, {-1045536390,  -244489594}, {-1045630074,  -244088618}, {-1045723604,  -243687606}, 
+	{-1045065665,  -246493935}, {-1045160118,  -246093139}, {-1045254416,  -245692307}, {-1045348561,  -245291439}, 
+	{-1044686319,  -248096755}, {-1044781386,  -247696104}, {-1044876299,  -247295417}, {-1044971059,  -246894694}, 
+	{-1044304514,  -249698991}, {-1044400196,  -249298487}, {-1044495724,  -248897946}, {-1044591098,  -248497369}, 
+	{-1043920252,  -251300640}, {-1044016548,  -250900283}, {-1044112690,  -250499889}, {-1044208679,  -250099458}, 
+	{-1043533534,  -252901697}, {-1043630444,  -252501488}, {-1043727200,  -252101242}, {-1043823803,  -251700959}, 
+	{-1043144360,  -254502159}, {-1043241884,  -254102099}, {-1043339254,  -253702003}, {-1043436471,  -253301868}, 
+	{-1042752731,  -256102022}, {-1042850869,  -255702113}, {-1042948852,  -255302166}, {-1043046683,  -254902181}, 
+	{-1042358649,  -257701283}, {-1042457400,  -257301525}, {-1042555997,  -256901728}, {-1042654441,  -256501894}, 
+	{-1041962114,  -259299937}, {-1042061478,  -258900331}, {-1042160688,  -258500686}, {-1042259745,  -258101004}, 
+	{-1041563127,  -260897982}, {-1041663104,  -260498528}, {-1041762927,  -260099036}, {-1041862597,  -259699506}, 
+	{-1041161689,  -262495412}, {-1041262279,  -262096112}, {-1041362715,  -261696774}, {-1041462997,  -261297397}, 
+	{-1040757802,  -264092224}, {-1040859003,  -263693079}, {-1040960052,  -263293896}, {-1041060947,  -262894673}, 
+	{-1040351465,  -265688415}, {-1040453279,  -265289426}, {-1040554939,  -264890398}, {-1040656447,  -264491331}, 
+	{-1039942680,  -267283981}, {-1040045106,  -266885149}, {-1040147378,  -266486277}, {-1040249498,  -266087366}, 
+	{-1039531448,  -268878918}, {-1039634486,  -268480243}, {-1039737370,  -268081529}, {-1039840101,  -267682775}, 
+	{-1039117770,  -270473223}, {-1039221419,  -270074706}, {-1039324915,  -269676150}, {-1039428258,  -269277554}, 
+	{-1038701647,  -272066891}, {-1038805907,  -271668533}, {-1038910014,  -271270136}, {-1039013969,  -270871700}, 
+	{-1038283080,  -273659918}, {-1038387951,  -273261722}, {-1038492669,  -272863485}, {-1038597234,  -272465208}, 
+	{-1037862069,  -275252302}, {-1037967551,  -274854267}, {-1038072880,  -274456191}, {-1038178056,  -274058075}, 
+	{-1037438617,  -276844038}, {-1037544709,  -276446165}, {-1037650648,  -276048251}, {-1037756435,  -275650297}, 
+	{-1037012723,  -278435122}, {-1037119425,  -278037413}, {-1037225975,  -277639662}, {-1037332372,  -277241870}, 
+	{-1036584389,  -280025552}, {-1036691701,  -279628006}, {-1036798861,  -279230419}, {-1036905868,  -278832791}, 
+	{-1036153615,  -281615322}, {-1036261537,  -281217942}, {-1036369307,  -280820520}, {-1036476924,  -280423056}, 
+	{-1035720404,  -283204430}, {-1035828935,  -282807215}, {-1035937314,  -282409959}, {-1036045541,  -282012662}, 
+	{-1035284755,  -284792871}, {-1035393896,  -284395824}, {-1035502884,  -283998734}, {-1035611720,  -283601603}, 
+	{-1034846671,  -286380643}, {-1034956420,  -285983763}, {-1035066018,  -285586841}, {-1035175463,  -285189877}, 
+	{-1034406151,  -287967740}, {-1034516509,  -287571029}, {-1034626715,  -287174276}, {-1034736769,  -286777480}, 
+	{-1033963197,  -289554160}, {-1034074164,  -289157619}, {-1034184978,  -288761035}, {-1034295641,  -288364409}, 
+	{-1033517810,  -291139898}, {-1033629385,  -290743528}, {-1033740808,  -290347114}, {-1033852079,  -289950658}, 
+	{-1033069992,  -292724951}, {-1033182174,  -292328753}, {-1033294205,  -291932511}, {-1033406084,  -291536226}, 
+	{-1032619742,  -294309316}, {-1032732532,  -293913290}, {-1032845170,  -293517220}, {-1032957657,  -293121107}, 
+	{-1032167062,  -295892988}, {-1032280460,  -295497135}, {-1032393706,  -295101239}, {-1032506800,  -294705299}, 
+	{-1031711954,  -297475964}, {-1031825959,  -297080285}, {-1031939812,  -296684563}, {-1032053513,  -296288797}, 
+	{-1031254418,  -299058239}, {-1031369029,  -298662736}, {-1031483489,  -298267189}, {-1031597797,  -297871598}, 
+	{-1030794455,  -300639811}, {-1030909673,  -300244484}, {-1031024740,  -299849113}, {-1031139655,  -299453698}, 
+	{-1030332067,  -302220676}, {-1030447891,  -301825526}, {-1030563564,  -301430332}, {-1030679085,  -301035094}, 
+	{-1029867254,  -303800829}, {-1029983684,  -303405858}, {-1030099963,  -303010842}, {-1030216091,  -302615781}, 
+	{-1029400018,  -305380268}, {-1029517054,  -304985475}, {-1029633939,  -304590638}, {-1029750672,  -304195756}, 
+	{-1028930359,  -306958988}, {-1029048001,  -306564375}, {-1029165491,  -306169718}, {-1029282830,  -305775015}, 
+	{-1028458280,  -308536985}, {-1028576527,  -308142554}, {-1028694622,  -307748077}, {-1028812566,  -307353555}, 
+	{-1027983780,  -310114257}, {-1028102632,  -309720007}, {-1028221332,  -309325712}, {-1028339882,  -308931371}, 
+	{-1027506862,  -311690799}, {-1027626318,  -311296732}, {-1027745623,  -310902619}, {-1027864777,  -310508461}, 
+	{-1027027525,  -313266607}, {-1027147586,  -312872724}, {-1027267495,  -312478795}, {-1027387254,  -312084820}, 
+	{-1026545772,  -314841679}, {-1026666437,  -314447980}, {-1026786951,  -314054235}, {-1026907313,  -313660444}, 
+	{-1026061603,  -316416009}, {-1026182872,  -316022496}, {-1026303990,  -315628937}, {-1026424956,  -315235331}, 
+	{-1025575020,  -317989595}, {-1025696892,  -317596268}, {-1025818614,  -317202895}, {-1025940184,  -316809475}, 
+	{-1025086024,  -319562433}, {-1025208499,  -319169293}, {-1025330824,  -318776108}, {-1025452997,  -318382875}, 
+	{-1024594615,  -321134518}, {-1024717694,  -320741568}, {-1024840621,  -320348570}, {-1024963398,  -319955525}, 
+	{-1024100796,  -322705848}, {-1024224477,  -322313087}, {-1024348007,  -321920278}, {-1024471386,  -321527422}, 
+	{-1023604567,  -324276419}, {-1023728850,  -323883848}, {-1023852982,  -323491229}, {-1023976964,  -323098562}, 
+	{-1023105929,  -325846226}, {-1023230814,  -325453846}, {-1023355549,  -325061418}, {-1023480133,  -324668942}, 
+	{-1022604883,  -327415267}, {-1022730370,  -327023079}, {-1022855707,  -326630843}, {-1022980893,  -326238559}, 
+	{-1022101432,  -328983538}, {-1022227520,  -328591543}, {-1022353458,  -328199499}, {-1022479246,  -327807407}, 
+	{-1021595575,  -330551034}, {-1021722264,  -330159233}, {-1021848804,  -329767383}, {-1021975193,  -329375485}, 
+	{-1021087314,  -332117752}, {-1021214605,  -331726146}, {-1021341745,  -331334491}, {-1021468735,  -330942787}, 
+	{-1020576651,  -333683689}, {-1020704542,  -333292279}, {-1020832283,  -332900819}, {-1020959873,  -332509310}, 
+	{-1020063586,  -335248841}, {-1020192077,  -334857627}, {-1020320418,  -334466364}, {-1020448610,  -334075051}, 
+	{-1019548121,  -336813204}, {-1019677212,  -336422188}, {-1019806153,  -336031121}, {-1019934944,  -335640006}, 
+	{-1019030256,  -338376774}, {-1019159947,  -337985956}, {-1019289488,  -337595089}, {-1019418879,  -337204171}, 
+	{-1018509994,  -339939549}, {-1018640284,  -339548930}, {-1018770425,  -339158261}, {-1018900415,  -338767543}, 
+	{-1017987335,  -341501523}, {-1018118225,  -341111104}, {-1018248964,  -340720636}, {-1018379554,  -340330117}, 
+	{-1017462281,  -343062693}, {-1017593769,  -342672476}, {-1017725107,  -342282209}, {-1017856296,  -341891891}, 
+	{-1016934832,  -344623057}, {-1017066919,  -344233042}, {-1017198856,  -343842976}, {-1017330643,  -343452860}, 
+	{-1016404991,  -346182609}, {-1016537676,  -345792797}, {-1016670211,  -345402934}, {-1016802596,  -345013021}, 
+	{-1015872758,  -347741347}, {-1016006040,  -347351739}, {-1016139173,  -346962080}, {-1016272157,  -346572370}, 
+	{-1015338134,  -349299266}, {-1015472014,  -348909863}, {-1015605745,  -348520409}, {-1015739326,  -348130904}, 
+	{-1014801122,  -350856364}, {-1014935599,  -350467167}, {-1015069927,  -350077918}, {-1015204105,  -349688618}, 
+	{-1014261721,  -352412636}, {-1014396795,  -352023646}, {-1014531720,  -351634604}, {-1014666495,  -351245510}, 
+	{-1013719934,  -353968079}, {-1013855604,  -353579296}, {-1013991126,  -353190461}, {-1014126498,  -352801575}, 
+	{-1013175761,  -355522689}, {-1013312028,  -355134115}, {-1013448145,  -354745488}, {-1013584114,  -354356810}, 
+	{-1012629204,  -357076462}, {-1012766067,  -356688097}, {-1012902780,  -356299680}, {-1013039345,  -355911211}, 
+	{-1012080264,  -358629395}, {-1012217723,  -358241241}, {-1012355032,  -357853034}, {-1012492193,  -357464774}, 
+	{-1011528943,  -360181484}, {-1011666997,  -359793541}, {-1011804901,  -359405545}, {-1011942657,  -359017496}, 
+	{-1010975242,  -361732726}, {-1011113890,  -361344995}, {-1011252390,  -360957211}, {-1011390741,  -360569374}, 
+	{-1010419162,  -363283116}, {-1010558405,  -362895598}, {-1010697499,  -362508027}, {-1010836445,  -362120403}, 
+	{-1009860704,  -364832652}, {-1010000541,  -364445348}, {-1010140230,  -364057991}, {-1010279770,  -363670580}, 
+	{-1009299870,  -366381329}, {-1009440301,  -365994240}, {-1009580584,  -365607098}, {-1009720718,  -365219902}, 
+	{-1008736660,  -367929144}, {-1008877685,  -367542271}, {-1009018562,  -367155344}, {-1009159290,  -366768363}, 
+	{-1008171077,  -369476093}, {-1008312696,  -369089437}, {-1008454166,  -368702727}, {-1008595487,  -368315962}, 
+	{-1007603122,  -371022173}, {-1007745333,  -370635734}, {-1007887396,  -370249242}, {-1008029311,  -369862694}, 
+	{-1007032796,  -372567379}, {-1007175600,  -372181160}, {-1007318256,  -371794885}, {-1007460763,  -371408556}, 
+	{-1006460100,  -374111709}, {-1006603496,  -373725709}, {-1006746744,  -373339654}, {-1006889844,  -372953544}, 
+	{-1005885036,  -375655159}, {-1006029024,  -375269379}, {-1006172864,  -374883544}, {-1006316556,  -374497654}, 
+	{-1005307605,  -377197725}, {-1005452185,  -376812166}, {-1005596617,  -376426553}, {-1005740900,  -376040883}, 
+	{-1004727809,  -378739403}, {-1004872979,  -378354067}, {-1005018003,  -377968675}, {-1005162878,  -377583228}, 
+	{-1004145648,  -380280190}, {-1004291410,  -379895077}, {-1004437024,  -379509908}, {-1004582490,  -379124683}, 
+	{-1003561124,  -381820082}, {-1003707476,  -381435193}, {-1003853681,  -381050248}, {-1003999738,  -380665247}, 
+	{-1002974239,  -383359076}, {-1003121181,  -382974412}, {-1003267977,  -382589691}, {-1003414624,  -382204915}, 
+	{-1002384994,  -384897167}, {-1002532526,  -384512729}, {-1002679911,  -384128234}, {-1002827149,  -383743683}, 
+	{-1001793390,  -386434353}, {-1001941512,  -386050142}, {-1002089486,  -385665873}, {-1002237314,  -385281549}, 
+	{-1001199428,  -387970630}, {-1001348140,  -387586646}, {-1001496704,  -387202605}, {-1001645120,  -386818508}, 
+	{-1000603111,  -389505993}, {-1000752411,  -389122238}, {-1000901564,  -388738426}, {-1001050570,  -388354556}, 
+	{-1000004439,  -391040440}, {-1000154328,  -390656915}, {-1000304069,  -390273331}, {-1000453664,  -389889691}, 
+	{ -999403415,  -392573967}, { -999553891,  -392190672}, { -999704221,  -391807319}, { -999854404,  -391423908}, 
+	{ -998800038,  -394106570}, { -998951103,  -393723506}, { -999102020,  -393340384}, { -999252791,  -392957205}, 
+	{ -998194311,  -395638246}, { -998345963,  -395255414}, { -998497468,  -394872524}, { -998648827,  -394489576}, 
+	{ -997586236,  -397168991}, { -997738475,  -396786392}, { -997890567,  -396403735}, { -998042512,  -396021020}, 
+	{ -996975812,  -398698801}, { -997128638,  -398316436}, { -997281317,  -397934013}, { -997433850,  -397551531}, 
+	{ -996363043,  -400227673}, { -996516456,  -399845543}, { -996669721,  -399463355}, { -996822840,  -399081107}, 
+	{ -995747930,  -401755603}, { -995901928,  -401373709}, { -996055780,  -400991756}, { -996209485,  -400609744}, 
+	{ -995130473,  -403282588}, { -995285057,  -402900931}, { -995439494,  -402519214}, { -995593785,  -402137438}, 
+	{ -994510675,  -404808624}, { -994665844,  -404427204}, { -994820867,  -404045725}, { -994975743,  -403664186}, 
+	{ -993888536,  -406333708}, { -994044290,  -405952526}, { -994199898,  -405571285}, { -994355360,  -405189985}, 
+	{ -993264059,  -407857835}, { -993420398,  -407476893}, { -993576590,  -407095891}, { -993732636,  -406714829}, 
+	{ -992637245,  -409381002}, { -992794167,  -409000301}, { -992950944,  -408619539}, { -993107575,  -408238717}, 
+	{ -992008094,  -410903207}, { -992165601,  -410522746}, { -992322961,  -410142225}, { -992480176,  -409761644}, 
+	{ -991376610,  -412424444}, { -991534700,  -412044226}, { -991692644,  -411663946}, { -991850442,  -411283607}, 
+	{ -990742793,  -413944711}, { -990901465,  -413564735}, { -991059993,  -413184699}, { -991218374,  -412804602}, 
+	{ -990106644,  -415464004}, { -990265900,  -415084272}, { -990425010,  -414704479}, { -990583974,  -414324625}, 
+	{ -989468165,  -416982319}, { -989628003,  -416602832}, { -989787696,  -416223284}, { -989947243,  -415843674}, 
+	{ -988827359,  -418499653}, { -988987779,  -418120411}, { -989148053,  -417741109}, { -989308182,  -417361744}, 
+	{ -988184225,  -420016002}, { -988345227,  -419637007}, { -988506083,  -419257951}, { -988666793,  -418878833}, 
+	{ -987538766,  -421531363}, { -987700349,  -421152615}, { -987861786,  -420773806}, { -988023078,  -420394935}, 
+	{ -986890984,  -423045732}, { -987053147,  -422667233}, { -987215165,  -422288671}, { -987377038,  -421910048}, 
+	{ -986240879,  -424559105}, { -986403623,  -424180855}, { -986566221,  -423802543}, { -986728675,  -423424169}, 
+	{ -985588453,  -426071480}, { -985751777,  -425693480}, { -985914956,  -425315418}, { -986077990,  -424937293}, 
+	{ -984933708,  -427582852}, { -985097612,  -427205103}, { -985261370,  -426827291}, { -985424984,  -426449417}, 
+	{ -984276646,  -429093217}, { -984441129,  -428715720}, { -984605467,  -428338160}, { -984769660,  -427960537}, 
+	{ -983617267,  -430602573}, { -983782329,  -430225329}, { -983947246,  -429848022}, { -984112018,  -429470651}, 
+	{ -982955574,  -432110916}, { -983121214,  -431733926}, { -983286710,  -431356872}, { -983452061,  -430979754}, 
+	{ -982291568,  -433618242}, { -982457786,  -433241506}, { -982623860,  -432864706}, { -982789789,  -432487843}, 
+	{ -981625251,  -435124548}, { -981792047,  -434748067}, { -981958698,  -434371523}, { -982125205,  -433994914}, 
+	{ -980956623,  -436629829}, { -981123997,  -436253605}, { -981291226,  -435877317}, { -981458310,  -435500964}, 
+	{ -980285688,  -438134084}, { -980453638,  -437758117}, { -980621444,  -437382085}, { -980789106,  -437005989}, 
+	{ -979612445,  -439637307}, { -979780972,  -439261598}, { -979949355,  -438885824}, { -980117593,  -438509986}, 
+	{ -978936898,  -441139496}, { -979106001,  -440764046}, { -979274960,  -440388531}, { -979443774,  -440012951}, 
+	{ -978259047,  -442640647}, { -978428725,  -442265456}, { -978598260,  -441890201}, { -978767651,  -441514881}, 
+	{ -977578894,  -444140756}, { -977749148,  -443765826}, { -977919258,  -443390832}, { -978089224,  -443015772}, 
+	{ -976896441,  -445639820}, { -977067269,  -445265152}, { -977237955,  -444890419}, { -977408496,  -444515620}, 
+	{ -976211688,  -447137835}, { -976383092,  -446763430}, { -976554352,  -446388959}, { -976725468,  -446014422}, 
+	{ -975524639,  -448634799}, { -975696617,  -448260657}, { -975868451,  -447886449}, { -976040141,  -447512175}, 
+	{ -974835295,  -450130706}, { -975007846,  -449756829}, { -975180254,  -449382885}, { -975352518,  -449008875}, 
+	{ -974143656,  -451625555}, { -974316781,  -451251942}, { -974489762,  -450878263}, { -974662600,  -450504518}, 
+	{ -973449725,  -453119340}, { -973623423,  -452745994}, { -973796977,  -452372581}, { -973970388,  -451999101}, 
+	{ -972753504,  -454612060}, { -972927774,  -454238980}, { -973101901,  -453865834}, { -973275885,  -453492620}, 
+	{ -972054994,  -456103710}, { -972229836,  -455730898}, { -972404535,  -455358019}, { -972579091,  -454985073}, 
+	{ -971354196,  -457594286}, { -971529610,  -457221743}, { -971704881,  -456849132}, { -971880009,  -456476455}, 
+	{ -970651112,  -459083786}, { -970827098,  -458711512}, { -971002940,  -458339171}, { -971178639,  -457966762}, 
+	{ -969945745,  -460572205}, { -970122301,  -460200202}, { -970298714,  -459828131}, { -970474985,  -459455992}, 
+	{ -969238095,  -462059541}, { -969415222,  -461687809}, { -969592205,  -461316009}, { -969769046,  -460944141}, 
+	{ -968528165,  -463545789}, { -968705861,  -463174329}, { -968883415,  -462802801}, { -969060826,  -462431205}, 
+	{ -967815955,  -465030947}, { -967994221,  -464659760}, { -968172345,  -464288505}, { -968350326,  -463917181}, 
+	{ -967101468,  -466515010}, { -967280303,  -466144097}, { -967458996,  -465773116}, { -967637547,  -465402066}, 
+	{ -966384706,  -467997976}, { -966564109,  -467627338}, { -966743371,  -467256631}, { -966922491,  -466885855}, 
+	{ -965665669,  -469479840}, { -965845641,  -469109478}, { -966025471,  -468739046}, { -966205159,  -468368545}, 
+	{ -964944360,  -470960600}, { -965124900,  -470590514}, { -965305298,  -470220358}, { -965485555,  -469850134}, 
+	{ -964220780,  -472440251}, { -964401888,  -472070443}, { -964582854,  -471700564}, { -964763678,  -471330617}, 
+	{ -963494932,  -473918791}, { -963676607,  -473549261}, { -963858140,  -473179660}, { -964039531,  -472809991}, 
+	{ -962766816,  -475396216}, { -962949058,  -475026964}, { -963131157,  -474657643}, { -963313116,  -474288252}, 
+	{ -962036435,  -476872522}, { -962219243,  -476503550}, { -962401909,  -476134509}, { -962584433,  -475765397}, 
+	{ -961303790,  -478347705}, { -961487164,  -477979015}, { -961670396,  -477610254}, { -961853486,  -477241423}, 
+	{ -960568883,  -479821764}, { -960752822,  -479453355}, { -960936620,  -479084875}, { -961120276,  -478716326}, 
+	{ -959831716,  -481294693}, { -960016220,  -480926566}, { -960200582,  -480558369}, { -960384803,  -480190102}, 
+	{ -959092290,  -482766489}, { -959277359,  -482398646}, { -959462286,  -482030733}, { -959647071,  -481662748}, 
+	{ -958350608,  -484237150}, { -958536240,  -483869591}, { -958721731,  -483501962}, { -958907081,  -483134261}, 
+	{ -957606670,  -485706671}, { -957792866,  -485339398}, { -957978921,  -484972053}, { -958164835,  -484604637}, 
+	{ -956860479,  -487175049}, { -957047238,  -486808062}, { -957233856,  -486441003}, { -957420333,  -486073873}, 
+	{ -956112036,  -488642281}, { -956299358,  -488275581}, { -956486539,  -487908809}, { -956673579,  -487541965}, 
+	{ -955361344,  -490108363}, { -955549228,  -489741950}, { -955736971,  -489375466}, { -955924574,  -489008909}, 
+	{ -954608403,  -491573292}, { -954796849,  -491207168}, { -954985154,  -490840972}, { -955173319,  -490474703}, 
+	{ -953853216,  -493037064}, { -954042224,  -492671229}, { -954231090,  -492305322}, { -954419817,  -491939343}, 
+	{ -953095785,  -494499676}, { -953285353,  -494134132}, { -953474781,  -493768515}, { -953664069,  -493402826}, 
+	{ -952336111,  -495961124}, { -952526240,  -495595871}, { -952716228,  -495230545}, { -952906077,  -494865147}, 
+	{ -951574196,  -497421405}, { -951764885,  -497056444}, { -951955434,  -496691410}, { -952145842,  -496326304}, 
+	{ -950810042,  -498880516}, { -951001290,  -498515848}, { -951192399,  -498151107}, { -951383367,  -497786293}, 
+	{ -950043650,  -500338453}, { -950235458,  -499974079}, { -950427126,  -499609631}, { -950618654,  -499245110}, 
+	{ -949275023,  -501795212}, { -949467390,  -501431133}, { -949659616,  -501066980}, { -949851703,  -500702753}, 
+	{ -948504163,  -503250791}, { -948697087,  -502887007}, { -948889872,  -502523149}, { -949082517,  -502159217}, 
+	{ -947731070,  -504705185}, { -947924552,  -504341698}, { -948117895,  -503978136}, { -948311099,  -503614500}, 
+	{ -946955747,  -506158392}, { -947149787,  -505795202}, { -947343687,  -505431937}, { -947537448,  -505068598}, 
+	{ -946178196,  -507610408}, { -946372792,  -507247516}, { -946567250,  -506884549}, { -946761568,  -506521508}, 
+	{ -945398418,  -509061229}, { -945593571,  -508698636}, { -945788585,  -508335968}, { -945983460,  -507973225}, 
+	{ -944616416,  -510510853}, { -944812125,  -510148559}, { -945007695,  -509786191}, { -945203126,  -509423748}, 
+	{ -943832191,  -511959275}, { -944028456,  -511597282}, { -944224582,  -511235214}, { -944420568,  -510873071}, 
+	{ -943045745,  -513406493}, { -943242565,  -513044801}, { -943439246,  -512683035}, { -943635788,  -512321192}, 
+	{ -942257081,  -514852502}, { -942454455,  -514491113}, { -942651690,  -514129648}, { -942848787,  -513768108}, 
+	{ -941466198,  -516297300}, { -941664127,  -515936214}, { -941861917,  -515575053}, { -942059568,  -515213815}, 
+	{ -940673101,  -517740883}, { -940871583,  -517380101}, { -941069926,  -517019243}, { -941268132,  -516658310}, 
+	{ -939877790,  -519183248}, { -940076825,  -518822771}, { -940275722,  -518462218}, { -940474481,  -518101588}, 
+	{ -939080267,  -520624391}, { -939279855,  -520264220}, { -939479305,  -519903972}, { -939678616,  -519543648}, 
+	{ -938280535,  -522064309}, { -938480675,  -521704444}, { -938680677,  -521344503}, { -938880541,  -520984485}, 
+	{ -937478595,  -523502998}, { -937679287,  -523143441}, { -937879841,  -522783807}, { -938080257,  -522424096}, 
+	{ -936674448,  -524940456}, { -936875692,  -524581207}, { -937076797,  -524221881}, { -937277765,  -523862478}, 
+	{ -935868098,  -526376678}, { -936069892,  -526017739}, { -936271549,  -525658722}, { -936473067,  -525299627}, 
+	{ -935059546,  -527811662}, { -935261890,  -527453033}, { -935464097,  -527094325}, { -935666166,  -526735541}, 
+	{ -934248793,  -529245404}, { -934451687,  -528887085}, { -934654444,  -528528689}, { -934857064,  -528170214}, 
+	{ -933435842,  -530677900}, { -933639286,  -530319893}, { -933842592,  -529961808}, { -934045761,  -529603645}, 
+	{ -932620694,  -532109148}, { -932824687,  -531751453}, { -933028542,  -531393681}, { -933232261,  -531035830}, 
+	{ -931803352,  -533539144}, { -932007893,  -533181762}, { -932212297,  -532824303}, { -932416564,  -532466765}, 
+	{ -930983817,  -534967884}, { -931188906,  -534610817}, { -931393859,  -534253671}, { -931598674,  -533896447}, 
+	{ -930162092,  -536395365}, { -930367728,  -536038613}, { -930573228,  -535681782}, { -930778591,  -535324872}, 
+	{ -929338177,  -537821584}, { -929544361,  -537465148}, { -929750408,  -537108633}, { -929956318,  -536752038}, 
+	{ -928512076,  -539246538}, { -928718807,  -538890418}, { -928925400,  -538534220}, { -929131857,  -538177942}, 
+	{ -927683790,  -540670223}, { -927891067,  -540314421}, { -928098206,  -539958539}, { -928305210,  -539602578}, 
+	{ -926853322,  -542092635}, { -927061143,  -541737151}, { -927268829,  -541381588}, { -927476378,  -541025945}, 
+	{ -926020672,  -543513772}, { -926229039,  -543158607}, { -926437269,  -542803363}, { -926645363,  -542448039}, 
+	{ -925185843,  -544933630}, { -925394754,  -544578785}, { -925603530,  -544223861}, { -925812169,  -543868856}, 
+	{ -924348837,  -546352205}, { -924558292,  -545997682}, { -924767612,  -545643078}, { -924976795,  -545288394}, 
+	{ -923509656,  -547769495}, { -923719655,  -547415294}, { -923929518,  -547061011}, { -924139246,  -546706649}, 
+	{ -922668302,  -549185496}, { -922878844,  -548831617}, { -923089250,  -548477657}, { -923299521,  -548123617}, 
+	{ -921824777,  -550600205}, { -922035861,  -550246649}, { -922246810,  -549893013}, { -922457624,  -549539295}, 
+	{ -920979082,  -552013618}, { -921190709,  -551660387}, { -921402200,  -551307074}, { -921613556,  -550953680}, 
+	{ -920131221,  -553425732}, { -920343389,  -553072826}, { -920555422,  -552719838}, { -920767320,  -552366769}, 
+	{ -919281194,  -554836544}, { -919493904,  -554483964}, { -919706478,  -554131301}, { -919918917,  -553778558}, 
+	{ -918429004,  -556246051}, { -918642254,  -555893797}, { -918855369,  -555541461}, { -919068349,  -555189044}, 
+	{ -917574653,  -557654248}, { -917788443,  -557302322}, { -918002099,  -556950313}, { -918215619,  -556598223}, 
+	{ -916718143,  -559061133}, { -916932473,  -558709535}, { -917146668,  -558357855}, { -917360728,  -558006093}, 
+	{ -915859476,  -560466703}, { -916074345,  -560115434}, { -916289079,  -559764083}, { -916503678,  -559412649}, 
+	{ -914998653,  -561870954}, { -915214061,  -561520015}, { -915429334,  -561168994}, { -915644472,  -560817890}, 
+	{ -914135678,  -563273883}, { -914351624,  -562923275}, { -914567435,  -562572584}, { -914783111,  -562221810}, 
+	{ -913270551,  -564675486}, { -913487035,  -564325210}, { -913703383,  -563974850}, { -913919598,  -563624408}, 
+	{ -912403276,  -566075761}, { -912620296,  -565725817}, { -912837182,  -565375790}, { -913053934,  -565025679}, 
+	{ -911533853,  -567474703}, { -911751410,  -567125093}, { -911968833,  -566775399}, { -912186121,  -566425621}, 
+	{ -910662286,  -568872310}, { -910880379,  -568523034}, { -911098338,  -568173674}, { -911316163,  -567824230}, 
+	{ -909788576,  -570268579}, { -910007204,  -569919637}, { -910225699,  -569570612}, { -910444059,  -569221503}, 
+	{ -908912725,  -571663506}, { -909131888,  -571314900}, { -909350918,  -570966210}, { -909569814,  -570617437}, 
+	{ -908034735,  -573057087}, { -908254433,  -572708818}, { -908473997,  -572360465}, { -908693428,  -572012027}, 
+	{ -907154608,  -574449320}, { -907374840,  -574101389}, { -907594938,  -573753372}, { -907814903,  -573405272}, 
+	{ -906272347,  -575840202}, { -906493112,  -575492608}, { -906713744,  -575144930}, { -906934243,  -574797167}, 
+	{ -905387953,  -577229728}, { -905609251,  -576882473}, { -905830417,  -576535134}, { -906051448,  -576187710}, 
+	{ -904501429,  -578617896}, { -904723260,  -578270981}, { -904944957,  -577923982}, { -905166522,  -577576897}, 
+	{ -903612776,  -580004702}, { -903835139,  -579658129}, { -904057369,  -579311470}, { -904279465,  -578964725}, 
+	{ -902721998,  -581390144}, { -902944892,  -581043912}, { -903167653,  -580697594}, { -903390281,  -580351191}, 
+	{ -901829095,  -582774218}, { -902052519,  -582428328}, { -902275811,  -582082352}, { -902498971,  -581736291}, 
+	{ -900934069,  -584156920}, { -901158025,  -583811373}, { -901381847,  -583465740}, { -901605537,  -583120022}, 
+	{ -900036924,  -585538248}, { -900261409,  -585193045}, { -900485762,  -584847756}, { -900709982,  -584502381}, 
+	{ -899137661,  -586918198}, { -899362675,  -586573340}, { -899587557,  -586228395}, { -899812307,  -585883365}, 
+	{ -898236282,  -588296766}, { -898461825,  -587952254}, { -898687236,  -587607655}, { -898912515,  -587262969}, 
+	{ -897332790,  -589673951}, { -897558861,  -589329785}, { -897784800,  -588985532}, { -898010607,  -588641192}, 
+	{ -896427186,  -591049748}, { -896653785,  -590705929}, { -896880252,  -590362023}, { -897106587,  -590018030}, 
+	{ -895519473,  -592424154}, { -895746599,  -592080683}, { -895973593,  -591737125}, { -896200456,  -591393480}, 
+	{ -894609652,  -593797166}, { -894837305,  -593454044}, { -895064826,  -593110835}, { -895292215,  -592767538}, 
+	{ -893697727,  -595168781}, { -893925905,  -594826008}, { -894153953,  -594483148}, { -894381868,  -594140201}, 
+	{ -892783698,  -596538995}, { -893012402,  -596196573}, { -893240975,  -595854063}, { -893469417,  -595511466}, 
+	{ -891867569,  -597907806}, { -892096798,  -597565735}, { -892325896,  -597223576}, { -892554863,  -596881330}, 
+	{ -890949341,  -599275210}, { -891179094,  -598933491}, { -891408717,  -598591684}, { -891638208,  -598249789}, 
+	{ -890029016,  -600641203}, { -890259294,  -600299837}, { -890489440,  -599958383}, { -890719456,  -599616840}, 
+	{ -889106597,  -602005783}, { -889337398,  -601664771}, { -889568068,  -601323670}, { -889798608,  -600982481}, 
+	{ -888182086,  -603368947}, { -888413410,  -603028289}, { -888644603,  -602687543}, { -888875666,  -602346707}, 
+	{ -887255485,  -604730691}, { -887487331,  -604390388}, { -887719047,  -604049997}, { -887950632,  -603709516}, 
+	{ -886326796,  -606091012}, { -886559164,  -605751065}, { -886791402,  -605411029}, { -887023509,  -605070905}, 
+	{ -885396022,  -607449906}, { -885628911,  -607110317}, { -885861670,  -606770638}, { -886094298,  -606430869}, 
+	{ -884463164,  -608807372}, { -884696574,  -608468140}, { -884929853,  -608128818}, { -885163003,  -607789407}, 
+	{ -883528225,  -610163404}, { -883762155,  -609824531}, { -883995955,  -609485567}, { -884229624,  -609146514}, 
+	{ -882591207,  -611518001}, { -882825656,  -611179487}, { -883059976,  -610840882}, { -883294165,  -610502188}, 
+	{ -881652112,  -612871159}, { -881887080,  -612533005}, { -882121919,  -612194760}, { -882356628,  -611856426}, 
+	{ -880710943,  -614222875}, { -880946429,  -613885081}, { -881181787,  -613547198}, { -881417014,  -613209223}, 
+	{ -879767701,  -615573145}, { -880003705,  -615235714}, { -880239581,  -614898191}, { -880475326,  -614560578}, 
+	{ -878822389,  -616921967}, { -879058911,  -616584898}, { -879295303,  -616247738}, { -879531567,  -615910487}, 
+	{ -877875009,  -618269338}, { -878112047,  -617932631}, { -878348957,  -617595834}, { -878585737,  -617258946}, 
+	{ -876925563,  -619615253}, { -877163118,  -619278911}, { -877400544,  -618942478}, { -877637841,  -618605953}, 
+	{ -875974054,  -620959711}, { -876212124,  -620623733}, { -876450066,  -620287664}, { -876687879,  -619951504}, 
+	{ -875020483,  -622302707}, { -875259069,  -621967095}, { -875497526,  -621631392}, { -875735854,  -621295597}, 
+	{ -874064853,  -623644239}, { -874303954,  -623308993}, { -874542925,  -622973656}, { -874781769,  -622638227}, 
+	{ -873107167,  -624984303}, { -873346781,  -624649425}, { -873586267,  -624314455}, { -873825625,  -623979393}, 
+	{ -872147426,  -626322897}, { -872387554,  -625988387}, { -872627553,  -625653784}, { -872867424,  -625319090}, 
+	{ -871185633,  -627660017}, { -871426274,  -627325875}, { -871666786,  -626991641}, { -871907170,  -626657315}, 
+	{ -870221790,  -628995660}, { -870462943,  -628661888}, { -870703968,  -628328023}, { -870944865,  -627994066}, 
+	{ -869255900,  -630329823}, { -869497564,  -629996421}, { -869739101,  -629662927}, { -869980510,  -629329340}, 
+	{ -868287963,  -631662503}, { -868530139,  -631329472}, { -868772187,  -630996348}, { -869014107,  -630663132}, 
+	{ -867317984,  -632993696}, { -867560670,  -632661037}, { -867803229,  -632328285}, { -868045660,  -631995440}, 
+	{ -866345964,  -634323400}, { -866589160,  -633991114}, { -866832229,  -633658734}, { -867075170,  -633326262}, 
+	{ -865371905,  -635651611}, { -865615611,  -635319698}, { -865859189,  -634987692}, { -866102640,  -634655593}, 
+	{ -864395810,  -636978327}, { -864640024,  -636646788}, { -864884112,  -636315156}, { -865128072,  -635983430}, 
+	{ -863417681,  -638303543}, { -863662404,  -637972380}, { -863906999,  -637641122}, { -864151468,  -637309771}, 
+	{ -862437520,  -639627258}, { -862682750,  -639296470}, { -862927854,  -638965588}, { -863172831,  -638634613}, 
+	{ -861455330,  -640949467}, { -861701067,  -640619056}, { -861946678,  -640288551}, { -862192163,  -639957951}, 
+	{ -860471112,  -642270169}, { -860717357,  -641940135}, { -860963474,  -641610007}, { -861209465,  -641279784}, 
+	{ -859484870,  -643589359}, { -859731620,  -643259703}, { -859978244,  -642929953}, { -860224742,  -642600108}, 
+	{ -858496606,  -644907034}, { -858743861,  -644577757}, { -858990991,  -644248386}, { -859237994,  -643918920}, 
+	{ -857506321,  -646223192}, { -857754081,  -645894295}, { -858001716,  -645565303}, { -858249224,  -645236216}, 
+	{ -856514019,  -647537830}, { -856762283,  -647209313}, { -857010422,  -646880701}, { -857258434,  -646551994}, 
+	{ -855519701,  -648850943}, { -855768469,  -648522808}, { -856017111,  -648194577}, { -856265628,  -647866251}, 
+	{ -854523370,  -650162530}, { -854772641,  -649834777}, { -855021787,  -649506928}, { -855270806,  -649178983}, 
+	{ -853525028,  -651472587}, { -853774802,  -651145216}, { -854024450,  -650817750}, { -854273973,  -650490188}, 
+	{ -852524677,  -652781111}, { -852774953,  -652454124}, { -853025104,  -652127041}, { -853275128,  -651799862}, 
+	{ -851522321,  -654088099}, { -851773098,  -653761496}, { -852023750,  -653434797}, { -852274276,  -653108002}, 
+	{ -850517961,  -655393548}, { -850769239,  -655067330}, { -851020391,  -654741016}, { -851271419,  -654414606}, 
+	{ -849511600,  -656697454}, { -849763378,  -656371622}, { -850015030,  -656045694}, { -850266558,  -655719669}, 
+	{ -848503239,  -657999816}, { -848755517,  -657674370}, { -849007669,  -657348828}, { -849259697,  -657023190}, 
+	{ -847492882,  -659300629}, { -847745659,  -658975571}, { -847998310,  -658650416}, { -848250837,  -658325164}, 
+	{ -846480531,  -660599890}, { -846733806,  -660275220}, { -846986956,  -659950454}, { -847239981,  -659625590}, 
+	{ -845466188,  -661897597}, { -845719960,  -661573317}, { -845973608,  -661248938}, { -846227132,  -660924463}, 
+	{ -844449856,  -663193747}, { -844704125,  -662869856}, { -844958270,  -662545867}, { -845212291,  -662221781}, 
+	{ -843431536,  -664488336}, { -843686302,  -664164835}, { -843940944,  -663841237}, { -844195462,  -663517541}, 
+	{ -842411232,  -665781362}, { -842666494,  -665458252}, { -842921632,  -665135044}, { -843176646,  -664811739}, 
+	{ -841388945,  -667072820}, { -841644702,  -666750103}, { -841900336,  -666427287}, { -842155846,  -666104373}, 
+	{ -840364679,  -668362709}, { -840620931,  -668040385}, { -840877059,  -667717961}, { -841133064,  -667395440}, 
+	{ -839338435,  -669651026}, { -839595181,  -669329094}, { -839851804,  -669007064}, { -840108303,  -668684936}, 
+	{ -838310216,  -670937767}, { -838567456,  -670616229}, { -838824572,  -670294593}, { -839081565,  -669972859}, 
+	{ -837280024,  -672222928}, { -837537757,  -671901786}, { -837795367,  -671580545}, { -838052853,  -671259205}, 
+	{ -836247863,  -673506508}, { -836506088,  -673185762}, { -836764190,  -672864916}, { -837022168,  -672543972}, 
+	{ -835213733,  -674788504}, { -835472450,  -674468154}, { -835731044,  -674147704}, { -835989515,  -673827156}, 
+	{ -834177638,  -676068911}, { -834436846,  -675748958}, { -834695931,  -675428906}, { -834954893,  -675108755}, 
+	{ -833139580,  -677347728}, { -833399279,  -677028173}, { -833658855,  -676708518}, { -833918308,  -676388765}, 
+	{ -832099562,  -678624950}, { -832359750,  -678305794}, { -832619816,  -677986538}, { -832879760,  -677667183}, 
+	{ -831057586,  -679900576}, { -831318263,  -679581820}, { -831578819,  -679262963}, { -831839252,  -678944007}, 
+	{ -830013654,  -681174602}, { -830274820,  -680856246}, { -830535864,  -680537789}, { -830796786,  -680219233}, 
+	{ -828967769,  -682447025}, { -829229423,  -682129070}, { -829490956,  -681811014}, { -829752366,  -681492858}, 
+	{ -827919934,  -683717842}, { -828182075,  -683400289}, { -828444095,  -683082635}, { -828705993,  -682764880}, 
+	{ -826870150,  -684987051}, { -827132778,  -684669900}, { -827395285,  -684352648}, { -827657670,  -684035295}, 
+	{ -825818421,  -686254647}, { -826081535,  -685937899}, { -826344528,  -685621051}, { -826607400,  -685304101}, 
+	{ -824764748,  -687520629}, { -825028348,  -687204285}, { -825291827,  -686887840}, { -825555185,  -686571294}, 
+	{ -823709135,  -688784993}, { -823973220,  -688469054}, { -824237184,  -688153013}, { -824501026,  -687836872}, 
+	{ -822651583,  -690047736}, { -822916152,  -689732202}, { -823180601,  -689416567}, { -823444928,  -689100831}, 
+	{ -821592095,  -691308855}, { -821857149,  -690993728}, { -822122081,  -690678499}, { -822386892,  -690363168}, 
+	{ -820530675,  -692568348}, { -820796211,  -692253627}, { -821061627,  -691938805}, { -821326921,  -691623881}, 
+	{ -819467323,  -693826211}, { -819733342,  -693511898}, { -819999240,  -693197483}, { -820265018,  -692882966}, 
+	{ -818402043,  -695082441}, { -818668544,  -694768537}, { -818934924,  -694454530}, { -819201184,  -694140422}, 
+	{ -817334838,  -696337036}, { -817601820,  -696023541}, { -817868681,  -695709943}, { -818135422,  -695396243}, 
+	{ -816265709,  -697589992}, { -816533171,  -697276907}, { -816800514,  -696963719}, { -817067736,  -696650429}, 
+	{ -815194659,  -698841307}, { -815462602,  -698528632}, { -815730424,  -698215855}, { -815998127,  -697902975}, 
+	{ -814121692,  -700090977}, { -814390113,  -699778714}, { -814658415,  -699466348}, { -814926597,  -699153879}, 
+	{ -813046808,  -701339000}, { -813315708,  -701027149}, { -813584489,  -700715194}, { -813853150,  -700403137}, 
+	{ -811970011,  -702585372}, { -812239390,  -702273934}, { -812508649,  -701962393}, { -812777788,  -701650748}, 
+	{ -810891304,  -703830092}, { -811161160,  -703519067}, { -811430896,  -703207939}, { -811700513,  -702896707}, 
+	{ -809810688,  -705073155}, { -810081021,  -704762544}, { -810351235,  -704451830}, { -810621329,  -704141013}, 
+	{ -808728167,  -706314559}, { -808998976,  -706004363}, { -809269666,  -705694064}, { -809540237,  -705383661}, 
+	{ -807643743,  -707554301}, { -807915028,  -707244521}, { -808186193,  -706934638}, { -808457240,  -706624650}, 
+	{ -806557419,  -708792378}, { -806829178,  -708483015}, { -807100819,  -708173547}, { -807372340,  -707863976}, 
+	{ -805469196,  -710028787}, { -805741430,  -709719841}, { -806013545,  -709410791}, { -806285541,  -709101636}, 
+	{ -804379079,  -711263525}, { -804651786,  -710954997}, { -804924374,  -710646365}, { -805196845,  -710337628}, 
+	{ -803287068,  -712496590}, { -803560248,  -712188481}, { -803833310,  -711880267}, { -804106253,  -711571948}, 
+	{ -802193167,  -713727978}, { -802466820,  -713420288}, { -802740354,  -713112494}, { -803013770,  -712804594}, 
+	{ -801097379,  -714957687}, { -801371503,  -714650417}, { -801645509,  -714343043}, { -801919397,  -714035563}, 
+	{ -799999706,  -716185713}, { -800274300,  -715878864}, { -800548778,  -715571910}, { -800823137,  -715264851}, 
+	{ -798900150,  -717412054}, { -799175215,  -717105627}, { -799450163,  -716799095}, { -799724993,  -716492457}, 
+	{ -797798714,  -718636707}, { -798074249,  -718330702}, { -798349667,  -718024592}, { -798624967,  -717718376}, 
+	{ -796695401,  -719859669}, { -796971405,  -719554087}, { -797247292,  -719248400}, { -797523061,  -718942606}, 
+	{ -795590213,  -721080937}, { -795866685,  -720775779}, { -796143041,  -720470515}, { -796419279,  -720165145}, 
+	{ -794483153,  -722300508}, { -794760093,  -721995775}, { -795036917,  -721690935}, { -795313623,  -721385989}, 
+	{ -793374223,  -723518380}, { -793651631,  -723214072}, { -793928922,  -722909657}, { -794206096,  -722605136}, 
+	{ -792263427,  -724734549}, { -792541301,  -724430667}, { -792819059,  -724126677}, { -793096699,  -723822582}, 
+	{ -791150767,  -725949013}, { -791429106,  -725645557}, { -791707330,  -725341994}, { -791985437,  -725038325}, 
+	{ -790036244,  -727161768}, { -790315049,  -726858740}, { -790593738,  -726555604}, { -790872310,  -726252362}, 
+	{ -788919863,  -728372813}, { -789199133,  -728070212}, { -789478286,  -727767504}, { -789757323,  -727464690}, 
+	{ -787801625,  -729582143}, { -788081359,  -729279971}, { -788360976,  -728977692}, { -788640478,  -728675306}, 
+	{ -786681534,  -730789757}, { -786961731,  -730488014}, { -787241811,  -730186165}, { -787521776,  -729884208}, 
+	{ -785559591,  -731995651}, { -785840250,  -731694339}, { -786120794,  -731392919}, { -786401222,  -731091392}, 
+	{ -784435800,  -733199822}, { -784716921,  -732898941}, { -784997927,  -732597952}, { -785278817,  -732296855}, 
+	{ -783310163,  -734402269}, { -783591746,  -734101819}, { -783873212,  -733801261}, { -784154564,  -733500596}, 
+	{ -782182683,  -735602987}, { -782464726,  -735302970}, { -782746654,  -735002844}, { -783028466,  -734702610}, 
+	{ -781053363,  -736801974}, { -781335865,  -736502390}, { -781618253,  -736202697}, { -781900526,  -735902896}, 
+	{ -779922204,  -737999228}, { -780205166,  -737700077}, { -780488013,  -737400818}, { -780770745,  -737101450}, 
+	{ -778789210,  -739194745}, { -779072631,  -738896028}, { -779355936,  -738597203}, { -779639128,  -738298270}, 
+	{ -777654384,  -740388522}, { -777938262,  -740090241}, { -778222026,  -739791851}, { -778505675,  -739493352}, 
+	{ -776517728,  -741580558}, { -776802063,  -741282712}, { -777086284,  -740984758}, { -777370391,  -740686694}, 
+	{ -775379244,  -742770848}, { -775664036,  -742473439}, { -775948714,  -742175921}, { -776233278,  -741878294}, 
+	{ -774238936,  -743959390}, { -774524184,  -743662419}, { -774809318,  -743365338}, { -775094338,  -743068147}, 
+	{ -773096806,  -745146182}, { -773382509,  -744849649}, { -773668099,  -744553005}, { -773953574,  -744256253}, 
+	{ -771952857,  -746331221}, { -772239015,  -746035126}, { -772525059,  -745738921}, { -772810989,  -745442606}, 
+	{ -770807092,  -747514503}, { -771093703,  -747218847}, { -771380201,  -746923082}, { -771666586,  -746627206}, 
+	{ -769659512,  -748696026}, { -769946577,  -748400811}, { -770233528,  -748105485}, { -770520367,  -747810049}, 
+	{ -768510122,  -749875788}, { -768797639,  -749581013}, { -769085043,  -749286127}, { -769372334,  -748991132}, 
+	{ -767358923,  -751053785}, { -767646892,  -750759451}, { -767934748,  -750465007}, { -768222492,  -750170453}, 
+	{ -766205919,  -752230015}, { -766494339,  -751936123}, { -766782646,  -751642121}, { -767070841,  -751348008}, 
+	{ -765051111,  -753404474}, { -765339982,  -753111025}, { -765628740,  -752817466}, { -765917386,  -752523796}, 
+	{ -763894504,  -754577161}, { -764183824,  -754284156}, { -764473032,  -753991040}, { -764762128,  -753697812}, 
+	{ -762736098,  -755748072}, { -763025868,  -755455511}, { -763315525,  -755162839}, { -763605071,  -754870056}, 
+	{ -761575898,  -756917205}, { -761866116,  -756625089}, { -762156223,  -756332861}, { -762446217,  -756040522}, 
+	{ -760413906,  -758084557}, { -760704572,  -757792886}, { -760995126,  -757501104}, { -761285568,  -757209210}, 
+	{ -759250125,  -759250125}, { -759541238,  -758958900}, { -759832239,  -758667564}, { -760123129,  -758376116}, 
+	{ -758084557,  -760413906}, { -758376116,  -760123129}, { -758667564,  -759832239}, { -758958900,  -759541238}, 
+	{ -756917205,  -761575898}, { -757209210,  -761285568}, { -757501104,  -760995126}, { -757792886,  -760704572}, 
+	{ -755748072,  -762736098}, { -756040522,  -762446217}, { -756332861,  -762156223}, { -756625089,  -761866116}, 
+	{ -754577161,  -763894504}, { -754870056,  -763605071}, { -755162839,  -763315525}, { -755455511,  -763025868}, 
+	{ -753404474,  -765051111}, { -753697812,  -764762128}, { -753991040,  -764473032}, { -754284156,  -764183824}, 
+	{ -752230015,  -766205919}, { -752523796,  -765917386}, { -752817466,  -765628740}, { -753111025,  -765339982}, 
+	{ -751053785,  -767358923}, { -751348008,  -767070841}, { -751642121,  -766782646}, { -751936123,  -766494339}, 
+	{ -749875788,  -768510122}, { -750170453,  -768222492}, { -750465007,  -767934748}, { -750759451,  -767646892}, 
+	{ -748696026,  -769659512}, { -748991132,  -769372334}, { -749286127,  -769085043}, { -749581013,  -768797639}, 
+	{ -747514503,  -770807092}, { -747810049,  -770520367}, { -748105485,  -770233528}, { -748400811,  -769946577}, 
+	{ -746331221,  -771952857}, { -746627206,  -771666586}, { -746923082,  -771380201}, { -747218847,  -771093703}, 
+	{ -745146182,  -773096806}, { -745442606,  -772810989}, { -745738921,  -772525059}, { -746035126,  -772239015}, 
+	{ -743959390,  -774238936}, { -744256253,  -773953574}, { -744553005,  -773668099}, { -744849649,  -773382509}, 
+	{ -742770848,  -775379244}, { -743068147,  -775094338}, { -743365338,  -774809318}, { -743662419,  -774524184}, 
+	{ -741580558,  -776517728}, { -741878294,  -776233278}, { -742175921,  -775948714}, { -742473439,  -775664036}, 
+	{ -740388522,  -777654384}, { -740686694,  -777370391}, { -740984758,  -777086284}, { -741282712,  -776802063}, 
+	{ -739194745,  -778789210}, { -739493352,  -778505675}, { -739791851,  -778222026}, { -740090241,  -777938262}, 
+	{ -737999228,  -779922204}, { -738298270,  -779639128}, { -738597203,  -779355936}, { -738896028,  -779072631}, 
+	{ -736801974,  -781053363}, { -737101450,  -780770745}, { -737400818,  -780488013}, { -737700077,  -780205166}, 
+	{ -735602987,  -782182683}, { -735902896,  -781900526}, { -736202697,  -781618253}, { -736502390,  -781335865}, 
+	{ -734402269,  -783310163}, { -734702610,  -783028466}, { -735002844,  -782746654}, { -735302970,  -782464726}, 
+	{ -733199822,  -784435800}, { -733500596,  -784154564}, { -733801261,  -783873212}, { -734101819,  -783591746}, 
+	{ -731995651,  -785559591}, { -732296855,  -785278817}, { -732597952,  -784997927}, { -732898941,  -784716921}, 
+	{ -730789757,  -786681534}, { -731091392,  -786401222}, { -731392919,  -786120794}, { -731694339,  -785840250}, 
+	{ -729582143,  -787801625}, { -729884208,  -787521776}, { -730186165,  -787241811}, { -730488014,  -786961731}, 
+	{ -728372813,  -788919863}, { -728675306,  -788640478}, { -728977692,  -788360976}, { -729279971,  -788081359}, 
+	{ -727161768,  -790036244}, { -727464690,  -789757323}, { -727767504,  -789478286}, { -728070212,  -789199133}, 
+	{ -725949013,  -791150767}, { -726252362,  -790872310}, { -726555604,  -790593738}, { -726858740,  -790315049}, 
+	{ -724734549,  -792263427}, { -725038325,  -791985437}, { -725341994,  -791707330}, { -725645557,  -791429106}, 
+	{ -723518380,  -793374223}, { -723822582,  -793096699}, { -724126677,  -792819059}, { -724430667,  -792541301}, 
+	{ -722300508,  -794483153}, { -722605136,  -794206096}, { -722909657,  -793928922}, { -723214072,  -793651631}, 
+	{ -721080937,  -795590213}, { -721385989,  -795313623}, { -721690935,  -795036917}, { -721995775,  -794760093}, 
+	{ -719859669,  -796695401}, { -720165145,  -796419279}, { -720470515,  -796143041}, { -720775779,  -795866685}, 
+	{ -718636707,  -797798714}, { -718942606,  -797523061}, { -719248400,  -797247292}, { -719554087,  -796971405}, 
+	{ -717412054,  -798900150}, { -717718376,  -798624967}, { -718024592,  -798349667}, { -718330702,  -798074249}, 
+	{ -716185713,  -799999706}, { -716492457,  -799724993}, { -716799095,  -799450163}, { -717105627,  -799175215}, 
+	{ -714957687,  -801097379}, { -715264851,  -800823137}, { -715571910,  -800548778}, { -715878864,  -800274300}, 
+	{ -713727978,  -802193167}, { -714035563,  -801919397}, { -714343043,  -801645509}, { -714650417,  -801371503}, 
+	{ -712496590,  -803287068}, { -712804594,  -803013770}, { -713112494,  -802740354}, { -713420288,  -802466820}, 
+	{ -711263525,  -804379079}, { -711571948,  -804106253}, { -711880267,  -803833310}, { -712188481,  -803560248}, 
+	{ -710028787,  -805469196}, { -710337628,  -805196845}, { -710646365,  -804924374}, { -710954997,  -804651786}, 
+	{ -708792378,  -806557419}, { -709101636,  -806285541}, { -709410791,  -806013545}, { -709719841,  -805741430}, 
+	{ -707554301,  -807643743}, { -707863976,  -807372340}, { -708173547,  -807100819}, { -708483015,  -806829178}, 
+	{ -706314559,  -808728167}, { -706624650,  -808457240}, { -706934638,  -808186193}, { -707244521,  -807915028}, 
+	{ -705073155,  -809810688}, { -705383661,  -809540237}, { -705694064,  -809269666}, { -706004363,  -808998976}, 
+	{ -703830092,  -810891304}, { -704141013,  -810621329}, { -704451830,  -810351235}, { -704762544,  -810081021}, 
+	{ -702585372,  -811970011}, { -702896707,  -811700513}, { -703207939,  -811430896}, { -703519067,  -811161160}, 
+	{ -701339000,  -813046808}, { -701650748,  -812777788}, { -701962393,  -812508649}, { -702273934,  -812239390}, 
+	{ -700090977,  -814121692}, { -700403137,  -813853150}, { -700715194,  -813584489}, { -701027149,  -813315708}, 
+	{ -698841307,  -815194659}, { -699153879,  -814926597}, { -699466348,  -814658415}, { -699778714,  -814390113}, 
+	{ -697589992,  -816265709}, { -697902975,  -815998127}, { -698215855,  -815730424}, { -698528632,  -815462602}, 
+	{ -696337036,  -817334838}, { -696650429,  -817067736}, { -696963719,  -816800514}, { -697276907,  -816533171}, 
+	{ -695082441,  -818402043}, { -695396243,  -818135422}, { -695709943,  -817868681}, { -696023541,  -817601820}, 
+	{ -693826211,  -819467323}, { -694140422,  -819201184}, { -694454530,  -818934924}, { -694768537,  -818668544}, 
+	{ -692568348,  -820530675}, { -692882966,  -820265018}, { -693197483,  -819999240}, { -693511898,  -819733342}, 
+	{ -691308855,  -821592095}, { -691623881,  -821326921}, { -691938805,  -821061627}, { -692253627,  -820796211}, 
+	{ -690047736,  -822651583}, { -690363168,  -822386892}, { -690678499,  -822122081}, { -690993728,  -821857149}, 
+	{ -688784993,  -823709135}, { -689100831,  -823444928}, { -689416567,  -823180601}, { -689732202,  -822916152}, 
+	{ -687520629,  -824764748}, { -687836872,  -824501026}, { -688153013,  -824237184}, { -688469054,  -823973220}, 
+	{ -686254647,  -825818421}, { -686571294,  -825555185}, { -686887840,  -825291827}, { -687204285,  -825028348}, 
+	{ -684987051,  -826870150}, { -685304101,  -826607400}, { -685621051,  -826344528}, { -685937899,  -826081535}, 
+	{ -683717842,  -827919934}, { -684035295,  -827657670}, { -684352648,  -827395285}, { -684669900,  -827132778}, 
+	{ -682447025,  -828967769}, { -682764880,  -828705993}, { -683082635,  -828444095}, { -683400289,  -828182075}, 
+	{ -681174602,  -830013654}, { -681492858,  -829752366}, { -681811014,  -829490956}, { -682129070,  -829229423}, 
+	{ -679900576,  -831057586}, { -680219233,  -830796786}, { -680537789,  -830535864}, { -680856246,  -830274820}, 
+	{ -678624950,  -832099562}, { -678944007,  -831839252}, { -679262963,  -831578819}, { -679581820,  -831318263}, 
+	{ -677347728,  -833139580}, { -677667183,  -832879760}, { -677986538,  -832619816}, { -678305794,  -832359750}, 
+	{ -676068911,  -834177638}, { -676388765,  -833918308}, { -676708518,  -833658855}, { -677028173,  -833399279}, 
+	{ -674788504,  -835213733}, { -675108755,  -834954893}, { -675428906,  -834695931}, { -675748958,  -834436846}, 
+	{ -673506508,  -836247863}, { -673827156,  -835989515}, { -674147704,  -835731044}, { -674468154,  -835472450}, 
+	{ -672222928,  -837280024}, { -672543972,  -837022168}, { -672864916,  -836764190}, { -673185762,  -836506088}, 
+	{ -670937767,  -838310216}, { -671259205,  -838052853}, { -671580545,  -837795367}, { -671901786,  -837537757}, 
+	{ -669651026,  -839338435}, { -669972859,  -839081565}, { -670294593,  -838824572}, { -670616229,  -838567456}, 
+	{ -668362709,  -840364679}, { -668684936,  -840108303}, { -669007064,  -839851804}, { -669329094,  -839595181}, 
+	{ -667072820,  -841388945}, { -667395440,  -841133064}, { -667717961,  -840877059}, { -668040385,  -840620931}, 
+	{ -665781362,  -842411232}, { -666104373,  -842155846}, { -666427287,  -841900336}, { -666750103,  -841644702}, 
+	{ -664488336,  -843431536}, { -664811739,  -843176646}, { -665135044,  -842921632}, { -665458252,  -842666494}, 
+	{ -663193747,  -844449856}, { -663517541,  -844195462}, { -663841237,  -843940944}, { -664164835,  -843686302}, 
+	{ -661897597,  -845466188}, { -662221781,  -845212291}, { -662545867,  -844958270}, { -662869856,  -844704125}, 
+	{ -660599890,  -846480531}, { -660924463,  -846227132}, { -661248938,  -845973608}, { -661573317,  -845719960}, 
+	{ -659300629,  -847492882}, { -659625590,  -847239981}, { -659950454,  -846986956}, { -660275220,  -846733806}, 
+	{ -657999816,  -848503239}, { -658325164,  -848250837}, { -658650416,  -847998310}, { -658975571,  -847745659}, 
+	{ -656697454,  -849511600}, { -657023190,  -849259697}, { -657348828,  -849007669}, { -657674370,  -848755517}, 
+	{ -655393548,  -850517961}, { -655719669,  -850266558}, { -656045694,  -850015030}, { -656371622,  -849763378}, 
+	{ -654088099,  -851522321}, { -654414606,  -851271419}, { -654741016,  -851020391}, { -655067330,  -850769239}, 
+	{ -652781111,  -852524677}, { -653108002,  -852274276}, { -653434797,  -852023750}, { -653761496,  -851773098}, 
+	{ -651472587,  -853525028}, { -651799862,  -853275128}, { -652127041,  -853025104}, { -652454124,  -852774953}, 
+	{ -650162530,  -854523370}, { -650490188,  -854273973}, { -650817750,  -854024450}, { -651145216,  -853774802}, 
+	{ -648850943,  -855519701}, { -649178983,  -855270806}, { -649506928,  -855021787}, { -649834777,  -854772641}, 
+	{ -647537830,  -856514019}, { -647866251,  -856265628}, { -648194577,  -856017111}, { -648522808,  -855768469}, 
+	{ -646223192,  -857506321}, { -646551994,  -857258434}, { -646880701,  -857010422}, { -647209313,  -856762283}, 
+	{ -644907034,  -858496606}, { -645236216,  -858249224}, { -645565303,  -858001716}, { -645894295,  -857754081}, 
+	{ -643589359,  -859484870}, { -643918920,  -859237994}, { -644248386,  -858990991}, { -644577757,  -858743861}, 
+	{ -642270169,  -860471112}, { -642600108,  -860224742}, { -642929953,  -859978244}, { -643259703,  -859731620}, 
+	{ -640949467,  -861455330}, { -641279784,  -861209465}, { -641610007,  -860963474}, { -641940135,  -860717357}, 
+	{ -639627258,  -862437520}, { -639957951,  -862192163}, { -640288551,  -861946678}, { -640619056,  -861701067}, 
+	{ -638303543,  -863417681}, { -638634613,  -863172831}, { -638965588,  -862927854}, { -639296470,  -862682750}, 
+	{ -636978327,  -864395810}, { -637309771,  -864151468}, { -637641122,  -863906999}, { -637972380,  -863662404}, 
+	{ -635651611,  -865371905}, { -635983430,  -865128072}, { -636315156,  -864884112}, { -636646788,  -864640024}, 
+	{ -634323400,  -866345964}, { -634655593,  -866102640}, { -634987692,  -865859189}, { -635319698,  -865615611}, 
+	{ -632993696,  -867317984}, { -633326262,  -867075170}, { -633658734,  -866832229}, { -633991114,  -866589160}, 
+	{ -631662503,  -868287963}, { -631995440,  -868045660}, { -632328285,  -867803229}, { -632661037,  -867560670}, 
+	{ -630329823,  -869255900}, { -630663132,  -869014107}, { -630996348,  -868772187}, { -631329472,  -868530139}, 
+	{ -628995660,  -870221790}, { -629329340,  -869980510}, { -629662927,  -869739101}, { -629996421,  -869497564}, 
+	{ -627660017,  -871185633}, { -627994066,  -870944865}, { -628328023,  -870703968}, { -628661888,  -870462943}, 
+	{ -626322897,  -872147426}, { -626657315,  -871907170}, { -626991641,  -871666786}, { -627325875,  -871426274}, 
+	{ -624984303,  -873107167}, { -625319090,  -872867424}, { -625653784,  -872627553}, { -625988387,  -872387554}, 
+	{ -623644239,  -874064853}, { -623979393,  -873825625}, { -624314455,  -873586267}, { -624649425,  -873346781}, 
+	{ -622302707,  -875020483}, { -622638227,  -874781769}, { -622973656,  -874542925}, { -623308993,  -874303954}, 
+	{ -620959711,  -875974054}, { -621295597,  -875735854}, { -621631392,  -875497526}, { -621967095,  -875259069}, 
+	{ -619615253,  -876925563}, { -619951504,  -876687879}, { -620287664,  -876450066}, { -620623733,  -876212124}, 
+	{ -618269338,  -877875009}, { -618605953,  -877637841}, { -618942478,  -877400544}, { -619278911,  -877163118}, 
+	{ -616921967,  -878822389}, { -617258946,  -878585737}, { -617595834,  -878348957}, { -617932631,  -878112047}, 
+	{ -615573145,  -879767701}, { -615910487,  -879531567}, { -616247738,  -879295303}, { -616584898,  -879058911}, 
+	{ -614222875,  -880710943}, { -614560578,  -880475326}, { -614898191,  -880239581}, { -615235714,  -880003705}, 
+	{ -612871159,  -881652112}, { -613209223,  -881417014}, { -613547198,  -881181787}, { -613885081,  -880946429}, 
+	{ -611518001,  -882591207}, { -611856426,  -882356628}, { -612194760,  -882121919}, { -612533005,  -881887080}, 
+	{ -610163404,  -883528225}, { -610502188,  -883294165}, { -610840882,  -883059976}, { -611179487,  -882825656}, 
+	{ -608807372,  -884463164}, { -609146514,  -884229624}, { -609485567,  -883995955}, { -609824531,  -883762155}, 
+	{ -607449906,  -885396022}, { -607789407,  -885163003}, { -608128818,  -884929853}, { -608468140,  -884696574}, 
+	{ -606091012,  -886326796}, { -606430869,  -886094298}, { -606770638,  -885861670}, { -607110317,  -885628911}, 
+	{ -604730691,  -887255485}, { -605070905,  -887023509}, { -605411029,  -886791402}, { -605751065,  -886559164}, 
+	{ -603368947,  -888182086}, { -603709516,  -887950632}, { -604049997,  -887719047}, { -604390388,  -887487331}, 
+	{ -602005783,  -889106597}, { -602346707,  -888875666}, { -602687543,  -888644603}, { -603028289,  -888413410}, 
+	{ -600641203,  -890029016}, { -600982481,  -889798608}, { -601323670,  -889568068}, { -601664771,  -889337398}, 
+	{ -599275210,  -890949341}, { -599616840,  -890719456}, { -599958383,  -890489440}, { -600299837,  -890259294}, 
+	{ -597907806,  -891867569}, { -598249789,  -891638208}, { -598591684,  -891408717}, { -598933491,  -891179094}, 
+	{ -596538995,  -892783698}, { -596881330,  -892554863}, { -597223576,  -892325896}, { -597565735,  -892096798}, 
+	{ -595168781,  -893697727}, { -595511466,  -893469417}, { -595854063,  -893240975}, { -596196573,  -893012402}, 
+	{ -593797166,  -894609652}, { -594140201,  -894381868}, { -594483148,  -894153953}, { -594826008,  -893925905}, 
+	{ -592424154,  -895519473}, { -592767538,  -895292215}, { -593110835,  -895064826}, { -593454044,  -894837305}, 
+	{ -591049748,  -896427186}, { -591393480,  -896200456}, { -591737125,  -895973593}, { -592080683,  -895746599}, 
+	{ -589673951,  -897332790}, { -590018030,  -897106587}, { -590362023,  -896880252}, { -590705929,  -896653785}, 
+	{ -588296766,  -898236282}, { -588641192,  -898010607}, { -588985532,  -897784800}, { -589329785,  -897558861}, 
+	{ -586918198,  -899137661}, { -587262969,  -898912515}, { -587607655,  -898687236}, { -587952254,  -898461825}, 
+	{ -585538248,  -900036924}, { -585883365,  -899812307}, { -586228395,  -899587557}, { -586573340,  -899362675}, 
+	{ -584156920,  -900934069}, { -584502381,  -900709982}, { -584847756,  -900485762}, { -585193045,  -900261409}, 
+	{ -582774218,  -901829095}, { -583120022,  -901605537}, { -583465740,  -901381847}, { -583811373,  -901158025}, 
+	{ -581390144,  -902721998}, { -581736291,  -902498971}, { -582082352,  -902275811}, { -582428328,  -902052519}, 
+	{ -580004702,  -903612776}, { -580351191,  -903390281}, { -580697594,  -903167653}, { -581043912,  -902944892}, 
+	{ -578617896,  -904501429}, { -578964725,  -904279465}, { -579311470,  -904057369}, { -579658129,  -903835139}, 
+	{ -577229728,  -905387953}, { -577576897,  -905166522}, { -577923982,  -904944957}, { -578270981,  -904723260}, 
+	{ -575840202,  -906272347}, { -576187710,  -906051448}, { -576535134,  -905830417}, { -576882473,  -905609251}, 
+	{ -574449320,  -907154608}, { -574797167,  -906934243}, { -575144930,  -906713744}, { -575492608,  -906493112}, 
+	{ -573057087,  -908034735}, { -573405272,  -907814903}, { -573753372,  -907594938}, { -574101389,  -907374840}, 
+	{ -571663506,  -908912725}, { -572012027,  -908693428}, { -572360465,  -908473997}, { -572708818,  -908254433}, 
+	{ -570268579,  -909788576}, { -570617437,  -909569814}, { -570966210,  -909350918}, { -571314900,  -909131888}, 
+	{ -568872310,  -910662286}, { -569221503,  -910444059}, { -569570612,  -910225699}, { -569919637,  -910007204}, 
+	{ -567474703,  -911533853}, { -567824230,  -911316163}, { -568173674,  -911098338}, { -568523034,  -910880379}, 
+	{ -566075761,  -912403276}, { -566425621,  -912186121}, { -566775399,  -911968833}, { -567125093,  -911751410}, 
+	{ -564675486,  -913270551}, { -565025679,  -913053934}, { -565375790,  -912837182}, { -565725817,  -912620296}, 
+	{ -563273883,  -914135678}, { -563624408,  -913919598}, { -563974850,  -913703383}, { -564325210,  -913487035}, 
+	{ -561870954,  -914998653}, { -562221810,  -914783111}, { -562572584,  -914567435}, { -562923275,  -914351624}, 
+	{ -560466703,  -915859476}, { -560817890,  -915644472}, { -561168994,  -915429334}, { -561520015,  -915214061}, 
+	{ -559061133,  -916718143}, { -559412649,  -916503678}, { -559764083,  -916289079}, { -560115434,  -916074345}, 
+	{ -557654248,  -917574653}, { -558006093,  -917360728}, { -558357855,  -917146668}, { -558709535,  -916932473}, 
+	{ -556246051,  -918429004}, { -556598223,  -918215619}, { -556950313,  -918002099}, { -557302322,  -917788443}, 
+	{ -554836544,  -919281194}, { -555189044,  -919068349}, { -555541461,  -918855369}, { -555893797,  -918642254}, 
+	{ -553425732,  -920131221}, { -553778558,  -919918917}, { -554131301,  -919706478}, { -554483964,  -919493904}, 
+	{ -552013618,  -920979082}, { -552366769,  -920767320}, { -552719838,  -920555422}, { -553072826,  -920343389}, 
+	{ -550600205,  -921824777}, { -550953680,  -921613556}, { -551307074,  -921402200}, { -551660387,  -921190709}, 
+	{ -549185496,  -922668302}, { -549539295,  -922457624}, { -549893013,  -922246810}, { -550246649,  -922035861}, 
+	{ -547769495,  -923509656}, { -548123617,  -923299521}, { -548477657,  -923089250}, { -548831617,  -922878844}, 
+	{ -546352205,  -924348837}, { -546706649,  -924139246}, { -547061011,  -923929518}, { -547415294,  -923719655}, 
+	{ -544933630,  -925185843}, { -545288394,  -924976795}, { -545643078,  -924767612}, { -545997682,  -924558292}, 
+	{ -543513772,  -926020672}, { -543868856,  -925812169}, { -544223861,  -925603530}, { -544578785,  -925394754}, 
+	{ -542092635,  -926853322}, { -542448039,  -926645363}, { -542803363,  -926437269}, { -543158607,  -926229039}, 
+	{ -540670223,  -927683790}, { -541025945,  -927476378}, { -541381588,  -927268829}, { -541737151,  -927061143}, 
+	{ -539246538,  -928512076}, { -539602578,  -928305210}, { -539958539,  -928098206}, { -540314421,  -927891067}, 
+	{ -537821584,  -929338177}, { -538177942,  -929131857}, { -538534220,  -928925400}, { -538890418,  -928718807}, 
+	{ -536395365,  -930162092}, { -536752038,  -929956318}, { -537108633,  -929750408}, { -537465148,  -929544361}, 
+	{ -534967884,  -930983817}, { -535324872,  -930778591}, { -535681782,  -930573228}, { -536038613,  -930367728}, 
+	{ -533539144,  -931803352}, { -533896447,  -931598674}, { -534253671,  -931393859}, { -534610817,  -931188906}, 
+	{ -532109148,  -932620694}, { -532466765,  -932416564}, { -532824303,  -932212297}, { -533181762,  -932007893}, 
+	{ -530677900,  -933435842}, { -531035830,  -933232261}, { -531393681,  -933028542}, { -531751453,  -932824687}, 
+	{ -529245404,  -934248793}, { -529603645,  -934045761}, { -529961808,  -933842592}, { -530319893,  -933639286}, 
+	{ -527811662,  -935059546}, { -528170214,  -934857064}, { -528528689,  -934654444}, { -528887085,  -934451687}, 
+	{ -526376678,  -935868098}, { -526735541,  -935666166}, { -527094325,  -935464097}, { -527453033,  -935261890}, 
+	{ -524940456,  -936674448}, { -525299627,  -936473067}, { -525658722,  -936271549}, { -526017739,  -936069892}, 
+	{ -523502998,  -937478595}, { -523862478,  -937277765}, { -524221881,  -937076797}, { -524581207,  -936875692}, 
+	{ -522064309,  -938280535}, { -522424096,  -938080257}, { -522783807,  -937879841}, { -523143441,  -937679287}, 
+	{ -520624391,  -939080267}, { -520984485,  -938880541}, { -521344503,  -938680677}, { -521704444,  -938480675}, 
+	{ -519183248,  -939877790}, { -519543648,  -939678616}, { -519903972,  -939479305}, { -520264220,  -939279855}, 
+	{ -517740883,  -940673101}, { -518101588,  -940474481}, { -518462218,  -940275722}, { -518822771,  -940076825}, 
+	{ -516297300,  -941466198}, { -516658310,  -941268132}, { -517019243,  -941069926}, { -517380101,  -940871583}, 
+	{ -514852502,  -942257081}, { -515213815,  -942059568}, { -515575053,  -941861917}, { -515936214,  -941664127}, 
+	{ -513406493,  -943045745}, { -513768108,  -942848787}, { -514129648,  -942651690}, { -514491113,  -942454455}, 
+	{ -511959275,  -943832191}, { -512321192,  -943635788}, { -512683035,  -943439246}, { -513044801,  -943242565}, 
+	{ -510510853,  -944616416}, { -510873071,  -944420568}, { -511235214,  -944224582}, { -511597282,  -944028456}, 
+	{ -509061229,  -945398418}, { -509423748,  -945203126}, { -509786191,  -945007695}, { -510148559,  -944812125}, 
+	{ -507610408,  -946178196}, { -507973225,  -945983460}, { -508335968,  -945788585}, { -508698636,  -945593571}, 
+	{ -506158392,  -946955747}, { -506521508,  -946761568}, { -506884549,  -946567250}, { -507247516,  -946372792}, 
+	{ -504705185,  -947731070}, { -505068598,  -947537448}, { -505431937,  -947343687}, { -505795202,  -947149787}, 
+	{ -503250791,  -948504163}, { -503614500,  -948311099}, { -503978136,  -948117895}, { -504341698,  -947924552}, 
+	{ -501795212,  -949275023}, { -502159217,  -949082517}, { -502523149,  -948889872}, { -502887007,  -948697087}, 
+	{ -500338453,  -950043650}, { -500702753,  -949851703}, { -501066980,  -949659616}, { -501431133,  -949467390}, 
+	{ -498880516,  -950810042}, { -499245110,  -950618654}, { -499609631,  -950427126}, { -499974079,  -950235458}, 
+	{ -497421405,  -951574196}, { -497786293,  -951383367}, { -498151107,  -951192399}, { -498515848,  -951001290}, 
+	{ -495961124,  -952336111}, { -496326304,  -952145842}, { -496691410,  -951955434}, { -497056444,  -951764885}, 
+	{ -494499676,  -953095785}, { -494865147,  -952906077}, { -495230545,  -952716228}, { -495595871,  -952526240}, 
+	{ -493037064,  -953853216}, { -493402826,  -953664069}, { -493768515,  -953474781}, { -494134132,  -953285353}, 
+	{ -491573292,  -954608403}, { -491939343,  -954419817}, { -492305322,  -954231090}, { -492671229,  -954042224}, 
+	{ -490108363,  -955361344}, { -490474703,  -955173319}, { -490840972,  -954985154}, { -491207168,  -954796849}, 
+	{ -488642281,  -956112036}, { -489008909,  -955924574}, { -489375466,  -955736971}, { -489741950,  -955549228}, 
+	{ -487175049,  -956860479}, { -487541965,  -956673579}, { -487908809,  -956486539}, { -488275581,  -956299358}, 
+	{ -485706671,  -957606670}, { -486073873,  -957420333}, { -486441003,  -957233856}, { -486808062,  -957047238}, 
+	{ -484237150,  -958350608}, { -484604637,  -958164835}, { -484972053,  -957978921}, { -485339398,  -957792866}, 
+	{ -482766489,  -959092290}, { -483134261,  -958907081}, { -483501962,  -958721731}, { -483869591,  -958536240}, 
+	{ -481294693,  -959831716}, { -481662748,  -959647071}, { -482030733,  -959462286}, { -482398646,  -959277359}, 
+	{ -479821764,  -960568883}, { -480190102,  -960384803}, { -480558369,  -960200582}, { -480926566,  -960016220}, 
+	{ -478347705,  -961303790}, { -478716326,  -961120276}, { -479084875,  -960936620}, { -479453355,  -960752822}, 
+	{ -476872522,  -962036435}, { -477241423,  -961853486}, { -477610254,  -961670396}, { -477979015,  -961487164}, 
+	{ -475396216,  -962766816}, { -475765397,  -962584433}, { -476134509,  -962401909}, { -476503550,  -962219243}, 
+	{ -473918791,  -963494932}, { -474288252,  -963313116}, { -474657643,  -963131157}, { -475026964,  -962949058}, 
+	{ -472440251,  -964220780}, { -472809991,  -964039531}, { -473179660,  -963858140}, { -473549261,  -963676607}, 
+	{ -470960600,  -964944360}, { -471330617,  -964763678}, { -471700564,  -964582854}, { -472070443,  -964401888}, 
+	{ -469479840,  -965665669}, { -469850134,  -965485555}, { -470220358,  -965305298}, { -470590514,  -965124900}, 
+	{ -467997976,  -966384706}, { -468368545,  -966205159}, { -468739046,  -966025471}, { -469109478,  -965845641}, 
+	{ -466515010,  -967101468}, { -466885855,  -966922491}, { -467256631,  -966743371}, { -467627338,  -966564109}, 
+	{ -465030947,  -967815955}, { -465402066,  -967637547}, { -465773116,  -967458996}, { -466144097,  -967280303}, 
+	{ -463545789,  -968528165}, { -463917181,  -968350326}, { -464288505,  -968172345}, { -464659760,  -967994221}, 
+	{ -462059541,  -969238095}, { -462431205,  -969060826}, { -462802801,  -968883415}, { -463174329,  -968705861}, 
+	{ -460572205,  -969945745}, { -460944141,  -969769046}, { -461316009,  -969592205}, { -461687809,  -969415222}, 
+	{ -459083786,  -970651112}, { -459455992,  -970474985}, { -459828131,  -970298714}, { -460200202,  -970122301}, 
+	{ -457594286,  -971354196}, { -457966762,  -971178639}, { -458339171,  -971002940}, { -458711512,  -970827098}, 
+	{ -456103710,  -972054994}, { -456476455,  -971880009}, { -456849132,  -971704881}, { -457221743,  -971529610}, 
+	{ -454612060,  -972753504}, { -454985073,  -972579091}, { -455358019,  -972404535}, { -455730898,  -972229836}, 
+	{ -453119340,  -973449725}, { -453492620,  -973275885}, { -453865834,  -973101901}, { -454238980,  -972927774}, 
+	{ -451625555,  -974143656}, { -451999101,  -973970388}, { -452372581,  -973796977}, { -452745994,  -973623423}, 
+	{ -450130706,  -974835295}, { -450504518,  -974662600}, { -450878263,  -974489762}, { -451251942,  -974316781}, 
+	{ -448634799,  -975524639}, { -449008875,  -975352518}, { -449382885,  -975180254}, { -449756829,  -975007846}, 
+	{ -447137835,  -976211688}, { -447512175,  -976040141}, { -447886449,  -975868451}, { -448260657,  -975696617}, 
+	{ -445639820,  -976896441}, { -446014422,  -976725468}, { -446388959,  -976554352}, { -446763430,  -976383092}, 
+	{ -444140756,  -977578894}, { -444515620,  -977408496}, { -444890419,  -977237955}, { -445265152,  -977067269}, 
+	{ -442640647,  -978259047}, { -443015772,  -978089224}, { -443390832,  -977919258}, { -443765826,  -977749148}, 
+	{ -441139496,  -978936898}, { -441514881,  -978767651}, { -441890201,  -978598260}, { -442265456,  -978428725}, 
+	{ -439637307,  -979612445}, { -440012951,  -979443774}, { -440388531,  -979274960}, { -440764046,  -979106001}, 
+	{ -438134084,  -980285688}, { -438509986,  -980117593}, { -438885824,  -979949355}, { -439261598,  -979780972}, 
+	{ -436629829,  -980956623}, { -437005989,  -980789106}, { -437382085,  -980621444}, { -437758117,  -980453638}, 
+	{ -435124548,  -981625251}, { -435500964,  -981458310}, { -435877317,  -981291226}, { -436253605,  -981123997}, 
+	{ -433618242,  -982291568}, { -433994914,  -982125205}, { -434371523,  -981958698}, { -434748067,  -981792047}, 
+	{ -432110916,  -982955574}, { -432487843,  -982789789}, { -432864706,  -982623860}, { -433241506,  -982457786}, 
+	{ -430602573,  -983617267}, { -430979754,  -983452061}, { -431356872,  -983286710}, { -431733926,  -983121214}, 
+	{ -429093217,  -984276646}, { -429470651,  -984112018}, { -429848022,  -983947246}, { -430225329,  -983782329}, 
+	{ -427582852,  -984933708}, { -427960537,  -984769660}, { -428338160,  -984605467}, { -428715720,  -984441129}, 
+	{ -426071480,  -985588453}, { -426449417,  -985424984}, { -426827291,  -985261370}, { -427205103,  -985097612}, 
+	{ -424559105,  -986240879}, { -424937293,  -986077990}, { -425315418,  -985914956}, { -425693480,  -985751777}, 
+	{ -423045732,  -986890984}, { -423424169,  -986728675}, { -423802543,  -986566221}, { -424180855,  -986403623}, 
+	{ -421531363,  -987538766}, { -421910048,  -987377038}, { -422288671,  -987215165}, { -422667233,  -987053147}, 
+	{ -420016002,  -988184225}, { -420394935,  -988023078}, { -420773806,  -987861786}, { -421152615,  -987700349}, 
+	{ -418499653,  -988827359}, { -418878833,  -988666793}, { -419257951,  -988506083}, { -419637007,  -988345227}, 
+	{ -416982319,  -989468165}, { -417361744,  -989308182}, { -417741109,  -989148053}, { -418120411,  -988987779}, 
+	{ -415464004,  -990106644}, { -415843674,  -989947243}, { -416223284,  -989787696}, { -416602832,  -989628003}, 
+	{ -413944711,  -990742793}, { -414324625,  -990583974}, { -414704479,  -990425010}, { -415084272,  -990265900}, 
+	{ -412424444,  -991376610}, { -412804602,  -991218374}, { -413184699,  -991059993}, { -413564735,  -990901465}, 
+	{ -410903207,  -992008094}, { -411283607,  -991850442}, { -411663946,  -991692644}, { -412044226,  -991534700}, 
+	{ -409381002,  -992637245}, { -409761644,  -992480176}, { -410142225,  -992322961}, { -410522746,  -992165601}, 
+	{ -407857835,  -993264059}, { -408238717,  -993107575}, { -408619539,  -992950944}, { -409000301,  -992794167}, 
+	{ -406333708,  -993888536}, { -406714829,  -993732636}, { -407095891,  -993576590}, { -407476893,  -993420398}, 
+	{ -404808624,  -994510675}, { -405189985,  -994355360}, { -405571285,  -994199898}, { -405952526,  -994044290}, 
+	{ -403282588,  -995130473}, { -403664186,  -994975743}, { -404045725,  -994820867}, { -404427204,  -994665844}, 
+	{ -401755603,  -995747930}, { -402137438,  -995593785}, { -402519214,  -995439494}, { -402900931,  -995285057}, 
+	{ -400227673,  -996363043}, { -400609744,  -996209485}, { -400991756,  -996055780}, { -401373709,  -995901928}, 
+	{ -398698801,  -996975812}, { -399081107,  -996822840}, { -399463355,  -996669721}, { -399845543,  -996516456}, 
+	{ -397168991,  -997586236}, { -397551531,  -997433850}, { -397934013,  -997281317}, { -398316436,  -997128638}, 
+	{ -395638246,  -998194311}, { -396021020,  -998042512}, { -396403735,  -997890567}, { -396786392,  -997738475}, 
+	{ -394106570,  -998800038}, { -394489576,  -998648827}, { -394872524,  -998497468}, { -395255414,  -998345963}, 
+	{ -392573967,  -999403415}, { -392957205,  -999252791}, { -393340384,  -999102020}, { -393723506,  -998951103}, 
+	{ -391040440, -1000004439}, { -391423908,  -999854404}, { -391807319,  -999704221}, { -392190672,  -999553891}, 
+	{ -389505993, -1000603111}, { -389889691, -1000453664}, { -390273331, -1000304069}, { -390656915, -1000154328}, 
+	{ -387970630, -1001199428}, { -388354556, -1001050570}, { -388738426, -1000901564}, { -389122238, -1000752411}, 
+	{ -386434353, -1001793390}, { -386818508, -1001645120}, { -387202605, -1001496704}, { -387586646, -1001348140}, 
+	{ -384897167, -1002384994}, { -385281549, -1002237314}, { -385665873, -1002089486}, { -386050142, -1001941512}, 
+	{ -383359076, -1002974239}, { -383743683, -1002827149}, { -384128234, -1002679911}, { -384512729, -1002532526}, 
+	{ -381820082, -1003561124}, { -382204915, -1003414624}, { -382589691, -1003267977}, { -382974412, -1003121181}, 
+	{ -380280190, -1004145648}, { -380665247, -1003999738}, { -381050248, -1003853681}, { -381435193, -1003707476}, 
+	{ -378739403, -1004727809}, { -379124683, -1004582490}, { -379509908, -1004437024}, { -379895077, -1004291410}, 
+	{ -377197725, -1005307605}, { -377583228, -1005162878}, { -377968675, -1005018003}, { -378354067, -1004872979}, 
+	{ -375655159, -1005885036}, { -376040883, -1005740900}, { -376426553, -1005596617}, { -376812166, -1005452185}, 
+	{ -374111709, -1006460100}, { -374497654, -1006316556}, { -374883544, -1006172864}, { -375269379, -1006029024}, 
+	{ -372567379, -1007032796}, { -372953544, -1006889844}, { -373339654, -1006746744}, { -373725709, -1006603496}, 
+	{ -371022173, -1007603122}, { -371408556, -1007460763}, { -371794885, -1007318256}, { -372181160, -1007175600}, 
+	{ -369476093, -1008171077}, { -369862694, -1008029311}, { -370249242, -1007887396}, { -370635734, -1007745333}, 
+	{ -367929144, -1008736660}, { -368315962, -1008595487}, { -368702727, -1008454166}, { -369089437, -1008312696}, 
+	{ -366381329, -1009299870}, { -366768363, -1009159290}, { -367155344, -1009018562}, { -367542271, -1008877685}, 
+	{ -364832652, -1009860704}, { -365219902, -1009720718}, { -365607098, -1009580584}, { -365994240, -1009440301}, 
+	{ -363283116, -1010419162}, { -363670580, -1010279770}, { -364057991, -1010140230}, { -364445348, -1010000541}, 
+	{ -361732726, -1010975242}, { -362120403, -1010836445}, { -362508027, -1010697499}, { -362895598, -1010558405}, 
+	{ -360181484, -1011528943}, { -360569374, -1011390741}, { -360957211, -1011252390}, { -361344995, -1011113890}, 
+	{ -358629395, -1012080264}, { -359017496, -1011942657}, { -359405545, -1011804901}, { -359793541, -1011666997}, 
+	{ -357076462, -1012629204}, { -357464774, -1012492193}, { -357853034, -1012355032}, { -358241241, -1012217723}, 
+	{ -355522689, -1013175761}, { -355911211, -1013039345}, { -356299680, -1012902780}, { -356688097, -1012766067}, 
+	{ -353968079, -1013719934}, { -354356810, -1013584114}, { -354745488, -1013448145}, { -355134115, -1013312028}, 
+	{ -352412636, -1014261721}, { -352801575, -1014126498}, { -353190461, -1013991126}, { -353579296, -1013855604}, 
+	{ -350856364, -1014801122}, { -351245510, -1014666495}, { -351634604, -1014531720}, { -352023646, -1014396795}, 
+	{ -349299266, -1015338134}, { -349688618, -1015204105}, { -350077918, -1015069927}, { -350467167, -1014935599}, 
+	{ -347741347, -1015872758}, { -348130904, -1015739326}, { -348520409, -1015605745}, { -348909863, -1015472014}, 
+	{ -346182609, -1016404991}, { -346572370, -1016272157}, { -346962080, -1016139173}, { -347351739, -1016006040}, 
+	{ -344623057, -1016934832}, { -345013021, -1016802596}, { -345402934, -1016670211}, { -345792797, -1016537676}, 
+	{ -343062693, -1017462281}, { -343452860, -1017330643}, { -343842976, -1017198856}, { -344233042, -1017066919}, 
+	{ -341501523, -1017987335}, { -341891891, -1017856296}, { -342282209, -1017725107}, { -342672476, -1017593769}, 
+	{ -339939549, -1018509994}, { -340330117, -1018379554}, { -340720636, -1018248964}, { -341111104, -1018118225}, 
+	{ -338376774, -1019030256}, { -338767543, -1018900415}, { -339158261, -1018770425}, { -339548930, -1018640284}, 
+	{ -336813204, -1019548121}, { -337204171, -1019418879}, { -337595089, -1019289488}, { -337985956, -1019159947}, 
+	{ -335248841, -1020063586}, { -335640006, -1019934944}, { -336031121, -1019806153}, { -336422188, -1019677212}, 
+	{ -333683689, -1020576651}, { -334075051, -1020448610}, { -334466364, -1020320418}, { -334857627, -1020192077}, 
+	{ -332117752, -1021087314}, { -332509310, -1020959873}, { -332900819, -1020832283}, { -333292279, -1020704542}, 
+	{ -330551034, -1021595575}, { -330942787, -1021468735}, { -331334491, -1021341745}, { -331726146, -1021214605}, 
+	{ -328983538, -1022101432}, { -329375485, -1021975193}, { -329767383, -1021848804}, { -330159233, -1021722264}, 
+	{ -327415267, -1022604883}, { -327807407, -1022479246}, { -328199499, -1022353458}, { -328591543, -1022227520}, 
+	{ -325846226, -1023105929}, { -326238559, -1022980893}, { -326630843, -1022855707}, { -327023079, -1022730370}, 
+	{ -324276419, -1023604567}, { -324668942, -1023480133}, { -325061418, -1023355549}, { -325453846, -1023230814}, 
+	{ -322705848, -1024100796}, { -323098562, -1023976964}, { -323491229, -1023852982}, { -323883848, -1023728850}, 
+	{ -321134518, -1024594615}, { -321527422, -1024471386}, { -321920278, -1024348007}, { -322313087, -1024224477}, 
+	{ -319562433, -1025086024}, { -319955525, -1024963398}, { -320348570, -1024840621}, { -320741568, -1024717694}, 
+	{ -317989595, -1025575020}, { -318382875, -1025452997}, { -318776108, -1025330824}, { -319169293, -1025208499}, 
+	{ -316416009, -1026061603}, { -316809475, -1025940184}, { -317202895, -1025818614}, { -317596268, -1025696892}, 
+	{ -314841679, -1026545772}, { -315235331, -1026424956}, { -315628937, -1026303990}, { -316022496, -1026182872}, 
+	{ -313266607, -1027027525}, { -313660444, -1026907313}, { -314054235, -1026786951}, { -314447980, -1026666437}, 
+	{ -311690799, -1027506862}, { -312084820, -1027387254}, { -312478795, -1027267495}, { -312872724, -1027147586}, 
+	{ -310114257, -1027983780}, { -310508461, -1027864777}, { -310902619, -1027745623}, { -311296732, -1027626318}, 
+	{ -308536985, -1028458280}, { -308931371, -1028339882}, { -309325712, -1028221332}, { -309720007, -1028102632}, 
+	{ -306958988, -1028930359}, { -307353555, -1028812566}, { -307748077, -1028694622}, { -308142554, -1028576527}, 
+	{ -305380268, -1029400018}, { -305775015, -1029282830}, { -306169718, -1029165491}, { -306564375, -1029048001}, 
+	{ -303800829, -1029867254}, { -304195756, -1029750672}, { -304590638, -1029633939}, { -304985475, -1029517054}, 
+	{ -302220676, -1030332067}, { -302615781, -1030216091}, { -303010842, -1030099963}, { -303405858, -1029983684}, 
+	{ -300639811, -1030794455}, { -301035094, -1030679085}, { -301430332, -1030563564}, { -301825526, -1030447891}, 
+	{ -299058239, -1031254418}, { -299453698, -1031139655}, { -299849113, -1031024740}, { -300244484, -1030909673}, 
+	{ -297475964, -1031711954}, { -297871598, -1031597797}, { -298267189, -1031483489}, { -298662736, -1031369029}, 
+	{ -295892988, -1032167062}, { -296288797, -1032053513}, { -296684563, -1031939812}, { -297080285, -1031825959}, 
+	{ -294309316, -1032619742}, { -294705299, -1032506800}, { -295101239, -1032393706}, { -295497135, -1032280460}, 
+	{ -292724951, -1033069992}, { -293121107, -1032957657}, { -293517220, -1032845170}, { -293913290, -1032732532}, 
+	{ -291139898, -1033517810}, { -291536226, -1033406084}, { -291932511, -1033294205}, { -292328753, -1033182174}, 
+	{ -289554160, -1033963197}, { -289950658, -1033852079}, { -290347114, -1033740808}, { -290743528, -1033629385}, 
+	{ -287967740, -1034406151}, { -288364409, -1034295641}, { -288761035, -1034184978}, { -289157619, -1034074164}, 
+	{ -286380643, -1034846671}, { -286777480, -1034736769}, { -287174276, -1034626715}, { -287571029, -1034516509}, 
+	{ -284792871, -1035284755}, { -285189877, -1035175463}, { -285586841, -1035066018}, { -285983763, -1034956420}, 
+	{ -283204430, -1035720404}, { -283601603, -1035611720}, { -283998734, -1035502884}, { -284395824, -1035393896}, 
+	{ -281615322, -1036153615}, { -282012662, -1036045541}, { -282409959, -1035937314}, { -282807215, -1035828935}, 
+	{ -280025552, -1036584389}, { -280423056, -1036476924}, { -280820520, -1036369307}, { -281217942, -1036261537}, 
+	{ -278435122, -1037012723}, { -278832791, -1036905868}, { -279230419, -1036798861}, { -279628006, -1036691701}, 
+	{ -276844038, -1037438617}, { -277241870, -1037332372}, { -277639662, -1037225975}, { -278037413, -1037119425}, 
+	{ -275252302, -1037862069}, { -275650297, -1037756435}, { -276048251, -1037650648}, { -276446165, -1037544709}, 
+	{ -273659918, -1038283080}, { -274058075, -1038178056}, { -274456191, -1038072880}, { -274854267, -1037967551}, 
+	{ -272066891, -1038701647}, { -272465208, -1038597234}, { -272863485, -1038492669}, { -273261722, -1038387951}, 
+	{ -270473223, -1039117770}, { -270871700, -1039013969}, { -271270136, -1038910014}, { -271668533, -1038805907}, 
+	{ -268878918, -1039531448}, { -269277554, -1039428258}, { -269676150, -1039324915}, { -270074706, -1039221419}, 
+	{ -267283981, -1039942680}, { -267682775, -1039840101}, { -268081529, -1039737370}, { -268480243, -1039634486}, 
+	{ -265688415, -1040351465}, { -266087366, -1040249498}, { -266486277, -1040147378}, { -266885149, -1040045106}, 
+	{ -264092224, -1040757802}, { -264491331, -1040656447}, { -264890398, -1040554939}, { -265289426, -1040453279}, 
+	{ -262495412, -1041161689}, { -262894673, -1041060947}, { -263293896, -1040960052}, { -263693079, -1040859003}, 
+	{ -260897982, -1041563127}, { -261297397, -1041462997}, { -261696774, -1041362715}, { -262096112, -1041262279}, 
+	{ -259299937, -1041962114}, { -259699506, -1041862597}, { -260099036, -1041762927}, { -260498528, -1041663104}, 
+	{ -257701283, -1042358649}, { -258101004, -1042259745}, { -258500686, -1042160688}, { -258900331, -1042061478}, 
+	{ -256102022, -1042752731}, { -256501894, -1042654441}, { -256901728, -1042555997}, { -257301525, -1042457400}, 
+	{ -254502159, -1043144360}, { -254902181, -1043046683}, { -255302166, -1042948852}, { -255702113, -1042850869}, 
+	{ -252901697, -1043533534}, { -253301868, -1043436471}, { -253702003, -1043339254}, { -254102099, -1043241884}, 
+	{ -251300640, -1043920252}, { -251700959, -1043823803}, { -252101242, -1043727200}, { -252501488, -1043630444}, 
+	{ -249698991, -1044304514}, { -250099458, -1044208679}, { -250499889, -1044112690}, { -250900283, -1044016548}, 
+	{ -248096755, -1044686319}, { -248497369, -1044591098}, { -248897946, -1044495724}, { -249298487, -1044400196}, 
+	{ -246493935, -1045065665}, { -246894694, -1044971059}, { -247295417, -1044876299}, { -247696104, -1044781386}, 
+	{ -244890535, -1045442553}, { -245291439, -1045348561}, { -245692307, -1045254416}, { -246093139, -1045160118}, 
+	{ -243286558, -1045816980}, { -243687606, -1045723604}, { -244088618, -1045630074}, { -244489594, -1045536390}, 
+	{ -241682010, -1046188946}, { -242083200, -1046096185}, { -242484355, -1046003271}, { -242885475, -1045910202}, 
+	{ -240076892, -1046558451}, { -240478225, -1046466305}, { -240879522, -1046374006}, { -241280783, -1046281553}, 
+	{ -238471210, -1046925492}, { -238872683, -1046833963}, { -239274121, -1046742279}, { -239675524, -1046650442}, 
+	{ -236864966, -1047290071}, { -237266579, -1047199157}, { -237668158, -1047108090}, { -238069701, -1047016868}, 
+	{ -235258165, -1047652185}, { -235659918, -1047561887}, { -236061635, -1047471436}, { -236463318, -1047380830}, 
+	{ -233650811, -1048011834}, { -234052701, -1047922153}, { -234454557, -1047832317}, { -234856378, -1047742328}, 
+	{ -232042906, -1048369016}, { -232444934, -1048279952}, { -232846927, -1048190733}, { -233248886, -1048101360}, 
+	{ -230434456, -1048723732}, { -230836620, -1048635284}, { -231238749, -1048546683}, { -231640845, -1048457926}, 
+	{ -228825464, -1049075980}, { -229227762, -1048988149}, { -229630027, -1048900165}, { -230032259, -1048812025}, 
+	{ -227215933, -1049425759}, { -227618366, -1049338546}, { -228020765, -1049251178}, { -228423131, -1049163656}, 
+	{ -225605867, -1049773069}, { -226008433, -1049686474}, { -226410966, -1049599723}, { -226813466, -1049512818}, 
+	{ -223995270, -1050117909}, { -224397969, -1050031931}, { -224800635, -1049945798}, { -225203267, -1049859511}, 
+	{ -222384147, -1050460278}, { -222786977, -1050374918}, { -223189774, -1050289403}, { -223592539, -1050203733}, 
+	{ -220772500, -1050800175}, { -221175461, -1050715433}, { -221578389, -1050630536}, { -221981284, -1050545484}, 
+	{ -219160334, -1051137599}, { -219563424, -1051053475}, { -219966481, -1050969196}, { -220369507, -1050884763}, 
+	{ -217547651, -1051472550}, { -217950870, -1051389044}, { -218354057, -1051305384}, { -218757211, -1051221569}, 
+	{ -215934457, -1051805027}, { -216337804, -1051722140}, { -216741118, -1051639098}, { -217144401, -1051555901}, 
+	{ -214320755, -1052135029}, { -214724228, -1052052760}, { -215127670, -1051970337}, { -215531079, -1051887759}, 
+	{ -212706549, -1052462555}, { -213110148, -1052380905}, { -213513715, -1052299101}, { -213917251, -1052217142}, 
+	{ -211091842, -1052787604}, { -211495565, -1052706574}, { -211899258, -1052625389}, { -212302919, -1052544049}, 
+	{ -209476638, -1053110176}, { -209880485, -1053029765}, { -210284302, -1052949200}, { -210688087, -1052868479}, 
+	{ -207860942, -1053430270}, { -208264912, -1053350479}, { -208668851, -1053270533}, { -209072760, -1053190432}, 
+	{ -206244756, -1053747885}, { -206648848, -1053668714}, { -207052910, -1053589387}, { -207456941, -1053509906}, 
+	{ -204628085, -1054063021}, { -205032298, -1053984469}, { -205436481, -1053905763}, { -205840633, -1053826901}, 
+	{ -203010932, -1054375676}, { -203415265, -1054297745}, { -203819569, -1054219658}, { -204223842, -1054141417}, 
+	{ -201393302, -1054685850}, { -201797754, -1054608539}, { -202202177, -1054531073}, { -202606569, -1054453452}, 
+	{ -199775198, -1054993543}, { -200179768, -1054916852}, { -200584309, -1054840007}, { -200988820, -1054763006}, 
+	{ -198156624, -1055298753}, { -198561311, -1055222683}, { -198965969, -1055146458}, { -199370598, -1055070078}, 
+	{ -196537583, -1055601479}, { -196942387, -1055526030}, { -197347161, -1055450426}, { -197751907, -1055374667}, 
+	{ -194918080, -1055901722}, { -195322999, -1055826894}, { -195727889, -1055751911}, { -196132751, -1055676773}, 
+	{ -193298119, -1056199480}, { -193703152, -1056125274}, { -194108156, -1056050912}, { -194513133, -1055976395}, 
+	{ -191677702, -1056494753}, { -192082849, -1056421168}, { -192487967, -1056347427}, { -192893057, -1056273531}, 
+	{ -190056834, -1056787540}, { -190462093, -1056714576}, { -190867324, -1056641457}, { -191272527, -1056568183}, 
+	{ -188435520, -1057077840}, { -188840890, -1057005498}, { -189246233, -1056933001}, { -189651548, -1056860348}, 
+	{ -186813762, -1057365653}, { -187219242, -1057293933}, { -187624696, -1057222057}, { -188030122, -1057150026}, 
+	{ -185191564, -1057650977}, { -185597154, -1057579879}, { -186002717, -1057508626}, { -186408253, -1057437217}, 
+	{ -183568930, -1057933813}, { -183974629, -1057863337}, { -184380301, -1057792706}, { -184785946, -1057721919}, 
+	{ -181945865, -1058214159}, { -182351671, -1058144306}, { -182757451, -1058074297}, { -183163204, -1058004133}, 
+	{ -180322371, -1058492016}, { -180728284, -1058422785}, { -181134171, -1058353399}, { -181540031, -1058283857}, 
+	{ -178698453, -1058767381}, { -179104472, -1058698773}, { -179510465, -1058630010}, { -179916431, -1058561091}, 
+	{ -177074115, -1059040255}, { -177480239, -1058972270}, { -177886336, -1058904130}, { -178292408, -1058835833}, 
+	{ -175449360, -1059310638}, { -175855587, -1059243276}, { -176261789, -1059175758}, { -176667965, -1059108085}, 
+	{ -173824192, -1059578527}, { -174230522, -1059511788}, { -174636827, -1059444894}, { -175043106, -1059377844}, 
+	{ -172198615, -1059843923}, { -172605047, -1059777808}, { -173011454, -1059711537}, { -173417836, -1059645110}, 
+	{ -170572633, -1060106826}, { -170979166, -1060041334}, { -171385674, -1059975686}, { -171792157, -1059909883}, 
+	{ -168946249, -1060367233}, { -169352882, -1060302365}, { -169759491, -1060237341}, { -170166074, -1060172161}, 
+	{ -167319468, -1060625146}, { -167726200, -1060560902}, { -168132908, -1060496502}, { -168539591, -1060431945}, 
+	{ -165692293, -1060880563}, { -166099124, -1060816943}, { -166505929, -1060753166}, { -166912711, -1060689234}, 
+	{ -164064728, -1061133483}, { -164471656, -1061070487}, { -164878559, -1061007335}, { -165285438, -1060944027}, 
+	{ -162436778, -1061383907}, { -162843801, -1061321535}, { -163250801, -1061259007}, { -163657777, -1061196323}, 
+	{ -160808445, -1061631833}, { -161215564, -1061570086}, { -161622659, -1061508182}, { -162029730, -1061446123}, 
+	{ -159179733, -1061877261}, { -159586946, -1061816138}, { -159994136, -1061754859}, { -160401302, -1061693424}, 
+	{ -157550647, -1062120190}, { -157957954, -1062059692}, { -158365237, -1061999038}, { -158772497, -1061938227}, 
+	{ -155921191, -1062360620}, { -156328589, -1062300747}, { -156735965, -1062240717}, { -157143318, -1062180532}, 
+	{ -154291367, -1062598550}, { -154698857, -1062539302}, { -155106324, -1062479898}, { -155513769, -1062420337}, 
+	{ -152661180, -1062833980}, { -153068761, -1062775357}, { -153476319, -1062716578}, { -153883854, -1062657642}, 
+	{ -151030634, -1063066909}, { -151438304, -1063008911}, { -151845952, -1062950757}, { -152253577, -1062892446}, 
+	{ -149399733, -1063297336}, { -149807492, -1063239964}, { -150215228, -1063182435}, { -150622942, -1063124750}, 
+	{ -147768480, -1063525261}, { -148176326, -1063468514}, { -148584150, -1063411611}, { -148991953, -1063354552}, 
+	{ -146136880, -1063750684}, { -146544812, -1063694563}, { -146952723, -1063638285}, { -147360613, -1063581851}, 
+	{ -144504935, -1063973603}, { -144912954, -1063918108}, { -145320950, -1063862456}, { -145728926, -1063806648}, 
+	{ -142872651, -1064194019}, { -143280754, -1064139150}, { -143688835, -1064084124}, { -144096896, -1064028942}, 
+	{ -141240030, -1064411931}, { -141648217, -1064357688}, { -142056382, -1064303288}, { -142464527, -1064248732}, 
+	{ -139607077, -1064627338}, { -140015347, -1064573721}, { -140423595, -1064519947}, { -140831823, -1064466017}, 
+	{ -137973796, -1064840240}, { -138382147, -1064787249}, { -138790477, -1064734102}, { -139198788, -1064680798}, 
+	{ -136340190, -1065050636}, { -136748621, -1064998272}, { -137157033, -1064945751}, { -137565425, -1064893074}, 
+	{ -134706263, -1065258526}, { -135114774, -1065206789}, { -135523266, -1065154894}, { -135931738, -1065102844}, 
+	{ -133072019, -1065463909}, { -133480609, -1065412799}, { -133889180, -1065361531}, { -134297731, -1065310107}, 
+	{ -131437462, -1065666786}, { -131846130, -1065616302}, { -132254779, -1065565661}, { -132663409, -1065514864}, 
+	{ -129802595, -1065867154}, { -130211341, -1065817297}, { -130620067, -1065767284}, { -131028774, -1065717113}, 
+	{ -128167423, -1066065015}, { -128576245, -1066015785}, { -128985047, -1065966398}, { -129393831, -1065916855}, 
+	{ -126531950, -1066260367}, { -126940846, -1066211764}, { -127349724, -1066163005}, { -127758583, -1066114088}, 
+	{ -124896179, -1066453210}, { -125305149, -1066405234}, { -125714101, -1066357102}, { -126123035, -1066308813}, 
+	{ -123260114, -1066643544}, { -123669157, -1066596195}, { -124078183, -1066548690}, { -124487190, -1066501029}, 
+	{ -121623759, -1066831367}, { -122032875, -1066784647}, { -122441972, -1066737769}, { -122851052, -1066690735}, 
+	{ -119987118, -1067016680}, { -120396304, -1066970587}, { -120805474, -1066924338}, { -121214625, -1066877931}, 
+	{ -118350194, -1067199483}, { -118759451, -1067154018}, { -119168691, -1067108396}, { -119577913, -1067062616}, 
+	{ -116712992, -1067379774}, { -117122318, -1067334937}, { -117531627, -1067289942}, { -117940919, -1067244791}, 
+	{ -115075515, -1067557554}, { -115484910, -1067513344}, { -115894288, -1067468978}, { -116303648, -1067424454}, 
+	{ -113437768, -1067732821}, { -113847230, -1067689240}, { -114256675, -1067645501}, { -114666103, -1067601606}, 
+	{ -111799753, -1067905576}, { -112209281, -1067862623}, { -112618793, -1067819513}, { -113028289, -1067776246}, 
+	{ -110161476, -1068075818}, { -110571069, -1068033493}, { -110980647, -1067991011}, { -111390208, -1067948372}, 
+	{ -108522939, -1068243547}, { -108932597, -1068201851}, { -109342239, -1068159997}, { -109751866, -1068117986}, 
+	{ -106884147, -1068408763}, { -107293868, -1068367694}, { -107703574, -1068326469}, { -108113265, -1068285087}, 
+	{ -105245103, -1068571464}, { -105654887, -1068531024}, { -106064656, -1068490427}, { -106474409, -1068449673}, 
+	{ -103605812, -1068731650}, { -104015658, -1068691839}, { -104425488, -1068651871}, { -104835303, -1068611746}, 
+	{ -101966277, -1068889322}, { -102376183, -1068850140}, { -102786074, -1068810801}, { -103195951, -1068771304}, 
+	{ -100326502, -1069044479}, { -100736468, -1069005925}, { -101146419, -1068967215}, { -101556355, -1068928347}, 
+	{  -98686491, -1069197120}, {  -99096515, -1069159195}, {  -99506525, -1069121114}, {  -99916521, -1069082875}, 
+	{  -97046247, -1069347245}, {  -97456330, -1069309950}, {  -97866398, -1069272497}, {  -98276451, -1069234887}, 
+	{  -95405776, -1069494854}, {  -95815915, -1069458188}, {  -96226040, -1069421364}, {  -96636151, -1069384383}, 
+	{  -93765079, -1069639946}, {  -94175274, -1069603909}, {  -94585455, -1069567715}, {  -94995622, -1069531363}, 
+	{  -92124163, -1069782521}, {  -92534412, -1069747114}, {  -92944648, -1069711548}, {  -93354871, -1069675826}, 
+	{  -90483029, -1069922579}, {  -90893333, -1069887801}, {  -91303623, -1069852865}, {  -91713899, -1069817772}, 
+	{  -88841683, -1070060120}, {  -89252039, -1070025971}, {  -89662382, -1069991664}, {  -90072712, -1069957201}, 
+	{  -87200127, -1070195142}, {  -87610535, -1070161623}, {  -88020931, -1070127946}, {  -88431313, -1070094111}, 
+	{  -85558366, -1070327646}, {  -85968825, -1070294756}, {  -86379272, -1070261709}, {  -86789706, -1070228504}, 
+	{  -83916404, -1070457632}, {  -84326913, -1070425372}, {  -84737410, -1070392954}, {  -85147894, -1070360379}, 
+	{  -82274245, -1070585099}, {  -82684803, -1070553468}, {  -83095349, -1070521680}, {  -83505883, -1070489735}, 
+	{  -80631892, -1070710046}, {  -81042498, -1070679045}, {  -81453092, -1070647887}, {  -81863674, -1070616572}, 
+	{  -78989349, -1070832474}, {  -79400002, -1070802103}, {  -79810644, -1070771575}, {  -80221273, -1070740889}, 
+	{  -77346620, -1070952382}, {  -77757319, -1070922641}, {  -78168007, -1070892743}, {  -78578684, -1070862687}, 
+	{  -75703709, -1071069770}, {  -76114454, -1071040660}, {  -76525187, -1071011391}, {  -76935909, -1070981966}, 
+	{  -74060620, -1071184638}, {  -74471409, -1071156158}, {  -74882187, -1071127519}, {  -75292954, -1071098724}, 
+	{  -72417357, -1071296985}, {  -72828189, -1071269135}, {  -73239010, -1071241127}, {  -73649821, -1071212961}, 
+	{  -70773924, -1071406812}, {  -71184798, -1071379592}, {  -71595661, -1071352214}, {  -72006515, -1071324678}, 
+	{  -69130324, -1071514117}, {  -69541239, -1071487527}, {  -69952144, -1071460780}, {  -70363039, -1071433874}, 
+	{  -67486561, -1071618901}, {  -67897517, -1071592941}, {  -68308462, -1071566824}, {  -68719398, -1071540549}, 
+	{  -65842639, -1071721163}, {  -66253634, -1071695834}, {  -66664620, -1071670347}, {  -67075595, -1071644703}, 
+	{  -64198563, -1071820903}, {  -64609596, -1071796205}, {  -65020620, -1071771349}, {  -65431634, -1071746335}, 
+	{  -62554335, -1071918122}, {  -62965406, -1071894054}, {  -63376468, -1071869828}, {  -63787520, -1071845445}, 
+	{  -60909960, -1072012818}, {  -61321068, -1071989380}, {  -61732166, -1071965785}, {  -62143255, -1071942032}, 
+	{  -59265442, -1072104991}, {  -59676585, -1072082184}, {  -60087719, -1072059220}, {  -60498844, -1072036098}, 
+	{  -57620785, -1072194642}, {  -58031962, -1072172466}, {  -58443131, -1072150132}, {  -58854291, -1072127640}, 
+	{  -55975992, -1072281769}, {  -56387202, -1072260224}, {  -56798405, -1072238521}, {  -57209599, -1072216660}, 
+	{  -54331067, -1072366374}, {  -54742310, -1072345459}, {  -55153545, -1072324387}, {  -55564773, -1072303157}, 
+	{  -52686014, -1072448455}, {  -53097289, -1072428171}, {  -53508556, -1072407730}, {  -53919815, -1072387131}, 
+	{  -51040837, -1072528012}, {  -51452143, -1072508360}, {  -51863441, -1072488549}, {  -52274731, -1072468581}, 
+	{  -49395541, -1072605046}, {  -49806876, -1072586024}, {  -50218204, -1072566845}, {  -50629524, -1072547508}, 
+	{  -47750128, -1072679556}, {  -48161492, -1072661165}, {  -48572848, -1072642617}, {  -48984198, -1072623910}, 
+	{  -46104602, -1072751542}, {  -46515994, -1072733782}, {  -46927379, -1072715864}, {  -47338757, -1072697789}, 
+	{  -44458968, -1072821003}, {  -44870387, -1072803874}, {  -45281799, -1072786588}, {  -45693204, -1072769144}, 
+	{  -42813230, -1072887940}, {  -43224674, -1072871443}, {  -43636112, -1072854787}, {  -44047544, -1072837974}, 
+	{  -41167391, -1072952352}, {  -41578860, -1072936486}, {  -41990323, -1072920462}, {  -42401779, -1072904280}, 
+	{  -39521455, -1073014240}, {  -39932948, -1072999005}, {  -40344435, -1072983612}, {  -40755916, -1072968061}, 
+	{  -37875426, -1073073603}, {  -38286941, -1073058999}, {  -38698452, -1073044237}, {  -39109956, -1073029317}, 
+	{  -36229307, -1073130440}, {  -36640845, -1073116468}, {  -37052377, -1073102337}, {  -37463904, -1073088049}, 
+	{  -34583104, -1073184753}, {  -34994663, -1073171411}, {  -35406216, -1073157912}, {  -35817764, -1073144255}, 
+	{  -32936819, -1073236540}, {  -33348398, -1073223830}, {  -33759971, -1073210962}, {  -34171540, -1073197936}, 
+	{  -31290457, -1073285802}, {  -31702054, -1073273723}, {  -32113647, -1073261486}, {  -32525236, -1073249092}, 
+	{  -29644021, -1073332538}, {  -30055636, -1073321091}, {  -30467248, -1073309485}, {  -30878855, -1073297722}, 
+	{  -27997515, -1073376748}, {  -28409148, -1073365932}, {  -28820776, -1073354959}, {  -29232401, -1073343827}, 
+	{  -26350943, -1073418433}, {  -26762592, -1073408249}, {  -27174237, -1073397906}, {  -27585878, -1073387406}, 
+	{  -24704310, -1073457592}, {  -25115974, -1073448039}, {  -25527634, -1073438328}, {  -25939291, -1073428460}, 
+	{  -23057618, -1073494225}, {  -23469296, -1073485303}, {  -23880971, -1073476224}, {  -24292642, -1073466987}, 
+	{  -21410872, -1073528332}, {  -21822563, -1073520042}, {  -22234252, -1073511594}, {  -22645937, -1073502988}, 
+	{  -19764076, -1073559913}, {  -20175779, -1073552254}, {  -20587480, -1073544438}, {  -20999178, -1073536464}, 
+	{  -18117233, -1073588967}, {  -18528948, -1073581940}, {  -18940660, -1073574756}, {  -19352369, -1073567413}, 
+	{  -16470347, -1073615496}, {  -16882072, -1073609100}, {  -17293795, -1073602547}, {  -17705515, -1073595836}, 
+	{  -14823423, -1073639498}, {  -15235158, -1073633734}, {  -15646890, -1073627812}, {  -16058620, -1073621733}, 
+	{  -13176464, -1073660973}, {  -13588207, -1073655841}, {  -13999948, -1073650551}, {  -14411686, -1073645103}, 
+	{  -11529474, -1073679922}, {  -11941224, -1073675422}, {  -12352972, -1073670764}, {  -12764719, -1073665947}, 
+	{   -9882456, -1073696345}, {  -10294213, -1073692476}, {  -10705968, -1073688450}, {  -11117722, -1073684265}, 
+	{   -8235416, -1073710241}, {   -8647178, -1073707004}, {   -9058939, -1073703609}, {   -9470698, -1073700056}, 
+	{   -6588356, -1073721611}, {   -7000123, -1073719006}, {   -7411888, -1073716242}, {   -7823653, -1073713321}, 
+	{   -4941281, -1073730454}, {   -5353051, -1073728480}, {   -5764820, -1073726348}, {   -6176588, -1073724059}, 
+	{   -3294193, -1073736771}, {   -3705966, -1073735429}, {   -4117738, -1073733928}, {   -4529510, -1073732270}, 
+	{   -1647099, -1073740561}, {   -2058873, -1073739850}, {   -2470647, -1073738982}, {   -2882420, -1073737955}, 
+	{          0, -1073741824}, {    -411775, -1073741745}, {    -823550, -1073741508}, {   -1235324, -1073741113}, 
+	{    1647099, -1073740561}, {    1235324, -1073741113}, {     823550, -1073741508}, {     411775, -1073741745}, 
+	{    3294193, -1073736771}, {    2882420, -1073737955}, {    2470647, -1073738982}, {    2058873, -1073739850}, 
+	{    4941281, -1073730454}, {    4529510, -1073732270}, {    4117738, -1073733928}, {    3705966, -1073735429}, 
+	{    6588356, -1073721611}, {    6176588, -1073724059}, {    5764820, -1073726348}, {    5353051, -1073728480}, 
+	{    8235416, -1073710241}, {    7823653, -1073713321}, {    7411888, -1073716242}, {    7000123, -1073719006}, 
+	{    9882456, -1073696345}, {    9470698, -1073700056}, {    9058939, -1073703609}, {    8647178, -1073707004}, 
+	{   11529474, -1073679922}, {   11117722, -1073684265}, {   10705968, -1073688450}, {   10294213, -1073692476}, 
+	{   13176464, -1073660973}, {   12764719, -1073665947}, {   12352972, -1073670764}, {   11941224, -1073675422}, 
+	{   14823423, -1073639498}, {   14411686, -1073645103}, {   13999948, -1073650551}, {   13588207, -1073655841}, 
+	{   16470347, -1073615496}, {   16058620, -1073621733}, {   15646890, -1073627812}, {   15235158, -1073633734}, 
+	{   18117233, -1073588967}, {   17705515, -1073595836}, {   17293795, -1073602547}, {   16882072, -1073609100}, 
+	{   19764076, -1073559913}, {   19352369, -1073567413}, {   18940660, -1073574756}, {   18528948, -1073581940}, 
+	{   21410872, -1073528332}, {   20999178, -1073536464}, {   20587480, -1073544438}, {   20175779, -1073552254}, 
+	{   23057618, -1073494225}, {   22645937, -1073502988}, {   22234252, -1073511594}, {   21822563, -1073520042}, 
+	{   24704310, -1073457592}, {   24292642, -1073466987}, {   23880971, -1073476224}, {   23469296, -1073485303}, 
+	{   26350943, -1073418433}, {   25939291, -1073428460}, {   25527634, -1073438328}, {   25115974, -1073448039}, 
+	{   27997515, -1073376748}, {   27585878, -1073387406}, {   27174237, -1073397906}, {   26762592, -1073408249}, 
+	{   29644021, -1073332538}, {   29232401, -1073343827}, {   28820776, -1073354959}, {   28409148, -1073365932}, 
+	{   31290457, -1073285802}, {   30878855, -1073297722}, {   30467248, -1073309485}, {   30055636, -1073321091}, 
+	{   32936819, -1073236540}, {   32525236, -1073249092}, {   32113647, -1073261486}, {   31702054, -1073273723}, 
+	{   34583104, -1073184753}, {   34171540, -1073197936}, {   33759971, -1073210962}, {   33348398, -1073223830}, 
+	{   36229307, -1073130440}, {   35817764, -1073144255}, {   35406216, -1073157912}, {   34994663, -1073171411}, 
+	{   37875426, -1073073603}, {   37463904, -1073088049}, {   37052377, -1073102337}, {   36640845, -1073116468}, 
+	{   39521455, -1073014240}, {   39109956, -1073029317}, {   38698452, -1073044237}, {   38286941, -1073058999}, 
+	{   41167391, -1072952352}, {   40755916, -1072968061}, {   40344435, -1072983612}, {   39932948, -1072999005}, 
+	{   42813230, -1072887940}, {   42401779, -1072904280}, {   41990323, -1072920462}, {   41578860, -1072936486}, 
+	{   44458968, -1072821003}, {   44047544, -1072837974}, {   43636112, -1072854787}, {   43224674, -1072871443}, 
+	{   46104602, -1072751542}, {   45693204, -1072769144}, {   45281799, -1072786588}, {   44870387, -1072803874}, 
+	{   47750128, -1072679556}, {   47338757, -1072697789}, {   46927379, -1072715864}, {   46515994, -1072733782}, 
+	{   49395541, -1072605046}, {   48984198, -1072623910}, {   48572848, -1072642617}, {   48161492, -1072661165}, 
+	{   51040837, -1072528012}, {   50629524, -1072547508}, {   50218204, -1072566845}, {   49806876, -1072586024}, 
+	{   52686014, -1072448455}, {   52274731, -1072468581}, {   51863441, -1072488549}, {   51452143, -1072508360}, 
+	{   54331067, -1072366374}, {   53919815, -1072387131}, {   53508556, -1072407730}, {   53097289, -1072428171}, 
+	{   55975992, -1072281769}, {   55564773, -1072303157}, {   55153545, -1072324387}, {   54742310, -1072345459}, 
+	{   57620785, -1072194642}, {   57209599, -1072216660}, {   56798405, -1072238521}, {   56387202, -1072260224}, 
+	{   59265442, -1072104991}, {   58854291, -1072127640}, {   58443131, -1072150132}, {   58031962, -1072172466}, 
+	{   60909960, -1072012818}, {   60498844, -1072036098}, {   60087719, -1072059220}, {   59676585, -1072082184}, 
+	{   62554335, -1071918122}, {   62143255, -1071942032}, {   61732166, -1071965785}, {   61321068, -1071989380}, 
+	{   64198563, -1071820903}, {   63787520, -1071845445}, {   63376468, -1071869828}, {   62965406, -1071894054}, 
+	{   65842639, -1071721163}, {   65431634, -1071746335}, {   65020620, -1071771349}, {   64609596, -1071796205}, 
+	{   67486561, -1071618901}, {   67075595, -1071644703}, {   66664620, -1071670347}, {   66253634, -1071695834}, 
+	{   69130324, -1071514117}, {   68719398, -1071540549}, {   68308462, -1071566824}, {   67897517, -1071592941}, 
+	{   70773924, -1071406812}, {   70363039, -1071433874}, {   69952144, -1071460780}, {   69541239, -1071487527}, 
+	{   72417357, -1071296985}, {   72006515, -1071324678}, {   71595661, -1071352214}, {   71184798, -1071379592}, 
+	{   74060620, -1071184638}, {   73649821, -1071212961}, {   73239010, -1071241127}, {   72828189, -1071269135}, 
+	{   75703709, -1071069770}, {   75292954, -1071098724}, {   74882187, -1071127519}, {   74471409, -1071156158}, 
+	{   77346620, -1070952382}, {   76935909, -1070981966}, {   76525187, -1071011391}, {   76114454, -1071040660}, 
+	{   78989349, -1070832474}, {   78578684, -1070862687}, {   78168007, -1070892743}, {   77757319, -1070922641}, 
+	{   80631892, -1070710046}, {   80221273, -1070740889}, {   79810644, -1070771575}, {   79400002, -1070802103}, 
+	{   82274245, -1070585099}, {   81863674, -1070616572}, {   81453092, -1070647887}, {   81042498, -1070679045}, 
+	{   83916404, -1070457632}, {   83505883, -1070489735}, {   83095349, -1070521680}, {   82684803, -1070553468}, 
+	{   85558366, -1070327646}, {   85147894, -1070360379}, {   84737410, -1070392954}, {   84326913, -1070425372}, 
+	{   87200127, -1070195142}, {   86789706, -1070228504}, {   86379272, -1070261709}, {   85968825, -1070294756}, 
+	{   88841683, -1070060120}, {   88431313, -1070094111}, {   88020931, -1070127946}, {   87610535, -1070161623}, 
+	{   90483029, -1069922579}, {   90072712, -1069957201}, {   89662382, -1069991664}, {   89252039, -1070025971}, 
+	{   92124163, -1069782521}, {   91713899, -1069817772}, {   91303623, -1069852865}, {   90893333, -1069887801}, 
+	{   93765079, -1069639946}, {   93354871, -1069675826}, {   92944648, -1069711548}, {   92534412, -1069747114}, 
+	{   95405776, -1069494854}, {   94995622, -1069531363}, {   94585455, -1069567715}, {   94175274, -1069603909}, 
+	{   97046247, -1069347245}, {   96636151, -1069384383}, {   96226040, -1069421364}, {   95815915, -1069458188}, 
+	{   98686491, -1069197120}, {   98276451, -1069234887}, {   97866398, -1069272497}, {   97456330, -1069309950}, 
+	{  100326502, -1069044479}, {   99916521, -1069082875}, {   99506525, -1069121114}, {   99096515, -1069159195}, 
+	{  101966277, -1068889322}, {  101556355, -1068928347}, {  101146419, -1068967215}, {  100736468, -1069005925}, 
+	{  103605812, -1068731650}, {  103195951, -1068771304}, {  102786074, -1068810801}, {  102376183, -1068850140}, 
+	{  105245103, -1068571464}, {  104835303, -1068611746}, {  104425488, -1068651871}, {  104015658, -1068691839}, 
+	{  106884147, -1068408763}, {  106474409, -1068449673}, {  106064656, -1068490427}, {  105654887, -1068531024}, 
+	{  108522939, -1068243547}, {  108113265, -1068285087}, {  107703574, -1068326469}, {  107293868, -1068367694}, 
+	{  110161476, -1068075818}, {  109751866, -1068117986}, {  109342239, -1068159997}, {  108932597, -1068201851}, 
+	{  111799753, -1067905576}, {  111390208, -1067948372}, {  110980647, -1067991011}, {  110571069, -1068033493}, 
+	{  113437768, -1067732821}, {  113028289, -1067776246}, {  112618793, -1067819513}, {  112209281, -1067862623}, 
+	{  115075515, -1067557554}, {  114666103, -1067601606}, {  114256675, -1067645501}, {  113847230, -1067689240}, 
+	{  116712992, -1067379774}, {  116303648, -1067424454}, {  115894288, -1067468978}, {  115484910, -1067513344}, 
+	{  118350194, -1067199483}, {  117940919, -1067244791}, {  117531627, -1067289942}, {  117122318, -1067334937}, 
+	{  119987118, -1067016680}, {  119577913, -1067062616}, {  119168691, -1067108396}, {  118759451, -1067154018}, 
+	{  121623759, -1066831367}, {  121214625, -1066877931}, {  120805474, -1066924338}, {  120396304, -1066970587}, 
+	{  123260114, -1066643544}, {  122851052, -1066690735}, {  122441972, -1066737769}, {  122032875, -1066784647}, 
+	{  124896179, -1066453210}, {  124487190, -1066501029}, {  124078183, -1066548690}, {  123669157, -1066596195}, 
+	{  126531950, -1066260367}, {  126123035, -1066308813}, {  125714101, -1066357102}, {  125305149, -1066405234}, 
+	{  128167423, -1066065015}, {  127758583, -1066114088}, {  127349724, -1066163005}, {  126940846, -1066211764}, 
+	{  129802595, -1065867154}, {  129393831, -1065916855}, {  128985047, -1065966398}, {  128576245, -1066015785}, 
+	{  131437462, -1065666786}, {  131028774, -1065717113}, {  130620067, -1065767284}, {  130211341, -1065817297}, 
+	{  133072019, -1065463909}, {  132663409, -1065514864}, {  132254779, -1065565661}, {  131846130, -1065616302}, 
+	{  134706263, -1065258526}, {  134297731, -1065310107}, {  133889180, -1065361531}, {  133480609, -1065412799}, 
+	{  136340190, -1065050636}, {  135931738, -1065102844}, {  135523266, -1065154894}, {  135114774, -1065206789}, 
+	{  137973796, -1064840240}, {  137565425, -1064893074}, {  137157033, -1064945751}, {  136748621, -1064998272}, 
+	{  139607077, -1064627338}, {  139198788, -1064680798}, {  138790477, -1064734102}, {  138382147, -1064787249}, 
+	{  141240030, -1064411931}, {  140831823, -1064466017}, {  140423595, -1064519947}, {  140015347, -1064573721}, 
+	{  142872651, -1064194019}, {  142464527, -1064248732}, {  142056382, -1064303288}, {  141648217, -1064357688}, 
+	{  144504935, -1063973603}, {  144096896, -1064028942}, {  143688835, -1064084124}, {  143280754, -1064139150}, 
+	{  146136880, -1063750684}, {  145728926, -1063806648}, {  145320950, -1063862456}, {  144912954, -1063918108}, 
+	{  147768480, -1063525261}, {  147360613, -1063581851}, {  146952723, -1063638285}, {  146544812, -1063694563}, 
+	{  149399733, -1063297336}, {  148991953, -1063354552}, {  148584150, -1063411611}, {  148176326, -1063468514}, 
+	{  151030634, -1063066909}, {  150622942, -1063124750}, {  150215228, -1063182435}, {  149807492, -1063239964}, 
+	{  152661180, -1062833980}, {  152253577, -1062892446}, {  151845952, -1062950757}, {  151438304, -1063008911}, 
+	{  154291367, -1062598550}, {  153883854, -1062657642}, {  153476319, -1062716578}, {  153068761, -1062775357}, 
+	{  155921191, -1062360620}, {  155513769, -1062420337}, {  155106324, -1062479898}, {  154698857, -1062539302}, 
+	{  157550647, -1062120190}, {  157143318, -1062180532}, {  156735965, -1062240717}, {  156328589, -1062300747}, 
+	{  159179733, -1061877261}, {  158772497, -1061938227}, {  158365237, -1061999038}, {  157957954, -1062059692}, 
+	{  160808445, -1061631833}, {  160401302, -1061693424}, {  159994136, -1061754859}, {  159586946, -1061816138}, 
+	{  162436778, -1061383907}, {  162029730, -1061446123}, {  161622659, -1061508182}, {  161215564, -1061570086}, 
+	{  164064728, -1061133483}, {  163657777, -1061196323}, {  163250801, -1061259007}, {  162843801, -1061321535}, 
+	{  165692293, -1060880563}, {  165285438, -1060944027}, {  164878559, -1061007335}, {  164471656, -1061070487}, 
+	{  167319468, -1060625146}, {  166912711, -1060689234}, {  166505929, -1060753166}, {  166099124, -1060816943}, 
+	{  168946249, -1060367233}, {  168539591, -1060431945}, {  168132908, -1060496502}, {  167726200, -1060560902}, 
+	{  170572633, -1060106826}, {  170166074, -1060172161}, {  169759491, -1060237341}, {  169352882, -1060302365}, 
+	{  172198615, -1059843923}, {  171792157, -1059909883}, {  171385674, -1059975686}, {  170979166, -1060041334}, 
+	{  173824192, -1059578527}, {  173417836, -1059645110}, {  173011454, -1059711537}, {  172605047, -1059777808}, 
+	{  175449360, -1059310638}, {  175043106, -1059377844}, {  174636827, -1059444894}, {  174230522, -1059511788}, 
+	{  177074115, -1059040255}, {  176667965, -1059108085}, {  176261789, -1059175758}, {  175855587, -1059243276}, 
+	{  178698453, -1058767381}, {  178292408, -1058835833}, {  177886336, -1058904130}, {  177480239, -1058972270}, 
+	{  180322371, -1058492016}, {  179916431, -1058561091}, {  179510465, -1058630010}, {  179104472, -1058698773}, 
+	{  181945865, -1058214159}, {  181540031, -1058283857}, {  181134171, -1058353399}, {  180728284, -1058422785}, 
+	{  183568930, -1057933813}, {  183163204, -1058004133}, {  182757451, -1058074297}, {  182351671, -1058144306}, 
+	{  185191564, -1057650977}, {  184785946, -1057721919}, {  184380301, -1057792706}, {  183974629, -1057863337}, 
+	{  186813762, -1057365653}, {  186408253, -1057437217}, {  186002717, -1057508626}, {  185597154, -1057579879}, 
+	{  188435520, -1057077840}, {  188030122, -1057150026}, {  187624696, -1057222057}, {  187219242, -1057293933}, 
+	{  190056834, -1056787540}, {  189651548, -1056860348}, {  189246233, -1056933001}, {  188840890, -1057005498}, 
+	{  191677702, -1056494753}, {  191272527, -1056568183}, {  190867324, -1056641457}, {  190462093, -1056714576}, 
+	{  193298119, -1056199480}, {  192893057, -1056273531}, {  192487967, -1056347427}, {  192082849, -1056421168}, 
+	{  194918080, -1055901722}, {  194513133, -1055976395}, {  194108156, -1056050912}, {  193703152, -1056125274}, 
+	{  196537583, -1055601479}, {  196132751, -1055676773}, {  195727889, -1055751911}, {  195322999, -1055826894}, 
+	{  198156624, -1055298753}, {  197751907, -1055374667}, {  197347161, -1055450426}, {  196942387, -1055526030}, 
+	{  199775198, -1054993543}, {  199370598, -1055070078}, {  198965969, -1055146458}, {  198561311, -1055222683}, 
+	{  201393302, -1054685850}, {  200988820, -1054763006}, {  200584309, -1054840007}, {  200179768, -1054916852}, 
+	{  203010932, -1054375676}, {  202606569, -1054453452}, {  202202177, -1054531073}, {  201797754, -1054608539}, 
+	{  204628085, -1054063021}, {  204223842, -1054141417}, {  203819569, -1054219658}, {  203415265, -1054297745}, 
+	{  206244756, -1053747885}, {  205840633, -1053826901}, {  205436481, -1053905763}, {  205032298, -1053984469}, 
+	{  207860942, -1053430270}, {  207456941, -1053509906}, {  207052910, -1053589387}, {  206648848, -1053668714}, 
+	{  209476638, -1053110176}, {  209072760, -1053190432}, {  208668851, -1053270533}, {  208264912, -1053350479}, 
+	{  211091842, -1052787604}, {  210688087, -1052868479}, {  210284302, -1052949200}, {  209880485, -1053029765}, 
+	{  212706549, -1052462555}, {  212302919, -1052544049}, {  211899258, -1052625389}, {  211495565, -1052706574}, 
+	{  214320755, -1052135029}, {  213917251, -1052217142}, {  213513715, -1052299101}, {  213110148, -1052380905}, 
+	{  215934457, -1051805027}, {  215531079, -1051887759}, {  215127670, -1051970337}, {  214724228, -1052052760}, 
+	{  217547651, -1051472550}, {  217144401, -1051555901}, {  216741118, -1051639098}, {  216337804, -1051722140}, 
+	{  219160334, -1051137599}, {  218757211, -1051221569}, {  218354057, -1051305384}, {  217950870, -1051389044}, 
+	{  220772500, -1050800175}, {  220369507, -1050884763}, {  219966481, -1050969196}, {  219563424, -1051053475}, 
+	{  222384147, -1050460278}, {  221981284, -1050545484}, {  221578389, -1050630536}, {  221175461, -1050715433}, 
+	{  223995270, -1050117909}, {  223592539, -1050203733}, {  223189774, -1050289403}, {  222786977, -1050374918}, 
+	{  225605867, -1049773069}, {  225203267, -1049859511}, {  224800635, -1049945798}, {  224397969, -1050031931}, 
+	{  227215933, -1049425759}, {  226813466, -1049512818}, {  226410966, -1049599723}, {  226008433, -1049686474}, 
+	{  228825464, -1049075980}, {  228423131, -1049163656}, {  228020765, -1049251178}, {  227618366, -1049338546}, 
+	{  230434456, -1048723732}, {  230032259, -1048812025}, {  229630027, -1048900165}, {  229227762, -1048988149}, 
+	{  232042906, -1048369016}, {  231640845, -1048457926}, {  231238749, -1048546683}, {  230836620, -1048635284}, 
+	{  233650811, -1048011834}, {  233248886, -1048101360}, {  232846927, -1048190733}, {  232444934, -1048279952}, 
+	{  235258165, -1047652185}, {  234856378, -1047742328}, {  234454557, -1047832317}, {  234052701, -1047922153}, 
+	{  236864966, -1047290071}, {  236463318, -1047380830}, {  236061635, -1047471436}, {  235659918, -1047561887}, 
+	{  238471210, -1046925492}, {  238069701, -1047016868}, {  237668158, -1047108090}, {  237266579, -1047199157}, 
+	{  240076892, -1046558451}, {  239675524, -1046650442}, {  239274121, -1046742279}, {  238872683, -1046833963}, 
+	{  241682010, -1046188946}, {  241280783, -1046281553}, {  240879522, -1046374006}, {  240478225, -1046466305}, 
+	{  243286558, -1045816980}, {  242885475, -1045910202}, {  242484355, -1046003271}, {  242083200, -1046096185}, 
+	{  244890535, -1045442553}, {  244489594, -1045536390}, {  244088618, -1045630074}, {  243687606, -1045723604}, 
+	{  246493935, -1045065665}, {  246093139, -1045160118}, {  245692307, -1045254416}, {  245291439, -1045348561}, 
+	{  248096755, -1044686319}, {  247696104, -1044781386}, {  247295417, -1044876299}, {  246894694, -1044971059}, 
+	{  249698991, -1044304514}, {  249298487, -1044400196}, {  248897946, -1044495724}, {  248497369, -1044591098}, 
+	{  251300640, -1043920252}, {  250900283, -1044016548}, {  250499889, -1044112690}, {  250099458, -1044208679}, 
+	{  252901697, -1043533534}, {  252501488, -1043630444}, {  252101242, -1043727200}, {  251700959, -1043823803}, 
+	{  254502159, -1043144360}, {  254102099, -1043241884}, {  253702003, -1043339254}, {  253301868, -1043436471}, 
+	{  256102022, -1042752731}, {  255702113, -1042850869}, {  255302166, -1042948852}, {  254902181, -1043046683}, 
+	{  257701283, -1042358649}, {  257301525, -1042457400}, {  256901728, -1042555997}, {  256501894, -1042654441}, 
+	{  259299937, -1041962114}, {  258900331, -1042061478}, {  258500686, -1042160688}, {  258101004, -1042259745}, 
+	{  260897982, -1041563127}, {  260498528, -1041663104}, {  260099036, -1041762927}, {  259699506, -1041862597}, 
+	{  262495412, -1041161689}, {  262096112, -1041262279}, {  261696774, -1041362715}, {  261297397, -1041462997}, 
+	{  264092224, -1040757802}, {  263693079, -1040859003}, {  263293896, -1040960052}, {  262894673, -1041060947}, 
+	{  265688415, -1040351465}, {  265289426, -1040453279}, {  264890398, -1040554939}, {  264491331, -1040656447}, 
+	{  267283981, -1039942680}, {  266885149, -1040045106}, {  266486277, -1040147378}, {  266087366, -1040249498}, 
+	{  268878918, -1039531448}, {  268480243, -1039634486}, {  268081529, -1039737370}, {  267682775, -1039840101}, 
+	{  270473223, -1039117770}, {  270074706, -1039221419}, {  269676150, -1039324915}, {  269277554, -1039428258}, 
+	{  272066891, -1038701647}, {  271668533, -1038805907}, {  271270136, -1038910014}, {  270871700, -1039013969}, 
+	{  273659918, -1038283080}, {  273261722, -1038387951}, {  272863485, -1038492669}, {  272465208, -1038597234}, 
+	{  275252302, -1037862069}, {  274854267, -1037967551}, {  274456191, -1038072880}, {  274058075, -1038178056}, 
+	{  276844038, -1037438617}, {  276446165, -1037544709}, {  276048251, -1037650648}, {  275650297, -1037756435}, 
+	{  278435122, -1037012723}, {  278037413, -1037119425}, {  277639662, -1037225975}, {  277241870, -1037332372}, 
+	{  280025552, -1036584389}, {  279628006, -1036691701}, {  279230419, -1036798861}, {  278832791, -1036905868}, 
+	{  281615322, -1036153615}, {  281217942, -1036261537}, {  280820520, -1036369307}, {  280423056, -1036476924}, 
+	{  283204430, -1035720404}, {  282807215, -1035828935}, {  282409959, -1035937314}, {  282012662, -1036045541}, 
+	{  284792871, -1035284755}, {  284395824, -1035393896}, {  283998734, -1035502884}, {  283601603, -1035611720}, 
+	{  286380643, -1034846671}, {  285983763, -1034956420}, {  285586841, -1035066018}, {  285189877, -1035175463}, 
+	{  287967740, -1034406151}, {  287571029, -1034516509}, {  287174276, -1034626715}, {  286777480, -1034736769}, 
+	{  289554160, -1033963197}, {  289157619, -1034074164}, {  288761035, -1034184978}, {  288364409, -1034295641}, 
+	{  291139898, -1033517810}, {  290743528, -1033629385}, {  290347114, -1033740808}, {  289950658, -1033852079}, 
+	{  292724951, -1033069992}, {  292328753, -1033182174}, {  291932511, -1033294205}, {  291536226, -1033406084}, 
+	{  294309316, -1032619742}, {  293913290, -1032732532}, {  293517220, -1032845170}, {  293121107, -1032957657}, 
+	{  295892988, -1032167062}, {  295497135, -1032280460}, {  295101239, -1032393706}, {  294705299, -1032506800}, 
+	{  297475964, -1031711954}, {  297080285, -1031825959}, {  296684563, -1031939812}, {  296288797, -1032053513}, 
+	{  299058239, -1031254418}, {  298662736, -1031369029}, {  298267189, -1031483489}, {  297871598, -1031597797}, 
+	{  300639811, -1030794455}, {  300244484, -1030909673}, {  299849113, -1031024740}, {  299453698, -1031139655}, 
+	{  302220676, -1030332067}, {  301825526, -1030447891}, {  301430332, -1030563564}, {  301035094, -1030679085}, 
+	{  303800829, -1029867254}, {  303405858, -1029983684}, {  303010842, -1030099963}, {  302615781, -1030216091}, 
+	{  305380268, -1029400018}, {  304985475, -1029517054}, {  304590638, -1029633939}, {  304195756, -1029750672}, 
+	{  306958988, -1028930359}, {  306564375, -1029048001}, {  306169718, -1029165491}, {  305775015, -1029282830}, 
+	{  308536985, -1028458280}, {  308142554, -1028576527}, {  307748077, -1028694622}, {  307353555, -1028812566}, 
+	{  310114257, -1027983780}, {  309720007, -1028102632}, {  309325712, -1028221332}, {  308931371, -1028339882}, 
+	{  311690799, -1027506862}, {  311296732, -1027626318}, {  310902619, -1027745623}, {  310508461, -1027864777}, 
+	{  313266607, -1027027525}, {  312872724, -1027147586}, {  312478795, -1027267495}, {  312084820, -1027387254}, 
+	{  314841679, -1026545772}, {  314447980, -1026666437}, {  314054235, -1026786951}, {  313660444, -1026907313}, 
+	{  316416009, -1026061603}, {  316022496, -1026182872}, {  315628937, -1026303990}, {  315235331, -1026424956}, 
+	{  317989595, -1025575020}, {  317596268, -1025696892}, {  317202895, -1025818614}, {  316809475, -1025940184}, 
+	{  319562433, -1025086024}, {  319169293, -1025208499}, {  318776108, -1025330824}, {  318382875, -1025452997}, 
+	{  321134518, -1024594615}, {  320741568, -1024717694}, {  320348570, -1024840621}, {  319955525, -1024963398}, 
+	{  322705848, -1024100796}, {  322313087, -1024224477}, {  321920278, -1024348007}, {  321527422, -1024471386}, 
+	{  324276419, -1023604567}, {  323883848, -1023728850}, {  323491229, -1023852982}, {  323098562, -1023976964}, 
+	{  325846226, -1023105929}, {  325453846, -1023230814}, {  325061418, -1023355549}, {  324668942, -1023480133}, 
+	{  327415267, -1022604883}, {  327023079, -1022730370}, {  326630843, -1022855707}, {  326238559, -1022980893}, 
+	{  328983538, -1022101432}, {  328591543, -1022227520}, {  328199499, -1022353458}, {  327807407, -1022479246}, 
+	{  330551034, -1021595575}, {  330159233, -1021722264}, {  329767383, -1021848804}, {  329375485, -1021975193}, 
+	{  332117752, -1021087314}, {  331726146, -1021214605}, {  331334491, -1021341745}, {  330942787, -1021468735}, 
+	{  333683689, -1020576651}, {  333292279, -1020704542}, {  332900819, -1020832283}, {  332509310, -1020959873}, 
+	{  335248841, -1020063586}, {  334857627, -1020192077}, {  334466364, -1020320418}, {  334075051, -1020448610}, 
+	{  336813204, -1019548121}, {  336422188, -1019677212}, {  336031121, -1019806153}, {  335640006, -1019934944}, 
+	{  338376774, -1019030256}, {  337985956, -1019159947}, {  337595089, -1019289488}, {  337204171, -1019418879}, 
+	{  339939549, -1018509994}, {  339548930, -1018640284}, {  339158261, -1018770425}, {  338767543, -1018900415}, 
+	{  341501523, -1017987335}, {  341111104, -1018118225}, {  340720636, -1018248964}, {  340330117, -1018379554}, 
+	{  343062693, -1017462281}, {  342672476, -1017593769}, {  342282209, -1017725107}, {  341891891, -1017856296}, 
+	{  344623057, -1016934832}, {  344233042, -1017066919}, {  343842976, -1017198856}, {  343452860, -1017330643}, 
+	{  346182609, -1016404991}, {  345792797, -1016537676}, {  345402934, -1016670211}, {  345013021, -1016802596}, 
+	{  347741347, -1015872758}, {  347351739, -1016006040}, {  346962080, -1016139173}, {  346572370, -1016272157}, 
+	{  349299266, -1015338134}, {  348909863, -1015472014}, {  348520409, -1015605745}, {  348130904, -1015739326}, 
+	{  350856364, -1014801122}, {  350467167, -1014935599}, {  350077918, -1015069927}, {  349688618, -1015204105}, 
+	{  352412636, -1014261721}, {  352023646, -1014396795}, {  351634604, -1014531720}, {  351245510, -1014666495}, 
+	{  353968079, -1013719934}, {  353579296, -1013855604}, {  353190461, -1013991126}, {  352801575, -1014126498}, 
+	{  355522689, -1013175761}, {  355134115, -1013312028}, {  354745488, -1013448145}, {  354356810, -1013584114}, 
+	{  357076462, -1012629204}, {  356688097, -1012766067}, {  356299680, -1012902780}, {  355911211, -1013039345}, 
+	{  358629395, -1012080264}, {  358241241, -1012217723}, {  357853034, -1012355032}, {  357464774, -1012492193}, 
+	{  360181484, -1011528943}, {  359793541, -1011666997}, {  359405545, -1011804901}, {  359017496, -1011942657}, 
+	{  361732726, -1010975242}, {  361344995, -1011113890}, {  360957211, -1011252390}, {  360569374, -1011390741}, 
+	{  363283116, -1010419162}, {  362895598, -1010558405}, {  362508027, -1010697499}, {  362120403, -1010836445}, 
+	{  364832652, -1009860704}, {  364445348, -1010000541}, {  364057991, -1010140230}, {  363670580, -1010279770}, 
+	{  366381329, -1009299870}, {  365994240, -1009440301}, {  365607098, -1009580584}, {  365219902, -1009720718}, 
+	{  367929144, -1008736660}, {  367542271, -1008877685}, {  367155344, -1009018562}, {  366768363, -1009159290}, 
+	{  369476093, -1008171077}, {  369089437, -1008312696}, {  368702727, -1008454166}, {  368315962, -1008595487}, 
+	{  371022173, -1007603122}, {  370635734, -1007745333}, {  370249242, -1007887396}, {  369862694, -1008029311}, 
+	{  372567379, -1007032796}, {  372181160, -1007175600}, {  371794885, -1007318256}, {  371408556, -1007460763}, 
+	{  374111709, -1006460100}, {  373725709, -1006603496}, {  373339654, -1006746744}, {  372953544, -1006889844}, 
+	{  375655159, -1005885036}, {  375269379, -1006029024}, {  374883544, -1006172864}, {  374497654, -1006316556}, 
+	{  377197725, -1005307605}, {  376812166, -1005452185}, {  376426553, -1005596617}, {  376040883, -1005740900}, 
+	{  378739403, -1004727809}, {  378354067, -1004872979}, {  377968675, -1005018003}, {  377583228, -1005162878}, 
+	{  380280190, -1004145648}, {  379895077, -1004291410}, {  379509908, -1004437024}, {  379124683, -1004582490}, 
+	{  381820082, -1003561124}, {  381435193, -1003707476}, {  381050248, -1003853681}, {  380665247, -1003999738}, 
+	{  383359076, -1002974239}, {  382974412, -1003121181}, {  382589691, -1003267977}, {  382204915, -1003414624}, 
+	{  384897167, -1002384994}, {  384512729, -1002532526}, {  384128234, -1002679911}, {  383743683, -1002827149}, 
+	{  386434353, -1001793390}, {  386050142, -1001941512}, {  385665873, -1002089486}, {  385281549, -1002237314}, 
+	{  387970630, -1001199428}, {  387586646, -1001348140}, {  387202605, -1001496704}, {  386818508, -1001645120}, 
+	{  389505993, -1000603111}, {  389122238, -1000752411}, {  388738426, -1000901564}, {  388354556, -1001050570}, 
+	{  391040440, -1000004439}, {  390656915, -1000154328}, {  390273331, -1000304069}, {  389889691, -1000453664}, 
+	{  392573967,  -999403415}, {  392190672,  -999553891}, {  391807319,  -999704221}, {  391423908,  -999854404}, 
+	{  394106570,  -998800038}, {  393723506,  -998951103}, {  393340384,  -999102020}, {  392957205,  -999252791}, 
+	{  395638246,  -998194311}, {  395255414,  -998345963}, {  394872524,  -998497468}, {  394489576,  -998648827}, 
+	{  397168991,  -997586236}, {  396786392,  -997738475}, {  396403735,  -997890567}, {  396021020,  -998042512}, 
+	{  398698801,  -996975812}, {  398316436,  -997128638}, {  397934013,  -997281317}, {  397551531,  -997433850}, 
+	{  400227673,  -996363043}, {  399845543,  -996516456}, {  399463355,  -996669721}, {  399081107,  -996822840}, 
+	{  401755603,  -995747930}, {  401373709,  -995901928}, {  400991756,  -996055780}, {  400609744,  -996209485}, 
+	{  403282588,  -995130473}, {  402900931,  -995285057}, {  402519214,  -995439494}, {  402137438,  -995593785}, 
+	{  404808624,  -994510675}, {  404427204,  -994665844}, {  404045725,  -994820867}, {  403664186,  -994975743}, 
+	{  406333708,  -993888536}, {  405952526,  -994044290}, {  405571285,  -994199898}, {  405189985,  -994355360}, 
+	{  407857835,  -993264059}, {  407476893,  -993420398}, {  407095891,  -993576590}, {  406714829,  -993732636}, 
+	{  409381002,  -992637245}, {  409000301,  -992794167}, {  408619539,  -992950944}, {  408238717,  -993107575}, 
+	{  410903207,  -992008094}, {  410522746,  -992165601}, {  410142225,  -992322961}, {  409761644,  -992480176}, 
+	{  412424444,  -991376610}, {  412044226,  -991534700}, {  411663946,  -991692644}, {  411283607,  -991850442}, 
+	{  413944711,  -990742793}, {  413564735,  -990901465}, {  413184699,  -991059993}, {  412804602,  -991218374}, 
+	{  415464004,  -990106644}, {  415084272,  -990265900}, {  414704479,  -990425010}, {  414324625,  -990583974}, 
+	{  416982319,  -989468165}, {  416602832,  -989628003}, {  416223284,  -989787696}, {  415843674,  -989947243}, 
+	{  418499653,  -988827359}, {  418120411,  -988987779}, {  417741109,  -989148053}, {  417361744,  -989308182}, 
+	{  420016002,  -988184225}, {  419637007,  -988345227}, {  419257951,  -988506083}, {  418878833,  -988666793}, 
+	{  421531363,  -987538766}, {  421152615,  -987700349}, {  420773806,  -987861786}, {  420394935,  -988023078}, 
+	{  423045732,  -986890984}, {  422667233,  -987053147}, {  422288671,  -987215165}, {  421910048,  -987377038}, 
+	{  424559105,  -986240879}, {  424180855,  -986403623}, {  423802543,  -986566221}, {  423424169,  -986728675}, 
+	{  426071480,  -985588453}, {  425693480,  -985751777}, {  425315418,  -985914956}, {  424937293,  -986077990}, 
+	{  427582852,  -984933708}, {  427205103,  -985097612}, {  426827291,  -985261370}, {  426449417,  -985424984}, 
+	{  429093217,  -984276646}, {  428715720,  -984441129}, {  428338160,  -984605467}, {  427960537,  -984769660}, 
+	{  430602573,  -983617267}, {  430225329,  -983782329}, {  429848022,  -983947246}, {  429470651,  -984112018}, 
+	{  432110916,  -982955574}, {  431733926,  -983121214}, {  431356872,  -983286710}, {  430979754,  -983452061}, 
+	{  433618242,  -982291568}, {  433241506,  -982457786}, {  432864706,  -982623860}, {  432487843,  -982789789}, 
+	{  435124548,  -981625251}, {  434748067,  -981792047}, {  434371523,  -981958698}, {  433994914,  -982125205}, 
+	{  436629829,  -980956623}, {  436253605,  -981123997}, {  435877317,  -981291226}, {  435500964,  -981458310}, 
+	{  438134084,  -980285688}, {  437758117,  -980453638}, {  437382085,  -980621444}, {  437005989,  -980789106}, 
+	{  439637307,  -979612445}, {  439261598,  -979780972}, {  438885824,  -979949355}, {  438509986,  -980117593}, 
+	{  441139496,  -978936898}, {  440764046,  -979106001}, {  440388531,  -979274960}, {  440012951,  -979443774}, 
+	{  442640647,  -978259047}, {  442265456,  -978428725}, {  441890201,  -978598260}, {  441514881,  -978767651}, 
+	{  444140756,  -977578894}, {  443765826,  -977749148}, {  443390832,  -977919258}, {  443015772,  -978089224}, 
+	{  445639820,  -976896441}, {  445265152,  -977067269}, {  444890419,  -977237955}, {  444515620,  -977408496}, 
+	{  447137835,  -976211688}, {  446763430,  -976383092}, {  446388959,  -976554352}, {  446014422,  -976725468}, 
+	{  448634799,  -975524639}, {  448260657,  -975696617}, {  447886449,  -975868451}, {  447512175,  -976040141}, 
+	{  450130706,  -974835295}, {  449756829,  -975007846}, {  449382885,  -975180254}, {  449008875,  -975352518}, 
+	{  451625555,  -974143656}, {  451251942,  -974316781}, {  450878263,  -974489762}, {  450504518,  -974662600}, 
+	{  453119340,  -973449725}, {  452745994,  -973623423}, {  452372581,  -973796977}, {  451999101,  -973970388}, 
+	{  454612060,  -972753504}, {  454238980,  -972927774}, {  453865834,  -973101901}, {  453492620,  -973275885}, 
+	{  456103710,  -972054994}, {  455730898,  -972229836}, {  455358019,  -972404535}, {  454985073,  -972579091}, 
+	{  457594286,  -971354196}, {  457221743,  -971529610}, {  456849132,  -971704881}, {  456476455,  -971880009}, 
+	{  459083786,  -970651112}, {  458711512,  -970827098}, {  458339171,  -971002940}, {  457966762,  -971178639}, 
+	{  460572205,  -969945745}, {  460200202,  -970122301}, {  459828131,  -970298714}, {  459455992,  -970474985}, 
+	{  462059541,  -969238095}, {  461687809,  -969415222}, {  461316009,  -969592205}, {  460944141,  -969769046}, 
+	{  463545789,  -968528165}, {  463174329,  -968705861}, {  462802801,  -968883415}, {  462431205,  -969060826}, 
+	{  465030947,  -967815955}, {  464659760,  -967994221}, {  464288505,  -968172345}, {  463917181,  -968350326}, 
+	{  466515010,  -967101468}, {  466144097,  -967280303}, {  465773116,  -967458996}, {  465402066,  -967637547}, 
+	{  467997976,  -966384706}, {  467627338,  -966564109}, {  467256631,  -966743371}, {  466885855,  -966922491}, 
+	{  469479840,  -965665669}, {  469109478,  -965845641}, {  468739046,  -966025471}, {  468368545,  -966205159}, 
+	{  470960600,  -964944360}, {  470590514,  -965124900}, {  470220358,  -965305298}, {  469850134,  -965485555}, 
+	{  472440251,  -964220780}, {  472070443,  -964401888}, {  471700564,  -964582854}, {  471330617,  -964763678}, 
+	{  473918791,  -963494932}, {  473549261,  -963676607}, {  473179660,  -963858140}, {  472809991,  -964039531}, 
+	{  475396216,  -962766816}, {  475026964,  -962949058}, {  474657643,  -963131157}, {  474288252,  -963313116}, 
+	{  476872522,  -962036435}, {  476503550,  -962219243}, {  476134509,  -962401909}, {  475765397,  -962584433}, 
+	{  478347705,  -961303790}, {  477979015,  -961487164}, {  477610254,  -961670396}, {  477241423,  -961853486}, 
+	{  479821764,  -960568883}, {  479453355,  -960752822}, {  479084875,  -960936620}, {  478716326,  -961120276}, 
+	{  481294693,  -959831716}, {  480926566,  -960016220}, {  480558369,  -960200582}, {  480190102,  -960384803}, 
+	{  482766489,  -959092290}, {  482398646,  -959277359}, {  482030733,  -959462286}, {  481662748,  -959647071}, 
+	{  484237150,  -958350608}, {  483869591,  -958536240}, {  483501962,  -958721731}, {  483134261,  -958907081}, 
+	{  485706671,  -957606670}, {  485339398,  -957792866}, {  484972053,  -957978921}, {  484604637,  -958164835}, 
+	{  487175049,  -956860479}, {  486808062,  -957047238}, {  486441003,  -957233856}, {  486073873,  -957420333}, 
+	{  488642281,  -956112036}, {  488275581,  -956299358}, {  487908809,  -956486539}, {  487541965,  -956673579}, 
+	{  490108363,  -955361344}, {  489741950,  -955549228}, {  489375466,  -955736971}, {  489008909,  -955924574}, 
+	{  491573292,  -954608403}, {  491207168,  -954796849}, {  490840972,  -954985154}, {  490474703,  -955173319}, 
+	{  493037064,  -953853216}, {  492671229,  -954042224}, {  492305322,  -954231090}, {  491939343,  -954419817}, 
+	{  494499676,  -953095785}, {  494134132,  -953285353}, {  493768515,  -953474781}, {  493402826,  -953664069}, 
+	{  495961124,  -952336111}, {  495595871,  -952526240}, {  495230545,  -952716228}, {  494865147,  -952906077}, 
+	{  497421405,  -951574196}, {  497056444,  -951764885}, {  496691410,  -951955434}, {  496326304,  -952145842}, 
+	{  498880516,  -950810042}, {  498515848,  -951001290}, {  498151107,  -951192399}, {  497786293,  -951383367}, 
+	{  500338453,  -950043650}, {  499974079,  -950235458}, {  499609631,  -950427126}, {  499245110,  -950618654}, 
+	{  501795212,  -949275023}, {  501431133,  -949467390}, {  501066980,  -949659616}, {  500702753,  -949851703}, 
+	{  503250791,  -948504163}, {  502887007,  -948697087}, {  502523149,  -948889872}, {  502159217,  -949082517}, 
+	{  504705185,  -947731070}, {  504341698,  -947924552}, {  503978136,  -948117895}, {  503614500,  -948311099}, 
+	{  506158392,  -946955747}, {  505795202,  -947149787}, {  505431937,  -947343687}, {  505068598,  -947537448}, 
+	{  507610408,  -946178196}, {  507247516,  -946372792}, {  506884549,  -946567250}, {  506521508,  -946761568}, 
+	{  509061229,  -945398418}, {  508698636,  -945593571}, {  508335968,  -945788585}, {  507973225,  -945983460}, 
+	{  510510853,  -944616416}, {  510148559,  -944812125}, {  509786191,  -945007695}, {  509423748,  -945203126}, 
+	{  511959275,  -943832191}, {  511597282,  -944028456}, {  511235214,  -944224582}, {  510873071,  -944420568}, 
+	{  513406493,  -943045745}, {  513044801,  -943242565}, {  512683035,  -943439246}, {  512321192,  -943635788}, 
+	{  514852502,  -942257081}, {  514491113,  -942454455}, {  514129648,  -942651690}, {  513768108,  -942848787}, 
+	{  516297300,  -941466198}, {  515936214,  -941664127}, {  515575053,  -941861917}, {  515213815,  -942059568}, 
+	{  517740883,  -940673101}, {  517380101,  -940871583}, {  517019243,  -941069926}, {  516658310,  -941268132}, 
+	{  519183248,  -939877790}, {  518822771,  -940076825}, {  518462218,  -940275722}, {  518101588,  -940474481}, 
+	{  520624391,  -939080267}, {  520264220,  -939279855}, {  519903972,  -939479305}, {  519543648,  -939678616}, 
+	{  522064309,  -938280535}, {  521704444,  -938480675}, {  521344503,  -938680677}, {  520984485,  -938880541}, 
+	{  523502998,  -937478595}, {  523143441,  -937679287}, {  522783807,  -937879841}, {  522424096,  -938080257}, 
+	{  524940456,  -936674448}, {  524581207,  -936875692}, {  524221881,  -937076797}, {  523862478,  -937277765}, 
+	{  526376678,  -935868098}, {  526017739,  -936069892}, {  525658722,  -936271549}, {  525299627,  -936473067}, 
+	{  527811662,  -935059546}, {  527453033,  -935261890}, {  527094325,  -935464097}, {  526735541,  -935666166}, 
+	{  529245404,  -934248793}, {  528887085,  -934451687}, {  528528689,  -934654444}, {  528170214,  -934857064}, 
+	{  530677900,  -933435842}, {  530319893,  -933639286}, {  529961808,  -933842592}, {  529603645,  -934045761}, 
+	{  532109148,  -932620694}, {  531751453,  -932824687}, {  531393681,  -933028542}, {  531035830,  -933232261}, 
+	{  533539144,  -931803352}, {  533181762,  -932007893}, {  532824303,  -932212297}, {  532466765,  -932416564}, 
+	{  534967884,  -930983817}, {  534610817,  -931188906}, {  534253671,  -931393859}, {  533896447,  -931598674}, 
+	{  536395365,  -930162092}, {  536038613,  -930367728}, {  535681782,  -930573228}, {  535324872,  -930778591}, 
+	{  537821584,  -929338177}, {  537465148,  -929544361}, {  537108633,  -929750408}, {  536752038,  -929956318}, 
+	{  539246538,  -928512076}, {  538890418,  -928718807}, {  538534220,  -928925400}, {  538177942,  -929131857}, 
+	{  540670223,  -927683790}, {  540314421,  -927891067}, {  539958539,  -928098206}, {  539602578,  -928305210}, 
+	{  542092635,  -926853322}, {  541737151,  -927061143}, {  541381588,  -927268829}, {  541025945,  -927476378}, 
+	{  543513772,  -926020672}, {  543158607,  -926229039}, {  542803363,  -926437269}, {  542448039,  -926645363}, 
+	{  544933630,  -925185843}, {  544578785,  -925394754}, {  544223861,  -925603530}, {  543868856,  -925812169}, 
+	{  546352205,  -924348837}, {  545997682,  -924558292}, {  545643078,  -924767612}, {  545288394,  -924976795}, 
+	{  547769495,  -923509656}, {  547415294,  -923719655}, {  547061011,  -923929518}, {  546706649,  -924139246}, 
+	{  549185496,  -922668302}, {  548831617,  -922878844}, {  548477657,  -923089250}, {  548123617,  -923299521}, 
+	{  550600205,  -921824777}, {  550246649,  -922035861}, {  549893013,  -922246810}, {  549539295,  -922457624}, 
+	{  552013618,  -920979082}, {  551660387,  -921190709}, {  551307074,  -921402200}, {  550953680,  -921613556}, 
+	{  553425732,  -920131221}, {  553072826,  -920343389}, {  552719838,  -920555422}, {  552366769,  -920767320}, 
+	{  554836544,  -919281194}, {  554483964,  -919493904}, {  554131301,  -919706478}, {  553778558,  -919918917}, 
+	{  556246051,  -918429004}, {  555893797,  -918642254}, {  555541461,  -918855369}, {  555189044,  -919068349}, 
+	{  557654248,  -917574653}, {  557302322,  -917788443}, {  556950313,  -918002099}, {  556598223,  -918215619}, 
+	{  559061133,  -916718143}, {  558709535,  -916932473}, {  558357855,  -917146668}, {  558006093,  -917360728}, 
+	{  560466703,  -915859476}, {  560115434,  -916074345}, {  559764083,  -916289079}, {  559412649,  -916503678}, 
+	{  561870954,  -914998653}, {  561520015,  -915214061}, {  561168994,  -915429334}, {  560817890,  -915644472}, 
+	{  563273883,  -914135678}, {  562923275,  -914351624}, {  562572584,  -914567435}, {  562221810,  -914783111}, 
+	{  564675486,  -913270551}, {  564325210,  -913487035}, {  563974850,  -913703383}, {  563624408,  -913919598}, 
+	{  566075761,  -912403276}, {  565725817,  -912620296}, {  565375790,  -912837182}, {  565025679,  -913053934}, 
+	{  567474703,  -911533853}, {  567125093,  -911751410}, {  566775399,  -911968833}, {  566425621,  -912186121}, 
+	{  568872310,  -910662286}, {  568523034,  -910880379}, {  568173674,  -911098338}, {  567824230,  -911316163}, 
+	{  570268579,  -909788576}, {  569919637,  -910007204}, {  569570612,  -910225699}, {  569221503,  -910444059}, 
+	{  571663506,  -908912725}, {  571314900,  -909131888}, {  570966210,  -909350918}, {  570617437,  -909569814}, 
+	{  573057087,  -908034735}, {  572708818,  -908254433}, {  572360465,  -908473997}, {  572012027,  -908693428}, 
+	{  574449320,  -907154608}, {  574101389,  -907374840}, {  573753372,  -907594938}, {  573405272,  -907814903}, 
+	{  575840202,  -906272347}, {  575492608,  -906493112}, {  575144930,  -906713744}, {  574797167,  -906934243}, 
+	{  577229728,  -905387953}, {  576882473,  -905609251}, {  576535134,  -905830417}, {  576187710,  -906051448}, 
+	{  578617896,  -904501429}, {  578270981,  -904723260}, {  577923982,  -904944957}, {  577576897,  -905166522}, 
+	{  580004702,  -903612776}, {  579658129,  -903835139}, {  579311470,  -904057369}, {  578964725,  -904279465}, 
+	{  581390144,  -902721998}, {  581043912,  -902944892}, {  580697594,  -903167653}, {  580351191,  -903390281}, 
+	{  582774218,  -901829095}, {  582428328,  -902052519}, {  582082352,  -902275811}, {  581736291,  -902498971}, 
+	{  584156920,  -900934069}, {  583811373,  -901158025}, {  583465740,  -901381847}, {  583120022,  -901605537}, 
+	{  585538248,  -900036924}, {  585193045,  -900261409}, {  584847756,  -900485762}, {  584502381,  -900709982}, 
+	{  586918198,  -899137661}, {  586573340,  -899362675}, {  586228395,  -899587557}, {  585883365,  -899812307}, 
+	{  588296766,  -898236282}, {  587952254,  -898461825}, {  587607655,  -898687236}, {  587262969,  -898912515}, 
+	{  589673951,  -897332790}, {  589329785,  -897558861}, {  588985532,  -897784800}, {  588641192,  -898010607}, 
+	{  591049748,  -896427186}, {  590705929,  -896653785}, {  590362023,  -896880252}, {  590018030,  -897106587}, 
+	{  592424154,  -895519473}, {  592080683,  -895746599}, {  591737125,  -895973593}, {  591393480,  -896200456}, 
+	{  593797166,  -894609652}, {  593454044,  -894837305}, {  593110835,  -895064826}, {  592767538,  -895292215}, 
+	{  595168781,  -893697727}, {  594826008,  -893925905}, {  594483148,  -894153953}, {  594140201,  -894381868}, 
+	{  596538995,  -892783698}, {  596196573,  -893012402}, {  595854063,  -893240975}, {  595511466,  -893469417}, 
+	{  597907806,  -891867569}, {  597565735,  -892096798}, {  597223576,  -892325896}, {  596881330,  -892554863}, 
+	{  599275210,  -890949341}, {  598933491,  -891179094}, {  598591684,  -891408717}, {  598249789,  -891638208}, 
+	{  600641203,  -890029016}, {  600299837,  -890259294}, {  599958383,  -890489440}, {  599616840,  -890719456}, 
+	{  602005783,  -889106597}, {  601664771,  -889337398}, {  601323670,  -889568068}, {  600982481,  -889798608}, 
+	{  603368947,  -888182086}, {  603028289,  -888413410}, {  602687543,  -888644603}, {  602346707,  -888875666}, 
+	{  604730691,  -887255485}, {  604390388,  -887487331}, {  604049997,  -887719047}, {  603709516,  -887950632}, 
+	{  606091012,  -886326796}, {  605751065,  -886559164}, {  605411029,  -886791402}, {  605070905,  -887023509}, 
+	{  607449906,  -885396022}, {  607110317,  -885628911}, {  606770638,  -885861670}, {  606430869,  -886094298}, 
+	{  608807372,  -884463164}, {  608468140,  -884696574}, {  608128818,  -884929853}, {  607789407,  -885163003}, 
+	{  610163404,  -883528225}, {  609824531,  -883762155}, {  609485567,  -883995955}, {  609146514,  -884229624}, 
+	{  611518001,  -882591207}, {  611179487,  -882825656}, {  610840882,  -883059976}, {  610502188,  -883294165}, 
+	{  612871159,  -881652112}, {  612533005,  -881887080}, {  612194760,  -882121919}, {  611856426,  -882356628}, 
+	{  614222875,  -880710943}, {  613885081,  -880946429}, {  613547198,  -881181787}, {  613209223,  -881417014}, 
+	{  615573145,  -879767701}, {  615235714,  -880003705}, {  614898191,  -880239581}, {  614560578,  -880475326}, 
+	{  616921967,  -878822389}, {  616584898,  -879058911}, {  616247738,  -879295303}, {  615910487,  -879531567}, 
+	{  618269338,  -877875009}, {  617932631,  -878112047}, {  617595834,  -878348957}, {  617258946,  -878585737}, 
+	{  619615253,  -876925563}, {  619278911,  -877163118}, {  618942478,  -877400544}, {  618605953,  -877637841}, 
+	{  620959711,  -875974054}, {  620623733,  -876212124}, {  620287664,  -876450066}, {  619951504,  -876687879}, 
+	{  622302707,  -875020483}, {  621967095,  -875259069}, {  621631392,  -875497526}, {  621295597,  -875735854}, 
+	{  623644239,  -874064853}, {  623308993,  -874303954}, {  622973656,  -874542925}, {  622638227,  -874781769}, 
+	{  624984303,  -873107167}, {  624649425,  -873346781}, {  624314455,  -873586267}, {  623979393,  -873825625}, 
+	{  626322897,  -872147426}, {  625988387,  -872387554}, {  625653784,  -872627553}, {  625319090,  -872867424}, 
+	{  627660017,  -871185633}, {  627325875,  -871426274}, {  626991641,  -871666786}, {  626657315,  -871907170}, 
+	{  628995660,  -870221790}, {  628661888,  -870462943}, {  628328023,  -870703968}, {  627994066,  -870944865}, 
+	{  630329823,  -869255900}, {  629996421,  -869497564}, {  629662927,  -869739101}, {  629329340,  -869980510}, 
+	{  631662503,  -868287963}, {  631329472,  -868530139}, {  630996348,  -868772187}, {  630663132,  -869014107}, 
+	{  632993696,  -867317984}, {  632661037,  -867560670}, {  632328285,  -867803229}, {  631995440,  -868045660}, 
+	{  634323400,  -866345964}, {  633991114,  -866589160}, {  633658734,  -866832229}, {  633326262,  -867075170}, 
+	{  635651611,  -865371905}, {  635319698,  -865615611}, {  634987692,  -865859189}, {  634655593,  -866102640}, 
+	{  636978327,  -864395810}, {  636646788,  -864640024}, {  636315156,  -864884112}, {  635983430,  -865128072}, 
+	{  638303543,  -863417681}, {  637972380,  -863662404}, {  637641122,  -863906999}, {  637309771,  -864151468}, 
+	{  639627258,  -862437520}, {  639296470,  -862682750}, {  638965588,  -862927854}, {  638634613,  -863172831}, 
+	{  640949467,  -861455330}, {  640619056,  -861701067}, {  640288551,  -861946678}, {  639957951,  -862192163}, 
+	{  642270169,  -860471112}, {  641940135,  -860717357}, {  641610007,  -860963474}, {  641279784,  -861209465}, 
+	{  643589359,  -859484870}, {  643259703,  -859731620}, {  642929953,  -859978244}, {  642600108,  -860224742}, 
+	{  644907034,  -858496606}, {  644577757,  -858743861}, {  644248386,  -858990991}, {  643918920,  -859237994}, 
+	{  646223192,  -857506321}, {  645894295,  -857754081}, {  645565303,  -858001716}, {  645236216,  -858249224}, 
+	{  647537830,  -856514019}, {  647209313,  -856762283}, {  646880701,  -857010422}, {  646551994,  -857258434}, 
+	{  648850943,  -855519701}, {  648522808,  -855768469}, {  648194577,  -856017111}, {  647866251,  -856265628}, 
+	{  650162530,  -854523370}, {  649834777,  -854772641}, {  649506928,  -855021787}, {  649178983,  -855270806}, 
+	{  651472587,  -853525028}, {  651145216,  -853774802}, {  650817750,  -854024450}, {  650490188,  -854273973}, 
+	{  652781111,  -852524677}, {  652454124,  -852774953}, {  652127041,  -853025104}, {  651799862,  -853275128}, 
+	{  654088099,  -851522321}, {  653761496,  -851773098}, {  653434797,  -852023750}, {  653108002,  -852274276}, 
+	{  655393548,  -850517961}, {  655067330,  -850769239}, {  654741016,  -851020391}, {  654414606,  -851271419}, 
+	{  656697454,  -849511600}, {  656371622,  -849763378}, {  656045694,  -850015030}, {  655719669,  -850266558}, 
+	{  657999816,  -848503239}, {  657674370,  -848755517}, {  657348828,  -849007669}, {  657023190,  -849259697}, 
+	{  659300629,  -847492882}, {  658975571,  -847745659}, {  658650416,  -847998310}, {  658325164,  -848250837}, 
+	{  660599890,  -846480531}, {  660275220,  -846733806}, {  659950454,  -846986956}, {  659625590,  -847239981}, 
+	{  661897597,  -845466188}, {  661573317,  -845719960}, {  661248938,  -845973608}, {  660924463,  -846227132}, 
+	{  663193747,  -844449856}, {  662869856,  -844704125}, {  662545867,  -844958270}, {  662221781,  -845212291}, 
+	{  664488336,  -843431536}, {  664164835,  -843686302}, {  663841237,  -843940944}, {  663517541,  -844195462}, 
+	{  665781362,  -842411232}, {  665458252,  -842666494}, {  665135044,  -842921632}, {  664811739,  -843176646}, 
+	{  667072820,  -841388945}, {  666750103,  -841644702}, {  666427287,  -841900336}, {  666104373,  -842155846}, 
+	{  668362709,  -840364679}, {  668040385,  -840620931}, {  667717961,  -840877059}, {  667395440,  -841133064}, 
+	{  669651026,  -839338435}, {  669329094,  -839595181}, {  669007064,  -839851804}, {  668684936,  -840108303}, 
+	{  670937767,  -838310216}, {  670616229,  -838567456}, {  670294593,  -838824572}, {  669972859,  -839081565}, 
+	{  672222928,  -837280024}, {  671901786,  -837537757}, {  671580545,  -837795367}, {  671259205,  -838052853}, 
+	{  673506508,  -836247863}, {  673185762,  -836506088}, {  672864916,  -836764190}, {  672543972,  -837022168}, 
+	{  674788504,  -835213733}, {  674468154,  -835472450}, {  674147704,  -835731044}, {  673827156,  -835989515}, 
+	{  676068911,  -834177638}, {  675748958,  -834436846}, {  675428906,  -834695931}, {  675108755,  -834954893}, 
+	{  677347728,  -833139580}, {  677028173,  -833399279}, {  676708518,  -833658855}, {  676388765,  -833918308}, 
+	{  678624950,  -832099562}, {  678305794,  -832359750}, {  677986538,  -832619816}, {  677667183,  -832879760}, 
+	{  679900576,  -831057586}, {  679581820,  -831318263}, {  679262963,  -831578819}, {  678944007,  -831839252}, 
+	{  681174602,  -830013654}, {  680856246,  -830274820}, {  680537789,  -830535864}, {  680219233,  -830796786}, 
+	{  682447025,  -828967769}, {  682129070,  -829229423}, {  681811014,  -829490956}, {  681492858,  -829752366}, 
+	{  683717842,  -827919934}, {  683400289,  -828182075}, {  683082635,  -828444095}, {  682764880,  -828705993}, 
+	{  684987051,  -826870150}, {  684669900,  -827132778}, {  684352648,  -827395285}, {  684035295,  -827657670}, 
+	{  686254647,  -825818421}, {  685937899,  -826081535}, {  685621051,  -826344528}, {  685304101,  -826607400}, 
+	{  687520629,  -824764748}, {  687204285,  -825028348}, {  686887840,  -825291827}, {  686571294,  -825555185}, 
+	{  688784993,  -823709135}, {  688469054,  -823973220}, {  688153013,  -824237184}, {  687836872,  -824501026}, 
+	{  690047736,  -822651583}, {  689732202,  -822916152}, {  689416567,  -823180601}, {  689100831,  -823444928}, 
+	{  691308855,  -821592095}, {  690993728,  -821857149}, {  690678499,  -822122081}, {  690363168,  -822386892}, 
+	{  692568348,  -820530675}, {  692253627,  -820796211}, {  691938805,  -821061627}, {  691623881,  -821326921}, 
+	{  693826211,  -819467323}, {  693511898,  -819733342}, {  693197483,  -819999240}, {  692882966,  -820265018}, 
+	{  695082441,  -818402043}, {  694768537,  -818668544}, {  694454530,  -818934924}, {  694140422,  -819201184}, 
+	{  696337036,  -817334838}, {  696023541,  -817601820}, {  695709943,  -817868681}, {  695396243,  -818135422}, 
+	{  697589992,  -816265709}, {  697276907,  -816533171}, {  696963719,  -816800514}, {  696650429,  -817067736}, 
+	{  698841307,  -815194659}, {  698528632,  -815462602}, {  698215855,  -815730424}, {  697902975,  -815998127}, 
+	{  700090977,  -814121692}, {  699778714,  -814390113}, {  699466348,  -814658415}, {  699153879,  -814926597}, 
+	{  701339000,  -813046808}, {  701027149,  -813315708}, {  700715194,  -813584489}, {  700403137,  -813853150}, 
+	{  702585372,  -811970011}, {  702273934,  -812239390}, {  701962393,  -812508649}, {  701650748,  -812777788}, 
+	{  703830092,  -810891304}, {  703519067,  -811161160}, {  703207939,  -811430896}, {  702896707,  -811700513}, 
+	{  705073155,  -809810688}, {  704762544,  -810081021}, {  704451830,  -810351235}, {  704141013,  -810621329}, 
+	{  706314559,  -808728167}, {  706004363,  -808998976}, {  705694064,  -809269666}, {  705383661,  -809540237}, 
+	{  707554301,  -807643743}, {  707244521,  -807915028}, {  706934638,  -808186193}, {  706624650,  -808457240}, 
+	{  708792378,  -806557419}, {  708483015,  -806829178}, {  708173547,  -807100819}, {  707863976,  -807372340}, 
+	{  710028787,  -805469196}, {  709719841,  -805741430}, {  709410791,  -806013545}, {  709101636,  -806285541}, 
+	{  711263525,  -804379079}, {  710954997,  -804651786}, {  710646365,  -804924374}, {  710337628,  -805196845}, 
+	{  712496590,  -803287068}, {  712188481,  -803560248}, {  711880267,  -803833310}, {  711571948,  -804106253}, 
+	{  713727978,  -802193167}, {  713420288,  -802466820}, {  713112494,  -802740354}, {  712804594,  -803013770}, 
+	{  714957687,  -801097379}, {  714650417,  -801371503}, {  714343043,  -801645509}, {  714035563,  -801919397}, 
+	{  716185713,  -799999706}, {  715878864,  -800274300}, {  715571910,  -800548778}, {  715264851,  -800823137}, 
+	{  717412054,  -798900150}, {  717105627,  -799175215}, {  716799095,  -799450163}, {  716492457,  -799724993}, 
+	{  718636707,  -797798714}, {  718330702,  -798074249}, {  718024592,  -798349667}, {  717718376,  -798624967}, 
+	{  719859669,  -796695401}, {  719554087,  -796971405}, {  719248400,  -797247292}, {  718942606,  -797523061}, 
+	{  721080937,  -795590213}, {  720775779,  -795866685}, {  720470515,  -796143041}, {  720165145,  -796419279}, 
+	{  722300508,  -794483153}, {  721995775,  -794760093}, {  721690935,  -795036917}, {  721385989,  -795313623}, 
+	{  723518380,  -793374223}, {  723214072,  -793651631}, {  722909657,  -793928922}, {  722605136,  -794206096}, 
+	{  724734549,  -792263427}, {  724430667,  -792541301}, {  724126677,  -792819059}, {  723822582,  -793096699}, 
+	{  725949013,  -791150767}, {  725645557,  -791429106}, {  725341994,  -791707330}, {  725038325,  -791985437}, 
+	{  727161768,  -790036244}, {  726858740,  -790315049}, {  726555604,  -790593738}, {  726252362,  -790872310}, 
+	{  728372813,  -788919863}, {  728070212,  -789199133}, {  727767504,  -789478286}, {  727464690,  -789757323}, 
+	{  729582143,  -787801625}, {  729279971,  -788081359}, {  728977692,  -788360976}, {  728675306,  -788640478}, 
+	{  730789757,  -786681534}, {  730488014,  -786961731}, {  730186165,  -787241811}, {  729884208,  -787521776}, 
+	{  731995651,  -785559591}, {  731694339,  -785840250}, {  731392919,  -786120794}, {  731091392,  -786401222}, 
+	{  733199822,  -784435800}, {  732898941,  -784716921}, {  732597952,  -784997927}, {  732296855,  -785278817}, 
+	{  734402269,  -783310163}, {  734101819,  -783591746}, {  733801261,  -783873212}, {  733500596,  -784154564}, 
+	{  735602987,  -782182683}, {  735302970,  -782464726}, {  735002844,  -782746654}, {  734702610,  -783028466}, 
+	{  736801974,  -781053363}, {  736502390,  -781335865}, {  736202697,  -781618253}, {  735902896,  -781900526}, 
+	{  737999228,  -779922204}, {  737700077,  -780205166}, {  737400818,  -780488013}, {  737101450,  -780770745}, 
+	{  739194745,  -778789210}, {  738896028,  -779072631}, {  738597203,  -779355936}, {  738298270,  -779639128}, 
+	{  740388522,  -777654384}, {  740090241,  -777938262}, {  739791851,  -778222026}, {  739493352,  -778505675}, 
+	{  741580558,  -776517728}, {  741282712,  -776802063}, {  740984758,  -777086284}, {  740686694,  -777370391}, 
+	{  742770848,  -775379244}, {  742473439,  -775664036}, {  742175921,  -775948714}, {  741878294,  -776233278}, 
+	{  743959390,  -774238936}, {  743662419,  -774524184}, {  743365338,  -774809318}, {  743068147,  -775094338}, 
+	{  745146182,  -773096806}, {  744849649,  -773382509}, {  744553005,  -773668099}, {  744256253,  -773953574}, 
+	{  746331221,  -771952857}, {  746035126,  -772239015}, {  745738921,  -772525059}, {  745442606,  -772810989}, 
+	{  747514503,  -770807092}, {  747218847,  -771093703}, {  746923082,  -771380201}, {  746627206,  -771666586}, 
+	{  748696026,  -769659512}, {  748400811,  -769946577}, {  748105485,  -770233528}, {  747810049,  -770520367}, 
+	{  749875788,  -768510122}, {  749581013,  -768797639}, {  749286127,  -769085043}, {  748991132,  -769372334}, 
+	{  751053785,  -767358923}, {  750759451,  -767646892}, {  750465007,  -767934748}, {  750170453,  -768222492}, 
+	{  752230015,  -766205919}, {  751936123,  -766494339}, {  751642121,  -766782646}, {  751348008,  -767070841}, 
+	{  753404474,  -765051111}, {  753111025,  -765339982}, {  752817466,  -765628740}, {  752523796,  -765917386}, 
+	{  754577161,  -763894504}, {  754284156,  -764183824}, {  753991040,  -764473032}, {  753697812,  -764762128}, 
+	{  755748072,  -762736098}, {  755455511,  -763025868}, {  755162839,  -763315525}, {  754870056,  -763605071}, 
+	{  756917205,  -761575898}, {  756625089,  -761866116}, {  756332861,  -762156223}, {  756040522,  -762446217}, 
+	{  758084557,  -760413906}, {  757792886,  -760704572}, {  757501104,  -760995126}, {  757209210,  -761285568}, 
+	{  759250125,  -759250125}, {  758958900,  -759541238}, {  758667564,  -759832239}, {  758376116,  -760123129}, 
+	{  760413906,  -758084557}, {  760123129,  -758376116}, {  759832239,  -758667564}, {  759541238,  -758958900}, 
+	{  761575898,  -756917205}, {  761285568,  -757209210}, {  760995126,  -757501104}, {  760704572,  -757792886}, 
+	{  762736098,  -755748072}, {  762446217,  -756040522}, {  762156223,  -756332861}, {  761866116,  -756625089}, 
+	{  763894504,  -754577161}, {  763605071,  -754870056}, {  763315525,  -755162839}, {  763025868,  -755455511}, 
+	{  765051111,  -753404474}, {  764762128,  -753697812}, {  764473032,  -753991040}, {  764183824,  -754284156}, 
+	{  766205919,  -752230015}, {  765917386,  -752523796}, {  765628740,  -752817466}, {  765339982,  -753111025}, 
+	{  767358923,  -751053785}, {  767070841,  -751348008}, {  766782646,  -751642121}, {  766494339,  -751936123}, 
+	{  768510122,  -749875788}, {  768222492,  -750170453}, {  767934748,  -750465007}, {  767646892,  -750759451}, 
+	{  769659512,  -748696026}, {  769372334,  -748991132}, {  769085043,  -749286127}, {  768797639,  -749581013}, 
+	{  770807092,  -747514503}, {  770520367,  -747810049}, {  770233528,  -748105485}, {  769946577,  -748400811}, 
+	{  771952857,  -746331221}, {  771666586,  -746627206}, {  771380201,  -746923082}, {  771093703,  -747218847}, 
+	{  773096806,  -745146182}, {  772810989,  -745442606}, {  772525059,  -745738921}, {  772239015,  -746035126}, 
+	{  774238936,  -743959390}, {  773953574,  -744256253}, {  773668099,  -744553005}, {  773382509,  -744849649}, 
+	{  775379244,  -742770848}, {  775094338,  -743068147}, {  774809318,  -743365338}, {  774524184,  -743662419}, 
+	{  776517728,  -741580558}, {  776233278,  -741878294}, {  775948714,  -742175921}, {  775664036,  -742473439}, 
+	{  777654384,  -740388522}, {  777370391,  -740686694}, {  777086284,  -740984758}, {  776802063,  -741282712}, 
+	{  778789210,  -739194745}, {  778505675,  -739493352}, {  778222026,  -739791851}, {  777938262,  -740090241}, 
+	{  779922204,  -737999228}, {  779639128,  -738298270}, {  779355936,  -738597203}, {  779072631,  -738896028}, 
+	{  781053363,  -736801974}, {  780770745,  -737101450}, {  780488013,  -737400818}, {  780205166,  -737700077}, 
+	{  782182683,  -735602987}, {  781900526,  -735902896}, {  781618253,  -736202697}, {  781335865,  -736502390}, 
+	{  783310163,  -734402269}, {  783028466,  -734702610}, {  782746654,  -735002844}, {  782464726,  -735302970}, 
+	{  784435800,  -733199822}, {  784154564,  -733500596}, {  783873212,  -733801261}, {  783591746,  -734101819}, 
+	{  785559591,  -731995651}, {  785278817,  -732296855}, {  784997927,  -732597952}, {  784716921,  -732898941}, 
+	{  786681534,  -730789757}, {  786401222,  -731091392}, {  786120794,  -731392919}, {  785840250,  -731694339}, 
+	{  787801625,  -729582143}, {  787521776,  -729884208}, {  787241811,  -730186165}, {  786961731,  -730488014}, 
+	{  788919863,  -728372813}, {  788640478,  -728675306}, {  788360976,  -728977692}, {  788081359,  -729279971}, 
+	{  790036244,  -727161768}, {  789757323,  -727464690}, {  789478286,  -727767504}, {  789199133,  -728070212}, 
+	{  791150767,  -725949013}, {  790872310,  -726252362}, {  790593738,  -726555604}, {  790315049,  -726858740}, 
+	{  792263427,  -724734549}, {  791985437,  -725038325}, {  791707330,  -725341994}, {  791429106,  -725645557}, 
+	{  793374223,  -723518380}, {  793096699,  -723822582}, {  792819059,  -724126677}, {  792541301,  -724430667}, 
+	{  794483153,  -722300508}, {  794206096,  -722605136}, {  793928922,  -722909657}, {  793651631,  -723214072}, 
+	{  795590213,  -721080937}, {  795313623,  -721385989}, {  795036917,  -721690935}, {  794760093,  -721995775}, 
+	{  796695401,  -719859669}, {  796419279,  -720165145}, {  796143041,  -720470515}, {  795866685,  -720775779}, 
+	{  797798714,  -718636707}, {  797523061,  -718942606}, {  797247292,  -719248400}, {  796971405,  -719554087}, 
+	{  798900150,  -717412054}, {  798624967,  -717718376}, {  798349667,  -718024592}, {  798074249,  -718330702}, 
+	{  799999706,  -716185713}, {  799724993,  -716492457}, {  799450163,  -716799095}, {  799175215,  -717105627}, 
+	{  801097379,  -714957687}, {  800823137,  -715264851}, {  800548778,  -715571910}, {  800274300,  -715878864}, 
+	{  802193167,  -713727978}, {  801919397,  -714035563}, {  801645509,  -714343043}, {  801371503,  -714650417}, 
+	{  803287068,  -712496590}, {  803013770,  -712804594}, {  802740354,  -713112494}, {  802466820,  -713420288}, 
+	{  804379079,  -711263525}, {  804106253,  -711571948}, {  803833310,  -711880267}, {  803560248,  -712188481}, 
+	{  805469196,  -710028787}, {  805196845,  -710337628}, {  804924374,  -710646365}, {  804651786,  -710954997}, 
+	{  806557419,  -708792378}, {  806285541,  -709101636}, {  806013545,  -709410791}, {  805741430,  -709719841}, 
+	{  807643743,  -707554301}, {  807372340,  -707863976}, {  807100819,  -708173547}, {  806829178,  -708483015}, 
+	{  808728167,  -706314559}, {  808457240,  -706624650}, {  808186193,  -706934638}, {  807915028,  -707244521}, 
+	{  809810688,  -705073155}, {  809540237,  -705383661}, {  809269666,  -705694064}, {  808998976,  -706004363}, 
+	{  810891304,  -703830092}, {  810621329,  -704141013}, {  810351235,  -704451830}, {  810081021,  -704762544}, 
+	{  811970011,  -702585372}, {  811700513,  -702896707}, {  811430896,  -703207939}, {  811161160,  -703519067}, 
+	{  813046808,  -701339000}, {  812777788,  -701650748}, {  812508649,  -701962393}, {  812239390,  -702273934}, 
+	{  814121692,  -700090977}, {  813853150,  -700403137}, {  813584489,  -700715194}, {  813315708,  -701027149}, 
+	{  815194659,  -698841307}, {  814926597,  -699153879}, {  814658415,  -699466348}, {  814390113,  -699778714}, 
+	{  816265709,  -697589992}, {  815998127,  -697902975}, {  815730424,  -698215855}, {  815462602,  -698528632}, 
+	{  817334838,  -696337036}, {  817067736,  -696650429}, {  816800514,  -696963719}, {  816533171,  -697276907}, 
+	{  818402043,  -695082441}, {  818135422,  -695396243}, {  817868681,  -695709943}, {  817601820,  -696023541}, 
+	{  819467323,  -693826211}, {  819201184,  -694140422}, {  818934924,  -694454530}, {  818668544,  -694768537}, 
+	{  820530675,  -692568348}, {  820265018,  -692882966}, {  819999240,  -693197483}, {  819733342,  -693511898}, 
+	{  821592095,  -691308855}, {  821326921,  -691623881}, {  821061627,  -691938805}, {  820796211,  -692253627}, 
+	{  822651583,  -690047736}, {  822386892,  -690363168}, {  822122081,  -690678499}, {  821857149,  -690993728}, 
+	{  823709135,  -688784993}, {  823444928,  -689100831}, {  823180601,  -689416567}, {  822916152,  -689732202}, 
+	{  824764748,  -687520629}, {  824501026,  -687836872}, {  824237184,  -688153013}, {  823973220,  -688469054}, 
+	{  825818421,  -686254647}, {  825555185,  -686571294}, {  825291827,  -686887840}, {  825028348,  -687204285}, 
+	{  826870150,  -684987051}, {  826607400,  -685304101}, {  826344528,  -685621051}, {  826081535,  -685937899}, 
+	{  827919934,  -683717842}, {  827657670,  -684035295}, {  827395285,  -684352648}, {  827132778,  -684669900}, 
+	{  828967769,  -682447025}, {  828705993,  -682764880}, {  828444095,  -683082635}, {  828182075,  -683400289}, 
+	{  830013654,  -681174602}, {  829752366,  -681492858}, {  829490956,  -681811014}, {  829229423,  -682129070}, 
+	{  831057586,  -679900576}, {  830796786,  -680219233}, {  830535864,  -680537789}, {  830274820,  -680856246}, 
+	{  832099562,  -678624950}, {  831839252,  -678944007}, {  831578819,  -679262963}, {  831318263,  -679581820}, 
+	{  833139580,  -677347728}, {  832879760,  -677667183}, {  832619816,  -677986538}, {  832359750,  -678305794}, 
+	{  834177638,  -676068911}, {  833918308,  -676388765}, {  833658855,  -676708518}, {  833399279,  -677028173}, 
+	{  835213733,  -674788504}, {  834954893,  -675108755}, {  834695931,  -675428906}, {  834436846,  -675748958}, 
+	{  836247863,  -673506508}, {  835989515,  -673827156}, {  835731044,  -674147704}, {  835472450,  -674468154}, 
+	{  837280024,  -672222928}, {  837022168,  -672543972}, {  836764190,  -672864916}, {  836506088,  -673185762}, 
+	{  838310216,  -670937767}, {  838052853,  -671259205}, {  837795367,  -671580545}, {  837537757,  -671901786}, 
+	{  839338435,  -669651026}, {  839081565,  -669972859}, {  838824572,  -670294593}, {  838567456,  -670616229}, 
+	{  840364679,  -668362709}, {  840108303,  -668684936}, {  839851804,  -669007064}, {  839595181,  -669329094}, 
+	{  841388945,  -667072820}, {  841133064,  -667395440}, {  840877059,  -667717961}, {  840620931,  -668040385}, 
+	{  842411232,  -665781362}, {  842155846,  -666104373}, {  841900336,  -666427287}, {  841644702,  -666750103}, 
+	{  843431536,  -664488336}, {  843176646,  -664811739}, {  842921632,  -665135044}, {  842666494,  -665458252}, 
+	{  844449856,  -663193747}, {  844195462,  -663517541}, {  843940944,  -663841237}, {  843686302,  -664164835}, 
+	{  845466188,  -661897597}, {  845212291,  -662221781}, {  844958270,  -662545867}, {  844704125,  -662869856}, 
+	{  846480531,  -660599890}, {  846227132,  -660924463}, {  845973608,  -661248938}, {  845719960,  -661573317}, 
+	{  847492882,  -659300629}, {  847239981,  -659625590}, {  846986956,  -659950454}, {  846733806,  -660275220}, 
+	{  848503239,  -657999816}, {  848250837,  -658325164}, {  847998310,  -658650416}, {  847745659,  -658975571}, 
+	{  849511600,  -656697454}, {  849259697,  -657023190}, {  849007669,  -657348828}, {  848755517,  -657674370}, 
+	{  850517961,  -655393548}, {  850266558,  -655719669}, {  850015030,  -656045694}, {  849763378,  -656371622}, 
+	{  851522321,  -654088099}, {  851271419,  -654414606}, {  851020391,  -654741016}, {  850769239,  -655067330}, 
+	{  852524677,  -652781111}, {  852274276,  -653108002}, {  852023750,  -653434797}, {  851773098,  -653761496}, 
+	{  853525028,  -651472587}, {  853275128,  -651799862}, {  853025104,  -652127041}, {  852774953,  -652454124}, 
+	{  854523370,  -650162530}, {  854273973,  -650490188}, {  854024450,  -650817750}, {  853774802,  -651145216}, 
+	{  855519701,  -648850943}, {  855270806,  -649178983}, {  855021787,  -649506928}, {  854772641,  -649834777}, 
+	{  856514019,  -647537830}, {  856265628,  -647866251}, {  856017111,  -648194577}, {  855768469,  -648522808}, 
+	{  857506321,  -646223192}, {  857258434,  -646551994}, {  857010422,  -646880701}, {  856762283,  -647209313}, 
+	{  858496606,  -644907034}, {  858249224,  -645236216}, {  858001716,  -645565303}, {  857754081,  -645894295}, 
+	{  859484870,  -643589359}, {  859237994,  -643918920}, {  858990991,  -644248386}, {  858743861,  -644577757}, 
+	{  860471112,  -642270169}, {  860224742,  -642600108}, {  859978244,  -642929953}, {  859731620,  -643259703}, 
+	{  861455330,  -640949467}, {  861209465,  -641279784}, {  860963474,  -641610007}, {  860717357,  -641940135}, 
+	{  862437520,  -639627258}, {  862192163,  -639957951}, {  861946678,  -640288551}, {  861701067,  -640619056}, 
+	{  863417681,  -638303543}, {  863172831,  -638634613}, {  862927854,  -638965588}, {  862682750,  -639296470}, 
+	{  864395810,  -636978327}, {  864151468,  -637309771}, {  863906999,  -637641122}, {  863662404,  -637972380}, 
+	{  865371905,  -635651611}, {  865128072,  -635983430}, {  864884112,  -636315156}, {  864640024,  -636646788}, 
+	{  866345964,  -634323400}, {  866102640,  -634655593}, {  865859189,  -634987692}, {  865615611,  -635319698}, 
+	{  867317984,  -632993696}, {  867075170,  -633326262}, {  866832229,  -633658734}, {  866589160,  -633991114}, 
+	{  868287963,  -631662503}, {  868045660,  -631995440}, {  867803229,  -632328285}, {  867560670,  -632661037}, 
+	{  869255900,  -630329823}, {  869014107,  -630663132}, {  868772187,  -630996348}, {  868530139,  -631329472}, 
+	{  870221790,  -628995660}, {  869980510,  -629329340}, {  869739101,  -629662927}, {  869497564,  -629996421}, 
+	{  871185633,  -627660017}, {  870944865,  -627994066}, {  870703968,  -628328023}, {  870462943,  -628661888}, 
+	{  872147426,  -626322897}, {  871907170,  -626657315}, {  871666786,  -626991641}, {  871426274,  -627325875}, 
+	{  873107167,  -624984303}, {  872867424,  -625319090}, {  872627553,  -625653784}, {  872387554,  -625988387}, 
+	{  874064853,  -623644239}, {  873825625,  -623979393}, {  873586267,  -624314455}, {  873346781,  -624649425}, 
+	{  875020483,  -622302707}, {  874781769,  -622638227}, {  874542925,  -622973656}, {  874303954,  -623308993}, 
+	{  875974054,  -620959711}, {  875735854,  -621295597}, {  875497526,  -621631392}, {  875259069,  -621967095}, 
+	{  876925563,  -619615253}, {  876687879,  -619951504}, {  876450066,  -620287664}, {  876212124,  -620623733}, 
+	{  877875009,  -618269338}, {  877637841,  -618605953}, {  877400544,  -618942478}, {  877163118,  -619278911}, 
+	{  878822389,  -616921967}, {  878585737,  -617258946}, {  878348957,  -617595834}, {  878112047,  -617932631}, 
+	{  879767701,  -615573145}, {  879531567,  -615910487}, {  879295303,  -616247738}, {  879058911,  -616584898}, 
+	{  880710943,  -614222875}, {  880475326,  -614560578}, {  880239581,  -614898191}, {  880003705,  -615235714}, 
+	{  881652112,  -612871159}, {  881417014,  -613209223}, {  881181787,  -613547198}, {  880946429,  -613885081}, 
+	{  882591207,  -611518001}, {  882356628,  -611856426}, {  882121919,  -612194760}, {  881887080,  -612533005}, 
+	{  883528225,  -610163404}, {  883294165,  -610502188}, {  883059976,  -610840882}, {  882825656,  -611179487}, 
+	{  884463164,  -608807372}, {  884229624,  -609146514}, {  883995955,  -609485567}, {  883762155,  -609824531}, 
+	{  885396022,  -607449906}, {  885163003,  -607789407}, {  884929853,  -608128818}, {  884696574,  -608468140}, 
+	{  886326796,  -606091012}, {  886094298,  -606430869}, {  885861670,  -606770638}, {  885628911,  -607110317}, 
+	{  887255485,  -604730691}, {  887023509,  -605070905}, {  886791402,  -605411029}, {  886559164,  -605751065}, 
+	{  888182086,  -603368947}, {  887950632,  -603709516}, {  887719047,  -604049997}, {  887487331,  -604390388}, 
+	{  889106597,  -602005783}, {  888875666,  -602346707}, {  888644603,  -602687543}, {  888413410,  -603028289}, 
+	{  890029016,  -600641203}, {  889798608,  -600982481}, {  889568068,  -601323670}, {  889337398,  -601664771}, 
+	{  890949341,  -599275210}, {  890719456,  -599616840}, {  890489440,  -599958383}, {  890259294,  -600299837}, 
+	{  891867569,  -597907806}, {  891638208,  -598249789}, {  891408717,  -598591684}, {  891179094,  -598933491}, 
+	{  892783698,  -596538995}, {  892554863,  -596881330}, {  892325896,  -597223576}, {  892096798,  -597565735}, 
+	{  893697727,  -595168781}, {  893469417,  -595511466}, {  893240975,  -595854063}, {  893012402,  -596196573}, 
+	{  894609652,  -593797166}, {  894381868,  -594140201}, {  894153953,  -594483148}, {  893925905,  -594826008}, 
+	{  895519473,  -592424154}, {  895292215,  -592767538}, {  895064826,  -593110835}, {  894837305,  -593454044}, 
+	{  896427186,  -591049748}, {  896200456,  -591393480}, {  895973593,  -591737125}, {  895746599,  -592080683}, 
+	{  897332790,  -589673951}, {  897106587,  -590018030}, {  896880252,  -590362023}, {  896653785,  -590705929}, 
+	{  898236282,  -588296766}, {  898010607,  -588641192}, {  897784800,  -588985532}, {  897558861,  -589329785}, 
+	{  899137661,  -586918198}, {  898912515,  -587262969}, {  898687236,  -587607655}, {  898461825,  -587952254}, 
+	{  900036924,  -585538248}, {  899812307,  -585883365}, {  899587557,  -586228395}, {  899362675,  -586573340}, 
+	{  900934069,  -584156920}, {  900709982,  -584502381}, {  900485762,  -584847756}, {  900261409,  -585193045}, 
+	{  901829095,  -582774218}, {  901605537,  -583120022}, {  901381847,  -583465740}, {  901158025,  -583811373}, 
+	{  902721998,  -581390144}, {  902498971,  -581736291}, {  902275811,  -582082352}, {  902052519,  -582428328}, 
+	{  903612776,  -580004702}, {  903390281,  -580351191}, {  903167653,  -580697594}, {  902944892,  -581043912}, 
+	{  904501429,  -578617896}, {  904279465,  -578964725}, {  904057369,  -579311470}, {  903835139,  -579658129}, 
+	{  905387953,  -577229728}, {  905166522,  -577576897}, {  904944957,  -577923982}, {  904723260,  -578270981}, 
+	{  906272347,  -575840202}, {  906051448,  -576187710}, {  905830417,  -576535134}, {  905609251,  -576882473}, 
+	{  907154608,  -574449320}, {  906934243,  -574797167}, {  906713744,  -575144930}, {  906493112,  -575492608}, 
+	{  908034735,  -573057087}, {  907814903,  -573405272}, {  907594938,  -573753372}, {  907374840,  -574101389}, 
+	{  908912725,  -571663506}, {  908693428,  -572012027}, {  908473997,  -572360465}, {  908254433,  -572708818}, 
+	{  909788576,  -570268579}, {  909569814,  -570617437}, {  909350918,  -570966210}, {  909131888,  -571314900}, 
+	{  910662286,  -568872310}, {  910444059,  -569221503}, {  910225699,  -569570612}, {  910007204,  -569919637}, 
+	{  911533853,  -567474703}, {  911316163,  -567824230}, {  911098338,  -568173674}, {  910880379,  -568523034}, 
+	{  912403276,  -566075761}, {  912186121,  -566425621}, {  911968833,  -566775399}, {  911751410,  -567125093}, 
+	{  913270551,  -564675486}, {  913053934,  -565025679}, {  912837182,  -565375790}, {  912620296,  -565725817}, 
+	{  914135678,  -563273883}, {  913919598,  -563624408}, {  913703383,  -563974850}, {  913487035,  -564325210}, 
+	{  914998653,  -561870954}, {  914783111,  -562221810}, {  914567435,  -562572584}, {  914351624,  -562923275}, 
+	{  915859476,  -560466703}, {  915644472,  -560817890}, {  915429334,  -561168994}, {  915214061,  -561520015}, 
+	{  916718143,  -559061133}, {  916503678,  -559412649}, {  916289079,  -559764083}, {  916074345,  -560115434}, 
+	{  917574653,  -557654248}, {  917360728,  -558006093}, {  917146668,  -558357855}, {  916932473,  -558709535}, 
+	{  918429004,  -556246051}, {  918215619,  -556598223}, {  918002099,  -556950313}, {  917788443,  -557302322}, 
+	{  919281194,  -554836544}, {  919068349,  -555189044}, {  918855369,  -555541461}, {  918642254,  -555893797}, 
+	{  920131221,  -553425732}, {  919918917,  -553778558}, {  919706478,  -554131301}, {  919493904,  -554483964}, 
+	{  920979082,  -552013618}, {  920767320,  -552366769}, {  920555422,  -552719838}, {  920343389,  -553072826}, 
+	{  921824777,  -550600205}, {  921613556,  -550953680}, {  921402200,  -551307074}, {  921190709,  -551660387}, 
+	{  922668302,  -549185496}, {  922457624,  -549539295}, {  922246810,  -549893013}, {  922035861,  -550246649}, 
+	{  923509656,  -547769495}, {  923299521,  -548123617}, {  923089250,  -548477657}, {  922878844,  -548831617}, 
+	{  924348837,  -546352205}, {  924139246,  -546706649}, {  923929518,  -547061011}, {  923719655,  -547415294}, 
+	{  925185843,  -544933630}, {  924976795,  -545288394}, {  924767612,  -545643078}, {  924558292,  -545997682}, 
+	{  926020672,  -543513772}, {  925812169,  -543868856}, {  925603530,  -544223861}, {  925394754,  -544578785}, 
+	{  926853322,  -542092635}, {  926645363,  -542448039}, {  926437269,  -542803363}, {  926229039,  -543158607}, 
+	{  927683790,  -540670223}, {  927476378,  -541025945}, {  927268829,  -541381588}, {  927061143,  -541737151}, 
+	{  928512076,  -539246538}, {  928305210,  -539602578}, {  928098206,  -539958539}, {  927891067,  -540314421}, 
+	{  929338177,  -537821584}, {  929131857,  -538177942}, {  928925400,  -538534220}, {  928718807,  -538890418}, 
+	{  930162092,  -536395365}, {  929956318,  -536752038}, {  929750408,  -537108633}, {  929544361,  -537465148}, 
+	{  930983817,  -534967884}, {  930778591,  -535324872}, {  930573228,  -535681782}, {  930367728,  -536038613}, 
+	{  931803352,  -533539144}, {  931598674,  -533896447}, {  931393859,  -534253671}, {  931188906,  -534610817}, 
+	{  932620694,  -532109148}, {  932416564,  -532466765}, {  932212297,  -532824303}, {  932007893,  -533181762}, 
+	{  933435842,  -530677900}, {  933232261,  -531035830}, {  933028542,  -531393681}, {  932824687,  -531751453}, 
+	{  934248793,  -529245404}, {  934045761,  -529603645}, {  933842592,  -529961808}, {  933639286,  -530319893}, 
+	{  935059546,  -527811662}, {  934857064,  -528170214}, {  934654444,  -528528689}, {  934451687,  -528887085}, 
+	{  935868098,  -526376678}, {  935666166,  -526735541}, {  935464097,  -527094325}, {  935261890,  -527453033}, 
+	{  936674448,  -524940456}, {  936473067,  -525299627}, {  936271549,  -525658722}, {  936069892,  -526017739}, 
+	{  937478595,  -523502998}, {  937277765,  -523862478}, {  937076797,  -524221881}, {  936875692,  -524581207}, 
+	{  938280535,  -522064309}, {  938080257,  -522424096}, {  937879841,  -522783807}, {  937679287,  -523143441}, 
+	{  939080267,  -520624391}, {  938880541,  -520984485}, {  938680677,  -521344503}, {  938480675,  -521704444}, 
+	{  939877790,  -519183248}, {  939678616,  -519543648}, {  939479305,  -519903972}, {  939279855,  -520264220}, 
+	{  940673101,  -517740883}, {  940474481,  -518101588}, {  940275722,  -518462218}, {  940076825,  -518822771}, 
+	{  941466198,  -516297300}, {  941268132,  -516658310}, {  941069926,  -517019243}, {  940871583,  -517380101}, 
+	{  942257081,  -514852502}, {  942059568,  -515213815}, {  941861917,  -515575053}, {  941664127,  -515936214}, 
+	{  943045745,  -513406493}, {  942848787,  -513768108}, {  942651690,  -514129648}, {  942454455,  -514491113}, 
+	{  943832191,  -511959275}, {  943635788,  -512321192}, {  943439246,  -512683035}, {  943242565,  -513044801}, 
+	{  944616416,  -510510853}, {  944420568,  -510873071}, {  944224582,  -511235214}, {  944028456,  -511597282}, 
+	{  945398418,  -509061229}, {  945203126,  -509423748}, {  945007695,  -509786191}, {  944812125,  -510148559}, 
+	{  946178196,  -507610408}, {  945983460,  -507973225}, {  945788585,  -508335968}, {  945593571,  -508698636}, 
+	{  946955747,  -506158392}, {  946761568,  -506521508}, {  946567250,  -506884549}, {  946372792,  -507247516}, 
+	{  947731070,  -504705185}, {  947537448,  -505068598}, {  947343687,  -505431937}, {  947149787,  -505795202}, 
+	{  948504163,  -503250791}, {  948311099,  -503614500}, {  948117895,  -503978136}, {  947924552,  -504341698}, 
+	{  949275023,  -501795212}, {  949082517,  -502159217}, {  948889872,  -502523149}, {  948697087,  -502887007}, 
+	{  950043650,  -500338453}, {  949851703,  -500702753}, {  949659616,  -501066980}, {  949467390,  -501431133}, 
+	{  950810042,  -498880516}, {  950618654,  -499245110}, {  950427126,  -499609631}, {  950235458,  -499974079}, 
+	{  951574196,  -497421405}, {  951383367,  -497786293}, {  951192399,  -498151107}, {  951001290,  -498515848}, 
+	{  952336111,  -495961124}, {  952145842,  -496326304}, {  951955434,  -496691410}, {  951764885,  -497056444}, 
+	{  953095785,  -494499676}, {  952906077,  -494865147}, {  952716228,  -495230545}, {  952526240,  -495595871}, 
+	{  953853216,  -493037064}, {  953664069,  -493402826}, {  953474781,  -493768515}, {  953285353,  -494134132}, 
+	{  954608403,  -491573292}, {  954419817,  -491939343}, {  954231090,  -492305322}, {  954042224,  -492671229}, 
+	{  955361344,  -490108363}, {  955173319,  -490474703}, {  954985154,  -490840972}, {  954796849,  -491207168}, 
+	{  956112036,  -488642281}, {  955924574,  -489008909}, {  955736971,  -489375466}, {  955549228,  -489741950}, 
+	{  956860479,  -487175049}, {  956673579,  -487541965}, {  956486539,  -487908809}, {  956299358,  -488275581}, 
+	{  957606670,  -485706671}, {  957420333,  -486073873}, {  957233856,  -486441003}, {  957047238,  -486808062}, 
+	{  958350608,  -484237150}, {  958164835,  -484604637}, {  957978921,  -484972053}, {  957792866,  -485339398}, 
+	{  959092290,  -482766489}, {  958907081,  -483134261}, {  958721731,  -483501962}, {  958536240,  -483869591}, 
+	{  959831716,  -481294693}, {  959647071,  -481662748}, {  959462286,  -482030733}, {  959277359,  -482398646}, 
+	{  960568883,  -479821764}, {  960384803,  -480190102}, {  960200582,  -480558369}, {  960016220,  -480926566}, 
+	{  961303790,  -478347705}, {  961120276,  -478716326}, {  960936620,  -479084875}, {  960752822,  -479453355}, 
+	{  962036435,  -476872522}, {  961853486,  -477241423}, {  961670396,  -477610254}, {  961487164,  -477979015}, 
+	{  962766816,  -475396216}, {  962584433,  -475765397}, {  962401909,  -476134509}, {  962219243,  -476503550}, 
+	{  963494932,  -473918791}, {  963313116,  -474288252}, {  963131157,  -474657643}, {  962949058,  -475026964}, 
+	{  964220780,  -472440251}, {  964039531,  -472809991}, {  963858140,  -473179660}, {  963676607,  -473549261}, 
+	{  964944360,  -470960600}, {  964763678,  -471330617}, {  964582854,  -471700564}, {  964401888,  -472070443}, 
+	{  965665669,  -469479840}, {  965485555,  -469850134}, {  965305298,  -470220358}, {  965124900,  -470590514}, 
+	{  966384706,  -467997976}, {  966205159,  -468368545}, {  966025471,  -468739046}, {  965845641,  -469109478}, 
+	{  967101468,  -466515010}, {  966922491,  -466885855}, {  966743371,  -467256631}, {  966564109,  -467627338}, 
+	{  967815955,  -465030947}, {  967637547,  -465402066}, {  967458996,  -465773116}, {  967280303,  -466144097}, 
+	{  968528165,  -463545789}, {  968350326,  -463917181}, {  968172345,  -464288505}, {  967994221,  -464659760}, 
+	{  969238095,  -462059541}, {  969060826,  -462431205}, {  968883415,  -462802801}, {  968705861,  -463174329}, 
+	{  969945745,  -460572205}, {  969769046,  -460944141}, {  969592205,  -461316009}, {  969415222,  -461687809}, 
+	{  970651112,  -459083786}, {  970474985,  -459455992}, {  970298714,  -459828131}, {  970122301,  -460200202}, 
+	{  971354196,  -457594286}, {  971178639,  -457966762}, {  971002940,  -458339171}, {  970827098,  -458711512}, 
+	{  972054994,  -456103710}, {  971880009,  -456476455}, {  971704881,  -456849132}, {  971529610,  -457221743}, 
+	{  972753504,  -454612060}, {  972579091,  -454985073}, {  972404535,  -455358019}, {  972229836,  -455730898}, 
+	{  973449725,  -453119340}, {  973275885,  -453492620}, {  973101901,  -453865834}, {  972927774,  -454238980}, 
+	{  974143656,  -451625555}, {  973970388,  -451999101}, {  973796977,  -452372581}, {  973623423,  -452745994}, 
+	{  974835295,  -450130706}, {  974662600,  -450504518}, {  974489762,  -450878263}, {  974316781,  -451251942}, 
+	{  975524639,  -448634799}, {  975352518,  -449008875}, {  975180254,  -449382885}, {  975007846,  -449756829}, 
+	{  976211688,  -447137835}, {  976040141,  -447512175}, {  975868451,  -447886449}, {  975696617,  -448260657}, 
+	{  976896441,  -445639820}, {  976725468,  -446014422}, {  976554352,  -446388959}, {  976383092,  -446763430}, 
+	{  977578894,  -444140756}, {  977408496,  -444515620}, {  977237955,  -444890419}, {  977067269,  -445265152}, 
+	{  978259047,  -442640647}, {  978089224,  -443015772}, {  977919258,  -443390832}, {  977749148,  -443765826}, 
+	{  978936898,  -441139496}, {  978767651,  -441514881}, {  978598260,  -441890201}, {  978428725,  -442265456}, 
+	{  979612445,  -439637307}, {  979443774,  -440012951}, {  979274960,  -440388531}, {  979106001,  -440764046}, 
+	{  980285688,  -438134084}, {  980117593,  -438509986}, {  979949355,  -438885824}, {  979780972,  -439261598}, 
+	{  980956623,  -436629829}, {  980789106,  -437005989}, {  980621444,  -437382085}, {  980453638,  -437758117}, 
+	{  981625251,  -435124548}, {  981458310,  -435500964}, {  981291226,  -435877317}, {  981123997,  -436253605}, 
+	{  982291568,  -433618242}, {  982125205,  -433994914}, {  981958698,  -434371523}, {  981792047,  -434748067}, 
+	{  982955574,  -432110916}, {  982789789,  -432487843}, {  982623860,  -432864706}, {  982457786,  -433241506}, 
+	{  983617267,  -430602573}, {  983452061,  -430979754}, {  983286710,  -431356872}, {  983121214,  -431733926}, 
+	{  984276646,  -429093217}, {  984112018,  -429470651}, {  983947246,  -429848022}, {  983782329,  -430225329}, 
+	{  984933708,  -427582852}, {  984769660,  -427960537}, {  984605467,  -428338160}, {  984441129,  -428715720}, 
+	{  985588453,  -426071480}, {  985424984,  -426449417}, {  985261370,  -426827291}, {  985097612,  -427205103}, 
+	{  986240879,  -424559105}, {  986077990,  -424937293}, {  985914956,  -425315418}, {  985751777,  -425693480}, 
+	{  986890984,  -423045732}, {  986728675,  -423424169}, {  986566221,  -423802543}, {  986403623,  -424180855}, 
+	{  987538766,  -421531363}, {  987377038,  -421910048}, {  987215165,  -422288671}, {  987053147,  -422667233}, 
+	{  988184225,  -420016002}, {  988023078,  -420394935}, {  987861786,  -420773806}, {  987700349,  -421152615}, 
+	{  988827359,  -418499653}, {  988666793,  -418878833}, {  988506083,  -419257951}, {  988345227,  -419637007}, 
+	{  989468165,  -416982319}, {  989308182,  -417361744}, {  989148053,  -417741109}, {  988987779,  -418120411}, 
+	{  990106644,  -415464004}, {  989947243,  -415843674}, {  989787696,  -416223284}, {  989628003,  -416602832}, 
+	{  990742793,  -413944711}, {  990583974,  -414324625}, {  990425010,  -414704479}, {  990265900,  -415084272}, 
+	{  991376610,  -412424444}, {  991218374,  -412804602}, {  991059993,  -413184699}, {  990901465,  -413564735}, 
+	{  992008094,  -410903207}, {  991850442,  -411283607}, {  991692644,  -411663946}, {  991534700,  -412044226}, 
+	{  992637245,  -409381002}, {  992480176,  -409761644}, {  992322961,  -410142225}, {  992165601,  -410522746}, 
+	{  993264059,  -407857835}, {  993107575,  -408238717}, {  992950944,  -408619539}, {  992794167,  -409000301}, 
+	{  993888536,  -406333708}, {  993732636,  -406714829}, {  993576590,  -407095891}, {  993420398,  -407476893}, 
+	{  994510675,  -404808624}, {  994355360,  -405189985}, {  994199898,  -405571285}, {  994044290,  -405952526}, 
+	{  995130473,  -403282588}, {  994975743,  -403664186}, {  994820867,  -404045725}, {  994665844,  -404427204}, 
+	{  995747930,  -401755603}, {  995593785,  -402137438}, {  995439494,  -402519214}, {  995285057,  -402900931}, 
+	{  996363043,  -400227673}, {  996209485,  -400609744}, {  996055780,  -400991756}, {  995901928,  -401373709}, 
+	{  996975812,  -398698801}, {  996822840,  -399081107}, {  996669721,  -399463355}, {  996516456,  -399845543}, 
+	{  997586236,  -397168991}, {  997433850,  -397551531}, {  997281317,  -397934013}, {  997128638,  -398316436}, 
+	{  998194311,  -395638246}, {  998042512,  -396021020}, {  997890567,  -396403735}, {  997738475,  -396786392}, 
+	{  998800038,  -394106570}, {  998648827,  -394489576}, {  998497468,  -394872524}, {  998345963,  -395255414}, 
+	{  999403415,  -392573967}, {  999252791,  -392957205}, {  999102020,  -393340384}, {  998951103,  -393723506}, 
+	{ 1000004439,  -391040440}, {  999854404,  -391423908}, {  999704221,  -391807319}, {  999553891,  -392190672}, 
+	{ 1000603111,  -389505993}, { 1000453664,  -389889691}, { 1000304069,  -390273331}, { 1000154328,  -390656915}, 
+	{ 1001199428,  -387970630}, { 1001050570,  -388354556}, { 1000901564,  -388738426}, { 1000752411,  -389122238}, 
+	{ 1001793390,  -386434353}, { 1001645120,  -386818508}, { 1001496704,  -387202605}, { 1001348140,  -387586646}, 
+	{ 1002384994,  -384897167}, { 1002237314,  -385281549}, { 1002089486,  -385665873}, { 1001941512,  -386050142}, 
+	{ 1002974239,  -383359076}, { 1002827149,  -383743683}, { 1002679911,  -384128234}, { 1002532526,  -384512729}, 
+	{ 1003561124,  -381820082}, { 1003414624,  -382204915}, { 1003267977,  -382589691}, { 1003121181,  -382974412}, 
+	{ 1004145648,  -380280190}, { 1003999738,  -380665247}, { 1003853681,  -381050248}, { 1003707476,  -381435193}, 
+	{ 1004727809,  -378739403}, { 1004582490,  -379124683}, { 1004437024,  -379509908}, { 1004291410,  -379895077}, 
+	{ 1005307605,  -377197725}, { 1005162878,  -377583228}, { 1005018003,  -377968675}, { 1004872979,  -378354067}, 
+	{ 1005885036,  -375655159}, { 1005740900,  -376040883}, { 1005596617,  -376426553}, { 1005452185,  -376812166}, 
+	{ 1006460100,  -374111709}, { 1006316556,  -374497654}, { 1006172864,  -374883544}, { 1006029024,  -375269379}, 
+	{ 1007032796,  -372567379}, { 1006889844,  -372953544}, { 1006746744,  -373339654}, { 1006603496,  -373725709}, 
+	{ 1007603122,  -371022173}, { 1007460763,  -371408556}, { 1007318256,  -371794885}, { 1007175600,  -372181160}, 
+	{ 1008171077,  -369476093}, { 1008029311,  -369862694}, { 1007887396,  -370249242}, { 1007745333,  -370635734}, 
+	{ 1008736660,  -367929144}, { 1008595487,  -368315962}, { 1008454166,  -368702727}, { 1008312696,  -369089437}, 
+	{ 1009299870,  -366381329}, { 1009159290,  -366768363}, { 1009018562,  -367155344}, { 1008877685,  -367542271}, 
+	{ 1009860704,  -364832652}, { 1009720718,  -365219902}, { 1009580584,  -365607098}, { 1009440301,  -365994240}, 
+	{ 1010419162,  -363283116}, { 1010279770,  -363670580}, { 1010140230,  -364057991}, { 1010000541,  -364445348}, 
+	{ 1010975242,  -361732726}, { 1010836445,  -362120403}, { 1010697499,  -362508027}, { 1010558405,  -362895598}, 
+	{ 1011528943,  -360181484}, { 1011390741,  -360569374}, { 1011252390,  -360957211}, { 1011113890,  -361344995}, 
+	{ 1012080264,  -358629395}, { 1011942657,  -359017496}, { 1011804901,  -359405545}, { 1011666997,  -359793541}, 
+	{ 1012629204,  -357076462}, { 1012492193,  -357464774}, { 1012355032,  -357853034}, { 1012217723,  -358241241}, 
+	{ 1013175761,  -355522689}, { 1013039345,  -355911211}, { 1012902780,  -356299680}, { 1012766067,  -356688097}, 
+	{ 1013719934,  -353968079}, { 1013584114,  -354356810}, { 1013448145,  -354745488}, { 1013312028,  -355134115}, 
+	{ 1014261721,  -352412636}, { 1014126498,  -352801575}, { 1013991126,  -353190461}, { 1013855604,  -353579296}, 
+	{ 1014801122,  -350856364}, { 1014666495,  -351245510}, { 1014531720,  -351634604}, { 1014396795,  -352023646}, 
+	{ 1015338134,  -349299266}, { 1015204105,  -349688618}, { 1015069927,  -350077918}, { 1014935599,  -350467167}, 
+	{ 1015872758,  -347741347}, { 1015739326,  -348130904}, { 1015605745,  -348520409}, { 1015472014,  -348909863}, 
+	{ 1016404991,  -346182609}, { 1016272157,  -346572370}, { 1016139173,  -346962080}, { 1016006040,  -347351739}, 
+	{ 1016934832,  -344623057}, { 1016802596,  -345013021}, { 1016670211,  -345402934}, { 1016537676,  -345792797}, 
+	{ 1017462281,  -343062693}, { 1017330643,  -343452860}, { 1017198856,  -343842976}, { 1017066919,  -344233042}, 
+	{ 1017987335,  -341501523}, { 1017856296,  -341891891}, { 1017725107,  -342282209}, { 1017593769,  -342672476}, 
+	{ 1018509994,  -339939549}, { 1018379554,  -340330117}, { 1018248964,  -340720636}, { 1018118225,  -341111104}, 
+	{ 1019030256,  -338376774}, { 1018900415,  -338767543}, { 1018770425,  -339158261}, { 1018640284,  -339548930}, 
+	{ 1019548121,  -336813204}, { 1019418879,  -337204171}, { 1019289488,  -337595089}, { 1019159947,  -337985956}, 
+	{ 1020063586,  -335248841}, { 1019934944,  -335640006}, { 1019806153,  -336031121}, { 1019677212,  -336422188}, 
+	{ 1020576651,  -333683689}, { 1020448610,  -334075051}, { 1020320418,  -334466364}, { 1020192077,  -334857627}, 
+	{ 1021087314,  -332117752}, { 1020959873,  -332509310}, { 1020832283,  -332900819}, { 1020704542,  -333292279}, 
+	{ 1021595575,  -330551034}, { 1021468735,  -330942787}, { 1021341745,  -331334491}, { 1021214605,  -331726146}, 
+	{ 1022101432,  -328983538}, { 1021975193,  -329375485}, { 1021848804,  -329767383}, { 1021722264,  -330159233}, 
+	{ 1022604883,  -327415267}, { 1022479246,  -327807407}, { 1022353458,  -328199499}, { 1022227520,  -328591543}, 
+	{ 1023105929,  -325846226}, { 1022980893,  -326238559}, { 1022855707,  -326630843}, { 1022730370,  -327023079}, 
+	{ 1023604567,  -324276419}, { 1023480133,  -324668942}, { 1023355549,  -325061418}, { 1023230814,  -325453846}, 
+	{ 1024100796,  -322705848}, { 1023976964,  -323098562}, { 1023852982,  -323491229}, { 1023728850,  -323883848}, 
+	{ 1024594615,  -321134518}, { 1024471386,  -321527422}, { 1024348007,  -321920278}, { 1024224477,  -322313087}, 
+	{ 1025086024,  -319562433}, { 1024963398,  -319955525}, { 1024840621,  -320348570}, { 1024717694,  -320741568}, 
+	{ 1025575020,  -317989595}, { 1025452997,  -318382875}, { 1025330824,  -318776108}, { 1025208499,  -319169293}, 
+	{ 1026061603,  -316416009}, { 1025940184,  -316809475}, { 1025818614,  -317202895}, { 1025696892,  -317596268}, 
+	{ 1026545772,  -314841679}, { 1026424956,  -315235331}, { 1026303990,  -315628937}, { 1026182872,  -316022496}, 
+	{ 1027027525,  -313266607}, { 1026907313,  -313660444}, { 1026786951,  -314054235}, { 1026666437,  -314447980}, 
+	{ 1027506862,  -311690799}, { 1027387254,  -312084820}, { 1027267495,  -312478795}, { 1027147586,  -312872724}, 
+	{ 1027983780,  -310114257}, { 1027864777,  -310508461}, { 1027745623,  -310902619}, { 1027626318,  -311296732}, 
+	{ 1028458280,  -308536985}, { 1028339882,  -308931371}, { 1028221332,  -309325712}, { 1028102632,  -309720007}, 
+	{ 1028930359,  -306958988}, { 1028812566,  -307353555}, { 1028694622,  -307748077}, { 1028576527,  -308142554}, 
+	{ 1029400018,  -305380268}, { 1029282830,  -305775015}, { 1029165491,  -306169718}, { 1029048001,  -306564375}, 
+	{ 1029867254,  -303800829}, { 1029750672,  -304195756}, { 1029633939,  -304590638}, { 1029517054,  -304985475}, 
+	{ 1030332067,  -302220676}, { 1030216091,  -302615781}, { 1030099963,  -303010842}, { 1029983684,  -303405858}, 
+	{ 1030794455,  -300639811}, { 1030679085,  -301035094}, { 1030563564,  -301430332}, { 1030447891,  -301825526}, 
+	{ 1031254418,  -299058239}, { 1031139655,  -299453698}, { 1031024740,  -299849113}, { 1030909673,  -300244484}, 
+	{ 1031711954,  -297475964}, { 1031597797,  -297871598}, { 1031483489,  -298267189}, { 1031369029,  -298662736}, 
+	{ 1032167062,  -295892988}, { 1032053513,  -296288797}, { 1031939812,  -296684563}, { 1031825959,  -297080285}, 
+	{ 1032619742,  -294309316}, { 1032506800,  -294705299}, { 1032393706,  -295101239}, { 1032280460,  -295497135}, 
+	{ 1033069992,  -292724951}, { 1032957657,  -293121107}, { 1032845170,  -293517220}, { 1032732532,  -293913290}, 
+	{ 1033517810,  -291139898}, { 1033406084,  -291536226}, { 1033294205,  -291932511}, { 1033182174,  -292328753}, 
+	{ 1033963197,  -289554160}, { 1033852079,  -289950658}, { 1033740808,  -290347114}, { 1033629385,  -290743528}, 
+	{ 1034406151,  -287967740}, { 1034295641,  -288364409}, { 1034184978,  -288761035}, { 1034074164,  -289157619}, 
+	{ 1034846671,  -286380643}, { 1034736769,  -286777480}, { 1034626715,  -287174276}, { 1034516509,  -287571029}, 
+	{ 1035284755,  -284792871}, { 1035175463,  -285189877}, { 1035066018,  -285586841}, { 1034956420,  -285983763}, 
+	{ 1035720404,  -283204430}, { 1035611720,  -283601603}, { 1035502884,  -283998734}, { 1035393896,  -284395824}, 
+	{ 1036153615,  -281615322}, { 1036045541,  -282012662}, { 1035937314,  -282409959}, { 1035828935,  -282807215}, 
+	{ 1036584389,  -280025552}, { 1036476924,  -280423056}, { 1036369307,  -280820520}, { 1036261537,  -281217942}, 
+	{ 1037012723,  -278435122}, { 1036905868,  -278832791}, { 1036798861,  -279230419}, { 1036691701,  -279628006}, 
+	{ 1037438617,  -276844038}, { 1037332372,  -277241870}, { 1037225975,  -277639662}, { 1037119425,  -278037413}, 
+	{ 1037862069,  -275252302}, { 1037756435,  -275650297}, { 1037650648,  -276048251}, { 1037544709,  -276446165}, 
+	{ 1038283080,  -273659918}, { 1038178056,  -274058075}, { 1038072880,  -274456191}, { 1037967551,  -274854267}, 
+	{ 1038701647,  -272066891}, { 1038597234,  -272465208}, { 1038492669,  -272863485}, { 1038387951,  -273261722}, 
+	{ 1039117770,  -270473223}, { 1039013969,  -270871700}, { 1038910014,  -271270136}, { 1038805907,  -271668533}, 
+	{ 1039531448,  -268878918}, { 1039428258,  -269277554}, { 1039324915,  -269676150}, { 1039221419,  -270074706}, 
+	{ 1039942680,  -267283981}, { 1039840101,  -267682775}, { 1039737370,  -268081529}, { 1039634486,  -268480243}, 
+	{ 1040351465,  -265688415}, { 1040249498,  -266087366}, { 1040147378,  -266486277}, { 1040045106,  -266885149}, 
+	{ 1040757802,  -264092224}, { 1040656447,  -264491331}, { 1040554939,  -264890398}, { 1040453279,  -265289426}, 
+	{ 1041161689,  -262495412}, { 1041060947,  -262894673}, { 1040960052,  -263293896}, { 1040859003,  -263693079}, 
+	{ 1041563127,  -260897982}, { 1041462997,  -261297397}, { 1041362715,  -261696774}, { 1041262279,  -262096112}, 
+	{ 1041962114,  -259299937}, { 1041862597,  -259699506}, { 1041762927,  -260099036}, { 1041663104,  -260498528}, 
+	{ 1042358649,  -257701283}, { 1042259745,  -258101004}, { 1042160688,  -258500686}, { 1042061478,  -258900331}, 
+	{ 1042752731,  -256102022}, { 1042654441,  -256501894}, { 1042555997,  -256901728}, { 1042457400,  -257301525}, 
+	{ 1043144360,  -254502159}, { 1043046683,  -254902181}, { 1042948852,  -255302166}, { 1042850869,  -255702113}, 
+	{ 1043533534,  -252901697}, { 1043436471,  -253301868}, { 1043339254,  -253702003}, { 1043241884,  -254102099}, 
+	{ 1043920252,  -251300640}, { 1043823803,  -251700959}, { 1043727200,  -252101242}, { 1043630444,  -252501488}, 
+	{ 1044304514,  -249698991}, { 1044208679,  -250099458}, { 1044112690,  -250499889}, { 1044016548,  -250900283}, 
+	{ 1044686319,  -248096755}, { 1044591098,  -248497369}, { 1044495724,  -248897946}, { 1044400196,  -249298487}, 
+	{ 1045065665,  -246493935}, { 1044971059,  -246894694}, { 1044876299,  -247295417}, { 1044781386,  -247696104}, 
+	{ 1045442553,  -244890535}, { 1045348561,  -245291439}, { 1045254416,  -245692307}, { 1045160118,  -246093139}, 
+	{ 1045816980,  -243286558}, { 1045723604,  -243687606}, { 1045630074,  -244088618}, { 1045536390,  -244489594}, 
+	{ 1046188946,  -241682010}, { 1046096185,  -242083200}, { 1046003271,  -242484355}, { 1045910202,  -242885475}, 
+	{ 1046558451,  -240076892}, { 1046466305,  -240478225}, { 1046374006,  -240879522}, { 1046281553,  -241280783}, 
+	{ 1046925492,  -238471210}, { 1046833963,  -238872683}, { 1046742279,  -239274121}, { 1046650442,  -239675524}, 
+	{ 1047290071,  -236864966}, { 1047199157,  -237266579}, { 1047108090,  -237668158}, { 1047016868,  -238069701}, 
+	{ 1047652185,  -235258165}, { 1047561887,  -235659918}, { 1047471436,  -236061635}, { 1047380830,  -236463318}, 
+	{ 1048011834,  -233650811}, { 1047922153,  -234052701}, { 1047832317,  -234454557}, { 1047742328,  -234856378}, 
+	{ 1048369016,  -232042906}, { 1048279952,  -232444934}, { 1048190733,  -232846927}, { 1048101360,  -233248886}, 
+	{ 1048723732,  -230434456}, { 1048635284,  -230836620}, { 1048546683,  -231238749}, { 1048457926,  -231640845}, 
+	{ 1049075980,  -228825464}, { 1048988149,  -229227762}, { 1048900165,  -229630027}, { 1048812025,  -230032259}, 
+	{ 1049425759,  -227215933}, { 1049338546,  -227618366}, { 1049251178,  -228020765}, { 1049163656,  -228423131}, 
+	{ 1049773069,  -225605867}, { 1049686474,  -226008433}, { 1049599723,  -226410966}, { 1049512818,  -226813466}, 
+	{ 1050117909,  -223995270}, { 1050031931,  -224397969}, { 1049945798,  -224800635}, { 1049859511,  -225203267}, 
+	{ 1050460278,  -222384147}, { 1050374918,  -222786977}, { 1050289403,  -223189774}, { 1050203733,  -223592539}, 
+	{ 1050800175,  -220772500}, { 1050715433,  -221175461}, { 1050630536,  -221578389}, { 1050545484,  -221981284}, 
+	{ 1051137599,  -219160334}, { 1051053475,  -219563424}, { 1050969196,  -219966481}, { 1050884763,  -220369507}, 
+	{ 1051472550,  -217547651}, { 1051389044,  -217950870}, { 1051305384,  -218354057}, { 1051221569,  -218757211}, 
+	{ 1051805027,  -215934457}, { 1051722140,  -216337804}, { 1051639098,  -216741118}, { 1051555901,  -217144401}, 
+	{ 1052135029,  -214320755}, { 1052052760,  -214724228}, { 1051970337,  -215127670}, { 1051887759,  -215531079}, 
+	{ 1052462555,  -212706549}, { 1052380905,  -213110148}, { 1052299101,  -213513715}, { 1052217142,  -213917251}, 
+	{ 1052787604,  -211091842}, { 1052706574,  -211495565}, { 1052625389,  -211899258}, { 1052544049,  -212302919}, 
+	{ 1053110176,  -209476638}, { 1053029765,  -209880485}, { 1052949200,  -210284302}, { 1052868479,  -210688087}, 
+	{ 1053430270,  -207860942}, { 1053350479,  -208264912}, { 1053270533,  -208668851}, { 1053190432,  -209072760}, 
+	{ 1053747885,  -206244756}, { 1053668714,  -206648848}, { 1053589387,  -207052910}, { 1053509906,  -207456941}, 
+	{ 1054063021,  -204628085}, { 1053984469,  -205032298}, { 1053905763,  -205436481}, { 1053826901,  -205840633}, 
+	{ 1054375676,  -203010932}, { 1054297745,  -203415265}, { 1054219658,  -203819569}, { 1054141417,  -204223842}, 
+	{ 1054685850,  -201393302}, { 1054608539,  -201797754}, { 1054531073,  -202202177}, { 1054453452,  -202606569}, 
+	{ 1054993543,  -199775198}, { 1054916852,  -200179768}, { 1054840007,  -200584309}, { 1054763006,  -200988820}, 
+	{ 1055298753,  -198156624}, { 1055222683,  -198561311}, { 1055146458,  -198965969}, { 1055070078,  -199370598}, 
+	{ 1055601479,  -196537583}, { 1055526030,  -196942387}, { 1055450426,  -197347161}, { 1055374667,  -197751907}, 
+	{ 1055901722,  -194918080}, { 1055826894,  -195322999}, { 1055751911,  -195727889}, { 1055676773,  -196132751}, 
+	{ 1056199480,  -193298119}, { 1056125274,  -193703152}, { 1056050912,  -194108156}, { 1055976395,  -194513133}, 
+	{ 1056494753,  -191677702}, { 1056421168,  -192082849}, { 1056347427,  -192487967}, { 1056273531,  -192893057}, 
+	{ 1056787540,  -190056834}, { 1056714576,  -190462093}, { 1056641457,  -190867324}, { 1056568183,  -191272527}, 
+	{ 1057077840,  -188435520}, { 1057005498,  -188840890}, { 1056933001,  -189246233}, { 1056860348,  -189651548}, 
+	{ 1057365653,  -186813762}, { 1057293933,  -187219242}, { 1057222057,  -187624696}, { 1057150026,  -188030122}, 
+	{ 1057650977,  -185191564}, { 1057579879,  -185597154}, { 1057508626,  -186002717}, { 1057437217,  -186408253}, 
+	{ 1057933813,  -183568930}, { 1057863337,  -183974629}, { 1057792706,  -184380301}, { 1057721919,  -184785946}, 
+	{ 1058214159,  -181945865}, { 1058144306,  -182351671}, { 1058074297,  -182757451}, { 1058004133,  -183163204}, 
+	{ 1058492016,  -180322371}, { 1058422785,  -180728284}, { 1058353399,  -181134171}, { 1058283857,  -181540031}, 
+	{ 1058767381,  -178698453}, { 1058698773,  -179104472}, { 1058630010,  -179510465}, { 1058561091,  -179916431}, 
+	{ 1059040255,  -177074115}, { 1058972270,  -177480239}, { 1058904130,  -177886336}, { 1058835833,  -178292408}, 
+	{ 1059310638,  -175449360}, { 1059243276,  -175855587}, { 1059175758,  -176261789}, { 1059108085,  -176667965}, 
+	{ 1059578527,  -173824192}, { 1059511788,  -174230522}, { 1059444894,  -174636827}, { 1059377844,  -175043106}, 
+	{ 1059843923,  -172198615}, { 1059777808,  -172605047}, { 1059711537,  -173011454}, { 1059645110,  -173417836}, 
+	{ 1060106826,  -170572633}, { 1060041334,  -170979166}, { 1059975686,  -171385674}, { 1059909883,  -171792157}, 
+	{ 1060367233,  -168946249}, { 1060302365,  -169352882}, { 1060237341,  -169759491}, { 1060172161,  -170166074}, 
+	{ 1060625146,  -167319468}, { 1060560902,  -167726200}, { 1060496502,  -168132908}, { 1060431945,  -168539591}, 
+	{ 1060880563,  -165692293}, { 1060816943,  -166099124}, { 1060753166,  -166505929}, { 1060689234,  -166912711}, 
+	{ 1061133483,  -164064728}, { 1061070487,  -164471656}, { 1061007335,  -164878559}, { 1060944027,  -165285438}, 
+	{ 1061383907,  -162436778}, { 1061321535,  -162843801}, { 1061259007,  -163250801}, { 1061196323,  -163657777}, 
+	{ 1061631833,  -160808445}, { 1061570086,  -161215564}, { 1061508182,  -161622659}, { 1061446123,  -162029730}, 
+	{ 1061877261,  -159179733}, { 1061816138,  -159586946}, { 1061754859,  -159994136}, { 1061693424,  -160401302}, 
+	{ 1062120190,  -157550647}, { 1062059692,  -157957954}, { 1061999038,  -158365237}, { 1061938227,  -158772497}, 
+	{ 1062360620,  -155921191}, { 1062300747,  -156328589}, { 1062240717,  -156735965}, { 1062180532,  -157143318}, 
+	{ 1062598550,  -154291367}, { 1062539302,  -154698857}, { 1062479898,  -155106324}, { 1062420337,  -155513769}, 
+	{ 1062833980,  -152661180}, { 1062775357,  -153068761}, { 1062716578,  -153476319}, { 1062657642,  -153883854}, 
+	{ 1063066909,  -151030634}, { 1063008911,  -151438304}, { 1062950757,  -151845952}, { 1062892446,  -152253577}, 
+	{ 1063297336,  -149399733}, { 1063239964,  -149807492}, { 1063182435,  -150215228}, { 1063124750,  -150622942}, 
+	{ 1063525261,  -147768480}, { 1063468514,  -148176326}, { 1063411611,  -148584150}, { 1063354552,  -148991953}, 
+	{ 1063750684,  -146136880}, { 1063694563,  -146544812}, { 1063638285,  -146952723}, { 1063581851,  -147360613}, 
+	{ 1063973603,  -144504935}, { 1063918108,  -144912954}, { 1063862456,  -145320950}, { 1063806648,  -145728926}, 
+	{ 1064194019,  -142872651}, { 1064139150,  -143280754}, { 1064084124,  -143688835}, { 1064028942,  -144096896}, 
+	{ 1064411931,  -141240030}, { 1064357688,  -141648217}, { 1064303288,  -142056382}, { 1064248732,  -142464527}, 
+	{ 1064627338,  -139607077}, { 1064573721,  -140015347}, { 1064519947,  -140423595}, { 1064466017,  -140831823}, 
+	{ 1064840240,  -137973796}, { 1064787249,  -138382147}, { 1064734102,  -138790477}, { 1064680798,  -139198788}, 
+	{ 1065050636,  -136340190}, { 1064998272,  -136748621}, { 1064945751,  -137157033}, { 1064893074,  -137565425}, 
+	{ 1065258526,  -134706263}, { 1065206789,  -135114774}, { 1065154894,  -135523266}, { 1065102844,  -135931738}, 
+	{ 1065463909,  -133072019}, { 1065412799,  -133480609}, { 1065361531,  -133889180}, { 1065310107,  -134297731}, 
+	{ 1065666786,  -131437462}, { 1065616302,  -131846130}, { 1065565661,  -132254779}, { 1065514864,  -132663409}, 
+	{ 1065867154,  -129802595}, { 1065817297,  -130211341}, { 1065767284,  -130620067}, { 1065717113,  -131028774}, 
+	{ 1066065015,  -128167423}, { 1066015785,  -128576245}, { 1065966398,  -128985047}, { 1065916855,  -129393831}, 
+	{ 1066260367,  -126531950}, { 1066211764,  -126940846}, { 1066163005,  -127349724}, { 1066114088,  -127758583}, 
+	{ 1066453210,  -124896179}, { 1066405234,  -125305149}, { 1066357102,  -125714101}, { 1066308813,  -126123035}, 
+	{ 1066643544,  -123260114}, { 1066596195,  -123669157}, { 1066548690,  -124078183}, { 1066501029,  -124487190}, 
+	{ 1066831367,  -121623759}, { 1066784647,  -122032875}, { 1066737769,  -122441972}, { 1066690735,  -122851052}, 
+	{ 1067016680,  -119987118}, { 1066970587,  -120396304}, { 1066924338,  -120805474}, { 1066877931,  -121214625}, 
+	{ 1067199483,  -118350194}, { 1067154018,  -118759451}, { 1067108396,  -119168691}, { 1067062616,  -119577913}, 
+	{ 1067379774,  -116712992}, { 1067334937,  -117122318}, { 1067289942,  -117531627}, { 1067244791,  -117940919}, 
+	{ 1067557554,  -115075515}, { 1067513344,  -115484910}, { 1067468978,  -115894288}, { 1067424454,  -116303648}, 
+	{ 1067732821,  -113437768}, { 1067689240,  -113847230}, { 1067645501,  -114256675}, { 1067601606,  -114666103}, 
+	{ 1067905576,  -111799753}, { 1067862623,  -112209281}, { 1067819513,  -112618793}, { 1067776246,  -113028289}, 
+	{ 1068075818,  -110161476}, { 1068033493,  -110571069}, { 1067991011,  -110980647}, { 1067948372,  -111390208}, 
+	{ 1068243547,  -108522939}, { 1068201851,  -108932597}, { 1068159997,  -109342239}, { 1068117986,  -109751866}, 
+	{ 1068408763,  -106884147}, { 1068367694,  -107293868}, { 1068326469,  -107703574}, { 1068285087,  -108113265}, 
+	{ 1068571464,  -105245103}, { 1068531024,  -105654887}, { 1068490427,  -106064656}, { 1068449673,  -106474409}, 
+	{ 1068731650,  -103605812}, { 1068691839,  -104015658}, { 1068651871,  -104425488}, { 1068611746,  -104835303}, 
+	{ 1068889322,  -101966277}, { 1068850140,  -102376183}, { 1068810801,  -102786074}, { 1068771304,  -103195951}, 
+	{ 1069044479,  -100326502}, { 1069005925,  -100736468}, { 1068967215,  -101146419}, { 1068928347,  -101556355}, 
+	{ 1069197120,   -98686491}, { 1069159195,   -99096515}, { 1069121114,   -99506525}, { 1069082875,   -99916521}, 
+	{ 1069347245,   -97046247}, { 1069309950,   -97456330}, { 1069272497,   -97866398}, { 1069234887,   -98276451}, 
+	{ 1069494854,   -95405776}, { 1069458188,   -95815915}, { 1069421364,   -96226040}, { 1069384383,   -96636151}, 
+	{ 1069639946,   -93765079}, { 1069603909,   -94175274}, { 1069567715,   -94585455}, { 1069531363,   -94995622}, 
+	{ 1069782521,   -92124163}, { 1069747114,   -92534412}, { 1069711548,   -92944648}, { 1069675826,   -93354871}, 
+	{ 1069922579,   -90483029}, { 1069887801,   -90893333}, { 1069852865,   -91303623}, { 1069817772,   -91713899}, 
+	{ 1070060120,   -88841683}, { 1070025971,   -89252039}, { 1069991664,   -89662382}, { 1069957201,   -90072712}, 
+	{ 1070195142,   -87200127}, { 1070161623,   -87610535}, { 1070127946,   -88020931}, { 1070094111,   -88431313}, 
+	{ 1070327646,   -85558366}, { 1070294756,   -85968825}, { 1070261709,   -86379272}, { 1070228504,   -86789706}, 
+	{ 1070457632,   -83916404}, { 1070425372,   -84326913}, { 1070392954,   -84737410}, { 1070360379,   -85147894}, 
+	{ 1070585099,   -82274245}, { 1070553468,   -82684803}, { 1070521680,   -83095349}, { 1070489735,   -83505883}, 
+	{ 1070710046,   -80631892}, { 1070679045,   -81042498}, { 1070647887,   -81453092}, { 1070616572,   -81863674}, 
+	{ 1070832474,   -78989349}, { 1070802103,   -79400002}, { 1070771575,   -79810644}, { 1070740889,   -80221273}, 
+	{ 1070952382,   -77346620}, { 1070922641,   -77757319}, { 1070892743,   -78168007}, { 1070862687,   -78578684}, 
+	{ 1071069770,   -75703709}, { 1071040660,   -76114454}, { 1071011391,   -76525187}, { 1070981966,   -76935909}, 
+	{ 1071184638,   -74060620}, { 1071156158,   -74471409}, { 1071127519,   -74882187}, { 1071098724,   -75292954}, 
+	{ 1071296985,   -72417357}, { 1071269135,   -72828189}, { 1071241127,   -73239010}, { 1071212961,   -73649821}, 
+	{ 1071406812,   -70773924}, { 1071379592,   -71184798}, { 1071352214,   -71595661}, { 1071324678,   -72006515}, 
+	{ 1071514117,   -69130324}, { 1071487527,   -69541239}, { 1071460780,   -69952144}, { 1071433874,   -70363039}, 
+	{ 1071618901,   -67486561}, { 1071592941,   -67897517}, { 1071566824,   -68308462}, { 1071540549,   -68719398}, 
+	{ 1071721163,   -65842639}, { 1071695834,   -66253634}, { 1071670347,   -66664620}, { 1071644703,   -67075595}, 
+	{ 1071820903,   -64198563}, { 1071796205,   -64609596}, { 1071771349,   -65020620}, { 1071746335,   -65431634}, 
+	{ 1071918122,   -62554335}, { 1071894054,   -62965406}, { 1071869828,   -63376468}, { 1071845445,   -63787520}, 
+	{ 1072012818,   -60909960}, { 1071989380,   -61321068}, { 1071965785,   -61732166}, { 1071942032,   -62143255}, 
+	{ 1072104991,   -59265442}, { 1072082184,   -59676585}, { 1072059220,   -60087719}, { 1072036098,   -60498844}, 
+	{ 1072194642,   -57620785}, { 1072172466,   -58031962}, { 1072150132,   -58443131}, { 1072127640,   -58854291}, 
+	{ 1072281769,   -55975992}, { 1072260224,   -56387202}, { 1072238521,   -56798405}, { 1072216660,   -57209599}, 
+	{ 1072366374,   -54331067}, { 1072345459,   -54742310}, { 1072324387,   -55153545}, { 1072303157,   -55564773}, 
+	{ 1072448455,   -52686014}, { 1072428171,   -53097289}, { 1072407730,   -53508556}, { 1072387131,   -53919815}, 
+	{ 1072528012,   -51040837}, { 1072508360,   -51452143}, { 1072488549,   -51863441}, { 1072468581,   -52274731}, 
+	{ 1072605046,   -49395541}, { 1072586024,   -49806876}, { 1072566845,   -50218204}, { 1072547508,   -50629524}, 
+	{ 1072679556,   -47750128}, { 1072661165,   -48161492}, { 1072642617,   -48572848}, { 1072623910,   -48984198}, 
+	{ 1072751542,   -46104602}, { 1072733782,   -46515994}, { 1072715864,   -46927379}, { 1072697789,   -47338757}, 
+	{ 1072821003,   -44458968}, { 1072803874,   -44870387}, { 1072786588,   -45281799}, { 1072769144,   -45693204}, 
+	{ 1072887940,   -42813230}, { 1072871443,   -43224674}, { 1072854787,   -43636112}, { 1072837974,   -44047544}, 
+	{ 1072952352,   -41167391}, { 1072936486,   -41578860}, { 1072920462,   -41990323}, { 1072904280,   -42401779}, 
+	{ 1073014240,   -39521455}, { 1072999005,   -39932948}, { 1072983612,   -40344435}, { 1072968061,   -40755916}, 
+	{ 1073073603,   -37875426}, { 1073058999,   -38286941}, { 1073044237,   -38698452}, { 1073029317,   -39109956}, 
+	{ 1073130440,   -36229307}, { 1073116468,   -36640845}, { 1073102337,   -37052377}, { 1073088049,   -37463904}, 
+	{ 1073184753,   -34583104}, { 1073171411,   -34994663}, { 1073157912,   -35406216}, { 1073144255,   -35817764}, 
+	{ 1073236540,   -32936819}, { 1073223830,   -33348398}, { 1073210962,   -33759971}, { 1073197936,   -34171540}, 
+	{ 1073285802,   -31290457}, { 1073273723,   -31702054}, { 1073261486,   -32113647}, { 1073249092,   -32525236}, 
+	{ 1073332538,   -29644021}, { 1073321091,   -30055636}, { 1073309485,   -30467248}, { 1073297722,   -30878855}, 
+	{ 1073376748,   -27997515}, { 1073365932,   -28409148}, { 1073354959,   -28820776}, { 1073343827,   -29232401}, 
+	{ 1073418433,   -26350943}, { 1073408249,   -26762592}, { 1073397906,   -27174237}, { 1073387406,   -27585878}, 
+	{ 1073457592,   -24704310}, { 1073448039,   -25115974}, { 1073438328,   -25527634}, { 1073428460,   -25939291}, 
+	{ 1073494225,   -23057618}, { 1073485303,   -23469296}, { 1073476224,   -23880971}, { 1073466987,   -24292642}, 
+	{ 1073528332,   -21410872}, { 1073520042,   -21822563}, { 1073511594,   -22234252}, { 1073502988,   -22645937}, 
+	{ 1073559913,   -19764076}, { 1073552254,   -20175779}, { 1073544438,   -20587480}, { 1073536464,   -20999178}, 
+	{ 1073588967,   -18117233}, { 1073581940,   -18528948}, { 1073574756,   -18940660}, { 1073567413,   -19352369}, 
+	{ 1073615496,   -16470347}, { 1073609100,   -16882072}, { 1073602547,   -17293795}, { 1073595836,   -17705515}, 
+	{ 1073639498,   -14823423}, { 1073633734,   -15235158}, { 1073627812,   -15646890}, { 1073621733,   -16058620}, 
+	{ 1073660973,   -13176464}, { 1073655841,   -13588207}, { 1073650551,   -13999948}, { 1073645103,   -14411686}, 
+	{ 1073679922,   -11529474}, { 1073675422,   -11941224}, { 1073670764,   -12352972}, { 1073665947,   -12764719}, 
+	{ 1073696345,    -9882456}, { 1073692476,   -10294213}, { 1073688450,   -10705968}, { 1073684265,   -11117722}, 
+	{ 1073710241,    -8235416}, { 1073707004,    -8647178}, { 1073703609,    -9058939}, { 1073700056,    -9470698}, 
+	{ 1073721611,    -6588356}, { 1073719006,    -7000123}, { 1073716242,    -7411888}, { 1073713321,    -7823653}, 
+	{ 1073730454,    -4941281}, { 1073728480,    -5353051}, { 1073726348,    -5764820}, { 1073724059,    -6176588}, 
+	{ 1073736771,    -3294193}, { 1073735429,    -3705966}, { 1073733928,    -4117738}, { 1073732270,    -4529510}, 
+	{ 1073740561,    -1647099}, { 1073739850,    -2058873}, { 1073738982,    -2470647}, { 1073737955,    -2882420}, 
+	{ 1073741824,           0}, { 1073741745,     -411775}, { 1073741508,     -823550}, { 1073741113,    -1235324}, 
+#endif
 	};
 
-    
 const uint32_t xs3_dit_fft_lut_size = sizeof(xs3_dit_fft_lut);
 
-const complex_s32_t xs3_dif_fft_lut[1020] = 
+const complex_s32_t xs3_dif_fft_lut[(1<<MAX_DIF_FFT_LUT_LOG2)-4] = 
 	{
+#if (MAX_DIF_FFT_LUT_LOG2 >= 14)
+	{ 1073740561,     1647099}, { 1073741113,     1235324}, { 1073741508,      823550}, { 1073741745,      411775}, 
+	{ 1073736771,     3294193}, { 1073737955,     2882420}, { 1073738982,     2470647}, { 1073739850,     2058873}, 
+	{ 1073730454,     4941281}, { 1073732270,     4529510}, { 1073733928,     4117738}, { 1073735429,     3705966}, 
+	{ 1073721611,     6588356}, { 1073724059,     6176588}, { 1073726348,     5764820}, { 1073728480,     5353051}, 
+	{ 1073710241,     8235416}, { 1073713321,     7823653}, { 1073716242,     7411888}, { 1073719006,     7000123}, 
+	{ 1073696345,     9882456}, { 1073700056,     9470698}, { 1073703609,     9058939}, { 1073707004,     8647178}, 
+	{ 1073679922,    11529474}, { 1073684265,    11117722}, { 1073688450,    10705968}, { 1073692476,    10294213}, 
+	{ 1073660973,    13176464}, { 1073665947,    12764719}, { 1073670764,    12352972}, { 1073675422,    11941224}, 
+	{ 1073639498,    14823423}, { 1073645103,    14411686}, { 1073650551,    13999948}, { 1073655841,    13588207}, 
+	{ 1073615496,    16470347}, { 1073621733,    16058620}, { 1073627812,    15646890}, { 1073633734,    15235158}, 
+	{ 1073588967,    18117233}, { 1073595836,    17705515}, { 1073602547,    17293795}, { 1073609100,    16882072}, 
+	{ 1073559913,    19764076}, { 1073567413,    19352369}, { 1073574756,    18940660}, { 1073581940,    18528948}, 
+	{ 1073528332,    21410872}, { 1073536464,    20999178}, { 1073544438,    20587480}, { 1073552254,    20175779}, 
+	{ 1073494225,    23057618}, { 1073502988,    22645937}, { 1073511594,    22234252}, { 1073520042,    21822563}, 
+	{ 1073457592,    24704310}, { 1073466987,    24292642}, { 1073476224,    23880971}, { 1073485303,    23469296}, 
+	{ 1073418433,    26350943}, { 1073428460,    25939291}, { 1073438328,    25527634}, { 1073448039,    25115974}, 
+	{ 1073376748,    27997515}, { 1073387406,    27585878}, { 1073397906,    27174237}, { 1073408249,    26762592}, 
+	{ 1073332538,    29644021}, { 1073343827,    29232401}, { 1073354959,    28820776}, { 1073365932,    28409148}, 
+	{ 1073285802,    31290457}, { 1073297722,    30878855}, { 1073309485,    30467248}, { 1073321091,    30055636}, 
+	{ 1073236540,    32936819}, { 1073249092,    32525236}, { 1073261486,    32113647}, { 1073273723,    31702054}, 
+	{ 1073184753,    34583104}, { 1073197936,    34171540}, { 1073210962,    33759971}, { 1073223830,    33348398}, 
+	{ 1073130440,    36229307}, { 1073144255,    35817764}, { 1073157912,    35406216}, { 1073171411,    34994663}, 
+	{ 1073073603,    37875426}, { 1073088049,    37463904}, { 1073102337,    37052377}, { 1073116468,    36640845}, 
+	{ 1073014240,    39521455}, { 1073029317,    39109956}, { 1073044237,    38698452}, { 1073058999,    38286941}, 
+	{ 1072952352,    41167391}, { 1072968061,    40755916}, { 1072983612,    40344435}, { 1072999005,    39932948}, 
+	{ 1072887940,    42813230}, { 1072904280,    42401779}, { 1072920462,    41990323}, { 1072936486,    41578860}, 
+	{ 1072821003,    44458968}, { 1072837974,    44047544}, { 1072854787,    43636112}, { 1072871443,    43224674}, 
+	{ 1072751542,    46104602}, { 1072769144,    45693204}, { 1072786588,    45281799}, { 1072803874,    44870387}, 
+	{ 1072679556,    47750128}, { 1072697789,    47338757}, { 1072715864,    46927379}, { 1072733782,    46515994}, 
+	{ 1072605046,    49395541}, { 1072623910,    48984198}, { 1072642617,    48572848}, { 1072661165,    48161492}, 
+	{ 1072528012,    51040837}, { 1072547508,    50629524}, { 1072566845,    50218204}, { 1072586024,    49806876}, 
+	{ 1072448455,    52686014}, { 1072468581,    52274731}, { 1072488549,    51863441}, { 1072508360,    51452143}, 
+	{ 1072366374,    54331067}, { 1072387131,    53919815}, { 1072407730,    53508556}, { 1072428171,    53097289}, 
+	{ 1072281769,    55975992}, { 1072303157,    55564773}, { 1072324387,    55153545}, { 1072345459,    54742310}, 
+	{ 1072194642,    57620785}, { 1072216660,    57209599}, { 1072238521,    56798405}, { 1072260224,    56387202}, 
+	{ 1072104991,    59265442}, { 1072127640,    58854291}, { 1072150132,    58443131}, { 1072172466,    58031962}, 
+	{ 1072012818,    60909960}, { 1072036098,    60498844}, { 1072059220,    60087719}, { 1072082184,    59676585}, 
+	{ 1071918122,    62554335}, { 1071942032,    62143255}, { 1071965785,    61732166}, { 1071989380,    61321068}, 
+	{ 1071820903,    64198563}, { 1071845445,    63787520}, { 1071869828,    63376468}, { 1071894054,    62965406}, 
+	{ 1071721163,    65842639}, { 1071746335,    65431634}, { 1071771349,    65020620}, { 1071796205,    64609596}, 
+	{ 1071618901,    67486561}, { 1071644703,    67075595}, { 1071670347,    66664620}, { 1071695834,    66253634}, 
+	{ 1071514117,    69130324}, { 1071540549,    68719398}, { 1071566824,    68308462}, { 1071592941,    67897517}, 
+	{ 1071406812,    70773924}, { 1071433874,    70363039}, { 1071460780,    69952144}, { 1071487527,    69541239}, 
+	{ 1071296985,    72417357}, { 1071324678,    72006515}, { 1071352214,    71595661}, { 1071379592,    71184798}, 
+	{ 1071184638,    74060620}, { 1071212961,    73649821}, { 1071241127,    73239010}, { 1071269135,    72828189}, 
+	{ 1071069770,    75703709}, { 1071098724,    75292954}, { 1071127519,    74882187}, { 1071156158,    74471409}, 
+	{ 1070952382,    77346620}, { 1070981966,    76935909}, { 1071011391,    76525187}, { 1071040660,    76114454}, 
+	{ 1070832474,    78989349}, { 1070862687,    78578684}, { 1070892743,    78168007}, { 1070922641,    77757319}, 
+	{ 1070710046,    80631892}, { 1070740889,    80221273}, { 1070771575,    79810644}, { 1070802103,    79400002}, 
+	{ 1070585099,    82274245}, { 1070616572,    81863674}, { 1070647887,    81453092}, { 1070679045,    81042498}, 
+	{ 1070457632,    83916404}, { 1070489735,    83505883}, { 1070521680,    83095349}, { 1070553468,    82684803}, 
+	{ 1070327646,    85558366}, { 1070360379,    85147894}, { 1070392954,    84737410}, { 1070425372,    84326913}, 
+	{ 1070195142,    87200127}, { 1070228504,    86789706}, { 1070261709,    86379272}, { 1070294756,    85968825}, 
+	{ 1070060120,    88841683}, { 1070094111,    88431313}, { 1070127946,    88020931}, { 1070161623,    87610535}, 
+	{ 1069922579,    90483029}, { 1069957201,    90072712}, { 1069991664,    89662382}, { 1070025971,    89252039}, 
+	{ 1069782521,    92124163}, { 1069817772,    91713899}, { 1069852865,    91303623}, { 1069887801,    90893333}, 
+	{ 1069639946,    93765079}, { 1069675826,    93354871}, { 1069711548,    92944648}, { 1069747114,    92534412}, 
+	{ 1069494854,    95405776}, { 1069531363,    94995622}, { 1069567715,    94585455}, { 1069603909,    94175274}, 
+	{ 1069347245,    97046247}, { 1069384383,    96636151}, { 1069421364,    96226040}, { 1069458188,    95815915}, 
+	{ 1069197120,    98686491}, { 1069234887,    98276451}, { 1069272497,    97866398}, { 1069309950,    97456330}, 
+	{ 1069044479,   100326502}, { 1069082875,    99916521}, { 1069121114,    99506525}, { 1069159195,    99096515}, 
+	{ 1068889322,   101966277}, { 1068928347,   101556355}, { 1068967215,   101146419}, { 1069005925,   100736468}, 
+	{ 1068731650,   103605812}, { 1068771304,   103195951}, { 1068810801,   102786074}, { 1068850140,   102376183}, 
+	{ 1068571464,   105245103}, { 1068611746,   104835303}, { 1068651871,   104425488}, { 1068691839,   104015658}, 
+	{ 1068408763,   106884147}, { 1068449673,   106474409}, { 1068490427,   106064656}, { 1068531024,   105654887}, 
+	{ 1068243547,   108522939}, { 1068285087,   108113265}, { 1068326469,   107703574}, { 1068367694,   107293868}, 
+	{ 1068075818,   110161476}, { 1068117986,   109751866}, { 1068159997,   109342239}, { 1068201851,   108932597}, 
+	{ 1067905576,   111799753}, { 1067948372,   111390208}, { 1067991011,   110980647}, { 1068033493,   110571069}, 
+	{ 1067732821,   113437768}, { 1067776246,   113028289}, { 1067819513,   112618793}, { 1067862623,   112209281}, 
+	{ 1067557554,   115075515}, { 1067601606,   114666103}, { 1067645501,   114256675}, { 1067689240,   113847230}, 
+	{ 1067379774,   116712992}, { 1067424454,   116303648}, { 1067468978,   115894288}, { 1067513344,   115484910}, 
+	{ 1067199483,   118350194}, { 1067244791,   117940919}, { 1067289942,   117531627}, { 1067334937,   117122318}, 
+	{ 1067016680,   119987118}, { 1067062616,   119577913}, { 1067108396,   119168691}, { 1067154018,   118759451}, 
+	{ 1066831367,   121623759}, { 1066877931,   121214625}, { 1066924338,   120805474}, { 1066970587,   120396304}, 
+	{ 1066643544,   123260114}, { 1066690735,   122851052}, { 1066737769,   122441972}, { 1066784647,   122032875}, 
+	{ 1066453210,   124896179}, { 1066501029,   124487190}, { 1066548690,   124078183}, { 1066596195,   123669157}, 
+	{ 1066260367,   126531950}, { 1066308813,   126123035}, { 1066357102,   125714101}, { 1066405234,   125305149}, 
+	{ 1066065015,   128167423}, { 1066114088,   127758583}, { 1066163005,   127349724}, { 1066211764,   126940846}, 
+	{ 1065867154,   129802595}, { 1065916855,   129393831}, { 1065966398,   128985047}, { 1066015785,   128576245}, 
+	{ 1065666786,   131437462}, { 1065717113,   131028774}, { 1065767284,   130620067}, { 1065817297,   130211341}, 
+	{ 1065463909,   133072019}, { 1065514864,   132663409}, { 1065565661,   132254779}, { 1065616302,   131846130}, 
+	{ 1065258526,   134706263}, { 1065310107,   134297731}, { 1065361531,   133889180}, { 1065412799,   133480609}, 
+	{ 1065050636,   136340190}, { 1065102844,   135931738}, { 1065154894,   135523266}, { 1065206789,   135114774}, 
+	{ 1064840240,   137973796}, { 1064893074,   137565425}, { 1064945751,   137157033}, { 1064998272,   136748621}, 
+	{ 1064627338,   139607077}, { 1064680798,   139198788}, { 1064734102,   138790477}, { 1064787249,   138382147}, 
+	{ 1064411931,   141240030}, { 1064466017,   140831823}, { 1064519947,   140423595}, { 1064573721,   140015347}, 
+	{ 1064194019,   142872651}, { 1064248732,   142464527}, { 1064303288,   142056382}, { 1064357688,   141648217}, 
+	{ 1063973603,   144504935}, { 1064028942,   144096896}, { 1064084124,   143688835}, { 1064139150,   143280754}, 
+	{ 1063750684,   146136880}, { 1063806648,   145728926}, { 1063862456,   145320950}, { 1063918108,   144912954}, 
+	{ 1063525261,   147768480}, { 1063581851,   147360613}, { 1063638285,   146952723}, { 1063694563,   146544812}, 
+	{ 1063297336,   149399733}, { 1063354552,   148991953}, { 1063411611,   148584150}, { 1063468514,   148176326}, 
+	{ 1063066909,   151030634}, { 1063124750,   150622942}, { 1063182435,   150215228}, { 1063239964,   149807492}, 
+	{ 1062833980,   152661180}, { 1062892446,   152253577}, { 1062950757,   151845952}, { 1063008911,   151438304}, 
+	{ 1062598550,   154291367}, { 1062657642,   153883854}, { 1062716578,   153476319}, { 1062775357,   153068761}, 
+	{ 1062360620,   155921191}, { 1062420337,   155513769}, { 1062479898,   155106324}, { 1062539302,   154698857}, 
+	{ 1062120190,   157550647}, { 1062180532,   157143318}, { 1062240717,   156735965}, { 1062300747,   156328589}, 
+	{ 1061877261,   159179733}, { 1061938227,   158772497}, { 1061999038,   158365237}, { 1062059692,   157957954}, 
+	{ 1061631833,   160808445}, { 1061693424,   160401302}, { 1061754859,   159994136}, { 1061816138,   159586946}, 
+	{ 1061383907,   162436778}, { 1061446123,   162029730}, { 1061508182,   161622659}, { 1061570086,   161215564}, 
+	{ 1061133483,   164064728}, { 1061196323,   163657777}, { 1061259007,   163250801}, { 1061321535,   162843801}, 
+	{ 1060880563,   165692293}, { 1060944027,   165285438}, { 1061007335,   164878559}, { 1061070487,   164471656}, 
+	{ 1060625146,   167319468}, { 1060689234,   166912711}, { 1060753166,   166505929}, { 1060816943,   166099124}, 
+	{ 1060367233,   168946249}, { 1060431945,   168539591}, { 1060496502,   168132908}, { 1060560902,   167726200}, 
+	{ 1060106826,   170572633}, { 1060172161,   170166074}, { 1060237341,   169759491}, { 1060302365,   169352882}, 
+	{ 1059843923,   172198615}, { 1059909883,   171792157}, { 1059975686,   171385674}, { 1060041334,   170979166}, 
+	{ 1059578527,   173824192}, { 1059645110,   173417836}, { 1059711537,   173011454}, { 1059777808,   172605047}, 
+	{ 1059310638,   175449360}, { 1059377844,   175043106}, { 1059444894,   174636827}, { 1059511788,   174230522}, 
+	{ 1059040255,   177074115}, { 1059108085,   176667965}, { 1059175758,   176261789}, { 1059243276,   175855587}, 
+	{ 1058767381,   178698453}, { 1058835833,   178292408}, { 1058904130,   177886336}, { 1058972270,   177480239}, 
+	{ 1058492016,   180322371}, { 1058561091,   179916431}, { 1058630010,   179510465}, { 1058698773,   179104472}, 
+	{ 1058214159,   181945865}, { 1058283857,   181540031}, { 1058353399,   181134171}, { 1058422785,   180728284}, 
+	{ 1057933813,   183568930}, { 1058004133,   183163204}, { 1058074297,   182757451}, { 1058144306,   182351671}, 
+	{ 1057650977,   185191564}, { 1057721919,   184785946}, { 1057792706,   184380301}, { 1057863337,   183974629}, 
+	{ 1057365653,   186813762}, { 1057437217,   186408253}, { 1057508626,   186002717}, { 1057579879,   185597154}, 
+	{ 1057077840,   188435520}, { 1057150026,   188030122}, { 1057222057,   187624696}, { 1057293933,   187219242}, 
+	{ 1056787540,   190056834}, { 1056860348,   189651548}, { 1056933001,   189246233}, { 1057005498,   188840890}, 
+	{ 1056494753,   191677702}, { 1056568183,   191272527}, { 1056641457,   190867324}, { 1056714576,   190462093}, 
+	{ 1056199480,   193298119}, { 1056273531,   192893057}, { 1056347427,   192487967}, { 1056421168,   192082849}, 
+	{ 1055901722,   194918080}, { 1055976395,   194513133}, { 1056050912,   194108156}, { 1056125274,   193703152}, 
+	{ 1055601479,   196537583}, { 1055676773,   196132751}, { 1055751911,   195727889}, { 1055826894,   195322999}, 
+	{ 1055298753,   198156624}, { 1055374667,   197751907}, { 1055450426,   197347161}, { 1055526030,   196942387}, 
+	{ 1054993543,   199775198}, { 1055070078,   199370598}, { 1055146458,   198965969}, { 1055222683,   198561311}, 
+	{ 1054685850,   201393302}, { 1054763006,   200988820}, { 1054840007,   200584309}, { 1054916852,   200179768}, 
+	{ 1054375676,   203010932}, { 1054453452,   202606569}, { 1054531073,   202202177}, { 1054608539,   201797754}, 
+	{ 1054063021,   204628085}, { 1054141417,   204223842}, { 1054219658,   203819569}, { 1054297745,   203415265}, 
+	{ 1053747885,   206244756}, { 1053826901,   205840633}, { 1053905763,   205436481}, { 1053984469,   205032298}, 
+	{ 1053430270,   207860942}, { 1053509906,   207456941}, { 1053589387,   207052910}, { 1053668714,   206648848}, 
+	{ 1053110176,   209476638}, { 1053190432,   209072760}, { 1053270533,   208668851}, { 1053350479,   208264912}, 
+	{ 1052787604,   211091842}, { 1052868479,   210688087}, { 1052949200,   210284302}, { 1053029765,   209880485}, 
+	{ 1052462555,   212706549}, { 1052544049,   212302919}, { 1052625389,   211899258}, { 1052706574,   211495565}, 
+	{ 1052135029,   214320755}, { 1052217142,   213917251}, { 1052299101,   213513715}, { 1052380905,   213110148}, 
+	{ 1051805027,   215934457}, { 1051887759,   215531079}, { 1051970337,   215127670}, { 1052052760,   214724228}, 
+	{ 1051472550,   217547651}, { 1051555901,   217144401}, { 1051639098,   216741118}, { 1051722140,   216337804}, 
+	{ 1051137599,   219160334}, { 1051221569,   218757211}, { 1051305384,   218354057}, { 1051389044,   217950870}, 
+	{ 1050800175,   220772500}, { 1050884763,   220369507}, { 1050969196,   219966481}, { 1051053475,   219563424}, 
+	{ 1050460278,   222384147}, { 1050545484,   221981284}, { 1050630536,   221578389}, { 1050715433,   221175461}, 
+	{ 1050117909,   223995270}, { 1050203733,   223592539}, { 1050289403,   223189774}, { 1050374918,   222786977}, 
+	{ 1049773069,   225605867}, { 1049859511,   225203267}, { 1049945798,   224800635}, { 1050031931,   224397969}, 
+	{ 1049425759,   227215933}, { 1049512818,   226813466}, { 1049599723,   226410966}, { 1049686474,   226008433}, 
+	{ 1049075980,   228825464}, { 1049163656,   228423131}, { 1049251178,   228020765}, { 1049338546,   227618366}, 
+	{ 1048723732,   230434456}, { 1048812025,   230032259}, { 1048900165,   229630027}, { 1048988149,   229227762}, 
+	{ 1048369016,   232042906}, { 1048457926,   231640845}, { 1048546683,   231238749}, { 1048635284,   230836620}, 
+	{ 1048011834,   233650811}, { 1048101360,   233248886}, { 1048190733,   232846927}, { 1048279952,   232444934}, 
+	{ 1047652185,   235258165}, { 1047742328,   234856378}, { 1047832317,   234454557}, { 1047922153,   234052701}, 
+	{ 1047290071,   236864966}, { 1047380830,   236463318}, { 1047471436,   236061635}, { 1047561887,   235659918}, 
+	{ 1046925492,   238471210}, { 1047016868,   238069701}, { 1047108090,   237668158}, { 1047199157,   237266579}, 
+	{ 1046558451,   240076892}, { 1046650442,   239675524}, { 1046742279,   239274121}, { 1046833963,   238872683}, 
+	{ 1046188946,   241682010}, { 1046281553,   241280783}, { 1046374006,   240879522}, { 1046466305,   240478225}, 
+	{ 1045816980,   243286558}, { 1045910202,   242885475}, { 1046003271,   242484355}, { 1046096185,   242083200}, 
+	{ 1045442553,   244890535}, { 1045536390,   244489594}, { 1045630074,   244088618}, { 1045723604,   243687606}, 
+	{ 1045065665,   246493935}, { 1045160118,   246093139}, { 1045254416,   245692307}, { 1045348561,   245291439}, 
+	{ 1044686319,   248096755}, { 1044781386,   247696104}, { 1044876299,   247295417}, { 1044971059,   246894694}, 
+	{ 1044304514,   249698991}, { 1044400196,   249298487}, { 1044495724,   248897946}, { 1044591098,   248497369}, 
+	{ 1043920252,   251300640}, { 1044016548,   250900283}, { 1044112690,   250499889}, { 1044208679,   250099458}, 
+	{ 1043533534,   252901697}, { 1043630444,   252501488}, { 1043727200,   252101242}, { 1043823803,   251700959}, 
+	{ 1043144360,   254502159}, { 1043241884,   254102099}, { 1043339254,   253702003}, { 1043436471,   253301868}, 
+	{ 1042752731,   256102022}, { 1042850869,   255702113}, { 1042948852,   255302166}, { 1043046683,   254902181}, 
+	{ 1042358649,   257701283}, { 1042457400,   257301525}, { 1042555997,   256901728}, { 1042654441,   256501894}, 
+	{ 1041962114,   259299937}, { 1042061478,   258900331}, { 1042160688,   258500686}, { 1042259745,   258101004}, 
+	{ 1041563127,   260897982}, { 1041663104,   260498528}, { 1041762927,   260099036}, { 1041862597,   259699506}, 
+	{ 1041161689,   262495412}, { 1041262279,   262096112}, { 1041362715,   261696774}, { 1041462997,   261297397}, 
+	{ 1040757802,   264092224}, { 1040859003,   263693079}, { 1040960052,   263293896}, { 1041060947,   262894673}, 
+	{ 1040351465,   265688415}, { 1040453279,   265289426}, { 1040554939,   264890398}, { 1040656447,   264491331}, 
+	{ 1039942680,   267283981}, { 1040045106,   266885149}, { 1040147378,   266486277}, { 1040249498,   266087366}, 
+	{ 1039531448,   268878918}, { 1039634486,   268480243}, { 1039737370,   268081529}, { 1039840101,   267682775}, 
+	{ 1039117770,   270473223}, { 1039221419,   270074706}, { 1039324915,   269676150}, { 1039428258,   269277554}, 
+	{ 1038701647,   272066891}, { 1038805907,   271668533}, { 1038910014,   271270136}, { 1039013969,   270871700}, 
+	{ 1038283080,   273659918}, { 1038387951,   273261722}, { 1038492669,   272863485}, { 1038597234,   272465208}, 
+	{ 1037862069,   275252302}, { 1037967551,   274854267}, { 1038072880,   274456191}, { 1038178056,   274058075}, 
+	{ 1037438617,   276844038}, { 1037544709,   276446165}, { 1037650648,   276048251}, { 1037756435,   275650297}, 
+	{ 1037012723,   278435122}, { 1037119425,   278037413}, { 1037225975,   277639662}, { 1037332372,   277241870}, 
+	{ 1036584389,   280025552}, { 1036691701,   279628006}, { 1036798861,   279230419}, { 1036905868,   278832791}, 
+	{ 1036153615,   281615322}, { 1036261537,   281217942}, { 1036369307,   280820520}, { 1036476924,   280423056}, 
+	{ 1035720404,   283204430}, { 1035828935,   282807215}, { 1035937314,   282409959}, { 1036045541,   282012662}, 
+	{ 1035284755,   284792871}, { 1035393896,   284395824}, { 1035502884,   283998734}, { 1035611720,   283601603}, 
+	{ 1034846671,   286380643}, { 1034956420,   285983763}, { 1035066018,   285586841}, { 1035175463,   285189877}, 
+	{ 1034406151,   287967740}, { 1034516509,   287571029}, { 1034626715,   287174276}, { 1034736769,   286777480}, 
+	{ 1033963197,   289554160}, { 1034074164,   289157619}, { 1034184978,   288761035}, { 1034295641,   288364409}, 
+	{ 1033517810,   291139898}, { 1033629385,   290743528}, { 1033740808,   290347114}, { 1033852079,   289950658}, 
+	{ 1033069992,   292724951}, { 1033182174,   292328753}, { 1033294205,   291932511}, { 1033406084,   291536226}, 
+	{ 1032619742,   294309316}, { 1032732532,   293913290}, { 1032845170,   293517220}, { 1032957657,   293121107}, 
+	{ 1032167062,   295892988}, { 1032280460,   295497135}, { 1032393706,   295101239}, { 1032506800,   294705299}, 
+	{ 1031711954,   297475964}, { 1031825959,   297080285}, { 1031939812,   296684563}, { 1032053513,   296288797}, 
+	{ 1031254418,   299058239}, { 1031369029,   298662736}, { 1031483489,   298267189}, { 1031597797,   297871598}, 
+	{ 1030794455,   300639811}, { 1030909673,   300244484}, { 1031024740,   299849113}, { 1031139655,   299453698}, 
+	{ 1030332067,   302220676}, { 1030447891,   301825526}, { 1030563564,   301430332}, { 1030679085,   301035094}, 
+	{ 1029867254,   303800829}, { 1029983684,   303405858}, { 1030099963,   303010842}, { 1030216091,   302615781}, 
+	{ 1029400018,   305380268}, { 1029517054,   304985475}, { 1029633939,   304590638}, { 1029750672,   304195756}, 
+	{ 1028930359,   306958988}, { 1029048001,   306564375}, { 1029165491,   306169718}, { 1029282830,   305775015}, 
+	{ 1028458280,   308536985}, { 1028576527,   308142554}, { 1028694622,   307748077}, { 1028812566,   307353555}, 
+	{ 1027983780,   310114257}, { 1028102632,   309720007}, { 1028221332,   309325712}, { 1028339882,   308931371}, 
+	{ 1027506862,   311690799}, { 1027626318,   311296732}, { 1027745623,   310902619}, { 1027864777,   310508461}, 
+	{ 1027027525,   313266607}, { 1027147586,   312872724}, { 1027267495,   312478795}, { 1027387254,   312084820}, 
+	{ 1026545772,   314841679}, { 1026666437,   314447980}, { 1026786951,   314054235}, { 1026907313,   313660444}, 
+	{ 1026061603,   316416009}, { 1026182872,   316022496}, { 1026303990,   315628937}, { 1026424956,   315235331}, 
+	{ 1025575020,   317989595}, { 1025696892,   317596268}, { 1025818614,   317202895}, { 1025940184,   316809475}, 
+	{ 1025086024,   319562433}, { 1025208499,   319169293}, { 1025330824,   318776108}, { 1025452997,   318382875}, 
+	{ 1024594615,   321134518}, { 1024717694,   320741568}, { 1024840621,   320348570}, { 1024963398,   319955525}, 
+	{ 1024100796,   322705848}, { 1024224477,   322313087}, { 1024348007,   321920278}, { 1024471386,   321527422}, 
+	{ 1023604567,   324276419}, { 1023728850,   323883848}, { 1023852982,   323491229}, { 1023976964,   323098562}, 
+	{ 1023105929,   325846226}, { 1023230814,   325453846}, { 1023355549,   325061418}, { 1023480133,   324668942}, 
+	{ 1022604883,   327415267}, { 1022730370,   327023079}, { 1022855707,   326630843}, { 1022980893,   326238559}, 
+	{ 1022101432,   328983538}, { 1022227520,   328591543}, { 1022353458,   328199499}, { 1022479246,   327807407}, 
+	{ 1021595575,   330551034}, { 1021722264,   330159233}, { 1021848804,   329767383}, { 1021975193,   329375485}, 
+	{ 1021087314,   332117752}, { 1021214605,   331726146}, { 1021341745,   331334491}, { 1021468735,   330942787}, 
+	{ 1020576651,   333683689}, { 1020704542,   333292279}, { 1020832283,   332900819}, { 1020959873,   332509310}, 
+	{ 1020063586,   335248841}, { 1020192077,   334857627}, { 1020320418,   334466364}, { 1020448610,   334075051}, 
+	{ 1019548121,   336813204}, { 1019677212,   336422188}, { 1019806153,   336031121}, { 1019934944,   335640006}, 
+	{ 1019030256,   338376774}, { 1019159947,   337985956}, { 1019289488,   337595089}, { 1019418879,   337204171}, 
+	{ 1018509994,   339939549}, { 1018640284,   339548930}, { 1018770425,   339158261}, { 1018900415,   338767543}, 
+	{ 1017987335,   341501523}, { 1018118225,   341111104}, { 1018248964,   340720636}, { 1018379554,   340330117}, 
+	{ 1017462281,   343062693}, { 1017593769,   342672476}, { 1017725107,   342282209}, { 1017856296,   341891891}, 
+	{ 1016934832,   344623057}, { 1017066919,   344233042}, { 1017198856,   343842976}, { 1017330643,   343452860}, 
+	{ 1016404991,   346182609}, { 1016537676,   345792797}, { 1016670211,   345402934}, { 1016802596,   345013021}, 
+	{ 1015872758,   347741347}, { 1016006040,   347351739}, { 1016139173,   346962080}, { 1016272157,   346572370}, 
+	{ 1015338134,   349299266}, { 1015472014,   348909863}, { 1015605745,   348520409}, { 1015739326,   348130904}, 
+	{ 1014801122,   350856364}, { 1014935599,   350467167}, { 1015069927,   350077918}, { 1015204105,   349688618}, 
+	{ 1014261721,   352412636}, { 1014396795,   352023646}, { 1014531720,   351634604}, { 1014666495,   351245510}, 
+	{ 1013719934,   353968079}, { 1013855604,   353579296}, { 1013991126,   353190461}, { 1014126498,   352801575}, 
+	{ 1013175761,   355522689}, { 1013312028,   355134115}, { 1013448145,   354745488}, { 1013584114,   354356810}, 
+	{ 1012629204,   357076462}, { 1012766067,   356688097}, { 1012902780,   356299680}, { 1013039345,   355911211}, 
+	{ 1012080264,   358629395}, { 1012217723,   358241241}, { 1012355032,   357853034}, { 1012492193,   357464774}, 
+	{ 1011528943,   360181484}, { 1011666997,   359793541}, { 1011804901,   359405545}, { 1011942657,   359017496}, 
+	{ 1010975242,   361732726}, { 1011113890,   361344995}, { 1011252390,   360957211}, { 1011390741,   360569374}, 
+	{ 1010419162,   363283116}, { 1010558405,   362895598}, { 1010697499,   362508027}, { 1010836445,   362120403}, 
+	{ 1009860704,   364832652}, { 1010000541,   364445348}, { 1010140230,   364057991}, { 1010279770,   363670580}, 
+	{ 1009299870,   366381329}, { 1009440301,   365994240}, { 1009580584,   365607098}, { 1009720718,   365219902}, 
+	{ 1008736660,   367929144}, { 1008877685,   367542271}, { 1009018562,   367155344}, { 1009159290,   366768363}, 
+	{ 1008171077,   369476093}, { 1008312696,   369089437}, { 1008454166,   368702727}, { 1008595487,   368315962}, 
+	{ 1007603122,   371022173}, { 1007745333,   370635734}, { 1007887396,   370249242}, { 1008029311,   369862694}, 
+	{ 1007032796,   372567379}, { 1007175600,   372181160}, { 1007318256,   371794885}, { 1007460763,   371408556}, 
+	{ 1006460100,   374111709}, { 1006603496,   373725709}, { 1006746744,   373339654}, { 1006889844,   372953544}, 
+	{ 1005885036,   375655159}, { 1006029024,   375269379}, { 1006172864,   374883544}, { 1006316556,   374497654}, 
+	{ 1005307605,   377197725}, { 1005452185,   376812166}, { 1005596617,   376426553}, { 1005740900,   376040883}, 
+	{ 1004727809,   378739403}, { 1004872979,   378354067}, { 1005018003,   377968675}, { 1005162878,   377583228}, 
+	{ 1004145648,   380280190}, { 1004291410,   379895077}, { 1004437024,   379509908}, { 1004582490,   379124683}, 
+	{ 1003561124,   381820082}, { 1003707476,   381435193}, { 1003853681,   381050248}, { 1003999738,   380665247}, 
+	{ 1002974239,   383359076}, { 1003121181,   382974412}, { 1003267977,   382589691}, { 1003414624,   382204915}, 
+	{ 1002384994,   384897167}, { 1002532526,   384512729}, { 1002679911,   384128234}, { 1002827149,   383743683}, 
+	{ 1001793390,   386434353}, { 1001941512,   386050142}, { 1002089486,   385665873}, { 1002237314,   385281549}, 
+	{ 1001199428,   387970630}, { 1001348140,   387586646}, { 1001496704,   387202605}, { 1001645120,   386818508}, 
+	{ 1000603111,   389505993}, { 1000752411,   389122238}, { 1000901564,   388738426}, { 1001050570,   388354556}, 
+	{ 1000004439,   391040440}, { 1000154328,   390656915}, { 1000304069,   390273331}, { 1000453664,   389889691}, 
+	{  999403415,   392573967}, {  999553891,   392190672}, {  999704221,   391807319}, {  999854404,   391423908}, 
+	{  998800038,   394106570}, {  998951103,   393723506}, {  999102020,   393340384}, {  999252791,   392957205}, 
+	{  998194311,   395638246}, {  998345963,   395255414}, {  998497468,   394872524}, {  998648827,   394489576}, 
+	{  997586236,   397168991}, {  997738475,   396786392}, {  997890567,   396403735}, {  998042512,   396021020}, 
+	{  996975812,   398698801}, {  997128638,   398316436}, {  997281317,   397934013}, {  997433850,   397551531}, 
+	{  996363043,   400227673}, {  996516456,   399845543}, {  996669721,   399463355}, {  996822840,   399081107}, 
+	{  995747930,   401755603}, {  995901928,   401373709}, {  996055780,   400991756}, {  996209485,   400609744}, 
+	{  995130473,   403282588}, {  995285057,   402900931}, {  995439494,   402519214}, {  995593785,   402137438}, 
+	{  994510675,   404808624}, {  994665844,   404427204}, {  994820867,   404045725}, {  994975743,   403664186}, 
+	{  993888536,   406333708}, {  994044290,   405952526}, {  994199898,   405571285}, {  994355360,   405189985}, 
+	{  993264059,   407857835}, {  993420398,   407476893}, {  993576590,   407095891}, {  993732636,   406714829}, 
+	{  992637245,   409381002}, {  992794167,   409000301}, {  992950944,   408619539}, {  993107575,   408238717}, 
+	{  992008094,   410903207}, {  992165601,   410522746}, {  992322961,   410142225}, {  992480176,   409761644}, 
+	{  991376610,   412424444}, {  991534700,   412044226}, {  991692644,   411663946}, {  991850442,   411283607}, 
+	{  990742793,   413944711}, {  990901465,   413564735}, {  991059993,   413184699}, {  991218374,   412804602}, 
+	{  990106644,   415464004}, {  990265900,   415084272}, {  990425010,   414704479}, {  990583974,   414324625}, 
+	{  989468165,   416982319}, {  989628003,   416602832}, {  989787696,   416223284}, {  989947243,   415843674}, 
+	{  988827359,   418499653}, {  988987779,   418120411}, {  989148053,   417741109}, {  989308182,   417361744}, 
+	{  988184225,   420016002}, {  988345227,   419637007}, {  988506083,   419257951}, {  988666793,   418878833}, 
+	{  987538766,   421531363}, {  987700349,   421152615}, {  987861786,   420773806}, {  988023078,   420394935}, 
+	{  986890984,   423045732}, {  987053147,   422667233}, {  987215165,   422288671}, {  987377038,   421910048}, 
+	{  986240879,   424559105}, {  986403623,   424180855}, {  986566221,   423802543}, {  986728675,   423424169}, 
+	{  985588453,   426071480}, {  985751777,   425693480}, {  985914956,   425315418}, {  986077990,   424937293}, 
+	{  984933708,   427582852}, {  985097612,   427205103}, {  985261370,   426827291}, {  985424984,   426449417}, 
+	{  984276646,   429093217}, {  984441129,   428715720}, {  984605467,   428338160}, {  984769660,   427960537}, 
+	{  983617267,   430602573}, {  983782329,   430225329}, {  983947246,   429848022}, {  984112018,   429470651}, 
+	{  982955574,   432110916}, {  983121214,   431733926}, {  983286710,   431356872}, {  983452061,   430979754}, 
+	{  982291568,   433618242}, {  982457786,   433241506}, {  982623860,   432864706}, {  982789789,   432487843}, 
+	{  981625251,   435124548}, {  981792047,   434748067}, {  981958698,   434371523}, {  982125205,   433994914}, 
+	{  980956623,   436629829}, {  981123997,   436253605}, {  981291226,   435877317}, {  981458310,   435500964}, 
+	{  980285688,   438134084}, {  980453638,   437758117}, {  980621444,   437382085}, {  980789106,   437005989}, 
+	{  979612445,   439637307}, {  979780972,   439261598}, {  979949355,   438885824}, {  980117593,   438509986}, 
+	{  978936898,   441139496}, {  979106001,   440764046}, {  979274960,   440388531}, {  979443774,   440012951}, 
+	{  978259047,   442640647}, {  978428725,   442265456}, {  978598260,   441890201}, {  978767651,   441514881}, 
+	{  977578894,   444140756}, {  977749148,   443765826}, {  977919258,   443390832}, {  978089224,   443015772}, 
+	{  976896441,   445639820}, {  977067269,   445265152}, {  977237955,   444890419}, {  977408496,   444515620}, 
+	{  976211688,   447137835}, {  976383092,   446763430}, {  976554352,   446388959}, {  976725468,   446014422}, 
+	{  975524639,   448634799}, {  975696617,   448260657}, {  975868451,   447886449}, {  976040141,   447512175}, 
+	{  974835295,   450130706}, {  975007846,   449756829}, {  975180254,   449382885}, {  975352518,   449008875}, 
+	{  974143656,   451625555}, {  974316781,   451251942}, {  974489762,   450878263}, {  974662600,   450504518}, 
+	{  973449725,   453119340}, {  973623423,   452745994}, {  973796977,   452372581}, {  973970388,   451999101}, 
+	{  972753504,   454612060}, {  972927774,   454238980}, {  973101901,   453865834}, {  973275885,   453492620}, 
+	{  972054994,   456103710}, {  972229836,   455730898}, {  972404535,   455358019}, {  972579091,   454985073}, 
+	{  971354196,   457594286}, {  971529610,   457221743}, {  971704881,   456849132}, {  971880009,   456476455}, 
+	{  970651112,   459083786}, {  970827098,   458711512}, {  971002940,   458339171}, {  971178639,   457966762}, 
+	{  969945745,   460572205}, {  970122301,   460200202}, {  970298714,   459828131}, {  970474985,   459455992}, 
+	{  969238095,   462059541}, {  969415222,   461687809}, {  969592205,   461316009}, {  969769046,   460944141}, 
+	{  968528165,   463545789}, {  968705861,   463174329}, {  968883415,   462802801}, {  969060826,   462431205}, 
+	{  967815955,   465030947}, {  967994221,   464659760}, {  968172345,   464288505}, {  968350326,   463917181}, 
+	{  967101468,   466515010}, {  967280303,   466144097}, {  967458996,   465773116}, {  967637547,   465402066}, 
+	{  966384706,   467997976}, {  966564109,   467627338}, {  966743371,   467256631}, {  966922491,   466885855}, 
+	{  965665669,   469479840}, {  965845641,   469109478}, {  966025471,   468739046}, {  966205159,   468368545}, 
+	{  964944360,   470960600}, {  965124900,   470590514}, {  965305298,   470220358}, {  965485555,   469850134}, 
+	{  964220780,   472440251}, {  964401888,   472070443}, {  964582854,   471700564}, {  964763678,   471330617}, 
+	{  963494932,   473918791}, {  963676607,   473549261}, {  963858140,   473179660}, {  964039531,   472809991}, 
+	{  962766816,   475396216}, {  962949058,   475026964}, {  963131157,   474657643}, {  963313116,   474288252}, 
+	{  962036435,   476872522}, {  962219243,   476503550}, {  962401909,   476134509}, {  962584433,   475765397}, 
+	{  961303790,   478347705}, {  961487164,   477979015}, {  961670396,   477610254}, {  961853486,   477241423}, 
+	{  960568883,   479821764}, {  960752822,   479453355}, {  960936620,   479084875}, {  961120276,   478716326}, 
+	{  959831716,   481294693}, {  960016220,   480926566}, {  960200582,   480558369}, {  960384803,   480190102}, 
+	{  959092290,   482766489}, {  959277359,   482398646}, {  959462286,   482030733}, {  959647071,   481662748}, 
+	{  958350608,   484237150}, {  958536240,   483869591}, {  958721731,   483501962}, {  958907081,   483134261}, 
+	{  957606670,   485706671}, {  957792866,   485339398}, {  957978921,   484972053}, {  958164835,   484604637}, 
+	{  956860479,   487175049}, {  957047238,   486808062}, {  957233856,   486441003}, {  957420333,   486073873}, 
+	{  956112036,   488642281}, {  956299358,   488275581}, {  956486539,   487908809}, {  956673579,   487541965}, 
+	{  955361344,   490108363}, {  955549228,   489741950}, {  955736971,   489375466}, {  955924574,   489008909}, 
+	{  954608403,   491573292}, {  954796849,   491207168}, {  954985154,   490840972}, {  955173319,   490474703}, 
+	{  953853216,   493037064}, {  954042224,   492671229}, {  954231090,   492305322}, {  954419817,   491939343}, 
+	{  953095785,   494499676}, {  953285353,   494134132}, {  953474781,   493768515}, {  953664069,   493402826}, 
+	{  952336111,   495961124}, {  952526240,   495595871}, {  952716228,   495230545}, {  952906077,   494865147}, 
+	{  951574196,   497421405}, {  951764885,   497056444}, {  951955434,   496691410}, {  952145842,   496326304}, 
+	{  950810042,   498880516}, {  951001290,   498515848}, {  951192399,   498151107}, {  951383367,   497786293}, 
+	{  950043650,   500338453}, {  950235458,   499974079}, {  950427126,   499609631}, {  950618654,   499245110}, 
+	{  949275023,   501795212}, {  949467390,   501431133}, {  949659616,   501066980}, {  949851703,   500702753}, 
+	{  948504163,   503250791}, {  948697087,   502887007}, {  948889872,   502523149}, {  949082517,   502159217}, 
+	{  947731070,   504705185}, {  947924552,   504341698}, {  948117895,   503978136}, {  948311099,   503614500}, 
+	{  946955747,   506158392}, {  947149787,   505795202}, {  947343687,   505431937}, {  947537448,   505068598}, 
+	{  946178196,   507610408}, {  946372792,   507247516}, {  946567250,   506884549}, {  946761568,   506521508}, 
+	{  945398418,   509061229}, {  945593571,   508698636}, {  945788585,   508335968}, {  945983460,   507973225}, 
+	{  944616416,   510510853}, {  944812125,   510148559}, {  945007695,   509786191}, {  945203126,   509423748}, 
+	{  943832191,   511959275}, {  944028456,   511597282}, {  944224582,   511235214}, {  944420568,   510873071}, 
+	{  943045745,   513406493}, {  943242565,   513044801}, {  943439246,   512683035}, {  943635788,   512321192}, 
+	{  942257081,   514852502}, {  942454455,   514491113}, {  942651690,   514129648}, {  942848787,   513768108}, 
+	{  941466198,   516297300}, {  941664127,   515936214}, {  941861917,   515575053}, {  942059568,   515213815}, 
+	{  940673101,   517740883}, {  940871583,   517380101}, {  941069926,   517019243}, {  941268132,   516658310}, 
+	{  939877790,   519183248}, {  940076825,   518822771}, {  940275722,   518462218}, {  940474481,   518101588}, 
+	{  939080267,   520624391}, {  939279855,   520264220}, {  939479305,   519903972}, {  939678616,   519543648}, 
+	{  938280535,   522064309}, {  938480675,   521704444}, {  938680677,   521344503}, {  938880541,   520984485}, 
+	{  937478595,   523502998}, {  937679287,   523143441}, {  937879841,   522783807}, {  938080257,   522424096}, 
+	{  936674448,   524940456}, {  936875692,   524581207}, {  937076797,   524221881}, {  937277765,   523862478}, 
+	{  935868098,   526376678}, {  936069892,   526017739}, {  936271549,   525658722}, {  936473067,   525299627}, 
+	{  935059546,   527811662}, {  935261890,   527453033}, {  935464097,   527094325}, {  935666166,   526735541}, 
+	{  934248793,   529245404}, {  934451687,   528887085}, {  934654444,   528528689}, {  934857064,   528170214}, 
+	{  933435842,   530677900}, {  933639286,   530319893}, {  933842592,   529961808}, {  934045761,   529603645}, 
+	{  932620694,   532109148}, {  932824687,   531751453}, {  933028542,   531393681}, {  933232261,   531035830}, 
+	{  931803352,   533539144}, {  932007893,   533181762}, {  932212297,   532824303}, {  932416564,   532466765}, 
+	{  930983817,   534967884}, {  931188906,   534610817}, {  931393859,   534253671}, {  931598674,   533896447}, 
+	{  930162092,   536395365}, {  930367728,   536038613}, {  930573228,   535681782}, {  930778591,   535324872}, 
+	{  929338177,   537821584}, {  929544361,   537465148}, {  929750408,   537108633}, {  929956318,   536752038}, 
+	{  928512076,   539246538}, {  928718807,   538890418}, {  928925400,   538534220}, {  929131857,   538177942}, 
+	{  927683790,   540670223}, {  927891067,   540314421}, {  928098206,   539958539}, {  928305210,   539602578}, 
+	{  926853322,   542092635}, {  927061143,   541737151}, {  927268829,   541381588}, {  927476378,   541025945}, 
+	{  926020672,   543513772}, {  926229039,   543158607}, {  926437269,   542803363}, {  926645363,   542448039}, 
+	{  925185843,   544933630}, {  925394754,   544578785}, {  925603530,   544223861}, {  925812169,   543868856}, 
+	{  924348837,   546352205}, {  924558292,   545997682}, {  924767612,   545643078}, {  924976795,   545288394}, 
+	{  923509656,   547769495}, {  923719655,   547415294}, {  923929518,   547061011}, {  924139246,   546706649}, 
+	{  922668302,   549185496}, {  922878844,   548831617}, {  923089250,   548477657}, {  923299521,   548123617}, 
+	{  921824777,   550600205}, {  922035861,   550246649}, {  922246810,   549893013}, {  922457624,   549539295}, 
+	{  920979082,   552013618}, {  921190709,   551660387}, {  921402200,   551307074}, {  921613556,   550953680}, 
+	{  920131221,   553425732}, {  920343389,   553072826}, {  920555422,   552719838}, {  920767320,   552366769}, 
+	{  919281194,   554836544}, {  919493904,   554483964}, {  919706478,   554131301}, {  919918917,   553778558}, 
+	{  918429004,   556246051}, {  918642254,   555893797}, {  918855369,   555541461}, {  919068349,   555189044}, 
+	{  917574653,   557654248}, {  917788443,   557302322}, {  918002099,   556950313}, {  918215619,   556598223}, 
+	{  916718143,   559061133}, {  916932473,   558709535}, {  917146668,   558357855}, {  917360728,   558006093}, 
+	{  915859476,   560466703}, {  916074345,   560115434}, {  916289079,   559764083}, {  916503678,   559412649}, 
+	{  914998653,   561870954}, {  915214061,   561520015}, {  915429334,   561168994}, {  915644472,   560817890}, 
+	{  914135678,   563273883}, {  914351624,   562923275}, {  914567435,   562572584}, {  914783111,   562221810}, 
+	{  913270551,   564675486}, {  913487035,   564325210}, {  913703383,   563974850}, {  913919598,   563624408}, 
+	{  912403276,   566075761}, {  912620296,   565725817}, {  912837182,   565375790}, {  913053934,   565025679}, 
+	{  911533853,   567474703}, {  911751410,   567125093}, {  911968833,   566775399}, {  912186121,   566425621}, 
+	{  910662286,   568872310}, {  910880379,   568523034}, {  911098338,   568173674}, {  911316163,   567824230}, 
+	{  909788576,   570268579}, {  910007204,   569919637}, {  910225699,   569570612}, {  910444059,   569221503}, 
+	{  908912725,   571663506}, {  909131888,   571314900}, {  909350918,   570966210}, {  909569814,   570617437}, 
+	{  908034735,   573057087}, {  908254433,   572708818}, {  908473997,   572360465}, {  908693428,   572012027}, 
+	{  907154608,   574449320}, {  907374840,   574101389}, {  907594938,   573753372}, {  907814903,   573405272}, 
+	{  906272347,   575840202}, {  906493112,   575492608}, {  906713744,   575144930}, {  906934243,   574797167}, 
+	{  905387953,   577229728}, {  905609251,   576882473}, {  905830417,   576535134}, {  906051448,   576187710}, 
+	{  904501429,   578617896}, {  904723260,   578270981}, {  904944957,   577923982}, {  905166522,   577576897}, 
+	{  903612776,   580004702}, {  903835139,   579658129}, {  904057369,   579311470}, {  904279465,   578964725}, 
+	{  902721998,   581390144}, {  902944892,   581043912}, {  903167653,   580697594}, {  903390281,   580351191}, 
+	{  901829095,   582774218}, {  902052519,   582428328}, {  902275811,   582082352}, {  902498971,   581736291}, 
+	{  900934069,   584156920}, {  901158025,   583811373}, {  901381847,   583465740}, {  901605537,   583120022}, 
+	{  900036924,   585538248}, {  900261409,   585193045}, {  900485762,   584847756}, {  900709982,   584502381}, 
+	{  899137661,   586918198}, {  899362675,   586573340}, {  899587557,   586228395}, {  899812307,   585883365}, 
+	{  898236282,   588296766}, {  898461825,   587952254}, {  898687236,   587607655}, {  898912515,   587262969}, 
+	{  897332790,   589673951}, {  897558861,   589329785}, {  897784800,   588985532}, {  898010607,   588641192}, 
+	{  896427186,   591049748}, {  896653785,   590705929}, {  896880252,   590362023}, {  897106587,   590018030}, 
+	{  895519473,   592424154}, {  895746599,   592080683}, {  895973593,   591737125}, {  896200456,   591393480}, 
+	{  894609652,   593797166}, {  894837305,   593454044}, {  895064826,   593110835}, {  895292215,   592767538}, 
+	{  893697727,   595168781}, {  893925905,   594826008}, {  894153953,   594483148}, {  894381868,   594140201}, 
+	{  892783698,   596538995}, {  893012402,   596196573}, {  893240975,   595854063}, {  893469417,   595511466}, 
+	{  891867569,   597907806}, {  892096798,   597565735}, {  892325896,   597223576}, {  892554863,   596881330}, 
+	{  890949341,   599275210}, {  891179094,   598933491}, {  891408717,   598591684}, {  891638208,   598249789}, 
+	{  890029016,   600641203}, {  890259294,   600299837}, {  890489440,   599958383}, {  890719456,   599616840}, 
+	{  889106597,   602005783}, {  889337398,   601664771}, {  889568068,   601323670}, {  889798608,   600982481}, 
+	{  888182086,   603368947}, {  888413410,   603028289}, {  888644603,   602687543}, {  888875666,   602346707}, 
+	{  887255485,   604730691}, {  887487331,   604390388}, {  887719047,   604049997}, {  887950632,   603709516}, 
+	{  886326796,   606091012}, {  886559164,   605751065}, {  886791402,   605411029}, {  887023509,   605070905}, 
+	{  885396022,   607449906}, {  885628911,   607110317}, {  885861670,   606770638}, {  886094298,   606430869}, 
+	{  884463164,   608807372}, {  884696574,   608468140}, {  884929853,   608128818}, {  885163003,   607789407}, 
+	{  883528225,   610163404}, {  883762155,   609824531}, {  883995955,   609485567}, {  884229624,   609146514}, 
+	{  882591207,   611518001}, {  882825656,   611179487}, {  883059976,   610840882}, {  883294165,   610502188}, 
+	{  881652112,   612871159}, {  881887080,   612533005}, {  882121919,   612194760}, {  882356628,   611856426}, 
+	{  880710943,   614222875}, {  880946429,   613885081}, {  881181787,   613547198}, {  881417014,   613209223}, 
+	{  879767701,   615573145}, {  880003705,   615235714}, {  880239581,   614898191}, {  880475326,   614560578}, 
+	{  878822389,   616921967}, {  879058911,   616584898}, {  879295303,   616247738}, {  879531567,   615910487}, 
+	{  877875009,   618269338}, {  878112047,   617932631}, {  878348957,   617595834}, {  878585737,   617258946}, 
+	{  876925563,   619615253}, {  877163118,   619278911}, {  877400544,   618942478}, {  877637841,   618605953}, 
+	{  875974054,   620959711}, {  876212124,   620623733}, {  876450066,   620287664}, {  876687879,   619951504}, 
+	{  875020483,   622302707}, {  875259069,   621967095}, {  875497526,   621631392}, {  875735854,   621295597}, 
+	{  874064853,   623644239}, {  874303954,   623308993}, {  874542925,   622973656}, {  874781769,   622638227}, 
+	{  873107167,   624984303}, {  873346781,   624649425}, {  873586267,   624314455}, {  873825625,   623979393}, 
+	{  872147426,   626322897}, {  872387554,   625988387}, {  872627553,   625653784}, {  872867424,   625319090}, 
+	{  871185633,   627660017}, {  871426274,   627325875}, {  871666786,   626991641}, {  871907170,   626657315}, 
+	{  870221790,   628995660}, {  870462943,   628661888}, {  870703968,   628328023}, {  870944865,   627994066}, 
+	{  869255900,   630329823}, {  869497564,   629996421}, {  869739101,   629662927}, {  869980510,   629329340}, 
+	{  868287963,   631662503}, {  868530139,   631329472}, {  868772187,   630996348}, {  869014107,   630663132}, 
+	{  867317984,   632993696}, {  867560670,   632661037}, {  867803229,   632328285}, {  868045660,   631995440}, 
+	{  866345964,   634323400}, {  866589160,   633991114}, {  866832229,   633658734}, {  867075170,   633326262}, 
+	{  865371905,   635651611}, {  865615611,   635319698}, {  865859189,   634987692}, {  866102640,   634655593}, 
+	{  864395810,   636978327}, {  864640024,   636646788}, {  864884112,   636315156}, {  865128072,   635983430}, 
+	{  863417681,   638303543}, {  863662404,   637972380}, {  863906999,   637641122}, {  864151468,   637309771}, 
+	{  862437520,   639627258}, {  862682750,   639296470}, {  862927854,   638965588}, {  863172831,   638634613}, 
+	{  861455330,   640949467}, {  861701067,   640619056}, {  861946678,   640288551}, {  862192163,   639957951}, 
+	{  860471112,   642270169}, {  860717357,   641940135}, {  860963474,   641610007}, {  861209465,   641279784}, 
+	{  859484870,   643589359}, {  859731620,   643259703}, {  859978244,   642929953}, {  860224742,   642600108}, 
+	{  858496606,   644907034}, {  858743861,   644577757}, {  858990991,   644248386}, {  859237994,   643918920}, 
+	{  857506321,   646223192}, {  857754081,   645894295}, {  858001716,   645565303}, {  858249224,   645236216}, 
+	{  856514019,   647537830}, {  856762283,   647209313}, {  857010422,   646880701}, {  857258434,   646551994}, 
+	{  855519701,   648850943}, {  855768469,   648522808}, {  856017111,   648194577}, {  856265628,   647866251}, 
+	{  854523370,   650162530}, {  854772641,   649834777}, {  855021787,   649506928}, {  855270806,   649178983}, 
+	{  853525028,   651472587}, {  853774802,   651145216}, {  854024450,   650817750}, {  854273973,   650490188}, 
+	{  852524677,   652781111}, {  852774953,   652454124}, {  853025104,   652127041}, {  853275128,   651799862}, 
+	{  851522321,   654088099}, {  851773098,   653761496}, {  852023750,   653434797}, {  852274276,   653108002}, 
+	{  850517961,   655393548}, {  850769239,   655067330}, {  851020391,   654741016}, {  851271419,   654414606}, 
+	{  849511600,   656697454}, {  849763378,   656371622}, {  850015030,   656045694}, {  850266558,   655719669}, 
+	{  848503239,   657999816}, {  848755517,   657674370}, {  849007669,   657348828}, {  849259697,   657023190}, 
+	{  847492882,   659300629}, {  847745659,   658975571}, {  847998310,   658650416}, {  848250837,   658325164}, 
+	{  846480531,   660599890}, {  846733806,   660275220}, {  846986956,   659950454}, {  847239981,   659625590}, 
+	{  845466188,   661897597}, {  845719960,   661573317}, {  845973608,   661248938}, {  846227132,   660924463}, 
+	{  844449856,   663193747}, {  844704125,   662869856}, {  844958270,   662545867}, {  845212291,   662221781}, 
+	{  843431536,   664488336}, {  843686302,   664164835}, {  843940944,   663841237}, {  844195462,   663517541}, 
+	{  842411232,   665781362}, {  842666494,   665458252}, {  842921632,   665135044}, {  843176646,   664811739}, 
+	{  841388945,   667072820}, {  841644702,   666750103}, {  841900336,   666427287}, {  842155846,   666104373}, 
+	{  840364679,   668362709}, {  840620931,   668040385}, {  840877059,   667717961}, {  841133064,   667395440}, 
+	{  839338435,   669651026}, {  839595181,   669329094}, {  839851804,   669007064}, {  840108303,   668684936}, 
+	{  838310216,   670937767}, {  838567456,   670616229}, {  838824572,   670294593}, {  839081565,   669972859}, 
+	{  837280024,   672222928}, {  837537757,   671901786}, {  837795367,   671580545}, {  838052853,   671259205}, 
+	{  836247863,   673506508}, {  836506088,   673185762}, {  836764190,   672864916}, {  837022168,   672543972}, 
+	{  835213733,   674788504}, {  835472450,   674468154}, {  835731044,   674147704}, {  835989515,   673827156}, 
+	{  834177638,   676068911}, {  834436846,   675748958}, {  834695931,   675428906}, {  834954893,   675108755}, 
+	{  833139580,   677347728}, {  833399279,   677028173}, {  833658855,   676708518}, {  833918308,   676388765}, 
+	{  832099562,   678624950}, {  832359750,   678305794}, {  832619816,   677986538}, {  832879760,   677667183}, 
+	{  831057586,   679900576}, {  831318263,   679581820}, {  831578819,   679262963}, {  831839252,   678944007}, 
+	{  830013654,   681174602}, {  830274820,   680856246}, {  830535864,   680537789}, {  830796786,   680219233}, 
+	{  828967769,   682447025}, {  829229423,   682129070}, {  829490956,   681811014}, {  829752366,   681492858}, 
+	{  827919934,   683717842}, {  828182075,   683400289}, {  828444095,   683082635}, {  828705993,   682764880}, 
+	{  826870150,   684987051}, {  827132778,   684669900}, {  827395285,   684352648}, {  827657670,   684035295}, 
+	{  825818421,   686254647}, {  826081535,   685937899}, {  826344528,   685621051}, {  826607400,   685304101}, 
+	{  824764748,   687520629}, {  825028348,   687204285}, {  825291827,   686887840}, {  825555185,   686571294}, 
+	{  823709135,   688784993}, {  823973220,   688469054}, {  824237184,   688153013}, {  824501026,   687836872}, 
+	{  822651583,   690047736}, {  822916152,   689732202}, {  823180601,   689416567}, {  823444928,   689100831}, 
+	{  821592095,   691308855}, {  821857149,   690993728}, {  822122081,   690678499}, {  822386892,   690363168}, 
+	{  820530675,   692568348}, {  820796211,   692253627}, {  821061627,   691938805}, {  821326921,   691623881}, 
+	{  819467323,   693826211}, {  819733342,   693511898}, {  819999240,   693197483}, {  820265018,   692882966}, 
+	{  818402043,   695082441}, {  818668544,   694768537}, {  818934924,   694454530}, {  819201184,   694140422}, 
+	{  817334838,   696337036}, {  817601820,   696023541}, {  817868681,   695709943}, {  818135422,   695396243}, 
+	{  816265709,   697589992}, {  816533171,   697276907}, {  816800514,   696963719}, {  817067736,   696650429}, 
+	{  815194659,   698841307}, {  815462602,   698528632}, {  815730424,   698215855}, {  815998127,   697902975}, 
+	{  814121692,   700090977}, {  814390113,   699778714}, {  814658415,   699466348}, {  814926597,   699153879}, 
+	{  813046808,   701339000}, {  813315708,   701027149}, {  813584489,   700715194}, {  813853150,   700403137}, 
+	{  811970011,   702585372}, {  812239390,   702273934}, {  812508649,   701962393}, {  812777788,   701650748}, 
+	{  810891304,   703830092}, {  811161160,   703519067}, {  811430896,   703207939}, {  811700513,   702896707}, 
+	{  809810688,   705073155}, {  810081021,   704762544}, {  810351235,   704451830}, {  810621329,   704141013}, 
+	{  808728167,   706314559}, {  808998976,   706004363}, {  809269666,   705694064}, {  809540237,   705383661}, 
+	{  807643743,   707554301}, {  807915028,   707244521}, {  808186193,   706934638}, {  808457240,   706624650}, 
+	{  806557419,   708792378}, {  806829178,   708483015}, {  807100819,   708173547}, {  807372340,   707863976}, 
+	{  805469196,   710028787}, {  805741430,   709719841}, {  806013545,   709410791}, {  806285541,   709101636}, 
+	{  804379079,   711263525}, {  804651786,   710954997}, {  804924374,   710646365}, {  805196845,   710337628}, 
+	{  803287068,   712496590}, {  803560248,   712188481}, {  803833310,   711880267}, {  804106253,   711571948}, 
+	{  802193167,   713727978}, {  802466820,   713420288}, {  802740354,   713112494}, {  803013770,   712804594}, 
+	{  801097379,   714957687}, {  801371503,   714650417}, {  801645509,   714343043}, {  801919397,   714035563}, 
+	{  799999706,   716185713}, {  800274300,   715878864}, {  800548778,   715571910}, {  800823137,   715264851}, 
+	{  798900150,   717412054}, {  799175215,   717105627}, {  799450163,   716799095}, {  799724993,   716492457}, 
+	{  797798714,   718636707}, {  798074249,   718330702}, {  798349667,   718024592}, {  798624967,   717718376}, 
+	{  796695401,   719859669}, {  796971405,   719554087}, {  797247292,   719248400}, {  797523061,   718942606}, 
+	{  795590213,   721080937}, {  795866685,   720775779}, {  796143041,   720470515}, {  796419279,   720165145}, 
+	{  794483153,   722300508}, {  794760093,   721995775}, {  795036917,   721690935}, {  795313623,   721385989}, 
+	{  793374223,   723518380}, {  793651631,   723214072}, {  793928922,   722909657}, {  794206096,   722605136}, 
+	{  792263427,   724734549}, {  792541301,   724430667}, {  792819059,   724126677}, {  793096699,   723822582}, 
+	{  791150767,   725949013}, {  791429106,   725645557}, {  791707330,   725341994}, {  791985437,   725038325}, 
+	{  790036244,   727161768}, {  790315049,   726858740}, {  790593738,   726555604}, {  790872310,   726252362}, 
+	{  788919863,   728372813}, {  789199133,   728070212}, {  789478286,   727767504}, {  789757323,   727464690}, 
+	{  787801625,   729582143}, {  788081359,   729279971}, {  788360976,   728977692}, {  788640478,   728675306}, 
+	{  786681534,   730789757}, {  786961731,   730488014}, {  787241811,   730186165}, {  787521776,   729884208}, 
+	{  785559591,   731995651}, {  785840250,   731694339}, {  786120794,   731392919}, {  786401222,   731091392}, 
+	{  784435800,   733199822}, {  784716921,   732898941}, {  784997927,   732597952}, {  785278817,   732296855}, 
+	{  783310163,   734402269}, {  783591746,   734101819}, {  783873212,   733801261}, {  784154564,   733500596}, 
+	{  782182683,   735602987}, {  782464726,   735302970}, {  782746654,   735002844}, {  783028466,   734702610}, 
+	{  781053363,   736801974}, {  781335865,   736502390}, {  781618253,   736202697}, {  781900526,   735902896}, 
+	{  779922204,   737999228}, {  780205166,   737700077}, {  780488013,   737400818}, {  780770745,   737101450}, 
+	{  778789210,   739194745}, {  779072631,   738896028}, {  779355936,   738597203}, {  779639128,   738298270}, 
+	{  777654384,   740388522}, {  777938262,   740090241}, {  778222026,   739791851}, {  778505675,   739493352}, 
+	{  776517728,   741580558}, {  776802063,   741282712}, {  777086284,   740984758}, {  777370391,   740686694}, 
+	{  775379244,   742770848}, {  775664036,   742473439}, {  775948714,   742175921}, {  776233278,   741878294}, 
+	{  774238936,   743959390}, {  774524184,   743662419}, {  774809318,   743365338}, {  775094338,   743068147}, 
+	{  773096806,   745146182}, {  773382509,   744849649}, {  773668099,   744553005}, {  773953574,   744256253}, 
+	{  771952857,   746331221}, {  772239015,   746035126}, {  772525059,   745738921}, {  772810989,   745442606}, 
+	{  770807092,   747514503}, {  771093703,   747218847}, {  771380201,   746923082}, {  771666586,   746627206}, 
+	{  769659512,   748696026}, {  769946577,   748400811}, {  770233528,   748105485}, {  770520367,   747810049}, 
+	{  768510122,   749875788}, {  768797639,   749581013}, {  769085043,   749286127}, {  769372334,   748991132}, 
+	{  767358923,   751053785}, {  767646892,   750759451}, {  767934748,   750465007}, {  768222492,   750170453}, 
+	{  766205919,   752230015}, {  766494339,   751936123}, {  766782646,   751642121}, {  767070841,   751348008}, 
+	{  765051111,   753404474}, {  765339982,   753111025}, {  765628740,   752817466}, {  765917386,   752523796}, 
+	{  763894504,   754577161}, {  764183824,   754284156}, {  764473032,   753991040}, {  764762128,   753697812}, 
+	{  762736098,   755748072}, {  763025868,   755455511}, {  763315525,   755162839}, {  763605071,   754870056}, 
+	{  761575898,   756917205}, {  761866116,   756625089}, {  762156223,   756332861}, {  762446217,   756040522}, 
+	{  760413906,   758084557}, {  760704572,   757792886}, {  760995126,   757501104}, {  761285568,   757209210}, 
+	{  759250125,   759250125}, {  759541238,   758958900}, {  759832239,   758667564}, {  760123129,   758376116}, 
+	{  758084557,   760413906}, {  758376116,   760123129}, {  758667564,   759832239}, {  758958900,   759541238}, 
+	{  756917205,   761575898}, {  757209210,   761285568}, {  757501104,   760995126}, {  757792886,   760704572}, 
+	{  755748072,   762736098}, {  756040522,   762446217}, {  756332861,   762156223}, {  756625089,   761866116}, 
+	{  754577161,   763894504}, {  754870056,   763605071}, {  755162839,   763315525}, {  755455511,   763025868}, 
+	{  753404474,   765051111}, {  753697812,   764762128}, {  753991040,   764473032}, {  754284156,   764183824}, 
+	{  752230015,   766205919}, {  752523796,   765917386}, {  752817466,   765628740}, {  753111025,   765339982}, 
+	{  751053785,   767358923}, {  751348008,   767070841}, {  751642121,   766782646}, {  751936123,   766494339}, 
+	{  749875788,   768510122}, {  750170453,   768222492}, {  750465007,   767934748}, {  750759451,   767646892}, 
+	{  748696026,   769659512}, {  748991132,   769372334}, {  749286127,   769085043}, {  749581013,   768797639}, 
+	{  747514503,   770807092}, {  747810049,   770520367}, {  748105485,   770233528}, {  748400811,   769946577}, 
+	{  746331221,   771952857}, {  746627206,   771666586}, {  746923082,   771380201}, {  747218847,   771093703}, 
+	{  745146182,   773096806}, {  745442606,   772810989}, {  745738921,   772525059}, {  746035126,   772239015}, 
+	{  743959390,   774238936}, {  744256253,   773953574}, {  744553005,   773668099}, {  744849649,   773382509}, 
+	{  742770848,   775379244}, {  743068147,   775094338}, {  743365338,   774809318}, {  743662419,   774524184}, 
+	{  741580558,   776517728}, {  741878294,   776233278}, {  742175921,   775948714}, {  742473439,   775664036}, 
+	{  740388522,   777654384}, {  740686694,   777370391}, {  740984758,   777086284}, {  741282712,   776802063}, 
+	{  739194745,   778789210}, {  739493352,   778505675}, {  739791851,   778222026}, {  740090241,   777938262}, 
+	{  737999228,   779922204}, {  738298270,   779639128}, {  738597203,   779355936}, {  738896028,   779072631}, 
+	{  736801974,   781053363}, {  737101450,   780770745}, {  737400818,   780488013}, {  737700077,   780205166}, 
+	{  735602987,   782182683}, {  735902896,   781900526}, {  736202697,   781618253}, {  736502390,   781335865}, 
+	{  734402269,   783310163}, {  734702610,   783028466}, {  735002844,   782746654}, {  735302970,   782464726}, 
+	{  733199822,   784435800}, {  733500596,   784154564}, {  733801261,   783873212}, {  734101819,   783591746}, 
+	{  731995651,   785559591}, {  732296855,   785278817}, {  732597952,   784997927}, {  732898941,   784716921}, 
+	{  730789757,   786681534}, {  731091392,   786401222}, {  731392919,   786120794}, {  731694339,   785840250}, 
+	{  729582143,   787801625}, {  729884208,   787521776}, {  730186165,   787241811}, {  730488014,   786961731}, 
+	{  728372813,   788919863}, {  728675306,   788640478}, {  728977692,   788360976}, {  729279971,   788081359}, 
+	{  727161768,   790036244}, {  727464690,   789757323}, {  727767504,   789478286}, {  728070212,   789199133}, 
+	{  725949013,   791150767}, {  726252362,   790872310}, {  726555604,   790593738}, {  726858740,   790315049}, 
+	{  724734549,   792263427}, {  725038325,   791985437}, {  725341994,   791707330}, {  725645557,   791429106}, 
+	{  723518380,   793374223}, {  723822582,   793096699}, {  724126677,   792819059}, {  724430667,   792541301}, 
+	{  722300508,   794483153}, {  722605136,   794206096}, {  722909657,   793928922}, {  723214072,   793651631}, 
+	{  721080937,   795590213}, {  721385989,   795313623}, {  721690935,   795036917}, {  721995775,   794760093}, 
+	{  719859669,   796695401}, {  720165145,   796419279}, {  720470515,   796143041}, {  720775779,   795866685}, 
+	{  718636707,   797798714}, {  718942606,   797523061}, {  719248400,   797247292}, {  719554087,   796971405}, 
+	{  717412054,   798900150}, {  717718376,   798624967}, {  718024592,   798349667}, {  718330702,   798074249}, 
+	{  716185713,   799999706}, {  716492457,   799724993}, {  716799095,   799450163}, {  717105627,   799175215}, 
+	{  714957687,   801097379}, {  715264851,   800823137}, {  715571910,   800548778}, {  715878864,   800274300}, 
+	{  713727978,   802193167}, {  714035563,   801919397}, {  714343043,   801645509}, {  714650417,   801371503}, 
+	{  712496590,   803287068}, {  712804594,   803013770}, {  713112494,   802740354}, {  713420288,   802466820}, 
+	{  711263525,   804379079}, {  711571948,   804106253}, {  711880267,   803833310}, {  712188481,   803560248}, 
+	{  710028787,   805469196}, {  710337628,   805196845}, {  710646365,   804924374}, {  710954997,   804651786}, 
+	{  708792378,   806557419}, {  709101636,   806285541}, {  709410791,   806013545}, {  709719841,   805741430}, 
+	{  707554301,   807643743}, {  707863976,   807372340}, {  708173547,   807100819}, {  708483015,   806829178}, 
+	{  706314559,   808728167}, {  706624650,   808457240}, {  706934638,   808186193}, {  707244521,   807915028}, 
+	{  705073155,   809810688}, {  705383661,   809540237}, {  705694064,   809269666}, {  706004363,   808998976}, 
+	{  703830092,   810891304}, {  704141013,   810621329}, {  704451830,   810351235}, {  704762544,   810081021}, 
+	{  702585372,   811970011}, {  702896707,   811700513}, {  703207939,   811430896}, {  703519067,   811161160}, 
+	{  701339000,   813046808}, {  701650748,   812777788}, {  701962393,   812508649}, {  702273934,   812239390}, 
+	{  700090977,   814121692}, {  700403137,   813853150}, {  700715194,   813584489}, {  701027149,   813315708}, 
+	{  698841307,   815194659}, {  699153879,   814926597}, {  699466348,   814658415}, {  699778714,   814390113}, 
+	{  697589992,   816265709}, {  697902975,   815998127}, {  698215855,   815730424}, {  698528632,   815462602}, 
+	{  696337036,   817334838}, {  696650429,   817067736}, {  696963719,   816800514}, {  697276907,   816533171}, 
+	{  695082441,   818402043}, {  695396243,   818135422}, {  695709943,   817868681}, {  696023541,   817601820}, 
+	{  693826211,   819467323}, {  694140422,   819201184}, {  694454530,   818934924}, {  694768537,   818668544}, 
+	{  692568348,   820530675}, {  692882966,   820265018}, {  693197483,   819999240}, {  693511898,   819733342}, 
+	{  691308855,   821592095}, {  691623881,   821326921}, {  691938805,   821061627}, {  692253627,   820796211}, 
+	{  690047736,   822651583}, {  690363168,   822386892}, {  690678499,   822122081}, {  690993728,   821857149}, 
+	{  688784993,   823709135}, {  689100831,   823444928}, {  689416567,   823180601}, {  689732202,   822916152}, 
+	{  687520629,   824764748}, {  687836872,   824501026}, {  688153013,   824237184}, {  688469054,   823973220}, 
+	{  686254647,   825818421}, {  686571294,   825555185}, {  686887840,   825291827}, {  687204285,   825028348}, 
+	{  684987051,   826870150}, {  685304101,   826607400}, {  685621051,   826344528}, {  685937899,   826081535}, 
+	{  683717842,   827919934}, {  684035295,   827657670}, {  684352648,   827395285}, {  684669900,   827132778}, 
+	{  682447025,   828967769}, {  682764880,   828705993}, {  683082635,   828444095}, {  683400289,   828182075}, 
+	{  681174602,   830013654}, {  681492858,   829752366}, {  681811014,   829490956}, {  682129070,   829229423}, 
+	{  679900576,   831057586}, {  680219233,   830796786}, {  680537789,   830535864}, {  680856246,   830274820}, 
+	{  678624950,   832099562}, {  678944007,   831839252}, {  679262963,   831578819}, {  679581820,   831318263}, 
+	{  677347728,   833139580}, {  677667183,   832879760}, {  677986538,   832619816}, {  678305794,   832359750}, 
+	{  676068911,   834177638}, {  676388765,   833918308}, {  676708518,   833658855}, {  677028173,   833399279}, 
+	{  674788504,   835213733}, {  675108755,   834954893}, {  675428906,   834695931}, {  675748958,   834436846}, 
+	{  673506508,   836247863}, {  673827156,   835989515}, {  674147704,   835731044}, {  674468154,   835472450}, 
+	{  672222928,   837280024}, {  672543972,   837022168}, {  672864916,   836764190}, {  673185762,   836506088}, 
+	{  670937767,   838310216}, {  671259205,   838052853}, {  671580545,   837795367}, {  671901786,   837537757}, 
+	{  669651026,   839338435}, {  669972859,   839081565}, {  670294593,   838824572}, {  670616229,   838567456}, 
+	{  668362709,   840364679}, {  668684936,   840108303}, {  669007064,   839851804}, {  669329094,   839595181}, 
+	{  667072820,   841388945}, {  667395440,   841133064}, {  667717961,   840877059}, {  668040385,   840620931}, 
+	{  665781362,   842411232}, {  666104373,   842155846}, {  666427287,   841900336}, {  666750103,   841644702}, 
+	{  664488336,   843431536}, {  664811739,   843176646}, {  665135044,   842921632}, {  665458252,   842666494}, 
+	{  663193747,   844449856}, {  663517541,   844195462}, {  663841237,   843940944}, {  664164835,   843686302}, 
+	{  661897597,   845466188}, {  662221781,   845212291}, {  662545867,   844958270}, {  662869856,   844704125}, 
+	{  660599890,   846480531}, {  660924463,   846227132}, {  661248938,   845973608}, {  661573317,   845719960}, 
+	{  659300629,   847492882}, {  659625590,   847239981}, {  659950454,   846986956}, {  660275220,   846733806}, 
+	{  657999816,   848503239}, {  658325164,   848250837}, {  658650416,   847998310}, {  658975571,   847745659}, 
+	{  656697454,   849511600}, {  657023190,   849259697}, {  657348828,   849007669}, {  657674370,   848755517}, 
+	{  655393548,   850517961}, {  655719669,   850266558}, {  656045694,   850015030}, {  656371622,   849763378}, 
+	{  654088099,   851522321}, {  654414606,   851271419}, {  654741016,   851020391}, {  655067330,   850769239}, 
+	{  652781111,   852524677}, {  653108002,   852274276}, {  653434797,   852023750}, {  653761496,   851773098}, 
+	{  651472587,   853525028}, {  651799862,   853275128}, {  652127041,   853025104}, {  652454124,   852774953}, 
+	{  650162530,   854523370}, {  650490188,   854273973}, {  650817750,   854024450}, {  651145216,   853774802}, 
+	{  648850943,   855519701}, {  649178983,   855270806}, {  649506928,   855021787}, {  649834777,   854772641}, 
+	{  647537830,   856514019}, {  647866251,   856265628}, {  648194577,   856017111}, {  648522808,   855768469}, 
+	{  646223192,   857506321}, {  646551994,   857258434}, {  646880701,   857010422}, {  647209313,   856762283}, 
+	{  644907034,   858496606}, {  645236216,   858249224}, {  645565303,   858001716}, {  645894295,   857754081}, 
+	{  643589359,   859484870}, {  643918920,   859237994}, {  644248386,   858990991}, {  644577757,   858743861}, 
+	{  642270169,   860471112}, {  642600108,   860224742}, {  642929953,   859978244}, {  643259703,   859731620}, 
+	{  640949467,   861455330}, {  641279784,   861209465}, {  641610007,   860963474}, {  641940135,   860717357}, 
+	{  639627258,   862437520}, {  639957951,   862192163}, {  640288551,   861946678}, {  640619056,   861701067}, 
+	{  638303543,   863417681}, {  638634613,   863172831}, {  638965588,   862927854}, {  639296470,   862682750}, 
+	{  636978327,   864395810}, {  637309771,   864151468}, {  637641122,   863906999}, {  637972380,   863662404}, 
+	{  635651611,   865371905}, {  635983430,   865128072}, {  636315156,   864884112}, {  636646788,   864640024}, 
+	{  634323400,   866345964}, {  634655593,   866102640}, {  634987692,   865859189}, {  635319698,   865615611}, 
+	{  632993696,   867317984}, {  633326262,   867075170}, {  633658734,   866832229}, {  633991114,   866589160}, 
+	{  631662503,   868287963}, {  631995440,   868045660}, {  632328285,   867803229}, {  632661037,   867560670}, 
+	{  630329823,   869255900}, {  630663132,   869014107}, {  630996348,   868772187}, {  631329472,   868530139}, 
+	{  628995660,   870221790}, {  629329340,   869980510}, {  629662927,   869739101}, {  629996421,   869497564}, 
+	{  627660017,   871185633}, {  627994066,   870944865}, {  628328023,   870703968}, {  628661888,   870462943}, 
+	{  626322897,   872147426}, {  626657315,   871907170}, {  626991641,   871666786}, {  627325875,   871426274}, 
+	{  624984303,   873107167}, {  625319090,   872867424}, {  625653784,   872627553}, {  625988387,   872387554}, 
+	{  623644239,   874064853}, {  623979393,   873825625}, {  624314455,   873586267}, {  624649425,   873346781}, 
+	{  622302707,   875020483}, {  622638227,   874781769}, {  622973656,   874542925}, {  623308993,   874303954}, 
+	{  620959711,   875974054}, {  621295597,   875735854}, {  621631392,   875497526}, {  621967095,   875259069}, 
+	{  619615253,   876925563}, {  619951504,   876687879}, {  620287664,   876450066}, {  620623733,   876212124}, 
+	{  618269338,   877875009}, {  618605953,   877637841}, {  618942478,   877400544}, {  619278911,   877163118}, 
+	{  616921967,   878822389}, {  617258946,   878585737}, {  617595834,   878348957}, {  617932631,   878112047}, 
+	{  615573145,   879767701}, {  615910487,   879531567}, {  616247738,   879295303}, {  616584898,   879058911}, 
+	{  614222875,   880710943}, {  614560578,   880475326}, {  614898191,   880239581}, {  615235714,   880003705}, 
+	{  612871159,   881652112}, {  613209223,   881417014}, {  613547198,   881181787}, {  613885081,   880946429}, 
+	{  611518001,   882591207}, {  611856426,   882356628}, {  612194760,   882121919}, {  612533005,   881887080}, 
+	{  610163404,   883528225}, {  610502188,   883294165}, {  610840882,   883059976}, {  611179487,   882825656}, 
+	{  608807372,   884463164}, {  609146514,   884229624}, {  609485567,   883995955}, {  609824531,   883762155}, 
+	{  607449906,   885396022}, {  607789407,   885163003}, {  608128818,   884929853}, {  608468140,   884696574}, 
+	{  606091012,   886326796}, {  606430869,   886094298}, {  606770638,   885861670}, {  607110317,   885628911}, 
+	{  604730691,   887255485}, {  605070905,   887023509}, {  605411029,   886791402}, {  605751065,   886559164}, 
+	{  603368947,   888182086}, {  603709516,   887950632}, {  604049997,   887719047}, {  604390388,   887487331}, 
+	{  602005783,   889106597}, {  602346707,   888875666}, {  602687543,   888644603}, {  603028289,   888413410}, 
+	{  600641203,   890029016}, {  600982481,   889798608}, {  601323670,   889568068}, {  601664771,   889337398}, 
+	{  599275210,   890949341}, {  599616840,   890719456}, {  599958383,   890489440}, {  600299837,   890259294}, 
+	{  597907806,   891867569}, {  598249789,   891638208}, {  598591684,   891408717}, {  598933491,   891179094}, 
+	{  596538995,   892783698}, {  596881330,   892554863}, {  597223576,   892325896}, {  597565735,   892096798}, 
+	{  595168781,   893697727}, {  595511466,   893469417}, {  595854063,   893240975}, {  596196573,   893012402}, 
+	{  593797166,   894609652}, {  594140201,   894381868}, {  594483148,   894153953}, {  594826008,   893925905}, 
+	{  592424154,   895519473}, {  592767538,   895292215}, {  593110835,   895064826}, {  593454044,   894837305}, 
+	{  591049748,   896427186}, {  591393480,   896200456}, {  591737125,   895973593}, {  592080683,   895746599}, 
+	{  589673951,   897332790}, {  590018030,   897106587}, {  590362023,   896880252}, {  590705929,   896653785}, 
+	{  588296766,   898236282}, {  588641192,   898010607}, {  588985532,   897784800}, {  589329785,   897558861}, 
+	{  586918198,   899137661}, {  587262969,   898912515}, {  587607655,   898687236}, {  587952254,   898461825}, 
+	{  585538248,   900036924}, {  585883365,   899812307}, {  586228395,   899587557}, {  586573340,   899362675}, 
+	{  584156920,   900934069}, {  584502381,   900709982}, {  584847756,   900485762}, {  585193045,   900261409}, 
+	{  582774218,   901829095}, {  583120022,   901605537}, {  583465740,   901381847}, {  583811373,   901158025}, 
+	{  581390144,   902721998}, {  581736291,   902498971}, {  582082352,   902275811}, {  582428328,   902052519}, 
+	{  580004702,   903612776}, {  580351191,   903390281}, {  580697594,   903167653}, {  581043912,   902944892}, 
+	{  578617896,   904501429}, {  578964725,   904279465}, {  579311470,   904057369}, {  579658129,   903835139}, 
+	{  577229728,   905387953}, {  577576897,   905166522}, {  577923982,   904944957}, {  578270981,   904723260}, 
+	{  575840202,   906272347}, {  576187710,   906051448}, {  576535134,   905830417}, {  576882473,   905609251}, 
+	{  574449320,   907154608}, {  574797167,   906934243}, {  575144930,   906713744}, {  575492608,   906493112}, 
+	{  573057087,   908034735}, {  573405272,   907814903}, {  573753372,   907594938}, {  574101389,   907374840}, 
+	{  571663506,   908912725}, {  572012027,   908693428}, {  572360465,   908473997}, {  572708818,   908254433}, 
+	{  570268579,   909788576}, {  570617437,   909569814}, {  570966210,   909350918}, {  571314900,   909131888}, 
+	{  568872310,   910662286}, {  569221503,   910444059}, {  569570612,   910225699}, {  569919637,   910007204}, 
+	{  567474703,   911533853}, {  567824230,   911316163}, {  568173674,   911098338}, {  568523034,   910880379}, 
+	{  566075761,   912403276}, {  566425621,   912186121}, {  566775399,   911968833}, {  567125093,   911751410}, 
+	{  564675486,   913270551}, {  565025679,   913053934}, {  565375790,   912837182}, {  565725817,   912620296}, 
+	{  563273883,   914135678}, {  563624408,   913919598}, {  563974850,   913703383}, {  564325210,   913487035}, 
+	{  561870954,   914998653}, {  562221810,   914783111}, {  562572584,   914567435}, {  562923275,   914351624}, 
+	{  560466703,   915859476}, {  560817890,   915644472}, {  561168994,   915429334}, {  561520015,   915214061}, 
+	{  559061133,   916718143}, {  559412649,   916503678}, {  559764083,   916289079}, {  560115434,   916074345}, 
+	{  557654248,   917574653}, {  558006093,   917360728}, {  558357855,   917146668}, {  558709535,   916932473}, 
+	{  556246051,   918429004}, {  556598223,   918215619}, {  556950313,   918002099}, {  557302322,   917788443}, 
+	{  554836544,   919281194}, {  555189044,   919068349}, {  555541461,   918855369}, {  555893797,   918642254}, 
+	{  553425732,   920131221}, {  553778558,   919918917}, {  554131301,   919706478}, {  554483964,   919493904}, 
+	{  552013618,   920979082}, {  552366769,   920767320}, {  552719838,   920555422}, {  553072826,   920343389}, 
+	{  550600205,   921824777}, {  550953680,   921613556}, {  551307074,   921402200}, {  551660387,   921190709}, 
+	{  549185496,   922668302}, {  549539295,   922457624}, {  549893013,   922246810}, {  550246649,   922035861}, 
+	{  547769495,   923509656}, {  548123617,   923299521}, {  548477657,   923089250}, {  548831617,   922878844}, 
+	{  546352205,   924348837}, {  546706649,   924139246}, {  547061011,   923929518}, {  547415294,   923719655}, 
+	{  544933630,   925185843}, {  545288394,   924976795}, {  545643078,   924767612}, {  545997682,   924558292}, 
+	{  543513772,   926020672}, {  543868856,   925812169}, {  544223861,   925603530}, {  544578785,   925394754}, 
+	{  542092635,   926853322}, {  542448039,   926645363}, {  542803363,   926437269}, {  543158607,   926229039}, 
+	{  540670223,   927683790}, {  541025945,   927476378}, {  541381588,   927268829}, {  541737151,   927061143}, 
+	{  539246538,   928512076}, {  539602578,   928305210}, {  539958539,   928098206}, {  540314421,   927891067}, 
+	{  537821584,   929338177}, {  538177942,   929131857}, {  538534220,   928925400}, {  538890418,   928718807}, 
+	{  536395365,   930162092}, {  536752038,   929956318}, {  537108633,   929750408}, {  537465148,   929544361}, 
+	{  534967884,   930983817}, {  535324872,   930778591}, {  535681782,   930573228}, {  536038613,   930367728}, 
+	{  533539144,   931803352}, {  533896447,   931598674}, {  534253671,   931393859}, {  534610817,   931188906}, 
+	{  532109148,   932620694}, {  532466765,   932416564}, {  532824303,   932212297}, {  533181762,   932007893}, 
+	{  530677900,   933435842}, {  531035830,   933232261}, {  531393681,   933028542}, {  531751453,   932824687}, 
+	{  529245404,   934248793}, {  529603645,   934045761}, {  529961808,   933842592}, {  530319893,   933639286}, 
+	{  527811662,   935059546}, {  528170214,   934857064}, {  528528689,   934654444}, {  528887085,   934451687}, 
+	{  526376678,   935868098}, {  526735541,   935666166}, {  527094325,   935464097}, {  527453033,   935261890}, 
+	{  524940456,   936674448}, {  525299627,   936473067}, {  525658722,   936271549}, {  526017739,   936069892}, 
+	{  523502998,   937478595}, {  523862478,   937277765}, {  524221881,   937076797}, {  524581207,   936875692}, 
+	{  522064309,   938280535}, {  522424096,   938080257}, {  522783807,   937879841}, {  523143441,   937679287}, 
+	{  520624391,   939080267}, {  520984485,   938880541}, {  521344503,   938680677}, {  521704444,   938480675}, 
+	{  519183248,   939877790}, {  519543648,   939678616}, {  519903972,   939479305}, {  520264220,   939279855}, 
+	{  517740883,   940673101}, {  518101588,   940474481}, {  518462218,   940275722}, {  518822771,   940076825}, 
+	{  516297300,   941466198}, {  516658310,   941268132}, {  517019243,   941069926}, {  517380101,   940871583}, 
+	{  514852502,   942257081}, {  515213815,   942059568}, {  515575053,   941861917}, {  515936214,   941664127}, 
+	{  513406493,   943045745}, {  513768108,   942848787}, {  514129648,   942651690}, {  514491113,   942454455}, 
+	{  511959275,   943832191}, {  512321192,   943635788}, {  512683035,   943439246}, {  513044801,   943242565}, 
+	{  510510853,   944616416}, {  510873071,   944420568}, {  511235214,   944224582}, {  511597282,   944028456}, 
+	{  509061229,   945398418}, {  509423748,   945203126}, {  509786191,   945007695}, {  510148559,   944812125}, 
+	{  507610408,   946178196}, {  507973225,   945983460}, {  508335968,   945788585}, {  508698636,   945593571}, 
+	{  506158392,   946955747}, {  506521508,   946761568}, {  506884549,   946567250}, {  507247516,   946372792}, 
+	{  504705185,   947731070}, {  505068598,   947537448}, {  505431937,   947343687}, {  505795202,   947149787}, 
+	{  503250791,   948504163}, {  503614500,   948311099}, {  503978136,   948117895}, {  504341698,   947924552}, 
+	{  501795212,   949275023}, {  502159217,   949082517}, {  502523149,   948889872}, {  502887007,   948697087}, 
+	{  500338453,   950043650}, {  500702753,   949851703}, {  501066980,   949659616}, {  501431133,   949467390}, 
+	{  498880516,   950810042}, {  499245110,   950618654}, {  499609631,   950427126}, {  499974079,   950235458}, 
+	{  497421405,   951574196}, {  497786293,   951383367}, {  498151107,   951192399}, {  498515848,   951001290}, 
+	{  495961124,   952336111}, {  496326304,   952145842}, {  496691410,   951955434}, {  497056444,   951764885}, 
+	{  494499676,   953095785}, {  494865147,   952906077}, {  495230545,   952716228}, {  495595871,   952526240}, 
+	{  493037064,   953853216}, {  493402826,   953664069}, {  493768515,   953474781}, {  494134132,   953285353}, 
+	{  491573292,   954608403}, {  491939343,   954419817}, {  492305322,   954231090}, {  492671229,   954042224}, 
+	{  490108363,   955361344}, {  490474703,   955173319}, {  490840972,   954985154}, {  491207168,   954796849}, 
+	{  488642281,   956112036}, {  489008909,   955924574}, {  489375466,   955736971}, {  489741950,   955549228}, 
+	{  487175049,   956860479}, {  487541965,   956673579}, {  487908809,   956486539}, {  488275581,   956299358}, 
+	{  485706671,   957606670}, {  486073873,   957420333}, {  486441003,   957233856}, {  486808062,   957047238}, 
+	{  484237150,   958350608}, {  484604637,   958164835}, {  484972053,   957978921}, {  485339398,   957792866}, 
+	{  482766489,   959092290}, {  483134261,   958907081}, {  483501962,   958721731}, {  483869591,   958536240}, 
+	{  481294693,   959831716}, {  481662748,   959647071}, {  482030733,   959462286}, {  482398646,   959277359}, 
+	{  479821764,   960568883}, {  480190102,   960384803}, {  480558369,   960200582}, {  480926566,   960016220}, 
+	{  478347705,   961303790}, {  478716326,   961120276}, {  479084875,   960936620}, {  479453355,   960752822}, 
+	{  476872522,   962036435}, {  477241423,   961853486}, {  477610254,   961670396}, {  477979015,   961487164}, 
+	{  475396216,   962766816}, {  475765397,   962584433}, {  476134509,   962401909}, {  476503550,   962219243}, 
+	{  473918791,   963494932}, {  474288252,   963313116}, {  474657643,   963131157}, {  475026964,   962949058}, 
+	{  472440251,   964220780}, {  472809991,   964039531}, {  473179660,   963858140}, {  473549261,   963676607}, 
+	{  470960600,   964944360}, {  471330617,   964763678}, {  471700564,   964582854}, {  472070443,   964401888}, 
+	{  469479840,   965665669}, {  469850134,   965485555}, {  470220358,   965305298}, {  470590514,   965124900}, 
+	{  467997976,   966384706}, {  468368545,   966205159}, {  468739046,   966025471}, {  469109478,   965845641}, 
+	{  466515010,   967101468}, {  466885855,   966922491}, {  467256631,   966743371}, {  467627338,   966564109}, 
+	{  465030947,   967815955}, {  465402066,   967637547}, {  465773116,   967458996}, {  466144097,   967280303}, 
+	{  463545789,   968528165}, {  463917181,   968350326}, {  464288505,   968172345}, {  464659760,   967994221}, 
+	{  462059541,   969238095}, {  462431205,   969060826}, {  462802801,   968883415}, {  463174329,   968705861}, 
+	{  460572205,   969945745}, {  460944141,   969769046}, {  461316009,   969592205}, {  461687809,   969415222}, 
+	{  459083786,   970651112}, {  459455992,   970474985}, {  459828131,   970298714}, {  460200202,   970122301}, 
+	{  457594286,   971354196}, {  457966762,   971178639}, {  458339171,   971002940}, {  458711512,   970827098}, 
+	{  456103710,   972054994}, {  456476455,   971880009}, {  456849132,   971704881}, {  457221743,   971529610}, 
+	{  454612060,   972753504}, {  454985073,   972579091}, {  455358019,   972404535}, {  455730898,   972229836}, 
+	{  453119340,   973449725}, {  453492620,   973275885}, {  453865834,   973101901}, {  454238980,   972927774}, 
+	{  451625555,   974143656}, {  451999101,   973970388}, {  452372581,   973796977}, {  452745994,   973623423}, 
+	{  450130706,   974835295}, {  450504518,   974662600}, {  450878263,   974489762}, {  451251942,   974316781}, 
+	{  448634799,   975524639}, {  449008875,   975352518}, {  449382885,   975180254}, {  449756829,   975007846}, 
+	{  447137835,   976211688}, {  447512175,   976040141}, {  447886449,   975868451}, {  448260657,   975696617}, 
+	{  445639820,   976896441}, {  446014422,   976725468}, {  446388959,   976554352}, {  446763430,   976383092}, 
+	{  444140756,   977578894}, {  444515620,   977408496}, {  444890419,   977237955}, {  445265152,   977067269}, 
+	{  442640647,   978259047}, {  443015772,   978089224}, {  443390832,   977919258}, {  443765826,   977749148}, 
+	{  441139496,   978936898}, {  441514881,   978767651}, {  441890201,   978598260}, {  442265456,   978428725}, 
+	{  439637307,   979612445}, {  440012951,   979443774}, {  440388531,   979274960}, {  440764046,   979106001}, 
+	{  438134084,   980285688}, {  438509986,   980117593}, {  438885824,   979949355}, {  439261598,   979780972}, 
+	{  436629829,   980956623}, {  437005989,   980789106}, {  437382085,   980621444}, {  437758117,   980453638}, 
+	{  435124548,   981625251}, {  435500964,   981458310}, {  435877317,   981291226}, {  436253605,   981123997}, 
+	{  433618242,   982291568}, {  433994914,   982125205}, {  434371523,   981958698}, {  434748067,   981792047}, 
+	{  432110916,   982955574}, {  432487843,   982789789}, {  432864706,   982623860}, {  433241506,   982457786}, 
+	{  430602573,   983617267}, {  430979754,   983452061}, {  431356872,   983286710}, {  431733926,   983121214}, 
+	{  429093217,   984276646}, {  429470651,   984112018}, {  429848022,   983947246}, {  430225329,   983782329}, 
+	{  427582852,   984933708}, {  427960537,   984769660}, {  428338160,   984605467}, {  428715720,   984441129}, 
+	{  426071480,   985588453}, {  426449417,   985424984}, {  426827291,   985261370}, {  427205103,   985097612}, 
+	{  424559105,   986240879}, {  424937293,   986077990}, {  425315418,   985914956}, {  425693480,   985751777}, 
+	{  423045732,   986890984}, {  423424169,   986728675}, {  423802543,   986566221}, {  424180855,   986403623}, 
+	{  421531363,   987538766}, {  421910048,   987377038}, {  422288671,   987215165}, {  422667233,   987053147}, 
+	{  420016002,   988184225}, {  420394935,   988023078}, {  420773806,   987861786}, {  421152615,   987700349}, 
+	{  418499653,   988827359}, {  418878833,   988666793}, {  419257951,   988506083}, {  419637007,   988345227}, 
+	{  416982319,   989468165}, {  417361744,   989308182}, {  417741109,   989148053}, {  418120411,   988987779}, 
+	{  415464004,   990106644}, {  415843674,   989947243}, {  416223284,   989787696}, {  416602832,   989628003}, 
+	{  413944711,   990742793}, {  414324625,   990583974}, {  414704479,   990425010}, {  415084272,   990265900}, 
+	{  412424444,   991376610}, {  412804602,   991218374}, {  413184699,   991059993}, {  413564735,   990901465}, 
+	{  410903207,   992008094}, {  411283607,   991850442}, {  411663946,   991692644}, {  412044226,   991534700}, 
+	{  409381002,   992637245}, {  409761644,   992480176}, {  410142225,   992322961}, {  410522746,   992165601}, 
+	{  407857835,   993264059}, {  408238717,   993107575}, {  408619539,   992950944}, {  409000301,   992794167}, 
+	{  406333708,   993888536}, {  406714829,   993732636}, {  407095891,   993576590}, {  407476893,   993420398}, 
+	{  404808624,   994510675}, {  405189985,   994355360}, {  405571285,   994199898}, {  405952526,   994044290}, 
+	{  403282588,   995130473}, {  403664186,   994975743}, {  404045725,   994820867}, {  404427204,   994665844}, 
+	{  401755603,   995747930}, {  402137438,   995593785}, {  402519214,   995439494}, {  402900931,   995285057}, 
+	{  400227673,   996363043}, {  400609744,   996209485}, {  400991756,   996055780}, {  401373709,   995901928}, 
+	{  398698801,   996975812}, {  399081107,   996822840}, {  399463355,   996669721}, {  399845543,   996516456}, 
+	{  397168991,   997586236}, {  397551531,   997433850}, {  397934013,   997281317}, {  398316436,   997128638}, 
+	{  395638246,   998194311}, {  396021020,   998042512}, {  396403735,   997890567}, {  396786392,   997738475}, 
+	{  394106570,   998800038}, {  394489576,   998648827}, {  394872524,   998497468}, {  395255414,   998345963}, 
+	{  392573967,   999403415}, {  392957205,   999252791}, {  393340384,   999102020}, {  393723506,   998951103}, 
+	{  391040440,  1000004439}, {  391423908,   999854404}, {  391807319,   999704221}, {  392190672,   999553891}, 
+	{  389505993,  1000603111}, {  389889691,  1000453664}, {  390273331,  1000304069}, {  390656915,  1000154328}, 
+	{  387970630,  1001199428}, {  388354556,  1001050570}, {  388738426,  1000901564}, {  389122238,  1000752411}, 
+	{  386434353,  1001793390}, {  386818508,  1001645120}, {  387202605,  1001496704}, {  387586646,  1001348140}, 
+	{  384897167,  1002384994}, {  385281549,  1002237314}, {  385665873,  1002089486}, {  386050142,  1001941512}, 
+	{  383359076,  1002974239}, {  383743683,  1002827149}, {  384128234,  1002679911}, {  384512729,  1002532526}, 
+	{  381820082,  1003561124}, {  382204915,  1003414624}, {  382589691,  1003267977}, {  382974412,  1003121181}, 
+	{  380280190,  1004145648}, {  380665247,  1003999738}, {  381050248,  1003853681}, {  381435193,  1003707476}, 
+	{  378739403,  1004727809}, {  379124683,  1004582490}, {  379509908,  1004437024}, {  379895077,  1004291410}, 
+	{  377197725,  1005307605}, {  377583228,  1005162878}, {  377968675,  1005018003}, {  378354067,  1004872979}, 
+	{  375655159,  1005885036}, {  376040883,  1005740900}, {  376426553,  1005596617}, {  376812166,  1005452185}, 
+	{  374111709,  1006460100}, {  374497654,  1006316556}, {  374883544,  1006172864}, {  375269379,  1006029024}, 
+	{  372567379,  1007032796}, {  372953544,  1006889844}, {  373339654,  1006746744}, {  373725709,  1006603496}, 
+	{  371022173,  1007603122}, {  371408556,  1007460763}, {  371794885,  1007318256}, {  372181160,  1007175600}, 
+	{  369476093,  1008171077}, {  369862694,  1008029311}, {  370249242,  1007887396}, {  370635734,  1007745333}, 
+	{  367929144,  1008736660}, {  368315962,  1008595487}, {  368702727,  1008454166}, {  369089437,  1008312696}, 
+	{  366381329,  1009299870}, {  366768363,  1009159290}, {  367155344,  1009018562}, {  367542271,  1008877685}, 
+	{  364832652,  1009860704}, {  365219902,  1009720718}, {  365607098,  1009580584}, {  365994240,  1009440301}, 
+	{  363283116,  1010419162}, {  363670580,  1010279770}, {  364057991,  1010140230}, {  364445348,  1010000541}, 
+	{  361732726,  1010975242}, {  362120403,  1010836445}, {  362508027,  1010697499}, {  362895598,  1010558405}, 
+	{  360181484,  1011528943}, {  360569374,  1011390741}, {  360957211,  1011252390}, {  361344995,  1011113890}, 
+	{  358629395,  1012080264}, {  359017496,  1011942657}, {  359405545,  1011804901}, {  359793541,  1011666997}, 
+	{  357076462,  1012629204}, {  357464774,  1012492193}, {  357853034,  1012355032}, {  358241241,  1012217723}, 
+	{  355522689,  1013175761}, {  355911211,  1013039345}, {  356299680,  1012902780}, {  356688097,  1012766067}, 
+	{  353968079,  1013719934}, {  354356810,  1013584114}, {  354745488,  1013448145}, {  355134115,  1013312028}, 
+	{  352412636,  1014261721}, {  352801575,  1014126498}, {  353190461,  1013991126}, {  353579296,  1013855604}, 
+	{  350856364,  1014801122}, {  351245510,  1014666495}, {  351634604,  1014531720}, {  352023646,  1014396795}, 
+	{  349299266,  1015338134}, {  349688618,  1015204105}, {  350077918,  1015069927}, {  350467167,  1014935599}, 
+	{  347741347,  1015872758}, {  348130904,  1015739326}, {  348520409,  1015605745}, {  348909863,  1015472014}, 
+	{  346182609,  1016404991}, {  346572370,  1016272157}, {  346962080,  1016139173}, {  347351739,  1016006040}, 
+	{  344623057,  1016934832}, {  345013021,  1016802596}, {  345402934,  1016670211}, {  345792797,  1016537676}, 
+	{  343062693,  1017462281}, {  343452860,  1017330643}, {  343842976,  1017198856}, {  344233042,  1017066919}, 
+	{  341501523,  1017987335}, {  341891891,  1017856296}, {  342282209,  1017725107}, {  342672476,  1017593769}, 
+	{  339939549,  1018509994}, {  340330117,  1018379554}, {  340720636,  1018248964}, {  341111104,  1018118225}, 
+	{  338376774,  1019030256}, {  338767543,  1018900415}, {  339158261,  1018770425}, {  339548930,  1018640284}, 
+	{  336813204,  1019548121}, {  337204171,  1019418879}, {  337595089,  1019289488}, {  337985956,  1019159947}, 
+	{  335248841,  1020063586}, {  335640006,  1019934944}, {  336031121,  1019806153}, {  336422188,  1019677212}, 
+	{  333683689,  1020576651}, {  334075051,  1020448610}, {  334466364,  1020320418}, {  334857627,  1020192077}, 
+	{  332117752,  1021087314}, {  332509310,  1020959873}, {  332900819,  1020832283}, {  333292279,  1020704542}, 
+	{  330551034,  1021595575}, {  330942787,  1021468735}, {  331334491,  1021341745}, {  331726146,  1021214605}, 
+	{  328983538,  1022101432}, {  329375485,  1021975193}, {  329767383,  1021848804}, {  330159233,  1021722264}, 
+	{  327415267,  1022604883}, {  327807407,  1022479246}, {  328199499,  1022353458}, {  328591543,  1022227520}, 
+	{  325846226,  1023105929}, {  326238559,  1022980893}, {  326630843,  1022855707}, {  327023079,  1022730370}, 
+	{  324276419,  1023604567}, {  324668942,  1023480133}, {  325061418,  1023355549}, {  325453846,  1023230814}, 
+	{  322705848,  1024100796}, {  323098562,  1023976964}, {  323491229,  1023852982}, {  323883848,  1023728850}, 
+	{  321134518,  1024594615}, {  321527422,  1024471386}, {  321920278,  1024348007}, {  322313087,  1024224477}, 
+	{  319562433,  1025086024}, {  319955525,  1024963398}, {  320348570,  1024840621}, {  320741568,  1024717694}, 
+	{  317989595,  1025575020}, {  318382875,  1025452997}, {  318776108,  1025330824}, {  319169293,  1025208499}, 
+	{  316416009,  1026061603}, {  316809475,  1025940184}, {  317202895,  1025818614}, {  317596268,  1025696892}, 
+	{  314841679,  1026545772}, {  315235331,  1026424956}, {  315628937,  1026303990}, {  316022496,  1026182872}, 
+	{  313266607,  1027027525}, {  313660444,  1026907313}, {  314054235,  1026786951}, {  314447980,  1026666437}, 
+	{  311690799,  1027506862}, {  312084820,  1027387254}, {  312478795,  1027267495}, {  312872724,  1027147586}, 
+	{  310114257,  1027983780}, {  310508461,  1027864777}, {  310902619,  1027745623}, {  311296732,  1027626318}, 
+	{  308536985,  1028458280}, {  308931371,  1028339882}, {  309325712,  1028221332}, {  309720007,  1028102632}, 
+	{  306958988,  1028930359}, {  307353555,  1028812566}, {  307748077,  1028694622}, {  308142554,  1028576527}, 
+	{  305380268,  1029400018}, {  305775015,  1029282830}, {  306169718,  1029165491}, {  306564375,  1029048001}, 
+	{  303800829,  1029867254}, {  304195756,  1029750672}, {  304590638,  1029633939}, {  304985475,  1029517054}, 
+	{  302220676,  1030332067}, {  302615781,  1030216091}, {  303010842,  1030099963}, {  303405858,  1029983684}, 
+	{  300639811,  1030794455}, {  301035094,  1030679085}, {  301430332,  1030563564}, {  301825526,  1030447891}, 
+	{  299058239,  1031254418}, {  299453698,  1031139655}, {  299849113,  1031024740}, {  300244484,  1030909673}, 
+	{  297475964,  1031711954}, {  297871598,  1031597797}, {  298267189,  1031483489}, {  298662736,  1031369029}, 
+	{  295892988,  1032167062}, {  296288797,  1032053513}, {  296684563,  1031939812}, {  297080285,  1031825959}, 
+	{  294309316,  1032619742}, {  294705299,  1032506800}, {  295101239,  1032393706}, {  295497135,  1032280460}, 
+	{  292724951,  1033069992}, {  293121107,  1032957657}, {  293517220,  1032845170}, {  293913290,  1032732532}, 
+	{  291139898,  1033517810}, {  291536226,  1033406084}, {  291932511,  1033294205}, {  292328753,  1033182174}, 
+	{  289554160,  1033963197}, {  289950658,  1033852079}, {  290347114,  1033740808}, {  290743528,  1033629385}, 
+	{  287967740,  1034406151}, {  288364409,  1034295641}, {  288761035,  1034184978}, {  289157619,  1034074164}, 
+	{  286380643,  1034846671}, {  286777480,  1034736769}, {  287174276,  1034626715}, {  287571029,  1034516509}, 
+	{  284792871,  1035284755}, {  285189877,  1035175463}, {  285586841,  1035066018}, {  285983763,  1034956420}, 
+	{  283204430,  1035720404}, {  283601603,  1035611720}, {  283998734,  1035502884}, {  284395824,  1035393896}, 
+	{  281615322,  1036153615}, {  282012662,  1036045541}, {  282409959,  1035937314}, {  282807215,  1035828935}, 
+	{  280025552,  1036584389}, {  280423056,  1036476924}, {  280820520,  1036369307}, {  281217942,  1036261537}, 
+	{  278435122,  1037012723}, {  278832791,  1036905868}, {  279230419,  1036798861}, {  279628006,  1036691701}, 
+	{  276844038,  1037438617}, {  277241870,  1037332372}, {  277639662,  1037225975}, {  278037413,  1037119425}, 
+	{  275252302,  1037862069}, {  275650297,  1037756435}, {  276048251,  1037650648}, {  276446165,  1037544709}, 
+	{  273659918,  1038283080}, {  274058075,  1038178056}, {  274456191,  1038072880}, {  274854267,  1037967551}, 
+	{  272066891,  1038701647}, {  272465208,  1038597234}, {  272863485,  1038492669}, {  273261722,  1038387951}, 
+	{  270473223,  1039117770}, {  270871700,  1039013969}, {  271270136,  1038910014}, {  271668533,  1038805907}, 
+	{  268878918,  1039531448}, {  269277554,  1039428258}, {  269676150,  1039324915}, {  270074706,  1039221419}, 
+	{  267283981,  1039942680}, {  267682775,  1039840101}, {  268081529,  1039737370}, {  268480243,  1039634486}, 
+	{  265688415,  1040351465}, {  266087366,  1040249498}, {  266486277,  1040147378}, {  266885149,  1040045106}, 
+	{  264092224,  1040757802}, {  264491331,  1040656447}, {  264890398,  1040554939}, {  265289426,  1040453279}, 
+	{  262495412,  1041161689}, {  262894673,  1041060947}, {  263293896,  1040960052}, {  263693079,  1040859003}, 
+	{  260897982,  1041563127}, {  261297397,  1041462997}, {  261696774,  1041362715}, {  262096112,  1041262279}, 
+	{  259299937,  1041962114}, {  259699506,  1041862597}, {  260099036,  1041762927}, {  260498528,  1041663104}, 
+	{  257701283,  1042358649}, {  258101004,  1042259745}, {  258500686,  1042160688}, {  258900331,  1042061478}, 
+	{  256102022,  1042752731}, {  256501894,  1042654441}, {  256901728,  1042555997}, {  257301525,  1042457400}, 
+	{  254502159,  1043144360}, {  254902181,  1043046683}, {  255302166,  1042948852}, {  255702113,  1042850869}, 
+	{  252901697,  1043533534}, {  253301868,  1043436471}, {  253702003,  1043339254}, {  254102099,  1043241884}, 
+	{  251300640,  1043920252}, {  251700959,  1043823803}, {  252101242,  1043727200}, {  252501488,  1043630444}, 
+	{  249698991,  1044304514}, {  250099458,  1044208679}, {  250499889,  1044112690}, {  250900283,  1044016548}, 
+	{  248096755,  1044686319}, {  248497369,  1044591098}, {  248897946,  1044495724}, {  249298487,  1044400196}, 
+	{  246493935,  1045065665}, {  246894694,  1044971059}, {  247295417,  1044876299}, {  247696104,  1044781386}, 
+	{  244890535,  1045442553}, {  245291439,  1045348561}, {  245692307,  1045254416}, {  246093139,  1045160118}, 
+	{  243286558,  1045816980}, {  243687606,  1045723604}, {  244088618,  1045630074}, {  244489594,  1045536390}, 
+	{  241682010,  1046188946}, {  242083200,  1046096185}, {  242484355,  1046003271}, {  242885475,  1045910202}, 
+	{  240076892,  1046558451}, {  240478225,  1046466305}, {  240879522,  1046374006}, {  241280783,  1046281553}, 
+	{  238471210,  1046925492}, {  238872683,  1046833963}, {  239274121,  1046742279}, {  239675524,  1046650442}, 
+	{  236864966,  1047290071}, {  237266579,  1047199157}, {  237668158,  1047108090}, {  238069701,  1047016868}, 
+	{  235258165,  1047652185}, {  235659918,  1047561887}, {  236061635,  1047471436}, {  236463318,  1047380830}, 
+	{  233650811,  1048011834}, {  234052701,  1047922153}, {  234454557,  1047832317}, {  234856378,  1047742328}, 
+	{  232042906,  1048369016}, {  232444934,  1048279952}, {  232846927,  1048190733}, {  233248886,  1048101360}, 
+	{  230434456,  1048723732}, {  230836620,  1048635284}, {  231238749,  1048546683}, {  231640845,  1048457926}, 
+	{  228825464,  1049075980}, {  229227762,  1048988149}, {  229630027,  1048900165}, {  230032259,  1048812025}, 
+	{  227215933,  1049425759}, {  227618366,  1049338546}, {  228020765,  1049251178}, {  228423131,  1049163656}, 
+	{  225605867,  1049773069}, {  226008433,  1049686474}, {  226410966,  1049599723}, {  226813466,  1049512818}, 
+	{  223995270,  1050117909}, {  224397969,  1050031931}, {  224800635,  1049945798}, {  225203267,  1049859511}, 
+	{  222384147,  1050460278}, {  222786977,  1050374918}, {  223189774,  1050289403}, {  223592539,  1050203733}, 
+	{  220772500,  1050800175}, {  221175461,  1050715433}, {  221578389,  1050630536}, {  221981284,  1050545484}, 
+	{  219160334,  1051137599}, {  219563424,  1051053475}, {  219966481,  1050969196}, {  220369507,  1050884763}, 
+	{  217547651,  1051472550}, {  217950870,  1051389044}, {  218354057,  1051305384}, {  218757211,  1051221569}, 
+	{  215934457,  1051805027}, {  216337804,  1051722140}, {  216741118,  1051639098}, {  217144401,  1051555901}, 
+	{  214320755,  1052135029}, {  214724228,  1052052760}, {  215127670,  1051970337}, {  215531079,  1051887759}, 
+	{  212706549,  1052462555}, {  213110148,  1052380905}, {  213513715,  1052299101}, {  213917251,  1052217142}, 
+	{  211091842,  1052787604}, {  211495565,  1052706574}, {  211899258,  1052625389}, {  212302919,  1052544049}, 
+	{  209476638,  1053110176}, {  209880485,  1053029765}, {  210284302,  1052949200}, {  210688087,  1052868479}, 
+	{  207860942,  1053430270}, {  208264912,  1053350479}, {  208668851,  1053270533}, {  209072760,  1053190432}, 
+	{  206244756,  1053747885}, {  206648848,  1053668714}, {  207052910,  1053589387}, {  207456941,  1053509906}, 
+	{  204628085,  1054063021}, {  205032298,  1053984469}, {  205436481,  1053905763}, {  205840633,  1053826901}, 
+	{  203010932,  1054375676}, {  203415265,  1054297745}, {  203819569,  1054219658}, {  204223842,  1054141417}, 
+	{  201393302,  1054685850}, {  201797754,  1054608539}, {  202202177,  1054531073}, {  202606569,  1054453452}, 
+	{  199775198,  1054993543}, {  200179768,  1054916852}, {  200584309,  1054840007}, {  200988820,  1054763006}, 
+	{  198156624,  1055298753}, {  198561311,  1055222683}, {  198965969,  1055146458}, {  199370598,  1055070078}, 
+	{  196537583,  1055601479}, {  196942387,  1055526030}, {  197347161,  1055450426}, {  197751907,  1055374667}, 
+	{  194918080,  1055901722}, {  195322999,  1055826894}, {  195727889,  1055751911}, {  196132751,  1055676773}, 
+	{  193298119,  1056199480}, {  193703152,  1056125274}, {  194108156,  1056050912}, {  194513133,  1055976395}, 
+	{  191677702,  1056494753}, {  192082849,  1056421168}, {  192487967,  1056347427}, {  192893057,  1056273531}, 
+	{  190056834,  1056787540}, {  190462093,  1056714576}, {  190867324,  1056641457}, {  191272527,  1056568183}, 
+	{  188435520,  1057077840}, {  188840890,  1057005498}, {  189246233,  1056933001}, {  189651548,  1056860348}, 
+	{  186813762,  1057365653}, {  187219242,  1057293933}, {  187624696,  1057222057}, {  188030122,  1057150026}, 
+	{  185191564,  1057650977}, {  185597154,  1057579879}, {  186002717,  1057508626}, {  186408253,  1057437217}, 
+	{  183568930,  1057933813}, {  183974629,  1057863337}, {  184380301,  1057792706}, {  184785946,  1057721919}, 
+	{  181945865,  1058214159}, {  182351671,  1058144306}, {  182757451,  1058074297}, {  183163204,  1058004133}, 
+	{  180322371,  1058492016}, {  180728284,  1058422785}, {  181134171,  1058353399}, {  181540031,  1058283857}, 
+	{  178698453,  1058767381}, {  179104472,  1058698773}, {  179510465,  1058630010}, {  179916431,  1058561091}, 
+	{  177074115,  1059040255}, {  177480239,  1058972270}, {  177886336,  1058904130}, {  178292408,  1058835833}, 
+	{  175449360,  1059310638}, {  175855587,  1059243276}, {  176261789,  1059175758}, {  176667965,  1059108085}, 
+	{  173824192,  1059578527}, {  174230522,  1059511788}, {  174636827,  1059444894}, {  175043106,  1059377844}, 
+	{  172198615,  1059843923}, {  172605047,  1059777808}, {  173011454,  1059711537}, {  173417836,  1059645110}, 
+	{  170572633,  1060106826}, {  170979166,  1060041334}, {  171385674,  1059975686}, {  171792157,  1059909883}, 
+	{  168946249,  1060367233}, {  169352882,  1060302365}, {  169759491,  1060237341}, {  170166074,  1060172161}, 
+	{  167319468,  1060625146}, {  167726200,  1060560902}, {  168132908,  1060496502}, {  168539591,  1060431945}, 
+	{  165692293,  1060880563}, {  166099124,  1060816943}, {  166505929,  1060753166}, {  166912711,  1060689234}, 
+	{  164064728,  1061133483}, {  164471656,  1061070487}, {  164878559,  1061007335}, {  165285438,  1060944027}, 
+	{  162436778,  1061383907}, {  162843801,  1061321535}, {  163250801,  1061259007}, {  163657777,  1061196323}, 
+	{  160808445,  1061631833}, {  161215564,  1061570086}, {  161622659,  1061508182}, {  162029730,  1061446123}, 
+	{  159179733,  1061877261}, {  159586946,  1061816138}, {  159994136,  1061754859}, {  160401302,  1061693424}, 
+	{  157550647,  1062120190}, {  157957954,  1062059692}, {  158365237,  1061999038}, {  158772497,  1061938227}, 
+	{  155921191,  1062360620}, {  156328589,  1062300747}, {  156735965,  1062240717}, {  157143318,  1062180532}, 
+	{  154291367,  1062598550}, {  154698857,  1062539302}, {  155106324,  1062479898}, {  155513769,  1062420337}, 
+	{  152661180,  1062833980}, {  153068761,  1062775357}, {  153476319,  1062716578}, {  153883854,  1062657642}, 
+	{  151030634,  1063066909}, {  151438304,  1063008911}, {  151845952,  1062950757}, {  152253577,  1062892446}, 
+	{  149399733,  1063297336}, {  149807492,  1063239964}, {  150215228,  1063182435}, {  150622942,  1063124750}, 
+	{  147768480,  1063525261}, {  148176326,  1063468514}, {  148584150,  1063411611}, {  148991953,  1063354552}, 
+	{  146136880,  1063750684}, {  146544812,  1063694563}, {  146952723,  1063638285}, {  147360613,  1063581851}, 
+	{  144504935,  1063973603}, {  144912954,  1063918108}, {  145320950,  1063862456}, {  145728926,  1063806648}, 
+	{  142872651,  1064194019}, {  143280754,  1064139150}, {  143688835,  1064084124}, {  144096896,  1064028942}, 
+	{  141240030,  1064411931}, {  141648217,  1064357688}, {  142056382,  1064303288}, {  142464527,  1064248732}, 
+	{  139607077,  1064627338}, {  140015347,  1064573721}, {  140423595,  1064519947}, {  140831823,  1064466017}, 
+	{  137973796,  1064840240}, {  138382147,  1064787249}, {  138790477,  1064734102}, {  139198788,  1064680798}, 
+	{  136340190,  1065050636}, {  136748621,  1064998272}, {  137157033,  1064945751}, {  137565425,  1064893074}, 
+	{  134706263,  1065258526}, {  135114774,  1065206789}, {  135523266,  1065154894}, {  135931738,  1065102844}, 
+	{  133072019,  1065463909}, {  133480609,  1065412799}, {  133889180,  1065361531}, {  134297731,  1065310107}, 
+	{  131437462,  1065666786}, {  131846130,  1065616302}, {  132254779,  1065565661}, {  132663409,  1065514864}, 
+	{  129802595,  1065867154}, {  130211341,  1065817297}, {  130620067,  1065767284}, {  131028774,  1065717113}, 
+	{  128167423,  1066065015}, {  128576245,  1066015785}, {  128985047,  1065966398}, {  129393831,  1065916855}, 
+	{  126531950,  1066260367}, {  126940846,  1066211764}, {  127349724,  1066163005}, {  127758583,  1066114088}, 
+	{  124896179,  1066453210}, {  125305149,  1066405234}, {  125714101,  1066357102}, {  126123035,  1066308813}, 
+	{  123260114,  1066643544}, {  123669157,  1066596195}, {  124078183,  1066548690}, {  124487190,  1066501029}, 
+	{  121623759,  1066831367}, {  122032875,  1066784647}, {  122441972,  1066737769}, {  122851052,  1066690735}, 
+	{  119987118,  1067016680}, {  120396304,  1066970587}, {  120805474,  1066924338}, {  121214625,  1066877931}, 
+	{  118350194,  1067199483}, {  118759451,  1067154018}, {  119168691,  1067108396}, {  119577913,  1067062616}, 
+	{  116712992,  1067379774}, {  117122318,  1067334937}, {  117531627,  1067289942}, {  117940919,  1067244791}, 
+	{  115075515,  1067557554}, {  115484910,  1067513344}, {  115894288,  1067468978}, {  116303648,  1067424454}, 
+	{  113437768,  1067732821}, {  113847230,  1067689240}, {  114256675,  1067645501}, {  114666103,  1067601606}, 
+	{  111799753,  1067905576}, {  112209281,  1067862623}, {  112618793,  1067819513}, {  113028289,  1067776246}, 
+	{  110161476,  1068075818}, {  110571069,  1068033493}, {  110980647,  1067991011}, {  111390208,  1067948372}, 
+	{  108522939,  1068243547}, {  108932597,  1068201851}, {  109342239,  1068159997}, {  109751866,  1068117986}, 
+	{  106884147,  1068408763}, {  107293868,  1068367694}, {  107703574,  1068326469}, {  108113265,  1068285087}, 
+	{  105245103,  1068571464}, {  105654887,  1068531024}, {  106064656,  1068490427}, {  106474409,  1068449673}, 
+	{  103605812,  1068731650}, {  104015658,  1068691839}, {  104425488,  1068651871}, {  104835303,  1068611746}, 
+	{  101966277,  1068889322}, {  102376183,  1068850140}, {  102786074,  1068810801}, {  103195951,  1068771304}, 
+	{  100326502,  1069044479}, {  100736468,  1069005925}, {  101146419,  1068967215}, {  101556355,  1068928347}, 
+	{   98686491,  1069197120}, {   99096515,  1069159195}, {   99506525,  1069121114}, {   99916521,  1069082875}, 
+	{   97046247,  1069347245}, {   97456330,  1069309950}, {   97866398,  1069272497}, {   98276451,  1069234887}, 
+	{   95405776,  1069494854}, {   95815915,  1069458188}, {   96226040,  1069421364}, {   96636151,  1069384383}, 
+	{   93765079,  1069639946}, {   94175274,  1069603909}, {   94585455,  1069567715}, {   94995622,  1069531363}, 
+	{   92124163,  1069782521}, {   92534412,  1069747114}, {   92944648,  1069711548}, {   93354871,  1069675826}, 
+	{   90483029,  1069922579}, {   90893333,  1069887801}, {   91303623,  1069852865}, {   91713899,  1069817772}, 
+	{   88841683,  1070060120}, {   89252039,  1070025971}, {   89662382,  1069991664}, {   90072712,  1069957201}, 
+	{   87200127,  1070195142}, {   87610535,  1070161623}, {   88020931,  1070127946}, {   88431313,  1070094111}, 
+	{   85558366,  1070327646}, {   85968825,  1070294756}, {   86379272,  1070261709}, {   86789706,  1070228504}, 
+	{   83916404,  1070457632}, {   84326913,  1070425372}, {   84737410,  1070392954}, {   85147894,  1070360379}, 
+	{   82274245,  1070585099}, {   82684803,  1070553468}, {   83095349,  1070521680}, {   83505883,  1070489735}, 
+	{   80631892,  1070710046}, {   81042498,  1070679045}, {   81453092,  1070647887}, {   81863674,  1070616572}, 
+	{   78989349,  1070832474}, {   79400002,  1070802103}, {   79810644,  1070771575}, {   80221273,  1070740889}, 
+	{   77346620,  1070952382}, {   77757319,  1070922641}, {   78168007,  1070892743}, {   78578684,  1070862687}, 
+	{   75703709,  1071069770}, {   76114454,  1071040660}, {   76525187,  1071011391}, {   76935909,  1070981966}, 
+	{   74060620,  1071184638}, {   74471409,  1071156158}, {   74882187,  1071127519}, {   75292954,  1071098724}, 
+	{   72417357,  1071296985}, {   72828189,  1071269135}, {   73239010,  1071241127}, {   73649821,  1071212961}, 
+	{   70773924,  1071406812}, {   71184798,  1071379592}, {   71595661,  1071352214}, {   72006515,  1071324678}, 
+	{   69130324,  1071514117}, {   69541239,  1071487527}, {   69952144,  1071460780}, {   70363039,  1071433874}, 
+	{   67486561,  1071618901}, {   67897517,  1071592941}, {   68308462,  1071566824}, {   68719398,  1071540549}, 
+	{   65842639,  1071721163}, {   66253634,  1071695834}, {   66664620,  1071670347}, {   67075595,  1071644703}, 
+	{   64198563,  1071820903}, {   64609596,  1071796205}, {   65020620,  1071771349}, {   65431634,  1071746335}, 
+	{   62554335,  1071918122}, {   62965406,  1071894054}, {   63376468,  1071869828}, {   63787520,  1071845445}, 
+	{   60909960,  1072012818}, {   61321068,  1071989380}, {   61732166,  1071965785}, {   62143255,  1071942032}, 
+	{   59265442,  1072104991}, {   59676585,  1072082184}, {   60087719,  1072059220}, {   60498844,  1072036098}, 
+	{   57620785,  1072194642}, {   58031962,  1072172466}, {   58443131,  1072150132}, {   58854291,  1072127640}, 
+	{   55975992,  1072281769}, {   56387202,  1072260224}, {   56798405,  1072238521}, {   57209599,  1072216660}, 
+	{   54331067,  1072366374}, {   54742310,  1072345459}, {   55153545,  1072324387}, {   55564773,  1072303157}, 
+	{   52686014,  1072448455}, {   53097289,  1072428171}, {   53508556,  1072407730}, {   53919815,  1072387131}, 
+	{   51040837,  1072528012}, {   51452143,  1072508360}, {   51863441,  1072488549}, {   52274731,  1072468581}, 
+	{   49395541,  1072605046}, {   49806876,  1072586024}, {   50218204,  1072566845}, {   50629524,  1072547508}, 
+	{   47750128,  1072679556}, {   48161492,  1072661165}, {   48572848,  1072642617}, {   48984198,  1072623910}, 
+	{   46104602,  1072751542}, {   46515994,  1072733782}, {   46927379,  1072715864}, {   47338757,  1072697789}, 
+	{   44458968,  1072821003}, {   44870387,  1072803874}, {   45281799,  1072786588}, {   45693204,  1072769144}, 
+	{   42813230,  1072887940}, {   43224674,  1072871443}, {   43636112,  1072854787}, {   44047544,  1072837974}, 
+	{   41167391,  1072952352}, {   41578860,  1072936486}, {   41990323,  1072920462}, {   42401779,  1072904280}, 
+	{   39521455,  1073014240}, {   39932948,  1072999005}, {   40344435,  1072983612}, {   40755916,  1072968061}, 
+	{   37875426,  1073073603}, {   38286941,  1073058999}, {   38698452,  1073044237}, {   39109956,  1073029317}, 
+	{   36229307,  1073130440}, {   36640845,  1073116468}, {   37052377,  1073102337}, {   37463904,  1073088049}, 
+	{   34583104,  1073184753}, {   34994663,  1073171411}, {   35406216,  1073157912}, {   35817764,  1073144255}, 
+	{   32936819,  1073236540}, {   33348398,  1073223830}, {   33759971,  1073210962}, {   34171540,  1073197936}, 
+	{   31290457,  1073285802}, {   31702054,  1073273723}, {   32113647,  1073261486}, {   32525236,  1073249092}, 
+	{   29644021,  1073332538}, {   30055636,  1073321091}, {   30467248,  1073309485}, {   30878855,  1073297722}, 
+	{   27997515,  1073376748}, {   28409148,  1073365932}, {   28820776,  1073354959}, {   29232401,  1073343827}, 
+	{   26350943,  1073418433}, {   26762592,  1073408249}, {   27174237,  1073397906}, {   27585878,  1073387406}, 
+	{   24704310,  1073457592}, {   25115974,  1073448039}, {   25527634,  1073438328}, {   25939291,  1073428460}, 
+	{   23057618,  1073494225}, {   23469296,  1073485303}, {   23880971,  1073476224}, {   24292642,  1073466987}, 
+	{   21410872,  1073528332}, {   21822563,  1073520042}, {   22234252,  1073511594}, {   22645937,  1073502988}, 
+	{   19764076,  1073559913}, {   20175779,  1073552254}, {   20587480,  1073544438}, {   20999178,  1073536464}, 
+	{   18117233,  1073588967}, {   18528948,  1073581940}, {   18940660,  1073574756}, {   19352369,  1073567413}, 
+	{   16470347,  1073615496}, {   16882072,  1073609100}, {   17293795,  1073602547}, {   17705515,  1073595836}, 
+	{   14823423,  1073639498}, {   15235158,  1073633734}, {   15646890,  1073627812}, {   16058620,  1073621733}, 
+	{   13176464,  1073660973}, {   13588207,  1073655841}, {   13999948,  1073650551}, {   14411686,  1073645103}, 
+	{   11529474,  1073679922}, {   11941224,  1073675422}, {   12352972,  1073670764}, {   12764719,  1073665947}, 
+	{    9882456,  1073696345}, {   10294213,  1073692476}, {   10705968,  1073688450}, {   11117722,  1073684265}, 
+	{    8235416,  1073710241}, {    8647178,  1073707004}, {    9058939,  1073703609}, {    9470698,  1073700056}, 
+	{    6588356,  1073721611}, {    7000123,  1073719006}, {    7411888,  1073716242}, {    7823653,  1073713321}, 
+	{    4941281,  1073730454}, {    5353051,  1073728480}, {    5764820,  1073726348}, {    6176588,  1073724059}, 
+	{    3294193,  1073736771}, {    3705966,  1073735429}, {    4117738,  1073733928}, {    4529510,  1073732270}, 
+	{    1647099,  1073740561}, {    2058873,  1073739850}, {    2470647,  1073738982}, {    2882420,  1073737955}, 
+	{          0,  1073741824}, {     411775,  1073741745}, {     823550,  1073741508}, {    1235324,  1073741113}, 
+	{   -1647099,  1073740561}, {   -1235324,  1073741113}, {    -823550,  1073741508}, {    -411775,  1073741745}, 
+	{   -3294193,  1073736771}, {   -2882420,  1073737955}, {   -2470647,  1073738982}, {   -2058873,  1073739850}, 
+	{   -4941281,  1073730454}, {   -4529510,  1073732270}, {   -4117738,  1073733928}, {   -3705966,  1073735429}, 
+	{   -6588356,  1073721611}, {   -6176588,  1073724059}, {   -5764820,  1073726348}, {   -5353051,  1073728480}, 
+	{   -8235416,  1073710241}, {   -7823653,  1073713321}, {   -7411888,  1073716242}, {   -7000123,  1073719006}, 
+	{   -9882456,  1073696345}, {   -9470698,  1073700056}, {   -9058939,  1073703609}, {   -8647178,  1073707004}, 
+	{  -11529474,  1073679922}, {  -11117722,  1073684265}, {  -10705968,  1073688450}, {  -10294213,  1073692476}, 
+	{  -13176464,  1073660973}, {  -12764719,  1073665947}, {  -12352972,  1073670764}, {  -11941224,  1073675422}, 
+	{  -14823423,  1073639498}, {  -14411686,  1073645103}, {  -13999948,  1073650551}, {  -13588207,  1073655841}, 
+	{  -16470347,  1073615496}, {  -16058620,  1073621733}, {  -15646890,  1073627812}, {  -15235158,  1073633734}, 
+	{  -18117233,  1073588967}, {  -17705515,  1073595836}, {  -17293795,  1073602547}, {  -16882072,  1073609100}, 
+	{  -19764076,  1073559913}, {  -19352369,  1073567413}, {  -18940660,  1073574756}, {  -18528948,  1073581940}, 
+	{  -21410872,  1073528332}, {  -20999178,  1073536464}, {  -20587480,  1073544438}, {  -20175779,  1073552254}, 
+	{  -23057618,  1073494225}, {  -22645937,  1073502988}, {  -22234252,  1073511594}, {  -21822563,  1073520042}, 
+	{  -24704310,  1073457592}, {  -24292642,  1073466987}, {  -23880971,  1073476224}, {  -23469296,  1073485303}, 
+	{  -26350943,  1073418433}, {  -25939291,  1073428460}, {  -25527634,  1073438328}, {  -25115974,  1073448039}, 
+	{  -27997515,  1073376748}, {  -27585878,  1073387406}, {  -27174237,  1073397906}, {  -26762592,  1073408249}, 
+	{  -29644021,  1073332538}, {  -29232401,  1073343827}, {  -28820776,  1073354959}, {  -28409148,  1073365932}, 
+	{  -31290457,  1073285802}, {  -30878855,  1073297722}, {  -30467248,  1073309485}, {  -30055636,  1073321091}, 
+	{  -32936819,  1073236540}, {  -32525236,  1073249092}, {  -32113647,  1073261486}, {  -31702054,  1073273723}, 
+	{  -34583104,  1073184753}, {  -34171540,  1073197936}, {  -33759971,  1073210962}, {  -33348398,  1073223830}, 
+	{  -36229307,  1073130440}, {  -35817764,  1073144255}, {  -35406216,  1073157912}, {  -34994663,  1073171411}, 
+	{  -37875426,  1073073603}, {  -37463904,  1073088049}, {  -37052377,  1073102337}, {  -36640845,  1073116468}, 
+	{  -39521455,  1073014240}, {  -39109956,  1073029317}, {  -38698452,  1073044237}, {  -38286941,  1073058999}, 
+	{  -41167391,  1072952352}, {  -40755916,  1072968061}, {  -40344435,  1072983612}, {  -39932948,  1072999005}, 
+	{  -42813230,  1072887940}, {  -42401779,  1072904280}, {  -41990323,  1072920462}, {  -41578860,  1072936486}, 
+	{  -44458968,  1072821003}, {  -44047544,  1072837974}, {  -43636112,  1072854787}, {  -43224674,  1072871443}, 
+	{  -46104602,  1072751542}, {  -45693204,  1072769144}, {  -45281799,  1072786588}, {  -44870387,  1072803874}, 
+	{  -47750128,  1072679556}, {  -47338757,  1072697789}, {  -46927379,  1072715864}, {  -46515994,  1072733782}, 
+	{  -49395541,  1072605046}, {  -48984198,  1072623910}, {  -48572848,  1072642617}, {  -48161492,  1072661165}, 
+	{  -51040837,  1072528012}, {  -50629524,  1072547508}, {  -50218204,  1072566845}, {  -49806876,  1072586024}, 
+	{  -52686014,  1072448455}, {  -52274731,  1072468581}, {  -51863441,  1072488549}, {  -51452143,  1072508360}, 
+	{  -54331067,  1072366374}, {  -53919815,  1072387131}, {  -53508556,  1072407730}, {  -53097289,  1072428171}, 
+	{  -55975992,  1072281769}, {  -55564773,  1072303157}, {  -55153545,  1072324387}, {  -54742310,  1072345459}, 
+	{  -57620785,  1072194642}, {  -57209599,  1072216660}, {  -56798405,  1072238521}, {  -56387202,  1072260224}, 
+	{  -59265442,  1072104991}, {  -58854291,  1072127640}, {  -58443131,  1072150132}, {  -58031962,  1072172466}, 
+	{  -60909960,  1072012818}, {  -60498844,  1072036098}, {  -60087719,  1072059220}, {  -59676585,  1072082184}, 
+	{  -62554335,  1071918122}, {  -62143255,  1071942032}, {  -61732166,  1071965785}, {  -61321068,  1071989380}, 
+	{  -64198563,  1071820903}, {  -63787520,  1071845445}, {  -63376468,  1071869828}, {  -62965406,  1071894054}, 
+	{  -65842639,  1071721163}, {  -65431634,  1071746335}, {  -65020620,  1071771349}, {  -64609596,  1071796205}, 
+	{  -67486561,  1071618901}, {  -67075595,  1071644703}, {  -66664620,  1071670347}, {  -66253634,  1071695834}, 
+	{  -69130324,  1071514117}, {  -68719398,  1071540549}, {  -68308462,  1071566824}, {  -67897517,  1071592941}, 
+	{  -70773924,  1071406812}, {  -70363039,  1071433874}, {  -69952144,  1071460780}, {  -69541239,  1071487527}, 
+	{  -72417357,  1071296985}, {  -72006515,  1071324678}, {  -71595661,  1071352214}, {  -71184798,  1071379592}, 
+	{  -74060620,  1071184638}, {  -73649821,  1071212961}, {  -73239010,  1071241127}, {  -72828189,  1071269135}, 
+	{  -75703709,  1071069770}, {  -75292954,  1071098724}, {  -74882187,  1071127519}, {  -74471409,  1071156158}, 
+	{  -77346620,  1070952382}, {  -76935909,  1070981966}, {  -76525187,  1071011391}, {  -76114454,  1071040660}, 
+	{  -78989349,  1070832474}, {  -78578684,  1070862687}, {  -78168007,  1070892743}, {  -77757319,  1070922641}, 
+	{  -80631892,  1070710046}, {  -80221273,  1070740889}, {  -79810644,  1070771575}, {  -79400002,  1070802103}, 
+	{  -82274245,  1070585099}, {  -81863674,  1070616572}, {  -81453092,  1070647887}, {  -81042498,  1070679045}, 
+	{  -83916404,  1070457632}, {  -83505883,  1070489735}, {  -83095349,  1070521680}, {  -82684803,  1070553468}, 
+	{  -85558366,  1070327646}, {  -85147894,  1070360379}, {  -84737410,  1070392954}, {  -84326913,  1070425372}, 
+	{  -87200127,  1070195142}, {  -86789706,  1070228504}, {  -86379272,  1070261709}, {  -85968825,  1070294756}, 
+	{  -88841683,  1070060120}, {  -88431313,  1070094111}, {  -88020931,  1070127946}, {  -87610535,  1070161623}, 
+	{  -90483029,  1069922579}, {  -90072712,  1069957201}, {  -89662382,  1069991664}, {  -89252039,  1070025971}, 
+	{  -92124163,  1069782521}, {  -91713899,  1069817772}, {  -91303623,  1069852865}, {  -90893333,  1069887801}, 
+	{  -93765079,  1069639946}, {  -93354871,  1069675826}, {  -92944648,  1069711548}, {  -92534412,  1069747114}, 
+	{  -95405776,  1069494854}, {  -94995622,  1069531363}, {  -94585455,  1069567715}, {  -94175274,  1069603909}, 
+	{  -97046247,  1069347245}, {  -96636151,  1069384383}, {  -96226040,  1069421364}, {  -95815915,  1069458188}, 
+	{  -98686491,  1069197120}, {  -98276451,  1069234887}, {  -97866398,  1069272497}, {  -97456330,  1069309950}, 
+	{ -100326502,  1069044479}, {  -99916521,  1069082875}, {  -99506525,  1069121114}, {  -99096515,  1069159195}, 
+	{ -101966277,  1068889322}, { -101556355,  1068928347}, { -101146419,  1068967215}, { -100736468,  1069005925}, 
+	{ -103605812,  1068731650}, { -103195951,  1068771304}, { -102786074,  1068810801}, { -102376183,  1068850140}, 
+	{ -105245103,  1068571464}, { -104835303,  1068611746}, { -104425488,  1068651871}, { -104015658,  1068691839}, 
+	{ -106884147,  1068408763}, { -106474409,  1068449673}, { -106064656,  1068490427}, { -105654887,  1068531024}, 
+	{ -108522939,  1068243547}, { -108113265,  1068285087}, { -107703574,  1068326469}, { -107293868,  1068367694}, 
+	{ -110161476,  1068075818}, { -109751866,  1068117986}, { -109342239,  1068159997}, { -108932597,  1068201851}, 
+	{ -111799753,  1067905576}, { -111390208,  1067948372}, { -110980647,  1067991011}, { -110571069,  1068033493}, 
+	{ -113437768,  1067732821}, { -113028289,  1067776246}, { -112618793,  1067819513}, { -112209281,  1067862623}, 
+	{ -115075515,  1067557554}, { -114666103,  1067601606}, { -114256675,  1067645501}, { -113847230,  1067689240}, 
+	{ -116712992,  1067379774}, { -116303648,  1067424454}, { -115894288,  1067468978}, { -115484910,  1067513344}, 
+	{ -118350194,  1067199483}, { -117940919,  1067244791}, { -117531627,  1067289942}, { -117122318,  1067334937}, 
+	{ -119987118,  1067016680}, { -119577913,  1067062616}, { -119168691,  1067108396}, { -118759451,  1067154018}, 
+	{ -121623759,  1066831367}, { -121214625,  1066877931}, { -120805474,  1066924338}, { -120396304,  1066970587}, 
+	{ -123260114,  1066643544}, { -122851052,  1066690735}, { -122441972,  1066737769}, { -122032875,  1066784647}, 
+	{ -124896179,  1066453210}, { -124487190,  1066501029}, { -124078183,  1066548690}, { -123669157,  1066596195}, 
+	{ -126531950,  1066260367}, { -126123035,  1066308813}, { -125714101,  1066357102}, { -125305149,  1066405234}, 
+	{ -128167423,  1066065015}, { -127758583,  1066114088}, { -127349724,  1066163005}, { -126940846,  1066211764}, 
+	{ -129802595,  1065867154}, { -129393831,  1065916855}, { -128985047,  1065966398}, { -128576245,  1066015785}, 
+	{ -131437462,  1065666786}, { -131028774,  1065717113}, { -130620067,  1065767284}, { -130211341,  1065817297}, 
+	{ -133072019,  1065463909}, { -132663409,  1065514864}, { -132254779,  1065565661}, { -131846130,  1065616302}, 
+	{ -134706263,  1065258526}, { -134297731,  1065310107}, { -133889180,  1065361531}, { -133480609,  1065412799}, 
+	{ -136340190,  1065050636}, { -135931738,  1065102844}, { -135523266,  1065154894}, { -135114774,  1065206789}, 
+	{ -137973796,  1064840240}, { -137565425,  1064893074}, { -137157033,  1064945751}, { -136748621,  1064998272}, 
+	{ -139607077,  1064627338}, { -139198788,  1064680798}, { -138790477,  1064734102}, { -138382147,  1064787249}, 
+	{ -141240030,  1064411931}, { -140831823,  1064466017}, { -140423595,  1064519947}, { -140015347,  1064573721}, 
+	{ -142872651,  1064194019}, { -142464527,  1064248732}, { -142056382,  1064303288}, { -141648217,  1064357688}, 
+	{ -144504935,  1063973603}, { -144096896,  1064028942}, { -143688835,  1064084124}, { -143280754,  1064139150}, 
+	{ -146136880,  1063750684}, { -145728926,  1063806648}, { -145320950,  1063862456}, { -144912954,  1063918108}, 
+	{ -147768480,  1063525261}, { -147360613,  1063581851}, { -146952723,  1063638285}, { -146544812,  1063694563}, 
+	{ -149399733,  1063297336}, { -148991953,  1063354552}, { -148584150,  1063411611}, { -148176326,  1063468514}, 
+	{ -151030634,  1063066909}, { -150622942,  1063124750}, { -150215228,  1063182435}, { -149807492,  1063239964}, 
+	{ -152661180,  1062833980}, { -152253577,  1062892446}, { -151845952,  1062950757}, { -151438304,  1063008911}, 
+	{ -154291367,  1062598550}, { -153883854,  1062657642}, { -153476319,  1062716578}, { -153068761,  1062775357}, 
+	{ -155921191,  1062360620}, { -155513769,  1062420337}, { -155106324,  1062479898}, { -154698857,  1062539302}, 
+	{ -157550647,  1062120190}, { -157143318,  1062180532}, { -156735965,  1062240717}, { -156328589,  1062300747}, 
+	{ -159179733,  1061877261}, { -158772497,  1061938227}, { -158365237,  1061999038}, { -157957954,  1062059692}, 
+	{ -160808445,  1061631833}, { -160401302,  1061693424}, { -159994136,  1061754859}, { -159586946,  1061816138}, 
+	{ -162436778,  1061383907}, { -162029730,  1061446123}, { -161622659,  1061508182}, { -161215564,  1061570086}, 
+	{ -164064728,  1061133483}, { -163657777,  1061196323}, { -163250801,  1061259007}, { -162843801,  1061321535}, 
+	{ -165692293,  1060880563}, { -165285438,  1060944027}, { -164878559,  1061007335}, { -164471656,  1061070487}, 
+	{ -167319468,  1060625146}, { -166912711,  1060689234}, { -166505929,  1060753166}, { -166099124,  1060816943}, 
+	{ -168946249,  1060367233}, { -168539591,  1060431945}, { -168132908,  1060496502}, { -167726200,  1060560902}, 
+	{ -170572633,  1060106826}, { -170166074,  1060172161}, { -169759491,  1060237341}, { -169352882,  1060302365}, 
+	{ -172198615,  1059843923}, { -171792157,  1059909883}, { -171385674,  1059975686}, { -170979166,  1060041334}, 
+	{ -173824192,  1059578527}, { -173417836,  1059645110}, { -173011454,  1059711537}, { -172605047,  1059777808}, 
+	{ -175449360,  1059310638}, { -175043106,  1059377844}, { -174636827,  1059444894}, { -174230522,  1059511788}, 
+	{ -177074115,  1059040255}, { -176667965,  1059108085}, { -176261789,  1059175758}, { -175855587,  1059243276}, 
+	{ -178698453,  1058767381}, { -178292408,  1058835833}, { -177886336,  1058904130}, { -177480239,  1058972270}, 
+	{ -180322371,  1058492016}, { -179916431,  1058561091}, { -179510465,  1058630010}, { -179104472,  1058698773}, 
+	{ -181945865,  1058214159}, { -181540031,  1058283857}, { -181134171,  1058353399}, { -180728284,  1058422785}, 
+	{ -183568930,  1057933813}, { -183163204,  1058004133}, { -182757451,  1058074297}, { -182351671,  1058144306}, 
+	{ -185191564,  1057650977}, { -184785946,  1057721919}, { -184380301,  1057792706}, { -183974629,  1057863337}, 
+	{ -186813762,  1057365653}, { -186408253,  1057437217}, { -186002717,  1057508626}, { -185597154,  1057579879}, 
+	{ -188435520,  1057077840}, { -188030122,  1057150026}, { -187624696,  1057222057}, { -187219242,  1057293933}, 
+	{ -190056834,  1056787540}, { -189651548,  1056860348}, { -189246233,  1056933001}, { -188840890,  1057005498}, 
+	{ -191677702,  1056494753}, { -191272527,  1056568183}, { -190867324,  1056641457}, { -190462093,  1056714576}, 
+	{ -193298119,  1056199480}, { -192893057,  1056273531}, { -192487967,  1056347427}, { -192082849,  1056421168}, 
+	{ -194918080,  1055901722}, { -194513133,  1055976395}, { -194108156,  1056050912}, { -193703152,  1056125274}, 
+	{ -196537583,  1055601479}, { -196132751,  1055676773}, { -195727889,  1055751911}, { -195322999,  1055826894}, 
+	{ -198156624,  1055298753}, { -197751907,  1055374667}, { -197347161,  1055450426}, { -196942387,  1055526030}, 
+	{ -199775198,  1054993543}, { -199370598,  1055070078}, { -198965969,  1055146458}, { -198561311,  1055222683}, 
+	{ -201393302,  1054685850}, { -200988820,  1054763006}, { -200584309,  1054840007}, { -200179768,  1054916852}, 
+	{ -203010932,  1054375676}, { -202606569,  1054453452}, { -202202177,  1054531073}, { -201797754,  1054608539}, 
+	{ -204628085,  1054063021}, { -204223842,  1054141417}, { -203819569,  1054219658}, { -203415265,  1054297745}, 
+	{ -206244756,  1053747885}, { -205840633,  1053826901}, { -205436481,  1053905763}, { -205032298,  1053984469}, 
+	{ -207860942,  1053430270}, { -207456941,  1053509906}, { -207052910,  1053589387}, { -206648848,  1053668714}, 
+	{ -209476638,  1053110176}, { -209072760,  1053190432}, { -208668851,  1053270533}, { -208264912,  1053350479}, 
+	{ -211091842,  1052787604}, { -210688087,  1052868479}, { -210284302,  1052949200}, { -209880485,  1053029765}, 
+	{ -212706549,  1052462555}, { -212302919,  1052544049}, { -211899258,  1052625389}, { -211495565,  1052706574}, 
+	{ -214320755,  1052135029}, { -213917251,  1052217142}, { -213513715,  1052299101}, { -213110148,  1052380905}, 
+	{ -215934457,  1051805027}, { -215531079,  1051887759}, { -215127670,  1051970337}, { -214724228,  1052052760}, 
+	{ -217547651,  1051472550}, { -217144401,  1051555901}, { -216741118,  1051639098}, { -216337804,  1051722140}, 
+	{ -219160334,  1051137599}, { -218757211,  1051221569}, { -218354057,  1051305384}, { -217950870,  1051389044}, 
+	{ -220772500,  1050800175}, { -220369507,  1050884763}, { -219966481,  1050969196}, { -219563424,  1051053475}, 
+	{ -222384147,  1050460278}, { -221981284,  1050545484}, { -221578389,  1050630536}, { -221175461,  1050715433}, 
+	{ -223995270,  1050117909}, { -223592539,  1050203733}, { -223189774,  1050289403}, { -222786977,  1050374918}, 
+	{ -225605867,  1049773069}, { -225203267,  1049859511}, { -224800635,  1049945798}, { -224397969,  1050031931}, 
+	{ -227215933,  1049425759}, { -226813466,  1049512818}, { -226410966,  1049599723}, { -226008433,  1049686474}, 
+	{ -228825464,  1049075980}, { -228423131,  1049163656}, { -228020765,  1049251178}, { -227618366,  1049338546}, 
+	{ -230434456,  1048723732}, { -230032259,  1048812025}, { -229630027,  1048900165}, { -229227762,  1048988149}, 
+	{ -232042906,  1048369016}, { -231640845,  1048457926}, { -231238749,  1048546683}, { -230836620,  1048635284}, 
+	{ -233650811,  1048011834}, { -233248886,  1048101360}, { -232846927,  1048190733}, { -232444934,  1048279952}, 
+	{ -235258165,  1047652185}, { -234856378,  1047742328}, { -234454557,  1047832317}, { -234052701,  1047922153}, 
+	{ -236864966,  1047290071}, { -236463318,  1047380830}, { -236061635,  1047471436}, { -235659918,  1047561887}, 
+	{ -238471210,  1046925492}, { -238069701,  1047016868}, { -237668158,  1047108090}, { -237266579,  1047199157}, 
+	{ -240076892,  1046558451}, { -239675524,  1046650442}, { -239274121,  1046742279}, { -238872683,  1046833963}, 
+	{ -241682010,  1046188946}, { -241280783,  1046281553}, { -240879522,  1046374006}, { -240478225,  1046466305}, 
+	{ -243286558,  1045816980}, { -242885475,  1045910202}, { -242484355,  1046003271}, { -242083200,  1046096185}, 
+	{ -244890535,  1045442553}, { -244489594,  1045536390}, { -244088618,  1045630074}, { -243687606,  1045723604}, 
+	{ -246493935,  1045065665}, { -246093139,  1045160118}, { -245692307,  1045254416}, { -245291439,  1045348561}, 
+	{ -248096755,  1044686319}, { -247696104,  1044781386}, { -247295417,  1044876299}, { -246894694,  1044971059}, 
+	{ -249698991,  1044304514}, { -249298487,  1044400196}, { -248897946,  1044495724}, { -248497369,  1044591098}, 
+	{ -251300640,  1043920252}, { -250900283,  1044016548}, { -250499889,  1044112690}, { -250099458,  1044208679}, 
+	{ -252901697,  1043533534}, { -252501488,  1043630444}, { -252101242,  1043727200}, { -251700959,  1043823803}, 
+	{ -254502159,  1043144360}, { -254102099,  1043241884}, { -253702003,  1043339254}, { -253301868,  1043436471}, 
+	{ -256102022,  1042752731}, { -255702113,  1042850869}, { -255302166,  1042948852}, { -254902181,  1043046683}, 
+	{ -257701283,  1042358649}, { -257301525,  1042457400}, { -256901728,  1042555997}, { -256501894,  1042654441}, 
+	{ -259299937,  1041962114}, { -258900331,  1042061478}, { -258500686,  1042160688}, { -258101004,  1042259745}, 
+	{ -260897982,  1041563127}, { -260498528,  1041663104}, { -260099036,  1041762927}, { -259699506,  1041862597}, 
+	{ -262495412,  1041161689}, { -262096112,  1041262279}, { -261696774,  1041362715}, { -261297397,  1041462997}, 
+	{ -264092224,  1040757802}, { -263693079,  1040859003}, { -263293896,  1040960052}, { -262894673,  1041060947}, 
+	{ -265688415,  1040351465}, { -265289426,  1040453279}, { -264890398,  1040554939}, { -264491331,  1040656447}, 
+	{ -267283981,  1039942680}, { -266885149,  1040045106}, { -266486277,  1040147378}, { -266087366,  1040249498}, 
+	{ -268878918,  1039531448}, { -268480243,  1039634486}, { -268081529,  1039737370}, { -267682775,  1039840101}, 
+	{ -270473223,  1039117770}, { -270074706,  1039221419}, { -269676150,  1039324915}, { -269277554,  1039428258}, 
+	{ -272066891,  1038701647}, { -271668533,  1038805907}, { -271270136,  1038910014}, { -270871700,  1039013969}, 
+	{ -273659918,  1038283080}, { -273261722,  1038387951}, { -272863485,  1038492669}, { -272465208,  1038597234}, 
+	{ -275252302,  1037862069}, { -274854267,  1037967551}, { -274456191,  1038072880}, { -274058075,  1038178056}, 
+	{ -276844038,  1037438617}, { -276446165,  1037544709}, { -276048251,  1037650648}, { -275650297,  1037756435}, 
+	{ -278435122,  1037012723}, { -278037413,  1037119425}, { -277639662,  1037225975}, { -277241870,  1037332372}, 
+	{ -280025552,  1036584389}, { -279628006,  1036691701}, { -279230419,  1036798861}, { -278832791,  1036905868}, 
+	{ -281615322,  1036153615}, { -281217942,  1036261537}, { -280820520,  1036369307}, { -280423056,  1036476924}, 
+	{ -283204430,  1035720404}, { -282807215,  1035828935}, { -282409959,  1035937314}, { -282012662,  1036045541}, 
+	{ -284792871,  1035284755}, { -284395824,  1035393896}, { -283998734,  1035502884}, { -283601603,  1035611720}, 
+	{ -286380643,  1034846671}, { -285983763,  1034956420}, { -285586841,  1035066018}, { -285189877,  1035175463}, 
+	{ -287967740,  1034406151}, { -287571029,  1034516509}, { -287174276,  1034626715}, { -286777480,  1034736769}, 
+	{ -289554160,  1033963197}, { -289157619,  1034074164}, { -288761035,  1034184978}, { -288364409,  1034295641}, 
+	{ -291139898,  1033517810}, { -290743528,  1033629385}, { -290347114,  1033740808}, { -289950658,  1033852079}, 
+	{ -292724951,  1033069992}, { -292328753,  1033182174}, { -291932511,  1033294205}, { -291536226,  1033406084}, 
+	{ -294309316,  1032619742}, { -293913290,  1032732532}, { -293517220,  1032845170}, { -293121107,  1032957657}, 
+	{ -295892988,  1032167062}, { -295497135,  1032280460}, { -295101239,  1032393706}, { -294705299,  1032506800}, 
+	{ -297475964,  1031711954}, { -297080285,  1031825959}, { -296684563,  1031939812}, { -296288797,  1032053513}, 
+	{ -299058239,  1031254418}, { -298662736,  1031369029}, { -298267189,  1031483489}, { -297871598,  1031597797}, 
+	{ -300639811,  1030794455}, { -300244484,  1030909673}, { -299849113,  1031024740}, { -299453698,  1031139655}, 
+	{ -302220676,  1030332067}, { -301825526,  1030447891}, { -301430332,  1030563564}, { -301035094,  1030679085}, 
+	{ -303800829,  1029867254}, { -303405858,  1029983684}, { -303010842,  1030099963}, { -302615781,  1030216091}, 
+	{ -305380268,  1029400018}, { -304985475,  1029517054}, { -304590638,  1029633939}, { -304195756,  1029750672}, 
+	{ -306958988,  1028930359}, { -306564375,  1029048001}, { -306169718,  1029165491}, { -305775015,  1029282830}, 
+	{ -308536985,  1028458280}, { -308142554,  1028576527}, { -307748077,  1028694622}, { -307353555,  1028812566}, 
+	{ -310114257,  1027983780}, { -309720007,  1028102632}, { -309325712,  1028221332}, { -308931371,  1028339882}, 
+	{ -311690799,  1027506862}, { -311296732,  1027626318}, { -310902619,  1027745623}, { -310508461,  1027864777}, 
+	{ -313266607,  1027027525}, { -312872724,  1027147586}, { -312478795,  1027267495}, { -312084820,  1027387254}, 
+	{ -314841679,  1026545772}, { -314447980,  1026666437}, { -314054235,  1026786951}, { -313660444,  1026907313}, 
+	{ -316416009,  1026061603}, { -316022496,  1026182872}, { -315628937,  1026303990}, { -315235331,  1026424956}, 
+	{ -317989595,  1025575020}, { -317596268,  1025696892}, { -317202895,  1025818614}, { -316809475,  1025940184}, 
+	{ -319562433,  1025086024}, { -319169293,  1025208499}, { -318776108,  1025330824}, { -318382875,  1025452997}, 
+	{ -321134518,  1024594615}, { -320741568,  1024717694}, { -320348570,  1024840621}, { -319955525,  1024963398}, 
+	{ -322705848,  1024100796}, { -322313087,  1024224477}, { -321920278,  1024348007}, { -321527422,  1024471386}, 
+	{ -324276419,  1023604567}, { -323883848,  1023728850}, { -323491229,  1023852982}, { -323098562,  1023976964}, 
+	{ -325846226,  1023105929}, { -325453846,  1023230814}, { -325061418,  1023355549}, { -324668942,  1023480133}, 
+	{ -327415267,  1022604883}, { -327023079,  1022730370}, { -326630843,  1022855707}, { -326238559,  1022980893}, 
+	{ -328983538,  1022101432}, { -328591543,  1022227520}, { -328199499,  1022353458}, { -327807407,  1022479246}, 
+	{ -330551034,  1021595575}, { -330159233,  1021722264}, { -329767383,  1021848804}, { -329375485,  1021975193}, 
+	{ -332117752,  1021087314}, { -331726146,  1021214605}, { -331334491,  1021341745}, { -330942787,  1021468735}, 
+	{ -333683689,  1020576651}, { -333292279,  1020704542}, { -332900819,  1020832283}, { -332509310,  1020959873}, 
+	{ -335248841,  1020063586}, { -334857627,  1020192077}, { -334466364,  1020320418}, { -334075051,  1020448610}, 
+	{ -336813204,  1019548121}, { -336422188,  1019677212}, { -336031121,  1019806153}, { -335640006,  1019934944}, 
+	{ -338376774,  1019030256}, { -337985956,  1019159947}, { -337595089,  1019289488}, { -337204171,  1019418879}, 
+	{ -339939549,  1018509994}, { -339548930,  1018640284}, { -339158261,  1018770425}, { -338767543,  1018900415}, 
+	{ -341501523,  1017987335}, { -341111104,  1018118225}, { -340720636,  1018248964}, { -340330117,  1018379554}, 
+	{ -343062693,  1017462281}, { -342672476,  1017593769}, { -342282209,  1017725107}, { -341891891,  1017856296}, 
+	{ -344623057,  1016934832}, { -344233042,  1017066919}, { -343842976,  1017198856}, { -343452860,  1017330643}, 
+	{ -346182609,  1016404991}, { -345792797,  1016537676}, { -345402934,  1016670211}, { -345013021,  1016802596}, 
+	{ -347741347,  1015872758}, { -347351739,  1016006040}, { -346962080,  1016139173}, { -346572370,  1016272157}, 
+	{ -349299266,  1015338134}, { -348909863,  1015472014}, { -348520409,  1015605745}, { -348130904,  1015739326}, 
+	{ -350856364,  1014801122}, { -350467167,  1014935599}, { -350077918,  1015069927}, { -349688618,  1015204105}, 
+	{ -352412636,  1014261721}, { -352023646,  1014396795}, { -351634604,  1014531720}, { -351245510,  1014666495}, 
+	{ -353968079,  1013719934}, { -353579296,  1013855604}, { -353190461,  1013991126}, { -352801575,  1014126498}, 
+	{ -355522689,  1013175761}, { -355134115,  1013312028}, { -354745488,  1013448145}, { -354356810,  1013584114}, 
+	{ -357076462,  1012629204}, { -356688097,  1012766067}, { -356299680,  1012902780}, { -355911211,  1013039345}, 
+	{ -358629395,  1012080264}, { -358241241,  1012217723}, { -357853034,  1012355032}, { -357464774,  1012492193}, 
+	{ -360181484,  1011528943}, { -359793541,  1011666997}, { -359405545,  1011804901}, { -359017496,  1011942657}, 
+	{ -361732726,  1010975242}, { -361344995,  1011113890}, { -360957211,  1011252390}, { -360569374,  1011390741}, 
+	{ -363283116,  1010419162}, { -362895598,  1010558405}, { -362508027,  1010697499}, { -362120403,  1010836445}, 
+	{ -364832652,  1009860704}, { -364445348,  1010000541}, { -364057991,  1010140230}, { -363670580,  1010279770}, 
+	{ -366381329,  1009299870}, { -365994240,  1009440301}, { -365607098,  1009580584}, { -365219902,  1009720718}, 
+	{ -367929144,  1008736660}, { -367542271,  1008877685}, { -367155344,  1009018562}, { -366768363,  1009159290}, 
+	{ -369476093,  1008171077}, { -369089437,  1008312696}, { -368702727,  1008454166}, { -368315962,  1008595487}, 
+	{ -371022173,  1007603122}, { -370635734,  1007745333}, { -370249242,  1007887396}, { -369862694,  1008029311}, 
+	{ -372567379,  1007032796}, { -372181160,  1007175600}, { -371794885,  1007318256}, { -371408556,  1007460763}, 
+	{ -374111709,  1006460100}, { -373725709,  1006603496}, { -373339654,  1006746744}, { -372953544,  1006889844}, 
+	{ -375655159,  1005885036}, { -375269379,  1006029024}, { -374883544,  1006172864}, { -374497654,  1006316556}, 
+	{ -377197725,  1005307605}, { -376812166,  1005452185}, { -376426553,  1005596617}, { -376040883,  1005740900}, 
+	{ -378739403,  1004727809}, { -378354067,  1004872979}, { -377968675,  1005018003}, { -377583228,  1005162878}, 
+	{ -380280190,  1004145648}, { -379895077,  1004291410}, { -379509908,  1004437024}, { -379124683,  1004582490}, 
+	{ -381820082,  1003561124}, { -381435193,  1003707476}, { -381050248,  1003853681}, { -380665247,  1003999738}, 
+	{ -383359076,  1002974239}, { -382974412,  1003121181}, { -382589691,  1003267977}, { -382204915,  1003414624}, 
+	{ -384897167,  1002384994}, { -384512729,  1002532526}, { -384128234,  1002679911}, { -383743683,  1002827149}, 
+	{ -386434353,  1001793390}, { -386050142,  1001941512}, { -385665873,  1002089486}, { -385281549,  1002237314}, 
+	{ -387970630,  1001199428}, { -387586646,  1001348140}, { -387202605,  1001496704}, { -386818508,  1001645120}, 
+	{ -389505993,  1000603111}, { -389122238,  1000752411}, { -388738426,  1000901564}, { -388354556,  1001050570}, 
+	{ -391040440,  1000004439}, { -390656915,  1000154328}, { -390273331,  1000304069}, { -389889691,  1000453664}, 
+	{ -392573967,   999403415}, { -392190672,   999553891}, { -391807319,   999704221}, { -391423908,   999854404}, 
+	{ -394106570,   998800038}, { -393723506,   998951103}, { -393340384,   999102020}, { -392957205,   999252791}, 
+	{ -395638246,   998194311}, { -395255414,   998345963}, { -394872524,   998497468}, { -394489576,   998648827}, 
+	{ -397168991,   997586236}, { -396786392,   997738475}, { -396403735,   997890567}, { -396021020,   998042512}, 
+	{ -398698801,   996975812}, { -398316436,   997128638}, { -397934013,   997281317}, { -397551531,   997433850}, 
+	{ -400227673,   996363043}, { -399845543,   996516456}, { -399463355,   996669721}, { -399081107,   996822840}, 
+	{ -401755603,   995747930}, { -401373709,   995901928}, { -400991756,   996055780}, { -400609744,   996209485}, 
+	{ -403282588,   995130473}, { -402900931,   995285057}, { -402519214,   995439494}, { -402137438,   995593785}, 
+	{ -404808624,   994510675}, { -404427204,   994665844}, { -404045725,   994820867}, { -403664186,   994975743}, 
+	{ -406333708,   993888536}, { -405952526,   994044290}, { -405571285,   994199898}, { -405189985,   994355360}, 
+	{ -407857835,   993264059}, { -407476893,   993420398}, { -407095891,   993576590}, { -406714829,   993732636}, 
+	{ -409381002,   992637245}, { -409000301,   992794167}, { -408619539,   992950944}, { -408238717,   993107575}, 
+	{ -410903207,   992008094}, { -410522746,   992165601}, { -410142225,   992322961}, { -409761644,   992480176}, 
+	{ -412424444,   991376610}, { -412044226,   991534700}, { -411663946,   991692644}, { -411283607,   991850442}, 
+	{ -413944711,   990742793}, { -413564735,   990901465}, { -413184699,   991059993}, { -412804602,   991218374}, 
+	{ -415464004,   990106644}, { -415084272,   990265900}, { -414704479,   990425010}, { -414324625,   990583974}, 
+	{ -416982319,   989468165}, { -416602832,   989628003}, { -416223284,   989787696}, { -415843674,   989947243}, 
+	{ -418499653,   988827359}, { -418120411,   988987779}, { -417741109,   989148053}, { -417361744,   989308182}, 
+	{ -420016002,   988184225}, { -419637007,   988345227}, { -419257951,   988506083}, { -418878833,   988666793}, 
+	{ -421531363,   987538766}, { -421152615,   987700349}, { -420773806,   987861786}, { -420394935,   988023078}, 
+	{ -423045732,   986890984}, { -422667233,   987053147}, { -422288671,   987215165}, { -421910048,   987377038}, 
+	{ -424559105,   986240879}, { -424180855,   986403623}, { -423802543,   986566221}, { -423424169,   986728675}, 
+	{ -426071480,   985588453}, { -425693480,   985751777}, { -425315418,   985914956}, { -424937293,   986077990}, 
+	{ -427582852,   984933708}, { -427205103,   985097612}, { -426827291,   985261370}, { -426449417,   985424984}, 
+	{ -429093217,   984276646}, { -428715720,   984441129}, { -428338160,   984605467}, { -427960537,   984769660}, 
+	{ -430602573,   983617267}, { -430225329,   983782329}, { -429848022,   983947246}, { -429470651,   984112018}, 
+	{ -432110916,   982955574}, { -431733926,   983121214}, { -431356872,   983286710}, { -430979754,   983452061}, 
+	{ -433618242,   982291568}, { -433241506,   982457786}, { -432864706,   982623860}, { -432487843,   982789789}, 
+	{ -435124548,   981625251}, { -434748067,   981792047}, { -434371523,   981958698}, { -433994914,   982125205}, 
+	{ -436629829,   980956623}, { -436253605,   981123997}, { -435877317,   981291226}, { -435500964,   981458310}, 
+	{ -438134084,   980285688}, { -437758117,   980453638}, { -437382085,   980621444}, { -437005989,   980789106}, 
+	{ -439637307,   979612445}, { -439261598,   979780972}, { -438885824,   979949355}, { -438509986,   980117593}, 
+	{ -441139496,   978936898}, { -440764046,   979106001}, { -440388531,   979274960}, { -440012951,   979443774}, 
+	{ -442640647,   978259047}, { -442265456,   978428725}, { -441890201,   978598260}, { -441514881,   978767651}, 
+	{ -444140756,   977578894}, { -443765826,   977749148}, { -443390832,   977919258}, { -443015772,   978089224}, 
+	{ -445639820,   976896441}, { -445265152,   977067269}, { -444890419,   977237955}, { -444515620,   977408496}, 
+	{ -447137835,   976211688}, { -446763430,   976383092}, { -446388959,   976554352}, { -446014422,   976725468}, 
+	{ -448634799,   975524639}, { -448260657,   975696617}, { -447886449,   975868451}, { -447512175,   976040141}, 
+	{ -450130706,   974835295}, { -449756829,   975007846}, { -449382885,   975180254}, { -449008875,   975352518}, 
+	{ -451625555,   974143656}, { -451251942,   974316781}, { -450878263,   974489762}, { -450504518,   974662600}, 
+	{ -453119340,   973449725}, { -452745994,   973623423}, { -452372581,   973796977}, { -451999101,   973970388}, 
+	{ -454612060,   972753504}, { -454238980,   972927774}, { -453865834,   973101901}, { -453492620,   973275885}, 
+	{ -456103710,   972054994}, { -455730898,   972229836}, { -455358019,   972404535}, { -454985073,   972579091}, 
+	{ -457594286,   971354196}, { -457221743,   971529610}, { -456849132,   971704881}, { -456476455,   971880009}, 
+	{ -459083786,   970651112}, { -458711512,   970827098}, { -458339171,   971002940}, { -457966762,   971178639}, 
+	{ -460572205,   969945745}, { -460200202,   970122301}, { -459828131,   970298714}, { -459455992,   970474985}, 
+	{ -462059541,   969238095}, { -461687809,   969415222}, { -461316009,   969592205}, { -460944141,   969769046}, 
+	{ -463545789,   968528165}, { -463174329,   968705861}, { -462802801,   968883415}, { -462431205,   969060826}, 
+	{ -465030947,   967815955}, { -464659760,   967994221}, { -464288505,   968172345}, { -463917181,   968350326}, 
+	{ -466515010,   967101468}, { -466144097,   967280303}, { -465773116,   967458996}, { -465402066,   967637547}, 
+	{ -467997976,   966384706}, { -467627338,   966564109}, { -467256631,   966743371}, { -466885855,   966922491}, 
+	{ -469479840,   965665669}, { -469109478,   965845641}, { -468739046,   966025471}, { -468368545,   966205159}, 
+	{ -470960600,   964944360}, { -470590514,   965124900}, { -470220358,   965305298}, { -469850134,   965485555}, 
+	{ -472440251,   964220780}, { -472070443,   964401888}, { -471700564,   964582854}, { -471330617,   964763678}, 
+	{ -473918791,   963494932}, { -473549261,   963676607}, { -473179660,   963858140}, { -472809991,   964039531}, 
+	{ -475396216,   962766816}, { -475026964,   962949058}, { -474657643,   963131157}, { -474288252,   963313116}, 
+	{ -476872522,   962036435}, { -476503550,   962219243}, { -476134509,   962401909}, { -475765397,   962584433}, 
+	{ -478347705,   961303790}, { -477979015,   961487164}, { -477610254,   961670396}, { -477241423,   961853486}, 
+	{ -479821764,   960568883}, { -479453355,   960752822}, { -479084875,   960936620}, { -478716326,   961120276}, 
+	{ -481294693,   959831716}, { -480926566,   960016220}, { -480558369,   960200582}, { -480190102,   960384803}, 
+	{ -482766489,   959092290}, { -482398646,   959277359}, { -482030733,   959462286}, { -481662748,   959647071}, 
+	{ -484237150,   958350608}, { -483869591,   958536240}, { -483501962,   958721731}, { -483134261,   958907081}, 
+	{ -485706671,   957606670}, { -485339398,   957792866}, { -484972053,   957978921}, { -484604637,   958164835}, 
+	{ -487175049,   956860479}, { -486808062,   957047238}, { -486441003,   957233856}, { -486073873,   957420333}, 
+	{ -488642281,   956112036}, { -488275581,   956299358}, { -487908809,   956486539}, { -487541965,   956673579}, 
+	{ -490108363,   955361344}, { -489741950,   955549228}, { -489375466,   955736971}, { -489008909,   955924574}, 
+	{ -491573292,   954608403}, { -491207168,   954796849}, { -490840972,   954985154}, { -490474703,   955173319}, 
+	{ -493037064,   953853216}, { -492671229,   954042224}, { -492305322,   954231090}, { -491939343,   954419817}, 
+	{ -494499676,   953095785}, { -494134132,   953285353}, { -493768515,   953474781}, { -493402826,   953664069}, 
+	{ -495961124,   952336111}, { -495595871,   952526240}, { -495230545,   952716228}, { -494865147,   952906077}, 
+	{ -497421405,   951574196}, { -497056444,   951764885}, { -496691410,   951955434}, { -496326304,   952145842}, 
+	{ -498880516,   950810042}, { -498515848,   951001290}, { -498151107,   951192399}, { -497786293,   951383367}, 
+	{ -500338453,   950043650}, { -499974079,   950235458}, { -499609631,   950427126}, { -499245110,   950618654}, 
+	{ -501795212,   949275023}, { -501431133,   949467390}, { -501066980,   949659616}, { -500702753,   949851703}, 
+	{ -503250791,   948504163}, { -502887007,   948697087}, { -502523149,   948889872}, { -502159217,   949082517}, 
+	{ -504705185,   947731070}, { -504341698,   947924552}, { -503978136,   948117895}, { -503614500,   948311099}, 
+	{ -506158392,   946955747}, { -505795202,   947149787}, { -505431937,   947343687}, { -505068598,   947537448}, 
+	{ -507610408,   946178196}, { -507247516,   946372792}, { -506884549,   946567250}, { -506521508,   946761568}, 
+	{ -509061229,   945398418}, { -508698636,   945593571}, { -508335968,   945788585}, { -507973225,   945983460}, 
+	{ -510510853,   944616416}, { -510148559,   944812125}, { -509786191,   945007695}, { -509423748,   945203126}, 
+	{ -511959275,   943832191}, { -511597282,   944028456}, { -511235214,   944224582}, { -510873071,   944420568}, 
+	{ -513406493,   943045745}, { -513044801,   943242565}, { -512683035,   943439246}, { -512321192,   943635788}, 
+	{ -514852502,   942257081}, { -514491113,   942454455}, { -514129648,   942651690}, { -513768108,   942848787}, 
+	{ -516297300,   941466198}, { -515936214,   941664127}, { -515575053,   941861917}, { -515213815,   942059568}, 
+	{ -517740883,   940673101}, { -517380101,   940871583}, { -517019243,   941069926}, { -516658310,   941268132}, 
+	{ -519183248,   939877790}, { -518822771,   940076825}, { -518462218,   940275722}, { -518101588,   940474481}, 
+	{ -520624391,   939080267}, { -520264220,   939279855}, { -519903972,   939479305}, { -519543648,   939678616}, 
+	{ -522064309,   938280535}, { -521704444,   938480675}, { -521344503,   938680677}, { -520984485,   938880541}, 
+	{ -523502998,   937478595}, { -523143441,   937679287}, { -522783807,   937879841}, { -522424096,   938080257}, 
+	{ -524940456,   936674448}, { -524581207,   936875692}, { -524221881,   937076797}, { -523862478,   937277765}, 
+	{ -526376678,   935868098}, { -526017739,   936069892}, { -525658722,   936271549}, { -525299627,   936473067}, 
+	{ -527811662,   935059546}, { -527453033,   935261890}, { -527094325,   935464097}, { -526735541,   935666166}, 
+	{ -529245404,   934248793}, { -528887085,   934451687}, { -528528689,   934654444}, { -528170214,   934857064}, 
+	{ -530677900,   933435842}, { -530319893,   933639286}, { -529961808,   933842592}, { -529603645,   934045761}, 
+	{ -532109148,   932620694}, { -531751453,   932824687}, { -531393681,   933028542}, { -531035830,   933232261}, 
+	{ -533539144,   931803352}, { -533181762,   932007893}, { -532824303,   932212297}, { -532466765,   932416564}, 
+	{ -534967884,   930983817}, { -534610817,   931188906}, { -534253671,   931393859}, { -533896447,   931598674}, 
+	{ -536395365,   930162092}, { -536038613,   930367728}, { -535681782,   930573228}, { -535324872,   930778591}, 
+	{ -537821584,   929338177}, { -537465148,   929544361}, { -537108633,   929750408}, { -536752038,   929956318}, 
+	{ -539246538,   928512076}, { -538890418,   928718807}, { -538534220,   928925400}, { -538177942,   929131857}, 
+	{ -540670223,   927683790}, { -540314421,   927891067}, { -539958539,   928098206}, { -539602578,   928305210}, 
+	{ -542092635,   926853322}, { -541737151,   927061143}, { -541381588,   927268829}, { -541025945,   927476378}, 
+	{ -543513772,   926020672}, { -543158607,   926229039}, { -542803363,   926437269}, { -542448039,   926645363}, 
+	{ -544933630,   925185843}, { -544578785,   925394754}, { -544223861,   925603530}, { -543868856,   925812169}, 
+	{ -546352205,   924348837}, { -545997682,   924558292}, { -545643078,   924767612}, { -545288394,   924976795}, 
+	{ -547769495,   923509656}, { -547415294,   923719655}, { -547061011,   923929518}, { -546706649,   924139246}, 
+	{ -549185496,   922668302}, { -548831617,   922878844}, { -548477657,   923089250}, { -548123617,   923299521}, 
+	{ -550600205,   921824777}, { -550246649,   922035861}, { -549893013,   922246810}, { -549539295,   922457624}, 
+	{ -552013618,   920979082}, { -551660387,   921190709}, { -551307074,   921402200}, { -550953680,   921613556}, 
+	{ -553425732,   920131221}, { -553072826,   920343389}, { -552719838,   920555422}, { -552366769,   920767320}, 
+	{ -554836544,   919281194}, { -554483964,   919493904}, { -554131301,   919706478}, { -553778558,   919918917}, 
+	{ -556246051,   918429004}, { -555893797,   918642254}, { -555541461,   918855369}, { -555189044,   919068349}, 
+	{ -557654248,   917574653}, { -557302322,   917788443}, { -556950313,   918002099}, { -556598223,   918215619}, 
+	{ -559061133,   916718143}, { -558709535,   916932473}, { -558357855,   917146668}, { -558006093,   917360728}, 
+	{ -560466703,   915859476}, { -560115434,   916074345}, { -559764083,   916289079}, { -559412649,   916503678}, 
+	{ -561870954,   914998653}, { -561520015,   915214061}, { -561168994,   915429334}, { -560817890,   915644472}, 
+	{ -563273883,   914135678}, { -562923275,   914351624}, { -562572584,   914567435}, { -562221810,   914783111}, 
+	{ -564675486,   913270551}, { -564325210,   913487035}, { -563974850,   913703383}, { -563624408,   913919598}, 
+	{ -566075761,   912403276}, { -565725817,   912620296}, { -565375790,   912837182}, { -565025679,   913053934}, 
+	{ -567474703,   911533853}, { -567125093,   911751410}, { -566775399,   911968833}, { -566425621,   912186121}, 
+	{ -568872310,   910662286}, { -568523034,   910880379}, { -568173674,   911098338}, { -567824230,   911316163}, 
+	{ -570268579,   909788576}, { -569919637,   910007204}, { -569570612,   910225699}, { -569221503,   910444059}, 
+	{ -571663506,   908912725}, { -571314900,   909131888}, { -570966210,   909350918}, { -570617437,   909569814}, 
+	{ -573057087,   908034735}, { -572708818,   908254433}, { -572360465,   908473997}, { -572012027,   908693428}, 
+	{ -574449320,   907154608}, { -574101389,   907374840}, { -573753372,   907594938}, { -573405272,   907814903}, 
+	{ -575840202,   906272347}, { -575492608,   906493112}, { -575144930,   906713744}, { -574797167,   906934243}, 
+	{ -577229728,   905387953}, { -576882473,   905609251}, { -576535134,   905830417}, { -576187710,   906051448}, 
+	{ -578617896,   904501429}, { -578270981,   904723260}, { -577923982,   904944957}, { -577576897,   905166522}, 
+	{ -580004702,   903612776}, { -579658129,   903835139}, { -579311470,   904057369}, { -578964725,   904279465}, 
+	{ -581390144,   902721998}, { -581043912,   902944892}, { -580697594,   903167653}, { -580351191,   903390281}, 
+	{ -582774218,   901829095}, { -582428328,   902052519}, { -582082352,   902275811}, { -581736291,   902498971}, 
+	{ -584156920,   900934069}, { -583811373,   901158025}, { -583465740,   901381847}, { -583120022,   901605537}, 
+	{ -585538248,   900036924}, { -585193045,   900261409}, { -584847756,   900485762}, { -584502381,   900709982}, 
+	{ -586918198,   899137661}, { -586573340,   899362675}, { -586228395,   899587557}, { -585883365,   899812307}, 
+	{ -588296766,   898236282}, { -587952254,   898461825}, { -587607655,   898687236}, { -587262969,   898912515}, 
+	{ -589673951,   897332790}, { -589329785,   897558861}, { -588985532,   897784800}, { -588641192,   898010607}, 
+	{ -591049748,   896427186}, { -590705929,   896653785}, { -590362023,   896880252}, { -590018030,   897106587}, 
+	{ -592424154,   895519473}, { -592080683,   895746599}, { -591737125,   895973593}, { -591393480,   896200456}, 
+	{ -593797166,   894609652}, { -593454044,   894837305}, { -593110835,   895064826}, { -592767538,   895292215}, 
+	{ -595168781,   893697727}, { -594826008,   893925905}, { -594483148,   894153953}, { -594140201,   894381868}, 
+	{ -596538995,   892783698}, { -596196573,   893012402}, { -595854063,   893240975}, { -595511466,   893469417}, 
+	{ -597907806,   891867569}, { -597565735,   892096798}, { -597223576,   892325896}, { -596881330,   892554863}, 
+	{ -599275210,   890949341}, { -598933491,   891179094}, { -598591684,   891408717}, { -598249789,   891638208}, 
+	{ -600641203,   890029016}, { -600299837,   890259294}, { -599958383,   890489440}, { -599616840,   890719456}, 
+	{ -602005783,   889106597}, { -601664771,   889337398}, { -601323670,   889568068}, { -600982481,   889798608}, 
+	{ -603368947,   888182086}, { -603028289,   888413410}, { -602687543,   888644603}, { -602346707,   888875666}, 
+	{ -604730691,   887255485}, { -604390388,   887487331}, { -604049997,   887719047}, { -603709516,   887950632}, 
+	{ -606091012,   886326796}, { -605751065,   886559164}, { -605411029,   886791402}, { -605070905,   887023509}, 
+	{ -607449906,   885396022}, { -607110317,   885628911}, { -606770638,   885861670}, { -606430869,   886094298}, 
+	{ -608807372,   884463164}, { -608468140,   884696574}, { -608128818,   884929853}, { -607789407,   885163003}, 
+	{ -610163404,   883528225}, { -609824531,   883762155}, { -609485567,   883995955}, { -609146514,   884229624}, 
+	{ -611518001,   882591207}, { -611179487,   882825656}, { -610840882,   883059976}, { -610502188,   883294165}, 
+	{ -612871159,   881652112}, { -612533005,   881887080}, { -612194760,   882121919}, { -611856426,   882356628}, 
+	{ -614222875,   880710943}, { -613885081,   880946429}, { -613547198,   881181787}, { -613209223,   881417014}, 
+	{ -615573145,   879767701}, { -615235714,   880003705}, { -614898191,   880239581}, { -614560578,   880475326}, 
+	{ -616921967,   878822389}, { -616584898,   879058911}, { -616247738,   879295303}, { -615910487,   879531567}, 
+	{ -618269338,   877875009}, { -617932631,   878112047}, { -617595834,   878348957}, { -617258946,   878585737}, 
+	{ -619615253,   876925563}, { -619278911,   877163118}, { -618942478,   877400544}, { -618605953,   877637841}, 
+	{ -620959711,   875974054}, { -620623733,   876212124}, { -620287664,   876450066}, { -619951504,   876687879}, 
+	{ -622302707,   875020483}, { -621967095,   875259069}, { -621631392,   875497526}, { -621295597,   875735854}, 
+	{ -623644239,   874064853}, { -623308993,   874303954}, { -622973656,   874542925}, { -622638227,   874781769}, 
+	{ -624984303,   873107167}, { -624649425,   873346781}, { -624314455,   873586267}, { -623979393,   873825625}, 
+	{ -626322897,   872147426}, { -625988387,   872387554}, { -625653784,   872627553}, { -625319090,   872867424}, 
+	{ -627660017,   871185633}, { -627325875,   871426274}, { -626991641,   871666786}, { -626657315,   871907170}, 
+	{ -628995660,   870221790}, { -628661888,   870462943}, { -628328023,   870703968}, { -627994066,   870944865}, 
+	{ -630329823,   869255900}, { -629996421,   869497564}, { -629662927,   869739101}, { -629329340,   869980510}, 
+	{ -631662503,   868287963}, { -631329472,   868530139}, { -630996348,   868772187}, { -630663132,   869014107}, 
+	{ -632993696,   867317984}, { -632661037,   867560670}, { -632328285,   867803229}, { -631995440,   868045660}, 
+	{ -634323400,   866345964}, { -633991114,   866589160}, { -633658734,   866832229}, { -633326262,   867075170}, 
+	{ -635651611,   865371905}, { -635319698,   865615611}, { -634987692,   865859189}, { -634655593,   866102640}, 
+	{ -636978327,   864395810}, { -636646788,   864640024}, { -636315156,   864884112}, { -635983430,   865128072}, 
+	{ -638303543,   863417681}, { -637972380,   863662404}, { -637641122,   863906999}, { -637309771,   864151468}, 
+	{ -639627258,   862437520}, { -639296470,   862682750}, { -638965588,   862927854}, { -638634613,   863172831}, 
+	{ -640949467,   861455330}, { -640619056,   861701067}, { -640288551,   861946678}, { -639957951,   862192163}, 
+	{ -642270169,   860471112}, { -641940135,   860717357}, { -641610007,   860963474}, { -641279784,   861209465}, 
+	{ -643589359,   859484870}, { -643259703,   859731620}, { -642929953,   859978244}, { -642600108,   860224742}, 
+	{ -644907034,   858496606}, { -644577757,   858743861}, { -644248386,   858990991}, { -643918920,   859237994}, 
+	{ -646223192,   857506321}, { -645894295,   857754081}, { -645565303,   858001716}, { -645236216,   858249224}, 
+	{ -647537830,   856514019}, { -647209313,   856762283}, { -646880701,   857010422}, { -646551994,   857258434}, 
+	{ -648850943,   855519701}, { -648522808,   855768469}, { -648194577,   856017111}, { -647866251,   856265628}, 
+	{ -650162530,   854523370}, { -649834777,   854772641}, { -649506928,   855021787}, { -649178983,   855270806}, 
+	{ -651472587,   853525028}, { -651145216,   853774802}, { -650817750,   854024450}, { -650490188,   854273973}, 
+	{ -652781111,   852524677}, { -652454124,   852774953}, { -652127041,   853025104}, { -651799862,   853275128}, 
+	{ -654088099,   851522321}, { -653761496,   851773098}, { -653434797,   852023750}, { -653108002,   852274276}, 
+	{ -655393548,   850517961}, { -655067330,   850769239}, { -654741016,   851020391}, { -654414606,   851271419}, 
+	{ -656697454,   849511600}, { -656371622,   849763378}, { -656045694,   850015030}, { -655719669,   850266558}, 
+	{ -657999816,   848503239}, { -657674370,   848755517}, { -657348828,   849007669}, { -657023190,   849259697}, 
+	{ -659300629,   847492882}, { -658975571,   847745659}, { -658650416,   847998310}, { -658325164,   848250837}, 
+	{ -660599890,   846480531}, { -660275220,   846733806}, { -659950454,   846986956}, { -659625590,   847239981}, 
+	{ -661897597,   845466188}, { -661573317,   845719960}, { -661248938,   845973608}, { -660924463,   846227132}, 
+	{ -663193747,   844449856}, { -662869856,   844704125}, { -662545867,   844958270}, { -662221781,   845212291}, 
+	{ -664488336,   843431536}, { -664164835,   843686302}, { -663841237,   843940944}, { -663517541,   844195462}, 
+	{ -665781362,   842411232}, { -665458252,   842666494}, { -665135044,   842921632}, { -664811739,   843176646}, 
+	{ -667072820,   841388945}, { -666750103,   841644702}, { -666427287,   841900336}, { -666104373,   842155846}, 
+	{ -668362709,   840364679}, { -668040385,   840620931}, { -667717961,   840877059}, { -667395440,   841133064}, 
+	{ -669651026,   839338435}, { -669329094,   839595181}, { -669007064,   839851804}, { -668684936,   840108303}, 
+	{ -670937767,   838310216}, { -670616229,   838567456}, { -670294593,   838824572}, { -669972859,   839081565}, 
+	{ -672222928,   837280024}, { -671901786,   837537757}, { -671580545,   837795367}, { -671259205,   838052853}, 
+	{ -673506508,   836247863}, { -673185762,   836506088}, { -672864916,   836764190}, { -672543972,   837022168}, 
+	{ -674788504,   835213733}, { -674468154,   835472450}, { -674147704,   835731044}, { -673827156,   835989515}, 
+	{ -676068911,   834177638}, { -675748958,   834436846}, { -675428906,   834695931}, { -675108755,   834954893}, 
+	{ -677347728,   833139580}, { -677028173,   833399279}, { -676708518,   833658855}, { -676388765,   833918308}, 
+	{ -678624950,   832099562}, { -678305794,   832359750}, { -677986538,   832619816}, { -677667183,   832879760}, 
+	{ -679900576,   831057586}, { -679581820,   831318263}, { -679262963,   831578819}, { -678944007,   831839252}, 
+	{ -681174602,   830013654}, { -680856246,   830274820}, { -680537789,   830535864}, { -680219233,   830796786}, 
+	{ -682447025,   828967769}, { -682129070,   829229423}, { -681811014,   829490956}, { -681492858,   829752366}, 
+	{ -683717842,   827919934}, { -683400289,   828182075}, { -683082635,   828444095}, { -682764880,   828705993}, 
+	{ -684987051,   826870150}, { -684669900,   827132778}, { -684352648,   827395285}, { -684035295,   827657670}, 
+	{ -686254647,   825818421}, { -685937899,   826081535}, { -685621051,   826344528}, { -685304101,   826607400}, 
+	{ -687520629,   824764748}, { -687204285,   825028348}, { -686887840,   825291827}, { -686571294,   825555185}, 
+	{ -688784993,   823709135}, { -688469054,   823973220}, { -688153013,   824237184}, { -687836872,   824501026}, 
+	{ -690047736,   822651583}, { -689732202,   822916152}, { -689416567,   823180601}, { -689100831,   823444928}, 
+	{ -691308855,   821592095}, { -690993728,   821857149}, { -690678499,   822122081}, { -690363168,   822386892}, 
+	{ -692568348,   820530675}, { -692253627,   820796211}, { -691938805,   821061627}, { -691623881,   821326921}, 
+	{ -693826211,   819467323}, { -693511898,   819733342}, { -693197483,   819999240}, { -692882966,   820265018}, 
+	{ -695082441,   818402043}, { -694768537,   818668544}, { -694454530,   818934924}, { -694140422,   819201184}, 
+	{ -696337036,   817334838}, { -696023541,   817601820}, { -695709943,   817868681}, { -695396243,   818135422}, 
+	{ -697589992,   816265709}, { -697276907,   816533171}, { -696963719,   816800514}, { -696650429,   817067736}, 
+	{ -698841307,   815194659}, { -698528632,   815462602}, { -698215855,   815730424}, { -697902975,   815998127}, 
+	{ -700090977,   814121692}, { -699778714,   814390113}, { -699466348,   814658415}, { -699153879,   814926597}, 
+	{ -701339000,   813046808}, { -701027149,   813315708}, { -700715194,   813584489}, { -700403137,   813853150}, 
+	{ -702585372,   811970011}, { -702273934,   812239390}, { -701962393,   812508649}, { -701650748,   812777788}, 
+	{ -703830092,   810891304}, { -703519067,   811161160}, { -703207939,   811430896}, { -702896707,   811700513}, 
+	{ -705073155,   809810688}, { -704762544,   810081021}, { -704451830,   810351235}, { -704141013,   810621329}, 
+	{ -706314559,   808728167}, { -706004363,   808998976}, { -705694064,   809269666}, { -705383661,   809540237}, 
+	{ -707554301,   807643743}, { -707244521,   807915028}, { -706934638,   808186193}, { -706624650,   808457240}, 
+	{ -708792378,   806557419}, { -708483015,   806829178}, { -708173547,   807100819}, { -707863976,   807372340}, 
+	{ -710028787,   805469196}, { -709719841,   805741430}, { -709410791,   806013545}, { -709101636,   806285541}, 
+	{ -711263525,   804379079}, { -710954997,   804651786}, { -710646365,   804924374}, { -710337628,   805196845}, 
+	{ -712496590,   803287068}, { -712188481,   803560248}, { -711880267,   803833310}, { -711571948,   804106253}, 
+	{ -713727978,   802193167}, { -713420288,   802466820}, { -713112494,   802740354}, { -712804594,   803013770}, 
+	{ -714957687,   801097379}, { -714650417,   801371503}, { -714343043,   801645509}, { -714035563,   801919397}, 
+	{ -716185713,   799999706}, { -715878864,   800274300}, { -715571910,   800548778}, { -715264851,   800823137}, 
+	{ -717412054,   798900150}, { -717105627,   799175215}, { -716799095,   799450163}, { -716492457,   799724993}, 
+	{ -718636707,   797798714}, { -718330702,   798074249}, { -718024592,   798349667}, { -717718376,   798624967}, 
+	{ -719859669,   796695401}, { -719554087,   796971405}, { -719248400,   797247292}, { -718942606,   797523061}, 
+	{ -721080937,   795590213}, { -720775779,   795866685}, { -720470515,   796143041}, { -720165145,   796419279}, 
+	{ -722300508,   794483153}, { -721995775,   794760093}, { -721690935,   795036917}, { -721385989,   795313623}, 
+	{ -723518380,   793374223}, { -723214072,   793651631}, { -722909657,   793928922}, { -722605136,   794206096}, 
+	{ -724734549,   792263427}, { -724430667,   792541301}, { -724126677,   792819059}, { -723822582,   793096699}, 
+	{ -725949013,   791150767}, { -725645557,   791429106}, { -725341994,   791707330}, { -725038325,   791985437}, 
+	{ -727161768,   790036244}, { -726858740,   790315049}, { -726555604,   790593738}, { -726252362,   790872310}, 
+	{ -728372813,   788919863}, { -728070212,   789199133}, { -727767504,   789478286}, { -727464690,   789757323}, 
+	{ -729582143,   787801625}, { -729279971,   788081359}, { -728977692,   788360976}, { -728675306,   788640478}, 
+	{ -730789757,   786681534}, { -730488014,   786961731}, { -730186165,   787241811}, { -729884208,   787521776}, 
+	{ -731995651,   785559591}, { -731694339,   785840250}, { -731392919,   786120794}, { -731091392,   786401222}, 
+	{ -733199822,   784435800}, { -732898941,   784716921}, { -732597952,   784997927}, { -732296855,   785278817}, 
+	{ -734402269,   783310163}, { -734101819,   783591746}, { -733801261,   783873212}, { -733500596,   784154564}, 
+	{ -735602987,   782182683}, { -735302970,   782464726}, { -735002844,   782746654}, { -734702610,   783028466}, 
+	{ -736801974,   781053363}, { -736502390,   781335865}, { -736202697,   781618253}, { -735902896,   781900526}, 
+	{ -737999228,   779922204}, { -737700077,   780205166}, { -737400818,   780488013}, { -737101450,   780770745}, 
+	{ -739194745,   778789210}, { -738896028,   779072631}, { -738597203,   779355936}, { -738298270,   779639128}, 
+	{ -740388522,   777654384}, { -740090241,   777938262}, { -739791851,   778222026}, { -739493352,   778505675}, 
+	{ -741580558,   776517728}, { -741282712,   776802063}, { -740984758,   777086284}, { -740686694,   777370391}, 
+	{ -742770848,   775379244}, { -742473439,   775664036}, { -742175921,   775948714}, { -741878294,   776233278}, 
+	{ -743959390,   774238936}, { -743662419,   774524184}, { -743365338,   774809318}, { -743068147,   775094338}, 
+	{ -745146182,   773096806}, { -744849649,   773382509}, { -744553005,   773668099}, { -744256253,   773953574}, 
+	{ -746331221,   771952857}, { -746035126,   772239015}, { -745738921,   772525059}, { -745442606,   772810989}, 
+	{ -747514503,   770807092}, { -747218847,   771093703}, { -746923082,   771380201}, { -746627206,   771666586}, 
+	{ -748696026,   769659512}, { -748400811,   769946577}, { -748105485,   770233528}, { -747810049,   770520367}, 
+	{ -749875788,   768510122}, { -749581013,   768797639}, { -749286127,   769085043}, { -748991132,   769372334}, 
+	{ -751053785,   767358923}, { -750759451,   767646892}, { -750465007,   767934748}, { -750170453,   768222492}, 
+	{ -752230015,   766205919}, { -751936123,   766494339}, { -751642121,   766782646}, { -751348008,   767070841}, 
+	{ -753404474,   765051111}, { -753111025,   765339982}, { -752817466,   765628740}, { -752523796,   765917386}, 
+	{ -754577161,   763894504}, { -754284156,   764183824}, { -753991040,   764473032}, { -753697812,   764762128}, 
+	{ -755748072,   762736098}, { -755455511,   763025868}, { -755162839,   763315525}, { -754870056,   763605071}, 
+	{ -756917205,   761575898}, { -756625089,   761866116}, { -756332861,   762156223}, { -756040522,   762446217}, 
+	{ -758084557,   760413906}, { -757792886,   760704572}, { -757501104,   760995126}, { -757209210,   761285568}, 
+	{ -759250125,   759250125}, { -758958900,   759541238}, { -758667564,   759832239}, { -758376116,   760123129}, 
+	{ -760413906,   758084557}, { -760123129,   758376116}, { -759832239,   758667564}, { -759541238,   758958900}, 
+	{ -761575898,   756917205}, { -761285568,   757209210}, { -760995126,   757501104}, { -760704572,   757792886}, 
+	{ -762736098,   755748072}, { -762446217,   756040522}, { -762156223,   756332861}, { -761866116,   756625089}, 
+	{ -763894504,   754577161}, { -763605071,   754870056}, { -763315525,   755162839}, { -763025868,   755455511}, 
+	{ -765051111,   753404474}, { -764762128,   753697812}, { -764473032,   753991040}, { -764183824,   754284156}, 
+	{ -766205919,   752230015}, { -765917386,   752523796}, { -765628740,   752817466}, { -765339982,   753111025}, 
+	{ -767358923,   751053785}, { -767070841,   751348008}, { -766782646,   751642121}, { -766494339,   751936123}, 
+	{ -768510122,   749875788}, { -768222492,   750170453}, { -767934748,   750465007}, { -767646892,   750759451}, 
+	{ -769659512,   748696026}, { -769372334,   748991132}, { -769085043,   749286127}, { -768797639,   749581013}, 
+	{ -770807092,   747514503}, { -770520367,   747810049}, { -770233528,   748105485}, { -769946577,   748400811}, 
+	{ -771952857,   746331221}, { -771666586,   746627206}, { -771380201,   746923082}, { -771093703,   747218847}, 
+	{ -773096806,   745146182}, { -772810989,   745442606}, { -772525059,   745738921}, { -772239015,   746035126}, 
+	{ -774238936,   743959390}, { -773953574,   744256253}, { -773668099,   744553005}, { -773382509,   744849649}, 
+	{ -775379244,   742770848}, { -775094338,   743068147}, { -774809318,   743365338}, { -774524184,   743662419}, 
+	{ -776517728,   741580558}, { -776233278,   741878294}, { -775948714,   742175921}, { -775664036,   742473439}, 
+	{ -777654384,   740388522}, { -777370391,   740686694}, { -777086284,   740984758}, { -776802063,   741282712}, 
+	{ -778789210,   739194745}, { -778505675,   739493352}, { -778222026,   739791851}, { -777938262,   740090241}, 
+	{ -779922204,   737999228}, { -779639128,   738298270}, { -779355936,   738597203}, { -779072631,   738896028}, 
+	{ -781053363,   736801974}, { -780770745,   737101450}, { -780488013,   737400818}, { -780205166,   737700077}, 
+	{ -782182683,   735602987}, { -781900526,   735902896}, { -781618253,   736202697}, { -781335865,   736502390}, 
+	{ -783310163,   734402269}, { -783028466,   734702610}, { -782746654,   735002844}, { -782464726,   735302970}, 
+	{ -784435800,   733199822}, { -784154564,   733500596}, { -783873212,   733801261}, { -783591746,   734101819}, 
+	{ -785559591,   731995651}, { -785278817,   732296855}, { -784997927,   732597952}, { -784716921,   732898941}, 
+	{ -786681534,   730789757}, { -786401222,   731091392}, { -786120794,   731392919}, { -785840250,   731694339}, 
+	{ -787801625,   729582143}, { -787521776,   729884208}, { -787241811,   730186165}, { -786961731,   730488014}, 
+	{ -788919863,   728372813}, { -788640478,   728675306}, { -788360976,   728977692}, { -788081359,   729279971}, 
+	{ -790036244,   727161768}, { -789757323,   727464690}, { -789478286,   727767504}, { -789199133,   728070212}, 
+	{ -791150767,   725949013}, { -790872310,   726252362}, { -790593738,   726555604}, { -790315049,   726858740}, 
+	{ -792263427,   724734549}, { -791985437,   725038325}, { -791707330,   725341994}, { -791429106,   725645557}, 
+	{ -793374223,   723518380}, { -793096699,   723822582}, { -792819059,   724126677}, { -792541301,   724430667}, 
+	{ -794483153,   722300508}, { -794206096,   722605136}, { -793928922,   722909657}, { -793651631,   723214072}, 
+	{ -795590213,   721080937}, { -795313623,   721385989}, { -795036917,   721690935}, { -794760093,   721995775}, 
+	{ -796695401,   719859669}, { -796419279,   720165145}, { -796143041,   720470515}, { -795866685,   720775779}, 
+	{ -797798714,   718636707}, { -797523061,   718942606}, { -797247292,   719248400}, { -796971405,   719554087}, 
+	{ -798900150,   717412054}, { -798624967,   717718376}, { -798349667,   718024592}, { -798074249,   718330702}, 
+	{ -799999706,   716185713}, { -799724993,   716492457}, { -799450163,   716799095}, { -799175215,   717105627}, 
+	{ -801097379,   714957687}, { -800823137,   715264851}, { -800548778,   715571910}, { -800274300,   715878864}, 
+	{ -802193167,   713727978}, { -801919397,   714035563}, { -801645509,   714343043}, { -801371503,   714650417}, 
+	{ -803287068,   712496590}, { -803013770,   712804594}, { -802740354,   713112494}, { -802466820,   713420288}, 
+	{ -804379079,   711263525}, { -804106253,   711571948}, { -803833310,   711880267}, { -803560248,   712188481}, 
+	{ -805469196,   710028787}, { -805196845,   710337628}, { -804924374,   710646365}, { -804651786,   710954997}, 
+	{ -806557419,   708792378}, { -806285541,   709101636}, { -806013545,   709410791}, { -805741430,   709719841}, 
+	{ -807643743,   707554301}, { -807372340,   707863976}, { -807100819,   708173547}, { -806829178,   708483015}, 
+	{ -808728167,   706314559}, { -808457240,   706624650}, { -808186193,   706934638}, { -807915028,   707244521}, 
+	{ -809810688,   705073155}, { -809540237,   705383661}, { -809269666,   705694064}, { -808998976,   706004363}, 
+	{ -810891304,   703830092}, { -810621329,   704141013}, { -810351235,   704451830}, { -810081021,   704762544}, 
+	{ -811970011,   702585372}, { -811700513,   702896707}, { -811430896,   703207939}, { -811161160,   703519067}, 
+	{ -813046808,   701339000}, { -812777788,   701650748}, { -812508649,   701962393}, { -812239390,   702273934}, 
+	{ -814121692,   700090977}, { -813853150,   700403137}, { -813584489,   700715194}, { -813315708,   701027149}, 
+	{ -815194659,   698841307}, { -814926597,   699153879}, { -814658415,   699466348}, { -814390113,   699778714}, 
+	{ -816265709,   697589992}, { -815998127,   697902975}, { -815730424,   698215855}, { -815462602,   698528632}, 
+	{ -817334838,   696337036}, { -817067736,   696650429}, { -816800514,   696963719}, { -816533171,   697276907}, 
+	{ -818402043,   695082441}, { -818135422,   695396243}, { -817868681,   695709943}, { -817601820,   696023541}, 
+	{ -819467323,   693826211}, { -819201184,   694140422}, { -818934924,   694454530}, { -818668544,   694768537}, 
+	{ -820530675,   692568348}, { -820265018,   692882966}, { -819999240,   693197483}, { -819733342,   693511898}, 
+	{ -821592095,   691308855}, { -821326921,   691623881}, { -821061627,   691938805}, { -820796211,   692253627}, 
+	{ -822651583,   690047736}, { -822386892,   690363168}, { -822122081,   690678499}, { -821857149,   690993728}, 
+	{ -823709135,   688784993}, { -823444928,   689100831}, { -823180601,   689416567}, { -822916152,   689732202}, 
+	{ -824764748,   687520629}, { -824501026,   687836872}, { -824237184,   688153013}, { -823973220,   688469054}, 
+	{ -825818421,   686254647}, { -825555185,   686571294}, { -825291827,   686887840}, { -825028348,   687204285}, 
+	{ -826870150,   684987051}, { -826607400,   685304101}, { -826344528,   685621051}, { -826081535,   685937899}, 
+	{ -827919934,   683717842}, { -827657670,   684035295}, { -827395285,   684352648}, { -827132778,   684669900}, 
+	{ -828967769,   682447025}, { -828705993,   682764880}, { -828444095,   683082635}, { -828182075,   683400289}, 
+	{ -830013654,   681174602}, { -829752366,   681492858}, { -829490956,   681811014}, { -829229423,   682129070}, 
+	{ -831057586,   679900576}, { -830796786,   680219233}, { -830535864,   680537789}, { -830274820,   680856246}, 
+	{ -832099562,   678624950}, { -831839252,   678944007}, { -831578819,   679262963}, { -831318263,   679581820}, 
+	{ -833139580,   677347728}, { -832879760,   677667183}, { -832619816,   677986538}, { -832359750,   678305794}, 
+	{ -834177638,   676068911}, { -833918308,   676388765}, { -833658855,   676708518}, { -833399279,   677028173}, 
+	{ -835213733,   674788504}, { -834954893,   675108755}, { -834695931,   675428906}, { -834436846,   675748958}, 
+	{ -836247863,   673506508}, { -835989515,   673827156}, { -835731044,   674147704}, { -835472450,   674468154}, 
+	{ -837280024,   672222928}, { -837022168,   672543972}, { -836764190,   672864916}, { -836506088,   673185762}, 
+	{ -838310216,   670937767}, { -838052853,   671259205}, { -837795367,   671580545}, { -837537757,   671901786}, 
+	{ -839338435,   669651026}, { -839081565,   669972859}, { -838824572,   670294593}, { -838567456,   670616229}, 
+	{ -840364679,   668362709}, { -840108303,   668684936}, { -839851804,   669007064}, { -839595181,   669329094}, 
+	{ -841388945,   667072820}, { -841133064,   667395440}, { -840877059,   667717961}, { -840620931,   668040385}, 
+	{ -842411232,   665781362}, { -842155846,   666104373}, { -841900336,   666427287}, { -841644702,   666750103}, 
+	{ -843431536,   664488336}, { -843176646,   664811739}, { -842921632,   665135044}, { -842666494,   665458252}, 
+	{ -844449856,   663193747}, { -844195462,   663517541}, { -843940944,   663841237}, { -843686302,   664164835}, 
+	{ -845466188,   661897597}, { -845212291,   662221781}, { -844958270,   662545867}, { -844704125,   662869856}, 
+	{ -846480531,   660599890}, { -846227132,   660924463}, { -845973608,   661248938}, { -845719960,   661573317}, 
+	{ -847492882,   659300629}, { -847239981,   659625590}, { -846986956,   659950454}, { -846733806,   660275220}, 
+	{ -848503239,   657999816}, { -848250837,   658325164}, { -847998310,   658650416}, { -847745659,   658975571}, 
+	{ -849511600,   656697454}, { -849259697,   657023190}, { -849007669,   657348828}, { -848755517,   657674370}, 
+	{ -850517961,   655393548}, { -850266558,   655719669}, { -850015030,   656045694}, { -849763378,   656371622}, 
+	{ -851522321,   654088099}, { -851271419,   654414606}, { -851020391,   654741016}, { -850769239,   655067330}, 
+	{ -852524677,   652781111}, { -852274276,   653108002}, { -852023750,   653434797}, { -851773098,   653761496}, 
+	{ -853525028,   651472587}, { -853275128,   651799862}, { -853025104,   652127041}, { -852774953,   652454124}, 
+	{ -854523370,   650162530}, { -854273973,   650490188}, { -854024450,   650817750}, { -853774802,   651145216}, 
+	{ -855519701,   648850943}, { -855270806,   649178983}, { -855021787,   649506928}, { -854772641,   649834777}, 
+	{ -856514019,   647537830}, { -856265628,   647866251}, { -856017111,   648194577}, { -855768469,   648522808}, 
+	{ -857506321,   646223192}, { -857258434,   646551994}, { -857010422,   646880701}, { -856762283,   647209313}, 
+	{ -858496606,   644907034}, { -858249224,   645236216}, { -858001716,   645565303}, { -857754081,   645894295}, 
+	{ -859484870,   643589359}, { -859237994,   643918920}, { -858990991,   644248386}, { -858743861,   644577757}, 
+	{ -860471112,   642270169}, { -860224742,   642600108}, { -859978244,   642929953}, { -859731620,   643259703}, 
+	{ -861455330,   640949467}, { -861209465,   641279784}, { -860963474,   641610007}, { -860717357,   641940135}, 
+	{ -862437520,   639627258}, { -862192163,   639957951}, { -861946678,   640288551}, { -861701067,   640619056}, 
+	{ -863417681,   638303543}, { -863172831,   638634613}, { -862927854,   638965588}, { -862682750,   639296470}, 
+	{ -864395810,   636978327}, { -864151468,   637309771}, { -863906999,   637641122}, { -863662404,   637972380}, 
+	{ -865371905,   635651611}, { -865128072,   635983430}, { -864884112,   636315156}, { -864640024,   636646788}, 
+	{ -866345964,   634323400}, { -866102640,   634655593}, { -865859189,   634987692}, { -865615611,   635319698}, 
+	{ -867317984,   632993696}, { -867075170,   633326262}, { -866832229,   633658734}, { -866589160,   633991114}, 
+	{ -868287963,   631662503}, { -868045660,   631995440}, { -867803229,   632328285}, { -867560670,   632661037}, 
+	{ -869255900,   630329823}, { -869014107,   630663132}, { -868772187,   630996348}, { -868530139,   631329472}, 
+	{ -870221790,   628995660}, { -869980510,   629329340}, { -869739101,   629662927}, { -869497564,   629996421}, 
+	{ -871185633,   627660017}, { -870944865,   627994066}, { -870703968,   628328023}, { -870462943,   628661888}, 
+	{ -872147426,   626322897}, { -871907170,   626657315}, { -871666786,   626991641}, { -871426274,   627325875}, 
+	{ -873107167,   624984303}, { -872867424,   625319090}, { -872627553,   625653784}, { -872387554,   625988387}, 
+	{ -874064853,   623644239}, { -873825625,   623979393}, { -873586267,   624314455}, { -873346781,   624649425}, 
+	{ -875020483,   622302707}, { -874781769,   622638227}, { -874542925,   622973656}, { -874303954,   623308993}, 
+	{ -875974054,   620959711}, { -875735854,   621295597}, { -875497526,   621631392}, { -875259069,   621967095}, 
+	{ -876925563,   619615253}, { -876687879,   619951504}, { -876450066,   620287664}, { -876212124,   620623733}, 
+	{ -877875009,   618269338}, { -877637841,   618605953}, { -877400544,   618942478}, { -877163118,   619278911}, 
+	{ -878822389,   616921967}, { -878585737,   617258946}, { -878348957,   617595834}, { -878112047,   617932631}, 
+	{ -879767701,   615573145}, { -879531567,   615910487}, { -879295303,   616247738}, { -879058911,   616584898}, 
+	{ -880710943,   614222875}, { -880475326,   614560578}, { -880239581,   614898191}, { -880003705,   615235714}, 
+	{ -881652112,   612871159}, { -881417014,   613209223}, { -881181787,   613547198}, { -880946429,   613885081}, 
+	{ -882591207,   611518001}, { -882356628,   611856426}, { -882121919,   612194760}, { -881887080,   612533005}, 
+	{ -883528225,   610163404}, { -883294165,   610502188}, { -883059976,   610840882}, { -882825656,   611179487}, 
+	{ -884463164,   608807372}, { -884229624,   609146514}, { -883995955,   609485567}, { -883762155,   609824531}, 
+	{ -885396022,   607449906}, { -885163003,   607789407}, { -884929853,   608128818}, { -884696574,   608468140}, 
+	{ -886326796,   606091012}, { -886094298,   606430869}, { -885861670,   606770638}, { -885628911,   607110317}, 
+	{ -887255485,   604730691}, { -887023509,   605070905}, { -886791402,   605411029}, { -886559164,   605751065}, 
+	{ -888182086,   603368947}, { -887950632,   603709516}, { -887719047,   604049997}, { -887487331,   604390388}, 
+	{ -889106597,   602005783}, { -888875666,   602346707}, { -888644603,   602687543}, { -888413410,   603028289}, 
+	{ -890029016,   600641203}, { -889798608,   600982481}, { -889568068,   601323670}, { -889337398,   601664771}, 
+	{ -890949341,   599275210}, { -890719456,   599616840}, { -890489440,   599958383}, { -890259294,   600299837}, 
+	{ -891867569,   597907806}, { -891638208,   598249789}, { -891408717,   598591684}, { -891179094,   598933491}, 
+	{ -892783698,   596538995}, { -892554863,   596881330}, { -892325896,   597223576}, { -892096798,   597565735}, 
+	{ -893697727,   595168781}, { -893469417,   595511466}, { -893240975,   595854063}, { -893012402,   596196573}, 
+	{ -894609652,   593797166}, { -894381868,   594140201}, { -894153953,   594483148}, { -893925905,   594826008}, 
+	{ -895519473,   592424154}, { -895292215,   592767538}, { -895064826,   593110835}, { -894837305,   593454044}, 
+	{ -896427186,   591049748}, { -896200456,   591393480}, { -895973593,   591737125}, { -895746599,   592080683}, 
+	{ -897332790,   589673951}, { -897106587,   590018030}, { -896880252,   590362023}, { -896653785,   590705929}, 
+	{ -898236282,   588296766}, { -898010607,   588641192}, { -897784800,   588985532}, { -897558861,   589329785}, 
+	{ -899137661,   586918198}, { -898912515,   587262969}, { -898687236,   587607655}, { -898461825,   587952254}, 
+	{ -900036924,   585538248}, { -899812307,   585883365}, { -899587557,   586228395}, { -899362675,   586573340}, 
+	{ -900934069,   584156920}, { -900709982,   584502381}, { -900485762,   584847756}, { -900261409,   585193045}, 
+	{ -901829095,   582774218}, { -901605537,   583120022}, { -901381847,   583465740}, { -901158025,   583811373}, 
+	{ -902721998,   581390144}, { -902498971,   581736291}, { -902275811,   582082352}, { -902052519,   582428328}, 
+	{ -903612776,   580004702}, { -903390281,   580351191}, { -903167653,   580697594}, { -902944892,   581043912}, 
+	{ -904501429,   578617896}, { -904279465,   578964725}, { -904057369,   579311470}, { -903835139,   579658129}, 
+	{ -905387953,   577229728}, { -905166522,   577576897}, { -904944957,   577923982}, { -904723260,   578270981}, 
+	{ -906272347,   575840202}, { -906051448,   576187710}, { -905830417,   576535134}, { -905609251,   576882473}, 
+	{ -907154608,   574449320}, { -906934243,   574797167}, { -906713744,   575144930}, { -906493112,   575492608}, 
+	{ -908034735,   573057087}, { -907814903,   573405272}, { -907594938,   573753372}, { -907374840,   574101389}, 
+	{ -908912725,   571663506}, { -908693428,   572012027}, { -908473997,   572360465}, { -908254433,   572708818}, 
+	{ -909788576,   570268579}, { -909569814,   570617437}, { -909350918,   570966210}, { -909131888,   571314900}, 
+	{ -910662286,   568872310}, { -910444059,   569221503}, { -910225699,   569570612}, { -910007204,   569919637}, 
+	{ -911533853,   567474703}, { -911316163,   567824230}, { -911098338,   568173674}, { -910880379,   568523034}, 
+	{ -912403276,   566075761}, { -912186121,   566425621}, { -911968833,   566775399}, { -911751410,   567125093}, 
+	{ -913270551,   564675486}, { -913053934,   565025679}, { -912837182,   565375790}, { -912620296,   565725817}, 
+	{ -914135678,   563273883}, { -913919598,   563624408}, { -913703383,   563974850}, { -913487035,   564325210}, 
+	{ -914998653,   561870954}, { -914783111,   562221810}, { -914567435,   562572584}, { -914351624,   562923275}, 
+	{ -915859476,   560466703}, { -915644472,   560817890}, { -915429334,   561168994}, { -915214061,   561520015}, 
+	{ -916718143,   559061133}, { -916503678,   559412649}, { -916289079,   559764083}, { -916074345,   560115434}, 
+	{ -917574653,   557654248}, { -917360728,   558006093}, { -917146668,   558357855}, { -916932473,   558709535}, 
+	{ -918429004,   556246051}, { -918215619,   556598223}, { -918002099,   556950313}, { -917788443,   557302322}, 
+	{ -919281194,   554836544}, { -919068349,   555189044}, { -918855369,   555541461}, { -918642254,   555893797}, 
+	{ -920131221,   553425732}, { -919918917,   553778558}, { -919706478,   554131301}, { -919493904,   554483964}, 
+	{ -920979082,   552013618}, { -920767320,   552366769}, { -920555422,   552719838}, { -920343389,   553072826}, 
+	{ -921824777,   550600205}, { -921613556,   550953680}, { -921402200,   551307074}, { -921190709,   551660387}, 
+	{ -922668302,   549185496}, { -922457624,   549539295}, { -922246810,   549893013}, { -922035861,   550246649}, 
+	{ -923509656,   547769495}, { -923299521,   548123617}, { -923089250,   548477657}, { -922878844,   548831617}, 
+	{ -924348837,   546352205}, { -924139246,   546706649}, { -923929518,   547061011}, { -923719655,   547415294}, 
+	{ -925185843,   544933630}, { -924976795,   545288394}, { -924767612,   545643078}, { -924558292,   545997682}, 
+	{ -926020672,   543513772}, { -925812169,   543868856}, { -925603530,   544223861}, { -925394754,   544578785}, 
+	{ -926853322,   542092635}, { -926645363,   542448039}, { -926437269,   542803363}, { -926229039,   543158607}, 
+	{ -927683790,   540670223}, { -927476378,   541025945}, { -927268829,   541381588}, { -927061143,   541737151}, 
+	{ -928512076,   539246538}, { -928305210,   539602578}, { -928098206,   539958539}, { -927891067,   540314421}, 
+	{ -929338177,   537821584}, { -929131857,   538177942}, { -928925400,   538534220}, { -928718807,   538890418}, 
+	{ -930162092,   536395365}, { -929956318,   536752038}, { -929750408,   537108633}, { -929544361,   537465148}, 
+	{ -930983817,   534967884}, { -930778591,   535324872}, { -930573228,   535681782}, { -930367728,   536038613}, 
+	{ -931803352,   533539144}, { -931598674,   533896447}, { -931393859,   534253671}, { -931188906,   534610817}, 
+	{ -932620694,   532109148}, { -932416564,   532466765}, { -932212297,   532824303}, { -932007893,   533181762}, 
+	{ -933435842,   530677900}, { -933232261,   531035830}, { -933028542,   531393681}, { -932824687,   531751453}, 
+	{ -934248793,   529245404}, { -934045761,   529603645}, { -933842592,   529961808}, { -933639286,   530319893}, 
+	{ -935059546,   527811662}, { -934857064,   528170214}, { -934654444,   528528689}, { -934451687,   528887085}, 
+	{ -935868098,   526376678}, { -935666166,   526735541}, { -935464097,   527094325}, { -935261890,   527453033}, 
+	{ -936674448,   524940456}, { -936473067,   525299627}, { -936271549,   525658722}, { -936069892,   526017739}, 
+	{ -937478595,   523502998}, { -937277765,   523862478}, { -937076797,   524221881}, { -936875692,   524581207}, 
+	{ -938280535,   522064309}, { -938080257,   522424096}, { -937879841,   522783807}, { -937679287,   523143441}, 
+	{ -939080267,   520624391}, { -938880541,   520984485}, { -938680677,   521344503}, { -938480675,   521704444}, 
+	{ -939877790,   519183248}, { -939678616,   519543648}, { -939479305,   519903972}, { -939279855,   520264220}, 
+	{ -940673101,   517740883}, { -940474481,   518101588}, { -940275722,   518462218}, { -940076825,   518822771}, 
+	{ -941466198,   516297300}, { -941268132,   516658310}, { -941069926,   517019243}, { -940871583,   517380101}, 
+	{ -942257081,   514852502}, { -942059568,   515213815}, { -941861917,   515575053}, { -941664127,   515936214}, 
+	{ -943045745,   513406493}, { -942848787,   513768108}, { -942651690,   514129648}, { -942454455,   514491113}, 
+	{ -943832191,   511959275}, { -943635788,   512321192}, { -943439246,   512683035}, { -943242565,   513044801}, 
+	{ -944616416,   510510853}, { -944420568,   510873071}, { -944224582,   511235214}, { -944028456,   511597282}, 
+	{ -945398418,   509061229}, { -945203126,   509423748}, { -945007695,   509786191}, { -944812125,   510148559}, 
+	{ -946178196,   507610408}, { -945983460,   507973225}, { -945788585,   508335968}, { -945593571,   508698636}, 
+	{ -946955747,   506158392}, { -946761568,   506521508}, { -946567250,   506884549}, { -946372792,   507247516}, 
+	{ -947731070,   504705185}, { -947537448,   505068598}, { -947343687,   505431937}, { -947149787,   505795202}, 
+	{ -948504163,   503250791}, { -948311099,   503614500}, { -948117895,   503978136}, { -947924552,   504341698}, 
+	{ -949275023,   501795212}, { -949082517,   502159217}, { -948889872,   502523149}, { -948697087,   502887007}, 
+	{ -950043650,   500338453}, { -949851703,   500702753}, { -949659616,   501066980}, { -949467390,   501431133}, 
+	{ -950810042,   498880516}, { -950618654,   499245110}, { -950427126,   499609631}, { -950235458,   499974079}, 
+	{ -951574196,   497421405}, { -951383367,   497786293}, { -951192399,   498151107}, { -951001290,   498515848}, 
+	{ -952336111,   495961124}, { -952145842,   496326304}, { -951955434,   496691410}, { -951764885,   497056444}, 
+	{ -953095785,   494499676}, { -952906077,   494865147}, { -952716228,   495230545}, { -952526240,   495595871}, 
+	{ -953853216,   493037064}, { -953664069,   493402826}, { -953474781,   493768515}, { -953285353,   494134132}, 
+	{ -954608403,   491573292}, { -954419817,   491939343}, { -954231090,   492305322}, { -954042224,   492671229}, 
+	{ -955361344,   490108363}, { -955173319,   490474703}, { -954985154,   490840972}, { -954796849,   491207168}, 
+	{ -956112036,   488642281}, { -955924574,   489008909}, { -955736971,   489375466}, { -955549228,   489741950}, 
+	{ -956860479,   487175049}, { -956673579,   487541965}, { -956486539,   487908809}, { -956299358,   488275581}, 
+	{ -957606670,   485706671}, { -957420333,   486073873}, { -957233856,   486441003}, { -957047238,   486808062}, 
+	{ -958350608,   484237150}, { -958164835,   484604637}, { -957978921,   484972053}, { -957792866,   485339398}, 
+	{ -959092290,   482766489}, { -958907081,   483134261}, { -958721731,   483501962}, { -958536240,   483869591}, 
+	{ -959831716,   481294693}, { -959647071,   481662748}, { -959462286,   482030733}, { -959277359,   482398646}, 
+	{ -960568883,   479821764}, { -960384803,   480190102}, { -960200582,   480558369}, { -960016220,   480926566}, 
+	{ -961303790,   478347705}, { -961120276,   478716326}, { -960936620,   479084875}, { -960752822,   479453355}, 
+	{ -962036435,   476872522}, { -961853486,   477241423}, { -961670396,   477610254}, { -961487164,   477979015}, 
+	{ -962766816,   475396216}, { -962584433,   475765397}, { -962401909,   476134509}, { -962219243,   476503550}, 
+	{ -963494932,   473918791}, { -963313116,   474288252}, { -963131157,   474657643}, { -962949058,   475026964}, 
+	{ -964220780,   472440251}, { -964039531,   472809991}, { -963858140,   473179660}, { -963676607,   473549261}, 
+	{ -964944360,   470960600}, { -964763678,   471330617}, { -964582854,   471700564}, { -964401888,   472070443}, 
+	{ -965665669,   469479840}, { -965485555,   469850134}, { -965305298,   470220358}, { -965124900,   470590514}, 
+	{ -966384706,   467997976}, { -966205159,   468368545}, { -966025471,   468739046}, { -965845641,   469109478}, 
+	{ -967101468,   466515010}, { -966922491,   466885855}, { -966743371,   467256631}, { -966564109,   467627338}, 
+	{ -967815955,   465030947}, { -967637547,   465402066}, { -967458996,   465773116}, { -967280303,   466144097}, 
+	{ -968528165,   463545789}, { -968350326,   463917181}, { -968172345,   464288505}, { -967994221,   464659760}, 
+	{ -969238095,   462059541}, { -969060826,   462431205}, { -968883415,   462802801}, { -968705861,   463174329}, 
+	{ -969945745,   460572205}, { -969769046,   460944141}, { -969592205,   461316009}, { -969415222,   461687809}, 
+	{ -970651112,   459083786}, { -970474985,   459455992}, { -970298714,   459828131}, { -970122301,   460200202}, 
+	{ -971354196,   457594286}, { -971178639,   457966762}, { -971002940,   458339171}, { -970827098,   458711512}, 
+	{ -972054994,   456103710}, { -971880009,   456476455}, { -971704881,   456849132}, { -971529610,   457221743}, 
+	{ -972753504,   454612060}, { -972579091,   454985073}, { -972404535,   455358019}, { -972229836,   455730898}, 
+	{ -973449725,   453119340}, { -973275885,   453492620}, { -973101901,   453865834}, { -972927774,   454238980}, 
+	{ -974143656,   451625555}, { -973970388,   451999101}, { -973796977,   452372581}, { -973623423,   452745994}, 
+	{ -974835295,   450130706}, { -974662600,   450504518}, { -974489762,   450878263}, { -974316781,   451251942}, 
+	{ -975524639,   448634799}, { -975352518,   449008875}, { -975180254,   449382885}, { -975007846,   449756829}, 
+	{ -976211688,   447137835}, { -976040141,   447512175}, { -975868451,   447886449}, { -975696617,   448260657}, 
+	{ -976896441,   445639820}, { -976725468,   446014422}, { -976554352,   446388959}, { -976383092,   446763430}, 
+	{ -977578894,   444140756}, { -977408496,   444515620}, { -977237955,   444890419}, { -977067269,   445265152}, 
+	{ -978259047,   442640647}, { -978089224,   443015772}, { -977919258,   443390832}, { -977749148,   443765826}, 
+	{ -978936898,   441139496}, { -978767651,   441514881}, { -978598260,   441890201}, { -978428725,   442265456}, 
+	{ -979612445,   439637307}, { -979443774,   440012951}, { -979274960,   440388531}, { -979106001,   440764046}, 
+	{ -980285688,   438134084}, { -980117593,   438509986}, { -979949355,   438885824}, { -979780972,   439261598}, 
+	{ -980956623,   436629829}, { -980789106,   437005989}, { -980621444,   437382085}, { -980453638,   437758117}, 
+	{ -981625251,   435124548}, { -981458310,   435500964}, { -981291226,   435877317}, { -981123997,   436253605}, 
+	{ -982291568,   433618242}, { -982125205,   433994914}, { -981958698,   434371523}, { -981792047,   434748067}, 
+	{ -982955574,   432110916}, { -982789789,   432487843}, { -982623860,   432864706}, { -982457786,   433241506}, 
+	{ -983617267,   430602573}, { -983452061,   430979754}, { -983286710,   431356872}, { -983121214,   431733926}, 
+	{ -984276646,   429093217}, { -984112018,   429470651}, { -983947246,   429848022}, { -983782329,   430225329}, 
+	{ -984933708,   427582852}, { -984769660,   427960537}, { -984605467,   428338160}, { -984441129,   428715720}, 
+	{ -985588453,   426071480}, { -985424984,   426449417}, { -985261370,   426827291}, { -985097612,   427205103}, 
+	{ -986240879,   424559105}, { -986077990,   424937293}, { -985914956,   425315418}, { -985751777,   425693480}, 
+	{ -986890984,   423045732}, { -986728675,   423424169}, { -986566221,   423802543}, { -986403623,   424180855}, 
+	{ -987538766,   421531363}, { -987377038,   421910048}, { -987215165,   422288671}, { -987053147,   422667233}, 
+	{ -988184225,   420016002}, { -988023078,   420394935}, { -987861786,   420773806}, { -987700349,   421152615}, 
+	{ -988827359,   418499653}, { -988666793,   418878833}, { -988506083,   419257951}, { -988345227,   419637007}, 
+	{ -989468165,   416982319}, { -989308182,   417361744}, { -989148053,   417741109}, { -988987779,   418120411}, 
+	{ -990106644,   415464004}, { -989947243,   415843674}, { -989787696,   416223284}, { -989628003,   416602832}, 
+	{ -990742793,   413944711}, { -990583974,   414324625}, { -990425010,   414704479}, { -990265900,   415084272}, 
+	{ -991376610,   412424444}, { -991218374,   412804602}, { -991059993,   413184699}, { -990901465,   413564735}, 
+	{ -992008094,   410903207}, { -991850442,   411283607}, { -991692644,   411663946}, { -991534700,   412044226}, 
+	{ -992637245,   409381002}, { -992480176,   409761644}, { -992322961,   410142225}, { -992165601,   410522746}, 
+	{ -993264059,   407857835}, { -993107575,   408238717}, { -992950944,   408619539}, { -992794167,   409000301}, 
+	{ -993888536,   406333708}, { -993732636,   406714829}, { -993576590,   407095891}, { -993420398,   407476893}, 
+	{ -994510675,   404808624}, { -994355360,   405189985}, { -994199898,   405571285}, { -994044290,   405952526}, 
+	{ -995130473,   403282588}, { -994975743,   403664186}, { -994820867,   404045725}, { -994665844,   404427204}, 
+	{ -995747930,   401755603}, { -995593785,   402137438}, { -995439494,   402519214}, { -995285057,   402900931}, 
+	{ -996363043,   400227673}, { -996209485,   400609744}, { -996055780,   400991756}, { -995901928,   401373709}, 
+	{ -996975812,   398698801}, { -996822840,   399081107}, { -996669721,   399463355}, { -996516456,   399845543}, 
+	{ -997586236,   397168991}, { -997433850,   397551531}, { -997281317,   397934013}, { -997128638,   398316436}, 
+	{ -998194311,   395638246}, { -998042512,   396021020}, { -997890567,   396403735}, { -997738475,   396786392}, 
+	{ -998800038,   394106570}, { -998648827,   394489576}, { -998497468,   394872524}, { -998345963,   395255414}, 
+	{ -999403415,   392573967}, { -999252791,   392957205}, { -999102020,   393340384}, { -998951103,   393723506}, 
+	{-1000004439,   391040440}, { -999854404,   391423908}, { -999704221,   391807319}, { -999553891,   392190672}, 
+	{-1000603111,   389505993}, {-1000453664,   389889691}, {-1000304069,   390273331}, {-1000154328,   390656915}, 
+	{-1001199428,   387970630}, {-1001050570,   388354556}, {-1000901564,   388738426}, {-1000752411,   389122238}, 
+	{-1001793390,   386434353}, {-1001645120,   386818508}, {-1001496704,   387202605}, {-1001348140,   387586646}, 
+	{-1002384994,   384897167}, {-1002237314,   385281549}, {-1002089486,   385665873}, {-1001941512,   386050142}, 
+	{-1002974239,   383359076}, {-1002827149,   383743683}, {-1002679911,   384128234}, {-1002532526,   384512729}, 
+	{-1003561124,   381820082}, {-1003414624,   382204915}, {-1003267977,   382589691}, {-1003121181,   382974412}, 
+	{-1004145648,   380280190}, {-1003999738,   380665247}, {-1003853681,   381050248}, {-1003707476,   381435193}, 
+	{-1004727809,   378739403}, {-1004582490,   379124683}, {-1004437024,   379509908}, {-1004291410,   379895077}, 
+	{-1005307605,   377197725}, {-1005162878,   377583228}, {-1005018003,   377968675}, {-1004872979,   378354067}, 
+	{-1005885036,   375655159}, {-1005740900,   376040883}, {-1005596617,   376426553}, {-1005452185,   376812166}, 
+	{-1006460100,   374111709}, {-1006316556,   374497654}, {-1006172864,   374883544}, {-1006029024,   375269379}, 
+	{-1007032796,   372567379}, {-1006889844,   372953544}, {-1006746744,   373339654}, {-1006603496,   373725709}, 
+	{-1007603122,   371022173}, {-1007460763,   371408556}, {-1007318256,   371794885}, {-1007175600,   372181160}, 
+	{-1008171077,   369476093}, {-1008029311,   369862694}, {-1007887396,   370249242}, {-1007745333,   370635734}, 
+	{-1008736660,   367929144}, {-1008595487,   368315962}, {-1008454166,   368702727}, {-1008312696,   369089437}, 
+	{-1009299870,   366381329}, {-1009159290,   366768363}, {-1009018562,   367155344}, {-1008877685,   367542271}, 
+	{-1009860704,   364832652}, {-1009720718,   365219902}, {-1009580584,   365607098}, {-1009440301,   365994240}, 
+	{-1010419162,   363283116}, {-1010279770,   363670580}, {-1010140230,   364057991}, {-1010000541,   364445348}, 
+	{-1010975242,   361732726}, {-1010836445,   362120403}, {-1010697499,   362508027}, {-1010558405,   362895598}, 
+	{-1011528943,   360181484}, {-1011390741,   360569374}, {-1011252390,   360957211}, {-1011113890,   361344995}, 
+	{-1012080264,   358629395}, {-1011942657,   359017496}, {-1011804901,   359405545}, {-1011666997,   359793541}, 
+	{-1012629204,   357076462}, {-1012492193,   357464774}, {-1012355032,   357853034}, {-1012217723,   358241241}, 
+	{-1013175761,   355522689}, {-1013039345,   355911211}, {-1012902780,   356299680}, {-1012766067,   356688097}, 
+	{-1013719934,   353968079}, {-1013584114,   354356810}, {-1013448145,   354745488}, {-1013312028,   355134115}, 
+	{-1014261721,   352412636}, {-1014126498,   352801575}, {-1013991126,   353190461}, {-1013855604,   353579296}, 
+	{-1014801122,   350856364}, {-1014666495,   351245510}, {-1014531720,   351634604}, {-1014396795,   352023646}, 
+	{-1015338134,   349299266}, {-1015204105,   349688618}, {-1015069927,   350077918}, {-1014935599,   350467167}, 
+	{-1015872758,   347741347}, {-1015739326,   348130904}, {-1015605745,   348520409}, {-1015472014,   348909863}, 
+	{-1016404991,   346182609}, {-1016272157,   346572370}, {-1016139173,   346962080}, {-1016006040,   347351739}, 
+	{-1016934832,   344623057}, {-1016802596,   345013021}, {-1016670211,   345402934}, {-1016537676,   345792797}, 
+	{-1017462281,   343062693}, {-1017330643,   343452860}, {-1017198856,   343842976}, {-1017066919,   344233042}, 
+	{-1017987335,   341501523}, {-1017856296,   341891891}, {-1017725107,   342282209}, {-1017593769,   342672476}, 
+	{-1018509994,   339939549}, {-1018379554,   340330117}, {-1018248964,   340720636}, {-1018118225,   341111104}, 
+	{-1019030256,   338376774}, {-1018900415,   338767543}, {-1018770425,   339158261}, {-1018640284,   339548930}, 
+	{-1019548121,   336813204}, {-1019418879,   337204171}, {-1019289488,   337595089}, {-1019159947,   337985956}, 
+	{-1020063586,   335248841}, {-1019934944,   335640006}, {-1019806153,   336031121}, {-1019677212,   336422188}, 
+	{-1020576651,   333683689}, {-1020448610,   334075051}, {-1020320418,   334466364}, {-1020192077,   334857627}, 
+	{-1021087314,   332117752}, {-1020959873,   332509310}, {-1020832283,   332900819}, {-1020704542,   333292279}, 
+	{-1021595575,   330551034}, {-1021468735,   330942787}, {-1021341745,   331334491}, {-1021214605,   331726146}, 
+	{-1022101432,   328983538}, {-1021975193,   329375485}, {-1021848804,   329767383}, {-1021722264,   330159233}, 
+	{-1022604883,   327415267}, {-1022479246,   327807407}, {-1022353458,   328199499}, {-1022227520,   328591543}, 
+	{-1023105929,   325846226}, {-1022980893,   326238559}, {-1022855707,   326630843}, {-1022730370,   327023079}, 
+	{-1023604567,   324276419}, {-1023480133,   324668942}, {-1023355549,   325061418}, {-1023230814,   325453846}, 
+	{-1024100796,   322705848}, {-1023976964,   323098562}, {-1023852982,   323491229}, {-1023728850,   323883848}, 
+	{-1024594615,   321134518}, {-1024471386,   321527422}, {-1024348007,   321920278}, {-1024224477,   322313087}, 
+	{-1025086024,   319562433}, {-1024963398,   319955525}, {-1024840621,   320348570}, {-1024717694,   320741568}, 
+	{-1025575020,   317989595}, {-1025452997,   318382875}, {-1025330824,   318776108}, {-1025208499,   319169293}, 
+	{-1026061603,   316416009}, {-1025940184,   316809475}, {-1025818614,   317202895}, {-1025696892,   317596268}, 
+	{-1026545772,   314841679}, {-1026424956,   315235331}, {-1026303990,   315628937}, {-1026182872,   316022496}, 
+	{-1027027525,   313266607}, {-1026907313,   313660444}, {-1026786951,   314054235}, {-1026666437,   314447980}, 
+	{-1027506862,   311690799}, {-1027387254,   312084820}, {-1027267495,   312478795}, {-1027147586,   312872724}, 
+	{-1027983780,   310114257}, {-1027864777,   310508461}, {-1027745623,   310902619}, {-1027626318,   311296732}, 
+	{-1028458280,   308536985}, {-1028339882,   308931371}, {-1028221332,   309325712}, {-1028102632,   309720007}, 
+	{-1028930359,   306958988}, {-1028812566,   307353555}, {-1028694622,   307748077}, {-1028576527,   308142554}, 
+	{-1029400018,   305380268}, {-1029282830,   305775015}, {-1029165491,   306169718}, {-1029048001,   306564375}, 
+	{-1029867254,   303800829}, {-1029750672,   304195756}, {-1029633939,   304590638}, {-1029517054,   304985475}, 
+	{-1030332067,   302220676}, {-1030216091,   302615781}, {-1030099963,   303010842}, {-1029983684,   303405858}, 
+	{-1030794455,   300639811}, {-1030679085,   301035094}, {-1030563564,   301430332}, {-1030447891,   301825526}, 
+	{-1031254418,   299058239}, {-1031139655,   299453698}, {-1031024740,   299849113}, {-1030909673,   300244484}, 
+	{-1031711954,   297475964}, {-1031597797,   297871598}, {-1031483489,   298267189}, {-1031369029,   298662736}, 
+	{-1032167062,   295892988}, {-1032053513,   296288797}, {-1031939812,   296684563}, {-1031825959,   297080285}, 
+	{-1032619742,   294309316}, {-1032506800,   294705299}, {-1032393706,   295101239}, {-1032280460,   295497135}, 
+	{-1033069992,   292724951}, {-1032957657,   293121107}, {-1032845170,   293517220}, {-1032732532,   293913290}, 
+	{-1033517810,   291139898}, {-1033406084,   291536226}, {-1033294205,   291932511}, {-1033182174,   292328753}, 
+	{-1033963197,   289554160}, {-1033852079,   289950658}, {-1033740808,   290347114}, {-1033629385,   290743528}, 
+	{-1034406151,   287967740}, {-1034295641,   288364409}, {-1034184978,   288761035}, {-1034074164,   289157619}, 
+	{-1034846671,   286380643}, {-1034736769,   286777480}, {-1034626715,   287174276}, {-1034516509,   287571029}, 
+	{-1035284755,   284792871}, {-1035175463,   285189877}, {-1035066018,   285586841}, {-1034956420,   285983763}, 
+	{-1035720404,   283204430}, {-1035611720,   283601603}, {-1035502884,   283998734}, {-1035393896,   284395824}, 
+	{-1036153615,   281615322}, {-1036045541,   282012662}, {-1035937314,   282409959}, {-1035828935,   282807215}, 
+	{-1036584389,   280025552}, {-1036476924,   280423056}, {-1036369307,   280820520}, {-1036261537,   281217942}, 
+	{-1037012723,   278435122}, {-1036905868,   278832791}, {-1036798861,   279230419}, {-1036691701,   279628006}, 
+	{-1037438617,   276844038}, {-1037332372,   277241870}, {-1037225975,   277639662}, {-1037119425,   278037413}, 
+	{-1037862069,   275252302}, {-1037756435,   275650297}, {-1037650648,   276048251}, {-1037544709,   276446165}, 
+	{-1038283080,   273659918}, {-1038178056,   274058075}, {-1038072880,   274456191}, {-1037967551,   274854267}, 
+	{-1038701647,   272066891}, {-1038597234,   272465208}, {-1038492669,   272863485}, {-1038387951,   273261722}, 
+	{-1039117770,   270473223}, {-1039013969,   270871700}, {-1038910014,   271270136}, {-1038805907,   271668533}, 
+	{-1039531448,   268878918}, {-1039428258,   269277554}, {-1039324915,   269676150}, {-1039221419,   270074706}, 
+	{-1039942680,   267283981}, {-1039840101,   267682775}, {-1039737370,   268081529}, {-1039634486,   268480243}, 
+	{-1040351465,   265688415}, {-1040249498,   266087366}, {-1040147378,   266486277}, {-1040045106,   266885149}, 
+	{-1040757802,   264092224}, {-1040656447,   264491331}, {-1040554939,   264890398}, {-1040453279,   265289426}, 
+	{-1041161689,   262495412}, {-1041060947,   262894673}, {-1040960052,   263293896}, {-1040859003,   263693079}, 
+	{-1041563127,   260897982}, {-1041462997,   261297397}, {-1041362715,   261696774}, {-1041262279,   262096112}, 
+	{-1041962114,   259299937}, {-1041862597,   259699506}, {-1041762927,   260099036}, {-1041663104,   260498528}, 
+	{-1042358649,   257701283}, {-1042259745,   258101004}, {-1042160688,   258500686}, {-1042061478,   258900331}, 
+	{-1042752731,   256102022}, {-1042654441,   256501894}, {-1042555997,   256901728}, {-1042457400,   257301525}, 
+	{-1043144360,   254502159}, {-1043046683,   254902181}, {-1042948852,   255302166}, {-1042850869,   255702113}, 
+	{-1043533534,   252901697}, {-1043436471,   253301868}, {-1043339254,   253702003}, {-1043241884,   254102099}, 
+	{-1043920252,   251300640}, {-1043823803,   251700959}, {-1043727200,   252101242}, {-1043630444,   252501488}, 
+	{-1044304514,   249698991}, {-1044208679,   250099458}, {-1044112690,   250499889}, {-1044016548,   250900283}, 
+	{-1044686319,   248096755}, {-1044591098,   248497369}, {-1044495724,   248897946}, {-1044400196,   249298487}, 
+	{-1045065665,   246493935}, {-1044971059,   246894694}, {-1044876299,   247295417}, {-1044781386,   247696104}, 
+	{-1045442553,   244890535}, {-1045348561,   245291439}, {-1045254416,   245692307}, {-1045160118,   246093139}, 
+	{-1045816980,   243286558}, {-1045723604,   243687606}, {-1045630074,   244088618}, {-1045536390,   244489594}, 
+	{-1046188946,   241682010}, {-1046096185,   242083200}, {-1046003271,   242484355}, {-1045910202,   242885475}, 
+	{-1046558451,   240076892}, {-1046466305,   240478225}, {-1046374006,   240879522}, {-1046281553,   241280783}, 
+	{-1046925492,   238471210}, {-1046833963,   238872683}, {-1046742279,   239274121}, {-1046650442,   239675524}, 
+	{-1047290071,   236864966}, {-1047199157,   237266579}, {-1047108090,   237668158}, {-1047016868,   238069701}, 
+	{-1047652185,   235258165}, {-1047561887,   235659918}, {-1047471436,   236061635}, {-1047380830,   236463318}, 
+	{-1048011834,   233650811}, {-1047922153,   234052701}, {-1047832317,   234454557}, {-1047742328,   234856378}, 
+	{-1048369016,   232042906}, {-1048279952,   232444934}, {-1048190733,   232846927}, {-1048101360,   233248886}, 
+	{-1048723732,   230434456}, {-1048635284,   230836620}, {-1048546683,   231238749}, {-1048457926,   231640845}, 
+	{-1049075980,   228825464}, {-1048988149,   229227762}, {-1048900165,   229630027}, {-1048812025,   230032259}, 
+	{-1049425759,   227215933}, {-1049338546,   227618366}, {-1049251178,   228020765}, {-1049163656,   228423131}, 
+	{-1049773069,   225605867}, {-1049686474,   226008433}, {-1049599723,   226410966}, {-1049512818,   226813466}, 
+	{-1050117909,   223995270}, {-1050031931,   224397969}, {-1049945798,   224800635}, {-1049859511,   225203267}, 
+	{-1050460278,   222384147}, {-1050374918,   222786977}, {-1050289403,   223189774}, {-1050203733,   223592539}, 
+	{-1050800175,   220772500}, {-1050715433,   221175461}, {-1050630536,   221578389}, {-1050545484,   221981284}, 
+	{-1051137599,   219160334}, {-1051053475,   219563424}, {-1050969196,   219966481}, {-1050884763,   220369507}, 
+	{-1051472550,   217547651}, {-1051389044,   217950870}, {-1051305384,   218354057}, {-1051221569,   218757211}, 
+	{-1051805027,   215934457}, {-1051722140,   216337804}, {-1051639098,   216741118}, {-1051555901,   217144401}, 
+	{-1052135029,   214320755}, {-1052052760,   214724228}, {-1051970337,   215127670}, {-1051887759,   215531079}, 
+	{-1052462555,   212706549}, {-1052380905,   213110148}, {-1052299101,   213513715}, {-1052217142,   213917251}, 
+	{-1052787604,   211091842}, {-1052706574,   211495565}, {-1052625389,   211899258}, {-1052544049,   212302919}, 
+	{-1053110176,   209476638}, {-1053029765,   209880485}, {-1052949200,   210284302}, {-1052868479,   210688087}, 
+	{-1053430270,   207860942}, {-1053350479,   208264912}, {-1053270533,   208668851}, {-1053190432,   209072760}, 
+	{-1053747885,   206244756}, {-1053668714,   206648848}, {-1053589387,   207052910}, {-1053509906,   207456941}, 
+	{-1054063021,   204628085}, {-1053984469,   205032298}, {-1053905763,   205436481}, {-1053826901,   205840633}, 
+	{-1054375676,   203010932}, {-1054297745,   203415265}, {-1054219658,   203819569}, {-1054141417,   204223842}, 
+	{-1054685850,   201393302}, {-1054608539,   201797754}, {-1054531073,   202202177}, {-1054453452,   202606569}, 
+	{-1054993543,   199775198}, {-1054916852,   200179768}, {-1054840007,   200584309}, {-1054763006,   200988820}, 
+	{-1055298753,   198156624}, {-1055222683,   198561311}, {-1055146458,   198965969}, {-1055070078,   199370598}, 
+	{-1055601479,   196537583}, {-1055526030,   196942387}, {-1055450426,   197347161}, {-1055374667,   197751907}, 
+	{-1055901722,   194918080}, {-1055826894,   195322999}, {-1055751911,   195727889}, {-1055676773,   196132751}, 
+	{-1056199480,   193298119}, {-1056125274,   193703152}, {-1056050912,   194108156}, {-1055976395,   194513133}, 
+	{-1056494753,   191677702}, {-1056421168,   192082849}, {-1056347427,   192487967}, {-1056273531,   192893057}, 
+	{-1056787540,   190056834}, {-1056714576,   190462093}, {-1056641457,   190867324}, {-1056568183,   191272527}, 
+	{-1057077840,   188435520}, {-1057005498,   188840890}, {-1056933001,   189246233}, {-1056860348,   189651548}, 
+	{-1057365653,   186813762}, {-1057293933,   187219242}, {-1057222057,   187624696}, {-1057150026,   188030122}, 
+	{-1057650977,   185191564}, {-1057579879,   185597154}, {-1057508626,   186002717}, {-1057437217,   186408253}, 
+	{-1057933813,   183568930}, {-1057863337,   183974629}, {-1057792706,   184380301}, {-1057721919,   184785946}, 
+	{-1058214159,   181945865}, {-1058144306,   182351671}, {-1058074297,   182757451}, {-1058004133,   183163204}, 
+	{-1058492016,   180322371}, {-1058422785,   180728284}, {-1058353399,   181134171}, {-1058283857,   181540031}, 
+	{-1058767381,   178698453}, {-1058698773,   179104472}, {-1058630010,   179510465}, {-1058561091,   179916431}, 
+	{-1059040255,   177074115}, {-1058972270,   177480239}, {-1058904130,   177886336}, {-1058835833,   178292408}, 
+	{-1059310638,   175449360}, {-1059243276,   175855587}, {-1059175758,   176261789}, {-1059108085,   176667965}, 
+	{-1059578527,   173824192}, {-1059511788,   174230522}, {-1059444894,   174636827}, {-1059377844,   175043106}, 
+	{-1059843923,   172198615}, {-1059777808,   172605047}, {-1059711537,   173011454}, {-1059645110,   173417836}, 
+	{-1060106826,   170572633}, {-1060041334,   170979166}, {-1059975686,   171385674}, {-1059909883,   171792157}, 
+	{-1060367233,   168946249}, {-1060302365,   169352882}, {-1060237341,   169759491}, {-1060172161,   170166074}, 
+	{-1060625146,   167319468}, {-1060560902,   167726200}, {-1060496502,   168132908}, {-1060431945,   168539591}, 
+	{-1060880563,   165692293}, {-1060816943,   166099124}, {-1060753166,   166505929}, {-1060689234,   166912711}, 
+	{-1061133483,   164064728}, {-1061070487,   164471656}, {-1061007335,   164878559}, {-1060944027,   165285438}, 
+	{-1061383907,   162436778}, {-1061321535,   162843801}, {-1061259007,   163250801}, {-1061196323,   163657777}, 
+	{-1061631833,   160808445}, {-1061570086,   161215564}, {-1061508182,   161622659}, {-1061446123,   162029730}, 
+	{-1061877261,   159179733}, {-1061816138,   159586946}, {-1061754859,   159994136}, {-1061693424,   160401302}, 
+	{-1062120190,   157550647}, {-1062059692,   157957954}, {-1061999038,   158365237}, {-1061938227,   158772497}, 
+	{-1062360620,   155921191}, {-1062300747,   156328589}, {-1062240717,   156735965}, {-1062180532,   157143318}, 
+	{-1062598550,   154291367}, {-1062539302,   154698857}, {-1062479898,   155106324}, {-1062420337,   155513769}, 
+	{-1062833980,   152661180}, {-1062775357,   153068761}, {-1062716578,   153476319}, {-1062657642,   153883854}, 
+	{-1063066909,   151030634}, {-1063008911,   151438304}, {-1062950757,   151845952}, {-1062892446,   152253577}, 
+	{-1063297336,   149399733}, {-1063239964,   149807492}, {-1063182435,   150215228}, {-1063124750,   150622942}, 
+	{-1063525261,   147768480}, {-1063468514,   148176326}, {-1063411611,   148584150}, {-1063354552,   148991953}, 
+	{-1063750684,   146136880}, {-1063694563,   146544812}, {-1063638285,   146952723}, {-1063581851,   147360613}, 
+	{-1063973603,   144504935}, {-1063918108,   144912954}, {-1063862456,   145320950}, {-1063806648,   145728926}, 
+	{-1064194019,   142872651}, {-1064139150,   143280754}, {-1064084124,   143688835}, {-1064028942,   144096896}, 
+	{-1064411931,   141240030}, {-1064357688,   141648217}, {-1064303288,   142056382}, {-1064248732,   142464527}, 
+	{-1064627338,   139607077}, {-1064573721,   140015347}, {-1064519947,   140423595}, {-1064466017,   140831823}, 
+	{-1064840240,   137973796}, {-1064787249,   138382147}, {-1064734102,   138790477}, {-1064680798,   139198788}, 
+	{-1065050636,   136340190}, {-1064998272,   136748621}, {-1064945751,   137157033}, {-1064893074,   137565425}, 
+	{-1065258526,   134706263}, {-1065206789,   135114774}, {-1065154894,   135523266}, {-1065102844,   135931738}, 
+	{-1065463909,   133072019}, {-1065412799,   133480609}, {-1065361531,   133889180}, {-1065310107,   134297731}, 
+	{-1065666786,   131437462}, {-1065616302,   131846130}, {-1065565661,   132254779}, {-1065514864,   132663409}, 
+	{-1065867154,   129802595}, {-1065817297,   130211341}, {-1065767284,   130620067}, {-1065717113,   131028774}, 
+	{-1066065015,   128167423}, {-1066015785,   128576245}, {-1065966398,   128985047}, {-1065916855,   129393831}, 
+	{-1066260367,   126531950}, {-1066211764,   126940846}, {-1066163005,   127349724}, {-1066114088,   127758583}, 
+	{-1066453210,   124896179}, {-1066405234,   125305149}, {-1066357102,   125714101}, {-1066308813,   126123035}, 
+	{-1066643544,   123260114}, {-1066596195,   123669157}, {-1066548690,   124078183}, {-1066501029,   124487190}, 
+	{-1066831367,   121623759}, {-1066784647,   122032875}, {-1066737769,   122441972}, {-1066690735,   122851052}, 
+	{-1067016680,   119987118}, {-1066970587,   120396304}, {-1066924338,   120805474}, {-1066877931,   121214625}, 
+	{-1067199483,   118350194}, {-1067154018,   118759451}, {-1067108396,   119168691}, {-1067062616,   119577913}, 
+	{-1067379774,   116712992}, {-1067334937,   117122318}, {-1067289942,   117531627}, {-1067244791,   117940919}, 
+	{-1067557554,   115075515}, {-1067513344,   115484910}, {-1067468978,   115894288}, {-1067424454,   116303648}, 
+	{-1067732821,   113437768}, {-1067689240,   113847230}, {-1067645501,   114256675}, {-1067601606,   114666103}, 
+	{-1067905576,   111799753}, {-1067862623,   112209281}, {-1067819513,   112618793}, {-1067776246,   113028289}, 
+	{-1068075818,   110161476}, {-1068033493,   110571069}, {-1067991011,   110980647}, {-1067948372,   111390208}, 
+	{-1068243547,   108522939}, {-1068201851,   108932597}, {-1068159997,   109342239}, {-1068117986,   109751866}, 
+	{-1068408763,   106884147}, {-1068367694,   107293868}, {-1068326469,   107703574}, {-1068285087,   108113265}, 
+	{-1068571464,   105245103}, {-1068531024,   105654887}, {-1068490427,   106064656}, {-1068449673,   106474409}, 
+	{-1068731650,   103605812}, {-1068691839,   104015658}, {-1068651871,   104425488}, {-1068611746,   104835303}, 
+	{-1068889322,   101966277}, {-1068850140,   102376183}, {-1068810801,   102786074}, {-1068771304,   103195951}, 
+	{-1069044479,   100326502}, {-1069005925,   100736468}, {-1068967215,   101146419}, {-1068928347,   101556355}, 
+	{-1069197120,    98686491}, {-1069159195,    99096515}, {-1069121114,    99506525}, {-1069082875,    99916521}, 
+	{-1069347245,    97046247}, {-1069309950,    97456330}, {-1069272497,    97866398}, {-1069234887,    98276451}, 
+	{-1069494854,    95405776}, {-1069458188,    95815915}, {-1069421364,    96226040}, {-1069384383,    96636151}, 
+	{-1069639946,    93765079}, {-1069603909,    94175274}, {-1069567715,    94585455}, {-1069531363,    94995622}, 
+	{-1069782521,    92124163}, {-1069747114,    92534412}, {-1069711548,    92944648}, {-1069675826,    93354871}, 
+	{-1069922579,    90483029}, {-1069887801,    90893333}, {-1069852865,    91303623}, {-1069817772,    91713899}, 
+	{-1070060120,    88841683}, {-1070025971,    89252039}, {-1069991664,    89662382}, {-1069957201,    90072712}, 
+	{-1070195142,    87200127}, {-1070161623,    87610535}, {-1070127946,    88020931}, {-1070094111,    88431313}, 
+	{-1070327646,    85558366}, {-1070294756,    85968825}, {-1070261709,    86379272}, {-1070228504,    86789706}, 
+	{-1070457632,    83916404}, {-1070425372,    84326913}, {-1070392954,    84737410}, {-1070360379,    85147894}, 
+	{-1070585099,    82274245}, {-1070553468,    82684803}, {-1070521680,    83095349}, {-1070489735,    83505883}, 
+	{-1070710046,    80631892}, {-1070679045,    81042498}, {-1070647887,    81453092}, {-1070616572,    81863674}, 
+	{-1070832474,    78989349}, {-1070802103,    79400002}, {-1070771575,    79810644}, {-1070740889,    80221273}, 
+	{-1070952382,    77346620}, {-1070922641,    77757319}, {-1070892743,    78168007}, {-1070862687,    78578684}, 
+	{-1071069770,    75703709}, {-1071040660,    76114454}, {-1071011391,    76525187}, {-1070981966,    76935909}, 
+	{-1071184638,    74060620}, {-1071156158,    74471409}, {-1071127519,    74882187}, {-1071098724,    75292954}, 
+	{-1071296985,    72417357}, {-1071269135,    72828189}, {-1071241127,    73239010}, {-1071212961,    73649821}, 
+	{-1071406812,    70773924}, {-1071379592,    71184798}, {-1071352214,    71595661}, {-1071324678,    72006515}, 
+	{-1071514117,    69130324}, {-1071487527,    69541239}, {-1071460780,    69952144}, {-1071433874,    70363039}, 
+	{-1071618901,    67486561}, {-1071592941,    67897517}, {-1071566824,    68308462}, {-1071540549,    68719398}, 
+	{-1071721163,    65842639}, {-1071695834,    66253634}, {-1071670347,    66664620}, {-1071644703,    67075595}, 
+	{-1071820903,    64198563}, {-1071796205,    64609596}, {-1071771349,    65020620}, {-1071746335,    65431634}, 
+	{-1071918122,    62554335}, {-1071894054,    62965406}, {-1071869828,    63376468}, {-1071845445,    63787520}, 
+	{-1072012818,    60909960}, {-1071989380,    61321068}, {-1071965785,    61732166}, {-1071942032,    62143255}, 
+	{-1072104991,    59265442}, {-1072082184,    59676585}, {-1072059220,    60087719}, {-1072036098,    60498844}, 
+	{-1072194642,    57620785}, {-1072172466,    58031962}, {-1072150132,    58443131}, {-1072127640,    58854291}, 
+	{-1072281769,    55975992}, {-1072260224,    56387202}, {-1072238521,    56798405}, {-1072216660,    57209599}, 
+	{-1072366374,    54331067}, {-1072345459,    54742310}, {-1072324387,    55153545}, {-1072303157,    55564773}, 
+	{-1072448455,    52686014}, {-1072428171,    53097289}, {-1072407730,    53508556}, {-1072387131,    53919815}, 
+	{-1072528012,    51040837}, {-1072508360,    51452143}, {-1072488549,    51863441}, {-1072468581,    52274731}, 
+	{-1072605046,    49395541}, {-1072586024,    49806876}, {-1072566845,    50218204}, {-1072547508,    50629524}, 
+	{-1072679556,    47750128}, {-1072661165,    48161492}, {-1072642617,    48572848}, {-1072623910,    48984198}, 
+	{-1072751542,    46104602}, {-1072733782,    46515994}, {-1072715864,    46927379}, {-1072697789,    47338757}, 
+	{-1072821003,    44458968}, {-1072803874,    44870387}, {-1072786588,    45281799}, {-1072769144,    45693204}, 
+	{-1072887940,    42813230}, {-1072871443,    43224674}, {-1072854787,    43636112}, {-1072837974,    44047544}, 
+	{-1072952352,    41167391}, {-1072936486,    41578860}, {-1072920462,    41990323}, {-1072904280,    42401779}, 
+	{-1073014240,    39521455}, {-1072999005,    39932948}, {-1072983612,    40344435}, {-1072968061,    40755916}, 
+	{-1073073603,    37875426}, {-1073058999,    38286941}, {-1073044237,    38698452}, {-1073029317,    39109956}, 
+	{-1073130440,    36229307}, {-1073116468,    36640845}, {-1073102337,    37052377}, {-1073088049,    37463904}, 
+	{-1073184753,    34583104}, {-1073171411,    34994663}, {-1073157912,    35406216}, {-1073144255,    35817764}, 
+	{-1073236540,    32936819}, {-1073223830,    33348398}, {-1073210962,    33759971}, {-1073197936,    34171540}, 
+	{-1073285802,    31290457}, {-1073273723,    31702054}, {-1073261486,    32113647}, {-1073249092,    32525236}, 
+	{-1073332538,    29644021}, {-1073321091,    30055636}, {-1073309485,    30467248}, {-1073297722,    30878855}, 
+	{-1073376748,    27997515}, {-1073365932,    28409148}, {-1073354959,    28820776}, {-1073343827,    29232401}, 
+	{-1073418433,    26350943}, {-1073408249,    26762592}, {-1073397906,    27174237}, {-1073387406,    27585878}, 
+	{-1073457592,    24704310}, {-1073448039,    25115974}, {-1073438328,    25527634}, {-1073428460,    25939291}, 
+	{-1073494225,    23057618}, {-1073485303,    23469296}, {-1073476224,    23880971}, {-1073466987,    24292642}, 
+	{-1073528332,    21410872}, {-1073520042,    21822563}, {-1073511594,    22234252}, {-1073502988,    22645937}, 
+	{-1073559913,    19764076}, {-1073552254,    20175779}, {-1073544438,    20587480}, {-1073536464,    20999178}, 
+	{-1073588967,    18117233}, {-1073581940,    18528948}, {-1073574756,    18940660}, {-1073567413,    19352369}, 
+	{-1073615496,    16470347}, {-1073609100,    16882072}, {-1073602547,    17293795}, {-1073595836,    17705515}, 
+	{-1073639498,    14823423}, {-1073633734,    15235158}, {-1073627812,    15646890}, {-1073621733,    16058620}, 
+	{-1073660973,    13176464}, {-1073655841,    13588207}, {-1073650551,    13999948}, {-1073645103,    14411686}, 
+	{-1073679922,    11529474}, {-1073675422,    11941224}, {-1073670764,    12352972}, {-1073665947,    12764719}, 
+	{-1073696345,     9882456}, {-1073692476,    10294213}, {-1073688450,    10705968}, {-1073684265,    11117722}, 
+	{-1073710241,     8235416}, {-1073707004,     8647178}, {-1073703609,     9058939}, {-1073700056,     9470698}, 
+	{-1073721611,     6588356}, {-1073719006,     7000123}, {-1073716242,     7411888}, {-1073713321,     7823653}, 
+	{-1073730454,     4941281}, {-1073728480,     5353051}, {-1073726348,     5764820}, {-1073724059,     6176588}, 
+	{-1073736771,     3294193}, {-1073735429,     3705966}, {-1073733928,     4117738}, {-1073732270,     4529510}, 
+	{-1073740561,     1647099}, {-1073739850,     2058873}, {-1073738982,     2470647}, {-1073737955,     2882420}, 
+	{-1073741824,           0}, {-1073741745,      411775}, {-1073741508,      823550}, {-1073741113,     1235324}, 
+#endif
+#if (MAX_DIF_FFT_LUT_LOG2 >= 13)
+	{ 1073736771,     3294193}, { 1073738982,     2470647}, { 1073740561,     1647099}, { 1073741508,      823550}, 
+	{ 1073721611,     6588356}, { 1073726348,     5764820}, { 1073730454,     4941281}, { 1073733928,     4117738}, 
+	{ 1073696345,     9882456}, { 1073703609,     9058939}, { 1073710241,     8235416}, { 1073716242,     7411888}, 
+	{ 1073660973,    13176464}, { 1073670764,    12352972}, { 1073679922,    11529474}, { 1073688450,    10705968}, 
+	{ 1073615496,    16470347}, { 1073627812,    15646890}, { 1073639498,    14823423}, { 1073650551,    13999948}, 
+	{ 1073559913,    19764076}, { 1073574756,    18940660}, { 1073588967,    18117233}, { 1073602547,    17293795}, 
+	{ 1073494225,    23057618}, { 1073511594,    22234252}, { 1073528332,    21410872}, { 1073544438,    20587480}, 
+	{ 1073418433,    26350943}, { 1073438328,    25527634}, { 1073457592,    24704310}, { 1073476224,    23880971}, 
+	{ 1073332538,    29644021}, { 1073354959,    28820776}, { 1073376748,    27997515}, { 1073397906,    27174237}, 
+	{ 1073236540,    32936819}, { 1073261486,    32113647}, { 1073285802,    31290457}, { 1073309485,    30467248}, 
+	{ 1073130440,    36229307}, { 1073157912,    35406216}, { 1073184753,    34583104}, { 1073210962,    33759971}, 
+	{ 1073014240,    39521455}, { 1073044237,    38698452}, { 1073073603,    37875426}, { 1073102337,    37052377}, 
+	{ 1072887940,    42813230}, { 1072920462,    41990323}, { 1072952352,    41167391}, { 1072983612,    40344435}, 
+	{ 1072751542,    46104602}, { 1072786588,    45281799}, { 1072821003,    44458968}, { 1072854787,    43636112}, 
+	{ 1072605046,    49395541}, { 1072642617,    48572848}, { 1072679556,    47750128}, { 1072715864,    46927379}, 
+	{ 1072448455,    52686014}, { 1072488549,    51863441}, { 1072528012,    51040837}, { 1072566845,    50218204}, 
+	{ 1072281769,    55975992}, { 1072324387,    55153545}, { 1072366374,    54331067}, { 1072407730,    53508556}, 
+	{ 1072104991,    59265442}, { 1072150132,    58443131}, { 1072194642,    57620785}, { 1072238521,    56798405}, 
+	{ 1071918122,    62554335}, { 1071965785,    61732166}, { 1072012818,    60909960}, { 1072059220,    60087719}, 
+	{ 1071721163,    65842639}, { 1071771349,    65020620}, { 1071820903,    64198563}, { 1071869828,    63376468}, 
+	{ 1071514117,    69130324}, { 1071566824,    68308462}, { 1071618901,    67486561}, { 1071670347,    66664620}, 
+	{ 1071296985,    72417357}, { 1071352214,    71595661}, { 1071406812,    70773924}, { 1071460780,    69952144}, 
+	{ 1071069770,    75703709}, { 1071127519,    74882187}, { 1071184638,    74060620}, { 1071241127,    73239010}, 
+	{ 1070832474,    78989349}, { 1070892743,    78168007}, { 1070952382,    77346620}, { 1071011391,    76525187}, 
+	{ 1070585099,    82274245}, { 1070647887,    81453092}, { 1070710046,    80631892}, { 1070771575,    79810644}, 
+	{ 1070327646,    85558366}, { 1070392954,    84737410}, { 1070457632,    83916404}, { 1070521680,    83095349}, 
+	{ 1070060120,    88841683}, { 1070127946,    88020931}, { 1070195142,    87200127}, { 1070261709,    86379272}, 
+	{ 1069782521,    92124163}, { 1069852865,    91303623}, { 1069922579,    90483029}, { 1069991664,    89662382}, 
+	{ 1069494854,    95405776}, { 1069567715,    94585455}, { 1069639946,    93765079}, { 1069711548,    92944648}, 
+	{ 1069197120,    98686491}, { 1069272497,    97866398}, { 1069347245,    97046247}, { 1069421364,    96226040}, 
+	{ 1068889322,   101966277}, { 1068967215,   101146419}, { 1069044479,   100326502}, { 1069121114,    99506525}, 
+	{ 1068571464,   105245103}, { 1068651871,   104425488}, { 1068731650,   103605812}, { 1068810801,   102786074}, 
+	{ 1068243547,   108522939}, { 1068326469,   107703574}, { 1068408763,   106884147}, { 1068490427,   106064656}, 
+	{ 1067905576,   111799753}, { 1067991011,   110980647}, { 1068075818,   110161476}, { 1068159997,   109342239}, 
+	{ 1067557554,   115075515}, { 1067645501,   114256675}, { 1067732821,   113437768}, { 1067819513,   112618793}, 
+	{ 1067199483,   118350194}, { 1067289942,   117531627}, { 1067379774,   116712992}, { 1067468978,   115894288}, 
+	{ 1066831367,   121623759}, { 1066924338,   120805474}, { 1067016680,   119987118}, { 1067108396,   119168691}, 
+	{ 1066453210,   124896179}, { 1066548690,   124078183}, { 1066643544,   123260114}, { 1066737769,   122441972}, 
+	{ 1066065015,   128167423}, { 1066163005,   127349724}, { 1066260367,   126531950}, { 1066357102,   125714101}, 
+	{ 1065666786,   131437462}, { 1065767284,   130620067}, { 1065867154,   129802595}, { 1065966398,   128985047}, 
+	{ 1065258526,   134706263}, { 1065361531,   133889180}, { 1065463909,   133072019}, { 1065565661,   132254779}, 
+	{ 1064840240,   137973796}, { 1064945751,   137157033}, { 1065050636,   136340190}, { 1065154894,   135523266}, 
+	{ 1064411931,   141240030}, { 1064519947,   140423595}, { 1064627338,   139607077}, { 1064734102,   138790477}, 
+	{ 1063973603,   144504935}, { 1064084124,   143688835}, { 1064194019,   142872651}, { 1064303288,   142056382}, 
+	{ 1063525261,   147768480}, { 1063638285,   146952723}, { 1063750684,   146136880}, { 1063862456,   145320950}, 
+	{ 1063066909,   151030634}, { 1063182435,   150215228}, { 1063297336,   149399733}, { 1063411611,   148584150}, 
+	{ 1062598550,   154291367}, { 1062716578,   153476319}, { 1062833980,   152661180}, { 1062950757,   151845952}, 
+	{ 1062120190,   157550647}, { 1062240717,   156735965}, { 1062360620,   155921191}, { 1062479898,   155106324}, 
+	{ 1061631833,   160808445}, { 1061754859,   159994136}, { 1061877261,   159179733}, { 1061999038,   158365237}, 
+	{ 1061133483,   164064728}, { 1061259007,   163250801}, { 1061383907,   162436778}, { 1061508182,   161622659}, 
+	{ 1060625146,   167319468}, { 1060753166,   166505929}, { 1060880563,   165692293}, { 1061007335,   164878559}, 
+	{ 1060106826,   170572633}, { 1060237341,   169759491}, { 1060367233,   168946249}, { 1060496502,   168132908}, 
+	{ 1059578527,   173824192}, { 1059711537,   173011454}, { 1059843923,   172198615}, { 1059975686,   171385674}, 
+	{ 1059040255,   177074115}, { 1059175758,   176261789}, { 1059310638,   175449360}, { 1059444894,   174636827}, 
+	{ 1058492016,   180322371}, { 1058630010,   179510465}, { 1058767381,   178698453}, { 1058904130,   177886336}, 
+	{ 1057933813,   183568930}, { 1058074297,   182757451}, { 1058214159,   181945865}, { 1058353399,   181134171}, 
+	{ 1057365653,   186813762}, { 1057508626,   186002717}, { 1057650977,   185191564}, { 1057792706,   184380301}, 
+	{ 1056787540,   190056834}, { 1056933001,   189246233}, { 1057077840,   188435520}, { 1057222057,   187624696}, 
+	{ 1056199480,   193298119}, { 1056347427,   192487967}, { 1056494753,   191677702}, { 1056641457,   190867324}, 
+	{ 1055601479,   196537583}, { 1055751911,   195727889}, { 1055901722,   194918080}, { 1056050912,   194108156}, 
+	{ 1054993543,   199775198}, { 1055146458,   198965969}, { 1055298753,   198156624}, { 1055450426,   197347161}, 
+	{ 1054375676,   203010932}, { 1054531073,   202202177}, { 1054685850,   201393302}, { 1054840007,   200584309}, 
+	{ 1053747885,   206244756}, { 1053905763,   205436481}, { 1054063021,   204628085}, { 1054219658,   203819569}, 
+	{ 1053110176,   209476638}, { 1053270533,   208668851}, { 1053430270,   207860942}, { 1053589387,   207052910}, 
+	{ 1052462555,   212706549}, { 1052625389,   211899258}, { 1052787604,   211091842}, { 1052949200,   210284302}, 
+	{ 1051805027,   215934457}, { 1051970337,   215127670}, { 1052135029,   214320755}, { 1052299101,   213513715}, 
+	{ 1051137599,   219160334}, { 1051305384,   218354057}, { 1051472550,   217547651}, { 1051639098,   216741118}, 
+	{ 1050460278,   222384147}, { 1050630536,   221578389}, { 1050800175,   220772500}, { 1050969196,   219966481}, 
+	{ 1049773069,   225605867}, { 1049945798,   224800635}, { 1050117909,   223995270}, { 1050289403,   223189774}, 
+	{ 1049075980,   228825464}, { 1049251178,   228020765}, { 1049425759,   227215933}, { 1049599723,   226410966}, 
+	{ 1048369016,   232042906}, { 1048546683,   231238749}, { 1048723732,   230434456}, { 1048900165,   229630027}, 
+	{ 1047652185,   235258165}, { 1047832317,   234454557}, { 1048011834,   233650811}, { 1048190733,   232846927}, 
+	{ 1046925492,   238471210}, { 1047108090,   237668158}, { 1047290071,   236864966}, { 1047471436,   236061635}, 
+	{ 1046188946,   241682010}, { 1046374006,   240879522}, { 1046558451,   240076892}, { 1046742279,   239274121}, 
+	{ 1045442553,   244890535}, { 1045630074,   244088618}, { 1045816980,   243286558}, { 1046003271,   242484355}, 
+	{ 1044686319,   248096755}, { 1044876299,   247295417}, { 1045065665,   246493935}, { 1045254416,   245692307}, 
+	{ 1043920252,   251300640}, { 1044112690,   250499889}, { 1044304514,   249698991}, { 1044495724,   248897946}, 
+	{ 1043144360,   254502159}, { 1043339254,   253702003}, { 1043533534,   252901697}, { 1043727200,   252101242}, 
+	{ 1042358649,   257701283}, { 1042555997,   256901728}, { 1042752731,   256102022}, { 1042948852,   255302166}, 
+	{ 1041563127,   260897982}, { 1041762927,   260099036}, { 1041962114,   259299937}, { 1042160688,   258500686}, 
+	{ 1040757802,   264092224}, { 1040960052,   263293896}, { 1041161689,   262495412}, { 1041362715,   261696774}, 
+	{ 1039942680,   267283981}, { 1040147378,   266486277}, { 1040351465,   265688415}, { 1040554939,   264890398}, 
+	{ 1039117770,   270473223}, { 1039324915,   269676150}, { 1039531448,   268878918}, { 1039737370,   268081529}, 
+	{ 1038283080,   273659918}, { 1038492669,   272863485}, { 1038701647,   272066891}, { 1038910014,   271270136}, 
+	{ 1037438617,   276844038}, { 1037650648,   276048251}, { 1037862069,   275252302}, { 1038072880,   274456191}, 
+	{ 1036584389,   280025552}, { 1036798861,   279230419}, { 1037012723,   278435122}, { 1037225975,   277639662}, 
+	{ 1035720404,   283204430}, { 1035937314,   282409959}, { 1036153615,   281615322}, { 1036369307,   280820520}, 
+	{ 1034846671,   286380643}, { 1035066018,   285586841}, { 1035284755,   284792871}, { 1035502884,   283998734}, 
+	{ 1033963197,   289554160}, { 1034184978,   288761035}, { 1034406151,   287967740}, { 1034626715,   287174276}, 
+	{ 1033069992,   292724951}, { 1033294205,   291932511}, { 1033517810,   291139898}, { 1033740808,   290347114}, 
+	{ 1032167062,   295892988}, { 1032393706,   295101239}, { 1032619742,   294309316}, { 1032845170,   293517220}, 
+	{ 1031254418,   299058239}, { 1031483489,   298267189}, { 1031711954,   297475964}, { 1031939812,   296684563}, 
+	{ 1030332067,   302220676}, { 1030563564,   301430332}, { 1030794455,   300639811}, { 1031024740,   299849113}, 
+	{ 1029400018,   305380268}, { 1029633939,   304590638}, { 1029867254,   303800829}, { 1030099963,   303010842}, 
+	{ 1028458280,   308536985}, { 1028694622,   307748077}, { 1028930359,   306958988}, { 1029165491,   306169718}, 
+	{ 1027506862,   311690799}, { 1027745623,   310902619}, { 1027983780,   310114257}, { 1028221332,   309325712}, 
+	{ 1026545772,   314841679}, { 1026786951,   314054235}, { 1027027525,   313266607}, { 1027267495,   312478795}, 
+	{ 1025575020,   317989595}, { 1025818614,   317202895}, { 1026061603,   316416009}, { 1026303990,   315628937}, 
+	{ 1024594615,   321134518}, { 1024840621,   320348570}, { 1025086024,   319562433}, { 1025330824,   318776108}, 
+	{ 1023604567,   324276419}, { 1023852982,   323491229}, { 1024100796,   322705848}, { 1024348007,   321920278}, 
+	{ 1022604883,   327415267}, { 1022855707,   326630843}, { 1023105929,   325846226}, { 1023355549,   325061418}, 
+	{ 1021595575,   330551034}, { 1021848804,   329767383}, { 1022101432,   328983538}, { 1022353458,   328199499}, 
+	{ 1020576651,   333683689}, { 1020832283,   332900819}, { 1021087314,   332117752}, { 1021341745,   331334491}, 
+	{ 1019548121,   336813204}, { 1019806153,   336031121}, { 1020063586,   335248841}, { 1020320418,   334466364}, 
+	{ 1018509994,   339939549}, { 1018770425,   339158261}, { 1019030256,   338376774}, { 1019289488,   337595089}, 
+	{ 1017462281,   343062693}, { 1017725107,   342282209}, { 1017987335,   341501523}, { 1018248964,   340720636}, 
+	{ 1016404991,   346182609}, { 1016670211,   345402934}, { 1016934832,   344623057}, { 1017198856,   343842976}, 
+	{ 1015338134,   349299266}, { 1015605745,   348520409}, { 1015872758,   347741347}, { 1016139173,   346962080}, 
+	{ 1014261721,   352412636}, { 1014531720,   351634604}, { 1014801122,   350856364}, { 1015069927,   350077918}, 
+	{ 1013175761,   355522689}, { 1013448145,   354745488}, { 1013719934,   353968079}, { 1013991126,   353190461}, 
+	{ 1012080264,   358629395}, { 1012355032,   357853034}, { 1012629204,   357076462}, { 1012902780,   356299680}, 
+	{ 1010975242,   361732726}, { 1011252390,   360957211}, { 1011528943,   360181484}, { 1011804901,   359405545}, 
+	{ 1009860704,   364832652}, { 1010140230,   364057991}, { 1010419162,   363283116}, { 1010697499,   362508027}, 
+	{ 1008736660,   367929144}, { 1009018562,   367155344}, { 1009299870,   366381329}, { 1009580584,   365607098}, 
+	{ 1007603122,   371022173}, { 1007887396,   370249242}, { 1008171077,   369476093}, { 1008454166,   368702727}, 
+	{ 1006460100,   374111709}, { 1006746744,   373339654}, { 1007032796,   372567379}, { 1007318256,   371794885}, 
+	{ 1005307605,   377197725}, { 1005596617,   376426553}, { 1005885036,   375655159}, { 1006172864,   374883544}, 
+	{ 1004145648,   380280190}, { 1004437024,   379509908}, { 1004727809,   378739403}, { 1005018003,   377968675}, 
+	{ 1002974239,   383359076}, { 1003267977,   382589691}, { 1003561124,   381820082}, { 1003853681,   381050248}, 
+	{ 1001793390,   386434353}, { 1002089486,   385665873}, { 1002384994,   384897167}, { 1002679911,   384128234}, 
+	{ 1000603111,   389505993}, { 1000901564,   388738426}, { 1001199428,   387970630}, { 1001496704,   387202605}, 
+	{  999403415,   392573967}, {  999704221,   391807319}, { 1000004439,   391040440}, { 1000304069,   390273331}, 
+	{  998194311,   395638246}, {  998497468,   394872524}, {  998800038,   394106570}, {  999102020,   393340384}, 
+	{  996975812,   398698801}, {  997281317,   397934013}, {  997586236,   397168991}, {  997890567,   396403735}, 
+	{  995747930,   401755603}, {  996055780,   400991756}, {  996363043,   400227673}, {  996669721,   399463355}, 
+	{  994510675,   404808624}, {  994820867,   404045725}, {  995130473,   403282588}, {  995439494,   402519214}, 
+	{  993264059,   407857835}, {  993576590,   407095891}, {  993888536,   406333708}, {  994199898,   405571285}, 
+	{  992008094,   410903207}, {  992322961,   410142225}, {  992637245,   409381002}, {  992950944,   408619539}, 
+	{  990742793,   413944711}, {  991059993,   413184699}, {  991376610,   412424444}, {  991692644,   411663946}, 
+	{  989468165,   416982319}, {  989787696,   416223284}, {  990106644,   415464004}, {  990425010,   414704479}, 
+	{  988184225,   420016002}, {  988506083,   419257951}, {  988827359,   418499653}, {  989148053,   417741109}, 
+	{  986890984,   423045732}, {  987215165,   422288671}, {  987538766,   421531363}, {  987861786,   420773806}, 
+	{  985588453,   426071480}, {  985914956,   425315418}, {  986240879,   424559105}, {  986566221,   423802543}, 
+	{  984276646,   429093217}, {  984605467,   428338160}, {  984933708,   427582852}, {  985261370,   426827291}, 
+	{  982955574,   432110916}, {  983286710,   431356872}, {  983617267,   430602573}, {  983947246,   429848022}, 
+	{  981625251,   435124548}, {  981958698,   434371523}, {  982291568,   433618242}, {  982623860,   432864706}, 
+	{  980285688,   438134084}, {  980621444,   437382085}, {  980956623,   436629829}, {  981291226,   435877317}, 
+	{  978936898,   441139496}, {  979274960,   440388531}, {  979612445,   439637307}, {  979949355,   438885824}, 
+	{  977578894,   444140756}, {  977919258,   443390832}, {  978259047,   442640647}, {  978598260,   441890201}, 
+	{  976211688,   447137835}, {  976554352,   446388959}, {  976896441,   445639820}, {  977237955,   444890419}, 
+	{  974835295,   450130706}, {  975180254,   449382885}, {  975524639,   448634799}, {  975868451,   447886449}, 
+	{  973449725,   453119340}, {  973796977,   452372581}, {  974143656,   451625555}, {  974489762,   450878263}, 
+	{  972054994,   456103710}, {  972404535,   455358019}, {  972753504,   454612060}, {  973101901,   453865834}, 
+	{  970651112,   459083786}, {  971002940,   458339171}, {  971354196,   457594286}, {  971704881,   456849132}, 
+	{  969238095,   462059541}, {  969592205,   461316009}, {  969945745,   460572205}, {  970298714,   459828131}, 
+	{  967815955,   465030947}, {  968172345,   464288505}, {  968528165,   463545789}, {  968883415,   462802801}, 
+	{  966384706,   467997976}, {  966743371,   467256631}, {  967101468,   466515010}, {  967458996,   465773116}, 
+	{  964944360,   470960600}, {  965305298,   470220358}, {  965665669,   469479840}, {  966025471,   468739046}, 
+	{  963494932,   473918791}, {  963858140,   473179660}, {  964220780,   472440251}, {  964582854,   471700564}, 
+	{  962036435,   476872522}, {  962401909,   476134509}, {  962766816,   475396216}, {  963131157,   474657643}, 
+	{  960568883,   479821764}, {  960936620,   479084875}, {  961303790,   478347705}, {  961670396,   477610254}, 
+	{  959092290,   482766489}, {  959462286,   482030733}, {  959831716,   481294693}, {  960200582,   480558369}, 
+	{  957606670,   485706671}, {  957978921,   484972053}, {  958350608,   484237150}, {  958721731,   483501962}, 
+	{  956112036,   488642281}, {  956486539,   487908809}, {  956860479,   487175049}, {  957233856,   486441003}, 
+	{  954608403,   491573292}, {  954985154,   490840972}, {  955361344,   490108363}, {  955736971,   489375466}, 
+	{  953095785,   494499676}, {  953474781,   493768515}, {  953853216,   493037064}, {  954231090,   492305322}, 
+	{  951574196,   497421405}, {  951955434,   496691410}, {  952336111,   495961124}, {  952716228,   495230545}, 
+	{  950043650,   500338453}, {  950427126,   499609631}, {  950810042,   498880516}, {  951192399,   498151107}, 
+	{  948504163,   503250791}, {  948889872,   502523149}, {  949275023,   501795212}, {  949659616,   501066980}, 
+	{  946955747,   506158392}, {  947343687,   505431937}, {  947731070,   504705185}, {  948117895,   503978136}, 
+	{  945398418,   509061229}, {  945788585,   508335968}, {  946178196,   507610408}, {  946567250,   506884549}, 
+	{  943832191,   511959275}, {  944224582,   511235214}, {  944616416,   510510853}, {  945007695,   509786191}, 
+	{  942257081,   514852502}, {  942651690,   514129648}, {  943045745,   513406493}, {  943439246,   512683035}, 
+	{  940673101,   517740883}, {  941069926,   517019243}, {  941466198,   516297300}, {  941861917,   515575053}, 
+	{  939080267,   520624391}, {  939479305,   519903972}, {  939877790,   519183248}, {  940275722,   518462218}, 
+	{  937478595,   523502998}, {  937879841,   522783807}, {  938280535,   522064309}, {  938680677,   521344503}, 
+	{  935868098,   526376678}, {  936271549,   525658722}, {  936674448,   524940456}, {  937076797,   524221881}, 
+	{  934248793,   529245404}, {  934654444,   528528689}, {  935059546,   527811662}, {  935464097,   527094325}, 
+	{  932620694,   532109148}, {  933028542,   531393681}, {  933435842,   530677900}, {  933842592,   529961808}, 
+	{  930983817,   534967884}, {  931393859,   534253671}, {  931803352,   533539144}, {  932212297,   532824303}, 
+	{  929338177,   537821584}, {  929750408,   537108633}, {  930162092,   536395365}, {  930573228,   535681782}, 
+	{  927683790,   540670223}, {  928098206,   539958539}, {  928512076,   539246538}, {  928925400,   538534220}, 
+	{  926020672,   543513772}, {  926437269,   542803363}, {  926853322,   542092635}, {  927268829,   541381588}, 
+	{  924348837,   546352205}, {  924767612,   545643078}, {  925185843,   544933630}, {  925603530,   544223861}, 
+	{  922668302,   549185496}, {  923089250,   548477657}, {  923509656,   547769495}, {  923929518,   547061011}, 
+	{  920979082,   552013618}, {  921402200,   551307074}, {  921824777,   550600205}, {  922246810,   549893013}, 
+	{  919281194,   554836544}, {  919706478,   554131301}, {  920131221,   553425732}, {  920555422,   552719838}, 
+	{  917574653,   557654248}, {  918002099,   556950313}, {  918429004,   556246051}, {  918855369,   555541461}, 
+	{  915859476,   560466703}, {  916289079,   559764083}, {  916718143,   559061133}, {  917146668,   558357855}, 
+	{  914135678,   563273883}, {  914567435,   562572584}, {  914998653,   561870954}, {  915429334,   561168994}, 
+	{  912403276,   566075761}, {  912837182,   565375790}, {  913270551,   564675486}, {  913703383,   563974850}, 
+	{  910662286,   568872310}, {  911098338,   568173674}, {  911533853,   567474703}, {  911968833,   566775399}, 
+	{  908912725,   571663506}, {  909350918,   570966210}, {  909788576,   570268579}, {  910225699,   569570612}, 
+	{  907154608,   574449320}, {  907594938,   573753372}, {  908034735,   573057087}, {  908473997,   572360465}, 
+	{  905387953,   577229728}, {  905830417,   576535134}, {  906272347,   575840202}, {  906713744,   575144930}, 
+	{  903612776,   580004702}, {  904057369,   579311470}, {  904501429,   578617896}, {  904944957,   577923982}, 
+	{  901829095,   582774218}, {  902275811,   582082352}, {  902721998,   581390144}, {  903167653,   580697594}, 
+	{  900036924,   585538248}, {  900485762,   584847756}, {  900934069,   584156920}, {  901381847,   583465740}, 
+	{  898236282,   588296766}, {  898687236,   587607655}, {  899137661,   586918198}, {  899587557,   586228395}, 
+	{  896427186,   591049748}, {  896880252,   590362023}, {  897332790,   589673951}, {  897784800,   588985532}, 
+	{  894609652,   593797166}, {  895064826,   593110835}, {  895519473,   592424154}, {  895973593,   591737125}, 
+	{  892783698,   596538995}, {  893240975,   595854063}, {  893697727,   595168781}, {  894153953,   594483148}, 
+	{  890949341,   599275210}, {  891408717,   598591684}, {  891867569,   597907806}, {  892325896,   597223576}, 
+	{  889106597,   602005783}, {  889568068,   601323670}, {  890029016,   600641203}, {  890489440,   599958383}, 
+	{  887255485,   604730691}, {  887719047,   604049997}, {  888182086,   603368947}, {  888644603,   602687543}, 
+	{  885396022,   607449906}, {  885861670,   606770638}, {  886326796,   606091012}, {  886791402,   605411029}, 
+	{  883528225,   610163404}, {  883995955,   609485567}, {  884463164,   608807372}, {  884929853,   608128818}, 
+	{  881652112,   612871159}, {  882121919,   612194760}, {  882591207,   611518001}, {  883059976,   610840882}, 
+	{  879767701,   615573145}, {  880239581,   614898191}, {  880710943,   614222875}, {  881181787,   613547198}, 
+	{  877875009,   618269338}, {  878348957,   617595834}, {  878822389,   616921967}, {  879295303,   616247738}, 
+	{  875974054,   620959711}, {  876450066,   620287664}, {  876925563,   619615253}, {  877400544,   618942478}, 
+	{  874064853,   623644239}, {  874542925,   622973656}, {  875020483,   622302707}, {  875497526,   621631392}, 
+	{  872147426,   626322897}, {  872627553,   625653784}, {  873107167,   624984303}, {  873586267,   624314455}, 
+	{  870221790,   628995660}, {  870703968,   628328023}, {  871185633,   627660017}, {  871666786,   626991641}, 
+	{  868287963,   631662503}, {  868772187,   630996348}, {  869255900,   630329823}, {  869739101,   629662927}, 
+	{  866345964,   634323400}, {  866832229,   633658734}, {  867317984,   632993696}, {  867803229,   632328285}, 
+	{  864395810,   636978327}, {  864884112,   636315156}, {  865371905,   635651611}, {  865859189,   634987692}, 
+	{  862437520,   639627258}, {  862927854,   638965588}, {  863417681,   638303543}, {  863906999,   637641122}, 
+	{  860471112,   642270169}, {  860963474,   641610007}, {  861455330,   640949467}, {  861946678,   640288551}, 
+	{  858496606,   644907034}, {  858990991,   644248386}, {  859484870,   643589359}, {  859978244,   642929953}, 
+	{  856514019,   647537830}, {  857010422,   646880701}, {  857506321,   646223192}, {  858001716,   645565303}, 
+	{  854523370,   650162530}, {  855021787,   649506928}, {  855519701,   648850943}, {  856017111,   648194577}, 
+	{  852524677,   652781111}, {  853025104,   652127041}, {  853525028,   651472587}, {  854024450,   650817750}, 
+	{  850517961,   655393548}, {  851020391,   654741016}, {  851522321,   654088099}, {  852023750,   653434797}, 
+	{  848503239,   657999816}, {  849007669,   657348828}, {  849511600,   656697454}, {  850015030,   656045694}, 
+	{  846480531,   660599890}, {  846986956,   659950454}, {  847492882,   659300629}, {  847998310,   658650416}, 
+	{  844449856,   663193747}, {  844958270,   662545867}, {  845466188,   661897597}, {  845973608,   661248938}, 
+	{  842411232,   665781362}, {  842921632,   665135044}, {  843431536,   664488336}, {  843940944,   663841237}, 
+	{  840364679,   668362709}, {  840877059,   667717961}, {  841388945,   667072820}, {  841900336,   666427287}, 
+	{  838310216,   670937767}, {  838824572,   670294593}, {  839338435,   669651026}, {  839851804,   669007064}, 
+	{  836247863,   673506508}, {  836764190,   672864916}, {  837280024,   672222928}, {  837795367,   671580545}, 
+	{  834177638,   676068911}, {  834695931,   675428906}, {  835213733,   674788504}, {  835731044,   674147704}, 
+	{  832099562,   678624950}, {  832619816,   677986538}, {  833139580,   677347728}, {  833658855,   676708518}, 
+	{  830013654,   681174602}, {  830535864,   680537789}, {  831057586,   679900576}, {  831578819,   679262963}, 
+	{  827919934,   683717842}, {  828444095,   683082635}, {  828967769,   682447025}, {  829490956,   681811014}, 
+	{  825818421,   686254647}, {  826344528,   685621051}, {  826870150,   684987051}, {  827395285,   684352648}, 
+	{  823709135,   688784993}, {  824237184,   688153013}, {  824764748,   687520629}, {  825291827,   686887840}, 
+	{  821592095,   691308855}, {  822122081,   690678499}, {  822651583,   690047736}, {  823180601,   689416567}, 
+	{  819467323,   693826211}, {  819999240,   693197483}, {  820530675,   692568348}, {  821061627,   691938805}, 
+	{  817334838,   696337036}, {  817868681,   695709943}, {  818402043,   695082441}, {  818934924,   694454530}, 
+	{  815194659,   698841307}, {  815730424,   698215855}, {  816265709,   697589992}, {  816800514,   696963719}, 
+	{  813046808,   701339000}, {  813584489,   700715194}, {  814121692,   700090977}, {  814658415,   699466348}, 
+	{  810891304,   703830092}, {  811430896,   703207939}, {  811970011,   702585372}, {  812508649,   701962393}, 
+	{  808728167,   706314559}, {  809269666,   705694064}, {  809810688,   705073155}, {  810351235,   704451830}, 
+	{  806557419,   708792378}, {  807100819,   708173547}, {  807643743,   707554301}, {  808186193,   706934638}, 
+	{  804379079,   711263525}, {  804924374,   710646365}, {  805469196,   710028787}, {  806013545,   709410791}, 
+	{  802193167,   713727978}, {  802740354,   713112494}, {  803287068,   712496590}, {  803833310,   711880267}, 
+	{  799999706,   716185713}, {  800548778,   715571910}, {  801097379,   714957687}, {  801645509,   714343043}, 
+	{  797798714,   718636707}, {  798349667,   718024592}, {  798900150,   717412054}, {  799450163,   716799095}, 
+	{  795590213,   721080937}, {  796143041,   720470515}, {  796695401,   719859669}, {  797247292,   719248400}, 
+	{  793374223,   723518380}, {  793928922,   722909657}, {  794483153,   722300508}, {  795036917,   721690935}, 
+	{  791150767,   725949013}, {  791707330,   725341994}, {  792263427,   724734549}, {  792819059,   724126677}, 
+	{  788919863,   728372813}, {  789478286,   727767504}, {  790036244,   727161768}, {  790593738,   726555604}, 
+	{  786681534,   730789757}, {  787241811,   730186165}, {  787801625,   729582143}, {  788360976,   728977692}, 
+	{  784435800,   733199822}, {  784997927,   732597952}, {  785559591,   731995651}, {  786120794,   731392919}, 
+	{  782182683,   735602987}, {  782746654,   735002844}, {  783310163,   734402269}, {  783873212,   733801261}, 
+	{  779922204,   737999228}, {  780488013,   737400818}, {  781053363,   736801974}, {  781618253,   736202697}, 
+	{  777654384,   740388522}, {  778222026,   739791851}, {  778789210,   739194745}, {  779355936,   738597203}, 
+	{  775379244,   742770848}, {  775948714,   742175921}, {  776517728,   741580558}, {  777086284,   740984758}, 
+	{  773096806,   745146182}, {  773668099,   744553005}, {  774238936,   743959390}, {  774809318,   743365338}, 
+	{  770807092,   747514503}, {  771380201,   746923082}, {  771952857,   746331221}, {  772525059,   745738921}, 
+	{  768510122,   749875788}, {  769085043,   749286127}, {  769659512,   748696026}, {  770233528,   748105485}, 
+	{  766205919,   752230015}, {  766782646,   751642121}, {  767358923,   751053785}, {  767934748,   750465007}, 
+	{  763894504,   754577161}, {  764473032,   753991040}, {  765051111,   753404474}, {  765628740,   752817466}, 
+	{  761575898,   756917205}, {  762156223,   756332861}, {  762736098,   755748072}, {  763315525,   755162839}, 
+	{  759250125,   759250125}, {  759832239,   758667564}, {  760413906,   758084557}, {  760995126,   757501104}, 
+	{  756917205,   761575898}, {  757501104,   760995126}, {  758084557,   760413906}, {  758667564,   759832239}, 
+	{  754577161,   763894504}, {  755162839,   763315525}, {  755748072,   762736098}, {  756332861,   762156223}, 
+	{  752230015,   766205919}, {  752817466,   765628740}, {  753404474,   765051111}, {  753991040,   764473032}, 
+	{  749875788,   768510122}, {  750465007,   767934748}, {  751053785,   767358923}, {  751642121,   766782646}, 
+	{  747514503,   770807092}, {  748105485,   770233528}, {  748696026,   769659512}, {  749286127,   769085043}, 
+	{  745146182,   773096806}, {  745738921,   772525059}, {  746331221,   771952857}, {  746923082,   771380201}, 
+	{  742770848,   775379244}, {  743365338,   774809318}, {  743959390,   774238936}, {  744553005,   773668099}, 
+	{  740388522,   777654384}, {  740984758,   777086284}, {  741580558,   776517728}, {  742175921,   775948714}, 
+	{  737999228,   779922204}, {  738597203,   779355936}, {  739194745,   778789210}, {  739791851,   778222026}, 
+	{  735602987,   782182683}, {  736202697,   781618253}, {  736801974,   781053363}, {  737400818,   780488013}, 
+	{  733199822,   784435800}, {  733801261,   783873212}, {  734402269,   783310163}, {  735002844,   782746654}, 
+	{  730789757,   786681534}, {  731392919,   786120794}, {  731995651,   785559591}, {  732597952,   784997927}, 
+	{  728372813,   788919863}, {  728977692,   788360976}, {  729582143,   787801625}, {  730186165,   787241811}, 
+	{  725949013,   791150767}, {  726555604,   790593738}, {  727161768,   790036244}, {  727767504,   789478286}, 
+	{  723518380,   793374223}, {  724126677,   792819059}, {  724734549,   792263427}, {  725341994,   791707330}, 
+	{  721080937,   795590213}, {  721690935,   795036917}, {  722300508,   794483153}, {  722909657,   793928922}, 
+	{  718636707,   797798714}, {  719248400,   797247292}, {  719859669,   796695401}, {  720470515,   796143041}, 
+	{  716185713,   799999706}, {  716799095,   799450163}, {  717412054,   798900150}, {  718024592,   798349667}, 
+	{  713727978,   802193167}, {  714343043,   801645509}, {  714957687,   801097379}, {  715571910,   800548778}, 
+	{  711263525,   804379079}, {  711880267,   803833310}, {  712496590,   803287068}, {  713112494,   802740354}, 
+	{  708792378,   806557419}, {  709410791,   806013545}, {  710028787,   805469196}, {  710646365,   804924374}, 
+	{  706314559,   808728167}, {  706934638,   808186193}, {  707554301,   807643743}, {  708173547,   807100819}, 
+	{  703830092,   810891304}, {  704451830,   810351235}, {  705073155,   809810688}, {  705694064,   809269666}, 
+	{  701339000,   813046808}, {  701962393,   812508649}, {  702585372,   811970011}, {  703207939,   811430896}, 
+	{  698841307,   815194659}, {  699466348,   814658415}, {  700090977,   814121692}, {  700715194,   813584489}, 
+	{  696337036,   817334838}, {  696963719,   816800514}, {  697589992,   816265709}, {  698215855,   815730424}, 
+	{  693826211,   819467323}, {  694454530,   818934924}, {  695082441,   818402043}, {  695709943,   817868681}, 
+	{  691308855,   821592095}, {  691938805,   821061627}, {  692568348,   820530675}, {  693197483,   819999240}, 
+	{  688784993,   823709135}, {  689416567,   823180601}, {  690047736,   822651583}, {  690678499,   822122081}, 
+	{  686254647,   825818421}, {  686887840,   825291827}, {  687520629,   824764748}, {  688153013,   824237184}, 
+	{  683717842,   827919934}, {  684352648,   827395285}, {  684987051,   826870150}, {  685621051,   826344528}, 
+	{  681174602,   830013654}, {  681811014,   829490956}, {  682447025,   828967769}, {  683082635,   828444095}, 
+	{  678624950,   832099562}, {  679262963,   831578819}, {  679900576,   831057586}, {  680537789,   830535864}, 
+	{  676068911,   834177638}, {  676708518,   833658855}, {  677347728,   833139580}, {  677986538,   832619816}, 
+	{  673506508,   836247863}, {  674147704,   835731044}, {  674788504,   835213733}, {  675428906,   834695931}, 
+	{  670937767,   838310216}, {  671580545,   837795367}, {  672222928,   837280024}, {  672864916,   836764190}, 
+	{  668362709,   840364679}, {  669007064,   839851804}, {  669651026,   839338435}, {  670294593,   838824572}, 
+	{  665781362,   842411232}, {  666427287,   841900336}, {  667072820,   841388945}, {  667717961,   840877059}, 
+	{  663193747,   844449856}, {  663841237,   843940944}, {  664488336,   843431536}, {  665135044,   842921632}, 
+	{  660599890,   846480531}, {  661248938,   845973608}, {  661897597,   845466188}, {  662545867,   844958270}, 
+	{  657999816,   848503239}, {  658650416,   847998310}, {  659300629,   847492882}, {  659950454,   846986956}, 
+	{  655393548,   850517961}, {  656045694,   850015030}, {  656697454,   849511600}, {  657348828,   849007669}, 
+	{  652781111,   852524677}, {  653434797,   852023750}, {  654088099,   851522321}, {  654741016,   851020391}, 
+	{  650162530,   854523370}, {  650817750,   854024450}, {  651472587,   853525028}, {  652127041,   853025104}, 
+	{  647537830,   856514019}, {  648194577,   856017111}, {  648850943,   855519701}, {  649506928,   855021787}, 
+	{  644907034,   858496606}, {  645565303,   858001716}, {  646223192,   857506321}, {  646880701,   857010422}, 
+	{  642270169,   860471112}, {  642929953,   859978244}, {  643589359,   859484870}, {  644248386,   858990991}, 
+	{  639627258,   862437520}, {  640288551,   861946678}, {  640949467,   861455330}, {  641610007,   860963474}, 
+	{  636978327,   864395810}, {  637641122,   863906999}, {  638303543,   863417681}, {  638965588,   862927854}, 
+	{  634323400,   866345964}, {  634987692,   865859189}, {  635651611,   865371905}, {  636315156,   864884112}, 
+	{  631662503,   868287963}, {  632328285,   867803229}, {  632993696,   867317984}, {  633658734,   866832229}, 
+	{  628995660,   870221790}, {  629662927,   869739101}, {  630329823,   869255900}, {  630996348,   868772187}, 
+	{  626322897,   872147426}, {  626991641,   871666786}, {  627660017,   871185633}, {  628328023,   870703968}, 
+	{  623644239,   874064853}, {  624314455,   873586267}, {  624984303,   873107167}, {  625653784,   872627553}, 
+	{  620959711,   875974054}, {  621631392,   875497526}, {  622302707,   875020483}, {  622973656,   874542925}, 
+	{  618269338,   877875009}, {  618942478,   877400544}, {  619615253,   876925563}, {  620287664,   876450066}, 
+	{  615573145,   879767701}, {  616247738,   879295303}, {  616921967,   878822389}, {  617595834,   878348957}, 
+	{  612871159,   881652112}, {  613547198,   881181787}, {  614222875,   880710943}, {  614898191,   880239581}, 
+	{  610163404,   883528225}, {  610840882,   883059976}, {  611518001,   882591207}, {  612194760,   882121919}, 
+	{  607449906,   885396022}, {  608128818,   884929853}, {  608807372,   884463164}, {  609485567,   883995955}, 
+	{  604730691,   887255485}, {  605411029,   886791402}, {  606091012,   886326796}, {  606770638,   885861670}, 
+	{  602005783,   889106597}, {  602687543,   888644603}, {  603368947,   888182086}, {  604049997,   887719047}, 
+	{  599275210,   890949341}, {  599958383,   890489440}, {  600641203,   890029016}, {  601323670,   889568068}, 
+	{  596538995,   892783698}, {  597223576,   892325896}, {  597907806,   891867569}, {  598591684,   891408717}, 
+	{  593797166,   894609652}, {  594483148,   894153953}, {  595168781,   893697727}, {  595854063,   893240975}, 
+	{  591049748,   896427186}, {  591737125,   895973593}, {  592424154,   895519473}, {  593110835,   895064826}, 
+	{  588296766,   898236282}, {  588985532,   897784800}, {  589673951,   897332790}, {  590362023,   896880252}, 
+	{  585538248,   900036924}, {  586228395,   899587557}, {  586918198,   899137661}, {  587607655,   898687236}, 
+	{  582774218,   901829095}, {  583465740,   901381847}, {  584156920,   900934069}, {  584847756,   900485762}, 
+	{  580004702,   903612776}, {  580697594,   903167653}, {  581390144,   902721998}, {  582082352,   902275811}, 
+	{  577229728,   905387953}, {  577923982,   904944957}, {  578617896,   904501429}, {  579311470,   904057369}, 
+	{  574449320,   907154608}, {  575144930,   906713744}, {  575840202,   906272347}, {  576535134,   905830417}, 
+	{  571663506,   908912725}, {  572360465,   908473997}, {  573057087,   908034735}, {  573753372,   907594938}, 
+	{  568872310,   910662286}, {  569570612,   910225699}, {  570268579,   909788576}, {  570966210,   909350918}, 
+	{  566075761,   912403276}, {  566775399,   911968833}, {  567474703,   911533853}, {  568173674,   911098338}, 
+	{  563273883,   914135678}, {  563974850,   913703383}, {  564675486,   913270551}, {  565375790,   912837182}, 
+	{  560466703,   915859476}, {  561168994,   915429334}, {  561870954,   914998653}, {  562572584,   914567435}, 
+	{  557654248,   917574653}, {  558357855,   917146668}, {  559061133,   916718143}, {  559764083,   916289079}, 
+	{  554836544,   919281194}, {  555541461,   918855369}, {  556246051,   918429004}, {  556950313,   918002099}, 
+	{  552013618,   920979082}, {  552719838,   920555422}, {  553425732,   920131221}, {  554131301,   919706478}, 
+	{  549185496,   922668302}, {  549893013,   922246810}, {  550600205,   921824777}, {  551307074,   921402200}, 
+	{  546352205,   924348837}, {  547061011,   923929518}, {  547769495,   923509656}, {  548477657,   923089250}, 
+	{  543513772,   926020672}, {  544223861,   925603530}, {  544933630,   925185843}, {  545643078,   924767612}, 
+	{  540670223,   927683790}, {  541381588,   927268829}, {  542092635,   926853322}, {  542803363,   926437269}, 
+	{  537821584,   929338177}, {  538534220,   928925400}, {  539246538,   928512076}, {  539958539,   928098206}, 
+	{  534967884,   930983817}, {  535681782,   930573228}, {  536395365,   930162092}, {  537108633,   929750408}, 
+	{  532109148,   932620694}, {  532824303,   932212297}, {  533539144,   931803352}, {  534253671,   931393859}, 
+	{  529245404,   934248793}, {  529961808,   933842592}, {  530677900,   933435842}, {  531393681,   933028542}, 
+	{  526376678,   935868098}, {  527094325,   935464097}, {  527811662,   935059546}, {  528528689,   934654444}, 
+	{  523502998,   937478595}, {  524221881,   937076797}, {  524940456,   936674448}, {  525658722,   936271549}, 
+	{  520624391,   939080267}, {  521344503,   938680677}, {  522064309,   938280535}, {  522783807,   937879841}, 
+	{  517740883,   940673101}, {  518462218,   940275722}, {  519183248,   939877790}, {  519903972,   939479305}, 
+	{  514852502,   942257081}, {  515575053,   941861917}, {  516297300,   941466198}, {  517019243,   941069926}, 
+	{  511959275,   943832191}, {  512683035,   943439246}, {  513406493,   943045745}, {  514129648,   942651690}, 
+	{  509061229,   945398418}, {  509786191,   945007695}, {  510510853,   944616416}, {  511235214,   944224582}, 
+	{  506158392,   946955747}, {  506884549,   946567250}, {  507610408,   946178196}, {  508335968,   945788585}, 
+	{  503250791,   948504163}, {  503978136,   948117895}, {  504705185,   947731070}, {  505431937,   947343687}, 
+	{  500338453,   950043650}, {  501066980,   949659616}, {  501795212,   949275023}, {  502523149,   948889872}, 
+	{  497421405,   951574196}, {  498151107,   951192399}, {  498880516,   950810042}, {  499609631,   950427126}, 
+	{  494499676,   953095785}, {  495230545,   952716228}, {  495961124,   952336111}, {  496691410,   951955434}, 
+	{  491573292,   954608403}, {  492305322,   954231090}, {  493037064,   953853216}, {  493768515,   953474781}, 
+	{  488642281,   956112036}, {  489375466,   955736971}, {  490108363,   955361344}, {  490840972,   954985154}, 
+	{  485706671,   957606670}, {  486441003,   957233856}, {  487175049,   956860479}, {  487908809,   956486539}, 
+	{  482766489,   959092290}, {  483501962,   958721731}, {  484237150,   958350608}, {  484972053,   957978921}, 
+	{  479821764,   960568883}, {  480558369,   960200582}, {  481294693,   959831716}, {  482030733,   959462286}, 
+	{  476872522,   962036435}, {  477610254,   961670396}, {  478347705,   961303790}, {  479084875,   960936620}, 
+	{  473918791,   963494932}, {  474657643,   963131157}, {  475396216,   962766816}, {  476134509,   962401909}, 
+	{  470960600,   964944360}, {  471700564,   964582854}, {  472440251,   964220780}, {  473179660,   963858140}, 
+	{  467997976,   966384706}, {  468739046,   966025471}, {  469479840,   965665669}, {  470220358,   965305298}, 
+	{  465030947,   967815955}, {  465773116,   967458996}, {  466515010,   967101468}, {  467256631,   966743371}, 
+	{  462059541,   969238095}, {  462802801,   968883415}, {  463545789,   968528165}, {  464288505,   968172345}, 
+	{  459083786,   970651112}, {  459828131,   970298714}, {  460572205,   969945745}, {  461316009,   969592205}, 
+	{  456103710,   972054994}, {  456849132,   971704881}, {  457594286,   971354196}, {  458339171,   971002940}, 
+	{  453119340,   973449725}, {  453865834,   973101901}, {  454612060,   972753504}, {  455358019,   972404535}, 
+	{  450130706,   974835295}, {  450878263,   974489762}, {  451625555,   974143656}, {  452372581,   973796977}, 
+	{  447137835,   976211688}, {  447886449,   975868451}, {  448634799,   975524639}, {  449382885,   975180254}, 
+	{  444140756,   977578894}, {  444890419,   977237955}, {  445639820,   976896441}, {  446388959,   976554352}, 
+	{  441139496,   978936898}, {  441890201,   978598260}, {  442640647,   978259047}, {  443390832,   977919258}, 
+	{  438134084,   980285688}, {  438885824,   979949355}, {  439637307,   979612445}, {  440388531,   979274960}, 
+	{  435124548,   981625251}, {  435877317,   981291226}, {  436629829,   980956623}, {  437382085,   980621444}, 
+	{  432110916,   982955574}, {  432864706,   982623860}, {  433618242,   982291568}, {  434371523,   981958698}, 
+	{  429093217,   984276646}, {  429848022,   983947246}, {  430602573,   983617267}, {  431356872,   983286710}, 
+	{  426071480,   985588453}, {  426827291,   985261370}, {  427582852,   984933708}, {  428338160,   984605467}, 
+	{  423045732,   986890984}, {  423802543,   986566221}, {  424559105,   986240879}, {  425315418,   985914956}, 
+	{  420016002,   988184225}, {  420773806,   987861786}, {  421531363,   987538766}, {  422288671,   987215165}, 
+	{  416982319,   989468165}, {  417741109,   989148053}, {  418499653,   988827359}, {  419257951,   988506083}, 
+	{  413944711,   990742793}, {  414704479,   990425010}, {  415464004,   990106644}, {  416223284,   989787696}, 
+	{  410903207,   992008094}, {  411663946,   991692644}, {  412424444,   991376610}, {  413184699,   991059993}, 
+	{  407857835,   993264059}, {  408619539,   992950944}, {  409381002,   992637245}, {  410142225,   992322961}, 
+	{  404808624,   994510675}, {  405571285,   994199898}, {  406333708,   993888536}, {  407095891,   993576590}, 
+	{  401755603,   995747930}, {  402519214,   995439494}, {  403282588,   995130473}, {  404045725,   994820867}, 
+	{  398698801,   996975812}, {  399463355,   996669721}, {  400227673,   996363043}, {  400991756,   996055780}, 
+	{  395638246,   998194311}, {  396403735,   997890567}, {  397168991,   997586236}, {  397934013,   997281317}, 
+	{  392573967,   999403415}, {  393340384,   999102020}, {  394106570,   998800038}, {  394872524,   998497468}, 
+	{  389505993,  1000603111}, {  390273331,  1000304069}, {  391040440,  1000004439}, {  391807319,   999704221}, 
+	{  386434353,  1001793390}, {  387202605,  1001496704}, {  387970630,  1001199428}, {  388738426,  1000901564}, 
+	{  383359076,  1002974239}, {  384128234,  1002679911}, {  384897167,  1002384994}, {  385665873,  1002089486}, 
+	{  380280190,  1004145648}, {  381050248,  1003853681}, {  381820082,  1003561124}, {  382589691,  1003267977}, 
+	{  377197725,  1005307605}, {  377968675,  1005018003}, {  378739403,  1004727809}, {  379509908,  1004437024}, 
+	{  374111709,  1006460100}, {  374883544,  1006172864}, {  375655159,  1005885036}, {  376426553,  1005596617}, 
+	{  371022173,  1007603122}, {  371794885,  1007318256}, {  372567379,  1007032796}, {  373339654,  1006746744}, 
+	{  367929144,  1008736660}, {  368702727,  1008454166}, {  369476093,  1008171077}, {  370249242,  1007887396}, 
+	{  364832652,  1009860704}, {  365607098,  1009580584}, {  366381329,  1009299870}, {  367155344,  1009018562}, 
+	{  361732726,  1010975242}, {  362508027,  1010697499}, {  363283116,  1010419162}, {  364057991,  1010140230}, 
+	{  358629395,  1012080264}, {  359405545,  1011804901}, {  360181484,  1011528943}, {  360957211,  1011252390}, 
+	{  355522689,  1013175761}, {  356299680,  1012902780}, {  357076462,  1012629204}, {  357853034,  1012355032}, 
+	{  352412636,  1014261721}, {  353190461,  1013991126}, {  353968079,  1013719934}, {  354745488,  1013448145}, 
+	{  349299266,  1015338134}, {  350077918,  1015069927}, {  350856364,  1014801122}, {  351634604,  1014531720}, 
+	{  346182609,  1016404991}, {  346962080,  1016139173}, {  347741347,  1015872758}, {  348520409,  1015605745}, 
+	{  343062693,  1017462281}, {  343842976,  1017198856}, {  344623057,  1016934832}, {  345402934,  1016670211}, 
+	{  339939549,  1018509994}, {  340720636,  1018248964}, {  341501523,  1017987335}, {  342282209,  1017725107}, 
+	{  336813204,  1019548121}, {  337595089,  1019289488}, {  338376774,  1019030256}, {  339158261,  1018770425}, 
+	{  333683689,  1020576651}, {  334466364,  1020320418}, {  335248841,  1020063586}, {  336031121,  1019806153}, 
+	{  330551034,  1021595575}, {  331334491,  1021341745}, {  332117752,  1021087314}, {  332900819,  1020832283}, 
+	{  327415267,  1022604883}, {  328199499,  1022353458}, {  328983538,  1022101432}, {  329767383,  1021848804}, 
+	{  324276419,  1023604567}, {  325061418,  1023355549}, {  325846226,  1023105929}, {  326630843,  1022855707}, 
+	{  321134518,  1024594615}, {  321920278,  1024348007}, {  322705848,  1024100796}, {  323491229,  1023852982}, 
+	{  317989595,  1025575020}, {  318776108,  1025330824}, {  319562433,  1025086024}, {  320348570,  1024840621}, 
+	{  314841679,  1026545772}, {  315628937,  1026303990}, {  316416009,  1026061603}, {  317202895,  1025818614}, 
+	{  311690799,  1027506862}, {  312478795,  1027267495}, {  313266607,  1027027525}, {  314054235,  1026786951}, 
+	{  308536985,  1028458280}, {  309325712,  1028221332}, {  310114257,  1027983780}, {  310902619,  1027745623}, 
+	{  305380268,  1029400018}, {  306169718,  1029165491}, {  306958988,  1028930359}, {  307748077,  1028694622}, 
+	{  302220676,  1030332067}, {  303010842,  1030099963}, {  303800829,  1029867254}, {  304590638,  1029633939}, 
+	{  299058239,  1031254418}, {  299849113,  1031024740}, {  300639811,  1030794455}, {  301430332,  1030563564}, 
+	{  295892988,  1032167062}, {  296684563,  1031939812}, {  297475964,  1031711954}, {  298267189,  1031483489}, 
+	{  292724951,  1033069992}, {  293517220,  1032845170}, {  294309316,  1032619742}, {  295101239,  1032393706}, 
+	{  289554160,  1033963197}, {  290347114,  1033740808}, {  291139898,  1033517810}, {  291932511,  1033294205}, 
+	{  286380643,  1034846671}, {  287174276,  1034626715}, {  287967740,  1034406151}, {  288761035,  1034184978}, 
+	{  283204430,  1035720404}, {  283998734,  1035502884}, {  284792871,  1035284755}, {  285586841,  1035066018}, 
+	{  280025552,  1036584389}, {  280820520,  1036369307}, {  281615322,  1036153615}, {  282409959,  1035937314}, 
+	{  276844038,  1037438617}, {  277639662,  1037225975}, {  278435122,  1037012723}, {  279230419,  1036798861}, 
+	{  273659918,  1038283080}, {  274456191,  1038072880}, {  275252302,  1037862069}, {  276048251,  1037650648}, 
+	{  270473223,  1039117770}, {  271270136,  1038910014}, {  272066891,  1038701647}, {  272863485,  1038492669}, 
+	{  267283981,  1039942680}, {  268081529,  1039737370}, {  268878918,  1039531448}, {  269676150,  1039324915}, 
+	{  264092224,  1040757802}, {  264890398,  1040554939}, {  265688415,  1040351465}, {  266486277,  1040147378}, 
+	{  260897982,  1041563127}, {  261696774,  1041362715}, {  262495412,  1041161689}, {  263293896,  1040960052}, 
+	{  257701283,  1042358649}, {  258500686,  1042160688}, {  259299937,  1041962114}, {  260099036,  1041762927}, 
+	{  254502159,  1043144360}, {  255302166,  1042948852}, {  256102022,  1042752731}, {  256901728,  1042555997}, 
+	{  251300640,  1043920252}, {  252101242,  1043727200}, {  252901697,  1043533534}, {  253702003,  1043339254}, 
+	{  248096755,  1044686319}, {  248897946,  1044495724}, {  249698991,  1044304514}, {  250499889,  1044112690}, 
+	{  244890535,  1045442553}, {  245692307,  1045254416}, {  246493935,  1045065665}, {  247295417,  1044876299}, 
+	{  241682010,  1046188946}, {  242484355,  1046003271}, {  243286558,  1045816980}, {  244088618,  1045630074}, 
+	{  238471210,  1046925492}, {  239274121,  1046742279}, {  240076892,  1046558451}, {  240879522,  1046374006}, 
+	{  235258165,  1047652185}, {  236061635,  1047471436}, {  236864966,  1047290071}, {  237668158,  1047108090}, 
+	{  232042906,  1048369016}, {  232846927,  1048190733}, {  233650811,  1048011834}, {  234454557,  1047832317}, 
+	{  228825464,  1049075980}, {  229630027,  1048900165}, {  230434456,  1048723732}, {  231238749,  1048546683}, 
+	{  225605867,  1049773069}, {  226410966,  1049599723}, {  227215933,  1049425759}, {  228020765,  1049251178}, 
+	{  222384147,  1050460278}, {  223189774,  1050289403}, {  223995270,  1050117909}, {  224800635,  1049945798}, 
+	{  219160334,  1051137599}, {  219966481,  1050969196}, {  220772500,  1050800175}, {  221578389,  1050630536}, 
+	{  215934457,  1051805027}, {  216741118,  1051639098}, {  217547651,  1051472550}, {  218354057,  1051305384}, 
+	{  212706549,  1052462555}, {  213513715,  1052299101}, {  214320755,  1052135029}, {  215127670,  1051970337}, 
+	{  209476638,  1053110176}, {  210284302,  1052949200}, {  211091842,  1052787604}, {  211899258,  1052625389}, 
+	{  206244756,  1053747885}, {  207052910,  1053589387}, {  207860942,  1053430270}, {  208668851,  1053270533}, 
+	{  203010932,  1054375676}, {  203819569,  1054219658}, {  204628085,  1054063021}, {  205436481,  1053905763}, 
+	{  199775198,  1054993543}, {  200584309,  1054840007}, {  201393302,  1054685850}, {  202202177,  1054531073}, 
+	{  196537583,  1055601479}, {  197347161,  1055450426}, {  198156624,  1055298753}, {  198965969,  1055146458}, 
+	{  193298119,  1056199480}, {  194108156,  1056050912}, {  194918080,  1055901722}, {  195727889,  1055751911}, 
+	{  190056834,  1056787540}, {  190867324,  1056641457}, {  191677702,  1056494753}, {  192487967,  1056347427}, 
+	{  186813762,  1057365653}, {  187624696,  1057222057}, {  188435520,  1057077840}, {  189246233,  1056933001}, 
+	{  183568930,  1057933813}, {  184380301,  1057792706}, {  185191564,  1057650977}, {  186002717,  1057508626}, 
+	{  180322371,  1058492016}, {  181134171,  1058353399}, {  181945865,  1058214159}, {  182757451,  1058074297}, 
+	{  177074115,  1059040255}, {  177886336,  1058904130}, {  178698453,  1058767381}, {  179510465,  1058630010}, 
+	{  173824192,  1059578527}, {  174636827,  1059444894}, {  175449360,  1059310638}, {  176261789,  1059175758}, 
+	{  170572633,  1060106826}, {  171385674,  1059975686}, {  172198615,  1059843923}, {  173011454,  1059711537}, 
+	{  167319468,  1060625146}, {  168132908,  1060496502}, {  168946249,  1060367233}, {  169759491,  1060237341}, 
+	{  164064728,  1061133483}, {  164878559,  1061007335}, {  165692293,  1060880563}, {  166505929,  1060753166}, 
+	{  160808445,  1061631833}, {  161622659,  1061508182}, {  162436778,  1061383907}, {  163250801,  1061259007}, 
+	{  157550647,  1062120190}, {  158365237,  1061999038}, {  159179733,  1061877261}, {  159994136,  1061754859}, 
+	{  154291367,  1062598550}, {  155106324,  1062479898}, {  155921191,  1062360620}, {  156735965,  1062240717}, 
+	{  151030634,  1063066909}, {  151845952,  1062950757}, {  152661180,  1062833980}, {  153476319,  1062716578}, 
+	{  147768480,  1063525261}, {  148584150,  1063411611}, {  149399733,  1063297336}, {  150215228,  1063182435}, 
+	{  144504935,  1063973603}, {  145320950,  1063862456}, {  146136880,  1063750684}, {  146952723,  1063638285}, 
+	{  141240030,  1064411931}, {  142056382,  1064303288}, {  142872651,  1064194019}, {  143688835,  1064084124}, 
+	{  137973796,  1064840240}, {  138790477,  1064734102}, {  139607077,  1064627338}, {  140423595,  1064519947}, 
+	{  134706263,  1065258526}, {  135523266,  1065154894}, {  136340190,  1065050636}, {  137157033,  1064945751}, 
+	{  131437462,  1065666786}, {  132254779,  1065565661}, {  133072019,  1065463909}, {  133889180,  1065361531}, 
+	{  128167423,  1066065015}, {  128985047,  1065966398}, {  129802595,  1065867154}, {  130620067,  1065767284}, 
+	{  124896179,  1066453210}, {  125714101,  1066357102}, {  126531950,  1066260367}, {  127349724,  1066163005}, 
+	{  121623759,  1066831367}, {  122441972,  1066737769}, {  123260114,  1066643544}, {  124078183,  1066548690}, 
+	{  118350194,  1067199483}, {  119168691,  1067108396}, {  119987118,  1067016680}, {  120805474,  1066924338}, 
+	{  115075515,  1067557554}, {  115894288,  1067468978}, {  116712992,  1067379774}, {  117531627,  1067289942}, 
+	{  111799753,  1067905576}, {  112618793,  1067819513}, {  113437768,  1067732821}, {  114256675,  1067645501}, 
+	{  108522939,  1068243547}, {  109342239,  1068159997}, {  110161476,  1068075818}, {  110980647,  1067991011}, 
+	{  105245103,  1068571464}, {  106064656,  1068490427}, {  106884147,  1068408763}, {  107703574,  1068326469}, 
+	{  101966277,  1068889322}, {  102786074,  1068810801}, {  103605812,  1068731650}, {  104425488,  1068651871}, 
+	{   98686491,  1069197120}, {   99506525,  1069121114}, {  100326502,  1069044479}, {  101146419,  1068967215}, 
+	{   95405776,  1069494854}, {   96226040,  1069421364}, {   97046247,  1069347245}, {   97866398,  1069272497}, 
+	{   92124163,  1069782521}, {   92944648,  1069711548}, {   93765079,  1069639946}, {   94585455,  1069567715}, 
+	{   88841683,  1070060120}, {   89662382,  1069991664}, {   90483029,  1069922579}, {   91303623,  1069852865}, 
+	{   85558366,  1070327646}, {   86379272,  1070261709}, {   87200127,  1070195142}, {   88020931,  1070127946}, 
+	{   82274245,  1070585099}, {   83095349,  1070521680}, {   83916404,  1070457632}, {   84737410,  1070392954}, 
+	{   78989349,  1070832474}, {   79810644,  1070771575}, {   80631892,  1070710046}, {   81453092,  1070647887}, 
+	{   75703709,  1071069770}, {   76525187,  1071011391}, {   77346620,  1070952382}, {   78168007,  1070892743}, 
+	{   72417357,  1071296985}, {   73239010,  1071241127}, {   74060620,  1071184638}, {   74882187,  1071127519}, 
+	{   69130324,  1071514117}, {   69952144,  1071460780}, {   70773924,  1071406812}, {   71595661,  1071352214}, 
+	{   65842639,  1071721163}, {   66664620,  1071670347}, {   67486561,  1071618901}, {   68308462,  1071566824}, 
+	{   62554335,  1071918122}, {   63376468,  1071869828}, {   64198563,  1071820903}, {   65020620,  1071771349}, 
+	{   59265442,  1072104991}, {   60087719,  1072059220}, {   60909960,  1072012818}, {   61732166,  1071965785}, 
+	{   55975992,  1072281769}, {   56798405,  1072238521}, {   57620785,  1072194642}, {   58443131,  1072150132}, 
+	{   52686014,  1072448455}, {   53508556,  1072407730}, {   54331067,  1072366374}, {   55153545,  1072324387}, 
+	{   49395541,  1072605046}, {   50218204,  1072566845}, {   51040837,  1072528012}, {   51863441,  1072488549}, 
+	{   46104602,  1072751542}, {   46927379,  1072715864}, {   47750128,  1072679556}, {   48572848,  1072642617}, 
+	{   42813230,  1072887940}, {   43636112,  1072854787}, {   44458968,  1072821003}, {   45281799,  1072786588}, 
+	{   39521455,  1073014240}, {   40344435,  1072983612}, {   41167391,  1072952352}, {   41990323,  1072920462}, 
+	{   36229307,  1073130440}, {   37052377,  1073102337}, {   37875426,  1073073603}, {   38698452,  1073044237}, 
+	{   32936819,  1073236540}, {   33759971,  1073210962}, {   34583104,  1073184753}, {   35406216,  1073157912}, 
+	{   29644021,  1073332538}, {   30467248,  1073309485}, {   31290457,  1073285802}, {   32113647,  1073261486}, 
+	{   26350943,  1073418433}, {   27174237,  1073397906}, {   27997515,  1073376748}, {   28820776,  1073354959}, 
+	{   23057618,  1073494225}, {   23880971,  1073476224}, {   24704310,  1073457592}, {   25527634,  1073438328}, 
+	{   19764076,  1073559913}, {   20587480,  1073544438}, {   21410872,  1073528332}, {   22234252,  1073511594}, 
+	{   16470347,  1073615496}, {   17293795,  1073602547}, {   18117233,  1073588967}, {   18940660,  1073574756}, 
+	{   13176464,  1073660973}, {   13999948,  1073650551}, {   14823423,  1073639498}, {   15646890,  1073627812}, 
+	{    9882456,  1073696345}, {   10705968,  1073688450}, {   11529474,  1073679922}, {   12352972,  1073670764}, 
+	{    6588356,  1073721611}, {    7411888,  1073716242}, {    8235416,  1073710241}, {    9058939,  1073703609}, 
+	{    3294193,  1073736771}, {    4117738,  1073733928}, {    4941281,  1073730454}, {    5764820,  1073726348}, 
+	{          0,  1073741824}, {     823550,  1073741508}, {    1647099,  1073740561}, {    2470647,  1073738982}, 
+	{   -3294193,  1073736771}, {   -2470647,  1073738982}, {   -1647099,  1073740561}, {    -823550,  1073741508}, 
+	{   -6588356,  1073721611}, {   -5764820,  1073726348}, {   -4941281,  1073730454}, {   -4117738,  1073733928}, 
+	{   -9882456,  1073696345}, {   -9058939,  1073703609}, {   -8235416,  1073710241}, {   -7411888,  1073716242}, 
+	{  -13176464,  1073660973}, {  -12352972,  1073670764}, {  -11529474,  1073679922}, {  -10705968,  1073688450}, 
+	{  -16470347,  1073615496}, {  -15646890,  1073627812}, {  -14823423,  1073639498}, {  -13999948,  1073650551}, 
+	{  -19764076,  1073559913}, {  -18940660,  1073574756}, {  -18117233,  1073588967}, {  -17293795,  1073602547}, 
+	{  -23057618,  1073494225}, {  -22234252,  1073511594}, {  -21410872,  1073528332}, {  -20587480,  1073544438}, 
+	{  -26350943,  1073418433}, {  -25527634,  1073438328}, {  -24704310,  1073457592}, {  -23880971,  1073476224}, 
+	{  -29644021,  1073332538}, {  -28820776,  1073354959}, {  -27997515,  1073376748}, {  -27174237,  1073397906}, 
+	{  -32936819,  1073236540}, {  -32113647,  1073261486}, {  -31290457,  1073285802}, {  -30467248,  1073309485}, 
+	{  -36229307,  1073130440}, {  -35406216,  1073157912}, {  -34583104,  1073184753}, {  -33759971,  1073210962}, 
+	{  -39521455,  1073014240}, {  -38698452,  1073044237}, {  -37875426,  1073073603}, {  -37052377,  1073102337}, 
+	{  -42813230,  1072887940}, {  -41990323,  1072920462}, {  -41167391,  1072952352}, {  -40344435,  1072983612}, 
+	{  -46104602,  1072751542}, {  -45281799,  1072786588}, {  -44458968,  1072821003}, {  -43636112,  1072854787}, 
+	{  -49395541,  1072605046}, {  -48572848,  1072642617}, {  -47750128,  1072679556}, {  -46927379,  1072715864}, 
+	{  -52686014,  1072448455}, {  -51863441,  1072488549}, {  -51040837,  1072528012}, {  -50218204,  1072566845}, 
+	{  -55975992,  1072281769}, {  -55153545,  1072324387}, {  -54331067,  1072366374}, {  -53508556,  1072407730}, 
+	{  -59265442,  1072104991}, {  -58443131,  1072150132}, {  -57620785,  1072194642}, {  -56798405,  1072238521}, 
+	{  -62554335,  1071918122}, {  -61732166,  1071965785}, {  -60909960,  1072012818}, {  -60087719,  1072059220}, 
+	{  -65842639,  1071721163}, {  -65020620,  1071771349}, {  -64198563,  1071820903}, {  -63376468,  1071869828}, 
+	{  -69130324,  1071514117}, {  -68308462,  1071566824}, {  -67486561,  1071618901}, {  -66664620,  1071670347}, 
+	{  -72417357,  1071296985}, {  -71595661,  1071352214}, {  -70773924,  1071406812}, {  -69952144,  1071460780}, 
+	{  -75703709,  1071069770}, {  -74882187,  1071127519}, {  -74060620,  1071184638}, {  -73239010,  1071241127}, 
+	{  -78989349,  1070832474}, {  -78168007,  1070892743}, {  -77346620,  1070952382}, {  -76525187,  1071011391}, 
+	{  -82274245,  1070585099}, {  -81453092,  1070647887}, {  -80631892,  1070710046}, {  -79810644,  1070771575}, 
+	{  -85558366,  1070327646}, {  -84737410,  1070392954}, {  -83916404,  1070457632}, {  -83095349,  1070521680}, 
+	{  -88841683,  1070060120}, {  -88020931,  1070127946}, {  -87200127,  1070195142}, {  -86379272,  1070261709}, 
+	{  -92124163,  1069782521}, {  -91303623,  1069852865}, {  -90483029,  1069922579}, {  -89662382,  1069991664}, 
+	{  -95405776,  1069494854}, {  -94585455,  1069567715}, {  -93765079,  1069639946}, {  -92944648,  1069711548}, 
+	{  -98686491,  1069197120}, {  -97866398,  1069272497}, {  -97046247,  1069347245}, {  -96226040,  1069421364}, 
+	{ -101966277,  1068889322}, { -101146419,  1068967215}, { -100326502,  1069044479}, {  -99506525,  1069121114}, 
+	{ -105245103,  1068571464}, { -104425488,  1068651871}, { -103605812,  1068731650}, { -102786074,  1068810801}, 
+	{ -108522939,  1068243547}, { -107703574,  1068326469}, { -106884147,  1068408763}, { -106064656,  1068490427}, 
+	{ -111799753,  1067905576}, { -110980647,  1067991011}, { -110161476,  1068075818}, { -109342239,  1068159997}, 
+	{ -115075515,  1067557554}, { -114256675,  1067645501}, { -113437768,  1067732821}, { -112618793,  1067819513}, 
+	{ -118350194,  1067199483}, { -117531627,  1067289942}, { -116712992,  1067379774}, { -115894288,  1067468978}, 
+	{ -121623759,  1066831367}, { -120805474,  1066924338}, { -119987118,  1067016680}, { -119168691,  1067108396}, 
+	{ -124896179,  1066453210}, { -124078183,  1066548690}, { -123260114,  1066643544}, { -122441972,  1066737769}, 
+	{ -128167423,  1066065015}, { -127349724,  1066163005}, { -126531950,  1066260367}, { -125714101,  1066357102}, 
+	{ -131437462,  1065666786}, { -130620067,  1065767284}, { -129802595,  1065867154}, { -128985047,  1065966398}, 
+	{ -134706263,  1065258526}, { -133889180,  1065361531}, { -133072019,  1065463909}, { -132254779,  1065565661}, 
+	{ -137973796,  1064840240}, { -137157033,  1064945751}, { -136340190,  1065050636}, { -135523266,  1065154894}, 
+	{ -141240030,  1064411931}, { -140423595,  1064519947}, { -139607077,  1064627338}, { -138790477,  1064734102}, 
+	{ -144504935,  1063973603}, { -143688835,  1064084124}, { -142872651,  1064194019}, { -142056382,  1064303288}, 
+	{ -147768480,  1063525261}, { -146952723,  1063638285}, { -146136880,  1063750684}, { -145320950,  1063862456}, 
+	{ -151030634,  1063066909}, { -150215228,  1063182435}, { -149399733,  1063297336}, { -148584150,  1063411611}, 
+	{ -154291367,  1062598550}, { -153476319,  1062716578}, { -152661180,  1062833980}, { -151845952,  1062950757}, 
+	{ -157550647,  1062120190}, { -156735965,  1062240717}, { -155921191,  1062360620}, { -155106324,  1062479898}, 
+	{ -160808445,  1061631833}, { -159994136,  1061754859}, { -159179733,  1061877261}, { -158365237,  1061999038}, 
+	{ -164064728,  1061133483}, { -163250801,  1061259007}, { -162436778,  1061383907}, { -161622659,  1061508182}, 
+	{ -167319468,  1060625146}, { -166505929,  1060753166}, { -165692293,  1060880563}, { -164878559,  1061007335}, 
+	{ -170572633,  1060106826}, { -169759491,  1060237341}, { -168946249,  1060367233}, { -168132908,  1060496502}, 
+	{ -173824192,  1059578527}, { -173011454,  1059711537}, { -172198615,  1059843923}, { -171385674,  1059975686}, 
+	{ -177074115,  1059040255}, { -176261789,  1059175758}, { -175449360,  1059310638}, { -174636827,  1059444894}, 
+	{ -180322371,  1058492016}, { -179510465,  1058630010}, { -178698453,  1058767381}, { -177886336,  1058904130}, 
+	{ -183568930,  1057933813}, { -182757451,  1058074297}, { -181945865,  1058214159}, { -181134171,  1058353399}, 
+	{ -186813762,  1057365653}, { -186002717,  1057508626}, { -185191564,  1057650977}, { -184380301,  1057792706}, 
+	{ -190056834,  1056787540}, { -189246233,  1056933001}, { -188435520,  1057077840}, { -187624696,  1057222057}, 
+	{ -193298119,  1056199480}, { -192487967,  1056347427}, { -191677702,  1056494753}, { -190867324,  1056641457}, 
+	{ -196537583,  1055601479}, { -195727889,  1055751911}, { -194918080,  1055901722}, { -194108156,  1056050912}, 
+	{ -199775198,  1054993543}, { -198965969,  1055146458}, { -198156624,  1055298753}, { -197347161,  1055450426}, 
+	{ -203010932,  1054375676}, { -202202177,  1054531073}, { -201393302,  1054685850}, { -200584309,  1054840007}, 
+	{ -206244756,  1053747885}, { -205436481,  1053905763}, { -204628085,  1054063021}, { -203819569,  1054219658}, 
+	{ -209476638,  1053110176}, { -208668851,  1053270533}, { -207860942,  1053430270}, { -207052910,  1053589387}, 
+	{ -212706549,  1052462555}, { -211899258,  1052625389}, { -211091842,  1052787604}, { -210284302,  1052949200}, 
+	{ -215934457,  1051805027}, { -215127670,  1051970337}, { -214320755,  1052135029}, { -213513715,  1052299101}, 
+	{ -219160334,  1051137599}, { -218354057,  1051305384}, { -217547651,  1051472550}, { -216741118,  1051639098}, 
+	{ -222384147,  1050460278}, { -221578389,  1050630536}, { -220772500,  1050800175}, { -219966481,  1050969196}, 
+	{ -225605867,  1049773069}, { -224800635,  1049945798}, { -223995270,  1050117909}, { -223189774,  1050289403}, 
+	{ -228825464,  1049075980}, { -228020765,  1049251178}, { -227215933,  1049425759}, { -226410966,  1049599723}, 
+	{ -232042906,  1048369016}, { -231238749,  1048546683}, { -230434456,  1048723732}, { -229630027,  1048900165}, 
+	{ -235258165,  1047652185}, { -234454557,  1047832317}, { -233650811,  1048011834}, { -232846927,  1048190733}, 
+	{ -238471210,  1046925492}, { -237668158,  1047108090}, { -236864966,  1047290071}, { -236061635,  1047471436}, 
+	{ -241682010,  1046188946}, { -240879522,  1046374006}, { -240076892,  1046558451}, { -239274121,  1046742279}, 
+	{ -244890535,  1045442553}, { -244088618,  1045630074}, { -243286558,  1045816980}, { -242484355,  1046003271}, 
+	{ -248096755,  1044686319}, { -247295417,  1044876299}, { -246493935,  1045065665}, { -245692307,  1045254416}, 
+	{ -251300640,  1043920252}, { -250499889,  1044112690}, { -249698991,  1044304514}, { -248897946,  1044495724}, 
+	{ -254502159,  1043144360}, { -253702003,  1043339254}, { -252901697,  1043533534}, { -252101242,  1043727200}, 
+	{ -257701283,  1042358649}, { -256901728,  1042555997}, { -256102022,  1042752731}, { -255302166,  1042948852}, 
+	{ -260897982,  1041563127}, { -260099036,  1041762927}, { -259299937,  1041962114}, { -258500686,  1042160688}, 
+	{ -264092224,  1040757802}, { -263293896,  1040960052}, { -262495412,  1041161689}, { -261696774,  1041362715}, 
+	{ -267283981,  1039942680}, { -266486277,  1040147378}, { -265688415,  1040351465}, { -264890398,  1040554939}, 
+	{ -270473223,  1039117770}, { -269676150,  1039324915}, { -268878918,  1039531448}, { -268081529,  1039737370}, 
+	{ -273659918,  1038283080}, { -272863485,  1038492669}, { -272066891,  1038701647}, { -271270136,  1038910014}, 
+	{ -276844038,  1037438617}, { -276048251,  1037650648}, { -275252302,  1037862069}, { -274456191,  1038072880}, 
+	{ -280025552,  1036584389}, { -279230419,  1036798861}, { -278435122,  1037012723}, { -277639662,  1037225975}, 
+	{ -283204430,  1035720404}, { -282409959,  1035937314}, { -281615322,  1036153615}, { -280820520,  1036369307}, 
+	{ -286380643,  1034846671}, { -285586841,  1035066018}, { -284792871,  1035284755}, { -283998734,  1035502884}, 
+	{ -289554160,  1033963197}, { -288761035,  1034184978}, { -287967740,  1034406151}, { -287174276,  1034626715}, 
+	{ -292724951,  1033069992}, { -291932511,  1033294205}, { -291139898,  1033517810}, { -290347114,  1033740808}, 
+	{ -295892988,  1032167062}, { -295101239,  1032393706}, { -294309316,  1032619742}, { -293517220,  1032845170}, 
+	{ -299058239,  1031254418}, { -298267189,  1031483489}, { -297475964,  1031711954}, { -296684563,  1031939812}, 
+	{ -302220676,  1030332067}, { -301430332,  1030563564}, { -300639811,  1030794455}, { -299849113,  1031024740}, 
+	{ -305380268,  1029400018}, { -304590638,  1029633939}, { -303800829,  1029867254}, { -303010842,  1030099963}, 
+	{ -308536985,  1028458280}, { -307748077,  1028694622}, { -306958988,  1028930359}, { -306169718,  1029165491}, 
+	{ -311690799,  1027506862}, { -310902619,  1027745623}, { -310114257,  1027983780}, { -309325712,  1028221332}, 
+	{ -314841679,  1026545772}, { -314054235,  1026786951}, { -313266607,  1027027525}, { -312478795,  1027267495}, 
+	{ -317989595,  1025575020}, { -317202895,  1025818614}, { -316416009,  1026061603}, { -315628937,  1026303990}, 
+	{ -321134518,  1024594615}, { -320348570,  1024840621}, { -319562433,  1025086024}, { -318776108,  1025330824}, 
+	{ -324276419,  1023604567}, { -323491229,  1023852982}, { -322705848,  1024100796}, { -321920278,  1024348007}, 
+	{ -327415267,  1022604883}, { -326630843,  1022855707}, { -325846226,  1023105929}, { -325061418,  1023355549}, 
+	{ -330551034,  1021595575}, { -329767383,  1021848804}, { -328983538,  1022101432}, { -328199499,  1022353458}, 
+	{ -333683689,  1020576651}, { -332900819,  1020832283}, { -332117752,  1021087314}, { -331334491,  1021341745}, 
+	{ -336813204,  1019548121}, { -336031121,  1019806153}, { -335248841,  1020063586}, { -334466364,  1020320418}, 
+	{ -339939549,  1018509994}, { -339158261,  1018770425}, { -338376774,  1019030256}, { -337595089,  1019289488}, 
+	{ -343062693,  1017462281}, { -342282209,  1017725107}, { -341501523,  1017987335}, { -340720636,  1018248964}, 
+	{ -346182609,  1016404991}, { -345402934,  1016670211}, { -344623057,  1016934832}, { -343842976,  1017198856}, 
+	{ -349299266,  1015338134}, { -348520409,  1015605745}, { -347741347,  1015872758}, { -346962080,  1016139173}, 
+	{ -352412636,  1014261721}, { -351634604,  1014531720}, { -350856364,  1014801122}, { -350077918,  1015069927}, 
+	{ -355522689,  1013175761}, { -354745488,  1013448145}, { -353968079,  1013719934}, { -353190461,  1013991126}, 
+	{ -358629395,  1012080264}, { -357853034,  1012355032}, { -357076462,  1012629204}, { -356299680,  1012902780}, 
+	{ -361732726,  1010975242}, { -360957211,  1011252390}, { -360181484,  1011528943}, { -359405545,  1011804901}, 
+	{ -364832652,  1009860704}, { -364057991,  1010140230}, { -363283116,  1010419162}, { -362508027,  1010697499}, 
+	{ -367929144,  1008736660}, { -367155344,  1009018562}, { -366381329,  1009299870}, { -365607098,  1009580584}, 
+	{ -371022173,  1007603122}, { -370249242,  1007887396}, { -369476093,  1008171077}, { -368702727,  1008454166}, 
+	{ -374111709,  1006460100}, { -373339654,  1006746744}, { -372567379,  1007032796}, { -371794885,  1007318256}, 
+	{ -377197725,  1005307605}, { -376426553,  1005596617}, { -375655159,  1005885036}, { -374883544,  1006172864}, 
+	{ -380280190,  1004145648}, { -379509908,  1004437024}, { -378739403,  1004727809}, { -377968675,  1005018003}, 
+	{ -383359076,  1002974239}, { -382589691,  1003267977}, { -381820082,  1003561124}, { -381050248,  1003853681}, 
+	{ -386434353,  1001793390}, { -385665873,  1002089486}, { -384897167,  1002384994}, { -384128234,  1002679911}, 
+	{ -389505993,  1000603111}, { -388738426,  1000901564}, { -387970630,  1001199428}, { -387202605,  1001496704}, 
+	{ -392573967,   999403415}, { -391807319,   999704221}, { -391040440,  1000004439}, { -390273331,  1000304069}, 
+	{ -395638246,   998194311}, { -394872524,   998497468}, { -394106570,   998800038}, { -393340384,   999102020}, 
+	{ -398698801,   996975812}, { -397934013,   997281317}, { -397168991,   997586236}, { -396403735,   997890567}, 
+	{ -401755603,   995747930}, { -400991756,   996055780}, { -400227673,   996363043}, { -399463355,   996669721}, 
+	{ -404808624,   994510675}, { -404045725,   994820867}, { -403282588,   995130473}, { -402519214,   995439494}, 
+	{ -407857835,   993264059}, { -407095891,   993576590}, { -406333708,   993888536}, { -405571285,   994199898}, 
+	{ -410903207,   992008094}, { -410142225,   992322961}, { -409381002,   992637245}, { -408619539,   992950944}, 
+	{ -413944711,   990742793}, { -413184699,   991059993}, { -412424444,   991376610}, { -411663946,   991692644}, 
+	{ -416982319,   989468165}, { -416223284,   989787696}, { -415464004,   990106644}, { -414704479,   990425010}, 
+	{ -420016002,   988184225}, { -419257951,   988506083}, { -418499653,   988827359}, { -417741109,   989148053}, 
+	{ -423045732,   986890984}, { -422288671,   987215165}, { -421531363,   987538766}, { -420773806,   987861786}, 
+	{ -426071480,   985588453}, { -425315418,   985914956}, { -424559105,   986240879}, { -423802543,   986566221}, 
+	{ -429093217,   984276646}, { -428338160,   984605467}, { -427582852,   984933708}, { -426827291,   985261370}, 
+	{ -432110916,   982955574}, { -431356872,   983286710}, { -430602573,   983617267}, { -429848022,   983947246}, 
+	{ -435124548,   981625251}, { -434371523,   981958698}, { -433618242,   982291568}, { -432864706,   982623860}, 
+	{ -438134084,   980285688}, { -437382085,   980621444}, { -436629829,   980956623}, { -435877317,   981291226}, 
+	{ -441139496,   978936898}, { -440388531,   979274960}, { -439637307,   979612445}, { -438885824,   979949355}, 
+	{ -444140756,   977578894}, { -443390832,   977919258}, { -442640647,   978259047}, { -441890201,   978598260}, 
+	{ -447137835,   976211688}, { -446388959,   976554352}, { -445639820,   976896441}, { -444890419,   977237955}, 
+	{ -450130706,   974835295}, { -449382885,   975180254}, { -448634799,   975524639}, { -447886449,   975868451}, 
+	{ -453119340,   973449725}, { -452372581,   973796977}, { -451625555,   974143656}, { -450878263,   974489762}, 
+	{ -456103710,   972054994}, { -455358019,   972404535}, { -454612060,   972753504}, { -453865834,   973101901}, 
+	{ -459083786,   970651112}, { -458339171,   971002940}, { -457594286,   971354196}, { -456849132,   971704881}, 
+	{ -462059541,   969238095}, { -461316009,   969592205}, { -460572205,   969945745}, { -459828131,   970298714}, 
+	{ -465030947,   967815955}, { -464288505,   968172345}, { -463545789,   968528165}, { -462802801,   968883415}, 
+	{ -467997976,   966384706}, { -467256631,   966743371}, { -466515010,   967101468}, { -465773116,   967458996}, 
+	{ -470960600,   964944360}, { -470220358,   965305298}, { -469479840,   965665669}, { -468739046,   966025471}, 
+	{ -473918791,   963494932}, { -473179660,   963858140}, { -472440251,   964220780}, { -471700564,   964582854}, 
+	{ -476872522,   962036435}, { -476134509,   962401909}, { -475396216,   962766816}, { -474657643,   963131157}, 
+	{ -479821764,   960568883}, { -479084875,   960936620}, { -478347705,   961303790}, { -477610254,   961670396}, 
+	{ -482766489,   959092290}, { -482030733,   959462286}, { -481294693,   959831716}, { -480558369,   960200582}, 
+	{ -485706671,   957606670}, { -484972053,   957978921}, { -484237150,   958350608}, { -483501962,   958721731}, 
+	{ -488642281,   956112036}, { -487908809,   956486539}, { -487175049,   956860479}, { -486441003,   957233856}, 
+	{ -491573292,   954608403}, { -490840972,   954985154}, { -490108363,   955361344}, { -489375466,   955736971}, 
+	{ -494499676,   953095785}, { -493768515,   953474781}, { -493037064,   953853216}, { -492305322,   954231090}, 
+	{ -497421405,   951574196}, { -496691410,   951955434}, { -495961124,   952336111}, { -495230545,   952716228}, 
+	{ -500338453,   950043650}, { -499609631,   950427126}, { -498880516,   950810042}, { -498151107,   951192399}, 
+	{ -503250791,   948504163}, { -502523149,   948889872}, { -501795212,   949275023}, { -501066980,   949659616}, 
+	{ -506158392,   946955747}, { -505431937,   947343687}, { -504705185,   947731070}, { -503978136,   948117895}, 
+	{ -509061229,   945398418}, { -508335968,   945788585}, { -507610408,   946178196}, { -506884549,   946567250}, 
+	{ -511959275,   943832191}, { -511235214,   944224582}, { -510510853,   944616416}, { -509786191,   945007695}, 
+	{ -514852502,   942257081}, { -514129648,   942651690}, { -513406493,   943045745}, { -512683035,   943439246}, 
+	{ -517740883,   940673101}, { -517019243,   941069926}, { -516297300,   941466198}, { -515575053,   941861917}, 
+	{ -520624391,   939080267}, { -519903972,   939479305}, { -519183248,   939877790}, { -518462218,   940275722}, 
+	{ -523502998,   937478595}, { -522783807,   937879841}, { -522064309,   938280535}, { -521344503,   938680677}, 
+	{ -526376678,   935868098}, { -525658722,   936271549}, { -524940456,   936674448}, { -524221881,   937076797}, 
+	{ -529245404,   934248793}, { -528528689,   934654444}, { -527811662,   935059546}, { -527094325,   935464097}, 
+	{ -532109148,   932620694}, { -531393681,   933028542}, { -530677900,   933435842}, { -529961808,   933842592}, 
+	{ -534967884,   930983817}, { -534253671,   931393859}, { -533539144,   931803352}, { -532824303,   932212297}, 
+	{ -537821584,   929338177}, { -537108633,   929750408}, { -536395365,   930162092}, { -535681782,   930573228}, 
+	{ -540670223,   927683790}, { -539958539,   928098206}, { -539246538,   928512076}, { -538534220,   928925400}, 
+	{ -543513772,   926020672}, { -542803363,   926437269}, { -542092635,   926853322}, { -541381588,   927268829}, 
+	{ -546352205,   924348837}, { -545643078,   924767612}, { -544933630,   925185843}, { -544223861,   925603530}, 
+	{ -549185496,   922668302}, { -548477657,   923089250}, { -547769495,   923509656}, { -547061011,   923929518}, 
+	{ -552013618,   920979082}, { -551307074,   921402200}, { -550600205,   921824777}, { -549893013,   922246810}, 
+	{ -554836544,   919281194}, { -554131301,   919706478}, { -553425732,   920131221}, { -552719838,   920555422}, 
+	{ -557654248,   917574653}, { -556950313,   918002099}, { -556246051,   918429004}, { -555541461,   918855369}, 
+	{ -560466703,   915859476}, { -559764083,   916289079}, { -559061133,   916718143}, { -558357855,   917146668}, 
+	{ -563273883,   914135678}, { -562572584,   914567435}, { -561870954,   914998653}, { -561168994,   915429334}, 
+	{ -566075761,   912403276}, { -565375790,   912837182}, { -564675486,   913270551}, { -563974850,   913703383}, 
+	{ -568872310,   910662286}, { -568173674,   911098338}, { -567474703,   911533853}, { -566775399,   911968833}, 
+	{ -571663506,   908912725}, { -570966210,   909350918}, { -570268579,   909788576}, { -569570612,   910225699}, 
+	{ -574449320,   907154608}, { -573753372,   907594938}, { -573057087,   908034735}, { -572360465,   908473997}, 
+	{ -577229728,   905387953}, { -576535134,   905830417}, { -575840202,   906272347}, { -575144930,   906713744}, 
+	{ -580004702,   903612776}, { -579311470,   904057369}, { -578617896,   904501429}, { -577923982,   904944957}, 
+	{ -582774218,   901829095}, { -582082352,   902275811}, { -581390144,   902721998}, { -580697594,   903167653}, 
+	{ -585538248,   900036924}, { -584847756,   900485762}, { -584156920,   900934069}, { -583465740,   901381847}, 
+	{ -588296766,   898236282}, { -587607655,   898687236}, { -586918198,   899137661}, { -586228395,   899587557}, 
+	{ -591049748,   896427186}, { -590362023,   896880252}, { -589673951,   897332790}, { -588985532,   897784800}, 
+	{ -593797166,   894609652}, { -593110835,   895064826}, { -592424154,   895519473}, { -591737125,   895973593}, 
+	{ -596538995,   892783698}, { -595854063,   893240975}, { -595168781,   893697727}, { -594483148,   894153953}, 
+	{ -599275210,   890949341}, { -598591684,   891408717}, { -597907806,   891867569}, { -597223576,   892325896}, 
+	{ -602005783,   889106597}, { -601323670,   889568068}, { -600641203,   890029016}, { -599958383,   890489440}, 
+	{ -604730691,   887255485}, { -604049997,   887719047}, { -603368947,   888182086}, { -602687543,   888644603}, 
+	{ -607449906,   885396022}, { -606770638,   885861670}, { -606091012,   886326796}, { -605411029,   886791402}, 
+	{ -610163404,   883528225}, { -609485567,   883995955}, { -608807372,   884463164}, { -608128818,   884929853}, 
+	{ -612871159,   881652112}, { -612194760,   882121919}, { -611518001,   882591207}, { -610840882,   883059976}, 
+	{ -615573145,   879767701}, { -614898191,   880239581}, { -614222875,   880710943}, { -613547198,   881181787}, 
+	{ -618269338,   877875009}, { -617595834,   878348957}, { -616921967,   878822389}, { -616247738,   879295303}, 
+	{ -620959711,   875974054}, { -620287664,   876450066}, { -619615253,   876925563}, { -618942478,   877400544}, 
+	{ -623644239,   874064853}, { -622973656,   874542925}, { -622302707,   875020483}, { -621631392,   875497526}, 
+	{ -626322897,   872147426}, { -625653784,   872627553}, { -624984303,   873107167}, { -624314455,   873586267}, 
+	{ -628995660,   870221790}, { -628328023,   870703968}, { -627660017,   871185633}, { -626991641,   871666786}, 
+	{ -631662503,   868287963}, { -630996348,   868772187}, { -630329823,   869255900}, { -629662927,   869739101}, 
+	{ -634323400,   866345964}, { -633658734,   866832229}, { -632993696,   867317984}, { -632328285,   867803229}, 
+	{ -636978327,   864395810}, { -636315156,   864884112}, { -635651611,   865371905}, { -634987692,   865859189}, 
+	{ -639627258,   862437520}, { -638965588,   862927854}, { -638303543,   863417681}, { -637641122,   863906999}, 
+	{ -642270169,   860471112}, { -641610007,   860963474}, { -640949467,   861455330}, { -640288551,   861946678}, 
+	{ -644907034,   858496606}, { -644248386,   858990991}, { -643589359,   859484870}, { -642929953,   859978244}, 
+	{ -647537830,   856514019}, { -646880701,   857010422}, { -646223192,   857506321}, { -645565303,   858001716}, 
+	{ -650162530,   854523370}, { -649506928,   855021787}, { -648850943,   855519701}, { -648194577,   856017111}, 
+	{ -652781111,   852524677}, { -652127041,   853025104}, { -651472587,   853525028}, { -650817750,   854024450}, 
+	{ -655393548,   850517961}, { -654741016,   851020391}, { -654088099,   851522321}, { -653434797,   852023750}, 
+	{ -657999816,   848503239}, { -657348828,   849007669}, { -656697454,   849511600}, { -656045694,   850015030}, 
+	{ -660599890,   846480531}, { -659950454,   846986956}, { -659300629,   847492882}, { -658650416,   847998310}, 
+	{ -663193747,   844449856}, { -662545867,   844958270}, { -661897597,   845466188}, { -661248938,   845973608}, 
+	{ -665781362,   842411232}, { -665135044,   842921632}, { -664488336,   843431536}, { -663841237,   843940944}, 
+	{ -668362709,   840364679}, { -667717961,   840877059}, { -667072820,   841388945}, { -666427287,   841900336}, 
+	{ -670937767,   838310216}, { -670294593,   838824572}, { -669651026,   839338435}, { -669007064,   839851804}, 
+	{ -673506508,   836247863}, { -672864916,   836764190}, { -672222928,   837280024}, { -671580545,   837795367}, 
+	{ -676068911,   834177638}, { -675428906,   834695931}, { -674788504,   835213733}, { -674147704,   835731044}, 
+	{ -678624950,   832099562}, { -677986538,   832619816}, { -677347728,   833139580}, { -676708518,   833658855}, 
+	{ -681174602,   830013654}, { -680537789,   830535864}, { -679900576,   831057586}, { -679262963,   831578819}, 
+	{ -683717842,   827919934}, { -683082635,   828444095}, { -682447025,   828967769}, { -681811014,   829490956}, 
+	{ -686254647,   825818421}, { -685621051,   826344528}, { -684987051,   826870150}, { -684352648,   827395285}, 
+	{ -688784993,   823709135}, { -688153013,   824237184}, { -687520629,   824764748}, { -686887840,   825291827}, 
+	{ -691308855,   821592095}, { -690678499,   822122081}, { -690047736,   822651583}, { -689416567,   823180601}, 
+	{ -693826211,   819467323}, { -693197483,   819999240}, { -692568348,   820530675}, { -691938805,   821061627}, 
+	{ -696337036,   817334838}, { -695709943,   817868681}, { -695082441,   818402043}, { -694454530,   818934924}, 
+	{ -698841307,   815194659}, { -698215855,   815730424}, { -697589992,   816265709}, { -696963719,   816800514}, 
+	{ -701339000,   813046808}, { -700715194,   813584489}, { -700090977,   814121692}, { -699466348,   814658415}, 
+	{ -703830092,   810891304}, { -703207939,   811430896}, { -702585372,   811970011}, { -701962393,   812508649}, 
+	{ -706314559,   808728167}, { -705694064,   809269666}, { -705073155,   809810688}, { -704451830,   810351235}, 
+	{ -708792378,   806557419}, { -708173547,   807100819}, { -707554301,   807643743}, { -706934638,   808186193}, 
+	{ -711263525,   804379079}, { -710646365,   804924374}, { -710028787,   805469196}, { -709410791,   806013545}, 
+	{ -713727978,   802193167}, { -713112494,   802740354}, { -712496590,   803287068}, { -711880267,   803833310}, 
+	{ -716185713,   799999706}, { -715571910,   800548778}, { -714957687,   801097379}, { -714343043,   801645509}, 
+	{ -718636707,   797798714}, { -718024592,   798349667}, { -717412054,   798900150}, { -716799095,   799450163}, 
+	{ -721080937,   795590213}, { -720470515,   796143041}, { -719859669,   796695401}, { -719248400,   797247292}, 
+	{ -723518380,   793374223}, { -722909657,   793928922}, { -722300508,   794483153}, { -721690935,   795036917}, 
+	{ -725949013,   791150767}, { -725341994,   791707330}, { -724734549,   792263427}, { -724126677,   792819059}, 
+	{ -728372813,   788919863}, { -727767504,   789478286}, { -727161768,   790036244}, { -726555604,   790593738}, 
+	{ -730789757,   786681534}, { -730186165,   787241811}, { -729582143,   787801625}, { -728977692,   788360976}, 
+	{ -733199822,   784435800}, { -732597952,   784997927}, { -731995651,   785559591}, { -731392919,   786120794}, 
+	{ -735602987,   782182683}, { -735002844,   782746654}, { -734402269,   783310163}, { -733801261,   783873212}, 
+	{ -737999228,   779922204}, { -737400818,   780488013}, { -736801974,   781053363}, { -736202697,   781618253}, 
+	{ -740388522,   777654384}, { -739791851,   778222026}, { -739194745,   778789210}, { -738597203,   779355936}, 
+	{ -742770848,   775379244}, { -742175921,   775948714}, { -741580558,   776517728}, { -740984758,   777086284}, 
+	{ -745146182,   773096806}, { -744553005,   773668099}, { -743959390,   774238936}, { -743365338,   774809318}, 
+	{ -747514503,   770807092}, { -746923082,   771380201}, { -746331221,   771952857}, { -745738921,   772525059}, 
+	{ -749875788,   768510122}, { -749286127,   769085043}, { -748696026,   769659512}, { -748105485,   770233528}, 
+	{ -752230015,   766205919}, { -751642121,   766782646}, { -751053785,   767358923}, { -750465007,   767934748}, 
+	{ -754577161,   763894504}, { -753991040,   764473032}, { -753404474,   765051111}, { -752817466,   765628740}, 
+	{ -756917205,   761575898}, { -756332861,   762156223}, { -755748072,   762736098}, { -755162839,   763315525}, 
+	{ -759250125,   759250125}, { -758667564,   759832239}, { -758084557,   760413906}, { -757501104,   760995126}, 
+	{ -761575898,   756917205}, { -760995126,   757501104}, { -760413906,   758084557}, { -759832239,   758667564}, 
+	{ -763894504,   754577161}, { -763315525,   755162839}, { -762736098,   755748072}, { -762156223,   756332861}, 
+	{ -766205919,   752230015}, { -765628740,   752817466}, { -765051111,   753404474}, { -764473032,   753991040}, 
+	{ -768510122,   749875788}, { -767934748,   750465007}, { -767358923,   751053785}, { -766782646,   751642121}, 
+	{ -770807092,   747514503}, { -770233528,   748105485}, { -769659512,   748696026}, { -769085043,   749286127}, 
+	{ -773096806,   745146182}, { -772525059,   745738921}, { -771952857,   746331221}, { -771380201,   746923082}, 
+	{ -775379244,   742770848}, { -774809318,   743365338}, { -774238936,   743959390}, { -773668099,   744553005}, 
+	{ -777654384,   740388522}, { -777086284,   740984758}, { -776517728,   741580558}, { -775948714,   742175921}, 
+	{ -779922204,   737999228}, { -779355936,   738597203}, { -778789210,   739194745}, { -778222026,   739791851}, 
+	{ -782182683,   735602987}, { -781618253,   736202697}, { -781053363,   736801974}, { -780488013,   737400818}, 
+	{ -784435800,   733199822}, { -783873212,   733801261}, { -783310163,   734402269}, { -782746654,   735002844}, 
+	{ -786681534,   730789757}, { -786120794,   731392919}, { -785559591,   731995651}, { -784997927,   732597952}, 
+	{ -788919863,   728372813}, { -788360976,   728977692}, { -787801625,   729582143}, { -787241811,   730186165}, 
+	{ -791150767,   725949013}, { -790593738,   726555604}, { -790036244,   727161768}, { -789478286,   727767504}, 
+	{ -793374223,   723518380}, { -792819059,   724126677}, { -792263427,   724734549}, { -791707330,   725341994}, 
+	{ -795590213,   721080937}, { -795036917,   721690935}, { -794483153,   722300508}, { -793928922,   722909657}, 
+	{ -797798714,   718636707}, { -797247292,   719248400}, { -796695401,   719859669}, { -796143041,   720470515}, 
+	{ -799999706,   716185713}, { -799450163,   716799095}, { -798900150,   717412054}, { -798349667,   718024592}, 
+	{ -802193167,   713727978}, { -801645509,   714343043}, { -801097379,   714957687}, { -800548778,   715571910}, 
+	{ -804379079,   711263525}, { -803833310,   711880267}, { -803287068,   712496590}, { -802740354,   713112494}, 
+	{ -806557419,   708792378}, { -806013545,   709410791}, { -805469196,   710028787}, { -804924374,   710646365}, 
+	{ -808728167,   706314559}, { -808186193,   706934638}, { -807643743,   707554301}, { -807100819,   708173547}, 
+	{ -810891304,   703830092}, { -810351235,   704451830}, { -809810688,   705073155}, { -809269666,   705694064}, 
+	{ -813046808,   701339000}, { -812508649,   701962393}, { -811970011,   702585372}, { -811430896,   703207939}, 
+	{ -815194659,   698841307}, { -814658415,   699466348}, { -814121692,   700090977}, { -813584489,   700715194}, 
+	{ -817334838,   696337036}, { -816800514,   696963719}, { -816265709,   697589992}, { -815730424,   698215855}, 
+	{ -819467323,   693826211}, { -818934924,   694454530}, { -818402043,   695082441}, { -817868681,   695709943}, 
+	{ -821592095,   691308855}, { -821061627,   691938805}, { -820530675,   692568348}, { -819999240,   693197483}, 
+	{ -823709135,   688784993}, { -823180601,   689416567}, { -822651583,   690047736}, { -822122081,   690678499}, 
+	{ -825818421,   686254647}, { -825291827,   686887840}, { -824764748,   687520629}, { -824237184,   688153013}, 
+	{ -827919934,   683717842}, { -827395285,   684352648}, { -826870150,   684987051}, { -826344528,   685621051}, 
+	{ -830013654,   681174602}, { -829490956,   681811014}, { -828967769,   682447025}, { -828444095,   683082635}, 
+	{ -832099562,   678624950}, { -831578819,   679262963}, { -831057586,   679900576}, { -830535864,   680537789}, 
+	{ -834177638,   676068911}, { -833658855,   676708518}, { -833139580,   677347728}, { -832619816,   677986538}, 
+	{ -836247863,   673506508}, { -835731044,   674147704}, { -835213733,   674788504}, { -834695931,   675428906}, 
+	{ -838310216,   670937767}, { -837795367,   671580545}, { -837280024,   672222928}, { -836764190,   672864916}, 
+	{ -840364679,   668362709}, { -839851804,   669007064}, { -839338435,   669651026}, { -838824572,   670294593}, 
+	{ -842411232,   665781362}, { -841900336,   666427287}, { -841388945,   667072820}, { -840877059,   667717961}, 
+	{ -844449856,   663193747}, { -843940944,   663841237}, { -843431536,   664488336}, { -842921632,   665135044}, 
+	{ -846480531,   660599890}, { -845973608,   661248938}, { -845466188,   661897597}, { -844958270,   662545867}, 
+	{ -848503239,   657999816}, { -847998310,   658650416}, { -847492882,   659300629}, { -846986956,   659950454}, 
+	{ -850517961,   655393548}, { -850015030,   656045694}, { -849511600,   656697454}, { -849007669,   657348828}, 
+	{ -852524677,   652781111}, { -852023750,   653434797}, { -851522321,   654088099}, { -851020391,   654741016}, 
+	{ -854523370,   650162530}, { -854024450,   650817750}, { -853525028,   651472587}, { -853025104,   652127041}, 
+	{ -856514019,   647537830}, { -856017111,   648194577}, { -855519701,   648850943}, { -855021787,   649506928}, 
+	{ -858496606,   644907034}, { -858001716,   645565303}, { -857506321,   646223192}, { -857010422,   646880701}, 
+	{ -860471112,   642270169}, { -859978244,   642929953}, { -859484870,   643589359}, { -858990991,   644248386}, 
+	{ -862437520,   639627258}, { -861946678,   640288551}, { -861455330,   640949467}, { -860963474,   641610007}, 
+	{ -864395810,   636978327}, { -863906999,   637641122}, { -863417681,   638303543}, { -862927854,   638965588}, 
+	{ -866345964,   634323400}, { -865859189,   634987692}, { -865371905,   635651611}, { -864884112,   636315156}, 
+	{ -868287963,   631662503}, { -867803229,   632328285}, { -867317984,   632993696}, { -866832229,   633658734}, 
+	{ -870221790,   628995660}, { -869739101,   629662927}, { -869255900,   630329823}, { -868772187,   630996348}, 
+	{ -872147426,   626322897}, { -871666786,   626991641}, { -871185633,   627660017}, { -870703968,   628328023}, 
+	{ -874064853,   623644239}, { -873586267,   624314455}, { -873107167,   624984303}, { -872627553,   625653784}, 
+	{ -875974054,   620959711}, { -875497526,   621631392}, { -875020483,   622302707}, { -874542925,   622973656}, 
+	{ -877875009,   618269338}, { -877400544,   618942478}, { -876925563,   619615253}, { -876450066,   620287664}, 
+	{ -879767701,   615573145}, { -879295303,   616247738}, { -878822389,   616921967}, { -878348957,   617595834}, 
+	{ -881652112,   612871159}, { -881181787,   613547198}, { -880710943,   614222875}, { -880239581,   614898191}, 
+	{ -883528225,   610163404}, { -883059976,   610840882}, { -882591207,   611518001}, { -882121919,   612194760}, 
+	{ -885396022,   607449906}, { -884929853,   608128818}, { -884463164,   608807372}, { -883995955,   609485567}, 
+	{ -887255485,   604730691}, { -886791402,   605411029}, { -886326796,   606091012}, { -885861670,   606770638}, 
+	{ -889106597,   602005783}, { -888644603,   602687543}, { -888182086,   603368947}, { -887719047,   604049997}, 
+	{ -890949341,   599275210}, { -890489440,   599958383}, { -890029016,   600641203}, { -889568068,   601323670}, 
+	{ -892783698,   596538995}, { -892325896,   597223576}, { -891867569,   597907806}, { -891408717,   598591684}, 
+	{ -894609652,   593797166}, { -894153953,   594483148}, { -893697727,   595168781}, { -893240975,   595854063}, 
+	{ -896427186,   591049748}, { -895973593,   591737125}, { -895519473,   592424154}, { -895064826,   593110835}, 
+	{ -898236282,   588296766}, { -897784800,   588985532}, { -897332790,   589673951}, { -896880252,   590362023}, 
+	{ -900036924,   585538248}, { -899587557,   586228395}, { -899137661,   586918198}, { -898687236,   587607655}, 
+	{ -901829095,   582774218}, { -901381847,   583465740}, { -900934069,   584156920}, { -900485762,   584847756}, 
+	{ -903612776,   580004702}, { -903167653,   580697594}, { -902721998,   581390144}, { -902275811,   582082352}, 
+	{ -905387953,   577229728}, { -904944957,   577923982}, { -904501429,   578617896}, { -904057369,   579311470}, 
+	{ -907154608,   574449320}, { -906713744,   575144930}, { -906272347,   575840202}, { -905830417,   576535134}, 
+	{ -908912725,   571663506}, { -908473997,   572360465}, { -908034735,   573057087}, { -907594938,   573753372}, 
+	{ -910662286,   568872310}, { -910225699,   569570612}, { -909788576,   570268579}, { -909350918,   570966210}, 
+	{ -912403276,   566075761}, { -911968833,   566775399}, { -911533853,   567474703}, { -911098338,   568173674}, 
+	{ -914135678,   563273883}, { -913703383,   563974850}, { -913270551,   564675486}, { -912837182,   565375790}, 
+	{ -915859476,   560466703}, { -915429334,   561168994}, { -914998653,   561870954}, { -914567435,   562572584}, 
+	{ -917574653,   557654248}, { -917146668,   558357855}, { -916718143,   559061133}, { -916289079,   559764083}, 
+	{ -919281194,   554836544}, { -918855369,   555541461}, { -918429004,   556246051}, { -918002099,   556950313}, 
+	{ -920979082,   552013618}, { -920555422,   552719838}, { -920131221,   553425732}, { -919706478,   554131301}, 
+	{ -922668302,   549185496}, { -922246810,   549893013}, { -921824777,   550600205}, { -921402200,   551307074}, 
+	{ -924348837,   546352205}, { -923929518,   547061011}, { -923509656,   547769495}, { -923089250,   548477657}, 
+	{ -926020672,   543513772}, { -925603530,   544223861}, { -925185843,   544933630}, { -924767612,   545643078}, 
+	{ -927683790,   540670223}, { -927268829,   541381588}, { -926853322,   542092635}, { -926437269,   542803363}, 
+	{ -929338177,   537821584}, { -928925400,   538534220}, { -928512076,   539246538}, { -928098206,   539958539}, 
+	{ -930983817,   534967884}, { -930573228,   535681782}, { -930162092,   536395365}, { -929750408,   537108633}, 
+	{ -932620694,   532109148}, { -932212297,   532824303}, { -931803352,   533539144}, { -931393859,   534253671}, 
+	{ -934248793,   529245404}, { -933842592,   529961808}, { -933435842,   530677900}, { -933028542,   531393681}, 
+	{ -935868098,   526376678}, { -935464097,   527094325}, { -935059546,   527811662}, { -934654444,   528528689}, 
+	{ -937478595,   523502998}, { -937076797,   524221881}, { -936674448,   524940456}, { -936271549,   525658722}, 
+	{ -939080267,   520624391}, { -938680677,   521344503}, { -938280535,   522064309}, { -937879841,   522783807}, 
+	{ -940673101,   517740883}, { -940275722,   518462218}, { -939877790,   519183248}, { -939479305,   519903972}, 
+	{ -942257081,   514852502}, { -941861917,   515575053}, { -941466198,   516297300}, { -941069926,   517019243}, 
+	{ -943832191,   511959275}, { -943439246,   512683035}, { -943045745,   513406493}, { -942651690,   514129648}, 
+	{ -945398418,   509061229}, { -945007695,   509786191}, { -944616416,   510510853}, { -944224582,   511235214}, 
+	{ -946955747,   506158392}, { -946567250,   506884549}, { -946178196,   507610408}, { -945788585,   508335968}, 
+	{ -948504163,   503250791}, { -948117895,   503978136}, { -947731070,   504705185}, { -947343687,   505431937}, 
+	{ -950043650,   500338453}, { -949659616,   501066980}, { -949275023,   501795212}, { -948889872,   502523149}, 
+	{ -951574196,   497421405}, { -951192399,   498151107}, { -950810042,   498880516}, { -950427126,   499609631}, 
+	{ -953095785,   494499676}, { -952716228,   495230545}, { -952336111,   495961124}, { -951955434,   496691410}, 
+	{ -954608403,   491573292}, { -954231090,   492305322}, { -953853216,   493037064}, { -953474781,   493768515}, 
+	{ -956112036,   488642281}, { -955736971,   489375466}, { -955361344,   490108363}, { -954985154,   490840972}, 
+	{ -957606670,   485706671}, { -957233856,   486441003}, { -956860479,   487175049}, { -956486539,   487908809}, 
+	{ -959092290,   482766489}, { -958721731,   483501962}, { -958350608,   484237150}, { -957978921,   484972053}, 
+	{ -960568883,   479821764}, { -960200582,   480558369}, { -959831716,   481294693}, { -959462286,   482030733}, 
+	{ -962036435,   476872522}, { -961670396,   477610254}, { -961303790,   478347705}, { -960936620,   479084875}, 
+	{ -963494932,   473918791}, { -963131157,   474657643}, { -962766816,   475396216}, { -962401909,   476134509}, 
+	{ -964944360,   470960600}, { -964582854,   471700564}, { -964220780,   472440251}, { -963858140,   473179660}, 
+	{ -966384706,   467997976}, { -966025471,   468739046}, { -965665669,   469479840}, { -965305298,   470220358}, 
+	{ -967815955,   465030947}, { -967458996,   465773116}, { -967101468,   466515010}, { -966743371,   467256631}, 
+	{ -969238095,   462059541}, { -968883415,   462802801}, { -968528165,   463545789}, { -968172345,   464288505}, 
+	{ -970651112,   459083786}, { -970298714,   459828131}, { -969945745,   460572205}, { -969592205,   461316009}, 
+	{ -972054994,   456103710}, { -971704881,   456849132}, { -971354196,   457594286}, { -971002940,   458339171}, 
+	{ -973449725,   453119340}, { -973101901,   453865834}, { -972753504,   454612060}, { -972404535,   455358019}, 
+	{ -974835295,   450130706}, { -974489762,   450878263}, { -974143656,   451625555}, { -973796977,   452372581}, 
+	{ -976211688,   447137835}, { -975868451,   447886449}, { -975524639,   448634799}, { -975180254,   449382885}, 
+	{ -977578894,   444140756}, { -977237955,   444890419}, { -976896441,   445639820}, { -976554352,   446388959}, 
+	{ -978936898,   441139496}, { -978598260,   441890201}, { -978259047,   442640647}, { -977919258,   443390832}, 
+	{ -980285688,   438134084}, { -979949355,   438885824}, { -979612445,   439637307}, { -979274960,   440388531}, 
+	{ -981625251,   435124548}, { -981291226,   435877317}, { -980956623,   436629829}, { -980621444,   437382085}, 
+	{ -982955574,   432110916}, { -982623860,   432864706}, { -982291568,   433618242}, { -981958698,   434371523}, 
+	{ -984276646,   429093217}, { -983947246,   429848022}, { -983617267,   430602573}, { -983286710,   431356872}, 
+	{ -985588453,   426071480}, { -985261370,   426827291}, { -984933708,   427582852}, { -984605467,   428338160}, 
+	{ -986890984,   423045732}, { -986566221,   423802543}, { -986240879,   424559105}, { -985914956,   425315418}, 
+	{ -988184225,   420016002}, { -987861786,   420773806}, { -987538766,   421531363}, { -987215165,   422288671}, 
+	{ -989468165,   416982319}, { -989148053,   417741109}, { -988827359,   418499653}, { -988506083,   419257951}, 
+	{ -990742793,   413944711}, { -990425010,   414704479}, { -990106644,   415464004}, { -989787696,   416223284}, 
+	{ -992008094,   410903207}, { -991692644,   411663946}, { -991376610,   412424444}, { -991059993,   413184699}, 
+	{ -993264059,   407857835}, { -992950944,   408619539}, { -992637245,   409381002}, { -992322961,   410142225}, 
+	{ -994510675,   404808624}, { -994199898,   405571285}, { -993888536,   406333708}, { -993576590,   407095891}, 
+	{ -995747930,   401755603}, { -995439494,   402519214}, { -995130473,   403282588}, { -994820867,   404045725}, 
+	{ -996975812,   398698801}, { -996669721,   399463355}, { -996363043,   400227673}, { -996055780,   400991756}, 
+	{ -998194311,   395638246}, { -997890567,   396403735}, { -997586236,   397168991}, { -997281317,   397934013}, 
+	{ -999403415,   392573967}, { -999102020,   393340384}, { -998800038,   394106570}, { -998497468,   394872524}, 
+	{-1000603111,   389505993}, {-1000304069,   390273331}, {-1000004439,   391040440}, { -999704221,   391807319}, 
+	{-1001793390,   386434353}, {-1001496704,   387202605}, {-1001199428,   387970630}, {-1000901564,   388738426}, 
+	{-1002974239,   383359076}, {-1002679911,   384128234}, {-1002384994,   384897167}, {-1002089486,   385665873}, 
+	{-1004145648,   380280190}, {-1003853681,   381050248}, {-1003561124,   381820082}, {-1003267977,   382589691}, 
+	{-1005307605,   377197725}, {-1005018003,   377968675}, {-1004727809,   378739403}, {-1004437024,   379509908}, 
+	{-1006460100,   374111709}, {-1006172864,   374883544}, {-1005885036,   375655159}, {-1005596617,   376426553}, 
+	{-1007603122,   371022173}, {-1007318256,   371794885}, {-1007032796,   372567379}, {-1006746744,   373339654}, 
+	{-1008736660,   367929144}, {-1008454166,   368702727}, {-1008171077,   369476093}, {-1007887396,   370249242}, 
+	{-1009860704,   364832652}, {-1009580584,   365607098}, {-1009299870,   366381329}, {-1009018562,   367155344}, 
+	{-1010975242,   361732726}, {-1010697499,   362508027}, {-1010419162,   363283116}, {-1010140230,   364057991}, 
+	{-1012080264,   358629395}, {-1011804901,   359405545}, {-1011528943,   360181484}, {-1011252390,   360957211}, 
+	{-1013175761,   355522689}, {-1012902780,   356299680}, {-1012629204,   357076462}, {-1012355032,   357853034}, 
+	{-1014261721,   352412636}, {-1013991126,   353190461}, {-1013719934,   353968079}, {-1013448145,   354745488}, 
+	{-1015338134,   349299266}, {-1015069927,   350077918}, {-1014801122,   350856364}, {-1014531720,   351634604}, 
+	{-1016404991,   346182609}, {-1016139173,   346962080}, {-1015872758,   347741347}, {-1015605745,   348520409}, 
+	{-1017462281,   343062693}, {-1017198856,   343842976}, {-1016934832,   344623057}, {-1016670211,   345402934}, 
+	{-1018509994,   339939549}, {-1018248964,   340720636}, {-1017987335,   341501523}, {-1017725107,   342282209}, 
+	{-1019548121,   336813204}, {-1019289488,   337595089}, {-1019030256,   338376774}, {-1018770425,   339158261}, 
+	{-1020576651,   333683689}, {-1020320418,   334466364}, {-1020063586,   335248841}, {-1019806153,   336031121}, 
+	{-1021595575,   330551034}, {-1021341745,   331334491}, {-1021087314,   332117752}, {-1020832283,   332900819}, 
+	{-1022604883,   327415267}, {-1022353458,   328199499}, {-1022101432,   328983538}, {-1021848804,   329767383}, 
+	{-1023604567,   324276419}, {-1023355549,   325061418}, {-1023105929,   325846226}, {-1022855707,   326630843}, 
+	{-1024594615,   321134518}, {-1024348007,   321920278}, {-1024100796,   322705848}, {-1023852982,   323491229}, 
+	{-1025575020,   317989595}, {-1025330824,   318776108}, {-1025086024,   319562433}, {-1024840621,   320348570}, 
+	{-1026545772,   314841679}, {-1026303990,   315628937}, {-1026061603,   316416009}, {-1025818614,   317202895}, 
+	{-1027506862,   311690799}, {-1027267495,   312478795}, {-1027027525,   313266607}, {-1026786951,   314054235}, 
+	{-1028458280,   308536985}, {-1028221332,   309325712}, {-1027983780,   310114257}, {-1027745623,   310902619}, 
+	{-1029400018,   305380268}, {-1029165491,   306169718}, {-1028930359,   306958988}, {-1028694622,   307748077}, 
+	{-1030332067,   302220676}, {-1030099963,   303010842}, {-1029867254,   303800829}, {-1029633939,   304590638}, 
+	{-1031254418,   299058239}, {-1031024740,   299849113}, {-1030794455,   300639811}, {-1030563564,   301430332}, 
+	{-1032167062,   295892988}, {-1031939812,   296684563}, {-1031711954,   297475964}, {-1031483489,   298267189}, 
+	{-1033069992,   292724951}, {-1032845170,   293517220}, {-1032619742,   294309316}, {-1032393706,   295101239}, 
+	{-1033963197,   289554160}, {-1033740808,   290347114}, {-1033517810,   291139898}, {-1033294205,   291932511}, 
+	{-1034846671,   286380643}, {-1034626715,   287174276}, {-1034406151,   287967740}, {-1034184978,   288761035}, 
+	{-1035720404,   283204430}, {-1035502884,   283998734}, {-1035284755,   284792871}, {-1035066018,   285586841}, 
+	{-1036584389,   280025552}, {-1036369307,   280820520}, {-1036153615,   281615322}, {-1035937314,   282409959}, 
+	{-1037438617,   276844038}, {-1037225975,   277639662}, {-1037012723,   278435122}, {-1036798861,   279230419}, 
+	{-1038283080,   273659918}, {-1038072880,   274456191}, {-1037862069,   275252302}, {-1037650648,   276048251}, 
+	{-1039117770,   270473223}, {-1038910014,   271270136}, {-1038701647,   272066891}, {-1038492669,   272863485}, 
+	{-1039942680,   267283981}, {-1039737370,   268081529}, {-1039531448,   268878918}, {-1039324915,   269676150}, 
+	{-1040757802,   264092224}, {-1040554939,   264890398}, {-1040351465,   265688415}, {-1040147378,   266486277}, 
+	{-1041563127,   260897982}, {-1041362715,   261696774}, {-1041161689,   262495412}, {-1040960052,   263293896}, 
+	{-1042358649,   257701283}, {-1042160688,   258500686}, {-1041962114,   259299937}, {-1041762927,   260099036}, 
+	{-1043144360,   254502159}, {-1042948852,   255302166}, {-1042752731,   256102022}, {-1042555997,   256901728}, 
+	{-1043920252,   251300640}, {-1043727200,   252101242}, {-1043533534,   252901697}, {-1043339254,   253702003}, 
+	{-1044686319,   248096755}, {-1044495724,   248897946}, {-1044304514,   249698991}, {-1044112690,   250499889}, 
+	{-1045442553,   244890535}, {-1045254416,   245692307}, {-1045065665,   246493935}, {-1044876299,   247295417}, 
+	{-1046188946,   241682010}, {-1046003271,   242484355}, {-1045816980,   243286558}, {-1045630074,   244088618}, 
+	{-1046925492,   238471210}, {-1046742279,   239274121}, {-1046558451,   240076892}, {-1046374006,   240879522}, 
+	{-1047652185,   235258165}, {-1047471436,   236061635}, {-1047290071,   236864966}, {-1047108090,   237668158}, 
+	{-1048369016,   232042906}, {-1048190733,   232846927}, {-1048011834,   233650811}, {-1047832317,   234454557}, 
+	{-1049075980,   228825464}, {-1048900165,   229630027}, {-1048723732,   230434456}, {-1048546683,   231238749}, 
+	{-1049773069,   225605867}, {-1049599723,   226410966}, {-1049425759,   227215933}, {-1049251178,   228020765}, 
+	{-1050460278,   222384147}, {-1050289403,   223189774}, {-1050117909,   223995270}, {-1049945798,   224800635}, 
+	{-1051137599,   219160334}, {-1050969196,   219966481}, {-1050800175,   220772500}, {-1050630536,   221578389}, 
+	{-1051805027,   215934457}, {-1051639098,   216741118}, {-1051472550,   217547651}, {-1051305384,   218354057}, 
+	{-1052462555,   212706549}, {-1052299101,   213513715}, {-1052135029,   214320755}, {-1051970337,   215127670}, 
+	{-1053110176,   209476638}, {-1052949200,   210284302}, {-1052787604,   211091842}, {-1052625389,   211899258}, 
+	{-1053747885,   206244756}, {-1053589387,   207052910}, {-1053430270,   207860942}, {-1053270533,   208668851}, 
+	{-1054375676,   203010932}, {-1054219658,   203819569}, {-1054063021,   204628085}, {-1053905763,   205436481}, 
+	{-1054993543,   199775198}, {-1054840007,   200584309}, {-1054685850,   201393302}, {-1054531073,   202202177}, 
+	{-1055601479,   196537583}, {-1055450426,   197347161}, {-1055298753,   198156624}, {-1055146458,   198965969}, 
+	{-1056199480,   193298119}, {-1056050912,   194108156}, {-1055901722,   194918080}, {-1055751911,   195727889}, 
+	{-1056787540,   190056834}, {-1056641457,   190867324}, {-1056494753,   191677702}, {-1056347427,   192487967}, 
+	{-1057365653,   186813762}, {-1057222057,   187624696}, {-1057077840,   188435520}, {-1056933001,   189246233}, 
+	{-1057933813,   183568930}, {-1057792706,   184380301}, {-1057650977,   185191564}, {-1057508626,   186002717}, 
+	{-1058492016,   180322371}, {-1058353399,   181134171}, {-1058214159,   181945865}, {-1058074297,   182757451}, 
+	{-1059040255,   177074115}, {-1058904130,   177886336}, {-1058767381,   178698453}, {-1058630010,   179510465}, 
+	{-1059578527,   173824192}, {-1059444894,   174636827}, {-1059310638,   175449360}, {-1059175758,   176261789}, 
+	{-1060106826,   170572633}, {-1059975686,   171385674}, {-1059843923,   172198615}, {-1059711537,   173011454}, 
+	{-1060625146,   167319468}, {-1060496502,   168132908}, {-1060367233,   168946249}, {-1060237341,   169759491}, 
+	{-1061133483,   164064728}, {-1061007335,   164878559}, {-1060880563,   165692293}, {-1060753166,   166505929}, 
+	{-1061631833,   160808445}, {-1061508182,   161622659}, {-1061383907,   162436778}, {-1061259007,   163250801}, 
+	{-1062120190,   157550647}, {-1061999038,   158365237}, {-1061877261,   159179733}, {-1061754859,   159994136}, 
+	{-1062598550,   154291367}, {-1062479898,   155106324}, {-1062360620,   155921191}, {-1062240717,   156735965}, 
+	{-1063066909,   151030634}, {-1062950757,   151845952}, {-1062833980,   152661180}, {-1062716578,   153476319}, 
+	{-1063525261,   147768480}, {-1063411611,   148584150}, {-1063297336,   149399733}, {-1063182435,   150215228}, 
+	{-1063973603,   144504935}, {-1063862456,   145320950}, {-1063750684,   146136880}, {-1063638285,   146952723}, 
+	{-1064411931,   141240030}, {-1064303288,   142056382}, {-1064194019,   142872651}, {-1064084124,   143688835}, 
+	{-1064840240,   137973796}, {-1064734102,   138790477}, {-1064627338,   139607077}, {-1064519947,   140423595}, 
+	{-1065258526,   134706263}, {-1065154894,   135523266}, {-1065050636,   136340190}, {-1064945751,   137157033}, 
+	{-1065666786,   131437462}, {-1065565661,   132254779}, {-1065463909,   133072019}, {-1065361531,   133889180}, 
+	{-1066065015,   128167423}, {-1065966398,   128985047}, {-1065867154,   129802595}, {-1065767284,   130620067}, 
+	{-1066453210,   124896179}, {-1066357102,   125714101}, {-1066260367,   126531950}, {-1066163005,   127349724}, 
+	{-1066831367,   121623759}, {-1066737769,   122441972}, {-1066643544,   123260114}, {-1066548690,   124078183}, 
+	{-1067199483,   118350194}, {-1067108396,   119168691}, {-1067016680,   119987118}, {-1066924338,   120805474}, 
+	{-1067557554,   115075515}, {-1067468978,   115894288}, {-1067379774,   116712992}, {-1067289942,   117531627}, 
+	{-1067905576,   111799753}, {-1067819513,   112618793}, {-1067732821,   113437768}, {-1067645501,   114256675}, 
+	{-1068243547,   108522939}, {-1068159997,   109342239}, {-1068075818,   110161476}, {-1067991011,   110980647}, 
+	{-1068571464,   105245103}, {-1068490427,   106064656}, {-1068408763,   106884147}, {-1068326469,   107703574}, 
+	{-1068889322,   101966277}, {-1068810801,   102786074}, {-1068731650,   103605812}, {-1068651871,   104425488}, 
+	{-1069197120,    98686491}, {-1069121114,    99506525}, {-1069044479,   100326502}, {-1068967215,   101146419}, 
+	{-1069494854,    95405776}, {-1069421364,    96226040}, {-1069347245,    97046247}, {-1069272497,    97866398}, 
+	{-1069782521,    92124163}, {-1069711548,    92944648}, {-1069639946,    93765079}, {-1069567715,    94585455}, 
+	{-1070060120,    88841683}, {-1069991664,    89662382}, {-1069922579,    90483029}, {-1069852865,    91303623}, 
+	{-1070327646,    85558366}, {-1070261709,    86379272}, {-1070195142,    87200127}, {-1070127946,    88020931}, 
+	{-1070585099,    82274245}, {-1070521680,    83095349}, {-1070457632,    83916404}, {-1070392954,    84737410}, 
+	{-1070832474,    78989349}, {-1070771575,    79810644}, {-1070710046,    80631892}, {-1070647887,    81453092}, 
+	{-1071069770,    75703709}, {-1071011391,    76525187}, {-1070952382,    77346620}, {-1070892743,    78168007}, 
+	{-1071296985,    72417357}, {-1071241127,    73239010}, {-1071184638,    74060620}, {-1071127519,    74882187}, 
+	{-1071514117,    69130324}, {-1071460780,    69952144}, {-1071406812,    70773924}, {-1071352214,    71595661}, 
+	{-1071721163,    65842639}, {-1071670347,    66664620}, {-1071618901,    67486561}, {-1071566824,    68308462}, 
+	{-1071918122,    62554335}, {-1071869828,    63376468}, {-1071820903,    64198563}, {-1071771349,    65020620}, 
+	{-1072104991,    59265442}, {-1072059220,    60087719}, {-1072012818,    60909960}, {-1071965785,    61732166}, 
+	{-1072281769,    55975992}, {-1072238521,    56798405}, {-1072194642,    57620785}, {-1072150132,    58443131}, 
+	{-1072448455,    52686014}, {-1072407730,    53508556}, {-1072366374,    54331067}, {-1072324387,    55153545}, 
+	{-1072605046,    49395541}, {-1072566845,    50218204}, {-1072528012,    51040837}, {-1072488549,    51863441}, 
+	{-1072751542,    46104602}, {-1072715864,    46927379}, {-1072679556,    47750128}, {-1072642617,    48572848}, 
+	{-1072887940,    42813230}, {-1072854787,    43636112}, {-1072821003,    44458968}, {-1072786588,    45281799}, 
+	{-1073014240,    39521455}, {-1072983612,    40344435}, {-1072952352,    41167391}, {-1072920462,    41990323}, 
+	{-1073130440,    36229307}, {-1073102337,    37052377}, {-1073073603,    37875426}, {-1073044237,    38698452}, 
+	{-1073236540,    32936819}, {-1073210962,    33759971}, {-1073184753,    34583104}, {-1073157912,    35406216}, 
+	{-1073332538,    29644021}, {-1073309485,    30467248}, {-1073285802,    31290457}, {-1073261486,    32113647}, 
+	{-1073418433,    26350943}, {-1073397906,    27174237}, {-1073376748,    27997515}, {-1073354959,    28820776}, 
+	{-1073494225,    23057618}, {-1073476224,    23880971}, {-1073457592,    24704310}, {-1073438328,    25527634}, 
+	{-1073559913,    19764076}, {-1073544438,    20587480}, {-1073528332,    21410872}, {-1073511594,    22234252}, 
+	{-1073615496,    16470347}, {-1073602547,    17293795}, {-1073588967,    18117233}, {-1073574756,    18940660}, 
+	{-1073660973,    13176464}, {-1073650551,    13999948}, {-1073639498,    14823423}, {-1073627812,    15646890}, 
+	{-1073696345,     9882456}, {-1073688450,    10705968}, {-1073679922,    11529474}, {-1073670764,    12352972}, 
+	{-1073721611,     6588356}, {-1073716242,     7411888}, {-1073710241,     8235416}, {-1073703609,     9058939}, 
+	{-1073736771,     3294193}, {-1073733928,     4117738}, {-1073730454,     4941281}, {-1073726348,     5764820}, 
+	{-1073741824,           0}, {-1073741508,      823550}, {-1073740561,     1647099}, {-1073738982,     2470647}, 
+#endif
+#if (MAX_DIF_FFT_LUT_LOG2 >= 12)
+	{ 1073721611,     6588356}, { 1073730454,     4941281}, { 1073736771,     3294193}, { 1073740561,     1647099}, 
+	{ 1073660973,    13176464}, { 1073679922,    11529474}, { 1073696345,     9882456}, { 1073710241,     8235416}, 
+	{ 1073559913,    19764076}, { 1073588967,    18117233}, { 1073615496,    16470347}, { 1073639498,    14823423}, 
+	{ 1073418433,    26350943}, { 1073457592,    24704310}, { 1073494225,    23057618}, { 1073528332,    21410872}, 
+	{ 1073236540,    32936819}, { 1073285802,    31290457}, { 1073332538,    29644021}, { 1073376748,    27997515}, 
+	{ 1073014240,    39521455}, { 1073073603,    37875426}, { 1073130440,    36229307}, { 1073184753,    34583104}, 
+	{ 1072751542,    46104602}, { 1072821003,    44458968}, { 1072887940,    42813230}, { 1072952352,    41167391}, 
+	{ 1072448455,    52686014}, { 1072528012,    51040837}, { 1072605046,    49395541}, { 1072679556,    47750128}, 
+	{ 1072104991,    59265442}, { 1072194642,    57620785}, { 1072281769,    55975992}, { 1072366374,    54331067}, 
+	{ 1071721163,    65842639}, { 1071820903,    64198563}, { 1071918122,    62554335}, { 1072012818,    60909960}, 
+	{ 1071296985,    72417357}, { 1071406812,    70773924}, { 1071514117,    69130324}, { 1071618901,    67486561}, 
+	{ 1070832474,    78989349}, { 1070952382,    77346620}, { 1071069770,    75703709}, { 1071184638,    74060620}, 
+	{ 1070327646,    85558366}, { 1070457632,    83916404}, { 1070585099,    82274245}, { 1070710046,    80631892}, 
+	{ 1069782521,    92124163}, { 1069922579,    90483029}, { 1070060120,    88841683}, { 1070195142,    87200127}, 
+	{ 1069197120,    98686491}, { 1069347245,    97046247}, { 1069494854,    95405776}, { 1069639946,    93765079}, 
+	{ 1068571464,   105245103}, { 1068731650,   103605812}, { 1068889322,   101966277}, { 1069044479,   100326502}, 
+	{ 1067905576,   111799753}, { 1068075818,   110161476}, { 1068243547,   108522939}, { 1068408763,   106884147}, 
+	{ 1067199483,   118350194}, { 1067379774,   116712992}, { 1067557554,   115075515}, { 1067732821,   113437768}, 
+	{ 1066453210,   124896179}, { 1066643544,   123260114}, { 1066831367,   121623759}, { 1067016680,   119987118}, 
+	{ 1065666786,   131437462}, { 1065867154,   129802595}, { 1066065015,   128167423}, { 1066260367,   126531950}, 
+	{ 1064840240,   137973796}, { 1065050636,   136340190}, { 1065258526,   134706263}, { 1065463909,   133072019}, 
+	{ 1063973603,   144504935}, { 1064194019,   142872651}, { 1064411931,   141240030}, { 1064627338,   139607077}, 
+	{ 1063066909,   151030634}, { 1063297336,   149399733}, { 1063525261,   147768480}, { 1063750684,   146136880}, 
+	{ 1062120190,   157550647}, { 1062360620,   155921191}, { 1062598550,   154291367}, { 1062833980,   152661180}, 
+	{ 1061133483,   164064728}, { 1061383907,   162436778}, { 1061631833,   160808445}, { 1061877261,   159179733}, 
+	{ 1060106826,   170572633}, { 1060367233,   168946249}, { 1060625146,   167319468}, { 1060880563,   165692293}, 
+	{ 1059040255,   177074115}, { 1059310638,   175449360}, { 1059578527,   173824192}, { 1059843923,   172198615}, 
+	{ 1057933813,   183568930}, { 1058214159,   181945865}, { 1058492016,   180322371}, { 1058767381,   178698453}, 
+	{ 1056787540,   190056834}, { 1057077840,   188435520}, { 1057365653,   186813762}, { 1057650977,   185191564}, 
+	{ 1055601479,   196537583}, { 1055901722,   194918080}, { 1056199480,   193298119}, { 1056494753,   191677702}, 
+	{ 1054375676,   203010932}, { 1054685850,   201393302}, { 1054993543,   199775198}, { 1055298753,   198156624}, 
+	{ 1053110176,   209476638}, { 1053430270,   207860942}, { 1053747885,   206244756}, { 1054063021,   204628085}, 
+	{ 1051805027,   215934457}, { 1052135029,   214320755}, { 1052462555,   212706549}, { 1052787604,   211091842}, 
+	{ 1050460278,   222384147}, { 1050800175,   220772500}, { 1051137599,   219160334}, { 1051472550,   217547651}, 
+	{ 1049075980,   228825464}, { 1049425759,   227215933}, { 1049773069,   225605867}, { 1050117909,   223995270}, 
+	{ 1047652185,   235258165}, { 1048011834,   233650811}, { 1048369016,   232042906}, { 1048723732,   230434456}, 
+	{ 1046188946,   241682010}, { 1046558451,   240076892}, { 1046925492,   238471210}, { 1047290071,   236864966}, 
+	{ 1044686319,   248096755}, { 1045065665,   246493935}, { 1045442553,   244890535}, { 1045816980,   243286558}, 
+	{ 1043144360,   254502159}, { 1043533534,   252901697}, { 1043920252,   251300640}, { 1044304514,   249698991}, 
+	{ 1041563127,   260897982}, { 1041962114,   259299937}, { 1042358649,   257701283}, { 1042752731,   256102022}, 
+	{ 1039942680,   267283981}, { 1040351465,   265688415}, { 1040757802,   264092224}, { 1041161689,   262495412}, 
+	{ 1038283080,   273659918}, { 1038701647,   272066891}, { 1039117770,   270473223}, { 1039531448,   268878918}, 
+	{ 1036584389,   280025552}, { 1037012723,   278435122}, { 1037438617,   276844038}, { 1037862069,   275252302}, 
+	{ 1034846671,   286380643}, { 1035284755,   284792871}, { 1035720404,   283204430}, { 1036153615,   281615322}, 
+	{ 1033069992,   292724951}, { 1033517810,   291139898}, { 1033963197,   289554160}, { 1034406151,   287967740}, 
+	{ 1031254418,   299058239}, { 1031711954,   297475964}, { 1032167062,   295892988}, { 1032619742,   294309316}, 
+	{ 1029400018,   305380268}, { 1029867254,   303800829}, { 1030332067,   302220676}, { 1030794455,   300639811}, 
+	{ 1027506862,   311690799}, { 1027983780,   310114257}, { 1028458280,   308536985}, { 1028930359,   306958988}, 
+	{ 1025575020,   317989595}, { 1026061603,   316416009}, { 1026545772,   314841679}, { 1027027525,   313266607}, 
+	{ 1023604567,   324276419}, { 1024100796,   322705848}, { 1024594615,   321134518}, { 1025086024,   319562433}, 
+	{ 1021595575,   330551034}, { 1022101432,   328983538}, { 1022604883,   327415267}, { 1023105929,   325846226}, 
+	{ 1019548121,   336813204}, { 1020063586,   335248841}, { 1020576651,   333683689}, { 1021087314,   332117752}, 
+	{ 1017462281,   343062693}, { 1017987335,   341501523}, { 1018509994,   339939549}, { 1019030256,   338376774}, 
+	{ 1015338134,   349299266}, { 1015872758,   347741347}, { 1016404991,   346182609}, { 1016934832,   344623057}, 
+	{ 1013175761,   355522689}, { 1013719934,   353968079}, { 1014261721,   352412636}, { 1014801122,   350856364}, 
+	{ 1010975242,   361732726}, { 1011528943,   360181484}, { 1012080264,   358629395}, { 1012629204,   357076462}, 
+	{ 1008736660,   367929144}, { 1009299870,   366381329}, { 1009860704,   364832652}, { 1010419162,   363283116}, 
+	{ 1006460100,   374111709}, { 1007032796,   372567379}, { 1007603122,   371022173}, { 1008171077,   369476093}, 
+	{ 1004145648,   380280190}, { 1004727809,   378739403}, { 1005307605,   377197725}, { 1005885036,   375655159}, 
+	{ 1001793390,   386434353}, { 1002384994,   384897167}, { 1002974239,   383359076}, { 1003561124,   381820082}, 
+	{  999403415,   392573967}, { 1000004439,   391040440}, { 1000603111,   389505993}, { 1001199428,   387970630}, 
+	{  996975812,   398698801}, {  997586236,   397168991}, {  998194311,   395638246}, {  998800038,   394106570}, 
+	{  994510675,   404808624}, {  995130473,   403282588}, {  995747930,   401755603}, {  996363043,   400227673}, 
+	{  992008094,   410903207}, {  992637245,   409381002}, {  993264059,   407857835}, {  993888536,   406333708}, 
+	{  989468165,   416982319}, {  990106644,   415464004}, {  990742793,   413944711}, {  991376610,   412424444}, 
+	{  986890984,   423045732}, {  987538766,   421531363}, {  988184225,   420016002}, {  988827359,   418499653}, 
+	{  984276646,   429093217}, {  984933708,   427582852}, {  985588453,   426071480}, {  986240879,   424559105}, 
+	{  981625251,   435124548}, {  982291568,   433618242}, {  982955574,   432110916}, {  983617267,   430602573}, 
+	{  978936898,   441139496}, {  979612445,   439637307}, {  980285688,   438134084}, {  980956623,   436629829}, 
+	{  976211688,   447137835}, {  976896441,   445639820}, {  977578894,   444140756}, {  978259047,   442640647}, 
+	{  973449725,   453119340}, {  974143656,   451625555}, {  974835295,   450130706}, {  975524639,   448634799}, 
+	{  970651112,   459083786}, {  971354196,   457594286}, {  972054994,   456103710}, {  972753504,   454612060}, 
+	{  967815955,   465030947}, {  968528165,   463545789}, {  969238095,   462059541}, {  969945745,   460572205}, 
+	{  964944360,   470960600}, {  965665669,   469479840}, {  966384706,   467997976}, {  967101468,   466515010}, 
+	{  962036435,   476872522}, {  962766816,   475396216}, {  963494932,   473918791}, {  964220780,   472440251}, 
+	{  959092290,   482766489}, {  959831716,   481294693}, {  960568883,   479821764}, {  961303790,   478347705}, 
+	{  956112036,   488642281}, {  956860479,   487175049}, {  957606670,   485706671}, {  958350608,   484237150}, 
+	{  953095785,   494499676}, {  953853216,   493037064}, {  954608403,   491573292}, {  955361344,   490108363}, 
+	{  950043650,   500338453}, {  950810042,   498880516}, {  951574196,   497421405}, {  952336111,   495961124}, 
+	{  946955747,   506158392}, {  947731070,   504705185}, {  948504163,   503250791}, {  949275023,   501795212}, 
+	{  943832191,   511959275}, {  944616416,   510510853}, {  945398418,   509061229}, {  946178196,   507610408}, 
+	{  940673101,   517740883}, {  941466198,   516297300}, {  942257081,   514852502}, {  943045745,   513406493}, 
+	{  937478595,   523502998}, {  938280535,   522064309}, {  939080267,   520624391}, {  939877790,   519183248}, 
+	{  934248793,   529245404}, {  935059546,   527811662}, {  935868098,   526376678}, {  936674448,   524940456}, 
+	{  930983817,   534967884}, {  931803352,   533539144}, {  932620694,   532109148}, {  933435842,   530677900}, 
+	{  927683790,   540670223}, {  928512076,   539246538}, {  929338177,   537821584}, {  930162092,   536395365}, 
+	{  924348837,   546352205}, {  925185843,   544933630}, {  926020672,   543513772}, {  926853322,   542092635}, 
+	{  920979082,   552013618}, {  921824777,   550600205}, {  922668302,   549185496}, {  923509656,   547769495}, 
+	{  917574653,   557654248}, {  918429004,   556246051}, {  919281194,   554836544}, {  920131221,   553425732}, 
+	{  914135678,   563273883}, {  914998653,   561870954}, {  915859476,   560466703}, {  916718143,   559061133}, 
+	{  910662286,   568872310}, {  911533853,   567474703}, {  912403276,   566075761}, {  913270551,   564675486}, 
+	{  907154608,   574449320}, {  908034735,   573057087}, {  908912725,   571663506}, {  909788576,   570268579}, 
+	{  903612776,   580004702}, {  904501429,   578617896}, {  905387953,   577229728}, {  906272347,   575840202}, 
+	{  900036924,   585538248}, {  900934069,   584156920}, {  901829095,   582774218}, {  902721998,   581390144}, 
+	{  896427186,   591049748}, {  897332790,   589673951}, {  898236282,   588296766}, {  899137661,   586918198}, 
+	{  892783698,   596538995}, {  893697727,   595168781}, {  894609652,   593797166}, {  895519473,   592424154}, 
+	{  889106597,   602005783}, {  890029016,   600641203}, {  890949341,   599275210}, {  891867569,   597907806}, 
+	{  885396022,   607449906}, {  886326796,   606091012}, {  887255485,   604730691}, {  888182086,   603368947}, 
+	{  881652112,   612871159}, {  882591207,   611518001}, {  883528225,   610163404}, {  884463164,   608807372}, 
+	{  877875009,   618269338}, {  878822389,   616921967}, {  879767701,   615573145}, {  880710943,   614222875}, 
+	{  874064853,   623644239}, {  875020483,   622302707}, {  875974054,   620959711}, {  876925563,   619615253}, 
+	{  870221790,   628995660}, {  871185633,   627660017}, {  872147426,   626322897}, {  873107167,   624984303}, 
+	{  866345964,   634323400}, {  867317984,   632993696}, {  868287963,   631662503}, {  869255900,   630329823}, 
+	{  862437520,   639627258}, {  863417681,   638303543}, {  864395810,   636978327}, {  865371905,   635651611}, 
+	{  858496606,   644907034}, {  859484870,   643589359}, {  860471112,   642270169}, {  861455330,   640949467}, 
+	{  854523370,   650162530}, {  855519701,   648850943}, {  856514019,   647537830}, {  857506321,   646223192}, 
+	{  850517961,   655393548}, {  851522321,   654088099}, {  852524677,   652781111}, {  853525028,   651472587}, 
+	{  846480531,   660599890}, {  847492882,   659300629}, {  848503239,   657999816}, {  849511600,   656697454}, 
+	{  842411232,   665781362}, {  843431536,   664488336}, {  844449856,   663193747}, {  845466188,   661897597}, 
+	{  838310216,   670937767}, {  839338435,   669651026}, {  840364679,   668362709}, {  841388945,   667072820}, 
+	{  834177638,   676068911}, {  835213733,   674788504}, {  836247863,   673506508}, {  837280024,   672222928}, 
+	{  830013654,   681174602}, {  831057586,   679900576}, {  832099562,   678624950}, {  833139580,   677347728}, 
+	{  825818421,   686254647}, {  826870150,   684987051}, {  827919934,   683717842}, {  828967769,   682447025}, 
+	{  821592095,   691308855}, {  822651583,   690047736}, {  823709135,   688784993}, {  824764748,   687520629}, 
+	{  817334838,   696337036}, {  818402043,   695082441}, {  819467323,   693826211}, {  820530675,   692568348}, 
+	{  813046808,   701339000}, {  814121692,   700090977}, {  815194659,   698841307}, {  816265709,   697589992}, 
+	{  808728167,   706314559}, {  809810688,   705073155}, {  810891304,   703830092}, {  811970011,   702585372}, 
+	{  804379079,   711263525}, {  805469196,   710028787}, {  806557419,   708792378}, {  807643743,   707554301}, 
+	{  799999706,   716185713}, {  801097379,   714957687}, {  802193167,   713727978}, {  803287068,   712496590}, 
+	{  795590213,   721080937}, {  796695401,   719859669}, {  797798714,   718636707}, {  798900150,   717412054}, 
+	{  791150767,   725949013}, {  792263427,   724734549}, {  793374223,   723518380}, {  794483153,   722300508}, 
+	{  786681534,   730789757}, {  787801625,   729582143}, {  788919863,   728372813}, {  790036244,   727161768}, 
+	{  782182683,   735602987}, {  783310163,   734402269}, {  784435800,   733199822}, {  785559591,   731995651}, 
+	{  777654384,   740388522}, {  778789210,   739194745}, {  779922204,   737999228}, {  781053363,   736801974}, 
+	{  773096806,   745146182}, {  774238936,   743959390}, {  775379244,   742770848}, {  776517728,   741580558}, 
+	{  768510122,   749875788}, {  769659512,   748696026}, {  770807092,   747514503}, {  771952857,   746331221}, 
+	{  763894504,   754577161}, {  765051111,   753404474}, {  766205919,   752230015}, {  767358923,   751053785}, 
+	{  759250125,   759250125}, {  760413906,   758084557}, {  761575898,   756917205}, {  762736098,   755748072}, 
+	{  754577161,   763894504}, {  755748072,   762736098}, {  756917205,   761575898}, {  758084557,   760413906}, 
+	{  749875788,   768510122}, {  751053785,   767358923}, {  752230015,   766205919}, {  753404474,   765051111}, 
+	{  745146182,   773096806}, {  746331221,   771952857}, {  747514503,   770807092}, {  748696026,   769659512}, 
+	{  740388522,   777654384}, {  741580558,   776517728}, {  742770848,   775379244}, {  743959390,   774238936}, 
+	{  735602987,   782182683}, {  736801974,   781053363}, {  737999228,   779922204}, {  739194745,   778789210}, 
+	{  730789757,   786681534}, {  731995651,   785559591}, {  733199822,   784435800}, {  734402269,   783310163}, 
+	{  725949013,   791150767}, {  727161768,   790036244}, {  728372813,   788919863}, {  729582143,   787801625}, 
+	{  721080937,   795590213}, {  722300508,   794483153}, {  723518380,   793374223}, {  724734549,   792263427}, 
+	{  716185713,   799999706}, {  717412054,   798900150}, {  718636707,   797798714}, {  719859669,   796695401}, 
+	{  711263525,   804379079}, {  712496590,   803287068}, {  713727978,   802193167}, {  714957687,   801097379}, 
+	{  706314559,   808728167}, {  707554301,   807643743}, {  708792378,   806557419}, {  710028787,   805469196}, 
+	{  701339000,   813046808}, {  702585372,   811970011}, {  703830092,   810891304}, {  705073155,   809810688}, 
+	{  696337036,   817334838}, {  697589992,   816265709}, {  698841307,   815194659}, {  700090977,   814121692}, 
+	{  691308855,   821592095}, {  692568348,   820530675}, {  693826211,   819467323}, {  695082441,   818402043}, 
+	{  686254647,   825818421}, {  687520629,   824764748}, {  688784993,   823709135}, {  690047736,   822651583}, 
+	{  681174602,   830013654}, {  682447025,   828967769}, {  683717842,   827919934}, {  684987051,   826870150}, 
+	{  676068911,   834177638}, {  677347728,   833139580}, {  678624950,   832099562}, {  679900576,   831057586}, 
+	{  670937767,   838310216}, {  672222928,   837280024}, {  673506508,   836247863}, {  674788504,   835213733}, 
+	{  665781362,   842411232}, {  667072820,   841388945}, {  668362709,   840364679}, {  669651026,   839338435}, 
+	{  660599890,   846480531}, {  661897597,   845466188}, {  663193747,   844449856}, {  664488336,   843431536}, 
+	{  655393548,   850517961}, {  656697454,   849511600}, {  657999816,   848503239}, {  659300629,   847492882}, 
+	{  650162530,   854523370}, {  651472587,   853525028}, {  652781111,   852524677}, {  654088099,   851522321}, 
+	{  644907034,   858496606}, {  646223192,   857506321}, {  647537830,   856514019}, {  648850943,   855519701}, 
+	{  639627258,   862437520}, {  640949467,   861455330}, {  642270169,   860471112}, {  643589359,   859484870}, 
+	{  634323400,   866345964}, {  635651611,   865371905}, {  636978327,   864395810}, {  638303543,   863417681}, 
+	{  628995660,   870221790}, {  630329823,   869255900}, {  631662503,   868287963}, {  632993696,   867317984}, 
+	{  623644239,   874064853}, {  624984303,   873107167}, {  626322897,   872147426}, {  627660017,   871185633}, 
+	{  618269338,   877875009}, {  619615253,   876925563}, {  620959711,   875974054}, {  622302707,   875020483}, 
+	{  612871159,   881652112}, {  614222875,   880710943}, {  615573145,   879767701}, {  616921967,   878822389}, 
+	{  607449906,   885396022}, {  608807372,   884463164}, {  610163404,   883528225}, {  611518001,   882591207}, 
+	{  602005783,   889106597}, {  603368947,   888182086}, {  604730691,   887255485}, {  606091012,   886326796}, 
+	{  596538995,   892783698}, {  597907806,   891867569}, {  599275210,   890949341}, {  600641203,   890029016}, 
+	{  591049748,   896427186}, {  592424154,   895519473}, {  593797166,   894609652}, {  595168781,   893697727}, 
+	{  585538248,   900036924}, {  586918198,   899137661}, {  588296766,   898236282}, {  589673951,   897332790}, 
+	{  580004702,   903612776}, {  581390144,   902721998}, {  582774218,   901829095}, {  584156920,   900934069}, 
+	{  574449320,   907154608}, {  575840202,   906272347}, {  577229728,   905387953}, {  578617896,   904501429}, 
+	{  568872310,   910662286}, {  570268579,   909788576}, {  571663506,   908912725}, {  573057087,   908034735}, 
+	{  563273883,   914135678}, {  564675486,   913270551}, {  566075761,   912403276}, {  567474703,   911533853}, 
+	{  557654248,   917574653}, {  559061133,   916718143}, {  560466703,   915859476}, {  561870954,   914998653}, 
+	{  552013618,   920979082}, {  553425732,   920131221}, {  554836544,   919281194}, {  556246051,   918429004}, 
+	{  546352205,   924348837}, {  547769495,   923509656}, {  549185496,   922668302}, {  550600205,   921824777}, 
+	{  540670223,   927683790}, {  542092635,   926853322}, {  543513772,   926020672}, {  544933630,   925185843}, 
+	{  534967884,   930983817}, {  536395365,   930162092}, {  537821584,   929338177}, {  539246538,   928512076}, 
+	{  529245404,   934248793}, {  530677900,   933435842}, {  532109148,   932620694}, {  533539144,   931803352}, 
+	{  523502998,   937478595}, {  524940456,   936674448}, {  526376678,   935868098}, {  527811662,   935059546}, 
+	{  517740883,   940673101}, {  519183248,   939877790}, {  520624391,   939080267}, {  522064309,   938280535}, 
+	{  511959275,   943832191}, {  513406493,   943045745}, {  514852502,   942257081}, {  516297300,   941466198}, 
+	{  506158392,   946955747}, {  507610408,   946178196}, {  509061229,   945398418}, {  510510853,   944616416}, 
+	{  500338453,   950043650}, {  501795212,   949275023}, {  503250791,   948504163}, {  504705185,   947731070}, 
+	{  494499676,   953095785}, {  495961124,   952336111}, {  497421405,   951574196}, {  498880516,   950810042}, 
+	{  488642281,   956112036}, {  490108363,   955361344}, {  491573292,   954608403}, {  493037064,   953853216}, 
+	{  482766489,   959092290}, {  484237150,   958350608}, {  485706671,   957606670}, {  487175049,   956860479}, 
+	{  476872522,   962036435}, {  478347705,   961303790}, {  479821764,   960568883}, {  481294693,   959831716}, 
+	{  470960600,   964944360}, {  472440251,   964220780}, {  473918791,   963494932}, {  475396216,   962766816}, 
+	{  465030947,   967815955}, {  466515010,   967101468}, {  467997976,   966384706}, {  469479840,   965665669}, 
+	{  459083786,   970651112}, {  460572205,   969945745}, {  462059541,   969238095}, {  463545789,   968528165}, 
+	{  453119340,   973449725}, {  454612060,   972753504}, {  456103710,   972054994}, {  457594286,   971354196}, 
+	{  447137835,   976211688}, {  448634799,   975524639}, {  450130706,   974835295}, {  451625555,   974143656}, 
+	{  441139496,   978936898}, {  442640647,   978259047}, {  444140756,   977578894}, {  445639820,   976896441}, 
+	{  435124548,   981625251}, {  436629829,   980956623}, {  438134084,   980285688}, {  439637307,   979612445}, 
+	{  429093217,   984276646}, {  430602573,   983617267}, {  432110916,   982955574}, {  433618242,   982291568}, 
+	{  423045732,   986890984}, {  424559105,   986240879}, {  426071480,   985588453}, {  427582852,   984933708}, 
+	{  416982319,   989468165}, {  418499653,   988827359}, {  420016002,   988184225}, {  421531363,   987538766}, 
+	{  410903207,   992008094}, {  412424444,   991376610}, {  413944711,   990742793}, {  415464004,   990106644}, 
+	{  404808624,   994510675}, {  406333708,   993888536}, {  407857835,   993264059}, {  409381002,   992637245}, 
+	{  398698801,   996975812}, {  400227673,   996363043}, {  401755603,   995747930}, {  403282588,   995130473}, 
+	{  392573967,   999403415}, {  394106570,   998800038}, {  395638246,   998194311}, {  397168991,   997586236}, 
+	{  386434353,  1001793390}, {  387970630,  1001199428}, {  389505993,  1000603111}, {  391040440,  1000004439}, 
+	{  380280190,  1004145648}, {  381820082,  1003561124}, {  383359076,  1002974239}, {  384897167,  1002384994}, 
+	{  374111709,  1006460100}, {  375655159,  1005885036}, {  377197725,  1005307605}, {  378739403,  1004727809}, 
+	{  367929144,  1008736660}, {  369476093,  1008171077}, {  371022173,  1007603122}, {  372567379,  1007032796}, 
+	{  361732726,  1010975242}, {  363283116,  1010419162}, {  364832652,  1009860704}, {  366381329,  1009299870}, 
+	{  355522689,  1013175761}, {  357076462,  1012629204}, {  358629395,  1012080264}, {  360181484,  1011528943}, 
+	{  349299266,  1015338134}, {  350856364,  1014801122}, {  352412636,  1014261721}, {  353968079,  1013719934}, 
+	{  343062693,  1017462281}, {  344623057,  1016934832}, {  346182609,  1016404991}, {  347741347,  1015872758}, 
+	{  336813204,  1019548121}, {  338376774,  1019030256}, {  339939549,  1018509994}, {  341501523,  1017987335}, 
+	{  330551034,  1021595575}, {  332117752,  1021087314}, {  333683689,  1020576651}, {  335248841,  1020063586}, 
+	{  324276419,  1023604567}, {  325846226,  1023105929}, {  327415267,  1022604883}, {  328983538,  1022101432}, 
+	{  317989595,  1025575020}, {  319562433,  1025086024}, {  321134518,  1024594615}, {  322705848,  1024100796}, 
+	{  311690799,  1027506862}, {  313266607,  1027027525}, {  314841679,  1026545772}, {  316416009,  1026061603}, 
+	{  305380268,  1029400018}, {  306958988,  1028930359}, {  308536985,  1028458280}, {  310114257,  1027983780}, 
+	{  299058239,  1031254418}, {  300639811,  1030794455}, {  302220676,  1030332067}, {  303800829,  1029867254}, 
+	{  292724951,  1033069992}, {  294309316,  1032619742}, {  295892988,  1032167062}, {  297475964,  1031711954}, 
+	{  286380643,  1034846671}, {  287967740,  1034406151}, {  289554160,  1033963197}, {  291139898,  1033517810}, 
+	{  280025552,  1036584389}, {  281615322,  1036153615}, {  283204430,  1035720404}, {  284792871,  1035284755}, 
+	{  273659918,  1038283080}, {  275252302,  1037862069}, {  276844038,  1037438617}, {  278435122,  1037012723}, 
+	{  267283981,  1039942680}, {  268878918,  1039531448}, {  270473223,  1039117770}, {  272066891,  1038701647}, 
+	{  260897982,  1041563127}, {  262495412,  1041161689}, {  264092224,  1040757802}, {  265688415,  1040351465}, 
+	{  254502159,  1043144360}, {  256102022,  1042752731}, {  257701283,  1042358649}, {  259299937,  1041962114}, 
+	{  248096755,  1044686319}, {  249698991,  1044304514}, {  251300640,  1043920252}, {  252901697,  1043533534}, 
+	{  241682010,  1046188946}, {  243286558,  1045816980}, {  244890535,  1045442553}, {  246493935,  1045065665}, 
+	{  235258165,  1047652185}, {  236864966,  1047290071}, {  238471210,  1046925492}, {  240076892,  1046558451}, 
+	{  228825464,  1049075980}, {  230434456,  1048723732}, {  232042906,  1048369016}, {  233650811,  1048011834}, 
+	{  222384147,  1050460278}, {  223995270,  1050117909}, {  225605867,  1049773069}, {  227215933,  1049425759}, 
+	{  215934457,  1051805027}, {  217547651,  1051472550}, {  219160334,  1051137599}, {  220772500,  1050800175}, 
+	{  209476638,  1053110176}, {  211091842,  1052787604}, {  212706549,  1052462555}, {  214320755,  1052135029}, 
+	{  203010932,  1054375676}, {  204628085,  1054063021}, {  206244756,  1053747885}, {  207860942,  1053430270}, 
+	{  196537583,  1055601479}, {  198156624,  1055298753}, {  199775198,  1054993543}, {  201393302,  1054685850}, 
+	{  190056834,  1056787540}, {  191677702,  1056494753}, {  193298119,  1056199480}, {  194918080,  1055901722}, 
+	{  183568930,  1057933813}, {  185191564,  1057650977}, {  186813762,  1057365653}, {  188435520,  1057077840}, 
+	{  177074115,  1059040255}, {  178698453,  1058767381}, {  180322371,  1058492016}, {  181945865,  1058214159}, 
+	{  170572633,  1060106826}, {  172198615,  1059843923}, {  173824192,  1059578527}, {  175449360,  1059310638}, 
+	{  164064728,  1061133483}, {  165692293,  1060880563}, {  167319468,  1060625146}, {  168946249,  1060367233}, 
+	{  157550647,  1062120190}, {  159179733,  1061877261}, {  160808445,  1061631833}, {  162436778,  1061383907}, 
+	{  151030634,  1063066909}, {  152661180,  1062833980}, {  154291367,  1062598550}, {  155921191,  1062360620}, 
+	{  144504935,  1063973603}, {  146136880,  1063750684}, {  147768480,  1063525261}, {  149399733,  1063297336}, 
+	{  137973796,  1064840240}, {  139607077,  1064627338}, {  141240030,  1064411931}, {  142872651,  1064194019}, 
+	{  131437462,  1065666786}, {  133072019,  1065463909}, {  134706263,  1065258526}, {  136340190,  1065050636}, 
+	{  124896179,  1066453210}, {  126531950,  1066260367}, {  128167423,  1066065015}, {  129802595,  1065867154}, 
+	{  118350194,  1067199483}, {  119987118,  1067016680}, {  121623759,  1066831367}, {  123260114,  1066643544}, 
+	{  111799753,  1067905576}, {  113437768,  1067732821}, {  115075515,  1067557554}, {  116712992,  1067379774}, 
+	{  105245103,  1068571464}, {  106884147,  1068408763}, {  108522939,  1068243547}, {  110161476,  1068075818}, 
+	{   98686491,  1069197120}, {  100326502,  1069044479}, {  101966277,  1068889322}, {  103605812,  1068731650}, 
+	{   92124163,  1069782521}, {   93765079,  1069639946}, {   95405776,  1069494854}, {   97046247,  1069347245}, 
+	{   85558366,  1070327646}, {   87200127,  1070195142}, {   88841683,  1070060120}, {   90483029,  1069922579}, 
+	{   78989349,  1070832474}, {   80631892,  1070710046}, {   82274245,  1070585099}, {   83916404,  1070457632}, 
+	{   72417357,  1071296985}, {   74060620,  1071184638}, {   75703709,  1071069770}, {   77346620,  1070952382}, 
+	{   65842639,  1071721163}, {   67486561,  1071618901}, {   69130324,  1071514117}, {   70773924,  1071406812}, 
+	{   59265442,  1072104991}, {   60909960,  1072012818}, {   62554335,  1071918122}, {   64198563,  1071820903}, 
+	{   52686014,  1072448455}, {   54331067,  1072366374}, {   55975992,  1072281769}, {   57620785,  1072194642}, 
+	{   46104602,  1072751542}, {   47750128,  1072679556}, {   49395541,  1072605046}, {   51040837,  1072528012}, 
+	{   39521455,  1073014240}, {   41167391,  1072952352}, {   42813230,  1072887940}, {   44458968,  1072821003}, 
+	{   32936819,  1073236540}, {   34583104,  1073184753}, {   36229307,  1073130440}, {   37875426,  1073073603}, 
+	{   26350943,  1073418433}, {   27997515,  1073376748}, {   29644021,  1073332538}, {   31290457,  1073285802}, 
+	{   19764076,  1073559913}, {   21410872,  1073528332}, {   23057618,  1073494225}, {   24704310,  1073457592}, 
+	{   13176464,  1073660973}, {   14823423,  1073639498}, {   16470347,  1073615496}, {   18117233,  1073588967}, 
+	{    6588356,  1073721611}, {    8235416,  1073710241}, {    9882456,  1073696345}, {   11529474,  1073679922}, 
+	{          0,  1073741824}, {    1647099,  1073740561}, {    3294193,  1073736771}, {    4941281,  1073730454}, 
+	{   -6588356,  1073721611}, {   -4941281,  1073730454}, {   -3294193,  1073736771}, {   -1647099,  1073740561}, 
+	{  -13176464,  1073660973}, {  -11529474,  1073679922}, {   -9882456,  1073696345}, {   -8235416,  1073710241}, 
+	{  -19764076,  1073559913}, {  -18117233,  1073588967}, {  -16470347,  1073615496}, {  -14823423,  1073639498}, 
+	{  -26350943,  1073418433}, {  -24704310,  1073457592}, {  -23057618,  1073494225}, {  -21410872,  1073528332}, 
+	{  -32936819,  1073236540}, {  -31290457,  1073285802}, {  -29644021,  1073332538}, {  -27997515,  1073376748}, 
+	{  -39521455,  1073014240}, {  -37875426,  1073073603}, {  -36229307,  1073130440}, {  -34583104,  1073184753}, 
+	{  -46104602,  1072751542}, {  -44458968,  1072821003}, {  -42813230,  1072887940}, {  -41167391,  1072952352}, 
+	{  -52686014,  1072448455}, {  -51040837,  1072528012}, {  -49395541,  1072605046}, {  -47750128,  1072679556}, 
+	{  -59265442,  1072104991}, {  -57620785,  1072194642}, {  -55975992,  1072281769}, {  -54331067,  1072366374}, 
+	{  -65842639,  1071721163}, {  -64198563,  1071820903}, {  -62554335,  1071918122}, {  -60909960,  1072012818}, 
+	{  -72417357,  1071296985}, {  -70773924,  1071406812}, {  -69130324,  1071514117}, {  -67486561,  1071618901}, 
+	{  -78989349,  1070832474}, {  -77346620,  1070952382}, {  -75703709,  1071069770}, {  -74060620,  1071184638}, 
+	{  -85558366,  1070327646}, {  -83916404,  1070457632}, {  -82274245,  1070585099}, {  -80631892,  1070710046}, 
+	{  -92124163,  1069782521}, {  -90483029,  1069922579}, {  -88841683,  1070060120}, {  -87200127,  1070195142}, 
+	{  -98686491,  1069197120}, {  -97046247,  1069347245}, {  -95405776,  1069494854}, {  -93765079,  1069639946}, 
+	{ -105245103,  1068571464}, { -103605812,  1068731650}, { -101966277,  1068889322}, { -100326502,  1069044479}, 
+	{ -111799753,  1067905576}, { -110161476,  1068075818}, { -108522939,  1068243547}, { -106884147,  1068408763}, 
+	{ -118350194,  1067199483}, { -116712992,  1067379774}, { -115075515,  1067557554}, { -113437768,  1067732821}, 
+	{ -124896179,  1066453210}, { -123260114,  1066643544}, { -121623759,  1066831367}, { -119987118,  1067016680}, 
+	{ -131437462,  1065666786}, { -129802595,  1065867154}, { -128167423,  1066065015}, { -126531950,  1066260367}, 
+	{ -137973796,  1064840240}, { -136340190,  1065050636}, { -134706263,  1065258526}, { -133072019,  1065463909}, 
+	{ -144504935,  1063973603}, { -142872651,  1064194019}, { -141240030,  1064411931}, { -139607077,  1064627338}, 
+	{ -151030634,  1063066909}, { -149399733,  1063297336}, { -147768480,  1063525261}, { -146136880,  1063750684}, 
+	{ -157550647,  1062120190}, { -155921191,  1062360620}, { -154291367,  1062598550}, { -152661180,  1062833980}, 
+	{ -164064728,  1061133483}, { -162436778,  1061383907}, { -160808445,  1061631833}, { -159179733,  1061877261}, 
+	{ -170572633,  1060106826}, { -168946249,  1060367233}, { -167319468,  1060625146}, { -165692293,  1060880563}, 
+	{ -177074115,  1059040255}, { -175449360,  1059310638}, { -173824192,  1059578527}, { -172198615,  1059843923}, 
+	{ -183568930,  1057933813}, { -181945865,  1058214159}, { -180322371,  1058492016}, { -178698453,  1058767381}, 
+	{ -190056834,  1056787540}, { -188435520,  1057077840}, { -186813762,  1057365653}, { -185191564,  1057650977}, 
+	{ -196537583,  1055601479}, { -194918080,  1055901722}, { -193298119,  1056199480}, { -191677702,  1056494753}, 
+	{ -203010932,  1054375676}, { -201393302,  1054685850}, { -199775198,  1054993543}, { -198156624,  1055298753}, 
+	{ -209476638,  1053110176}, { -207860942,  1053430270}, { -206244756,  1053747885}, { -204628085,  1054063021}, 
+	{ -215934457,  1051805027}, { -214320755,  1052135029}, { -212706549,  1052462555}, { -211091842,  1052787604}, 
+	{ -222384147,  1050460278}, { -220772500,  1050800175}, { -219160334,  1051137599}, { -217547651,  1051472550}, 
+	{ -228825464,  1049075980}, { -227215933,  1049425759}, { -225605867,  1049773069}, { -223995270,  1050117909}, 
+	{ -235258165,  1047652185}, { -233650811,  1048011834}, { -232042906,  1048369016}, { -230434456,  1048723732}, 
+	{ -241682010,  1046188946}, { -240076892,  1046558451}, { -238471210,  1046925492}, { -236864966,  1047290071}, 
+	{ -248096755,  1044686319}, { -246493935,  1045065665}, { -244890535,  1045442553}, { -243286558,  1045816980}, 
+	{ -254502159,  1043144360}, { -252901697,  1043533534}, { -251300640,  1043920252}, { -249698991,  1044304514}, 
+	{ -260897982,  1041563127}, { -259299937,  1041962114}, { -257701283,  1042358649}, { -256102022,  1042752731}, 
+	{ -267283981,  1039942680}, { -265688415,  1040351465}, { -264092224,  1040757802}, { -262495412,  1041161689}, 
+	{ -273659918,  1038283080}, { -272066891,  1038701647}, { -270473223,  1039117770}, { -268878918,  1039531448}, 
+	{ -280025552,  1036584389}, { -278435122,  1037012723}, { -276844038,  1037438617}, { -275252302,  1037862069}, 
+	{ -286380643,  1034846671}, { -284792871,  1035284755}, { -283204430,  1035720404}, { -281615322,  1036153615}, 
+	{ -292724951,  1033069992}, { -291139898,  1033517810}, { -289554160,  1033963197}, { -287967740,  1034406151}, 
+	{ -299058239,  1031254418}, { -297475964,  1031711954}, { -295892988,  1032167062}, { -294309316,  1032619742}, 
+	{ -305380268,  1029400018}, { -303800829,  1029867254}, { -302220676,  1030332067}, { -300639811,  1030794455}, 
+	{ -311690799,  1027506862}, { -310114257,  1027983780}, { -308536985,  1028458280}, { -306958988,  1028930359}, 
+	{ -317989595,  1025575020}, { -316416009,  1026061603}, { -314841679,  1026545772}, { -313266607,  1027027525}, 
+	{ -324276419,  1023604567}, { -322705848,  1024100796}, { -321134518,  1024594615}, { -319562433,  1025086024}, 
+	{ -330551034,  1021595575}, { -328983538,  1022101432}, { -327415267,  1022604883}, { -325846226,  1023105929}, 
+	{ -336813204,  1019548121}, { -335248841,  1020063586}, { -333683689,  1020576651}, { -332117752,  1021087314}, 
+	{ -343062693,  1017462281}, { -341501523,  1017987335}, { -339939549,  1018509994}, { -338376774,  1019030256}, 
+	{ -349299266,  1015338134}, { -347741347,  1015872758}, { -346182609,  1016404991}, { -344623057,  1016934832}, 
+	{ -355522689,  1013175761}, { -353968079,  1013719934}, { -352412636,  1014261721}, { -350856364,  1014801122}, 
+	{ -361732726,  1010975242}, { -360181484,  1011528943}, { -358629395,  1012080264}, { -357076462,  1012629204}, 
+	{ -367929144,  1008736660}, { -366381329,  1009299870}, { -364832652,  1009860704}, { -363283116,  1010419162}, 
+	{ -374111709,  1006460100}, { -372567379,  1007032796}, { -371022173,  1007603122}, { -369476093,  1008171077}, 
+	{ -380280190,  1004145648}, { -378739403,  1004727809}, { -377197725,  1005307605}, { -375655159,  1005885036}, 
+	{ -386434353,  1001793390}, { -384897167,  1002384994}, { -383359076,  1002974239}, { -381820082,  1003561124}, 
+	{ -392573967,   999403415}, { -391040440,  1000004439}, { -389505993,  1000603111}, { -387970630,  1001199428}, 
+	{ -398698801,   996975812}, { -397168991,   997586236}, { -395638246,   998194311}, { -394106570,   998800038}, 
+	{ -404808624,   994510675}, { -403282588,   995130473}, { -401755603,   995747930}, { -400227673,   996363043}, 
+	{ -410903207,   992008094}, { -409381002,   992637245}, { -407857835,   993264059}, { -406333708,   993888536}, 
+	{ -416982319,   989468165}, { -415464004,   990106644}, { -413944711,   990742793}, { -412424444,   991376610}, 
+	{ -423045732,   986890984}, { -421531363,   987538766}, { -420016002,   988184225}, { -418499653,   988827359}, 
+	{ -429093217,   984276646}, { -427582852,   984933708}, { -426071480,   985588453}, { -424559105,   986240879}, 
+	{ -435124548,   981625251}, { -433618242,   982291568}, { -432110916,   982955574}, { -430602573,   983617267}, 
+	{ -441139496,   978936898}, { -439637307,   979612445}, { -438134084,   980285688}, { -436629829,   980956623}, 
+	{ -447137835,   976211688}, { -445639820,   976896441}, { -444140756,   977578894}, { -442640647,   978259047}, 
+	{ -453119340,   973449725}, { -451625555,   974143656}, { -450130706,   974835295}, { -448634799,   975524639}, 
+	{ -459083786,   970651112}, { -457594286,   971354196}, { -456103710,   972054994}, { -454612060,   972753504}, 
+	{ -465030947,   967815955}, { -463545789,   968528165}, { -462059541,   969238095}, { -460572205,   969945745}, 
+	{ -470960600,   964944360}, { -469479840,   965665669}, { -467997976,   966384706}, { -466515010,   967101468}, 
+	{ -476872522,   962036435}, { -475396216,   962766816}, { -473918791,   963494932}, { -472440251,   964220780}, 
+	{ -482766489,   959092290}, { -481294693,   959831716}, { -479821764,   960568883}, { -478347705,   961303790}, 
+	{ -488642281,   956112036}, { -487175049,   956860479}, { -485706671,   957606670}, { -484237150,   958350608}, 
+	{ -494499676,   953095785}, { -493037064,   953853216}, { -491573292,   954608403}, { -490108363,   955361344}, 
+	{ -500338453,   950043650}, { -498880516,   950810042}, { -497421405,   951574196}, { -495961124,   952336111}, 
+	{ -506158392,   946955747}, { -504705185,   947731070}, { -503250791,   948504163}, { -501795212,   949275023}, 
+	{ -511959275,   943832191}, { -510510853,   944616416}, { -509061229,   945398418}, { -507610408,   946178196}, 
+	{ -517740883,   940673101}, { -516297300,   941466198}, { -514852502,   942257081}, { -513406493,   943045745}, 
+	{ -523502998,   937478595}, { -522064309,   938280535}, { -520624391,   939080267}, { -519183248,   939877790}, 
+	{ -529245404,   934248793}, { -527811662,   935059546}, { -526376678,   935868098}, { -524940456,   936674448}, 
+	{ -534967884,   930983817}, { -533539144,   931803352}, { -532109148,   932620694}, { -530677900,   933435842}, 
+	{ -540670223,   927683790}, { -539246538,   928512076}, { -537821584,   929338177}, { -536395365,   930162092}, 
+	{ -546352205,   924348837}, { -544933630,   925185843}, { -543513772,   926020672}, { -542092635,   926853322}, 
+	{ -552013618,   920979082}, { -550600205,   921824777}, { -549185496,   922668302}, { -547769495,   923509656}, 
+	{ -557654248,   917574653}, { -556246051,   918429004}, { -554836544,   919281194}, { -553425732,   920131221}, 
+	{ -563273883,   914135678}, { -561870954,   914998653}, { -560466703,   915859476}, { -559061133,   916718143}, 
+	{ -568872310,   910662286}, { -567474703,   911533853}, { -566075761,   912403276}, { -564675486,   913270551}, 
+	{ -574449320,   907154608}, { -573057087,   908034735}, { -571663506,   908912725}, { -570268579,   909788576}, 
+	{ -580004702,   903612776}, { -578617896,   904501429}, { -577229728,   905387953}, { -575840202,   906272347}, 
+	{ -585538248,   900036924}, { -584156920,   900934069}, { -582774218,   901829095}, { -581390144,   902721998}, 
+	{ -591049748,   896427186}, { -589673951,   897332790}, { -588296766,   898236282}, { -586918198,   899137661}, 
+	{ -596538995,   892783698}, { -595168781,   893697727}, { -593797166,   894609652}, { -592424154,   895519473}, 
+	{ -602005783,   889106597}, { -600641203,   890029016}, { -599275210,   890949341}, { -597907806,   891867569}, 
+	{ -607449906,   885396022}, { -606091012,   886326796}, { -604730691,   887255485}, { -603368947,   888182086}, 
+	{ -612871159,   881652112}, { -611518001,   882591207}, { -610163404,   883528225}, { -608807372,   884463164}, 
+	{ -618269338,   877875009}, { -616921967,   878822389}, { -615573145,   879767701}, { -614222875,   880710943}, 
+	{ -623644239,   874064853}, { -622302707,   875020483}, { -620959711,   875974054}, { -619615253,   876925563}, 
+	{ -628995660,   870221790}, { -627660017,   871185633}, { -626322897,   872147426}, { -624984303,   873107167}, 
+	{ -634323400,   866345964}, { -632993696,   867317984}, { -631662503,   868287963}, { -630329823,   869255900}, 
+	{ -639627258,   862437520}, { -638303543,   863417681}, { -636978327,   864395810}, { -635651611,   865371905}, 
+	{ -644907034,   858496606}, { -643589359,   859484870}, { -642270169,   860471112}, { -640949467,   861455330}, 
+	{ -650162530,   854523370}, { -648850943,   855519701}, { -647537830,   856514019}, { -646223192,   857506321}, 
+	{ -655393548,   850517961}, { -654088099,   851522321}, { -652781111,   852524677}, { -651472587,   853525028}, 
+	{ -660599890,   846480531}, { -659300629,   847492882}, { -657999816,   848503239}, { -656697454,   849511600}, 
+	{ -665781362,   842411232}, { -664488336,   843431536}, { -663193747,   844449856}, { -661897597,   845466188}, 
+	{ -670937767,   838310216}, { -669651026,   839338435}, { -668362709,   840364679}, { -667072820,   841388945}, 
+	{ -676068911,   834177638}, { -674788504,   835213733}, { -673506508,   836247863}, { -672222928,   837280024}, 
+	{ -681174602,   830013654}, { -679900576,   831057586}, { -678624950,   832099562}, { -677347728,   833139580}, 
+	{ -686254647,   825818421}, { -684987051,   826870150}, { -683717842,   827919934}, { -682447025,   828967769}, 
+	{ -691308855,   821592095}, { -690047736,   822651583}, { -688784993,   823709135}, { -687520629,   824764748}, 
+	{ -696337036,   817334838}, { -695082441,   818402043}, { -693826211,   819467323}, { -692568348,   820530675}, 
+	{ -701339000,   813046808}, { -700090977,   814121692}, { -698841307,   815194659}, { -697589992,   816265709}, 
+	{ -706314559,   808728167}, { -705073155,   809810688}, { -703830092,   810891304}, { -702585372,   811970011}, 
+	{ -711263525,   804379079}, { -710028787,   805469196}, { -708792378,   806557419}, { -707554301,   807643743}, 
+	{ -716185713,   799999706}, { -714957687,   801097379}, { -713727978,   802193167}, { -712496590,   803287068}, 
+	{ -721080937,   795590213}, { -719859669,   796695401}, { -718636707,   797798714}, { -717412054,   798900150}, 
+	{ -725949013,   791150767}, { -724734549,   792263427}, { -723518380,   793374223}, { -722300508,   794483153}, 
+	{ -730789757,   786681534}, { -729582143,   787801625}, { -728372813,   788919863}, { -727161768,   790036244}, 
+	{ -735602987,   782182683}, { -734402269,   783310163}, { -733199822,   784435800}, { -731995651,   785559591}, 
+	{ -740388522,   777654384}, { -739194745,   778789210}, { -737999228,   779922204}, { -736801974,   781053363}, 
+	{ -745146182,   773096806}, { -743959390,   774238936}, { -742770848,   775379244}, { -741580558,   776517728}, 
+	{ -749875788,   768510122}, { -748696026,   769659512}, { -747514503,   770807092}, { -746331221,   771952857}, 
+	{ -754577161,   763894504}, { -753404474,   765051111}, { -752230015,   766205919}, { -751053785,   767358923}, 
+	{ -759250125,   759250125}, { -758084557,   760413906}, { -756917205,   761575898}, { -755748072,   762736098}, 
+	{ -763894504,   754577161}, { -762736098,   755748072}, { -761575898,   756917205}, { -760413906,   758084557}, 
+	{ -768510122,   749875788}, { -767358923,   751053785}, { -766205919,   752230015}, { -765051111,   753404474}, 
+	{ -773096806,   745146182}, { -771952857,   746331221}, { -770807092,   747514503}, { -769659512,   748696026}, 
+	{ -777654384,   740388522}, { -776517728,   741580558}, { -775379244,   742770848}, { -774238936,   743959390}, 
+	{ -782182683,   735602987}, { -781053363,   736801974}, { -779922204,   737999228}, { -778789210,   739194745}, 
+	{ -786681534,   730789757}, { -785559591,   731995651}, { -784435800,   733199822}, { -783310163,   734402269}, 
+	{ -791150767,   725949013}, { -790036244,   727161768}, { -788919863,   728372813}, { -787801625,   729582143}, 
+	{ -795590213,   721080937}, { -794483153,   722300508}, { -793374223,   723518380}, { -792263427,   724734549}, 
+	{ -799999706,   716185713}, { -798900150,   717412054}, { -797798714,   718636707}, { -796695401,   719859669}, 
+	{ -804379079,   711263525}, { -803287068,   712496590}, { -802193167,   713727978}, { -801097379,   714957687}, 
+	{ -808728167,   706314559}, { -807643743,   707554301}, { -806557419,   708792378}, { -805469196,   710028787}, 
+	{ -813046808,   701339000}, { -811970011,   702585372}, { -810891304,   703830092}, { -809810688,   705073155}, 
+	{ -817334838,   696337036}, { -816265709,   697589992}, { -815194659,   698841307}, { -814121692,   700090977}, 
+	{ -821592095,   691308855}, { -820530675,   692568348}, { -819467323,   693826211}, { -818402043,   695082441}, 
+	{ -825818421,   686254647}, { -824764748,   687520629}, { -823709135,   688784993}, { -822651583,   690047736}, 
+	{ -830013654,   681174602}, { -828967769,   682447025}, { -827919934,   683717842}, { -826870150,   684987051}, 
+	{ -834177638,   676068911}, { -833139580,   677347728}, { -832099562,   678624950}, { -831057586,   679900576}, 
+	{ -838310216,   670937767}, { -837280024,   672222928}, { -836247863,   673506508}, { -835213733,   674788504}, 
+	{ -842411232,   665781362}, { -841388945,   667072820}, { -840364679,   668362709}, { -839338435,   669651026}, 
+	{ -846480531,   660599890}, { -845466188,   661897597}, { -844449856,   663193747}, { -843431536,   664488336}, 
+	{ -850517961,   655393548}, { -849511600,   656697454}, { -848503239,   657999816}, { -847492882,   659300629}, 
+	{ -854523370,   650162530}, { -853525028,   651472587}, { -852524677,   652781111}, { -851522321,   654088099}, 
+	{ -858496606,   644907034}, { -857506321,   646223192}, { -856514019,   647537830}, { -855519701,   648850943}, 
+	{ -862437520,   639627258}, { -861455330,   640949467}, { -860471112,   642270169}, { -859484870,   643589359}, 
+	{ -866345964,   634323400}, { -865371905,   635651611}, { -864395810,   636978327}, { -863417681,   638303543}, 
+	{ -870221790,   628995660}, { -869255900,   630329823}, { -868287963,   631662503}, { -867317984,   632993696}, 
+	{ -874064853,   623644239}, { -873107167,   624984303}, { -872147426,   626322897}, { -871185633,   627660017}, 
+	{ -877875009,   618269338}, { -876925563,   619615253}, { -875974054,   620959711}, { -875020483,   622302707}, 
+	{ -881652112,   612871159}, { -880710943,   614222875}, { -879767701,   615573145}, { -878822389,   616921967}, 
+	{ -885396022,   607449906}, { -884463164,   608807372}, { -883528225,   610163404}, { -882591207,   611518001}, 
+	{ -889106597,   602005783}, { -888182086,   603368947}, { -887255485,   604730691}, { -886326796,   606091012}, 
+	{ -892783698,   596538995}, { -891867569,   597907806}, { -890949341,   599275210}, { -890029016,   600641203}, 
+	{ -896427186,   591049748}, { -895519473,   592424154}, { -894609652,   593797166}, { -893697727,   595168781}, 
+	{ -900036924,   585538248}, { -899137661,   586918198}, { -898236282,   588296766}, { -897332790,   589673951}, 
+	{ -903612776,   580004702}, { -902721998,   581390144}, { -901829095,   582774218}, { -900934069,   584156920}, 
+	{ -907154608,   574449320}, { -906272347,   575840202}, { -905387953,   577229728}, { -904501429,   578617896}, 
+	{ -910662286,   568872310}, { -909788576,   570268579}, { -908912725,   571663506}, { -908034735,   573057087}, 
+	{ -914135678,   563273883}, { -913270551,   564675486}, { -912403276,   566075761}, { -911533853,   567474703}, 
+	{ -917574653,   557654248}, { -916718143,   559061133}, { -915859476,   560466703}, { -914998653,   561870954}, 
+	{ -920979082,   552013618}, { -920131221,   553425732}, { -919281194,   554836544}, { -918429004,   556246051}, 
+	{ -924348837,   546352205}, { -923509656,   547769495}, { -922668302,   549185496}, { -921824777,   550600205}, 
+	{ -927683790,   540670223}, { -926853322,   542092635}, { -926020672,   543513772}, { -925185843,   544933630}, 
+	{ -930983817,   534967884}, { -930162092,   536395365}, { -929338177,   537821584}, { -928512076,   539246538}, 
+	{ -934248793,   529245404}, { -933435842,   530677900}, { -932620694,   532109148}, { -931803352,   533539144}, 
+	{ -937478595,   523502998}, { -936674448,   524940456}, { -935868098,   526376678}, { -935059546,   527811662}, 
+	{ -940673101,   517740883}, { -939877790,   519183248}, { -939080267,   520624391}, { -938280535,   522064309}, 
+	{ -943832191,   511959275}, { -943045745,   513406493}, { -942257081,   514852502}, { -941466198,   516297300}, 
+	{ -946955747,   506158392}, { -946178196,   507610408}, { -945398418,   509061229}, { -944616416,   510510853}, 
+	{ -950043650,   500338453}, { -949275023,   501795212}, { -948504163,   503250791}, { -947731070,   504705185}, 
+	{ -953095785,   494499676}, { -952336111,   495961124}, { -951574196,   497421405}, { -950810042,   498880516}, 
+	{ -956112036,   488642281}, { -955361344,   490108363}, { -954608403,   491573292}, { -953853216,   493037064}, 
+	{ -959092290,   482766489}, { -958350608,   484237150}, { -957606670,   485706671}, { -956860479,   487175049}, 
+	{ -962036435,   476872522}, { -961303790,   478347705}, { -960568883,   479821764}, { -959831716,   481294693}, 
+	{ -964944360,   470960600}, { -964220780,   472440251}, { -963494932,   473918791}, { -962766816,   475396216}, 
+	{ -967815955,   465030947}, { -967101468,   466515010}, { -966384706,   467997976}, { -965665669,   469479840}, 
+	{ -970651112,   459083786}, { -969945745,   460572205}, { -969238095,   462059541}, { -968528165,   463545789}, 
+	{ -973449725,   453119340}, { -972753504,   454612060}, { -972054994,   456103710}, { -971354196,   457594286}, 
+	{ -976211688,   447137835}, { -975524639,   448634799}, { -974835295,   450130706}, { -974143656,   451625555}, 
+	{ -978936898,   441139496}, { -978259047,   442640647}, { -977578894,   444140756}, { -976896441,   445639820}, 
+	{ -981625251,   435124548}, { -980956623,   436629829}, { -980285688,   438134084}, { -979612445,   439637307}, 
+	{ -984276646,   429093217}, { -983617267,   430602573}, { -982955574,   432110916}, { -982291568,   433618242}, 
+	{ -986890984,   423045732}, { -986240879,   424559105}, { -985588453,   426071480}, { -984933708,   427582852}, 
+	{ -989468165,   416982319}, { -988827359,   418499653}, { -988184225,   420016002}, { -987538766,   421531363}, 
+	{ -992008094,   410903207}, { -991376610,   412424444}, { -990742793,   413944711}, { -990106644,   415464004}, 
+	{ -994510675,   404808624}, { -993888536,   406333708}, { -993264059,   407857835}, { -992637245,   409381002}, 
+	{ -996975812,   398698801}, { -996363043,   400227673}, { -995747930,   401755603}, { -995130473,   403282588}, 
+	{ -999403415,   392573967}, { -998800038,   394106570}, { -998194311,   395638246}, { -997586236,   397168991}, 
+	{-1001793390,   386434353}, {-1001199428,   387970630}, {-1000603111,   389505993}, {-1000004439,   391040440}, 
+	{-1004145648,   380280190}, {-1003561124,   381820082}, {-1002974239,   383359076}, {-1002384994,   384897167}, 
+	{-1006460100,   374111709}, {-1005885036,   375655159}, {-1005307605,   377197725}, {-1004727809,   378739403}, 
+	{-1008736660,   367929144}, {-1008171077,   369476093}, {-1007603122,   371022173}, {-1007032796,   372567379}, 
+	{-1010975242,   361732726}, {-1010419162,   363283116}, {-1009860704,   364832652}, {-1009299870,   366381329}, 
+	{-1013175761,   355522689}, {-1012629204,   357076462}, {-1012080264,   358629395}, {-1011528943,   360181484}, 
+	{-1015338134,   349299266}, {-1014801122,   350856364}, {-1014261721,   352412636}, {-1013719934,   353968079}, 
+	{-1017462281,   343062693}, {-1016934832,   344623057}, {-1016404991,   346182609}, {-1015872758,   347741347}, 
+	{-1019548121,   336813204}, {-1019030256,   338376774}, {-1018509994,   339939549}, {-1017987335,   341501523}, 
+	{-1021595575,   330551034}, {-1021087314,   332117752}, {-1020576651,   333683689}, {-1020063586,   335248841}, 
+	{-1023604567,   324276419}, {-1023105929,   325846226}, {-1022604883,   327415267}, {-1022101432,   328983538}, 
+	{-1025575020,   317989595}, {-1025086024,   319562433}, {-1024594615,   321134518}, {-1024100796,   322705848}, 
+	{-1027506862,   311690799}, {-1027027525,   313266607}, {-1026545772,   314841679}, {-1026061603,   316416009}, 
+	{-1029400018,   305380268}, {-1028930359,   306958988}, {-1028458280,   308536985}, {-1027983780,   310114257}, 
+	{-1031254418,   299058239}, {-1030794455,   300639811}, {-1030332067,   302220676}, {-1029867254,   303800829}, 
+	{-1033069992,   292724951}, {-1032619742,   294309316}, {-1032167062,   295892988}, {-1031711954,   297475964}, 
+	{-1034846671,   286380643}, {-1034406151,   287967740}, {-1033963197,   289554160}, {-1033517810,   291139898}, 
+	{-1036584389,   280025552}, {-1036153615,   281615322}, {-1035720404,   283204430}, {-1035284755,   284792871}, 
+	{-1038283080,   273659918}, {-1037862069,   275252302}, {-1037438617,   276844038}, {-1037012723,   278435122}, 
+	{-1039942680,   267283981}, {-1039531448,   268878918}, {-1039117770,   270473223}, {-1038701647,   272066891}, 
+	{-1041563127,   260897982}, {-1041161689,   262495412}, {-1040757802,   264092224}, {-1040351465,   265688415}, 
+	{-1043144360,   254502159}, {-1042752731,   256102022}, {-1042358649,   257701283}, {-1041962114,   259299937}, 
+	{-1044686319,   248096755}, {-1044304514,   249698991}, {-1043920252,   251300640}, {-1043533534,   252901697}, 
+	{-1046188946,   241682010}, {-1045816980,   243286558}, {-1045442553,   244890535}, {-1045065665,   246493935}, 
+	{-1047652185,   235258165}, {-1047290071,   236864966}, {-1046925492,   238471210}, {-1046558451,   240076892}, 
+	{-1049075980,   228825464}, {-1048723732,   230434456}, {-1048369016,   232042906}, {-1048011834,   233650811}, 
+	{-1050460278,   222384147}, {-1050117909,   223995270}, {-1049773069,   225605867}, {-1049425759,   227215933}, 
+	{-1051805027,   215934457}, {-1051472550,   217547651}, {-1051137599,   219160334}, {-1050800175,   220772500}, 
+	{-1053110176,   209476638}, {-1052787604,   211091842}, {-1052462555,   212706549}, {-1052135029,   214320755}, 
+	{-1054375676,   203010932}, {-1054063021,   204628085}, {-1053747885,   206244756}, {-1053430270,   207860942}, 
+	{-1055601479,   196537583}, {-1055298753,   198156624}, {-1054993543,   199775198}, {-1054685850,   201393302}, 
+	{-1056787540,   190056834}, {-1056494753,   191677702}, {-1056199480,   193298119}, {-1055901722,   194918080}, 
+	{-1057933813,   183568930}, {-1057650977,   185191564}, {-1057365653,   186813762}, {-1057077840,   188435520}, 
+	{-1059040255,   177074115}, {-1058767381,   178698453}, {-1058492016,   180322371}, {-1058214159,   181945865}, 
+	{-1060106826,   170572633}, {-1059843923,   172198615}, {-1059578527,   173824192}, {-1059310638,   175449360}, 
+	{-1061133483,   164064728}, {-1060880563,   165692293}, {-1060625146,   167319468}, {-1060367233,   168946249}, 
+	{-1062120190,   157550647}, {-1061877261,   159179733}, {-1061631833,   160808445}, {-1061383907,   162436778}, 
+	{-1063066909,   151030634}, {-1062833980,   152661180}, {-1062598550,   154291367}, {-1062360620,   155921191}, 
+	{-1063973603,   144504935}, {-1063750684,   146136880}, {-1063525261,   147768480}, {-1063297336,   149399733}, 
+	{-1064840240,   137973796}, {-1064627338,   139607077}, {-1064411931,   141240030}, {-1064194019,   142872651}, 
+	{-1065666786,   131437462}, {-1065463909,   133072019}, {-1065258526,   134706263}, {-1065050636,   136340190}, 
+	{-1066453210,   124896179}, {-1066260367,   126531950}, {-1066065015,   128167423}, {-1065867154,   129802595}, 
+	{-1067199483,   118350194}, {-1067016680,   119987118}, {-1066831367,   121623759}, {-1066643544,   123260114}, 
+	{-1067905576,   111799753}, {-1067732821,   113437768}, {-1067557554,   115075515}, {-1067379774,   116712992}, 
+	{-1068571464,   105245103}, {-1068408763,   106884147}, {-1068243547,   108522939}, {-1068075818,   110161476}, 
+	{-1069197120,    98686491}, {-1069044479,   100326502}, {-1068889322,   101966277}, {-1068731650,   103605812}, 
+	{-1069782521,    92124163}, {-1069639946,    93765079}, {-1069494854,    95405776}, {-1069347245,    97046247}, 
+	{-1070327646,    85558366}, {-1070195142,    87200127}, {-1070060120,    88841683}, {-1069922579,    90483029}, 
+	{-1070832474,    78989349}, {-1070710046,    80631892}, {-1070585099,    82274245}, {-1070457632,    83916404}, 
+	{-1071296985,    72417357}, {-1071184638,    74060620}, {-1071069770,    75703709}, {-1070952382,    77346620}, 
+	{-1071721163,    65842639}, {-1071618901,    67486561}, {-1071514117,    69130324}, {-1071406812,    70773924}, 
+	{-1072104991,    59265442}, {-1072012818,    60909960}, {-1071918122,    62554335}, {-1071820903,    64198563}, 
+	{-1072448455,    52686014}, {-1072366374,    54331067}, {-1072281769,    55975992}, {-1072194642,    57620785}, 
+	{-1072751542,    46104602}, {-1072679556,    47750128}, {-1072605046,    49395541}, {-1072528012,    51040837}, 
+	{-1073014240,    39521455}, {-1072952352,    41167391}, {-1072887940,    42813230}, {-1072821003,    44458968}, 
+	{-1073236540,    32936819}, {-1073184753,    34583104}, {-1073130440,    36229307}, {-1073073603,    37875426}, 
+	{-1073418433,    26350943}, {-1073376748,    27997515}, {-1073332538,    29644021}, {-1073285802,    31290457}, 
+	{-1073559913,    19764076}, {-1073528332,    21410872}, {-1073494225,    23057618}, {-1073457592,    24704310}, 
+	{-1073660973,    13176464}, {-1073639498,    14823423}, {-1073615496,    16470347}, {-1073588967,    18117233}, 
+	{-1073721611,     6588356}, {-1073710241,     8235416}, {-1073696345,     9882456}, {-1073679922,    11529474}, 
+	{-1073741824,           0}, {-1073740561,     1647099}, {-1073736771,     3294193}, {-1073730454,     4941281}, 
+#endif
+#if (MAX_DIF_FFT_LUT_LOG2 >= 11)
+	{ 1073660973,    13176464}, { 1073696345,     9882456}, { 1073721611,     6588356}, { 1073736771,     3294193}, 
+	{ 1073418433,    26350943}, { 1073494225,    23057618}, { 1073559913,    19764076}, { 1073615496,    16470347}, 
+	{ 1073014240,    39521455}, { 1073130440,    36229307}, { 1073236540,    32936819}, { 1073332538,    29644021}, 
+	{ 1072448455,    52686014}, { 1072605046,    49395541}, { 1072751542,    46104602}, { 1072887940,    42813230}, 
+	{ 1071721163,    65842639}, { 1071918122,    62554335}, { 1072104991,    59265442}, { 1072281769,    55975992}, 
+	{ 1070832474,    78989349}, { 1071069770,    75703709}, { 1071296985,    72417357}, { 1071514117,    69130324}, 
+	{ 1069782521,    92124163}, { 1070060120,    88841683}, { 1070327646,    85558366}, { 1070585099,    82274245}, 
+	{ 1068571464,   105245103}, { 1068889322,   101966277}, { 1069197120,    98686491}, { 1069494854,    95405776}, 
+	{ 1067199483,   118350194}, { 1067557554,   115075515}, { 1067905576,   111799753}, { 1068243547,   108522939}, 
+	{ 1065666786,   131437462}, { 1066065015,   128167423}, { 1066453210,   124896179}, { 1066831367,   121623759}, 
+	{ 1063973603,   144504935}, { 1064411931,   141240030}, { 1064840240,   137973796}, { 1065258526,   134706263}, 
+	{ 1062120190,   157550647}, { 1062598550,   154291367}, { 1063066909,   151030634}, { 1063525261,   147768480}, 
+	{ 1060106826,   170572633}, { 1060625146,   167319468}, { 1061133483,   164064728}, { 1061631833,   160808445}, 
+	{ 1057933813,   183568930}, { 1058492016,   180322371}, { 1059040255,   177074115}, { 1059578527,   173824192}, 
+	{ 1055601479,   196537583}, { 1056199480,   193298119}, { 1056787540,   190056834}, { 1057365653,   186813762}, 
+	{ 1053110176,   209476638}, { 1053747885,   206244756}, { 1054375676,   203010932}, { 1054993543,   199775198}, 
+	{ 1050460278,   222384147}, { 1051137599,   219160334}, { 1051805027,   215934457}, { 1052462555,   212706549}, 
+	{ 1047652185,   235258165}, { 1048369016,   232042906}, { 1049075980,   228825464}, { 1049773069,   225605867}, 
+	{ 1044686319,   248096755}, { 1045442553,   244890535}, { 1046188946,   241682010}, { 1046925492,   238471210}, 
+	{ 1041563127,   260897982}, { 1042358649,   257701283}, { 1043144360,   254502159}, { 1043920252,   251300640}, 
+	{ 1038283080,   273659918}, { 1039117770,   270473223}, { 1039942680,   267283981}, { 1040757802,   264092224}, 
+	{ 1034846671,   286380643}, { 1035720404,   283204430}, { 1036584389,   280025552}, { 1037438617,   276844038}, 
+	{ 1031254418,   299058239}, { 1032167062,   295892988}, { 1033069992,   292724951}, { 1033963197,   289554160}, 
+	{ 1027506862,   311690799}, { 1028458280,   308536985}, { 1029400018,   305380268}, { 1030332067,   302220676}, 
+	{ 1023604567,   324276419}, { 1024594615,   321134518}, { 1025575020,   317989595}, { 1026545772,   314841679}, 
+	{ 1019548121,   336813204}, { 1020576651,   333683689}, { 1021595575,   330551034}, { 1022604883,   327415267}, 
+	{ 1015338134,   349299266}, { 1016404991,   346182609}, { 1017462281,   343062693}, { 1018509994,   339939549}, 
+	{ 1010975242,   361732726}, { 1012080264,   358629395}, { 1013175761,   355522689}, { 1014261721,   352412636}, 
+	{ 1006460100,   374111709}, { 1007603122,   371022173}, { 1008736660,   367929144}, { 1009860704,   364832652}, 
+	{ 1001793390,   386434353}, { 1002974239,   383359076}, { 1004145648,   380280190}, { 1005307605,   377197725}, 
+	{  996975812,   398698801}, {  998194311,   395638246}, {  999403415,   392573967}, { 1000603111,   389505993}, 
+	{  992008094,   410903207}, {  993264059,   407857835}, {  994510675,   404808624}, {  995747930,   401755603}, 
+	{  986890984,   423045732}, {  988184225,   420016002}, {  989468165,   416982319}, {  990742793,   413944711}, 
+	{  981625251,   435124548}, {  982955574,   432110916}, {  984276646,   429093217}, {  985588453,   426071480}, 
+	{  976211688,   447137835}, {  977578894,   444140756}, {  978936898,   441139496}, {  980285688,   438134084}, 
+	{  970651112,   459083786}, {  972054994,   456103710}, {  973449725,   453119340}, {  974835295,   450130706}, 
+	{  964944360,   470960600}, {  966384706,   467997976}, {  967815955,   465030947}, {  969238095,   462059541}, 
+	{  959092290,   482766489}, {  960568883,   479821764}, {  962036435,   476872522}, {  963494932,   473918791}, 
+	{  953095785,   494499676}, {  954608403,   491573292}, {  956112036,   488642281}, {  957606670,   485706671}, 
+	{  946955747,   506158392}, {  948504163,   503250791}, {  950043650,   500338453}, {  951574196,   497421405}, 
+	{  940673101,   517740883}, {  942257081,   514852502}, {  943832191,   511959275}, {  945398418,   509061229}, 
+	{  934248793,   529245404}, {  935868098,   526376678}, {  937478595,   523502998}, {  939080267,   520624391}, 
+	{  927683790,   540670223}, {  929338177,   537821584}, {  930983817,   534967884}, {  932620694,   532109148}, 
+	{  920979082,   552013618}, {  922668302,   549185496}, {  924348837,   546352205}, {  926020672,   543513772}, 
+	{  914135678,   563273883}, {  915859476,   560466703}, {  917574653,   557654248}, {  919281194,   554836544}, 
+	{  907154608,   574449320}, {  908912725,   571663506}, {  910662286,   568872310}, {  912403276,   566075761}, 
+	{  900036924,   585538248}, {  901829095,   582774218}, {  903612776,   580004702}, {  905387953,   577229728}, 
+	{  892783698,   596538995}, {  894609652,   593797166}, {  896427186,   591049748}, {  898236282,   588296766}, 
+	{  885396022,   607449906}, {  887255485,   604730691}, {  889106597,   602005783}, {  890949341,   599275210}, 
+	{  877875009,   618269338}, {  879767701,   615573145}, {  881652112,   612871159}, {  883528225,   610163404}, 
+	{  870221790,   628995660}, {  872147426,   626322897}, {  874064853,   623644239}, {  875974054,   620959711}, 
+	{  862437520,   639627258}, {  864395810,   636978327}, {  866345964,   634323400}, {  868287963,   631662503}, 
+	{  854523370,   650162530}, {  856514019,   647537830}, {  858496606,   644907034}, {  860471112,   642270169}, 
+	{  846480531,   660599890}, {  848503239,   657999816}, {  850517961,   655393548}, {  852524677,   652781111}, 
+	{  838310216,   670937767}, {  840364679,   668362709}, {  842411232,   665781362}, {  844449856,   663193747}, 
+	{  830013654,   681174602}, {  832099562,   678624950}, {  834177638,   676068911}, {  836247863,   673506508}, 
+	{  821592095,   691308855}, {  823709135,   688784993}, {  825818421,   686254647}, {  827919934,   683717842}, 
+	{  813046808,   701339000}, {  815194659,   698841307}, {  817334838,   696337036}, {  819467323,   693826211}, 
+	{  804379079,   711263525}, {  806557419,   708792378}, {  808728167,   706314559}, {  810891304,   703830092}, 
+	{  795590213,   721080937}, {  797798714,   718636707}, {  799999706,   716185713}, {  802193167,   713727978}, 
+	{  786681534,   730789757}, {  788919863,   728372813}, {  791150767,   725949013}, {  793374223,   723518380}, 
+	{  777654384,   740388522}, {  779922204,   737999228}, {  782182683,   735602987}, {  784435800,   733199822}, 
+	{  768510122,   749875788}, {  770807092,   747514503}, {  773096806,   745146182}, {  775379244,   742770848}, 
+	{  759250125,   759250125}, {  761575898,   756917205}, {  763894504,   754577161}, {  766205919,   752230015}, 
+	{  749875788,   768510122}, {  752230015,   766205919}, {  754577161,   763894504}, {  756917205,   761575898}, 
+	{  740388522,   777654384}, {  742770848,   775379244}, {  745146182,   773096806}, {  747514503,   770807092}, 
+	{  730789757,   786681534}, {  733199822,   784435800}, {  735602987,   782182683}, {  737999228,   779922204}, 
+	{  721080937,   795590213}, {  723518380,   793374223}, {  725949013,   791150767}, {  728372813,   788919863}, 
+	{  711263525,   804379079}, {  713727978,   802193167}, {  716185713,   799999706}, {  718636707,   797798714}, 
+	{  701339000,   813046808}, {  703830092,   810891304}, {  706314559,   808728167}, {  708792378,   806557419}, 
+	{  691308855,   821592095}, {  693826211,   819467323}, {  696337036,   817334838}, {  698841307,   815194659}, 
+	{  681174602,   830013654}, {  683717842,   827919934}, {  686254647,   825818421}, {  688784993,   823709135}, 
+	{  670937767,   838310216}, {  673506508,   836247863}, {  676068911,   834177638}, {  678624950,   832099562}, 
+	{  660599890,   846480531}, {  663193747,   844449856}, {  665781362,   842411232}, {  668362709,   840364679}, 
+	{  650162530,   854523370}, {  652781111,   852524677}, {  655393548,   850517961}, {  657999816,   848503239}, 
+	{  639627258,   862437520}, {  642270169,   860471112}, {  644907034,   858496606}, {  647537830,   856514019}, 
+	{  628995660,   870221790}, {  631662503,   868287963}, {  634323400,   866345964}, {  636978327,   864395810}, 
+	{  618269338,   877875009}, {  620959711,   875974054}, {  623644239,   874064853}, {  626322897,   872147426}, 
+	{  607449906,   885396022}, {  610163404,   883528225}, {  612871159,   881652112}, {  615573145,   879767701}, 
+	{  596538995,   892783698}, {  599275210,   890949341}, {  602005783,   889106597}, {  604730691,   887255485}, 
+	{  585538248,   900036924}, {  588296766,   898236282}, {  591049748,   896427186}, {  593797166,   894609652}, 
+	{  574449320,   907154608}, {  577229728,   905387953}, {  580004702,   903612776}, {  582774218,   901829095}, 
+	{  563273883,   914135678}, {  566075761,   912403276}, {  568872310,   910662286}, {  571663506,   908912725}, 
+	{  552013618,   920979082}, {  554836544,   919281194}, {  557654248,   917574653}, {  560466703,   915859476}, 
+	{  540670223,   927683790}, {  543513772,   926020672}, {  546352205,   924348837}, {  549185496,   922668302}, 
+	{  529245404,   934248793}, {  532109148,   932620694}, {  534967884,   930983817}, {  537821584,   929338177}, 
+	{  517740883,   940673101}, {  520624391,   939080267}, {  523502998,   937478595}, {  526376678,   935868098}, 
+	{  506158392,   946955747}, {  509061229,   945398418}, {  511959275,   943832191}, {  514852502,   942257081}, 
+	{  494499676,   953095785}, {  497421405,   951574196}, {  500338453,   950043650}, {  503250791,   948504163}, 
+	{  482766489,   959092290}, {  485706671,   957606670}, {  488642281,   956112036}, {  491573292,   954608403}, 
+	{  470960600,   964944360}, {  473918791,   963494932}, {  476872522,   962036435}, {  479821764,   960568883}, 
+	{  459083786,   970651112}, {  462059541,   969238095}, {  465030947,   967815955}, {  467997976,   966384706}, 
+	{  447137835,   976211688}, {  450130706,   974835295}, {  453119340,   973449725}, {  456103710,   972054994}, 
+	{  435124548,   981625251}, {  438134084,   980285688}, {  441139496,   978936898}, {  444140756,   977578894}, 
+	{  423045732,   986890984}, {  426071480,   985588453}, {  429093217,   984276646}, {  432110916,   982955574}, 
+	{  410903207,   992008094}, {  413944711,   990742793}, {  416982319,   989468165}, {  420016002,   988184225}, 
+	{  398698801,   996975812}, {  401755603,   995747930}, {  404808624,   994510675}, {  407857835,   993264059}, 
+	{  386434353,  1001793390}, {  389505993,  1000603111}, {  392573967,   999403415}, {  395638246,   998194311}, 
+	{  374111709,  1006460100}, {  377197725,  1005307605}, {  380280190,  1004145648}, {  383359076,  1002974239}, 
+	{  361732726,  1010975242}, {  364832652,  1009860704}, {  367929144,  1008736660}, {  371022173,  1007603122}, 
+	{  349299266,  1015338134}, {  352412636,  1014261721}, {  355522689,  1013175761}, {  358629395,  1012080264}, 
+	{  336813204,  1019548121}, {  339939549,  1018509994}, {  343062693,  1017462281}, {  346182609,  1016404991}, 
+	{  324276419,  1023604567}, {  327415267,  1022604883}, {  330551034,  1021595575}, {  333683689,  1020576651}, 
+	{  311690799,  1027506862}, {  314841679,  1026545772}, {  317989595,  1025575020}, {  321134518,  1024594615}, 
+	{  299058239,  1031254418}, {  302220676,  1030332067}, {  305380268,  1029400018}, {  308536985,  1028458280}, 
+	{  286380643,  1034846671}, {  289554160,  1033963197}, {  292724951,  1033069992}, {  295892988,  1032167062}, 
+	{  273659918,  1038283080}, {  276844038,  1037438617}, {  280025552,  1036584389}, {  283204430,  1035720404}, 
+	{  260897982,  1041563127}, {  264092224,  1040757802}, {  267283981,  1039942680}, {  270473223,  1039117770}, 
+	{  248096755,  1044686319}, {  251300640,  1043920252}, {  254502159,  1043144360}, {  257701283,  1042358649}, 
+	{  235258165,  1047652185}, {  238471210,  1046925492}, {  241682010,  1046188946}, {  244890535,  1045442553}, 
+	{  222384147,  1050460278}, {  225605867,  1049773069}, {  228825464,  1049075980}, {  232042906,  1048369016}, 
+	{  209476638,  1053110176}, {  212706549,  1052462555}, {  215934457,  1051805027}, {  219160334,  1051137599}, 
+	{  196537583,  1055601479}, {  199775198,  1054993543}, {  203010932,  1054375676}, {  206244756,  1053747885}, 
+	{  183568930,  1057933813}, {  186813762,  1057365653}, {  190056834,  1056787540}, {  193298119,  1056199480}, 
+	{  170572633,  1060106826}, {  173824192,  1059578527}, {  177074115,  1059040255}, {  180322371,  1058492016}, 
+	{  157550647,  1062120190}, {  160808445,  1061631833}, {  164064728,  1061133483}, {  167319468,  1060625146}, 
+	{  144504935,  1063973603}, {  147768480,  1063525261}, {  151030634,  1063066909}, {  154291367,  1062598550}, 
+	{  131437462,  1065666786}, {  134706263,  1065258526}, {  137973796,  1064840240}, {  141240030,  1064411931}, 
+	{  118350194,  1067199483}, {  121623759,  1066831367}, {  124896179,  1066453210}, {  128167423,  1066065015}, 
+	{  105245103,  1068571464}, {  108522939,  1068243547}, {  111799753,  1067905576}, {  115075515,  1067557554}, 
+	{   92124163,  1069782521}, {   95405776,  1069494854}, {   98686491,  1069197120}, {  101966277,  1068889322}, 
+	{   78989349,  1070832474}, {   82274245,  1070585099}, {   85558366,  1070327646}, {   88841683,  1070060120}, 
+	{   65842639,  1071721163}, {   69130324,  1071514117}, {   72417357,  1071296985}, {   75703709,  1071069770}, 
+	{   52686014,  1072448455}, {   55975992,  1072281769}, {   59265442,  1072104991}, {   62554335,  1071918122}, 
+	{   39521455,  1073014240}, {   42813230,  1072887940}, {   46104602,  1072751542}, {   49395541,  1072605046}, 
+	{   26350943,  1073418433}, {   29644021,  1073332538}, {   32936819,  1073236540}, {   36229307,  1073130440}, 
+	{   13176464,  1073660973}, {   16470347,  1073615496}, {   19764076,  1073559913}, {   23057618,  1073494225}, 
+	{          0,  1073741824}, {    3294193,  1073736771}, {    6588356,  1073721611}, {    9882456,  1073696345}, 
+	{  -13176464,  1073660973}, {   -9882456,  1073696345}, {   -6588356,  1073721611}, {   -3294193,  1073736771}, 
+	{  -26350943,  1073418433}, {  -23057618,  1073494225}, {  -19764076,  1073559913}, {  -16470347,  1073615496}, 
+	{  -39521455,  1073014240}, {  -36229307,  1073130440}, {  -32936819,  1073236540}, {  -29644021,  1073332538}, 
+	{  -52686014,  1072448455}, {  -49395541,  1072605046}, {  -46104602,  1072751542}, {  -42813230,  1072887940}, 
+	{  -65842639,  1071721163}, {  -62554335,  1071918122}, {  -59265442,  1072104991}, {  -55975992,  1072281769}, 
+	{  -78989349,  1070832474}, {  -75703709,  1071069770}, {  -72417357,  1071296985}, {  -69130324,  1071514117}, 
+	{  -92124163,  1069782521}, {  -88841683,  1070060120}, {  -85558366,  1070327646}, {  -82274245,  1070585099}, 
+	{ -105245103,  1068571464}, { -101966277,  1068889322}, {  -98686491,  1069197120}, {  -95405776,  1069494854}, 
+	{ -118350194,  1067199483}, { -115075515,  1067557554}, { -111799753,  1067905576}, { -108522939,  1068243547}, 
+	{ -131437462,  1065666786}, { -128167423,  1066065015}, { -124896179,  1066453210}, { -121623759,  1066831367}, 
+	{ -144504935,  1063973603}, { -141240030,  1064411931}, { -137973796,  1064840240}, { -134706263,  1065258526}, 
+	{ -157550647,  1062120190}, { -154291367,  1062598550}, { -151030634,  1063066909}, { -147768480,  1063525261}, 
+	{ -170572633,  1060106826}, { -167319468,  1060625146}, { -164064728,  1061133483}, { -160808445,  1061631833}, 
+	{ -183568930,  1057933813}, { -180322371,  1058492016}, { -177074115,  1059040255}, { -173824192,  1059578527}, 
+	{ -196537583,  1055601479}, { -193298119,  1056199480}, { -190056834,  1056787540}, { -186813762,  1057365653}, 
+	{ -209476638,  1053110176}, { -206244756,  1053747885}, { -203010932,  1054375676}, { -199775198,  1054993543}, 
+	{ -222384147,  1050460278}, { -219160334,  1051137599}, { -215934457,  1051805027}, { -212706549,  1052462555}, 
+	{ -235258165,  1047652185}, { -232042906,  1048369016}, { -228825464,  1049075980}, { -225605867,  1049773069}, 
+	{ -248096755,  1044686319}, { -244890535,  1045442553}, { -241682010,  1046188946}, { -238471210,  1046925492}, 
+	{ -260897982,  1041563127}, { -257701283,  1042358649}, { -254502159,  1043144360}, { -251300640,  1043920252}, 
+	{ -273659918,  1038283080}, { -270473223,  1039117770}, { -267283981,  1039942680}, { -264092224,  1040757802}, 
+	{ -286380643,  1034846671}, { -283204430,  1035720404}, { -280025552,  1036584389}, { -276844038,  1037438617}, 
+	{ -299058239,  1031254418}, { -295892988,  1032167062}, { -292724951,  1033069992}, { -289554160,  1033963197}, 
+	{ -311690799,  1027506862}, { -308536985,  1028458280}, { -305380268,  1029400018}, { -302220676,  1030332067}, 
+	{ -324276419,  1023604567}, { -321134518,  1024594615}, { -317989595,  1025575020}, { -314841679,  1026545772}, 
+	{ -336813204,  1019548121}, { -333683689,  1020576651}, { -330551034,  1021595575}, { -327415267,  1022604883}, 
+	{ -349299266,  1015338134}, { -346182609,  1016404991}, { -343062693,  1017462281}, { -339939549,  1018509994}, 
+	{ -361732726,  1010975242}, { -358629395,  1012080264}, { -355522689,  1013175761}, { -352412636,  1014261721}, 
+	{ -374111709,  1006460100}, { -371022173,  1007603122}, { -367929144,  1008736660}, { -364832652,  1009860704}, 
+	{ -386434353,  1001793390}, { -383359076,  1002974239}, { -380280190,  1004145648}, { -377197725,  1005307605}, 
+	{ -398698801,   996975812}, { -395638246,   998194311}, { -392573967,   999403415}, { -389505993,  1000603111}, 
+	{ -410903207,   992008094}, { -407857835,   993264059}, { -404808624,   994510675}, { -401755603,   995747930}, 
+	{ -423045732,   986890984}, { -420016002,   988184225}, { -416982319,   989468165}, { -413944711,   990742793}, 
+	{ -435124548,   981625251}, { -432110916,   982955574}, { -429093217,   984276646}, { -426071480,   985588453}, 
+	{ -447137835,   976211688}, { -444140756,   977578894}, { -441139496,   978936898}, { -438134084,   980285688}, 
+	{ -459083786,   970651112}, { -456103710,   972054994}, { -453119340,   973449725}, { -450130706,   974835295}, 
+	{ -470960600,   964944360}, { -467997976,   966384706}, { -465030947,   967815955}, { -462059541,   969238095}, 
+	{ -482766489,   959092290}, { -479821764,   960568883}, { -476872522,   962036435}, { -473918791,   963494932}, 
+	{ -494499676,   953095785}, { -491573292,   954608403}, { -488642281,   956112036}, { -485706671,   957606670}, 
+	{ -506158392,   946955747}, { -503250791,   948504163}, { -500338453,   950043650}, { -497421405,   951574196}, 
+	{ -517740883,   940673101}, { -514852502,   942257081}, { -511959275,   943832191}, { -509061229,   945398418}, 
+	{ -529245404,   934248793}, { -526376678,   935868098}, { -523502998,   937478595}, { -520624391,   939080267}, 
+	{ -540670223,   927683790}, { -537821584,   929338177}, { -534967884,   930983817}, { -532109148,   932620694}, 
+	{ -552013618,   920979082}, { -549185496,   922668302}, { -546352205,   924348837}, { -543513772,   926020672}, 
+	{ -563273883,   914135678}, { -560466703,   915859476}, { -557654248,   917574653}, { -554836544,   919281194}, 
+	{ -574449320,   907154608}, { -571663506,   908912725}, { -568872310,   910662286}, { -566075761,   912403276}, 
+	{ -585538248,   900036924}, { -582774218,   901829095}, { -580004702,   903612776}, { -577229728,   905387953}, 
+	{ -596538995,   892783698}, { -593797166,   894609652}, { -591049748,   896427186}, { -588296766,   898236282}, 
+	{ -607449906,   885396022}, { -604730691,   887255485}, { -602005783,   889106597}, { -599275210,   890949341}, 
+	{ -618269338,   877875009}, { -615573145,   879767701}, { -612871159,   881652112}, { -610163404,   883528225}, 
+	{ -628995660,   870221790}, { -626322897,   872147426}, { -623644239,   874064853}, { -620959711,   875974054}, 
+	{ -639627258,   862437520}, { -636978327,   864395810}, { -634323400,   866345964}, { -631662503,   868287963}, 
+	{ -650162530,   854523370}, { -647537830,   856514019}, { -644907034,   858496606}, { -642270169,   860471112}, 
+	{ -660599890,   846480531}, { -657999816,   848503239}, { -655393548,   850517961}, { -652781111,   852524677}, 
+	{ -670937767,   838310216}, { -668362709,   840364679}, { -665781362,   842411232}, { -663193747,   844449856}, 
+	{ -681174602,   830013654}, { -678624950,   832099562}, { -676068911,   834177638}, { -673506508,   836247863}, 
+	{ -691308855,   821592095}, { -688784993,   823709135}, { -686254647,   825818421}, { -683717842,   827919934}, 
+	{ -701339000,   813046808}, { -698841307,   815194659}, { -696337036,   817334838}, { -693826211,   819467323}, 
+	{ -711263525,   804379079}, { -708792378,   806557419}, { -706314559,   808728167}, { -703830092,   810891304}, 
+	{ -721080937,   795590213}, { -718636707,   797798714}, { -716185713,   799999706}, { -713727978,   802193167}, 
+	{ -730789757,   786681534}, { -728372813,   788919863}, { -725949013,   791150767}, { -723518380,   793374223}, 
+	{ -740388522,   777654384}, { -737999228,   779922204}, { -735602987,   782182683}, { -733199822,   784435800}, 
+	{ -749875788,   768510122}, { -747514503,   770807092}, { -745146182,   773096806}, { -742770848,   775379244}, 
+	{ -759250125,   759250125}, { -756917205,   761575898}, { -754577161,   763894504}, { -752230015,   766205919}, 
+	{ -768510122,   749875788}, { -766205919,   752230015}, { -763894504,   754577161}, { -761575898,   756917205}, 
+	{ -777654384,   740388522}, { -775379244,   742770848}, { -773096806,   745146182}, { -770807092,   747514503}, 
+	{ -786681534,   730789757}, { -784435800,   733199822}, { -782182683,   735602987}, { -779922204,   737999228}, 
+	{ -795590213,   721080937}, { -793374223,   723518380}, { -791150767,   725949013}, { -788919863,   728372813}, 
+	{ -804379079,   711263525}, { -802193167,   713727978}, { -799999706,   716185713}, { -797798714,   718636707}, 
+	{ -813046808,   701339000}, { -810891304,   703830092}, { -808728167,   706314559}, { -806557419,   708792378}, 
+	{ -821592095,   691308855}, { -819467323,   693826211}, { -817334838,   696337036}, { -815194659,   698841307}, 
+	{ -830013654,   681174602}, { -827919934,   683717842}, { -825818421,   686254647}, { -823709135,   688784993}, 
+	{ -838310216,   670937767}, { -836247863,   673506508}, { -834177638,   676068911}, { -832099562,   678624950}, 
+	{ -846480531,   660599890}, { -844449856,   663193747}, { -842411232,   665781362}, { -840364679,   668362709}, 
+	{ -854523370,   650162530}, { -852524677,   652781111}, { -850517961,   655393548}, { -848503239,   657999816}, 
+	{ -862437520,   639627258}, { -860471112,   642270169}, { -858496606,   644907034}, { -856514019,   647537830}, 
+	{ -870221790,   628995660}, { -868287963,   631662503}, { -866345964,   634323400}, { -864395810,   636978327}, 
+	{ -877875009,   618269338}, { -875974054,   620959711}, { -874064853,   623644239}, { -872147426,   626322897}, 
+	{ -885396022,   607449906}, { -883528225,   610163404}, { -881652112,   612871159}, { -879767701,   615573145}, 
+	{ -892783698,   596538995}, { -890949341,   599275210}, { -889106597,   602005783}, { -887255485,   604730691}, 
+	{ -900036924,   585538248}, { -898236282,   588296766}, { -896427186,   591049748}, { -894609652,   593797166}, 
+	{ -907154608,   574449320}, { -905387953,   577229728}, { -903612776,   580004702}, { -901829095,   582774218}, 
+	{ -914135678,   563273883}, { -912403276,   566075761}, { -910662286,   568872310}, { -908912725,   571663506}, 
+	{ -920979082,   552013618}, { -919281194,   554836544}, { -917574653,   557654248}, { -915859476,   560466703}, 
+	{ -927683790,   540670223}, { -926020672,   543513772}, { -924348837,   546352205}, { -922668302,   549185496}, 
+	{ -934248793,   529245404}, { -932620694,   532109148}, { -930983817,   534967884}, { -929338177,   537821584}, 
+	{ -940673101,   517740883}, { -939080267,   520624391}, { -937478595,   523502998}, { -935868098,   526376678}, 
+	{ -946955747,   506158392}, { -945398418,   509061229}, { -943832191,   511959275}, { -942257081,   514852502}, 
+	{ -953095785,   494499676}, { -951574196,   497421405}, { -950043650,   500338453}, { -948504163,   503250791}, 
+	{ -959092290,   482766489}, { -957606670,   485706671}, { -956112036,   488642281}, { -954608403,   491573292}, 
+	{ -964944360,   470960600}, { -963494932,   473918791}, { -962036435,   476872522}, { -960568883,   479821764}, 
+	{ -970651112,   459083786}, { -969238095,   462059541}, { -967815955,   465030947}, { -966384706,   467997976}, 
+	{ -976211688,   447137835}, { -974835295,   450130706}, { -973449725,   453119340}, { -972054994,   456103710}, 
+	{ -981625251,   435124548}, { -980285688,   438134084}, { -978936898,   441139496}, { -977578894,   444140756}, 
+	{ -986890984,   423045732}, { -985588453,   426071480}, { -984276646,   429093217}, { -982955574,   432110916}, 
+	{ -992008094,   410903207}, { -990742793,   413944711}, { -989468165,   416982319}, { -988184225,   420016002}, 
+	{ -996975812,   398698801}, { -995747930,   401755603}, { -994510675,   404808624}, { -993264059,   407857835}, 
+	{-1001793390,   386434353}, {-1000603111,   389505993}, { -999403415,   392573967}, { -998194311,   395638246}, 
+	{-1006460100,   374111709}, {-1005307605,   377197725}, {-1004145648,   380280190}, {-1002974239,   383359076}, 
+	{-1010975242,   361732726}, {-1009860704,   364832652}, {-1008736660,   367929144}, {-1007603122,   371022173}, 
+	{-1015338134,   349299266}, {-1014261721,   352412636}, {-1013175761,   355522689}, {-1012080264,   358629395}, 
+	{-1019548121,   336813204}, {-1018509994,   339939549}, {-1017462281,   343062693}, {-1016404991,   346182609}, 
+	{-1023604567,   324276419}, {-1022604883,   327415267}, {-1021595575,   330551034}, {-1020576651,   333683689}, 
+	{-1027506862,   311690799}, {-1026545772,   314841679}, {-1025575020,   317989595}, {-1024594615,   321134518}, 
+	{-1031254418,   299058239}, {-1030332067,   302220676}, {-1029400018,   305380268}, {-1028458280,   308536985}, 
+	{-1034846671,   286380643}, {-1033963197,   289554160}, {-1033069992,   292724951}, {-1032167062,   295892988}, 
+	{-1038283080,   273659918}, {-1037438617,   276844038}, {-1036584389,   280025552}, {-1035720404,   283204430}, 
+	{-1041563127,   260897982}, {-1040757802,   264092224}, {-1039942680,   267283981}, {-1039117770,   270473223}, 
+	{-1044686319,   248096755}, {-1043920252,   251300640}, {-1043144360,   254502159}, {-1042358649,   257701283}, 
+	{-1047652185,   235258165}, {-1046925492,   238471210}, {-1046188946,   241682010}, {-1045442553,   244890535}, 
+	{-1050460278,   222384147}, {-1049773069,   225605867}, {-1049075980,   228825464}, {-1048369016,   232042906}, 
+	{-1053110176,   209476638}, {-1052462555,   212706549}, {-1051805027,   215934457}, {-1051137599,   219160334}, 
+	{-1055601479,   196537583}, {-1054993543,   199775198}, {-1054375676,   203010932}, {-1053747885,   206244756}, 
+	{-1057933813,   183568930}, {-1057365653,   186813762}, {-1056787540,   190056834}, {-1056199480,   193298119}, 
+	{-1060106826,   170572633}, {-1059578527,   173824192}, {-1059040255,   177074115}, {-1058492016,   180322371}, 
+	{-1062120190,   157550647}, {-1061631833,   160808445}, {-1061133483,   164064728}, {-1060625146,   167319468}, 
+	{-1063973603,   144504935}, {-1063525261,   147768480}, {-1063066909,   151030634}, {-1062598550,   154291367}, 
+	{-1065666786,   131437462}, {-1065258526,   134706263}, {-1064840240,   137973796}, {-1064411931,   141240030}, 
+	{-1067199483,   118350194}, {-1066831367,   121623759}, {-1066453210,   124896179}, {-1066065015,   128167423}, 
+	{-1068571464,   105245103}, {-1068243547,   108522939}, {-1067905576,   111799753}, {-1067557554,   115075515}, 
+	{-1069782521,    92124163}, {-1069494854,    95405776}, {-1069197120,    98686491}, {-1068889322,   101966277}, 
+	{-1070832474,    78989349}, {-1070585099,    82274245}, {-1070327646,    85558366}, {-1070060120,    88841683}, 
+	{-1071721163,    65842639}, {-1071514117,    69130324}, {-1071296985,    72417357}, {-1071069770,    75703709}, 
+	{-1072448455,    52686014}, {-1072281769,    55975992}, {-1072104991,    59265442}, {-1071918122,    62554335}, 
+	{-1073014240,    39521455}, {-1072887940,    42813230}, {-1072751542,    46104602}, {-1072605046,    49395541}, 
+	{-1073418433,    26350943}, {-1073332538,    29644021}, {-1073236540,    32936819}, {-1073130440,    36229307}, 
+	{-1073660973,    13176464}, {-1073615496,    16470347}, {-1073559913,    19764076}, {-1073494225,    23057618}, 
+	{-1073741824,           0}, {-1073736771,     3294193}, {-1073721611,     6588356}, {-1073696345,     9882456}, 
+#endif
+#if (MAX_DIF_FFT_LUT_LOG2 >= 10)
 	{ 1073418433,    26350943}, { 1073559913,    19764076}, { 1073660973,    13176464}, { 1073721611,     6588356}, 
 	{ 1072448455,    52686014}, { 1072751542,    46104602}, { 1073014240,    39521455}, { 1073236540,    32936819}, 
 	{ 1070832474,    78989349}, { 1071296985,    72417357}, { 1071721163,    65842639}, { 1072104991,    59265442}, 
@@ -394,6 +8104,8 @@ const complex_s32_t xs3_dif_fft_lut[1020] =
 	{-1072448455,    52686014}, {-1072104991,    59265442}, {-1071721163,    65842639}, {-1071296985,    72417357}, 
 	{-1073418433,    26350943}, {-1073236540,    32936819}, {-1073014240,    39521455}, {-1072751542,    46104602}, 
 	{-1073741824,           0}, {-1073721611,     6588356}, {-1073660973,    13176464}, {-1073559913,    19764076}, 
+#endif
+#if (MAX_DIF_FFT_LUT_LOG2 >= 9)
 	{ 1072448455,    52686014}, { 1073014240,    39521455}, { 1073418433,    26350943}, { 1073660973,    13176464}, 
 	{ 1068571464,   105245103}, { 1069782521,    92124163}, { 1070832474,    78989349}, { 1071721163,    65842639}, 
 	{ 1062120190,   157550647}, { 1063973603,   144504935}, { 1065666786,   131437462}, { 1067199483,   118350194}, 
@@ -458,6 +8170,8 @@ const complex_s32_t xs3_dif_fft_lut[1020] =
 	{-1068571464,   105245103}, {-1067199483,   118350194}, {-1065666786,   131437462}, {-1063973603,   144504935}, 
 	{-1072448455,    52686014}, {-1071721163,    65842639}, {-1070832474,    78989349}, {-1069782521,    92124163}, 
 	{-1073741824,           0}, {-1073660973,    13176464}, {-1073418433,    26350943}, {-1073014240,    39521455}, 
+#endif
+#if (MAX_DIF_FFT_LUT_LOG2 >= 8)
 	{ 1068571464,   105245103}, { 1070832474,    78989349}, { 1072448455,    52686014}, { 1073418433,    26350943}, 
 	{ 1053110176,   209476638}, { 1057933813,   183568930}, { 1062120190,   157550647}, { 1065666786,   131437462}, 
 	{ 1027506862,   311690799}, { 1034846671,   286380643}, { 1041563127,   260897982}, { 1047652185,   235258165}, 
@@ -490,6 +8204,8 @@ const complex_s32_t xs3_dif_fft_lut[1020] =
 	{-1053110176,   209476638}, {-1047652185,   235258165}, {-1041563127,   260897982}, {-1034846671,   286380643}, 
 	{-1068571464,   105245103}, {-1065666786,   131437462}, {-1062120190,   157550647}, {-1057933813,   183568930}, 
 	{-1073741824,           0}, {-1073418433,    26350943}, {-1072448455,    52686014}, {-1070832474,    78989349}, 
+#endif
+#if (MAX_DIF_FFT_LUT_LOG2 >= 7)
 	{ 1053110176,   209476638}, { 1062120190,   157550647}, { 1068571464,   105245103}, { 1072448455,    52686014}, 
 	{  992008094,   410903207}, { 1010975242,   361732726}, { 1027506862,   311690799}, { 1041563127,   260897982}, 
 	{  892783698,   596538995}, {  920979082,   552013618}, {  946955747,   506158392}, {  970651112,   459083786}, 
@@ -506,6 +8222,8 @@ const complex_s32_t xs3_dif_fft_lut[1020] =
 	{ -992008094,   410903207}, { -970651112,   459083786}, { -946955747,   506158392}, { -920979082,   552013618}, 
 	{-1053110176,   209476638}, {-1041563127,   260897982}, {-1027506862,   311690799}, {-1010975242,   361732726}, 
 	{-1073741824,           0}, {-1072448455,    52686014}, {-1068571464,   105245103}, {-1062120190,   157550647}, 
+#endif
+#if (MAX_DIF_FFT_LUT_LOG2 >= 6)
 	{  992008094,   410903207}, { 1027506862,   311690799}, { 1053110176,   209476638}, { 1068571464,   105245103}, 
 	{  759250125,   759250125}, {  830013654,   681174602}, {  892783698,   596538995}, {  946955747,   506158392}, 
 	{  410903207,   992008094}, {  506158392,   946955747}, {  596538995,   892783698}, {  681174602,   830013654}, 
@@ -514,13 +8232,858 @@ const complex_s32_t xs3_dif_fft_lut[1020] =
 	{ -759250125,   759250125}, { -681174602,   830013654}, { -596538995,   892783698}, { -506158392,   946955747}, 
 	{ -992008094,   410903207}, { -946955747,   506158392}, { -892783698,   596538995}, { -830013654,   681174602}, 
 	{-1073741824,           0}, {-1068571464,   105245103}, {-1053110176,   209476638}, {-1027506862,   311690799}, 
+#endif
+#if (MAX_DIF_FFT_LUT_LOG2 >= 5)
 	{  759250125,   759250125}, {  892783698,   596538995}, {  992008094,   410903207}, { 1053110176,   209476638}, 
 	{          0,  1073741824}, {  209476638,  1053110176}, {  410903207,   992008094}, {  596538995,   892783698}, 
 	{ -759250125,   759250125}, { -596538995,   892783698}, { -410903207,   992008094}, { -209476638,  1053110176}, 
 	{-1073741824,           0}, {-1053110176,   209476638}, { -992008094,   410903207}, { -892783698,   596538995}, 
+#endif
+#if (MAX_DIF_FFT_LUT_LOG2 >= 4)
 	{          0,  1073741824}, {  410903207,   992008094}, {  759250125,   759250125}, {  992008094,   410903207}, 
 	{-1073741824,           0}, { -992008094,   410903207}, { -759250125,   759250125}, { -410903207,   992008094}, 
+#endif
 	{-1073741824,           0}, { -759250125,   759250125}, {          0,  1073741824}, {  759250125,   759250125}, 
 	};
 
 const uint32_t xs3_dif_fft_lut_size = sizeof(xs3_dif_fft_lut);
+
+#if (MAX_DIT_FFT_LUT_LOG2 < MAX_DIT_FFT_LOG2) && !(XS3_MATH_FFT_COMPACT_TWIDDLES)
+const complex_s32_t xs3_fft_twiddle_seed[15] = 
+	{
+	{ 1073741824,           0}, {-1073741824,           0}, {          0, -1073741824}, {  759250125,  -759250125}, 
+	{  992008094,  -410903207}, { 1053110176,  -209476638}, { 1068571464,  -105245103}, { 1072448455,   -52686014}, 
+	{ 1073418433,   -26350943}, { 1073660973,   -13176464}, { 1073721611,    -6588356}, { 1073736771,    -3294193}, 
+	{ 1073740561,    -1647099}, { 1073741508,     -823550}, { 1073741745,     -411775}, 
+	};
+#endif
+
+#if (XS3_MATH_FFT_COMPACT_TWIDDLES)
+const int32_t xs3_fft_sine_lut[XS3_FFT_SINE_LUT_SIZE] = 
+	{
+	          0,  1073741824, 
+	  759250125, 
+#if (XS3_MATH_FFT_MAX_LOG2 >= 4)
+	  410903207,   992008094, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 5)
+	  209476638,   596538995,   892783698,  1053110176, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 6)
+	  105245103,   311690799,   506158392,   681174602,   830013654,   946955747,  1027506862,  1068571464, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 7)
+	   52686014,   157550647,   260897982,   361732726,   459083786,   552013618,   639627258,   721080937, 
+	  795590213,   862437520,   920979082,   970651112,  1010975242,  1041563127,  1062120190,  1072448455, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 8)
+	   26350943,    78989349,   131437462,   183568930,   235258165,   286380643,   336813204,   386434353, 
+	  435124548,   482766489,   529245404,   574449320,   618269338,   660599890,   701339000,   740388522, 
+	  777654384,   813046808,   846480531,   877875009,   907154608,   934248793,   959092290,   981625251, 
+	 1001793390,  1019548121,  1034846671,  1047652185,  1057933813,  1065666786,  1070832474,  1073418433, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 9)
+	   13176464,    39521455,    65842639,    92124163,   118350194,   144504935,   170572633,   196537583, 
+	  222384147,   248096755,   273659918,   299058239,   324276419,   349299266,   374111709,   398698801, 
+	  423045732,   447137835,   470960600,   494499676,   517740883,   540670223,   563273883,   585538248, 
+	  607449906,   628995660,   650162530,   670937767,   691308855,   711263525,   730789757,   749875788, 
+	  768510122,   786681534,   804379079,   821592095,   838310216,   854523370,   870221790,   885396022, 
+	  900036924,   914135678,   927683790,   940673101,   953095785,   964944360,   976211688,   986890984, 
+	  996975812,  1006460100,  1015338134,  1023604567,  1031254418,  1038283080,  1044686319,  1050460278, 
+	 1055601479,  1060106826,  1063973603,  1067199483,  1069782521,  1071721163,  1073014240,  1073660973, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 10)
+	    6588356,    19764076,    32936819,    46104602,    59265442,    72417357,    85558366,    98686491, 
+	  111799753,   124896179,   137973796,   151030634,   164064728,   177074115,   190056834,   203010932, 
+	  215934457,   228825464,   241682010,   254502159,   267283981,   280025552,   292724951,   305380268, 
+	  317989595,   330551034,   343062693,   355522689,   367929144,   380280190,   392573967,   404808624, 
+	  416982319,   429093217,   441139496,   453119340,   465030947,   476872522,   488642281,   500338453, 
+	  511959275,   523502998,   534967884,   546352205,   557654248,   568872310,   580004702,   591049748, 
+	  602005783,   612871159,   623644239,   634323400,   644907034,   655393548,   665781362,   676068911, 
+	  686254647,   696337036,   706314559,   716185713,   725949013,   735602987,   745146182,   754577161, 
+	  763894504,   773096806,   782182683,   791150767,   799999706,   808728167,   817334838,   825818421, 
+	  834177638,   842411232,   850517961,   858496606,   866345964,   874064853,   881652112,   889106597, 
+	  896427186,   903612776,   910662286,   917574653,   924348837,   930983817,   937478595,   943832191, 
+	  950043650,   956112036,   962036435,   967815955,   973449725,   978936898,   984276646,   989468165, 
+	  994510675,   999403415,  1004145648,  1008736660,  1013175761,  1017462281,  1021595575,  1025575020, 
+	 1029400018,  1033069992,  1036584389,  1039942680,  1043144360,  1046188946,  1049075980,  1051805027, 
+	 1054375676,  1056787540,  1059040255,  1061133483,  1063066909,  1064840240,  1066453210,  1067905576, 
+	 1069197120,  1070327646,  1071296985,  1072104991,  1072751542,  1073236540,  1073559913,  1073721611, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 11)
+	    3294193,     9882456,    16470347,    23057618,    29644021,    36229307,    42813230,    49395541, 
+	   55975992,    62554335,    69130324,    75703709,    82274245,    88841683,    95405776,   101966277, 
+	  108522939,   115075515,   121623759,   128167423,   134706263,   141240030,   147768480,   154291367, 
+	  160808445,   167319468,   173824192,   180322371,   186813762,   193298119,   199775198,   206244756, 
+	  212706549,   219160334,   225605867,   232042906,   238471210,   244890535,   251300640,   257701283, 
+	  264092224,   270473223,   276844038,   283204430,   289554160,   295892988,   302220676,   308536985, 
+	  314841679,   321134518,   327415267,   333683689,   339939549,   346182609,   352412636,   358629395, 
+	  364832652,   371022173,   377197725,   383359076,   389505993,   395638246,   401755603,   407857835, 
+	  413944711,   420016002,   426071480,   432110916,   438134084,   444140756,   450130706,   456103710, 
+	  462059541,   467997976,   473918791,   479821764,   485706671,   491573292,   497421405,   503250791, 
+	  509061229,   514852502,   520624391,   526376678,   532109148,   537821584,   543513772,   549185496, 
+	  554836544,   560466703,   566075761,   571663506,   577229728,   582774218,   588296766,   593797166, 
+	  599275210,   604730691,   610163404,   615573145,   620959711,   626322897,   631662503,   636978327, 
+	  642270169,   647537830,   652781111,   657999816,   663193747,   668362709,   673506508,   678624950, 
+	  683717842,   688784993,   693826211,   698841307,   703830092,   708792378,   713727978,   718636707, 
+	  723518380,   728372813,   733199822,   737999228,   742770848,   747514503,   752230015,   756917205, 
+	  761575898,   766205919,   770807092,   775379244,   779922204,   784435800,   788919863,   793374223, 
+	  797798714,   802193167,   806557419,   810891304,   815194659,   819467323,   823709135,   827919934, 
+	  832099562,   836247863,   840364679,   844449856,   848503239,   852524677,   856514019,   860471112, 
+	  864395810,   868287963,   872147426,   875974054,   879767701,   883528225,   887255485,   890949341, 
+	  894609652,   898236282,   901829095,   905387953,   908912725,   912403276,   915859476,   919281194, 
+	  922668302,   926020672,   929338177,   932620694,   935868098,   939080267,   942257081,   945398418, 
+	  948504163,   951574196,   954608403,   957606670,   960568883,   963494932,   966384706,   969238095, 
+	  972054994,   974835295,   977578894,   980285688,   982955574,   985588453,   988184225,   990742793, 
+	  993264059,   995747930,   998194311,  1000603111,  1002974239,  1005307605,  1007603122,  1009860704, 
+	 1012080264,  1014261721,  1016404991,  1018509994,  1020576651,  1022604883,  1024594615,  1026545772, 
+	 1028458280,  1030332067,  1032167062,  1033963197,  1035720404,  1037438617,  1039117770,  1040757802, 
+	 1042358649,  1043920252,  1045442553,  1046925492,  1048369016,  1049773069,  1051137599,  1052462555, 
+	 1053747885,  1054993543,  1056199480,  1057365653,  1058492016,  1059578527,  1060625146,  1061631833, 
+	 1062598550,  1063525261,  1064411931,  1065258526,  1066065015,  1066831367,  1067557554,  1068243547, 
+	 1068889322,  1069494854,  1070060120,  1070585099,  1071069770,  1071514117,  1071918122,  1072281769, 
+	 1072605046,  1072887940,  1073130440,  1073332538,  1073494225,  1073615496,  1073696345,  1073736771, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 12)
+	    1647099,     4941281,     8235416,    11529474,    14823423,    18117233,    21410872,    24704310, 
+	   27997515,    31290457,    34583104,    37875426,    41167391,    44458968,    47750128,    51040837, 
+	   54331067,    57620785,    60909960,    64198563,    67486561,    70773924,    74060620,    77346620, 
+	   80631892,    83916404,    87200127,    90483029,    93765079,    97046247,   100326502,   103605812, 
+	  106884147,   110161476,   113437768,   116712992,   119987118,   123260114,   126531950,   129802595, 
+	  133072019,   136340190,   139607077,   142872651,   146136880,   149399733,   152661180,   155921191, 
+	  159179733,   162436778,   165692293,   168946249,   172198615,   175449360,   178698453,   181945865, 
+	  185191564,   188435520,   191677702,   194918080,   198156624,   201393302,   204628085,   207860942, 
+	  211091842,   214320755,   217547651,   220772500,   223995270,   227215933,   230434456,   233650811, 
+	  236864966,   240076892,   243286558,   246493935,   249698991,   252901697,   256102022,   259299937, 
+	  262495412,   265688415,   268878918,   272066891,   275252302,   278435122,   281615322,   284792871, 
+	  287967740,   291139898,   294309316,   297475964,   300639811,   303800829,   306958988,   310114257, 
+	  313266607,   316416009,   319562433,   322705848,   325846226,   328983538,   332117752,   335248841, 
+	  338376774,   341501523,   344623057,   347741347,   350856364,   353968079,   357076462,   360181484, 
+	  363283116,   366381329,   369476093,   372567379,   375655159,   378739403,   381820082,   384897167, 
+	  387970630,   391040440,   394106570,   397168991,   400227673,   403282588,   406333708,   409381002, 
+	  412424444,   415464004,   418499653,   421531363,   424559105,   427582852,   430602573,   433618242, 
+	  436629829,   439637307,   442640647,   445639820,   448634799,   451625555,   454612060,   457594286, 
+	  460572205,   463545789,   466515010,   469479840,   472440251,   475396216,   478347705,   481294693, 
+	  484237150,   487175049,   490108363,   493037064,   495961124,   498880516,   501795212,   504705185, 
+	  507610408,   510510853,   513406493,   516297300,   519183248,   522064309,   524940456,   527811662, 
+	  530677900,   533539144,   536395365,   539246538,   542092635,   544933630,   547769495,   550600205, 
+	  553425732,   556246051,   559061133,   561870954,   564675486,   567474703,   570268579,   573057087, 
+	  575840202,   578617896,   581390144,   584156920,   586918198,   589673951,   592424154,   595168781, 
+	  597907806,   600641203,   603368947,   606091012,   608807372,   611518001,   614222875,   616921967, 
+	  619615253,   622302707,   624984303,   627660017,   630329823,   632993696,   635651611,   638303543, 
+	  640949467,   643589359,   646223192,   648850943,   651472587,   654088099,   656697454,   659300629, 
+	  661897597,   664488336,   667072820,   669651026,   672222928,   674788504,   677347728,   679900576, 
+	  682447025,   684987051,   687520629,   690047736,   692568348,   695082441,   697589992,   700090977, 
+	  702585372,   705073155,   707554301,   710028787,   712496590,   714957687,   717412054,   719859669, 
+	  722300508,   724734549,   727161768,   729582143,   731995651,   734402269,   736801974,   739194745, 
+	  741580558,   743959390,   746331221,   748696026,   751053785,   753404474,   755748072,   758084557, 
+	  760413906,   762736098,   765051111,   767358923,   769659512,   771952857,   774238936,   776517728, 
+	  778789210,   781053363,   783310163,   785559591,   787801625,   790036244,   792263427,   794483153, 
+	  796695401,   798900150,   801097379,   803287068,   805469196,   807643743,   809810688,   811970011, 
+	  814121692,   816265709,   818402043,   820530675,   822651583,   824764748,   826870150,   828967769, 
+	  831057586,   833139580,   835213733,   837280024,   839338435,   841388945,   843431536,   845466188, 
+	  847492882,   849511600,   851522321,   853525028,   855519701,   857506321,   859484870,   861455330, 
+	  863417681,   865371905,   867317984,   869255900,   871185633,   873107167,   875020483,   876925563, 
+	  878822389,   880710943,   882591207,   884463164,   886326796,   888182086,   890029016,   891867569, 
+	  893697727,   895519473,   897332790,   899137661,   900934069,   902721998,   904501429,   906272347, 
+	  908034735,   909788576,   911533853,   913270551,   914998653,   916718143,   918429004,   920131221, 
+	  921824777,   923509656,   925185843,   926853322,   928512076,   930162092,   931803352,   933435842, 
+	  935059546,   936674448,   938280535,   939877790,   941466198,   943045745,   944616416,   946178196, 
+	  947731070,   949275023,   950810042,   952336111,   953853216,   955361344,   956860479,   958350608, 
+	  959831716,   961303790,   962766816,   964220780,   965665669,   967101468,   968528165,   969945745, 
+	  971354196,   972753504,   974143656,   975524639,   976896441,   978259047,   979612445,   980956623, 
+	  982291568,   983617267,   984933708,   986240879,   987538766,   988827359,   990106644,   991376610, 
+	  992637245,   993888536,   995130473,   996363043,   997586236,   998800038,  1000004439,  1001199428, 
+	 1002384994,  1003561124,  1004727809,  1005885036,  1007032796,  1008171077,  1009299870,  1010419162, 
+	 1011528943,  1012629204,  1013719934,  1014801122,  1015872758,  1016934832,  1017987335,  1019030256, 
+	 1020063586,  1021087314,  1022101432,  1023105929,  1024100796,  1025086024,  1026061603,  1027027525, 
+	 1027983780,  1028930359,  1029867254,  1030794455,  1031711954,  1032619742,  1033517810,  1034406151, 
+	 1035284755,  1036153615,  1037012723,  1037862069,  1038701647,  1039531448,  1040351465,  1041161689, 
+	 1041962114,  1042752731,  1043533534,  1044304514,  1045065665,  1045816980,  1046558451,  1047290071, 
+	 1048011834,  1048723732,  1049425759,  1050117909,  1050800175,  1051472550,  1052135029,  1052787604, 
+	 1053430270,  1054063021,  1054685850,  1055298753,  1055901722,  1056494753,  1057077840,  1057650977, 
+	 1058214159,  1058767381,  1059310638,  1059843923,  1060367233,  1060880563,  1061383907,  1061877261, 
+	 1062360620,  1062833980,  1063297336,  1063750684,  1064194019,  1064627338,  1065050636,  1065463909, 
+	 1065867154,  1066260367,  1066643544,  1067016680,  1067379774,  1067732821,  1068075818,  1068408763, 
+	 1068731650,  1069044479,  1069347245,  1069639946,  1069922579,  1070195142,  1070457632,  1070710046, 
+	 1070952382,  1071184638,  1071406812,  1071618901,  1071820903,  1072012818,  1072194642,  1072366374, 
+	 1072528012,  1072679556,  1072821003,  1072952352,  1073073603,  1073184753,  1073285802,  1073376748, 
+	 1073457592,  1073528332,  1073588967,  1073639498,  1073679922,  1073710241,  1073730454,  1073740561, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 13)
+	     823550,     2470647,     4117738,     5764820,     7411888,     9058939,    10705968,    12352972, 
+	   13999948,    15646890,    17293795,    18940660,    20587480,    22234252,    23880971,    25527634, 
+	   27174237,    28820776,    30467248,    32113647,    33759971,    35406216,    37052377,    38698452, 
+	   40344435,    41990323,    43636112,    45281799,    46927379,    48572848,    50218204,    51863441, 
+	   53508556,    55153545,    56798405,    58443131,    60087719,    61732166,    63376468,    65020620, 
+	   66664620,    68308462,    69952144,    71595661,    73239010,    74882187,    76525187,    78168007, 
+	   79810644,    81453092,    83095349,    84737410,    86379272,    88020931,    89662382,    91303623, 
+	   92944648,    94585455,    96226040,    97866398,    99506525,   101146419,   102786074,   104425488, 
+	  106064656,   107703574,   109342239,   110980647,   112618793,   114256675,   115894288,   117531627, 
+	  119168691,   120805474,   122441972,   124078183,   125714101,   127349724,   128985047,   130620067, 
+	  132254779,   133889180,   135523266,   137157033,   138790477,   140423595,   142056382,   143688835, 
+	  145320950,   146952723,   148584150,   150215228,   151845952,   153476319,   155106324,   156735965, 
+	  158365237,   159994136,   161622659,   163250801,   164878559,   166505929,   168132908,   169759491, 
+	  171385674,   173011454,   174636827,   176261789,   177886336,   179510465,   181134171,   182757451, 
+	  184380301,   186002717,   187624696,   189246233,   190867324,   192487967,   194108156,   195727889, 
+	  197347161,   198965969,   200584309,   202202177,   203819569,   205436481,   207052910,   208668851, 
+	  210284302,   211899258,   213513715,   215127670,   216741118,   218354057,   219966481,   221578389, 
+	  223189774,   224800635,   226410966,   228020765,   229630027,   231238749,   232846927,   234454557, 
+	  236061635,   237668158,   239274121,   240879522,   242484355,   244088618,   245692307,   247295417, 
+	  248897946,   250499889,   252101242,   253702003,   255302166,   256901728,   258500686,   260099036, 
+	  261696774,   263293896,   264890398,   266486277,   268081529,   269676150,   271270136,   272863485, 
+	  274456191,   276048251,   277639662,   279230419,   280820520,   282409959,   283998734,   285586841, 
+	  287174276,   288761035,   290347114,   291932511,   293517220,   295101239,   296684563,   298267189, 
+	  299849113,   301430332,   303010842,   304590638,   306169718,   307748077,   309325712,   310902619, 
+	  312478795,   314054235,   315628937,   317202895,   318776108,   320348570,   321920278,   323491229, 
+	  325061418,   326630843,   328199499,   329767383,   331334491,   332900819,   334466364,   336031121, 
+	  337595089,   339158261,   340720636,   342282209,   343842976,   345402934,   346962080,   348520409, 
+	  350077918,   351634604,   353190461,   354745488,   356299680,   357853034,   359405545,   360957211, 
+	  362508027,   364057991,   365607098,   367155344,   368702727,   370249242,   371794885,   373339654, 
+	  374883544,   376426553,   377968675,   379509908,   381050248,   382589691,   384128234,   385665873, 
+	  387202605,   388738426,   390273331,   391807319,   393340384,   394872524,   396403735,   397934013, 
+	  399463355,   400991756,   402519214,   404045725,   405571285,   407095891,   408619539,   410142225, 
+	  411663946,   413184699,   414704479,   416223284,   417741109,   419257951,   420773806,   422288671, 
+	  423802543,   425315418,   426827291,   428338160,   429848022,   431356872,   432864706,   434371523, 
+	  435877317,   437382085,   438885824,   440388531,   441890201,   443390832,   444890419,   446388959, 
+	  447886449,   449382885,   450878263,   452372581,   453865834,   455358019,   456849132,   458339171, 
+	  459828131,   461316009,   462802801,   464288505,   465773116,   467256631,   468739046,   470220358, 
+	  471700564,   473179660,   474657643,   476134509,   477610254,   479084875,   480558369,   482030733, 
+	  483501962,   484972053,   486441003,   487908809,   489375466,   490840972,   492305322,   493768515, 
+	  495230545,   496691410,   498151107,   499609631,   501066980,   502523149,   503978136,   505431937, 
+	  506884549,   508335968,   509786191,   511235214,   512683035,   514129648,   515575053,   517019243, 
+	  518462218,   519903972,   521344503,   522783807,   524221881,   525658722,   527094325,   528528689, 
+	  529961808,   531393681,   532824303,   534253671,   535681782,   537108633,   538534220,   539958539, 
+	  541381588,   542803363,   544223861,   545643078,   547061011,   548477657,   549893013,   551307074, 
+	  552719838,   554131301,   555541461,   556950313,   558357855,   559764083,   561168994,   562572584, 
+	  563974850,   565375790,   566775399,   568173674,   569570612,   570966210,   572360465,   573753372, 
+	  575144930,   576535134,   577923982,   579311470,   580697594,   582082352,   583465740,   584847756, 
+	  586228395,   587607655,   588985532,   590362023,   591737125,   593110835,   594483148,   595854063, 
+	  597223576,   598591684,   599958383,   601323670,   602687543,   604049997,   605411029,   606770638, 
+	  608128818,   609485567,   610840882,   612194760,   613547198,   614898191,   616247738,   617595834, 
+	  618942478,   620287664,   621631392,   622973656,   624314455,   625653784,   626991641,   628328023, 
+	  629662927,   630996348,   632328285,   633658734,   634987692,   636315156,   637641122,   638965588, 
+	  640288551,   641610007,   642929953,   644248386,   645565303,   646880701,   648194577,   649506928, 
+	  650817750,   652127041,   653434797,   654741016,   656045694,   657348828,   658650416,   659950454, 
+	  661248938,   662545867,   663841237,   665135044,   666427287,   667717961,   669007064,   670294593, 
+	  671580545,   672864916,   674147704,   675428906,   676708518,   677986538,   679262963,   680537789, 
+	  681811014,   683082635,   684352648,   685621051,   686887840,   688153013,   689416567,   690678499, 
+	  691938805,   693197483,   694454530,   695709943,   696963719,   698215855,   699466348,   700715194, 
+	  701962393,   703207939,   704451830,   705694064,   706934638,   708173547,   709410791,   710646365, 
+	  711880267,   713112494,   714343043,   715571910,   716799095,   718024592,   719248400,   720470515, 
+	  721690935,   722909657,   724126677,   725341994,   726555604,   727767504,   728977692,   730186165, 
+	  731392919,   732597952,   733801261,   735002844,   736202697,   737400818,   738597203,   739791851, 
+	  740984758,   742175921,   743365338,   744553005,   745738921,   746923082,   748105485,   749286127, 
+	  750465007,   751642121,   752817466,   753991040,   755162839,   756332861,   757501104,   758667564, 
+	  759832239,   760995126,   762156223,   763315525,   764473032,   765628740,   766782646,   767934748, 
+	  769085043,   770233528,   771380201,   772525059,   773668099,   774809318,   775948714,   777086284, 
+	  778222026,   779355936,   780488013,   781618253,   782746654,   783873212,   784997927,   786120794, 
+	  787241811,   788360976,   789478286,   790593738,   791707330,   792819059,   793928922,   795036917, 
+	  796143041,   797247292,   798349667,   799450163,   800548778,   801645509,   802740354,   803833310, 
+	  804924374,   806013545,   807100819,   808186193,   809269666,   810351235,   811430896,   812508649, 
+	  813584489,   814658415,   815730424,   816800514,   817868681,   818934924,   819999240,   821061627, 
+	  822122081,   823180601,   824237184,   825291827,   826344528,   827395285,   828444095,   829490956, 
+	  830535864,   831578819,   832619816,   833658855,   834695931,   835731044,   836764190,   837795367, 
+	  838824572,   839851804,   840877059,   841900336,   842921632,   843940944,   844958270,   845973608, 
+	  846986956,   847998310,   849007669,   850015030,   851020391,   852023750,   853025104,   854024450, 
+	  855021787,   856017111,   857010422,   858001716,   858990991,   859978244,   860963474,   861946678, 
+	  862927854,   863906999,   864884112,   865859189,   866832229,   867803229,   868772187,   869739101, 
+	  870703968,   871666786,   872627553,   873586267,   874542925,   875497526,   876450066,   877400544, 
+	  878348957,   879295303,   880239581,   881181787,   882121919,   883059976,   883995955,   884929853, 
+	  885861670,   886791402,   887719047,   888644603,   889568068,   890489440,   891408717,   892325896, 
+	  893240975,   894153953,   895064826,   895973593,   896880252,   897784800,   898687236,   899587557, 
+	  900485762,   901381847,   902275811,   903167653,   904057369,   904944957,   905830417,   906713744, 
+	  907594938,   908473997,   909350918,   910225699,   911098338,   911968833,   912837182,   913703383, 
+	  914567435,   915429334,   916289079,   917146668,   918002099,   918855369,   919706478,   920555422, 
+	  921402200,   922246810,   923089250,   923929518,   924767612,   925603530,   926437269,   927268829, 
+	  928098206,   928925400,   929750408,   930573228,   931393859,   932212297,   933028542,   933842592, 
+	  934654444,   935464097,   936271549,   937076797,   937879841,   938680677,   939479305,   940275722, 
+	  941069926,   941861917,   942651690,   943439246,   944224582,   945007695,   945788585,   946567250, 
+	  947343687,   948117895,   948889872,   949659616,   950427126,   951192399,   951955434,   952716228, 
+	  953474781,   954231090,   954985154,   955736971,   956486539,   957233856,   957978921,   958721731, 
+	  959462286,   960200582,   960936620,   961670396,   962401909,   963131157,   963858140,   964582854, 
+	  965305298,   966025471,   966743371,   967458996,   968172345,   968883415,   969592205,   970298714, 
+	  971002940,   971704881,   972404535,   973101901,   973796977,   974489762,   975180254,   975868451, 
+	  976554352,   977237955,   977919258,   978598260,   979274960,   979949355,   980621444,   981291226, 
+	  981958698,   982623860,   983286710,   983947246,   984605467,   985261370,   985914956,   986566221, 
+	  987215165,   987861786,   988506083,   989148053,   989787696,   990425010,   991059993,   991692644, 
+	  992322961,   992950944,   993576590,   994199898,   994820867,   995439494,   996055780,   996669721, 
+	  997281317,   997890567,   998497468,   999102020,   999704221,  1000304069,  1000901564,  1001496704, 
+	 1002089486,  1002679911,  1003267977,  1003853681,  1004437024,  1005018003,  1005596617,  1006172864, 
+	 1006746744,  1007318256,  1007887396,  1008454166,  1009018562,  1009580584,  1010140230,  1010697499, 
+	 1011252390,  1011804901,  1012355032,  1012902780,  1013448145,  1013991126,  1014531720,  1015069927, 
+	 1015605745,  1016139173,  1016670211,  1017198856,  1017725107,  1018248964,  1018770425,  1019289488, 
+	 1019806153,  1020320418,  1020832283,  1021341745,  1021848804,  1022353458,  1022855707,  1023355549, 
+	 1023852982,  1024348007,  1024840621,  1025330824,  1025818614,  1026303990,  1026786951,  1027267495, 
+	 1027745623,  1028221332,  1028694622,  1029165491,  1029633939,  1030099963,  1030563564,  1031024740, 
+	 1031483489,  1031939812,  1032393706,  1032845170,  1033294205,  1033740808,  1034184978,  1034626715, 
+	 1035066018,  1035502884,  1035937314,  1036369307,  1036798861,  1037225975,  1037650648,  1038072880, 
+	 1038492669,  1038910014,  1039324915,  1039737370,  1040147378,  1040554939,  1040960052,  1041362715, 
+	 1041762927,  1042160688,  1042555997,  1042948852,  1043339254,  1043727200,  1044112690,  1044495724, 
+	 1044876299,  1045254416,  1045630074,  1046003271,  1046374006,  1046742279,  1047108090,  1047471436, 
+	 1047832317,  1048190733,  1048546683,  1048900165,  1049251178,  1049599723,  1049945798,  1050289403, 
+	 1050630536,  1050969196,  1051305384,  1051639098,  1051970337,  1052299101,  1052625389,  1052949200, 
+	 1053270533,  1053589387,  1053905763,  1054219658,  1054531073,  1054840007,  1055146458,  1055450426, 
+	 1055751911,  1056050912,  1056347427,  1056641457,  1056933001,  1057222057,  1057508626,  1057792706, 
+	 1058074297,  1058353399,  1058630010,  1058904130,  1059175758,  1059444894,  1059711537,  1059975686, 
+	 1060237341,  1060496502,  1060753166,  1061007335,  1061259007,  1061508182,  1061754859,  1061999038, 
+	 1062240717,  1062479898,  1062716578,  1062950757,  1063182435,  1063411611,  1063638285,  1063862456, 
+	 1064084124,  1064303288,  1064519947,  1064734102,  1064945751,  1065154894,  1065361531,  1065565661, 
+	 1065767284,  1065966398,  1066163005,  1066357102,  1066548690,  1066737769,  1066924338,  1067108396, 
+	 1067289942,  1067468978,  1067645501,  1067819513,  1067991011,  1068159997,  1068326469,  1068490427, 
+	 1068651871,  1068810801,  1068967215,  1069121114,  1069272497,  1069421364,  1069567715,  1069711548, 
+	 1069852865,  1069991664,  1070127946,  1070261709,  1070392954,  1070521680,  1070647887,  1070771575, 
+	 1070892743,  1071011391,  1071127519,  1071241127,  1071352214,  1071460780,  1071566824,  1071670347, 
+	 1071771349,  1071869828,  1071965785,  1072059220,  1072150132,  1072238521,  1072324387,  1072407730, 
+	 1072488549,  1072566845,  1072642617,  1072715864,  1072786588,  1072854787,  1072920462,  1072983612, 
+	 1073044237,  1073102337,  1073157912,  1073210962,  1073261486,  1073309485,  1073354959,  1073397906, 
+	 1073438328,  1073476224,  1073511594,  1073544438,  1073574756,  1073602547,  1073627812,  1073650551, 
+	 1073670764,  1073688450,  1073703609,  1073716242,  1073726348,  1073733928,  1073738982,  1073741508, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 14)
+	     411775,     1235324,     2058873,     2882420,     3705966,     4529510,     5353051,     6176588, 
+	    7000123,     7823653,     8647178,     9470698,    10294213,    11117722,    11941224,    12764719, 
+	   13588207,    14411686,    15235158,    16058620,    16882072,    17705515,    18528948,    19352369, 
+	   20175779,    20999178,    21822563,    22645937,    23469296,    24292642,    25115974,    25939291, 
+	   26762592,    27585878,    28409148,    29232401,    30055636,    30878855,    31702054,    32525236, 
+	   33348398,    34171540,    34994663,    35817764,    36640845,    37463904,    38286941,    39109956, 
+	   39932948,    40755916,    41578860,    42401779,    43224674,    44047544,    44870387,    45693204, 
+	   46515994,    47338757,    48161492,    48984198,    49806876,    50629524,    51452143,    52274731, 
+	   53097289,    53919815,    54742310,    55564773,    56387202,    57209599,    58031962,    58854291, 
+	   59676585,    60498844,    61321068,    62143255,    62965406,    63787520,    64609596,    65431634, 
+	   66253634,    67075595,    67897517,    68719398,    69541239,    70363039,    71184798,    72006515, 
+	   72828189,    73649821,    74471409,    75292954,    76114454,    76935909,    77757319,    78578684, 
+	   79400002,    80221273,    81042498,    81863674,    82684803,    83505883,    84326913,    85147894, 
+	   85968825,    86789706,    87610535,    88431313,    89252039,    90072712,    90893333,    91713899, 
+	   92534412,    93354871,    94175274,    94995622,    95815915,    96636151,    97456330,    98276451, 
+	   99096515,    99916521,   100736468,   101556355,   102376183,   103195951,   104015658,   104835303, 
+	  105654887,   106474409,   107293868,   108113265,   108932597,   109751866,   110571069,   111390208, 
+	  112209281,   113028289,   113847230,   114666103,   115484910,   116303648,   117122318,   117940919, 
+	  118759451,   119577913,   120396304,   121214625,   122032875,   122851052,   123669157,   124487190, 
+	  125305149,   126123035,   126940846,   127758583,   128576245,   129393831,   130211341,   131028774, 
+	  131846130,   132663409,   133480609,   134297731,   135114774,   135931738,   136748621,   137565425, 
+	  138382147,   139198788,   140015347,   140831823,   141648217,   142464527,   143280754,   144096896, 
+	  144912954,   145728926,   146544812,   147360613,   148176326,   148991953,   149807492,   150622942, 
+	  151438304,   152253577,   153068761,   153883854,   154698857,   155513769,   156328589,   157143318, 
+	  157957954,   158772497,   159586946,   160401302,   161215564,   162029730,   162843801,   163657777, 
+	  164471656,   165285438,   166099124,   166912711,   167726200,   168539591,   169352882,   170166074, 
+	  170979166,   171792157,   172605047,   173417836,   174230522,   175043106,   175855587,   176667965, 
+	  177480239,   178292408,   179104472,   179916431,   180728284,   181540031,   182351671,   183163204, 
+	  183974629,   184785946,   185597154,   186408253,   187219242,   188030122,   188840890,   189651548, 
+	  190462093,   191272527,   192082849,   192893057,   193703152,   194513133,   195322999,   196132751, 
+	  196942387,   197751907,   198561311,   199370598,   200179768,   200988820,   201797754,   202606569, 
+	  203415265,   204223842,   205032298,   205840633,   206648848,   207456941,   208264912,   209072760, 
+	  209880485,   210688087,   211495565,   212302919,   213110148,   213917251,   214724228,   215531079, 
+	  216337804,   217144401,   217950870,   218757211,   219563424,   220369507,   221175461,   221981284, 
+	  222786977,   223592539,   224397969,   225203267,   226008433,   226813466,   227618366,   228423131, 
+	  229227762,   230032259,   230836620,   231640845,   232444934,   233248886,   234052701,   234856378, 
+	  235659918,   236463318,   237266579,   238069701,   238872683,   239675524,   240478225,   241280783, 
+	  242083200,   242885475,   243687606,   244489594,   245291439,   246093139,   246894694,   247696104, 
+	  248497369,   249298487,   250099458,   250900283,   251700959,   252501488,   253301868,   254102099, 
+	  254902181,   255702113,   256501894,   257301525,   258101004,   258900331,   259699506,   260498528, 
+	  261297397,   262096112,   262894673,   263693079,   264491331,   265289426,   266087366,   266885149, 
+	  267682775,   268480243,   269277554,   270074706,   270871700,   271668533,   272465208,   273261722, 
+	  274058075,   274854267,   275650297,   276446165,   277241870,   278037413,   278832791,   279628006, 
+	  280423056,   281217942,   282012662,   282807215,   283601603,   284395824,   285189877,   285983763, 
+	  286777480,   287571029,   288364409,   289157619,   289950658,   290743528,   291536226,   292328753, 
+	  293121107,   293913290,   294705299,   295497135,   296288797,   297080285,   297871598,   298662736, 
+	  299453698,   300244484,   301035094,   301825526,   302615781,   303405858,   304195756,   304985475, 
+	  305775015,   306564375,   307353555,   308142554,   308931371,   309720007,   310508461,   311296732, 
+	  312084820,   312872724,   313660444,   314447980,   315235331,   316022496,   316809475,   317596268, 
+	  318382875,   319169293,   319955525,   320741568,   321527422,   322313087,   323098562,   323883848, 
+	  324668942,   325453846,   326238559,   327023079,   327807407,   328591543,   329375485,   330159233, 
+	  330942787,   331726146,   332509310,   333292279,   334075051,   334857627,   335640006,   336422188, 
+	  337204171,   337985956,   338767543,   339548930,   340330117,   341111104,   341891891,   342672476, 
+	  343452860,   344233042,   345013021,   345792797,   346572370,   347351739,   348130904,   348909863, 
+	  349688618,   350467167,   351245510,   352023646,   352801575,   353579296,   354356810,   355134115, 
+	  355911211,   356688097,   357464774,   358241241,   359017496,   359793541,   360569374,   361344995, 
+	  362120403,   362895598,   363670580,   364445348,   365219902,   365994240,   366768363,   367542271, 
+	  368315962,   369089437,   369862694,   370635734,   371408556,   372181160,   372953544,   373725709, 
+	  374497654,   375269379,   376040883,   376812166,   377583228,   378354067,   379124683,   379895077, 
+	  380665247,   381435193,   382204915,   382974412,   383743683,   384512729,   385281549,   386050142, 
+	  386818508,   387586646,   388354556,   389122238,   389889691,   390656915,   391423908,   392190672, 
+	  392957205,   393723506,   394489576,   395255414,   396021020,   396786392,   397551531,   398316436, 
+	  399081107,   399845543,   400609744,   401373709,   402137438,   402900931,   403664186,   404427204, 
+	  405189985,   405952526,   406714829,   407476893,   408238717,   409000301,   409761644,   410522746, 
+	  411283607,   412044226,   412804602,   413564735,   414324625,   415084272,   415843674,   416602832, 
+	  417361744,   418120411,   418878833,   419637007,   420394935,   421152615,   421910048,   422667233, 
+	  423424169,   424180855,   424937293,   425693480,   426449417,   427205103,   427960537,   428715720, 
+	  429470651,   430225329,   430979754,   431733926,   432487843,   433241506,   433994914,   434748067, 
+	  435500964,   436253605,   437005989,   437758117,   438509986,   439261598,   440012951,   440764046, 
+	  441514881,   442265456,   443015772,   443765826,   444515620,   445265152,   446014422,   446763430, 
+	  447512175,   448260657,   449008875,   449756829,   450504518,   451251942,   451999101,   452745994, 
+	  453492620,   454238980,   454985073,   455730898,   456476455,   457221743,   457966762,   458711512, 
+	  459455992,   460200202,   460944141,   461687809,   462431205,   463174329,   463917181,   464659760, 
+	  465402066,   466144097,   466885855,   467627338,   468368545,   469109478,   469850134,   470590514, 
+	  471330617,   472070443,   472809991,   473549261,   474288252,   475026964,   475765397,   476503550, 
+	  477241423,   477979015,   478716326,   479453355,   480190102,   480926566,   481662748,   482398646, 
+	  483134261,   483869591,   484604637,   485339398,   486073873,   486808062,   487541965,   488275581, 
+	  489008909,   489741950,   490474703,   491207168,   491939343,   492671229,   493402826,   494134132, 
+	  494865147,   495595871,   496326304,   497056444,   497786293,   498515848,   499245110,   499974079, 
+	  500702753,   501431133,   502159217,   502887007,   503614500,   504341698,   505068598,   505795202, 
+	  506521508,   507247516,   507973225,   508698636,   509423748,   510148559,   510873071,   511597282, 
+	  512321192,   513044801,   513768108,   514491113,   515213815,   515936214,   516658310,   517380101, 
+	  518101588,   518822771,   519543648,   520264220,   520984485,   521704444,   522424096,   523143441, 
+	  523862478,   524581207,   525299627,   526017739,   526735541,   527453033,   528170214,   528887085, 
+	  529603645,   530319893,   531035830,   531751453,   532466765,   533181762,   533896447,   534610817, 
+	  535324872,   536038613,   536752038,   537465148,   538177942,   538890418,   539602578,   540314421, 
+	  541025945,   541737151,   542448039,   543158607,   543868856,   544578785,   545288394,   545997682, 
+	  546706649,   547415294,   548123617,   548831617,   549539295,   550246649,   550953680,   551660387, 
+	  552366769,   553072826,   553778558,   554483964,   555189044,   555893797,   556598223,   557302322, 
+	  558006093,   558709535,   559412649,   560115434,   560817890,   561520015,   562221810,   562923275, 
+	  563624408,   564325210,   565025679,   565725817,   566425621,   567125093,   567824230,   568523034, 
+	  569221503,   569919637,   570617437,   571314900,   572012027,   572708818,   573405272,   574101389, 
+	  574797167,   575492608,   576187710,   576882473,   577576897,   578270981,   578964725,   579658129, 
+	  580351191,   581043912,   581736291,   582428328,   583120022,   583811373,   584502381,   585193045, 
+	  585883365,   586573340,   587262969,   587952254,   588641192,   589329785,   590018030,   590705929, 
+	  591393480,   592080683,   592767538,   593454044,   594140201,   594826008,   595511466,   596196573, 
+	  596881330,   597565735,   598249789,   598933491,   599616840,   600299837,   600982481,   601664771, 
+	  602346707,   603028289,   603709516,   604390388,   605070905,   605751065,   606430869,   607110317, 
+	  607789407,   608468140,   609146514,   609824531,   610502188,   611179487,   611856426,   612533005, 
+	  613209223,   613885081,   614560578,   615235714,   615910487,   616584898,   617258946,   617932631, 
+	  618605953,   619278911,   619951504,   620623733,   621295597,   621967095,   622638227,   623308993, 
+	  623979393,   624649425,   625319090,   625988387,   626657315,   627325875,   627994066,   628661888, 
+	  629329340,   629996421,   630663132,   631329472,   631995440,   632661037,   633326262,   633991114, 
+	  634655593,   635319698,   635983430,   636646788,   637309771,   637972380,   638634613,   639296470, 
+	  639957951,   640619056,   641279784,   641940135,   642600108,   643259703,   643918920,   644577757, 
+	  645236216,   645894295,   646551994,   647209313,   647866251,   648522808,   649178983,   649834777, 
+	  650490188,   651145216,   651799862,   652454124,   653108002,   653761496,   654414606,   655067330, 
+	  655719669,   656371622,   657023190,   657674370,   658325164,   658975571,   659625590,   660275220, 
+	  660924463,   661573317,   662221781,   662869856,   663517541,   664164835,   664811739,   665458252, 
+	  666104373,   666750103,   667395440,   668040385,   668684936,   669329094,   669972859,   670616229, 
+	  671259205,   671901786,   672543972,   673185762,   673827156,   674468154,   675108755,   675748958, 
+	  676388765,   677028173,   677667183,   678305794,   678944007,   679581820,   680219233,   680856246, 
+	  681492858,   682129070,   682764880,   683400289,   684035295,   684669900,   685304101,   685937899, 
+	  686571294,   687204285,   687836872,   688469054,   689100831,   689732202,   690363168,   690993728, 
+	  691623881,   692253627,   692882966,   693511898,   694140422,   694768537,   695396243,   696023541, 
+	  696650429,   697276907,   697902975,   698528632,   699153879,   699778714,   700403137,   701027149, 
+	  701650748,   702273934,   702896707,   703519067,   704141013,   704762544,   705383661,   706004363, 
+	  706624650,   707244521,   707863976,   708483015,   709101636,   709719841,   710337628,   710954997, 
+	  711571948,   712188481,   712804594,   713420288,   714035563,   714650417,   715264851,   715878864, 
+	  716492457,   717105627,   717718376,   718330702,   718942606,   719554087,   720165145,   720775779, 
+	  721385989,   721995775,   722605136,   723214072,   723822582,   724430667,   725038325,   725645557, 
+	  726252362,   726858740,   727464690,   728070212,   728675306,   729279971,   729884208,   730488014, 
+	  731091392,   731694339,   732296855,   732898941,   733500596,   734101819,   734702610,   735302970, 
+	  735902896,   736502390,   737101450,   737700077,   738298270,   738896028,   739493352,   740090241, 
+	  740686694,   741282712,   741878294,   742473439,   743068147,   743662419,   744256253,   744849649, 
+	  745442606,   746035126,   746627206,   747218847,   747810049,   748400811,   748991132,   749581013, 
+	  750170453,   750759451,   751348008,   751936123,   752523796,   753111025,   753697812,   754284156, 
+	  754870056,   755455511,   756040522,   756625089,   757209210,   757792886,   758376116,   758958900, 
+	  759541238,   760123129,   760704572,   761285568,   761866116,   762446217,   763025868,   763605071, 
+	  764183824,   764762128,   765339982,   765917386,   766494339,   767070841,   767646892,   768222492, 
+	  768797639,   769372334,   769946577,   770520367,   771093703,   771666586,   772239015,   772810989, 
+	  773382509,   773953574,   774524184,   775094338,   775664036,   776233278,   776802063,   777370391, 
+	  777938262,   778505675,   779072631,   779639128,   780205166,   780770745,   781335865,   781900526, 
+	  782464726,   783028466,   783591746,   784154564,   784716921,   785278817,   785840250,   786401222, 
+	  786961731,   787521776,   788081359,   788640478,   789199133,   789757323,   790315049,   790872310, 
+	  791429106,   791985437,   792541301,   793096699,   793651631,   794206096,   794760093,   795313623, 
+	  795866685,   796419279,   796971405,   797523061,   798074249,   798624967,   799175215,   799724993, 
+	  800274300,   800823137,   801371503,   801919397,   802466820,   803013770,   803560248,   804106253, 
+	  804651786,   805196845,   805741430,   806285541,   806829178,   807372340,   807915028,   808457240, 
+	  808998976,   809540237,   810081021,   810621329,   811161160,   811700513,   812239390,   812777788, 
+	  813315708,   813853150,   814390113,   814926597,   815462602,   815998127,   816533171,   817067736, 
+	  817601820,   818135422,   818668544,   819201184,   819733342,   820265018,   820796211,   821326921, 
+	  821857149,   822386892,   822916152,   823444928,   823973220,   824501026,   825028348,   825555185, 
+	  826081535,   826607400,   827132778,   827657670,   828182075,   828705993,   829229423,   829752366, 
+	  830274820,   830796786,   831318263,   831839252,   832359750,   832879760,   833399279,   833918308, 
+	  834436846,   834954893,   835472450,   835989515,   836506088,   837022168,   837537757,   838052853, 
+	  838567456,   839081565,   839595181,   840108303,   840620931,   841133064,   841644702,   842155846, 
+	  842666494,   843176646,   843686302,   844195462,   844704125,   845212291,   845719960,   846227132, 
+	  846733806,   847239981,   847745659,   848250837,   848755517,   849259697,   849763378,   850266558, 
+	  850769239,   851271419,   851773098,   852274276,   852774953,   853275128,   853774802,   854273973, 
+	  854772641,   855270806,   855768469,   856265628,   856762283,   857258434,   857754081,   858249224, 
+	  858743861,   859237994,   859731620,   860224742,   860717357,   861209465,   861701067,   862192163, 
+	  862682750,   863172831,   863662404,   864151468,   864640024,   865128072,   865615611,   866102640, 
+	  866589160,   867075170,   867560670,   868045660,   868530139,   869014107,   869497564,   869980510, 
+	  870462943,   870944865,   871426274,   871907170,   872387554,   872867424,   873346781,   873825625, 
+	  874303954,   874781769,   875259069,   875735854,   876212124,   876687879,   877163118,   877637841, 
+	  878112047,   878585737,   879058911,   879531567,   880003705,   880475326,   880946429,   881417014, 
+	  881887080,   882356628,   882825656,   883294165,   883762155,   884229624,   884696574,   885163003, 
+	  885628911,   886094298,   886559164,   887023509,   887487331,   887950632,   888413410,   888875666, 
+	  889337398,   889798608,   890259294,   890719456,   891179094,   891638208,   892096798,   892554863, 
+	  893012402,   893469417,   893925905,   894381868,   894837305,   895292215,   895746599,   896200456, 
+	  896653785,   897106587,   897558861,   898010607,   898461825,   898912515,   899362675,   899812307, 
+	  900261409,   900709982,   901158025,   901605537,   902052519,   902498971,   902944892,   903390281, 
+	  903835139,   904279465,   904723260,   905166522,   905609251,   906051448,   906493112,   906934243, 
+	  907374840,   907814903,   908254433,   908693428,   909131888,   909569814,   910007204,   910444059, 
+	  910880379,   911316163,   911751410,   912186121,   912620296,   913053934,   913487035,   913919598, 
+	  914351624,   914783111,   915214061,   915644472,   916074345,   916503678,   916932473,   917360728, 
+	  917788443,   918215619,   918642254,   919068349,   919493904,   919918917,   920343389,   920767320, 
+	  921190709,   921613556,   922035861,   922457624,   922878844,   923299521,   923719655,   924139246, 
+	  924558292,   924976795,   925394754,   925812169,   926229039,   926645363,   927061143,   927476378, 
+	  927891067,   928305210,   928718807,   929131857,   929544361,   929956318,   930367728,   930778591, 
+	  931188906,   931598674,   932007893,   932416564,   932824687,   933232261,   933639286,   934045761, 
+	  934451687,   934857064,   935261890,   935666166,   936069892,   936473067,   936875692,   937277765, 
+	  937679287,   938080257,   938480675,   938880541,   939279855,   939678616,   940076825,   940474481, 
+	  940871583,   941268132,   941664127,   942059568,   942454455,   942848787,   943242565,   943635788, 
+	  944028456,   944420568,   944812125,   945203126,   945593571,   945983460,   946372792,   946761568, 
+	  947149787,   947537448,   947924552,   948311099,   948697087,   949082517,   949467390,   949851703, 
+	  950235458,   950618654,   951001290,   951383367,   951764885,   952145842,   952526240,   952906077, 
+	  953285353,   953664069,   954042224,   954419817,   954796849,   955173319,   955549228,   955924574, 
+	  956299358,   956673579,   957047238,   957420333,   957792866,   958164835,   958536240,   958907081, 
+	  959277359,   959647071,   960016220,   960384803,   960752822,   961120276,   961487164,   961853486, 
+	  962219243,   962584433,   962949058,   963313116,   963676607,   964039531,   964401888,   964763678, 
+	  965124900,   965485555,   965845641,   966205159,   966564109,   966922491,   967280303,   967637547, 
+	  967994221,   968350326,   968705861,   969060826,   969415222,   969769046,   970122301,   970474985, 
+	  970827098,   971178639,   971529610,   971880009,   972229836,   972579091,   972927774,   973275885, 
+	  973623423,   973970388,   974316781,   974662600,   975007846,   975352518,   975696617,   976040141, 
+	  976383092,   976725468,   977067269,   977408496,   977749148,   978089224,   978428725,   978767651, 
+	  979106001,   979443774,   979780972,   980117593,   980453638,   980789106,   981123997,   981458310, 
+	  981792047,   982125205,   982457786,   982789789,   983121214,   983452061,   983782329,   984112018, 
+	  984441129,   984769660,   985097612,   985424984,   985751777,   986077990,   986403623,   986728675, 
+	  987053147,   987377038,   987700349,   988023078,   988345227,   988666793,   988987779,   989308182, 
+	  989628003,   989947243,   990265900,   990583974,   990901465,   991218374,   991534700,   991850442, 
+	  992165601,   992480176,   992794167,   993107575,   993420398,   993732636,   994044290,   994355360, 
+	  994665844,   994975743,   995285057,   995593785,   995901928,   996209485,   996516456,   996822840, 
+	  997128638,   997433850,   997738475,   998042512,   998345963,   998648827,   998951103,   999252791, 
+	  999553891,   999854404,  1000154328,  1000453664,  1000752411,  1001050570,  1001348140,  1001645120, 
+	 1001941512,  1002237314,  1002532526,  1002827149,  1003121181,  1003414624,  1003707476,  1003999738, 
+	 1004291410,  1004582490,  1004872979,  1005162878,  1005452185,  1005740900,  1006029024,  1006316556, 
+	 1006603496,  1006889844,  1007175600,  1007460763,  1007745333,  1008029311,  1008312696,  1008595487, 
+	 1008877685,  1009159290,  1009440301,  1009720718,  1010000541,  1010279770,  1010558405,  1010836445, 
+	 1011113890,  1011390741,  1011666997,  1011942657,  1012217723,  1012492193,  1012766067,  1013039345, 
+	 1013312028,  1013584114,  1013855604,  1014126498,  1014396795,  1014666495,  1014935599,  1015204105, 
+	 1015472014,  1015739326,  1016006040,  1016272157,  1016537676,  1016802596,  1017066919,  1017330643, 
+	 1017593769,  1017856296,  1018118225,  1018379554,  1018640284,  1018900415,  1019159947,  1019418879, 
+	 1019677212,  1019934944,  1020192077,  1020448610,  1020704542,  1020959873,  1021214605,  1021468735, 
+	 1021722264,  1021975193,  1022227520,  1022479246,  1022730370,  1022980893,  1023230814,  1023480133, 
+	 1023728850,  1023976964,  1024224477,  1024471386,  1024717694,  1024963398,  1025208499,  1025452997, 
+	 1025696892,  1025940184,  1026182872,  1026424956,  1026666437,  1026907313,  1027147586,  1027387254, 
+	 1027626318,  1027864777,  1028102632,  1028339882,  1028576527,  1028812566,  1029048001,  1029282830, 
+	 1029517054,  1029750672,  1029983684,  1030216091,  1030447891,  1030679085,  1030909673,  1031139655, 
+	 1031369029,  1031597797,  1031825959,  1032053513,  1032280460,  1032506800,  1032732532,  1032957657, 
+	 1033182174,  1033406084,  1033629385,  1033852079,  1034074164,  1034295641,  1034516509,  1034736769, 
+	 1034956420,  1035175463,  1035393896,  1035611720,  1035828935,  1036045541,  1036261537,  1036476924, 
+	 1036691701,  1036905868,  1037119425,  1037332372,  1037544709,  1037756435,  1037967551,  1038178056, 
+	 1038387951,  1038597234,  1038805907,  1039013969,  1039221419,  1039428258,  1039634486,  1039840101, 
+	 1040045106,  1040249498,  1040453279,  1040656447,  1040859003,  1041060947,  1041262279,  1041462997, 
+	 1041663104,  1041862597,  1042061478,  1042259745,  1042457400,  1042654441,  1042850869,  1043046683, 
+	 1043241884,  1043436471,  1043630444,  1043823803,  1044016548,  1044208679,  1044400196,  1044591098, 
+	 1044781386,  1044971059,  1045160118,  1045348561,  1045536390,  1045723604,  1045910202,  1046096185, 
+	 1046281553,  1046466305,  1046650442,  1046833963,  1047016868,  1047199157,  1047380830,  1047561887, 
+	 1047742328,  1047922153,  1048101360,  1048279952,  1048457926,  1048635284,  1048812025,  1048988149, 
+	 1049163656,  1049338546,  1049512818,  1049686474,  1049859511,  1050031931,  1050203733,  1050374918, 
+	 1050545484,  1050715433,  1050884763,  1051053475,  1051221569,  1051389044,  1051555901,  1051722140, 
+	 1051887759,  1052052760,  1052217142,  1052380905,  1052544049,  1052706574,  1052868479,  1053029765, 
+	 1053190432,  1053350479,  1053509906,  1053668714,  1053826901,  1053984469,  1054141417,  1054297745, 
+	 1054453452,  1054608539,  1054763006,  1054916852,  1055070078,  1055222683,  1055374667,  1055526030, 
+	 1055676773,  1055826894,  1055976395,  1056125274,  1056273531,  1056421168,  1056568183,  1056714576, 
+	 1056860348,  1057005498,  1057150026,  1057293933,  1057437217,  1057579879,  1057721919,  1057863337, 
+	 1058004133,  1058144306,  1058283857,  1058422785,  1058561091,  1058698773,  1058835833,  1058972270, 
+	 1059108085,  1059243276,  1059377844,  1059511788,  1059645110,  1059777808,  1059909883,  1060041334, 
+	 1060172161,  1060302365,  1060431945,  1060560902,  1060689234,  1060816943,  1060944027,  1061070487, 
+	 1061196323,  1061321535,  1061446123,  1061570086,  1061693424,  1061816138,  1061938227,  1062059692, 
+	 1062180532,  1062300747,  1062420337,  1062539302,  1062657642,  1062775357,  1062892446,  1063008911, 
+	 1063124750,  1063239964,  1063354552,  1063468514,  1063581851,  1063694563,  1063806648,  1063918108, 
+	 1064028942,  1064139150,  1064248732,  1064357688,  1064466017,  1064573721,  1064680798,  1064787249, 
+	 1064893074,  1064998272,  1065102844,  1065206789,  1065310107,  1065412799,  1065514864,  1065616302, 
+	 1065717113,  1065817297,  1065916855,  1066015785,  1066114088,  1066211764,  1066308813,  1066405234, 
+	 1066501029,  1066596195,  1066690735,  1066784647,  1066877931,  1066970587,  1067062616,  1067154018, 
+	 1067244791,  1067334937,  1067424454,  1067513344,  1067601606,  1067689240,  1067776246,  1067862623, 
+	 1067948372,  1068033493,  1068117986,  1068201851,  1068285087,  1068367694,  1068449673,  1068531024, 
+	 1068611746,  1068691839,  1068771304,  1068850140,  1068928347,  1069005925,  1069082875,  1069159195, 
+	 1069234887,  1069309950,  1069384383,  1069458188,  1069531363,  1069603909,  1069675826,  1069747114, 
+	 1069817772,  1069887801,  1069957201,  1070025971,  1070094111,  1070161623,  1070228504,  1070294756, 
+	 1070360379,  1070425372,  1070489735,  1070553468,  1070616572,  1070679045,  1070740889,  1070802103, 
+	 1070862687,  1070922641,  1070981966,  1071040660,  1071098724,  1071156158,  1071212961,  1071269135, 
+	 1071324678,  1071379592,  1071433874,  1071487527,  1071540549,  1071592941,  1071644703,  1071695834, 
+	 1071746335,  1071796205,  1071845445,  1071894054,  1071942032,  1071989380,  1072036098,  1072082184, 
+	 1072127640,  1072172466,  1072216660,  1072260224,  1072303157,  1072345459,  1072387131,  1072428171, 
+	 1072468581,  1072508360,  1072547508,  1072586024,  1072623910,  1072661165,  1072697789,  1072733782, 
+	 1072769144,  1072803874,  1072837974,  1072871443,  1072904280,  1072936486,  1072968061,  1072999005, 
+	 1073029317,  1073058999,  1073088049,  1073116468,  1073144255,  1073171411,  1073197936,  1073223830, 
+	 1073249092,  1073273723,  1073297722,  1073321091,  1073343827,  1073365932,  1073387406,  1073408249, 
+	 1073428460,  1073448039,  1073466987,  1073485303,  1073502988,  1073520042,  1073536464,  1073552254, 
+	 1073567413,  1073581940,  1073595836,  1073609100,  1073621733,  1073633734,  1073645103,  1073655841, 
+	 1073665947,  1073675422,  1073684265,  1073692476,  1073700056,  1073707004,  1073713321,  1073719006, 
+	 1073724059,  1073728480,  1073732270,  1073735429,  1073737955,  1073739850,  1073741113,  1073741745, 
+#endif
+	};
+#endif
+
+const int16_t xs3_fft_sine_lut_s16[XS3_FFT_SINE_LUT_SIZE] = 
+	{
+	     0,  16384, 
+	 11585, 
+#if (XS3_MATH_FFT_MAX_LOG2 >= 4)
+	  6270,  15137, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 5)
+	  3196,   9102,  13623,  16069, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 6)
+	  1606,   4756,   7723,  10394,  12665,  14449,  15679,  16305, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 7)
+	   804,   2404,   3981,   5520,   7005,   8423,   9760,  11003,  12140,  13160,  14053,  14811,  15426,  15893,  16207,  16364, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 8)
+	   402,   1205,   2006,   2801,   3590,   4370,   5139,   5897,   6639,   7366,   8076,   8765,   9434,  10080,  10702,  11297, 
+	 11866,  12406,  12916,  13395,  13842,  14256,  14635,  14978,  15286,  15557,  15791,  15986,  16143,  16261,  16340,  16379, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 9)
+	   201,    603,   1005,   1406,   1806,   2205,   2603,   2999,   3393,   3786,   4176,   4563,   4948,   5330,   5708,   6084, 
+	  6455,   6823,   7186,   7545,   7900,   8250,   8595,   8935,   9269,   9598,   9921,  10238,  10549,  10853,  11151,  11442, 
+	 11727,  12004,  12274,  12537,  12792,  13039,  13279,  13510,  13733,  13949,  14155,  14354,  14543,  14724,  14896,  15059, 
+	 15213,  15357,  15493,  15619,  15736,  15843,  15941,  16029,  16107,  16176,  16235,  16284,  16324,  16353,  16373,  16383, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 10)
+	   101,    302,    503,    704,    904,   1105,   1306,   1506,   1706,   1906,   2105,   2305,   2503,   2702,   2900,   3098, 
+	  3295,   3492,   3688,   3883,   4078,   4273,   4467,   4660,   4852,   5044,   5235,   5425,   5614,   5803,   5990,   6177, 
+	  6363,   6547,   6731,   6914,   7096,   7276,   7456,   7635,   7812,   7988,   8163,   8337,   8509,   8680,   8850,   9019, 
+	  9186,   9352,   9516,   9679,   9841,  10001,  10159,  10316,  10471,  10625,  10778,  10928,  11077,  11224,  11370,  11514, 
+	 11656,  11797,  11935,  12072,  12207,  12340,  12472,  12601,  12729,  12854,  12978,  13100,  13219,  13337,  13453,  13567, 
+	 13678,  13788,  13896,  14001,  14104,  14206,  14305,  14402,  14497,  14589,  14680,  14768,  14854,  14937,  15019,  15098, 
+	 15175,  15250,  15322,  15392,  15460,  15525,  15588,  15649,  15707,  15763,  15817,  15868,  15917,  15964,  16008,  16049, 
+	 16088,  16125,  16160,  16192,  16221,  16248,  16273,  16295,  16315,  16332,  16347,  16359,  16369,  16376,  16381,  16384, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 11)
+	    50,    151,    251,    352,    452,    553,    653,    754,    854,    955,   1055,   1155,   1255,   1356,   1456,   1556, 
+	  1656,   1756,   1856,   1956,   2055,   2155,   2255,   2354,   2454,   2553,   2652,   2752,   2851,   2949,   3048,   3147, 
+	  3246,   3344,   3442,   3541,   3639,   3737,   3835,   3932,   4030,   4127,   4224,   4321,   4418,   4515,   4612,   4708, 
+	  4804,   4900,   4996,   5092,   5187,   5282,   5377,   5472,   5567,   5661,   5756,   5850,   5943,   6037,   6130,   6223, 
+	  6316,   6409,   6501,   6593,   6685,   6777,   6868,   6960,   7050,   7141,   7231,   7321,   7411,   7501,   7590,   7679, 
+	  7768,   7856,   7944,   8032,   8119,   8207,   8293,   8380,   8466,   8552,   8638,   8723,   8808,   8892,   8977,   9061, 
+	  9144,   9227,   9310,   9393,   9475,   9557,   9638,   9720,   9800,   9881,   9961,  10040,  10120,  10198,  10277,  10355, 
+	 10433,  10510,  10587,  10663,  10740,  10815,  10891,  10966,  11040,  11114,  11188,  11261,  11334,  11406,  11478,  11550, 
+	 11621,  11691,  11762,  11831,  11901,  11970,  12038,  12106,  12173,  12240,  12307,  12373,  12439,  12504,  12569,  12633, 
+	 12697,  12760,  12823,  12885,  12947,  13008,  13069,  13130,  13190,  13249,  13308,  13366,  13424,  13482,  13538,  13595, 
+	 13651,  13706,  13761,  13815,  13869,  13922,  13975,  14027,  14079,  14130,  14181,  14231,  14280,  14329,  14378,  14426, 
+	 14473,  14520,  14566,  14612,  14657,  14702,  14746,  14789,  14832,  14875,  14917,  14958,  14999,  15039,  15078,  15118, 
+	 15156,  15194,  15231,  15268,  15304,  15340,  15375,  15409,  15443,  15476,  15509,  15541,  15573,  15604,  15634,  15664, 
+	 15693,  15722,  15750,  15777,  15804,  15830,  15856,  15881,  15905,  15929,  15952,  15975,  15997,  16018,  16039,  16059, 
+	 16079,  16098,  16116,  16134,  16151,  16168,  16184,  16199,  16214,  16228,  16242,  16255,  16267,  16279,  16290,  16300, 
+	 16310,  16319,  16328,  16336,  16343,  16350,  16356,  16362,  16367,  16371,  16375,  16378,  16380,  16382,  16383,  16384, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 12)
+	    25,     75,    126,    176,    226,    276,    327,    377,    427,    477,    528,    578,    628,    678,    729,    779, 
+	   829,    879,    929,    980,   1030,   1080,   1130,   1180,   1230,   1280,   1331,   1381,   1431,   1481,   1531,   1581, 
+	  1631,   1681,   1731,   1781,   1831,   1881,   1931,   1981,   2031,   2080,   2130,   2180,   2230,   2280,   2329,   2379, 
+	  2429,   2479,   2528,   2578,   2628,   2677,   2727,   2776,   2826,   2875,   2925,   2974,   3024,   3073,   3122,   3172, 
+	  3221,   3270,   3320,   3369,   3418,   3467,   3516,   3565,   3614,   3663,   3712,   3761,   3810,   3859,   3908,   3957, 
+	  4005,   4054,   4103,   4151,   4200,   4249,   4297,   4346,   4394,   4442,   4491,   4539,   4587,   4636,   4684,   4732, 
+	  4780,   4828,   4876,   4924,   4972,   5020,   5068,   5115,   5163,   5211,   5259,   5306,   5354,   5401,   5449,   5496, 
+	  5543,   5591,   5638,   5685,   5732,   5779,   5826,   5873,   5920,   5967,   6014,   6060,   6107,   6154,   6200,   6247, 
+	  6293,   6339,   6386,   6432,   6478,   6524,   6570,   6616,   6662,   6708,   6754,   6800,   6846,   6891,   6937,   6982, 
+	  7028,   7073,   7118,   7164,   7209,   7254,   7299,   7344,   7389,   7434,   7478,   7523,   7568,   7612,   7657,   7701, 
+	  7746,   7790,   7834,   7878,   7922,   7966,   8010,   8054,   8098,   8141,   8185,   8228,   8272,   8315,   8358,   8401, 
+	  8445,   8488,   8531,   8573,   8616,   8659,   8702,   8744,   8787,   8829,   8871,   8914,   8956,   8998,   9040,   9082, 
+	  9123,   9165,   9207,   9248,   9290,   9331,   9372,   9413,   9455,   9496,   9537,   9577,   9618,   9659,   9699,   9740, 
+	  9780,   9820,   9861,   9901,   9941,   9981,  10020,  10060,  10100,  10139,  10179,  10218,  10257,  10296,  10336,  10374, 
+	 10413,  10452,  10491,  10529,  10568,  10606,  10644,  10683,  10721,  10759,  10796,  10834,  10872,  10909,  10947,  10984, 
+	 11021,  11059,  11096,  11133,  11169,  11206,  11243,  11279,  11316,  11352,  11388,  11424,  11460,  11496,  11532,  11567, 
+	 11603,  11638,  11674,  11709,  11744,  11779,  11814,  11849,  11883,  11918,  11952,  11987,  12021,  12055,  12089,  12123, 
+	 12157,  12190,  12224,  12257,  12290,  12324,  12357,  12390,  12423,  12455,  12488,  12520,  12553,  12585,  12617,  12649, 
+	 12681,  12713,  12744,  12776,  12807,  12839,  12870,  12901,  12932,  12963,  12993,  13024,  13054,  13085,  13115,  13145, 
+	 13175,  13205,  13234,  13264,  13293,  13323,  13352,  13381,  13410,  13439,  13467,  13496,  13524,  13553,  13581,  13609, 
+	 13637,  13665,  13692,  13720,  13747,  13774,  13802,  13829,  13856,  13882,  13909,  13935,  13962,  13988,  14014,  14040, 
+	 14066,  14092,  14117,  14143,  14168,  14193,  14218,  14243,  14268,  14293,  14317,  14341,  14366,  14390,  14414,  14438, 
+	 14461,  14485,  14508,  14531,  14555,  14578,  14601,  14623,  14646,  14668,  14691,  14713,  14735,  14757,  14779,  14800, 
+	 14822,  14843,  14864,  14885,  14906,  14927,  14948,  14968,  14989,  15009,  15029,  15049,  15069,  15088,  15108,  15127, 
+	 15146,  15166,  15184,  15203,  15222,  15240,  15259,  15277,  15295,  15313,  15331,  15349,  15366,  15383,  15401,  15418, 
+	 15435,  15451,  15468,  15485,  15501,  15517,  15533,  15549,  15565,  15581,  15596,  15611,  15627,  15642,  15656,  15671, 
+	 15686,  15700,  15715,  15729,  15743,  15757,  15770,  15784,  15797,  15810,  15824,  15837,  15849,  15862,  15875,  15887, 
+	 15899,  15911,  15923,  15935,  15946,  15958,  15969,  15980,  15991,  16002,  16013,  16024,  16034,  16044,  16054,  16064, 
+	 16074,  16084,  16093,  16103,  16112,  16121,  16130,  16138,  16147,  16156,  16164,  16172,  16180,  16188,  16195,  16203, 
+	 16210,  16218,  16225,  16232,  16238,  16245,  16251,  16258,  16264,  16270,  16276,  16281,  16287,  16292,  16298,  16303, 
+	 16308,  16312,  16317,  16321,  16326,  16330,  16334,  16338,  16341,  16345,  16348,  16352,  16355,  16358,  16360,  16363, 
+	 16365,  16368,  16370,  16372,  16374,  16375,  16377,  16378,  16380,  16381,  16382,  16382,  16383,  16384,  16384,  16384, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 13)
+	    13,     38,     63,     88,    113,    138,    163,    188,    214,    239,    264,    289,    314,    339,    364,    390, 
+	   415,    440,    465,    490,    515,    540,    565,    590,    616,    641,    666,    691,    716,    741,    766,    791, 
+	   816,    842,    867,    892,    917,    942,    967,    992,   1017,   1042,   1067,   1092,   1118,   1143,   1168,   1193, 
+	  1218,   1243,   1268,   1293,   1318,   1343,   1368,   1393,   1418,   1443,   1468,   1493,   1518,   1543,   1568,   1593, 
+	  1618,   1643,   1668,   1693,   1718,   1743,   1768,   1793,   1818,   1843,   1868,   1893,   1918,   1943,   1968,   1993, 
+	  2018,   2043,   2068,   2093,   2118,   2143,   2168,   2193,   2217,   2242,   2267,   2292,   2317,   2342,   2367,   2392, 
+	  2416,   2441,   2466,   2491,   2516,   2541,   2566,   2590,   2615,   2640,   2665,   2690,   2714,   2739,   2764,   2789, 
+	  2813,   2838,   2863,   2888,   2912,   2937,   2962,   2987,   3011,   3036,   3061,   3085,   3110,   3135,   3159,   3184, 
+	  3209,   3233,   3258,   3283,   3307,   3332,   3356,   3381,   3406,   3430,   3455,   3479,   3504,   3528,   3553,   3577, 
+	  3602,   3627,   3651,   3676,   3700,   3724,   3749,   3773,   3798,   3822,   3847,   3871,   3896,   3920,   3944,   3969, 
+	  3993,   4018,   4042,   4066,   4091,   4115,   4139,   4164,   4188,   4212,   4236,   4261,   4285,   4309,   4333,   4358, 
+	  4382,   4406,   4430,   4455,   4479,   4503,   4527,   4551,   4575,   4599,   4624,   4648,   4672,   4696,   4720,   4744, 
+	  4768,   4792,   4816,   4840,   4864,   4888,   4912,   4936,   4960,   4984,   5008,   5032,   5056,   5080,   5104,   5127, 
+	  5151,   5175,   5199,   5223,   5247,   5270,   5294,   5318,   5342,   5366,   5389,   5413,   5437,   5460,   5484,   5508, 
+	  5531,   5555,   5579,   5602,   5626,   5650,   5673,   5697,   5720,   5744,   5767,   5791,   5814,   5838,   5861,   5885, 
+	  5908,   5932,   5955,   5979,   6002,   6025,   6049,   6072,   6095,   6119,   6142,   6165,   6189,   6212,   6235,   6258, 
+	  6281,   6305,   6328,   6351,   6374,   6397,   6420,   6444,   6467,   6490,   6513,   6536,   6559,   6582,   6605,   6628, 
+	  6651,   6674,   6697,   6720,   6743,   6766,   6788,   6811,   6834,   6857,   6880,   6903,   6925,   6948,   6971,   6994, 
+	  7016,   7039,   7062,   7084,   7107,   7130,   7152,   7175,   7198,   7220,   7243,   7265,   7288,   7310,   7333,   7355, 
+	  7378,   7400,   7423,   7445,   7467,   7490,   7512,   7534,   7557,   7579,   7601,   7623,   7646,   7668,   7690,   7712, 
+	  7734,   7757,   7779,   7801,   7823,   7845,   7867,   7889,   7911,   7933,   7955,   7977,   7999,   8021,   8043,   8065, 
+	  8087,   8108,   8130,   8152,   8174,   8196,   8217,   8239,   8261,   8283,   8304,   8326,   8347,   8369,   8391,   8412, 
+	  8434,   8455,   8477,   8498,   8520,   8541,   8563,   8584,   8606,   8627,   8648,   8670,   8691,   8712,   8734,   8755, 
+	  8776,   8797,   8818,   8840,   8861,   8882,   8903,   8924,   8945,   8966,   8987,   9008,   9029,   9050,   9071,   9092, 
+	  9113,   9134,   9155,   9175,   9196,   9217,   9238,   9259,   9279,   9300,   9321,   9341,   9362,   9383,   9403,   9424, 
+	  9444,   9465,   9485,   9506,   9526,   9547,   9567,   9588,   9608,   9628,   9649,   9669,   9689,   9709,   9730,   9750, 
+	  9770,   9790,   9810,   9830,   9851,   9871,   9891,   9911,   9931,   9951,   9971,   9991,  10010,  10030,  10050,  10070, 
+	 10090,  10110,  10129,  10149,  10169,  10189,  10208,  10228,  10248,  10267,  10287,  10306,  10326,  10345,  10365,  10384, 
+	 10404,  10423,  10442,  10462,  10481,  10500,  10520,  10539,  10558,  10577,  10597,  10616,  10635,  10654,  10673,  10692, 
+	 10711,  10730,  10749,  10768,  10787,  10806,  10825,  10844,  10862,  10881,  10900,  10919,  10937,  10956,  10975,  10994, 
+	 11012,  11031,  11049,  11068,  11086,  11105,  11123,  11142,  11160,  11179,  11197,  11215,  11234,  11252,  11270,  11288, 
+	 11307,  11325,  11343,  11361,  11379,  11397,  11415,  11433,  11451,  11469,  11487,  11505,  11523,  11541,  11559,  11576, 
+	 11594,  11612,  11630,  11647,  11665,  11683,  11700,  11718,  11735,  11753,  11770,  11788,  11805,  11823,  11840,  11857, 
+	 11875,  11892,  11909,  11927,  11944,  11961,  11978,  11995,  12012,  12029,  12046,  12064,  12080,  12097,  12114,  12131, 
+	 12148,  12165,  12182,  12199,  12215,  12232,  12249,  12266,  12282,  12299,  12315,  12332,  12348,  12365,  12381,  12398, 
+	 12414,  12431,  12447,  12463,  12480,  12496,  12512,  12528,  12545,  12561,  12577,  12593,  12609,  12625,  12641,  12657, 
+	 12673,  12689,  12705,  12721,  12736,  12752,  12768,  12784,  12799,  12815,  12831,  12846,  12862,  12878,  12893,  12909, 
+	 12924,  12939,  12955,  12970,  12986,  13001,  13016,  13031,  13047,  13062,  13077,  13092,  13107,  13122,  13137,  13152, 
+	 13167,  13182,  13197,  13212,  13227,  13242,  13256,  13271,  13286,  13301,  13315,  13330,  13344,  13359,  13374,  13388, 
+	 13403,  13417,  13431,  13446,  13460,  13474,  13489,  13503,  13517,  13531,  13546,  13560,  13574,  13588,  13602,  13616, 
+	 13630,  13644,  13658,  13671,  13685,  13699,  13713,  13727,  13740,  13754,  13768,  13781,  13795,  13808,  13822,  13835, 
+	 13849,  13862,  13876,  13889,  13902,  13916,  13929,  13942,  13955,  13968,  13981,  13995,  14008,  14021,  14034,  14047, 
+	 14059,  14072,  14085,  14098,  14111,  14124,  14136,  14149,  14162,  14174,  14187,  14199,  14212,  14224,  14237,  14249, 
+	 14262,  14274,  14286,  14299,  14311,  14323,  14335,  14347,  14360,  14372,  14384,  14396,  14408,  14420,  14432,  14443, 
+	 14455,  14467,  14479,  14491,  14502,  14514,  14526,  14537,  14549,  14560,  14572,  14583,  14595,  14606,  14618,  14629, 
+	 14640,  14651,  14663,  14674,  14685,  14696,  14707,  14718,  14729,  14740,  14751,  14762,  14773,  14784,  14795,  14806, 
+	 14816,  14827,  14838,  14848,  14859,  14870,  14880,  14891,  14901,  14911,  14922,  14932,  14943,  14953,  14963,  14973, 
+	 14984,  14994,  15004,  15014,  15024,  15034,  15044,  15054,  15064,  15074,  15083,  15093,  15103,  15113,  15122,  15132, 
+	 15142,  15151,  15161,  15170,  15180,  15189,  15199,  15208,  15217,  15227,  15236,  15245,  15254,  15263,  15273,  15282, 
+	 15291,  15300,  15309,  15318,  15326,  15335,  15344,  15353,  15362,  15370,  15379,  15388,  15396,  15405,  15414,  15422, 
+	 15430,  15439,  15447,  15456,  15464,  15472,  15481,  15489,  15497,  15505,  15513,  15521,  15529,  15537,  15545,  15553, 
+	 15561,  15569,  15577,  15584,  15592,  15600,  15608,  15615,  15623,  15630,  15638,  15645,  15653,  15660,  15668,  15675, 
+	 15682,  15689,  15697,  15704,  15711,  15718,  15725,  15732,  15739,  15746,  15753,  15760,  15767,  15774,  15780,  15787, 
+	 15794,  15801,  15807,  15814,  15820,  15827,  15833,  15840,  15846,  15853,  15859,  15865,  15871,  15878,  15884,  15890, 
+	 15896,  15902,  15908,  15914,  15920,  15926,  15932,  15938,  15944,  15949,  15955,  15961,  15966,  15972,  15978,  15983, 
+	 15989,  15994,  16000,  16005,  16010,  16016,  16021,  16026,  16031,  16037,  16042,  16047,  16052,  16057,  16062,  16067, 
+	 16072,  16076,  16081,  16086,  16091,  16096,  16100,  16105,  16109,  16114,  16119,  16123,  16128,  16132,  16136,  16141, 
+	 16145,  16149,  16153,  16158,  16162,  16166,  16170,  16174,  16178,  16182,  16186,  16190,  16194,  16197,  16201,  16205, 
+	 16209,  16212,  16216,  16219,  16223,  16226,  16230,  16233,  16237,  16240,  16243,  16247,  16250,  16253,  16256,  16259, 
+	 16262,  16265,  16268,  16271,  16274,  16277,  16280,  16283,  16286,  16288,  16291,  16294,  16296,  16299,  16301,  16304, 
+	 16306,  16309,  16311,  16313,  16316,  16318,  16320,  16323,  16325,  16327,  16329,  16331,  16333,  16335,  16337,  16339, 
+	 16341,  16342,  16344,  16346,  16348,  16349,  16351,  16352,  16354,  16355,  16357,  16358,  16360,  16361,  16362,  16364, 
+	 16365,  16366,  16367,  16368,  16369,  16370,  16371,  16372,  16373,  16374,  16375,  16376,  16377,  16377,  16378,  16379, 
+	 16379,  16380,  16380,  16381,  16381,  16382,  16382,  16383,  16383,  16383,  16383,  16384,  16384,  16384,  16384,  16384, 
+#endif
+#if (XS3_MATH_FFT_MAX_LOG2 >= 14)
+	     6,     19,     31,     44,     57,     69,     82,     94,    107,    119,    132,    145,    157,    170,    182,    195, 
+	   207,    220,    232,    245,    258,    270,    283,    295,    308,    320,    333,    346,    358,    371,    383,    396, 
+	   408,    421,    433,    446,    459,    471,    484,    496,    509,    521,    534,    547,    559,    572,    584,    597, 
+	   609,    622,    634,    647,    660,    672,    685,    697,    710,    722,    735,    747,    760,    773,    785,    798, 
+	   810,    823,    835,    848,    860,    873,    885,    898,    911,    923,    936,    948,    961,    973,    986,    998, 
+	  1011,   1023,   1036,   1049,   1061,   1074,   1086,   1099,   1111,   1124,   1136,   1149,   1161,   1174,   1186,   1199, 
+	  1212,   1224,   1237,   1249,   1262,   1274,   1287,   1299,   1312,   1324,   1337,   1349,   1362,   1374,   1387,   1399, 
+	  1412,   1424,   1437,   1450,   1462,   1475,   1487,   1500,   1512,   1525,   1537,   1550,   1562,   1575,   1587,   1600, 
+	  1612,   1625,   1637,   1650,   1662,   1675,   1687,   1700,   1712,   1725,   1737,   1750,   1762,   1775,   1787,   1800, 
+	  1812,   1825,   1837,   1850,   1862,   1875,   1887,   1900,   1912,   1924,   1937,   1949,   1962,   1974,   1987,   1999, 
+	  2012,   2024,   2037,   2049,   2062,   2074,   2087,   2099,   2112,   2124,   2136,   2149,   2161,   2174,   2186,   2199, 
+	  2211,   2224,   2236,   2249,   2261,   2273,   2286,   2298,   2311,   2323,   2336,   2348,   2361,   2373,   2385,   2398, 
+	  2410,   2423,   2435,   2448,   2460,   2472,   2485,   2497,   2510,   2522,   2534,   2547,   2559,   2572,   2584,   2597, 
+	  2609,   2621,   2634,   2646,   2659,   2671,   2683,   2696,   2708,   2721,   2733,   2745,   2758,   2770,   2782,   2795, 
+	  2807,   2820,   2832,   2844,   2857,   2869,   2881,   2894,   2906,   2919,   2931,   2943,   2956,   2968,   2980,   2993, 
+	  3005,   3017,   3030,   3042,   3055,   3067,   3079,   3092,   3104,   3116,   3129,   3141,   3153,   3166,   3178,   3190, 
+	  3203,   3215,   3227,   3239,   3252,   3264,   3276,   3289,   3301,   3313,   3326,   3338,   3350,   3363,   3375,   3387, 
+	  3399,   3412,   3424,   3436,   3449,   3461,   3473,   3485,   3498,   3510,   3522,   3535,   3547,   3559,   3571,   3584, 
+	  3596,   3608,   3620,   3633,   3645,   3657,   3669,   3682,   3694,   3706,   3718,   3731,   3743,   3755,   3767,   3780, 
+	  3792,   3804,   3816,   3828,   3841,   3853,   3865,   3877,   3889,   3902,   3914,   3926,   3938,   3951,   3963,   3975, 
+	  3987,   3999,   4011,   4024,   4036,   4048,   4060,   4072,   4085,   4097,   4109,   4121,   4133,   4145,   4157,   4170, 
+	  4182,   4194,   4206,   4218,   4230,   4243,   4255,   4267,   4279,   4291,   4303,   4315,   4327,   4340,   4352,   4364, 
+	  4376,   4388,   4400,   4412,   4424,   4436,   4448,   4461,   4473,   4485,   4497,   4509,   4521,   4533,   4545,   4557, 
+	  4569,   4581,   4593,   4605,   4618,   4630,   4642,   4654,   4666,   4678,   4690,   4702,   4714,   4726,   4738,   4750, 
+	  4762,   4774,   4786,   4798,   4810,   4822,   4834,   4846,   4858,   4870,   4882,   4894,   4906,   4918,   4930,   4942, 
+	  4954,   4966,   4978,   4990,   5002,   5014,   5026,   5038,   5050,   5062,   5074,   5086,   5098,   5110,   5121,   5133, 
+	  5145,   5157,   5169,   5181,   5193,   5205,   5217,   5229,   5241,   5253,   5264,   5276,   5288,   5300,   5312,   5324, 
+	  5336,   5348,   5360,   5371,   5383,   5395,   5407,   5419,   5431,   5443,   5454,   5466,   5478,   5490,   5502,   5514, 
+	  5526,   5537,   5549,   5561,   5573,   5585,   5596,   5608,   5620,   5632,   5644,   5655,   5667,   5679,   5691,   5703, 
+	  5714,   5726,   5738,   5750,   5761,   5773,   5785,   5797,   5808,   5820,   5832,   5844,   5855,   5867,   5879,   5891, 
+	  5902,   5914,   5926,   5938,   5949,   5961,   5973,   5984,   5996,   6008,   6019,   6031,   6043,   6054,   6066,   6078, 
+	  6089,   6101,   6113,   6124,   6136,   6148,   6159,   6171,   6183,   6194,   6206,   6218,   6229,   6241,   6252,   6264, 
+	  6276,   6287,   6299,   6310,   6322,   6334,   6345,   6357,   6368,   6380,   6392,   6403,   6415,   6426,   6438,   6449, 
+	  6461,   6472,   6484,   6496,   6507,   6519,   6530,   6542,   6553,   6565,   6576,   6588,   6599,   6611,   6622,   6634, 
+	  6645,   6657,   6668,   6680,   6691,   6703,   6714,   6726,   6737,   6748,   6760,   6771,   6783,   6794,   6806,   6817, 
+	  6828,   6840,   6851,   6863,   6874,   6886,   6897,   6908,   6920,   6931,   6943,   6954,   6965,   6977,   6988,   6999, 
+	  7011,   7022,   7033,   7045,   7056,   7067,   7079,   7090,   7101,   7113,   7124,   7135,   7147,   7158,   7169,   7181, 
+	  7192,   7203,   7215,   7226,   7237,   7248,   7260,   7271,   7282,   7293,   7305,   7316,   7327,   7338,   7350,   7361, 
+	  7372,   7383,   7394,   7406,   7417,   7428,   7439,   7450,   7462,   7473,   7484,   7495,   7506,   7518,   7529,   7540, 
+	  7551,   7562,   7573,   7584,   7596,   7607,   7618,   7629,   7640,   7651,   7662,   7673,   7685,   7696,   7707,   7718, 
+	  7729,   7740,   7751,   7762,   7773,   7784,   7795,   7806,   7817,   7828,   7839,   7851,   7862,   7873,   7884,   7895, 
+	  7906,   7917,   7928,   7939,   7950,   7961,   7972,   7983,   7994,   8004,   8015,   8026,   8037,   8048,   8059,   8070, 
+	  8081,   8092,   8103,   8114,   8125,   8136,   8147,   8158,   8168,   8179,   8190,   8201,   8212,   8223,   8234,   8245, 
+	  8255,   8266,   8277,   8288,   8299,   8310,   8320,   8331,   8342,   8353,   8364,   8375,   8385,   8396,   8407,   8418, 
+	  8428,   8439,   8450,   8461,   8472,   8482,   8493,   8504,   8514,   8525,   8536,   8547,   8557,   8568,   8579,   8590, 
+	  8600,   8611,   8622,   8632,   8643,   8654,   8664,   8675,   8686,   8696,   8707,   8718,   8728,   8739,   8749,   8760, 
+	  8771,   8781,   8792,   8803,   8813,   8824,   8834,   8845,   8855,   8866,   8877,   8887,   8898,   8908,   8919,   8929, 
+	  8940,   8950,   8961,   8971,   8982,   8992,   9003,   9013,   9024,   9034,   9045,   9055,   9066,   9076,   9087,   9097, 
+	  9108,   9118,   9129,   9139,   9149,   9160,   9170,   9181,   9191,   9201,   9212,   9222,   9233,   9243,   9253,   9264, 
+	  9274,   9284,   9295,   9305,   9316,   9326,   9336,   9347,   9357,   9367,   9377,   9388,   9398,   9408,   9419,   9429, 
+	  9439,   9449,   9460,   9470,   9480,   9490,   9501,   9511,   9521,   9531,   9542,   9552,   9562,   9572,   9582,   9593, 
+	  9603,   9613,   9623,   9633,   9643,   9654,   9664,   9674,   9684,   9694,   9704,   9714,   9725,   9735,   9745,   9755, 
+	  9765,   9775,   9785,   9795,   9805,   9815,   9825,   9835,   9846,   9856,   9866,   9876,   9886,   9896,   9906,   9916, 
+	  9926,   9936,   9946,   9956,   9966,   9976,   9986,   9996,  10005,  10015,  10025,  10035,  10045,  10055,  10065,  10075, 
+	 10085,  10095,  10105,  10115,  10124,  10134,  10144,  10154,  10164,  10174,  10184,  10193,  10203,  10213,  10223,  10233, 
+	 10243,  10252,  10262,  10272,  10282,  10292,  10301,  10311,  10321,  10331,  10340,  10350,  10360,  10370,  10379,  10389, 
+	 10399,  10408,  10418,  10428,  10438,  10447,  10457,  10467,  10476,  10486,  10496,  10505,  10515,  10524,  10534,  10544, 
+	 10553,  10563,  10573,  10582,  10592,  10601,  10611,  10620,  10630,  10640,  10649,  10659,  10668,  10678,  10687,  10697, 
+	 10706,  10716,  10725,  10735,  10744,  10754,  10763,  10773,  10782,  10792,  10801,  10811,  10820,  10829,  10839,  10848, 
+	 10858,  10867,  10877,  10886,  10895,  10905,  10914,  10923,  10933,  10942,  10952,  10961,  10970,  10980,  10989,  10998, 
+	 11007,  11017,  11026,  11035,  11045,  11054,  11063,  11072,  11082,  11091,  11100,  11109,  11119,  11128,  11137,  11146, 
+	 11156,  11165,  11174,  11183,  11192,  11202,  11211,  11220,  11229,  11238,  11247,  11256,  11266,  11275,  11284,  11293, 
+	 11302,  11311,  11320,  11329,  11338,  11347,  11356,  11366,  11375,  11384,  11393,  11402,  11411,  11420,  11429,  11438, 
+	 11447,  11456,  11465,  11474,  11483,  11492,  11501,  11509,  11518,  11527,  11536,  11545,  11554,  11563,  11572,  11581, 
+	 11590,  11599,  11607,  11616,  11625,  11634,  11643,  11652,  11661,  11669,  11678,  11687,  11696,  11705,  11713,  11722, 
+	 11731,  11740,  11748,  11757,  11766,  11775,  11783,  11792,  11801,  11810,  11818,  11827,  11836,  11844,  11853,  11862, 
+	 11870,  11879,  11888,  11896,  11905,  11914,  11922,  11931,  11939,  11948,  11957,  11965,  11974,  11982,  11991,  12000, 
+	 12008,  12017,  12025,  12034,  12042,  12051,  12059,  12068,  12076,  12085,  12093,  12102,  12110,  12119,  12127,  12136, 
+	 12144,  12152,  12161,  12169,  12178,  12186,  12194,  12203,  12211,  12220,  12228,  12236,  12245,  12253,  12261,  12270, 
+	 12278,  12286,  12295,  12303,  12311,  12320,  12328,  12336,  12344,  12353,  12361,  12369,  12377,  12386,  12394,  12402, 
+	 12410,  12418,  12427,  12435,  12443,  12451,  12459,  12467,  12476,  12484,  12492,  12500,  12508,  12516,  12524,  12532, 
+	 12541,  12549,  12557,  12565,  12573,  12581,  12589,  12597,  12605,  12613,  12621,  12629,  12637,  12645,  12653,  12661, 
+	 12669,  12677,  12685,  12693,  12701,  12709,  12717,  12725,  12732,  12740,  12748,  12756,  12764,  12772,  12780,  12788, 
+	 12796,  12803,  12811,  12819,  12827,  12835,  12842,  12850,  12858,  12866,  12874,  12881,  12889,  12897,  12905,  12912, 
+	 12920,  12928,  12936,  12943,  12951,  12959,  12966,  12974,  12982,  12989,  12997,  13005,  13012,  13020,  13028,  13035, 
+	 13043,  13050,  13058,  13066,  13073,  13081,  13088,  13096,  13103,  13111,  13118,  13126,  13134,  13141,  13149,  13156, 
+	 13163,  13171,  13178,  13186,  13193,  13201,  13208,  13216,  13223,  13231,  13238,  13245,  13253,  13260,  13267,  13275, 
+	 13282,  13290,  13297,  13304,  13312,  13319,  13326,  13334,  13341,  13348,  13355,  13363,  13370,  13377,  13384,  13392, 
+	 13399,  13406,  13413,  13421,  13428,  13435,  13442,  13449,  13457,  13464,  13471,  13478,  13485,  13492,  13499,  13507, 
+	 13514,  13521,  13528,  13535,  13542,  13549,  13556,  13563,  13570,  13577,  13584,  13591,  13598,  13605,  13612,  13619, 
+	 13626,  13633,  13640,  13647,  13654,  13661,  13668,  13675,  13682,  13689,  13696,  13703,  13709,  13716,  13723,  13730, 
+	 13737,  13744,  13751,  13757,  13764,  13771,  13778,  13785,  13791,  13798,  13805,  13812,  13819,  13825,  13832,  13839, 
+	 13845,  13852,  13859,  13866,  13872,  13879,  13886,  13892,  13899,  13906,  13912,  13919,  13925,  13932,  13939,  13945, 
+	 13952,  13958,  13965,  13972,  13978,  13985,  13991,  13998,  14004,  14011,  14017,  14024,  14030,  14037,  14043,  14050, 
+	 14056,  14063,  14069,  14076,  14082,  14088,  14095,  14101,  14108,  14114,  14120,  14127,  14133,  14139,  14146,  14152, 
+	 14158,  14165,  14171,  14177,  14184,  14190,  14196,  14203,  14209,  14215,  14221,  14228,  14234,  14240,  14246,  14252, 
+	 14259,  14265,  14271,  14277,  14283,  14289,  14296,  14302,  14308,  14314,  14320,  14326,  14332,  14338,  14344,  14351, 
+	 14357,  14363,  14369,  14375,  14381,  14387,  14393,  14399,  14405,  14411,  14417,  14423,  14429,  14435,  14441,  14446, 
+	 14452,  14458,  14464,  14470,  14476,  14482,  14488,  14494,  14499,  14505,  14511,  14517,  14523,  14529,  14534,  14540, 
+	 14546,  14552,  14558,  14563,  14569,  14575,  14581,  14586,  14592,  14598,  14603,  14609,  14615,  14620,  14626,  14632, 
+	 14637,  14643,  14649,  14654,  14660,  14666,  14671,  14677,  14682,  14688,  14693,  14699,  14705,  14710,  14716,  14721, 
+	 14727,  14732,  14738,  14743,  14749,  14754,  14760,  14765,  14770,  14776,  14781,  14787,  14792,  14798,  14803,  14808, 
+	 14814,  14819,  14824,  14830,  14835,  14840,  14846,  14851,  14856,  14862,  14867,  14872,  14877,  14883,  14888,  14893, 
+	 14898,  14904,  14909,  14914,  14919,  14924,  14930,  14935,  14940,  14945,  14950,  14955,  14961,  14966,  14971,  14976, 
+	 14981,  14986,  14991,  14996,  15001,  15006,  15011,  15016,  15021,  15026,  15031,  15036,  15041,  15046,  15051,  15056, 
+	 15061,  15066,  15071,  15076,  15081,  15086,  15091,  15096,  15101,  15105,  15110,  15115,  15120,  15125,  15130,  15134, 
+	 15139,  15144,  15149,  15154,  15158,  15163,  15168,  15173,  15177,  15182,  15187,  15192,  15196,  15201,  15206,  15210, 
+	 15215,  15220,  15224,  15229,  15234,  15238,  15243,  15247,  15252,  15257,  15261,  15266,  15270,  15275,  15279,  15284, 
+	 15288,  15293,  15297,  15302,  15306,  15311,  15315,  15320,  15324,  15329,  15333,  15338,  15342,  15346,  15351,  15355, 
+	 15360,  15364,  15368,  15373,  15377,  15381,  15386,  15390,  15394,  15399,  15403,  15407,  15411,  15416,  15420,  15424, 
+	 15428,  15433,  15437,  15441,  15445,  15449,  15454,  15458,  15462,  15466,  15470,  15474,  15478,  15483,  15487,  15491, 
+	 15495,  15499,  15503,  15507,  15511,  15515,  15519,  15523,  15527,  15531,  15535,  15539,  15543,  15547,  15551,  15555, 
+	 15559,  15563,  15567,  15571,  15575,  15579,  15582,  15586,  15590,  15594,  15598,  15602,  15606,  15609,  15613,  15617, 
+	 15621,  15625,  15628,  15632,  15636,  15640,  15643,  15647,  15651,  15655,  15658,  15662,  15666,  15669,  15673,  15677, 
+	 15680,  15684,  15688,  15691,  15695,  15698,  15702,  15706,  15709,  15713,  15716,  15720,  15723,  15727,  15730,  15734, 
+	 15737,  15741,  15744,  15748,  15751,  15755,  15758,  15762,  15765,  15769,  15772,  15775,  15779,  15782,  15785,  15789, 
+	 15792,  15796,  15799,  15802,  15805,  15809,  15812,  15815,  15819,  15822,  15825,  15828,  15832,  15835,  15838,  15841, 
+	 15845,  15848,  15851,  15854,  15857,  15860,  15864,  15867,  15870,  15873,  15876,  15879,  15882,  15885,  15888,  15891, 
+	 15895,  15898,  15901,  15904,  15907,  15910,  15913,  15916,  15919,  15922,  15925,  15927,  15930,  15933,  15936,  15939, 
+	 15942,  15945,  15948,  15951,  15954,  15956,  15959,  15962,  15965,  15968,  15971,  15973,  15976,  15979,  15982,  15985, 
+	 15987,  15990,  15993,  15995,  15998,  16001,  16004,  16006,  16009,  16012,  16014,  16017,  16020,  16022,  16025,  16027, 
+	 16030,  16033,  16035,  16038,  16040,  16043,  16045,  16048,  16051,  16053,  16056,  16058,  16061,  16063,  16065,  16068, 
+	 16070,  16073,  16075,  16078,  16080,  16083,  16085,  16087,  16090,  16092,  16094,  16097,  16099,  16101,  16104,  16106, 
+	 16108,  16111,  16113,  16115,  16117,  16120,  16122,  16124,  16126,  16129,  16131,  16133,  16135,  16137,  16140,  16142, 
+	 16144,  16146,  16148,  16150,  16152,  16154,  16157,  16159,  16161,  16163,  16165,  16167,  16169,  16171,  16173,  16175, 
+	 16177,  16179,  16181,  16183,  16185,  16187,  16189,  16191,  16193,  16194,  16196,  16198,  16200,  16202,  16204,  16206, 
+	 16208,  16209,  16211,  16213,  16215,  16217,  16218,  16220,  16222,  16224,  16226,  16227,  16229,  16231,  16232,  16234, 
+	 16236,  16237,  16239,  16241,  16242,  16244,  16246,  16247,  16249,  16251,  16252,  16254,  16255,  16257,  16258,  16260, 
+	 16262,  16263,  16265,  16266,  16268,  16269,  16271,  16272,  16274,  16275,  16276,  16278,  16279,  16281,  16282,  16283, 
+	 16285,  16286,  16288,  16289,  16290,  16292,  16293,  16294,  16296,  16297,  16298,  16299,  16301,  16302,  16303,  16304, 
+	 16306,  16307,  16308,  16309,  16311,  16312,  16313,  16314,  16315,  16316,  16318,  16319,  16320,  16321,  16322,  16323, 
+	 16324,  16325,  16326,  16327,  16328,  16329,  16330,  16331,  16332,  16333,  16334,  16335,  16336,  16337,  16338,  16339, 
+	 16340,  16341,  16342,  16343,  16344,  16345,  16345,  16346,  16347,  16348,  16349,  16350,  16350,  16351,  16352,  16353, 
+	 16354,  16354,  16355,  16356,  16357,  16357,  16358,  16359,  16359,  16360,  16361,  16361,  16362,  16363,  16363,  16364, 
+	 16365,  16365,  16366,  16366,  16367,  16368,  16368,  16369,  16369,  16370,  16370,  16371,  16371,  16372,  16372,  16373, 
+	 16373,  16374,  16374,  16374,  16375,  16375,  16376,  16376,  16376,  16377,  16377,  16378,  16378,  16378,  16379,  16379, 
+	 16379,  16380,  16380,  16380,  16380,  16381,  16381,  16381,  16381,  16382,  16382,  16382,  16382,  16382,  16383,  16383, 
+	 16383,  16383,  16383,  16383,  16383,  16383,  16384,  16384,  16384,  16384,  16384,  16384,  16384,  16384,  16384,  16384, 
+#endif
+	};
+
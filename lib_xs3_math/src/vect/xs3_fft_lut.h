@@ -5,8 +5,23 @@
 #include "xs3_math.h"
 
 
+/** @brief Maximum FFT length (log2) for which twiddle factors have been generated. */
+#define XS3_FFT_LUT_GENERATED_LOG2 14
+
+#if (XS3_MATH_FFT_MAX_LOG2 > XS3_FFT_LUT_GENERATED_LOG2)
+# error XS3_MATH_FFT_MAX_LOG2 exceeds the FFT length for which the look-up tables were generated.
+#endif
+
+#if (XS3_MATH_FFT_LUT_MAX_LOG2 > XS3_MATH_FFT_MAX_LOG2) || (XS3_MATH_FFT_LUT_MAX_LOG2 < 4)
+# error XS3_MATH_FFT_LUT_MAX_LOG2 must be between 4 and XS3_MATH_FFT_MAX_LOG2.
+#endif
+
+
 /** @brief Maximum FFT length (log2) that can be performed using decimation-in-time. */
-#define MAX_DIT_FFT_LOG2 10
+#define MAX_DIT_FFT_LOG2 (XS3_MATH_FFT_MAX_LOG2)
+
+/** @brief Maximum FFT length (log2) with decimation-in-time twiddle factors in `xs3_dit_fft_lut[]`. */
+#define MAX_DIT_FFT_LUT_LOG2 (XS3_MATH_FFT_LUT_MAX_LOG2)
 
 /** @brief Convenience macro to index into the decimation-in-time FFT look-up table. 
 
@@ -19,7 +34,10 @@
 
 
 /** @brief Maximum FFT length (log2) that can be performed using decimation-in-frequency. */
-#define MAX_DIF_FFT_LOG2 10
+#define MAX_DIF_FFT_LOG2 (XS3_MATH_FFT_MAX_LOG2)
+
+/** @brief Maximum FFT length (log2) with decimation-in-frequency twiddle factors in `xs3_dif_fft_lut[]`. */
+#define MAX_DIF_FFT_LUT_LOG2 (XS3_MATH_FFT_LUT_MAX_LOG2)
 
 /** @brief Convenience macro to index into the decimation-in-frequency FFT look-up table. 
 
@@ -28,7 +46,43 @@
 
 	@param N	The FFT length.
 */
-#define XS3_DIF_FFT_LUT(N) &xs3_dif_fft_lut[(1<<(MAX_DIF_FFT_LOG2)) - (N)]
+#define XS3_DIF_FFT_LUT(N) &xs3_dif_fft_lut[(1<<(MAX_DIF_FFT_LUT_LOG2)) - (N)]
+
+extern const complex_s32_t xs3_dit_fft_lut[(1<<MAX_DIT_FFT_LUT_LOG2)-4];
+extern const complex_s32_t xs3_dif_fft_lut[(1<<MAX_DIF_FFT_LUT_LOG2)-4];
+
+/** @brief Principal roots of unity (@math{e^{-j2\pi/2^p}}, Q30) used to generate twiddle factors for FFT
+	stages which are not covered by the look-up tables. */
+#if (MAX_DIT_FFT_LUT_LOG2 < MAX_DIT_FFT_LOG2) && !(XS3_MATH_FFT_COMPACT_TWIDDLES)
+extern const complex_s32_t xs3_fft_twiddle_seed[15];
+#endif
+
+/** @brief Number of elements in the quarter-wave sine tables. */
+#define XS3_FFT_SINE_LUT_SIZE ((1<<(XS3_MATH_FFT_MAX_LOG2-2))+1)
+
+/** @brief Get the index of @math{sin(2\pi i/2^P)}, for @math{0 \le i \le 2^{P-2}}, within a quarter-wave sine
+	table (`xs3_fft_sine_lut[]` or `xs3_fft_sine_lut_s16[]`). See gen_fft_table.py for the table layout. */
+static inline unsigned xs3_fft_sine_lut_index(
+    unsigned i,
+    unsigned P)
+{
+    if(i == 0)
+        return 0;
+
+    // Reduce i/2^P to lowest terms. (i & -i) isolates the lowest set bit of i, so this costs a single cls rather
+    // than a loop over the trailing zeros.
+    const unsigned tz = 31 - CLS_S32(i & -i);
+    i >>= tz;
+    P -= tz;
+
+    return (P == 2)? 1 : (1 << (P-3)) + 1 + (i >> 1);
+}
+
+/** @brief Quarter-wave sine table (Q30) from which the twiddle factors of FFT stages not covered by the look-up
+	tables are computed when `XS3_MATH_FFT_COMPACT_TWIDDLES` is enabled. */
+#if (XS3_MATH_FFT_COMPACT_TWIDDLES)
+extern const int32_t xs3_fft_sine_lut[XS3_FFT_SINE_LUT_SIZE];
+#endif
 
-extern const complex_s32_t xs3_dit_fft_lut[1020]; // 8160 bytes
-extern const complex_s32_t xs3_dif_fft_lut[1020]; // 8160 bytes
+/** @brief Quarter-wave sine table (Q14) from which the twiddle factors of the 16-bit FFTs are computed. */
+extern const int16_t xs3_fft_sine_lut_s16[XS3_FFT_SINE_LUT_SIZE];
@@ -0,0 +1,519 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+
+/*
+    Mixed-radix FFTs.
+
+    These compute FFTs of any length N = 2^a * 3^b * 5^c using radix-4, radix-2, radix-3 and radix-5 stages (in that
+    order), in-place, using the decimation-in-time algorithm. The input is first put into digit-reversed order by
+    xs3_fft_index_digit_reversal().
+
+    The twiddle factors for arbitrary N cannot be taken from the (power-of-2) look-up tables, so they are computed as
+    required from a polynomial approximation of sine and cosine over one octant.
+
+    As with the power-of-2 FFTs, the headroom of the data is tracked stage-by-stage. Before each stage the data is
+    (logically) shifted so that the stage cannot saturate; right-shifts are applied with rounding when the inputs are
+    multiplied by the twiddle factors, left-shifts when the outputs are stored.
+
+    The inverse FFT includes the 1/N scale factor. The factor of 1/r of each radix-r stage is applied to the exponent
+    (as 2^-ceil(log2(r))) with the remaining gain of 2^ceil(log2(r))/r folded into the twiddle factors.
+*/
+
+// Twiddle factors and butterfly constants are Q30
+#define Q30_SHR             (30)
+#define Q30_ONE             (1<<Q30_SHR)
+
+// Enough for any length which can be indexed with an unsigned int
+#define MAX_STAGES          (32)
+
+// Largest supported FFT length. The mono adjustment computes twiddle factors for up to twice this length.
+#define MAX_MIXED_FFT_N     (1<<17)
+
+// pi/4 (Q46)
+#define PI_4_Q46            (55267482437722LL)
+
+// sin(2*pi/3) (Q30)
+#define RADIX3_SIN          (929887697)
+
+// cos(2*pi/5), cos(4*pi/5), sin(2*pi/5), sin(4*pi/5) (Q30)
+#define RADIX5_COS1         (331804471)
+#define RADIX5_COS2         (-868675383)
+#define RADIX5_SIN1         (1021189159)
+#define RADIX5_SIN2         (631129609)
+
+// Inverse FFT stage gains, 4/3 and 8/5 (Q30)
+#define RADIX3_INV_GAIN     (1431655765)
+#define RADIX5_INV_GAIN     (1717986918)
+
+
+typedef struct {
+    int64_t re;
+    int64_t im;
+} complex_s64_acc_t;
+
+
+/*
+    Get sin(phi) and cos(phi) (Q30) for phi = (pi/4) * (r/N), with 0 <= r <= N <= 2*MAX_MIXED_FFT_N.
+
+    Taylor series evaluated (Horner's method) in Q31. The error is within 1 LSB of the Q30 result.
+
+    r * (pi/4) in Q46 would overflow 64 bits for r above about 1.6e5, so the product is split into the Q31 part of the
+    constant and its remaining 15 bits, which gives the same (floored) quotient.
+*/
+static void fft_sin_cos(
+    int32_t* sin_phi,
+    int32_t* cos_phi,
+    const unsigned r,
+    const unsigned N)
+{
+    // 1/(n*(n-1)) (Q31) for n = 11, 9, 7, 5, 3 and n = 12, 10, 8, 6, 4, 2
+    static const int64_t sin_coef[] = { 19522579, 29826162, 51130563, 107374182, 357913941 };
+    static const int64_t cos_coef[] = { 16268816, 23860929, 38347922, 71582788, 178956971, 1073741824 };
+
+    const int64_t one = 1LL << 31;
+
+    const int64_t pi_hi = PI_4_Q46 >> 15;
+    const int64_t pi_lo = PI_4_Q46 & 0x7FFF;
+
+    const int64_t q_hi = (((int64_t) r) * pi_hi) / N;
+    const int64_t r_hi = (((int64_t) r) * pi_hi) % N;
+    const int64_t q_lo = ((r_hi << 15) + ((int64_t) r) * pi_lo) / N;
+
+    const int64_t phi = ((q_hi << 15) + q_lo + (1 << 14)) >> 15;
+    const int64_t phi2 = (phi * phi + (1 << 30)) >> 31;
+
+    int64_t s = one;
+    for(int i = 0; i < sizeof(sin_coef)/sizeof(sin_coef[0]); i++)
+        s = one - ((((phi2 * s) >> 31) * sin_coef[i]) >> 31);
+
+    int64_t c = one;
+    for(int i = 0; i < sizeof(cos_coef)/sizeof(cos_coef[0]); i++)
+        c = one - ((((phi2 * c) >> 31) * cos_coef[i]) >> 31);
+
+    s = (phi * s) >> 31;
+
+    *sin_phi = (int32_t) ROUND_SHR(s, 1);
+    *cos_phi = (int32_t) ROUND_SHR(c, 1);
+}
+
+
+// Get W_N^k = exp(-j*2*pi*k / N) (Q30), for 0 <= k < N.
+static complex_s32_t fft_twiddle_mixed(
+    const unsigned k,
+    const unsigned N)
+{
+    // The angle 2*pi*k/N lies in octant `o`, offset by (pi/4)*(r/N) from the octant's start
+    const unsigned o = (8*k) / N;
+    unsigned r = (8*k) - o*N;
+
+    // Odd octants are measured back from the end of the octant
+    if(o & 1)
+        r = N - r;
+
+    int32_t s, c;
+    fft_sin_cos(&s, &c, r, N);
+
+    if(o & 1){
+        int32_t tmp = s;
+        s = c;
+        c = tmp;
+    }
+
+    complex_s32_t W;
+
+    switch(o >> 1){
+        case 0:  W.re =  c;  W.im = -s;  break;
+        case 1:  W.re = -s;  W.im = -c;  break;
+        case 2:  W.re = -c;  W.im =  s;  break;
+        default: W.re =  s;  W.im =  c;  break;
+    }
+
+    return W;
+}
+
+
+// Get the radices of the stages of an N-point mixed-radix FFT. Returns the number of stages, or 0 if N is unsupported.
+static unsigned fft_mixed_radices(
+    unsigned radix[],
+    unsigned N)
+{
+    unsigned stages = 0;
+
+    if(N < 2)
+        return 0;
+
+    while(!(N % 4)){ radix[stages++] = 4; N /= 4; }
+    while(!(N % 2)){ radix[stages++] = 2; N /= 2; }
+    while(!(N % 3)){ radix[stages++] = 3; N /= 3; }
+    while(!(N % 5)){ radix[stages++] = 5; N /= 5; }
+
+    return (N == 1)? stages : 0;
+}
+
+
+unsigned xs3_fft_mixed_is_supported(
+    const unsigned N)
+{
+    unsigned radix[MAX_STAGES];
+
+    if(N > MAX_MIXED_FFT_N)
+        return 0;
+
+    return fft_mixed_radices(radix, N) != 0;
+}
+
+
+// Index of the input element which belongs at index p for the DIT FFT
+static unsigned fft_digit_reverse(
+    unsigned p,
+    unsigned N,
+    const unsigned radix[],
+    const unsigned stages)
+{
+    unsigned n = 0;
+    unsigned mult = 1;
+
+    for(int s = stages-1; s >= 0; s--){
+        N /= radix[s];
+        n += (p / N) * mult;
+        p = p % N;
+        mult *= radix[s];
+    }
+
+    return n;
+}
+
+
+void xs3_fft_index_digit_reversal(
+    complex_s32_t x[],
+    const unsigned N)
+{
+    unsigned radix[MAX_STAGES];
+    const unsigned stages = fft_mixed_radices(radix, N);
+
+    // Each cycle of the permutation is applied once, from its smallest element (its leader), so no record of the
+    // elements already moved is needed. Finding whether p0 leads its cycle means walking the cycle until a smaller
+    // element is reached, which for the supported lengths averages about as many steps as there are FFT stages.
+    for(unsigned p0 = 0; p0 < N; p0++){
+
+        unsigned c = fft_digit_reverse(p0, N, radix, stages);
+        while(c > p0)
+            c = fft_digit_reverse(c, N, radix, stages);
+
+        if(c < p0)
+            continue;
+
+        const complex_s32_t tmp = x[p0];
+        unsigned p = p0;
+
+        while(1){
+            const unsigned q = fft_digit_reverse(p, N, radix, stages);
+            if(q == p0)
+                break;
+            x[p] = x[q];
+            p = q;
+        }
+
+        x[p] = tmp;
+    }
+}
+
+
+// Round and shift a Q30 accumulator to a 32-bit output
+static int32_t fft_mixed_out(
+    const int64_t acc,
+    const left_shift_t shl)
+{
+    const int64_t res = ROUND_SHR(acc, Q30_SHR - shl);
+    return (int32_t) SAT32(res);
+}
+
+
+// Radix-r DFT on y[] (with the signs of the imaginary constants flipped if inverse). Outputs are Q30 accumulators.
+static void fft_mixed_butterfly(
+    complex_s64_acc_t acc[],
+    const complex_s64_acc_t y[],
+    const unsigned radix,
+    const unsigned inverse)
+{
+    // For the forward DFT, multiplying by -j (or +j for inverse): (re, im) -> (sgn*im, -sgn*re)
+    const int64_t sgn = inverse? -1 : 1;
+
+    switch(radix){
+        case 2:
+            acc[0].re = (y[0].re + y[1].re) << Q30_SHR;
+            acc[0].im = (y[0].im + y[1].im) << Q30_SHR;
+            acc[1].re = (y[0].re - y[1].re) << Q30_SHR;
+            acc[1].im = (y[0].im - y[1].im) << Q30_SHR;
+            break;
+
+        case 4: {
+            const int64_t a_re = y[0].re + y[2].re,  a_im = y[0].im + y[2].im;
+            const int64_t b_re = y[0].re - y[2].re,  b_im = y[0].im - y[2].im;
+            const int64_t c_re = y[1].re + y[3].re,  c_im = y[1].im + y[3].im;
+            const int64_t d_re = y[1].re - y[3].re,  d_im = y[1].im - y[3].im;
+
+            // X[1] = b - j*d,  X[3] = b + j*d  (forward)
+            acc[0].re = (a_re + c_re) << Q30_SHR;
+            acc[0].im = (a_im + c_im) << Q30_SHR;
+            acc[1].re = (b_re + sgn * d_im) << Q30_SHR;
+            acc[1].im = (b_im - sgn * d_re) << Q30_SHR;
+            acc[2].re = (a_re - c_re) << Q30_SHR;
+            acc[2].im = (a_im - c_im) << Q30_SHR;
+            acc[3].re = (b_re - sgn * d_im) << Q30_SHR;
+            acc[3].im = (b_im + sgn * d_re) << Q30_SHR;
+            break;
+        }
+
+        case 3: {
+            const int64_t t1_re = y[1].re + y[2].re,  t1_im = y[1].im + y[2].im;
+            const int64_t t2_re = (y[0].re << Q30_SHR) - (t1_re << (Q30_SHR-1));
+            const int64_t t2_im = (y[0].im << Q30_SHR) - (t1_im << (Q30_SHR-1));
+            const int64_t t3_re = (y[1].re - y[2].re) * RADIX3_SIN;
+            const int64_t t3_im = (y[1].im - y[2].im) * RADIX3_SIN;
+
+            // X[1] = t2 - j*t3,  X[2] = t2 + j*t3  (forward)
+            acc[0].re = (y[0].re + t1_re) << Q30_SHR;
+            acc[0].im = (y[0].im + t1_im) << Q30_SHR;
+            acc[1].re = t2_re + sgn * t3_im;
+            acc[1].im = t2_im - sgn * t3_re;
+            acc[2].re = t2_re - sgn * t3_im;
+            acc[2].im = t2_im + sgn * t3_re;
+            break;
+        }
+
+        default: {
+            const int64_t a1_re = y[1].re + y[4].re,  a1_im = y[1].im + y[4].im;
+            const int64_t a2_re = y[2].re + y[3].re,  a2_im = y[2].im + y[3].im;
+            const int64_t b1_re = y[1].re - y[4].re,  b1_im = y[1].im - y[4].im;
+            const int64_t b2_re = y[2].re - y[3].re,  b2_im = y[2].im - y[3].im;
+
+            const int64_t y0_re = y[0].re << Q30_SHR;
+            const int64_t y0_im = y[0].im << Q30_SHR;
+
+            const int64_t e1_re = y0_re + RADIX5_COS1 * a1_re + RADIX5_COS2 * a2_re;
+            const int64_t e1_im = y0_im + RADIX5_COS1 * a1_im + RADIX5_COS2 * a2_im;
+            const int64_t e2_re = y0_re + RADIX5_COS2 * a1_re + RADIX5_COS1 * a2_re;
+            const int64_t e2_im = y0_im + RADIX5_COS2 * a1_im + RADIX5_COS1 * a2_im;
+
+            const int64_t o1_re = RADIX5_SIN1 * b1_re + RADIX5_SIN2 * b2_re;
+            const int64_t o1_im = RADIX5_SIN1 * b1_im + RADIX5_SIN2 * b2_im;
+            const int64_t o2_re = RADIX5_SIN2 * b1_re - RADIX5_SIN1 * b2_re;
+            const int64_t o2_im = RADIX5_SIN2 * b1_im - RADIX5_SIN1 * b2_im;
+
+            // X[1] = e1 - j*o1,  X[4] = e1 + j*o1,  X[2] = e2 - j*o2,  X[3] = e2 + j*o2  (forward)
+            acc[0].re = (y[0].re + a1_re + a2_re) << Q30_SHR;
+            acc[0].im = (y[0].im + a1_im + a2_im) << Q30_SHR;
+            acc[1].re = e1_re + sgn * o1_im;
+            acc[1].im = e1_im - sgn * o1_re;
+            acc[4].re = e1_re - sgn * o1_im;
+            acc[4].im = e1_im + sgn * o1_re;
+            acc[2].re = e2_re + sgn * o2_im;
+            acc[2].im = e2_im - sgn * o2_re;
+            acc[3].re = e2_re - sgn * o2_im;
+            acc[3].im = e2_im + sgn * o2_re;
+            break;
+        }
+    }
+}
+
+
+/*
+    Headroom required at the input of a radix-r stage so that it cannot saturate. Each output component is bounded by
+    gain * (1 + (r-1)*sqrt(2)) times the largest input component.
+*/
+static headroom_t fft_mixed_stage_headroom(
+    const unsigned radix,
+    const unsigned inverse)
+{
+    switch(radix){
+        case 2:  return 2;
+        case 3:  return inverse? 3 : 2;
+        case 4:  return 3;
+        default: return inverse? 4 : 3;
+    }
+}
+
+
+// log2 of the power of 2 applied to the exponent by an inverse radix-r stage
+static exponent_t fft_mixed_stage_inverse_exp(
+    const unsigned radix)
+{
+    switch(radix){
+        case 2:  return 1;
+        case 3:  return 2;
+        case 4:  return 2;
+        default: return 3;
+    }
+}
+
+
+static void fft_mixed(
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp,
+    const unsigned inverse)
+{
+    unsigned radix[MAX_STAGES];
+    const unsigned stages = fft_mixed_radices(radix, N);
+
+    headroom_t cur_hr = *hr;
+    exponent_t exp_modifier = 0;
+
+    unsigned L = 1;
+
+    for(unsigned s = 0; s < stages; s++){
+
+        const unsigned r = radix[s];
+        const unsigned L_prev = L;
+        L = L * r;
+
+        const right_shift_t shr = fft_mixed_stage_headroom(r, inverse) - cur_hr;
+        const right_shift_t in_shr = MAX(shr, 0);
+        const left_shift_t out_shl = MAX(-shr, 0);
+
+        exp_modifier += shr;
+
+        // Inverse stage gain (Q30)
+        int64_t gain = Q30_ONE;
+        if(inverse){
+            exp_modifier -= fft_mixed_stage_inverse_exp(r);
+            if(r == 3) gain = RADIX3_INV_GAIN;
+            if(r == 5) gain = RADIX5_INV_GAIN;
+        }
+
+        unsigned hr_mask = 0;
+
+        for(unsigned k = 0; k < L_prev; k++){
+
+            // Twiddle factors W_L^(j*k), scaled by the stage gain
+            complex_s32_t W[5];
+            for(unsigned j = 0; j < r; j++){
+                const complex_s32_t tw = fft_twiddle_mixed(j*k, L);
+                W[j].re = (int32_t) ROUND_SHR(tw.re * gain, Q30_SHR);
+                W[j].im = (int32_t) ROUND_SHR(tw.im * gain, Q30_SHR);
+                if(inverse) W[j].im = -W[j].im;
+            }
+
+            for(unsigned base = 0; base < N; base += L){
+
+                complex_s64_acc_t y[5], acc[5];
+
+                for(unsigned j = 0; j < r; j++){
+                    const complex_s32_t v = x[base + k + j*L_prev];
+                    const int64_t re = ((int64_t) v.re) * W[j].re - ((int64_t) v.im) * W[j].im;
+                    const int64_t im = ((int64_t) v.re) * W[j].im + ((int64_t) v.im) * W[j].re;
+                    y[j].re = ROUND_SHR(re, Q30_SHR + in_shr);
+                    y[j].im = ROUND_SHR(im, Q30_SHR + in_shr);
+                }
+
+                fft_mixed_butterfly(acc, y, r, inverse);
+
+                for(unsigned j = 0; j < r; j++){
+                    complex_s32_t* dst = &x[base + k + j*L_prev];
+                    dst->re = fft_mixed_out(acc[j].re, out_shl);
+                    dst->im = fft_mixed_out(acc[j].im, out_shl);
+                    hr_mask = HRMASK_ADD(hr_mask, dst->re);
+                    hr_mask = HRMASK_ADD(hr_mask, dst->im);
+                }
+            }
+        }
+
+        cur_hr = hr_from_mask(hr_mask);
+    }
+
+    *hr = cur_hr;
+    *exp = *exp + exp_modifier;
+}
+
+
+void xs3_fft_mixed_forward(
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    fft_mixed(x, N, hr, exp, 0);
+}
+
+
+void xs3_fft_mixed_inverse(
+    complex_s32_t x[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    fft_mixed(x, N, hr, exp, 1);
+}
+
+
+void xs3_fft_mono_adjust_mixed(
+    complex_s32_t x[],
+    const unsigned FFT_N,
+    const unsigned inverse,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    const unsigned K = FFT_N / 2;
+
+    // Outputs are (half) the sum of two terms, each with at most 1 bit of growth
+    const right_shift_t shr = 2 - *hr;
+
+    unsigned hr_mask = 0;
+
+    // The DC and Nyquist components are packed into element 0 (see @ref spectrum_packing)
+    {
+        const int64_t re = x[0].re;
+        const int64_t im = x[0].im;
+
+        x[0].re = ASHR(32)(re + im, shr + (inverse? 1 : 0));
+        x[0].im = ASHR(32)(re - im, shr + (inverse? 1 : 0));
+
+        hr_mask = HRMASK_ADD(hr_mask, x[0].re);
+        hr_mask = HRMASK_ADD(hr_mask, x[0].im);
+    }
+
+    for(unsigned k = 1; k <= K/2; k++){
+
+        const unsigned m = K - k;
+
+        complex_s32_t W = fft_twiddle_mixed(k, FFT_N);
+        if(inverse) W.im = -W.im;
+
+        // a = X[k], b = conj(X[K-k])
+        const int64_t a_re = x[k].re, a_im = x[k].im;
+        const int64_t b_re = x[m].re, b_im = -((int64_t) x[m].im);
+
+        const int64_t e_re = a_re + b_re;
+        const int64_t e_im = a_im + b_im;
+        const int64_t d_re = a_re - b_re;
+        const int64_t d_im = a_im - b_im;
+
+        // t = j * W * d
+        const int64_t t_re = ROUND_SHR(-(d_re * W.im + d_im * W.re), Q30_SHR);
+        const int64_t t_im = ROUND_SHR(  d_re * W.re - d_im * W.im,  Q30_SHR);
+
+        // Forward: X[k] = (e - t)/2,  X[K-k] = conj(e + t)/2
+        // Inverse: Z[k] = (e + t)/2,  Z[K-k] = conj(e - t)/2
+        const int64_t sgn = inverse? 1 : -1;
+
+        x[k].re = ASHR(32)(e_re + sgn * t_re, 1 + shr);
+        x[k].im = ASHR(32)(e_im + sgn * t_im, 1 + shr);
+        x[m].re = ASHR(32)(  e_re - sgn * t_re,  1 + shr);
+        x[m].im = ASHR(32)(-(e_im - sgn * t_im), 1 + shr);
+
+        hr_mask = HRMASK_ADD(hr_mask, x[k].re);
+        hr_mask = HRMASK_ADD(hr_mask, x[k].im);
+        hr_mask = HRMASK_ADD(hr_mask, x[m].re);
+        hr_mask = HRMASK_ADD(hr_mask, x[m].im);
+    }
+
+    *hr = hr_from_mask(hr_mask);
+    *exp = *exp + shr;
+}
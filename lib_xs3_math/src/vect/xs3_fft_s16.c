@@ -0,0 +1,319 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "xs3_fft_lut.h"
+
+/*
+    16-bit FFTs.
+
+    The complex data is held as separate real and imaginary arrays (as in bfp_complex_s16_t), and the twiddle factors
+    are taken from the Q14 quarter-wave sine table xs3_fft_sine_lut_s16[].
+
+    Every stage is a radix-2 stage. Before each stage the data is (logically) shifted so that it has 2 bits of headroom,
+    which is enough to guarantee that the stage cannot saturate. The shift is folded into the rounding right-shift
+    applied to the (32-bit) butterfly outputs, so no precision is lost when the data is shifted down. The headroom of
+    each stage's output is tracked with a headroom mask.
+
+    There is no VPU kernel for these FFTs; the butterflies are scalar C on every platform. The cost of a stage with
+    butterfly span b is dominated by the N/2 butterflies, each of which is four 16x16-bit multiplies (the products,
+    and their sum with the Q14-scaled other input, fit in 32 bits) and four rounding shifts. The twiddle factor only
+    depends on the butterfly's position k within its group, so the loops are ordered with k outermost and each stage
+    looks up just b twiddle factors (N-1 in the whole transform rather than one per butterfly). Each lookup is a
+    constant number of table reads (see xs3_fft_sine_lut_index()).
+*/
+
+// Twiddle factors are Q14
+#define TWIDDLE_SHR     (14)
+#define TWIDDLE_ONE     (1<<TWIDDLE_SHR)
+
+// Headroom needed at the input of each stage
+#define STAGE_HR        (2)
+
+
+// Get sin(2*pi*i / 2^P), for 0 <= i <= 2^(P-2)
+static int16_t fft_sine_s16(
+    unsigned i,
+    unsigned P)
+{
+    return xs3_fft_sine_lut_s16[xs3_fft_sine_lut_index(i, P)];
+}
+
+
+// Get W_{2^P}^k = exp(-j*2*pi*k / 2^P), for 0 <= k < 2^(P-1), using quarter-wave symmetry.
+static complex_s16_t fft_twiddle_s16(
+    const unsigned k,
+    const unsigned P)
+{
+    complex_s16_t W = {TWIDDLE_ONE, 0};
+
+    if(k == 0)
+        return W;
+
+    const unsigned Q = 1 << (P-2);
+
+    if(k <= Q){
+        W.re =  fft_sine_s16(Q - k, P);
+        W.im = -fft_sine_s16(k, P);
+    } else {
+        W.re = -fft_sine_s16(k - Q, P);
+        W.im = -fft_sine_s16(2*Q - k, P);
+    }
+
+    return W;
+}
+
+
+// Rounding (or, if shr is negative, left-) shift to 16 bits
+static int16_t fft_shr_s16(
+    const int64_t val,
+    const right_shift_t shr)
+{
+    const int64_t res = (shr >= 0)? ROUND_SHR(val, shr) : (val << (-shr));
+    return (int16_t) SAT16(res);
+}
+
+
+static unsigned bitrev(unsigned index, size_t bit_width)
+{
+    unsigned res = 0;
+    for(int i = 0; i < bit_width; i++, index >>= 1){
+        res = ((res<<1) | (index & 0x1));
+    }
+    return res;
+}
+
+
+void xs3_fft_index_bit_reversal_s16(
+    int16_t x[],
+    const unsigned length)
+{
+    size_t logn = ceil_log2(length);
+    for(int i = 0; i < length; i++){
+
+        unsigned rev = bitrev(i, logn);
+        if(rev <= i) continue;
+
+        int16_t tmp = x[i];
+
+        x[i] = x[rev];
+        x[rev] = tmp;
+    }
+}
+
+
+static void fft_dit_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp,
+    const unsigned inverse)
+{
+    headroom_t cur_hr = *hr;
+    exponent_t exp_modifier = 0;
+
+    for(unsigned P = 1; (1u << P) <= N; P++){
+
+        const unsigned b = 1 << (P-1);
+
+        const right_shift_t shr = STAGE_HR - cur_hr;
+        exp_modifier += shr;
+        if(inverse) exp_modifier += -1;
+
+        unsigned hr_mask = 0;
+
+        for(unsigned k = 0; k < b; k++){
+
+            complex_s16_t W = fft_twiddle_s16(k, P);
+            if(inverse) W.im = -W.im;
+
+            for(unsigned s = k; s < N; s += 2*b){
+                const int32_t lo_re = ((int32_t) real[s]) << TWIDDLE_SHR;
+                const int32_t lo_im = ((int32_t) imag[s]) << TWIDDLE_SHR;
+                const int32_t t_re = ((int32_t) real[s+b]) * W.re - ((int32_t) imag[s+b]) * W.im;
+                const int32_t t_im = ((int32_t) real[s+b]) * W.im + ((int32_t) imag[s+b]) * W.re;
+
+                real[s]   = fft_shr_s16(lo_re + t_re, TWIDDLE_SHR + shr);
+                imag[s]   = fft_shr_s16(lo_im + t_im, TWIDDLE_SHR + shr);
+                real[s+b] = fft_shr_s16(lo_re - t_re, TWIDDLE_SHR + shr);
+                imag[s+b] = fft_shr_s16(lo_im - t_im, TWIDDLE_SHR + shr);
+
+                hr_mask = HRMASK_ADD(hr_mask, real[s]);
+                hr_mask = HRMASK_ADD(hr_mask, imag[s]);
+                hr_mask = HRMASK_ADD(hr_mask, real[s+b]);
+                hr_mask = HRMASK_ADD(hr_mask, imag[s+b]);
+            }
+        }
+
+        cur_hr = hr_from_mask(hr_mask) - 16;
+    }
+
+    *hr = cur_hr;
+    *exp = *exp + exp_modifier;
+}
+
+
+static void fft_dif_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp,
+    const unsigned inverse)
+{
+    headroom_t cur_hr = *hr;
+    exponent_t exp_modifier = 0;
+
+    for(unsigned P = 31 - CLS_S32(N); P > 0; P--){
+
+        const unsigned b = 1 << (P-1);
+
+        const right_shift_t shr = STAGE_HR - cur_hr;
+        exp_modifier += shr;
+        if(inverse) exp_modifier += -1;
+
+        unsigned hr_mask = 0;
+
+        for(unsigned k = 0; k < b; k++){
+
+            complex_s16_t W = fft_twiddle_s16(k, P);
+            if(inverse) W.im = -W.im;
+
+            for(unsigned s = k; s < N; s += 2*b){
+                const int32_t d_re = ((int32_t) real[s]) - real[s+b];
+                const int32_t d_im = ((int32_t) imag[s]) - imag[s+b];
+
+                real[s]   = fft_shr_s16(((int32_t) real[s]) + real[s+b], shr);
+                imag[s]   = fft_shr_s16(((int32_t) imag[s]) + imag[s+b], shr);
+                real[s+b] = fft_shr_s16(d_re * W.re - d_im * W.im, TWIDDLE_SHR + shr);
+                imag[s+b] = fft_shr_s16(d_re * W.im + d_im * W.re, TWIDDLE_SHR + shr);
+
+                hr_mask = HRMASK_ADD(hr_mask, real[s]);
+                hr_mask = HRMASK_ADD(hr_mask, imag[s]);
+                hr_mask = HRMASK_ADD(hr_mask, real[s+b]);
+                hr_mask = HRMASK_ADD(hr_mask, imag[s+b]);
+            }
+        }
+
+        cur_hr = hr_from_mask(hr_mask) - 16;
+    }
+
+    *hr = cur_hr;
+    *exp = *exp + exp_modifier;
+}
+
+
+void xs3_fft_dit_forward_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    fft_dit_s16(real, imag, N, hr, exp, 0);
+}
+
+
+void xs3_fft_dit_inverse_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    fft_dit_s16(real, imag, N, hr, exp, 1);
+}
+
+
+void xs3_fft_dif_forward_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    fft_dif_s16(real, imag, N, hr, exp, 0);
+}
+
+
+void xs3_fft_dif_inverse_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned N,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    fft_dif_s16(real, imag, N, hr, exp, 1);
+}
+
+
+void xs3_fft_mono_adjust_s16(
+    int16_t real[],
+    int16_t imag[],
+    const unsigned FFT_N,
+    const unsigned inverse,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+    const unsigned FFT_N_LOG2 = 31 - CLS_S32(FFT_N);
+    const unsigned K = FFT_N / 2;
+
+    // Outputs are (half) the sum of two terms, each with at most 1 bit of growth
+    const right_shift_t shr = STAGE_HR - *hr;
+
+    unsigned hr_mask = 0;
+
+    // The DC and Nyquist components are packed into element 0 (see @ref spectrum_packing)
+    {
+        const int64_t re = real[0];
+        const int64_t im = imag[0];
+
+        real[0] = fft_shr_s16(re + im, shr + (inverse? 1 : 0));
+        imag[0] = fft_shr_s16(re - im, shr + (inverse? 1 : 0));
+
+        hr_mask = HRMASK_ADD(hr_mask, real[0]);
+        hr_mask = HRMASK_ADD(hr_mask, imag[0]);
+    }
+
+    for(unsigned k = 1; k <= K/2; k++){
+
+        const unsigned m = K - k;
+
+        complex_s16_t W = fft_twiddle_s16(k, FFT_N_LOG2);
+        if(inverse) W.im = -W.im;
+
+        // a = X[k], b = conj(X[K-k])
+        const int64_t a_re = real[k], a_im = imag[k];
+        const int64_t b_re = real[m], b_im = -imag[m];
+
+        const int64_t e_re = (a_re + b_re) << TWIDDLE_SHR;
+        const int64_t e_im = (a_im + b_im) << TWIDDLE_SHR;
+        const int64_t d_re = a_re - b_re;
+        const int64_t d_im = a_im - b_im;
+
+        // t = j * W * d
+        const int64_t t_re = -(d_re * W.im + d_im * W.re);
+        const int64_t t_im =   d_re * W.re - d_im * W.im;
+
+        // Forward: X[k] = (e - t)/2,  X[K-k] = conj(e + t)/2
+        // Inverse: Z[k] = (e + t)/2,  Z[K-k] = conj(e - t)/2
+        const int64_t sgn = inverse? 1 : -1;
+
+        real[k] = fft_shr_s16(e_re + sgn * t_re, TWIDDLE_SHR + 1 + shr);
+        imag[k] = fft_shr_s16(e_im + sgn * t_im, TWIDDLE_SHR + 1 + shr);
+        real[m] = fft_shr_s16(  e_re - sgn * t_re,  TWIDDLE_SHR + 1 + shr);
+        imag[m] = fft_shr_s16(-(e_im - sgn * t_im), TWIDDLE_SHR + 1 + shr);
+
+        hr_mask = HRMASK_ADD(hr_mask, real[k]);
+        hr_mask = HRMASK_ADD(hr_mask, imag[k]);
+        hr_mask = HRMASK_ADD(hr_mask, real[m]);
+        hr_mask = HRMASK_ADD(hr_mask, imag[m]);
+    }
+
+    *hr = hr_from_mask(hr_mask) - 16;
+    *exp = *exp + shr;
+}
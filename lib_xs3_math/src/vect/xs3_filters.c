@@ -4,9 +4,11 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "xs3_math.h"
 
+
 void xs3_push_sample_up_s16(
     int16_t* buffer,
     const unsigned length,
@@ -28,6 +30,22 @@ void xs3_filter_fir_s16_init(
     filter->shift = shift;
     filter->coef = (int16_t*) coefficients;
     filter->state = sample_buffer;
+    filter->circular = 0;
+    filter->head = 0;
+    filter->window = sample_buffer;
+}
+
+
+void xs3_filter_fir_s16_init_circular(
+    xs3_filter_fir_s16_t* filter,
+    int16_t* sample_buffer,
+    const unsigned tap_count,
+    const int16_t* coefficients,
+    const right_shift_t shift)
+{
+    xs3_filter_fir_s16_init(filter, sample_buffer, tap_count, coefficients, shift);
+    memset(sample_buffer, 0, 4 * tap_count * sizeof(int16_t));
+    filter->circular = 1;
 }
 
 
@@ -35,7 +53,26 @@ void xs3_filter_fir_s16_add_sample(
     xs3_filter_fir_s16_t* filter,
     const int16_t new_sample)
 {
-    xs3_push_sample_up_s16(filter->state, filter->num_taps, new_sample); 
+    if(!filter->circular){
+        xs3_push_sample_up_s16(filter->state, filter->num_taps, new_sample); 
+        return;
+    }
+
+    const unsigned N = filter->num_taps;
+    int16_t* state = filter->state;
+
+    filter->head = (filter->head == 0)? N - 1 : filter->head - 1;
+
+    // The first mirrored buffer has the new sample at head, and the second one position further along
+    const unsigned head_a = filter->head;
+    const unsigned head_b = (head_a == N - 1)? 0 : head_a + 1;
+
+    state[head_a] = new_sample;
+    state[head_a + N] = new_sample;
+    state[2*N + head_b] = new_sample;
+    state[3*N + head_b] = new_sample;
+
+    filter->window = (head_a & 1)? &state[2*N + head_b] : &state[head_a];
 }
 
 
@@ -68,6 +105,666 @@ void xs3_filter_fir_s32_add_sample(
 
 
 
+void xs3_filter_fir_sym_s32_init(
+    xs3_filter_fir_sym_s32_t* filter,
+    int32_t* sample_buffer,
+    const unsigned tap_count,
+    const int32_t* coefficients,
+    const right_shift_t shift)
+{
+    assert(tap_count != 0);
+    filter->num_taps = tap_count;
+    filter->shift = shift;
+    filter->coef = (int32_t*) coefficients;
+    filter->state = sample_buffer;
+    filter->head = 0;
+    filter->tail = 0;
+    memset(sample_buffer, 0, XS3_FILTER_FIR_SYM_S32_STATE_LEN(tap_count) * sizeof(int32_t));
+}
+
+
+void xs3_filter_fir_sym_s32_add_sample(
+    xs3_filter_fir_sym_s32_t* filter,
+    const int32_t new_sample)
+{
+    // M newest samples (newest first) in state[0:2M], Q oldest samples (oldest first) in state[2M:2M+2Q]
+    const unsigned M = (filter->num_taps + 1) / 2;
+    const unsigned Q = filter->num_taps / 2;
+    int32_t* newest = &filter->state[0];
+    int32_t* oldest = &filter->state[2*M];
+
+    filter->head = (filter->head == 0)? M - 1 : filter->head - 1;
+
+    // The slot being overwritten holds the sample which moves from the newest half to the oldest half
+    const int32_t moved = newest[filter->head];
+
+    newest[filter->head] = new_sample;
+    newest[filter->head + M] = new_sample;
+
+    if(Q == 0)
+        return;
+
+    oldest[filter->tail] = moved;
+    oldest[filter->tail + Q] = moved;
+    filter->tail = (filter->tail == Q - 1)? 0 : filter->tail + 1;
+}
+
+
+int32_t xs3_filter_fir_sym_s32(
+    xs3_filter_fir_sym_s32_t* filter,
+    const int32_t new_sample)
+{
+    xs3_filter_fir_sym_s32_add_sample(filter, new_sample);
+
+    const unsigned M = (filter->num_taps + 1) / 2;
+    const unsigned Q = filter->num_taps / 2;
+    const int32_t* newest = &filter->state[filter->head];
+    const int32_t* oldest = &filter->state[2*M + filter->tail];
+    int32_t* pairs = &filter->state[2*filter->num_taps];
+
+    // pairs[k] = x[t-k] + x[t-(N-1-k)], and for odd N the middle sample stands alone
+    if(Q != 0)
+        xs3_vect_s32_add(pairs, newest, oldest, Q, 0, 0);
+    if(M != Q)
+        pairs[Q] = newest[Q];
+
+    int64_t acc = xs3_vect_s32_dot(pairs, filter->coef, M, 0, 0);
+
+    if(filter->shift > 0){
+        acc += ((int64_t) 1) << (filter->shift - 1);
+        acc = acc >> filter->shift;
+    } else {
+        acc = acc << (-filter->shift);
+    }
+
+    return (int32_t) MAX(-INT32_MAX, MIN(INT32_MAX, acc));
+}
+
+
+void xs3_filter_fir_sym_s16_init(
+    xs3_filter_fir_sym_s16_t* filter,
+    int16_t* sample_buffer,
+    const unsigned tap_count,
+    const int16_t* coefficients,
+    const right_shift_t shift)
+{
+    assert(tap_count != 0);
+    filter->num_taps = tap_count;
+    filter->shift = shift;
+    filter->coef = (int16_t*) coefficients;
+    filter->state = sample_buffer;
+    filter->head = 0;
+    filter->tail = 0;
+    filter->newest = &sample_buffer[0];
+    filter->oldest = &sample_buffer[4*((tap_count + 1) / 2)];
+    memset(sample_buffer, 0, XS3_FILTER_FIR_SYM_S16_STATE_LEN(tap_count) * sizeof(int16_t));
+}
+
+
+void xs3_filter_fir_sym_s16_add_sample(
+    xs3_filter_fir_sym_s16_t* filter,
+    const int16_t new_sample)
+{
+    // M newest samples (newest first) in state[0:2M], and one position further along in state[2M:4M]. Q oldest 
+    // samples (oldest first) in state[4M:4M+2Q], and one position further along in state[4M+2Q:4M+4Q].
+    const unsigned M = (filter->num_taps + 1) / 2;
+    const unsigned Q = filter->num_taps / 2;
+    int16_t* newest = &filter->state[0];
+    int16_t* oldest = &filter->state[4*M];
+
+    filter->head = (filter->head == 0)? M - 1 : filter->head - 1;
+
+    const unsigned head_a = filter->head;
+    const unsigned head_b = (head_a == M - 1)? 0 : head_a + 1;
+
+    // The slot being overwritten holds the sample which moves from the newest half to the oldest half
+    const int16_t moved = newest[head_a];
+
+    newest[head_a] = new_sample;
+    newest[head_a + M] = new_sample;
+    newest[2*M + head_b] = new_sample;
+    newest[3*M + head_b] = new_sample;
+
+    filter->newest = (head_a & 1)? &newest[2*M + head_b] : &newest[head_a];
+
+    if(Q == 0)
+        return;
+
+    const unsigned tail_a = filter->tail;
+    const unsigned tail_b = (tail_a == Q - 1)? 0 : tail_a + 1;
+
+    oldest[tail_a] = moved;
+    oldest[tail_a + Q] = moved;
+    oldest[2*Q + tail_b] = moved;
+    oldest[3*Q + tail_b] = moved;
+
+    // The oldest sample is now the one after the slot just written
+    filter->tail = tail_b;
+    const unsigned tail_c = (tail_b == Q - 1)? 0 : tail_b + 1;
+
+    filter->oldest = (tail_b & 1)? &oldest[2*Q + tail_c] : &oldest[tail_b];
+}
+
+
+int16_t xs3_filter_fir_sym_s16(
+    xs3_filter_fir_sym_s16_t* filter,
+    const int16_t new_sample)
+{
+    xs3_filter_fir_sym_s16_add_sample(filter, new_sample);
+
+    const unsigned M = (filter->num_taps + 1) / 2;
+    const unsigned Q = filter->num_taps / 2;
+    int16_t* pairs = &filter->state[4*filter->num_taps];
+
+    // pairs[k] = x[t-k] + x[t-(N-1-k)], and for odd N the middle sample stands alone
+    if(Q != 0)
+        xs3_vect_s16_add(pairs, filter->newest, filter->oldest, Q, 0, 0);
+    if(M != Q)
+        pairs[Q] = filter->newest[Q];
+
+    int64_t acc = xs3_vect_s16_dot(pairs, filter->coef, M);
+
+    if(filter->shift > 0)   acc = (acc + (((int64_t) 1) << (filter->shift - 1))) >> filter->shift;
+    else                    acc = acc << (-filter->shift);
+
+    return (int16_t) MAX(-INT16_MAX, MIN(INT16_MAX, acc));
+}
+
+
+void xs3_filter_decimator_s32_init(
+    xs3_filter_decimator_s32_t* decimator,
+    int32_t* sample_buffer,
+    const unsigned tap_count,
+    const int32_t* coefficients,
+    const right_shift_t shift,
+    const unsigned factor)
+{
+    assert(factor != 0);
+    xs3_filter_fir_s32_init(&decimator->filter, sample_buffer, tap_count, coefficients, shift);
+    decimator->factor = factor;
+}
+
+
+int32_t xs3_filter_decimator_s32(
+    xs3_filter_decimator_s32_t* decimator,
+    const int32_t new_samples[])
+{
+    const unsigned R = decimator->factor;
+
+    for(int i = 0; i < R-1; i++)
+        xs3_filter_fir_s32_add_sample(&decimator->filter, new_samples[i]);
+
+    return xs3_filter_fir_s32(&decimator->filter, new_samples[R-1]);
+}
+
+
+void xs3_filter_decimator_s16_init(
+    xs3_filter_decimator_s16_t* decimator,
+    int16_t* sample_buffer,
+    const unsigned tap_count,
+    const int16_t* coefficients,
+    const right_shift_t shift,
+    const unsigned factor)
+{
+    assert(factor != 0);
+    xs3_filter_fir_s16_init_circular(&decimator->filter, sample_buffer, tap_count, coefficients, shift);
+    decimator->factor = factor;
+}
+
+
+int16_t xs3_filter_decimator_s16(
+    xs3_filter_decimator_s16_t* decimator,
+    const int16_t new_samples[])
+{
+    const unsigned R = decimator->factor;
+
+    for(int i = 0; i < R-1; i++)
+        xs3_filter_fir_s16_add_sample(&decimator->filter, new_samples[i]);
+
+    return xs3_filter_fir_s16(&decimator->filter, new_samples[R-1]);
+}
+
+
+void xs3_filter_interpolator_s32_init(
+    xs3_filter_interpolator_s32_t* interpolator,
+    int32_t* sample_buffer,
+    int32_t* coef_buffer,
+    const unsigned tap_count,
+    const int32_t* coefficients,
+    const right_shift_t shift,
+    const unsigned factor)
+{
+    assert(factor != 0);
+    const unsigned M = XS3_FILTER_POLYPHASE_TAPS(tap_count, factor);
+
+    // Phase p gets prototype taps p, p + factor, p + 2*factor, ...
+    for(int p = 0; p < factor; p++){
+        for(int k = 0; k < M; k++){
+            const unsigned tap = k * factor + p;
+            coef_buffer[p * M + k] = (tap < tap_count)? coefficients[tap] : 0;
+        }
+    }
+
+    memset(sample_buffer, 0, M * sizeof(int32_t));
+    xs3_filter_fir_s32_init(&interpolator->filter, sample_buffer, M, coef_buffer, shift);
+    interpolator->factor = factor;
+    interpolator->coef = coef_buffer;
+}
+
+
+void xs3_filter_interpolator_s32(
+    xs3_filter_interpolator_s32_t* interpolator,
+    int32_t output[],
+    const int32_t new_sample)
+{
+    xs3_filter_fir_s32_t* filter = &interpolator->filter;
+    const unsigned M = filter->num_taps;
+    const unsigned head = filter->head;
+
+    // Every phase adds the same sample to the same slot of the shared state, so rewinding the head before each phase 
+    // leaves the state exactly as if the sample had been added once.
+    for(int p = 0; p < interpolator->factor; p++){
+        filter->head = head;
+        filter->coef = &interpolator->coef[p * M];
+        output[p] = xs3_filter_fir_s32(filter, new_sample);
+    }
+}
+
+
+void xs3_filter_interpolator_s16_init(
+    xs3_filter_interpolator_s16_t* interpolator,
+    int16_t* sample_buffer,
+    int16_t* coef_buffer,
+    const unsigned tap_count,
+    const int16_t* coefficients,
+    const right_shift_t shift,
+    const unsigned factor)
+{
+    assert(factor != 0);
+    const unsigned M = XS3_FILTER_POLYPHASE_TAPS(tap_count, factor);
+
+    // Phase p gets prototype taps p, p + factor, p + 2*factor, ...
+    for(int p = 0; p < factor; p++){
+        for(int k = 0; k < M; k++){
+            const unsigned tap = k * factor + p;
+            coef_buffer[p * M + k] = (tap < tap_count)? coefficients[tap] : 0;
+        }
+    }
+
+    xs3_filter_fir_s16_init_circular(&interpolator->filter, sample_buffer, M, coef_buffer, shift);
+    interpolator->factor = factor;
+    interpolator->coef = coef_buffer;
+}
+
+
+void xs3_filter_interpolator_s16(
+    xs3_filter_interpolator_s16_t* interpolator,
+    int16_t output[],
+    const int16_t new_sample)
+{
+    xs3_filter_fir_s16_t* filter = &interpolator->filter;
+    const unsigned M = filter->num_taps;
+    const unsigned head = filter->head;
+
+    // As for the 32-bit interpolator, adding the same sample again at the same head position doesn't change the state
+    for(int p = 0; p < interpolator->factor; p++){
+        filter->head = head;
+        filter->coef = &interpolator->coef[p * M];
+        output[p] = xs3_filter_fir_s16(filter, new_sample);
+    }
+}
+
+
+
+void xs3_filter_src_s32_init(
+    xs3_filter_src_s32_t* src,
+    int32_t* sample_buffer,
+    int32_t* coef_buffer,
+    const unsigned tap_count,
+    const int32_t* coefficients,
+    const right_shift_t shift,
+    const unsigned up,
+    const unsigned down)
+{
+    assert(down != 0);
+    xs3_filter_interpolator_s32_init(&src->interpolator, sample_buffer, coef_buffer, tap_count, coefficients, 
+                                     shift, up);
+    src->down = down;
+    src->phase = 0;
+}
+
+
+headroom_t xs3_filter_src_s32(
+    xs3_filter_src_s32_t* src,
+    int32_t output[],
+    unsigned* output_length,
+    const int32_t input[],
+    const unsigned input_length)
+{
+    xs3_filter_fir_s32_t* filter = &src->interpolator.filter;
+    const unsigned L = src->interpolator.factor;
+    const unsigned M = src->down;
+    const unsigned taps = filter->num_taps;
+
+    unsigned phase = src->phase;
+    unsigned count = 0;
+
+    for(int n = 0; n < input_length; n++){
+
+        // No output falls on this input sample's phases
+        if(phase >= L){
+            xs3_filter_fir_s32_add_sample(filter, input[n]);
+            phase -= L;
+            continue;
+        }
+
+        // As in xs3_filter_interpolator_s32(), every output adds the same sample at the same head position
+        const unsigned head = filter->head;
+
+        for(; phase < L; phase += M){
+            filter->head = head;
+            filter->coef = &src->interpolator.coef[phase * taps];
+            output[count++] = xs3_filter_fir_s32(filter, input[n]);
+        }
+
+        phase -= L;
+    }
+
+    src->phase = phase;
+    *output_length = count;
+
+    return xs3_vect_s32_headroom(output, count);
+}
+
+
+void xs3_filter_cic_s32_init(
+    xs3_filter_cic_s32_t* cic,
+    const unsigned order,
+    const unsigned ratio,
+    const unsigned input_bits)
+{
+    assert(order != 0 && order <= XS3_FILTER_CIC_MAX_ORDER);
+    assert(ratio != 0);
+    assert(input_bits != 0 && input_bits <= 32);
+
+    // Bit growth G = ceil(log2(R^N))
+    uint64_t gain = 1;
+    for(int k = 0; k < order; k++){
+        assert(gain <= (UINT64_MAX / ratio));
+        gain *= ratio;
+    }
+
+    unsigned growth = 0;
+    while(growth < 64 && (((uint64_t) 1) << growth) < gain)
+        growth++;
+
+    assert(growth + input_bits <= 64);
+
+    cic->order = order;
+    cic->ratio = ratio;
+    cic->shift = (growth + input_bits > 31)? (growth + input_bits - 31) : 0;
+
+    memset(cic->integrator, 0, sizeof(cic->integrator));
+    memset(cic->comb, 0, sizeof(cic->comb));
+}
+
+
+/*
+    Add one input sample to the CIC decimator's integrators.
+*/
+static inline void cic_integrate(
+    xs3_filter_cic_s32_t* cic,
+    const int32_t sample)
+{
+    uint64_t acc = (uint64_t) (int64_t) sample;
+
+    for(int k = 0; k < cic->order; k++){
+        cic->integrator[k] += acc;
+        acc = cic->integrator[k];
+    }
+}
+
+
+/*
+    Apply the CIC decimator's rounding right-shift to a comb output.
+*/
+static inline int32_t cic_round(
+    const xs3_filter_cic_s32_t* cic,
+    const int64_t y)
+{
+    const right_shift_t shr = cic->shift;
+
+    if(shr == 0)
+        return (int32_t) y;
+
+    return (int32_t) ((y + (((int64_t) 1) << (shr - 1))) >> shr);
+}
+
+
+/*
+    Get the next output sample of the CIC decimator by passing the last integrator's output through the combs.
+*/
+static inline int32_t cic_comb(
+    xs3_filter_cic_s32_t* cic)
+{
+    const unsigned N = cic->order;
+    uint64_t acc = cic->integrator[N-1];
+
+    for(int k = 0; k < N; k++){
+        const uint64_t prev = cic->comb[k];
+        cic->comb[k] = acc;
+        acc -= prev;
+    }
+
+    // The wrapped result is exact once it is interpreted as signed
+    return cic_round(cic, (int64_t) acc);
+}
+
+
+headroom_t xs3_filter_cic_s32(
+    xs3_filter_cic_s32_t* cic,
+    int32_t output[],
+    const int32_t input[],
+    const unsigned length)
+{
+    const unsigned R = cic->ratio;
+
+    for(int n = 0; n < length; n++){
+        for(int i = 0; i < R; i++)
+            cic_integrate(cic, input[n*R + i]);
+
+        output[n] = cic_comb(cic);
+    }
+
+    return xs3_vect_s32_headroom(output, length);
+}
+
+
+/*
+    Contribution of a byte of PDM samples to each integrator, split into its low and high nibbles.
+
+    Sample j of a byte (j = 0 being the earliest, in the LSB) reaches integrator k through C(7-j+k, k) paths by the end
+    of the byte, so the byte adds sum_j C(7-j+k, k) * (1 - 2*b_j) to integrator k. The low nibble's table includes the
+    constant sum_j C(7-j+k, k), and the high nibble's only the -2 * C(7-j+k, k) terms of its set bits.
+*/
+static const int16_t cic_pdm_lut_lo[16][XS3_FILTER_CIC_MAX_ORDER] = {
+    {     8,    36,   120,   330,   792,  1716,  3432,  6435 },
+    {     6,    20,    48,    90,   132,   132,     0,  -429 },
+    {     6,    22,    64,   162,   372,   792,  1584,  3003 },
+    {     4,     6,    -8,   -78,  -288,  -792, -1848, -3861 },
+    {     6,    24,    78,   218,   540,  1212,  2508,  4851 },
+    {     4,     8,     6,   -22,  -120,  -372,  -924, -2013 },
+    {     4,    10,    22,    50,   120,   288,   660,  1419 },
+    {     2,    -6,   -50,  -190,  -540, -1296, -2772, -5445 },
+    {     6,    26,    90,   260,   652,  1464,  3012,  5775 },
+    {     4,    10,    18,    20,    -8,  -120,  -420, -1089 },
+    {     4,    12,    34,    92,   232,   540,  1164,  2343 },
+    {     2,    -4,   -38,  -148,  -428, -1044, -2268, -4521 },
+    {     4,    14,    48,   148,   400,   960,  2088,  4191 },
+    {     2,    -2,   -24,   -92,  -260,  -624, -1344, -2673 },
+    {     2,     0,    -8,   -20,   -20,    36,   240,   759 },
+    {     0,   -16,   -80,  -260,  -680, -1548, -3192, -6105 },
+};
+
+static const int16_t cic_pdm_lut_hi[16][XS3_FILTER_CIC_MAX_ORDER] = {
+    {     0,     0,     0,     0,     0,     0,     0,     0 },
+    {    -2,    -8,   -20,   -40,   -70,  -112,  -168,  -240 },
+    {    -2,    -6,   -12,   -20,   -30,   -42,   -56,   -72 },
+    {    -4,   -14,   -32,   -60,  -100,  -154,  -224,  -312 },
+    {    -2,    -4,    -6,    -8,   -10,   -12,   -14,   -16 },
+    {    -4,   -12,   -26,   -48,   -80,  -124,  -182,  -256 },
+    {    -4,   -10,   -18,   -28,   -40,   -54,   -70,   -88 },
+    {    -6,   -18,   -38,   -68,  -110,  -166,  -238,  -328 },
+    {    -2,    -2,    -2,    -2,    -2,    -2,    -2,    -2 },
+    {    -4,   -10,   -22,   -42,   -72,  -114,  -170,  -242 },
+    {    -4,    -8,   -14,   -22,   -32,   -44,   -58,   -74 },
+    {    -6,   -16,   -34,   -62,  -102,  -156,  -226,  -314 },
+    {    -4,    -6,    -8,   -10,   -12,   -14,   -16,   -18 },
+    {    -6,   -14,   -28,   -50,   -82,  -126,  -184,  -258 },
+    {    -6,   -12,   -20,   -30,   -42,   -56,   -72,   -90 },
+    {    -8,   -20,   -40,   -70,  -112,  -168,  -240,  -330 },
+};
+
+/*
+    Over a byte of samples, integrator m's state reaches integrator k (k >= m) through C(7+k-m, k-m) paths.
+*/
+static const uint32_t cic_pdm_byte_gain[XS3_FILTER_CIC_MAX_ORDER] = {
+    1, 8, 36, 120, 330, 792, 1716, 3432,
+};
+
+
+/*
+    Add one PDM sample to a 32-bit copy of the CIC decimator's integrators.
+*/
+static inline void cic_pdm_integrate_bit(
+    uint32_t integrator[],
+    const unsigned order,
+    const unsigned b)
+{
+    uint32_t acc = 1 - 2 * b;
+
+    for(int k = 0; k < order; k++){
+        integrator[k] += acc;
+        acc = integrator[k];
+    }
+}
+
+
+/*
+    Add a byte of PDM samples (the earliest in the LSB) to a 32-bit copy of the CIC decimator's integrators.
+
+    The last integrator is updated first, so that each integrator's new state is computed from the old states.
+*/
+static inline void cic_pdm_integrate_byte(
+    uint32_t integrator[],
+    const unsigned order,
+    const unsigned byte)
+{
+    const int16_t* lo = cic_pdm_lut_lo[byte & 0xF];
+    const int16_t* hi = cic_pdm_lut_hi[byte >> 4];
+
+    for(int k = order - 1; k >= 0; k--){
+        uint32_t acc = (uint32_t) (lo[k] + hi[k]);
+
+        for(int m = 0; m <= k; m++)
+            acc += cic_pdm_byte_gain[k - m] * integrator[m];
+
+        integrator[k] = acc;
+    }
+}
+
+
+/*
+    CIC decimator for a PDM stream whose outputs fit in 32 bits (R^N < 2^31), for which 32-bit wrapping arithmetic is
+    exact. Aligned bytes of samples are added to the integrators with cic_pdm_integrate_byte().
+*/
+static void cic_pdm_s32_narrow(
+    xs3_filter_cic_s32_t* cic,
+    int32_t output[],
+    const uint32_t input[],
+    const unsigned length)
+{
+    const unsigned N = cic->order;
+    const unsigned R = cic->ratio;
+
+    uint32_t integrator[XS3_FILTER_CIC_MAX_ORDER];
+    uint32_t comb[XS3_FILTER_CIC_MAX_ORDER];
+
+    for(int k = 0; k < N; k++){
+        integrator[k] = (uint32_t) cic->integrator[k];
+        comb[k] = (uint32_t) cic->comb[k];
+    }
+
+    unsigned bit = 0;
+
+    for(int n = 0; n < length; n++){
+        const unsigned end = bit + R;
+
+        // As for VDEPTH1, a set bit is a negative sample
+        for(; (bit < end) && (bit & 0x7); bit++)
+            cic_pdm_integrate_bit(integrator, N, (input[bit >> 5] >> (bit & 0x1F)) & 1);
+
+        for(; bit + 8 <= end; bit += 8)
+            cic_pdm_integrate_byte(integrator, N, (input[bit >> 5] >> (bit & 0x18)) & 0xFF);
+
+        for(; bit < end; bit++)
+            cic_pdm_integrate_bit(integrator, N, (input[bit >> 5] >> (bit & 0x1F)) & 1);
+
+        uint32_t acc = integrator[N-1];
+
+        for(int k = 0; k < N; k++){
+            const uint32_t prev = comb[k];
+            comb[k] = acc;
+            acc -= prev;
+        }
+
+        output[n] = cic_round(cic, (int32_t) acc);
+    }
+
+    for(int k = 0; k < N; k++){
+        cic->integrator[k] = (uint64_t) (int64_t) (int32_t) integrator[k];
+        cic->comb[k] = (uint64_t) (int64_t) (int32_t) comb[k];
+    }
+}
+
+
+headroom_t xs3_filter_cic_s32_pdm(
+    xs3_filter_cic_s32_t* cic,
+    int32_t output[],
+    const uint32_t input[],
+    const unsigned length)
+{
+    const unsigned R = cic->ratio;
+
+    assert(((length * R) % 32) == 0);
+
+    // The outputs are at most R^N in magnitude
+    uint64_t gain = 1;
+    for(int k = 0; k < cic->order; k++)
+        gain *= R;
+
+    if(gain < (((uint64_t) 1) << 31)){
+        cic_pdm_s32_narrow(cic, output, input, length);
+        return xs3_vect_s32_headroom(output, length);
+    }
+
+    unsigned bit = 0;
+
+    for(int n = 0; n < length; n++){
+        for(int i = 0; i < R; i++, bit++){
+            // As for VDEPTH1, a set bit is a negative sample
+            const unsigned b = (input[bit >> 5] >> (bit & 0x1F)) & 1;
+            cic_integrate(cic, 1 - 2 * (int32_t) b);
+        }
+
+        output[n] = cic_comb(cic);
+    }
+
+    return xs3_vect_s32_headroom(output, length);
+}
+
+
+
 int32_t xs3_filter_biquads_s32(
     xs3_biquad_filter_s32_t biquads[],
     const unsigned block_count,
@@ -79,4 +776,112 @@ int32_t xs3_filter_biquads_s32(
         smp = xs3_filter_biquad_s32(&biquads[i], smp);
     
     return smp;
-}
\ No newline at end of file
+}
+
+
+unsigned xs3_filter_biquads_s32_init(
+    xs3_biquad_filter_s32_t biquads[],
+    const int32_t coef[][5],
+    const unsigned section_count)
+{
+    const unsigned block_count = XS3_BIQUAD_BLOCK_COUNT(section_count);
+
+    for(int b = 0; b < block_count; b++){
+        xs3_biquad_filter_s32_t* biquad = &biquads[b];
+
+        biquad->biquad_count = MIN(8, section_count - 8*b);
+        memset(biquad->state, 0, sizeof(biquad->state));
+
+        for(int k = 0; k < 8; k++){
+            for(int j = 0; j < 5; j++)
+                biquad->coef[j][k] = (k < biquad->biquad_count)? coef[8*b + k][j] : 0;
+        }
+    }
+
+    return block_count;
+}
+
+
+void xs3_filter_biquads_s32_block(
+    xs3_biquad_filter_s32_t biquads[],
+    const unsigned block_count,
+    int32_t output[],
+    const int32_t input[],
+    const unsigned length)
+{
+    // Each block's output is the next block's input, so output[] holds the intermediate signal. This only reorders the
+    // calls made by xs3_filter_biquads_s32(); the kernel still loads the coefficients for every sample.
+    const int32_t* x = input;
+
+    for(int b = 0; b < block_count; b++){
+        for(int n = 0; n < length; n++)
+            output[n] = xs3_filter_biquad_s32(&biquads[b], x[n]);
+        x = output;
+    }
+
+    if(block_count == 0 && output != input)
+        memmove(output, input, length * sizeof(int32_t));
+}
+
+
+void xs3_filter_biquad_bank_s32_init(
+    xs3_filter_biquad_bank_s32_t* bank,
+    int32_t state_buffer[][2][8],
+    const int32_t coef[][5][8],
+    const unsigned stage_count,
+    const unsigned channel_count)
+{
+    assert(channel_count != 0 && channel_count <= 8);
+    bank->channel_count = channel_count;
+    bank->stage_count = stage_count;
+    bank->coef = (int32_t*) coef;
+    bank->state = (int32_t*) state_buffer;
+    memset(state_buffer, 0, (stage_count + 1) * sizeof(state_buffer[0]));
+}
+
+
+// Rounded product of two 32-bit values with a 30-bit right-shift, as applied by the VPU's VLMACC in 32-bit mode
+#define BANK_MUL32(X, Y)    ((int32_t)(((((int64_t)(X)) * (Y)) + (1<<29)) >> 30))
+
+void xs3_filter_biquad_bank_s32(
+    xs3_filter_biquad_bank_s32_t* bank,
+    int32_t output[],
+    const int32_t input[])
+{
+    int32_t (*coef)[5][8] = (int32_t (*)[5][8]) bank->coef;
+    int32_t (*state)[2][8] = (int32_t (*)[2][8]) bank->state;
+
+    const unsigned C = bank->channel_count;
+    const unsigned S = bank->stage_count;
+
+    // Input to the current stage, for every channel. The lanes of unused channels are never touched, and stay zero.
+    int32_t x[8];
+
+    for(int c = 0; c < C; c++)
+        x[c] = input[c];
+
+    for(int s = 0; s < S; s++){
+
+        // The taps are accumulated in the same order as in xs3_filter_biquad_s32()
+        for(int c = 0; c < C; c++){
+            int64_t acc = 0;
+            acc += BANK_MUL32(state[s+1][1][c], coef[s][4][c]);
+            acc += BANK_MUL32(state[s+1][0][c], coef[s][3][c]);
+            acc += BANK_MUL32(state[s  ][1][c], coef[s][2][c]);
+            acc += BANK_MUL32(state[s  ][0][c], coef[s][1][c]);
+            acc += BANK_MUL32(x[c],             coef[s][0][c]);
+
+            state[s][1][c] = state[s][0][c];
+            state[s][0][c] = x[c];
+            
+            // The output is the input to the next stage
+            x[c] = (int32_t) acc;
+        }
+    }
+
+    for(int c = 0; c < C; c++){
+        state[S][1][c] = state[S][0][c];
+        state[S][0][c] = x[c];
+        output[c] = x[c];
+    }
+}
@@ -11,7 +11,7 @@
 
 
 ////////////////////////////////////////
-//  Shared params (16- and 32-bit)    //
+//  Shared params (8-, 16-, 32-bit)   //
 ////////////////////////////////////////
 
 
@@ -102,6 +102,36 @@ void xs3_vect_s16_mul_prepare(
 
 
 
+void xs3_vect_s16_macc_prepare(
+    exponent_t* new_acc_exp,
+    right_shift_t* acc_shr,
+    right_shift_t* bc_sat,
+    const exponent_t acc_exp,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t acc_hr,
+    const headroom_t b_hr,
+    const headroom_t c_hr)
+{
+    /*
+        The 32-bit product of b and c is at most 2^(30-b_hr-c_hr) at exponent (b_exp+c_exp), and the accumulator is at
+        most 2^(15-acc_hr) at acc_exp. Their sum can't saturate if each is at most 2^14 at the new exponent. The
+        product can only be shifted right.
+    */
+    const exponent_t acc_min_exp = acc_exp - acc_hr + 1;
+    const exponent_t p_min_exp = b_exp + c_exp + 16 - b_hr - c_hr;
+
+    *new_acc_exp = MAX(acc_min_exp, p_min_exp);
+    *new_acc_exp = MAX(*new_acc_exp, b_exp + c_exp);
+
+    *acc_shr = *new_acc_exp - acc_exp;
+
+    // Any larger shift rounds the product to zero anyway.
+    *bc_sat = MIN(*new_acc_exp - (b_exp + c_exp), 31);
+}
+
+
+
 ////////////////////////////////////////
 //      Params for 32-bit             //
 ////////////////////////////////////////
@@ -155,6 +185,39 @@ void xs3_vect_s32_mul_prepare(
 
 
 
+void xs3_vect_s32_macc_prepare(
+    exponent_t* new_acc_exp,
+    right_shift_t* acc_shr,
+    right_shift_t* b_shr,
+    right_shift_t* c_shr,
+    const exponent_t acc_exp,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t acc_hr,
+    const headroom_t b_hr,
+    const headroom_t c_hr)
+{
+    /*
+        With the shifts from xs3_vect_s32_mul_prepare() the product is at most 2^30 at p_exp, and the accumulator is
+        at most 2^(31-acc_hr) at acc_exp. Their sum can't saturate if each is at most 2^30 at the new exponent.
+    */
+    exponent_t p_exp;
+    xs3_vect_s32_mul_prepare(&p_exp, b_shr, c_shr, b_exp, c_exp, b_hr, c_hr);
+
+    const exponent_t acc_min_exp = acc_exp - acc_hr + 1;
+
+    *new_acc_exp = MAX(acc_min_exp, p_exp);
+
+    // Split any extra shift of the product between its two inputs
+    const right_shift_t extra = *new_acc_exp - p_exp;
+    *b_shr += (extra >> 1);
+    *c_shr += extra - (extra >> 1);
+
+    *acc_shr = *new_acc_exp - acc_exp;
+}
+
+
+
 void xs3_vect_s16_scale_prepare(
     exponent_t* a_exp,
     right_shift_t* a_shr,
@@ -500,3 +563,49 @@ void xs3_vect_s32_energy_prepare(
 
     *a_exp = 2*(b_exp + *b_shr) + 30;
 }
+
+
+
+
+////////////////////////////////////////
+//      Params for 8-bit              //
+////////////////////////////////////////
+
+
+void xs3_vect_s8_mul_prepare(
+    exponent_t* a_exp,
+    right_shift_t* b_shr,
+    right_shift_t* c_shr,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t b_hr,
+    const headroom_t c_hr)
+{
+    /*
+        Same reasoning as xs3_vect_s32_mul_prepare(), except VLMUL has an implicit right-shift of 6 bits in 8-bit mode.
+
+        (-0x80 >> b_hr) * (-0x80 >> c_hr) >> 6
+        2^(14 - b_hr - c_hr - 6)
+        0x40 * 2^(2-total_hr)
+    */
+    headroom_t total_hr = b_hr + c_hr;
+
+    if(total_hr == 0){
+        *b_shr = 1;
+        *c_shr = 1;
+    } else if(total_hr == 1){
+        *b_shr = (b_hr == 0)? 1 : 0;
+        *c_shr = (c_hr == 0)? 1 : 0;
+    } else if(b_hr == 0){
+        *b_shr = 0;
+        *c_shr = 2-total_hr;
+    } else if(c_hr == 0){
+        *b_shr = 2-total_hr;
+        *c_shr = 0;
+    } else {
+        *b_shr = 1-b_hr;
+        *c_shr = 1-c_hr;
+    }
+
+    *a_exp = b_exp + c_exp + *b_shr + *c_shr + 6;
+}
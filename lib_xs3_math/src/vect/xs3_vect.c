@@ -284,4 +284,4 @@ headroom_t xs3_vect_s32_shr(
     const right_shift_t shr)
 {
     return xs3_vect_s32_shl(a, b, length, -shr);
-}
\ No newline at end of file
+}
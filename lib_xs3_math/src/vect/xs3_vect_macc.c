@@ -0,0 +1,146 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+
+#include "xs3_math.h"
+
+
+/*
+    The multiply-accumulate functions are built from the existing multiply and add kernels. The products are formed a
+    block at a time in a small stack buffer and then added to the accumulator, so they are never written to a caller
+    buffer and no scratch memory is needed. Each block is fully read before it is written, so the operations are safe
+    in-place.
+*/
+
+// Number of 32-bit words in the stack buffer used for the products
+#define MACC_BLOCK_WORDS    (64)
+
+
+
+headroom_t xs3_vect_s16_macc(
+    int16_t acc[],
+    const int16_t b[],
+    const int16_t c[],
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t bc_sat)
+{
+    // int32_t buffer so that the products are word-aligned
+    int32_t buff[MACC_BLOCK_WORDS];
+    int16_t* prod = (int16_t*) buff;
+    const unsigned block = 2*MACC_BLOCK_WORDS;
+
+    headroom_t hr = 16;
+
+    for(unsigned k = 0; k < length; k += block){
+        const unsigned len = MIN(block, length - k);
+        xs3_vect_s16_mul(prod, &b[k], &c[k], len, bc_sat);
+        const headroom_t block_hr = xs3_vect_s16_add(&acc[k], &acc[k], prod, len, acc_shr, 0);
+        hr = MIN(hr, block_hr);
+    }
+
+    return hr;
+}
+
+
+
+headroom_t xs3_vect_s32_macc(
+    int32_t acc[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    int32_t prod[MACC_BLOCK_WORDS];
+
+    headroom_t hr = 32;
+
+    for(unsigned k = 0; k < length; k += MACC_BLOCK_WORDS){
+        const unsigned len = MIN(MACC_BLOCK_WORDS, length - k);
+        xs3_vect_s32_mul(prod, &b[k], &c[k], len, b_shr, c_shr);
+        const headroom_t block_hr = xs3_vect_s32_add(&acc[k], &acc[k], prod, len, acc_shr, 0);
+        hr = MIN(hr, block_hr);
+    }
+
+    return hr;
+}
+
+
+
+headroom_t xs3_vect_s32_nmacc(
+    int32_t acc[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    int32_t prod[MACC_BLOCK_WORDS];
+
+    headroom_t hr = 32;
+
+    for(unsigned k = 0; k < length; k += MACC_BLOCK_WORDS){
+        const unsigned len = MIN(MACC_BLOCK_WORDS, length - k);
+        xs3_vect_s32_mul(prod, &b[k], &c[k], len, b_shr, c_shr);
+        const headroom_t block_hr = xs3_vect_s32_sub(&acc[k], &acc[k], prod, len, acc_shr, 0);
+        hr = MIN(hr, block_hr);
+    }
+
+    return hr;
+}
+
+
+
+headroom_t xs3_vect_s32_add_scaled(
+    int32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const int32_t alpha,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr,
+    const right_shift_t alpha_shr)
+{
+    int32_t prod[MACC_BLOCK_WORDS];
+
+    headroom_t hr = 32;
+
+    for(unsigned k = 0; k < length; k += MACC_BLOCK_WORDS){
+        const unsigned len = MIN(MACC_BLOCK_WORDS, length - k);
+        xs3_vect_s32_scale(prod, &c[k], len, alpha, c_shr, alpha_shr);
+        const headroom_t block_hr = xs3_vect_s32_add(&a[k], &b[k], prod, len, b_shr, 0);
+        hr = MIN(hr, block_hr);
+    }
+
+    return hr;
+}
+
+
+
+headroom_t xs3_vect_complex_s32_macc(
+    complex_s32_t acc[],
+    const complex_s32_t b[],
+    const complex_s32_t c[],
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    complex_s32_t prod[MACC_BLOCK_WORDS/2];
+    const unsigned block = MACC_BLOCK_WORDS/2;
+
+    headroom_t hr = 32;
+
+    for(unsigned k = 0; k < length; k += block){
+        const unsigned len = MIN(block, length - k);
+        xs3_vect_complex_s32_mul(prod, &b[k], &c[k], len, b_shr, c_shr);
+        const headroom_t block_hr = xs3_vect_complex_s32_add(&acc[k], &acc[k], prod, len, acc_shr, 0);
+        hr = MIN(hr, block_hr);
+    }
+
+    return hr;
+}
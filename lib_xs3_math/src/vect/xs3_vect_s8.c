@@ -0,0 +1,218 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+// The 8-bit functions are built from the single-element VPU operations, which have an implementation on every 
+// platform, so the same C serves for both xcore and ref builds.
+
+headroom_t xs3_vect_s8_headroom(
+    const int8_t v[],
+    const unsigned length)
+{
+    uint8_t largest = 0;
+    unsigned ldex = 0;
+
+    for(int k = 0; k < length; k++){
+        uint8_t pt =  v[k];
+        uint8_t nt = -v[k];
+
+        if(v[k] >= 0 && pt >= largest){
+            largest = pt;
+            ldex = k;
+        } else if(v[k] < 0 && nt > largest) {
+            largest = nt;
+            ldex = k;
+        }
+    }
+    
+    int8_t lval = v[ldex];
+
+    for(int i = 6; i >= 0; i--){
+        uint8_t mask = (1<<(i));
+        int8_t lmod;
+        if(lval >= 0)
+            lmod = lval & ~mask;
+        else
+            lmod = lval | mask;
+
+        if(lmod != lval){
+            return 6 - i;
+        }
+    }
+
+    return 7;
+}
+
+
+headroom_t xs3_vect_s8_shl(
+    int8_t a[],
+    const int8_t b[],
+    const unsigned length,
+    const int shl)
+{
+    for(int i = 0; i < length; i++){
+        a[i] = vlashr8(b[i], -shl);
+    }
+    return xs3_vect_s8_headroom(a, length);
+}
+
+
+headroom_t xs3_vect_s8_shr(
+    int8_t a[],
+    const int8_t b[],
+    const unsigned length,
+    const right_shift_t shr)
+{
+    return xs3_vect_s8_shl(a, b, length, -shr);
+}
+
+
+headroom_t xs3_vect_s8_add(
+    int8_t a[],
+    const int8_t b[],
+    const int8_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    for(int k = 0; k < length; k++){
+        const int8_t B = vlashr8(b[k], b_shr);
+        const int8_t C = vlashr8(c[k], c_shr);
+        a[k] = vladd8(B, C);
+    }
+
+    return xs3_vect_s8_headroom(a, length);
+}
+
+
+headroom_t xs3_vect_s8_sub(
+    int8_t a[],
+    const int8_t b[],
+    const int8_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    for(int k = 0; k < length; k++){
+        const int8_t B = vlashr8(b[k], b_shr);
+        const int8_t C = vlashr8(c[k], c_shr);
+        a[k] = vlsub8(B, C);
+    }
+
+    return xs3_vect_s8_headroom(a, length);
+}
+
+
+headroom_t xs3_vect_s8_mul(
+    int8_t a[],
+    const int8_t b[],
+    const int8_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    for(int k = 0; k < length; k++){
+        const int8_t B = vlashr8(b[k], b_shr);
+        const int8_t C = vlashr8(c[k], c_shr);
+        a[k] = vlmul8(B, C);
+    }
+
+    return xs3_vect_s8_headroom(a, length);
+}
+
+
+headroom_t xs3_vect_s8_scale(
+    int8_t a[],
+    const int8_t b[],
+    const unsigned length,
+    const int8_t c,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    int8_t C = vlashr8(c, c_shr);
+
+    for(int k = 0; k < length; k++){
+        int8_t B = vlashr8(b[k], b_shr);
+        a[k] = vlmul8(B, C);
+    }
+
+    return xs3_vect_s8_headroom(a, length);
+}
+
+
+int64_t xs3_vect_s8_dot(
+    const int8_t b[],
+    const int8_t c[],
+    const unsigned length)
+{
+    // Each product fits easily in 32 bits, so the sum can't saturate unless length is in the millions
+    int64_t acc = 0;
+
+    for(int k = 0; k < length; k++){
+        acc += vlmacc8(0, b[k], c[k]);
+    }
+
+    return acc;
+}
+
+
+void xs3_vect_s16_to_s8(
+    int8_t a[],
+    const int16_t b[],
+    const unsigned length,
+    const right_shift_t b_shr)
+{
+    // VDEPTH8 has an implicit 8-bit right-shift (in 16-bit mode). To make it more intuitive, b_shr is specified so that
+    // the user doesn't have to care about that.
+    const right_shift_t b_shr_mod = b_shr - 8;
+
+    for(int k = 0; k < length; k++){
+        const int16_t B = vlashr16(b[k], b_shr_mod);
+        a[k] = vdepth8_16(B);
+    }
+}
+
+
+void xs3_vect_s32_to_s8(
+    int8_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr)
+{
+    // VDEPTH8 has an implicit 24-bit right-shift (in 32-bit mode).
+    const right_shift_t b_shr_mod = b_shr - 24;
+
+    for(int k = 0; k < length; k++){
+        const int32_t B = vlashr32(b[k], b_shr_mod);
+        a[k] = vdepth8_32(B);
+    }
+}
+
+
+void xs3_vect_s8_to_s16(
+    int16_t a[],
+    const int8_t b[],
+    const unsigned length)
+{
+    // Iterate backwards so that this is safe if a[] and b[] begin at the same address
+    for(int k = length-1; k >= 0; k--){
+        a[k] = ((int16_t) b[k]) << 8;
+    }
+}
+
+
+void xs3_vect_s8_to_s32(
+    int32_t a[],
+    const int8_t b[],
+    const unsigned length)
+{
+    for(int k = length-1; k >= 0; k--){
+        a[k] = ((int32_t) b[k]) << 24;
+    }
+}
@@ -0,0 +1,92 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity.h"
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+
+#define REPS        (1000)
+#define MAX_LEN     40 
+
+
+static unsigned seed = 666;
+
+
+
+
+void test_bfp_complex_s32_macc()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x2B90F1C7;
+
+    complex_s32_t A_data[MAX_LEN], B_data[MAX_LEN], C_data[MAX_LEN];
+    bfp_complex_s32_t A, B, C;
+
+    A.data = A_data;
+    B.data = B_data;
+    C.data = C_data;
+
+    struct {
+        double real[MAX_LEN];
+        double imag[MAX_LEN];
+    } Af, Bf, Cf;
+
+    complex_s32_t expA[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_complex_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_complex_s32(&C, MAX_LEN, &seed, &A, B.length);
+        test_random_bfp_complex_s32(&A, MAX_LEN, &seed, NULL, B.length);
+
+        // Half of the time, make the accumulator and the products similar in magnitude
+        if(r & 1)
+            A.exp = B.exp + C.exp + 31 + pseudo_rand_int(&seed, -4, 5);
+
+        test_double_from_complex_s32(Af.real, Af.imag, &A);
+        test_double_from_complex_s32(Bf.real, Bf.imag, &B);
+        test_double_from_complex_s32(Cf.real, Cf.imag, &C);
+
+        for(int i = 0; i < B.length; i++){
+            Af.real[i] += Bf.real[i] * Cf.real[i] - Bf.imag[i] * Cf.imag[i];
+            Af.imag[i] += Bf.real[i] * Cf.imag[i] + Bf.imag[i] * Cf.real[i];
+        }
+
+        bfp_complex_s32_macc(&A, &B, &C);
+
+        test_complex_s32_from_double(expA, Af.real, Af.imag, MAX_LEN, A.exp);
+
+        TEST_ASSERT_EQUAL(xs3_vect_complex_s32_headroom(A.data, A.length), A.hr);
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(4, expA[i].re, A.data[i].re);
+            TEST_ASSERT_INT32_WITHIN(4, expA[i].im, A.data[i].im);
+        }
+    }
+}
+
+
+
+
+void test_bfp_macc_vect_complex()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_complex_s32_macc);
+}
@@ -0,0 +1,226 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../tst_common.h"
+
+#include "unity.h"
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+
+#define REPS        (200)
+#define ARENA_SIZE  (2048)
+
+
+
+
+static void test_bfp_arena_alloc()
+{
+    PRINTF("%s...\n", __func__);
+
+    unsigned seed = 0x7D31A2C4;
+
+    uint64_t buff[ARENA_SIZE / sizeof(uint64_t) + 1];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep %d..\n", r);
+
+        // Deliberately misalign the buffer half of the time
+        const unsigned offset = (r & 1)? pseudo_rand_uint(&seed, 1, 8) : 0;
+        uint8_t* buffer = ((uint8_t*) buff) + offset;
+
+        bfp_arena_t arena;
+        bfp_arena_init(&arena, buffer, ARENA_SIZE);
+
+        TEST_ASSERT_EQUAL(0, bfp_arena_high_water(&arena));
+        TEST_ASSERT(bfp_arena_available(&arena) <= ARENA_SIZE);
+        TEST_ASSERT(bfp_arena_available(&arena) >= ARENA_SIZE - BFP_ARENA_ALIGN);
+
+        uint8_t* prev_end = buffer;
+        unsigned total = 0;
+
+        while(1){
+            const unsigned size = pseudo_rand_uint(&seed, 1, 200);
+            const unsigned avail = bfp_arena_available(&arena);
+
+            uint8_t* block = (uint8_t*) bfp_arena_alloc(&arena, size);
+
+            if(size > avail){
+                TEST_ASSERT_NULL(block);
+                TEST_ASSERT_EQUAL(avail, bfp_arena_available(&arena));
+                break;
+            }
+
+            TEST_ASSERT_NOT_NULL(block);
+            TEST_ASSERT_EQUAL(0, ((uintptr_t) block) % BFP_ARENA_ALIGN);
+
+            // Blocks must lie within the buffer and must not overlap
+            TEST_ASSERT(block >= prev_end);
+            TEST_ASSERT(block + size <= buffer + ARENA_SIZE);
+            memset(block, 0xA5, size);
+            prev_end = block + size;
+
+            total += size;
+            TEST_ASSERT(bfp_arena_high_water(&arena) >= total);
+            TEST_ASSERT(bfp_arena_high_water(&arena) < total + 200 * BFP_ARENA_ALIGN);
+        }
+
+        // Releasing everything makes the whole arena available again, but leaves the high-water mark
+        const unsigned high_water = bfp_arena_high_water(&arena);
+        bfp_arena_reset(&arena, 0);
+        TEST_ASSERT_EQUAL(ARENA_SIZE - (ARENA_SIZE % BFP_ARENA_ALIGN) - ((offset)? BFP_ARENA_ALIGN : 0),
+                          bfp_arena_available(&arena));
+        TEST_ASSERT_EQUAL(high_water, bfp_arena_high_water(&arena));
+    }
+}
+
+
+static void test_bfp_arena_mark_reset()
+{
+    PRINTF("%s...\n", __func__);
+
+    uint64_t buff[ARENA_SIZE / sizeof(uint64_t)];
+
+    bfp_arena_t arena;
+    bfp_arena_init(&arena, buff, sizeof(buff));
+
+    TEST_ASSERT_EQUAL(ARENA_SIZE, bfp_arena_available(&arena));
+
+    bfp_arena_mark_t start = bfp_arena_mark(&arena);
+
+    void* a = bfp_arena_alloc(&arena, 100);
+    TEST_ASSERT_EQUAL(buff, a);
+
+    // Nested marks
+    bfp_arena_mark_t mark1 = bfp_arena_mark(&arena);
+    void* b = bfp_arena_alloc(&arena, 300);
+    TEST_ASSERT_EQUAL(((uint8_t*) buff) + 104, b);
+
+    bfp_arena_mark_t mark2 = bfp_arena_mark(&arena);
+    void* c = bfp_arena_alloc(&arena, 12);
+    TEST_ASSERT_EQUAL(((uint8_t*) buff) + 408, c);
+    TEST_ASSERT_EQUAL(424, bfp_arena_high_water(&arena));
+
+    bfp_arena_reset(&arena, mark2);
+    TEST_ASSERT_EQUAL(c, bfp_arena_alloc(&arena, 4));
+
+    bfp_arena_reset(&arena, mark1);
+    TEST_ASSERT_EQUAL(b, bfp_arena_alloc(&arena, 8));
+    TEST_ASSERT_EQUAL(424, bfp_arena_high_water(&arena));
+
+    // Exhaustion leaves the arena unchanged
+    TEST_ASSERT_NULL(bfp_arena_alloc(&arena, ARENA_SIZE));
+    TEST_ASSERT_EQUAL(ARENA_SIZE - 112, bfp_arena_available(&arena));
+
+    TEST_ASSERT_EQUAL(((uint8_t*) buff) + 112, bfp_arena_alloc(&arena, ARENA_SIZE - 112));
+    TEST_ASSERT_EQUAL(0, bfp_arena_available(&arena));
+    TEST_ASSERT_EQUAL(ARENA_SIZE, bfp_arena_high_water(&arena));
+    TEST_ASSERT_NULL(bfp_arena_alloc(&arena, 1));
+
+    bfp_arena_reset(&arena, start);
+    TEST_ASSERT_EQUAL(ARENA_SIZE, bfp_arena_available(&arena));
+    TEST_ASSERT_EQUAL(ARENA_SIZE, bfp_arena_high_water(&arena));
+}
+
+
+static void test_bfp_init_from_arena()
+{
+    PRINTF("%s...\n", __func__);
+
+    unsigned seed = 0x1B9E57F0;
+
+    uint64_t buff[ARENA_SIZE / sizeof(uint64_t)];
+
+    bfp_arena_t arena;
+    bfp_arena_init(&arena, buff, sizeof(buff));
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep %d..\n", r);
+
+        const bfp_arena_mark_t frame = bfp_arena_mark(&arena);
+
+        const unsigned length = pseudo_rand_uint(&seed, 1, 50);
+        const exponent_t exp = pseudo_rand_int(&seed, -30, 30);
+
+        bfp_s16_t A16;
+        bfp_s32_t A32;
+        bfp_complex_s16_t C16;
+        bfp_complex_s32_t C32;
+        bfp_ch_pair_s16_t P16;
+        bfp_ch_pair_s32_t P32;
+
+        TEST_ASSERT_EQUAL(bfp_s16_init_from_arena(&A16, &arena, exp, length), A16.data);
+        TEST_ASSERT_EQUAL(bfp_s32_init_from_arena(&A32, &arena, exp, length), A32.data);
+        TEST_ASSERT_EQUAL(bfp_complex_s16_init_from_arena(&C16, &arena, exp, length), C16.real);
+        TEST_ASSERT_EQUAL(bfp_complex_s32_init_from_arena(&C32, &arena, exp, length), C32.data);
+        TEST_ASSERT_EQUAL(bfp_ch_pair_s16_init_from_arena(&P16, &arena, exp, length), P16.data);
+        TEST_ASSERT_EQUAL(bfp_ch_pair_s32_init_from_arena(&P32, &arena, exp, length), P32.data);
+
+        void* blocks[] = { A16.data, A32.data, C16.real, C16.imag, C32.data, P16.data, P32.data };
+        const unsigned sizes[] = { 2*length, 4*length, 2*length, 2*length, 8*length, 4*length, 8*length };
+
+        unsigned total = 0;
+        for(int k = 0; k < sizeof(sizes)/sizeof(sizes[0]); k++){
+            TEST_ASSERT_NOT_NULL(blocks[k]);
+            TEST_ASSERT_EQUAL(0, ((uintptr_t) blocks[k]) % BFP_ARENA_ALIGN);
+            if(k > 0)
+                TEST_ASSERT(((uint8_t*) blocks[k]) >= ((uint8_t*) blocks[k-1]) + sizes[k-1]);
+            total += sizes[k];
+        }
+
+        TEST_ASSERT(bfp_arena_high_water(&arena) >= total);
+
+        TEST_ASSERT_EQUAL(length, A32.length);
+        TEST_ASSERT_EQUAL(exp, A32.exp);
+        TEST_ASSERT_EQUAL(0, A32.hr);
+        TEST_ASSERT_EQUAL(0, A32.hr_exact);
+        TEST_ASSERT_EQUAL(length, C16.length);
+        TEST_ASSERT_EQUAL(exp, C16.exp);
+        TEST_ASSERT_EQUAL(length, P32.length);
+        TEST_ASSERT_EQUAL(exp, P32.exp);
+
+        // The temporaries can be used as ordinary BFP vectors
+        bfp_s32_set(&A32, 0x12345, exp);
+        bfp_s32_add(&A32, &A32, &A32);
+        TEST_ASSERT_EQUAL(ldexp(2*0x12345, exp), ldexp(A32.data[length-1], A32.exp));
+
+        bfp_arena_reset(&arena, frame);
+        TEST_ASSERT_EQUAL(ARENA_SIZE, bfp_arena_available(&arena));
+    }
+
+    // Running out of space
+    bfp_s32_t big;
+    TEST_ASSERT_NULL(bfp_s32_init_from_arena(&big, &arena, 0, ARENA_SIZE));
+    TEST_ASSERT_NULL(big.data);
+
+    // Complex 16-bit vectors need two buffers; if the second doesn't fit, neither is allocated
+    bfp_complex_s16_t cbig;
+    TEST_ASSERT_NULL(bfp_complex_s16_init_from_arena(&cbig, &arena, 0, 3*ARENA_SIZE/8));
+    TEST_ASSERT_NULL(cbig.real);
+    TEST_ASSERT_NULL(cbig.imag);
+    TEST_ASSERT_EQUAL(ARENA_SIZE, bfp_arena_available(&arena));
+}
+
+
+
+
+void test_bfp_arena()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_arena_alloc);
+    RUN_TEST(test_bfp_arena_mark_reset);
+    RUN_TEST(test_bfp_init_from_arena);
+}
@@ -0,0 +1,428 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+#include "bfp/bfp_expr.hpp"
+
+#include "../tst_common.h"
+
+#include "unity.h"
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+
+#define REPS        1000
+#define MAX_LEN     256
+
+
+static unsigned seed = 666;
+
+
+
+
+// Single operations should give exactly the same result as the corresponding BFP function
+static void test_bfp_expr_s32_single()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x3C91E5A7;
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    int32_t dataC[MAX_LEN];
+    int32_t dataY[MAX_LEN];
+    bfp_s32_t A, B, C, Y;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+    Y.data = dataY;
+
+    bfp::vect_s32 b(B), c(C), y(Y);
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s32(&C, MAX_LEN, &seed, &A, B.length);
+        Y.length = B.length;
+
+        float_s32_t alpha = {
+            pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 12),
+            pseudo_rand_int(&seed, -40, 0) };
+
+        bfp_s32_add(&A, &B, &C);
+        y = b + c;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT(Y.hr_exact);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(A.data, Y.data, A.length);
+
+        bfp_s32_sub(&A, &B, &C);
+        y = b - c;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(A.data, Y.data, A.length);
+
+        bfp_s32_mul(&A, &B, &C);
+        y = b * c;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(A.data, Y.data, A.length);
+
+        bfp_s32_scale(&A, &B, alpha);
+        y = b * alpha;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(A.data, Y.data, A.length);
+    }
+}
+
+
+static void test_bfp_expr_s16_single()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x70B2D94E;
+
+    int16_t dataA[MAX_LEN];
+    int16_t dataB[MAX_LEN];
+    int16_t dataC[MAX_LEN];
+    int16_t dataY[MAX_LEN];
+    bfp_s16_t A, B, C, Y;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+    Y.data = dataY;
+
+    bfp::vect_s16 b(B), c(C), y(Y);
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s16(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s16(&C, MAX_LEN, &seed, &A, B.length);
+        Y.length = B.length;
+
+        float_s16_t alpha = {
+            (int16_t) (pseudo_rand_int16(&seed) >> pseudo_rand_uint(&seed, 0, 6)),
+            pseudo_rand_int(&seed, -20, 0) };
+
+        bfp_s16_add(&A, &B, &C);
+        y = b + c;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(A.data, Y.data, A.length);
+
+        bfp_s16_sub(&A, &B, &C);
+        y = b - c;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(A.data, Y.data, A.length);
+
+        bfp_s16_mul(&A, &B, &C);
+        y = b * c;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(A.data, Y.data, A.length);
+
+        bfp_s16_scale(&A, &B, alpha);
+        y = b * alpha;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(A.data, Y.data, A.length);
+    }
+}
+
+
+static void test_bfp_expr_complex_s32_single()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x1A6F3C08;
+
+    complex_s32_t dataA[MAX_LEN];
+    complex_s32_t dataB[MAX_LEN];
+    complex_s32_t dataC[MAX_LEN];
+    complex_s32_t dataY[MAX_LEN];
+    bfp_complex_s32_t A, B, C, Y;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+    Y.data = dataY;
+
+    bfp::vect_complex_s32 b(B), c(C), y(Y);
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_complex_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_complex_s32(&C, MAX_LEN, &seed, &A, B.length);
+        Y.length = B.length;
+
+        float_s32_t alpha = {
+            pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 12),
+            pseudo_rand_int(&seed, -40, 0) };
+
+        bfp_complex_s32_add(&A, &B, &C);
+        y = b + c;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT(Y.hr_exact);
+        TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) A.data, (int32_t*) Y.data, 2*A.length);
+
+        bfp_complex_s32_sub(&A, &B, &C);
+        y = b - c;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) A.data, (int32_t*) Y.data, 2*A.length);
+
+        bfp_complex_s32_mul(&A, &B, &C);
+        y = b * c;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) A.data, (int32_t*) Y.data, 2*A.length);
+
+        bfp_complex_s32_real_scale(&A, &B, alpha);
+        y = b * alpha;
+        TEST_ASSERT_EQUAL(A.exp, Y.exp);
+        TEST_ASSERT_EQUAL(A.hr, Y.hr);
+        TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) A.data, (int32_t*) Y.data, 2*A.length);
+    }
+}
+
+
+static void test_bfp_expr_s32_chain()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x5E04A7B3;
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    int32_t dataC[MAX_LEN];
+    int32_t dataD[MAX_LEN];
+    int32_t expY[MAX_LEN];
+    bfp_s32_t A, B, C, D;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+    D.data = dataD;
+
+    double Af[MAX_LEN];
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+    double Df[MAX_LEN];
+
+    bfp::vect_s32 a(A), b(B), c(C), d(D);
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s32(&C, MAX_LEN, &seed, &A, B.length);
+        test_random_bfp_s32(&D, MAX_LEN, &seed, &A, B.length);
+        test_random_bfp_s32(&A, MAX_LEN, &seed, NULL, B.length);
+
+        // Half of the time, make the sum and the product similar in magnitude
+        if(r & 1)
+            D.exp = B.exp + C.exp + 30 + pseudo_rand_int(&seed, -4, 5);
+
+        const int shr = pseudo_rand_int(&seed, -10, 10);
+
+        float_s32_t alpha = {
+            pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 12),
+            pseudo_rand_int(&seed, -40, 0) };
+
+        test_double_from_s32(Af, &A);
+        test_double_from_s32(Bf, &B);
+        test_double_from_s32(Cf, &C);
+        test_double_from_s32(Df, &D);
+
+        for(unsigned i = 0; i < B.length; i++){
+            Df[i] = ldexp(Bf[i] * Cf[i] + Df[i], -shr) - Cf[i] * ldexp(alpha.mant, alpha.exp);
+        }
+
+        a = ((b * c + d) >> shr) - c * alpha;
+
+        test_s32_from_double(expY, Df, MAX_LEN, A.exp);
+
+        TEST_ASSERT(A.hr_exact);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+
+        for(unsigned i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(4, expY[i], A.data[i]);
+        }
+
+        // The output may also be an operand
+        test_double_from_s32(Af, &A);
+        test_double_from_s32(Bf, &B);
+
+        for(unsigned i = 0; i < A.length; i++){
+            Af[i] = Af[i] + Bf[i] * Bf[i];
+        }
+
+        a += b * b;
+
+        test_s32_from_double(expY, Af, MAX_LEN, A.exp);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+
+        for(unsigned i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(4, expY[i], A.data[i]);
+        }
+    }
+}
+
+
+static void test_bfp_expr_s16_chain()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x2B8D61F0;
+
+    int16_t dataA[MAX_LEN];
+    int16_t dataB[MAX_LEN];
+    int16_t dataC[MAX_LEN];
+    int16_t dataD[MAX_LEN];
+    int16_t expY[MAX_LEN];
+    bfp_s16_t A, B, C, D;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+    D.data = dataD;
+
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+    double Df[MAX_LEN];
+
+    bfp::vect_s16 a(A), b(B), c(C), d(D);
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s16(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s16(&C, MAX_LEN, &seed, &A, B.length);
+        test_random_bfp_s16(&D, MAX_LEN, &seed, &A, B.length);
+        A.length = B.length;
+
+        if(r & 1)
+            D.exp = B.exp + C.exp + 15 + pseudo_rand_int(&seed, -4, 5);
+
+        const int shl = pseudo_rand_int(&seed, -10, 10);
+
+        test_double_from_s16(Bf, &B);
+        test_double_from_s16(Cf, &C);
+        test_double_from_s16(Df, &D);
+
+        for(unsigned i = 0; i < B.length; i++){
+            Df[i] = ldexp(Df[i] - Bf[i] * Cf[i], shl);
+        }
+
+        a = (d - b * c) << shl;
+
+        test_s16_from_double(expY, Df, MAX_LEN, A.exp);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s16_headroom(A.data, A.length), A.hr);
+
+        for(unsigned i = 0; i < A.length; i++){
+            TEST_ASSERT_INT16_WITHIN(4, expY[i], A.data[i]);
+        }
+    }
+}
+
+
+static void test_bfp_expr_complex_s32_chain()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x49C2F81D;
+
+    complex_s32_t dataA[MAX_LEN];
+    complex_s32_t dataB[MAX_LEN];
+    complex_s32_t dataC[MAX_LEN];
+    complex_s32_t dataD[MAX_LEN];
+    complex_s32_t expY[MAX_LEN];
+    bfp_complex_s32_t A, B, C, D;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+    D.data = dataD;
+
+    double B_re[MAX_LEN], B_im[MAX_LEN];
+    double C_re[MAX_LEN], C_im[MAX_LEN];
+    double D_re[MAX_LEN], D_im[MAX_LEN];
+
+    bfp::vect_complex_s32 a(A), b(B), c(C), d(D);
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_complex_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_complex_s32(&C, MAX_LEN, &seed, &A, B.length);
+        test_random_bfp_complex_s32(&D, MAX_LEN, &seed, &A, B.length);
+        A.length = B.length;
+
+        if(r & 1)
+            D.exp = B.exp + C.exp + 30 + pseudo_rand_int(&seed, -4, 5);
+
+        float_s32_t alpha = {
+            pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 12),
+            pseudo_rand_int(&seed, -40, 0) };
+
+        test_double_from_complex_s32(B_re, B_im, &B);
+        test_double_from_complex_s32(C_re, C_im, &C);
+        test_double_from_complex_s32(D_re, D_im, &D);
+
+        const double alpha_f = ldexp(alpha.mant, alpha.exp);
+
+        for(unsigned i = 0; i < B.length; i++){
+            const double re = B_re[i] * C_re[i] - B_im[i] * C_im[i];
+            const double im = B_re[i] * C_im[i] + B_im[i] * C_re[i];
+            D_re[i] = (re + D_re[i]) * alpha_f;
+            D_im[i] = (im + D_im[i]) * alpha_f;
+        }
+
+        a = (b * c + d) * alpha;
+
+        test_complex_s32_from_double(expY, D_re, D_im, MAX_LEN, A.exp);
+
+        TEST_ASSERT(A.hr_exact);
+        TEST_ASSERT_EQUAL(xs3_vect_complex_s32_headroom(A.data, A.length), A.hr);
+
+        for(unsigned i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(4, expY[i].re, A.data[i].re);
+            TEST_ASSERT_INT32_WITHIN(4, expY[i].im, A.data[i].im);
+        }
+    }
+}
+
+
+
+
+extern "C" void test_bfp_expr_vect()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_expr_s32_single);
+    RUN_TEST(test_bfp_expr_s16_single);
+    RUN_TEST(test_bfp_expr_complex_s32_single);
+    RUN_TEST(test_bfp_expr_s32_chain);
+    RUN_TEST(test_bfp_expr_s16_chain);
+    RUN_TEST(test_bfp_expr_complex_s32_chain);
+}
@@ -0,0 +1,226 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+#include "../tst_common.h"
+
+#include "unity.h"
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+
+#define CIC_ORDER       4
+#define CIC_RATIO       32
+#define DEC_FACTOR      2
+#define DEC_TAPS        24
+#define BLOCK_OUTPUTS   8
+#define BLOCKS          40
+#define BLOCK_BITS      (BLOCK_OUTPUTS * CIC_RATIO)
+#define TOTAL_BITS      (BLOCKS * BLOCK_BITS)
+
+
+static unsigned seed = 0x2B7F9D31;
+
+
+/*
+    Compute the output of the order-N, ratio-R CIC filter for the last of the R input samples of each output, directly
+    as N cascaded moving sums, with the samples before time 0 being zero.
+*/
+static void cic_reference(
+    double y[],
+    const double x[],
+    const unsigned length,
+    const unsigned N,
+    const unsigned R)
+{
+    static double stage[TOTAL_BITS];
+    memcpy(stage, x, length * R * sizeof(double));
+
+    for(int s = 0; s < N; s++){
+        for(int t = length * R - 1; t >= 0; t--){
+            double acc = 0;
+            for(int j = 0; j < R && j <= t; j++)
+                acc += stage[t - j];
+            stage[t] = acc;
+        }
+    }
+
+    for(int n = 0; n < length; n++)
+        y[n] = stage[n*R + R - 1];
+}
+
+
+/*
+    PDM-modulate x[] with a first-order sigma-delta modulator, and pack the bits with the semantics of VDEPTH1.
+*/
+static void pdm_modulate(
+    uint32_t bits[],
+    double pdm[],
+    const double x[],
+    const unsigned length)
+{
+    double integral = 0;
+    double prev = 0;
+
+    memset(bits, 0, (length / 32) * sizeof(uint32_t));
+
+    for(int t = 0; t < length; t++){
+        integral += x[t] - prev;
+        prev = (integral >= 0)? 1.0 : -1.0;
+        pdm[t] = prev;
+        bits[t / 32] |= vdepth1_32((int32_t) prev) << (t % 32);
+    }
+}
+
+
+void test_bfp_filter_cic_s32_pdm()
+{
+    PRINTF("%s...\n", __func__);
+
+    static double signal[TOTAL_BITS];
+    static double pdm[TOTAL_BITS];
+    static uint32_t bits[TOTAL_BITS / 32];
+    static double cic_expected[BLOCKS * BLOCK_OUTPUTS];
+    static double cic_out[BLOCKS * BLOCK_OUTPUTS];
+
+    // A slow sine on a DC offset
+    for(int t = 0; t < TOTAL_BITS; t++)
+        signal[t] = 0.25 + 0.5 * sin(2 * M_PI * t / (TOTAL_BITS / 4.0));
+
+    pdm_modulate(bits, pdm, signal, TOTAL_BITS);
+    cic_reference(cic_expected, pdm, BLOCKS * BLOCK_OUTPUTS, CIC_ORDER, CIC_RATIO);
+
+    xs3_filter_cic_s32_t cic;
+    xs3_filter_cic_s32_init(&cic, CIC_ORDER, CIC_RATIO, 1);
+
+    // The compensation stage. Its coefficients are a windowed-sinc lowpass with a DC gain of 1, at exponent -30.
+    int32_t dec_coef[DEC_TAPS];
+    int32_t dec_state[DEC_TAPS] = {0};
+    double dec_coef_dbl[DEC_TAPS];
+    const exponent_t coef_exp = -30;
+    double coef_sum = 0;
+    for(int k = 0; k < DEC_TAPS; k++){
+        const double m = k - (DEC_TAPS - 1) / 2.0;
+        const double window = 0.54 - 0.46 * cos(2 * M_PI * k / (DEC_TAPS - 1));
+        dec_coef_dbl[k] = window * ((m == 0)? 1 : sin(M_PI * m / 2) / (M_PI * m / 2));
+        coef_sum += dec_coef_dbl[k];
+    }
+    for(int k = 0; k < DEC_TAPS; k++){
+        dec_coef[k] = (int32_t) round(ldexp(dec_coef_dbl[k] / coef_sum, -coef_exp));
+        dec_coef_dbl[k] = ldexp(dec_coef[k], coef_exp);
+    }
+
+    xs3_filter_decimator_s32_t decimator;
+    xs3_filter_decimator_s32_init(&decimator, dec_state, DEC_TAPS, dec_coef, 0, DEC_FACTOR);
+
+    for(int b = 0; b < BLOCKS; b++){
+        int32_t y_data[BLOCK_OUTPUTS];
+        int32_t z_data[BLOCK_OUTPUTS / DEC_FACTOR];
+        bfp_s32_t y, z;
+        y.data = y_data;
+        z.data = z_data;
+
+        bfp_filter_cic_s32_pdm(&cic, &y, &bits[b * BLOCK_BITS / 32], BLOCK_OUTPUTS);
+
+        TEST_ASSERT_EQUAL(BLOCK_OUTPUTS, y.length);
+        TEST_ASSERT_EQUAL(cic.shift, y.exp);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(y.data, BLOCK_OUTPUTS), y.hr);
+
+        for(int n = 0; n < BLOCK_OUTPUTS; n++){
+            cic_out[b * BLOCK_OUTPUTS + n] = ldexp(y.data[n], y.exp);
+            TEST_ASSERT(cic_out[b * BLOCK_OUTPUTS + n] == cic_expected[b * BLOCK_OUTPUTS + n]);
+        }
+
+        // Hand the block off to the compensation stage
+        bfp_filter_decimator_s32(&decimator, &z, &y, coef_exp);
+
+        TEST_ASSERT_EQUAL(BLOCK_OUTPUTS / DEC_FACTOR, z.length);
+        TEST_ASSERT_EQUAL(y.exp + coef_exp + 30, z.exp);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(z.data, z.length), z.hr);
+
+        // Each tap's product is rounded separately
+        for(int n = 0; n < z.length; n++){
+            const int t = b * BLOCK_OUTPUTS + (n + 1) * DEC_FACTOR - 1;
+            double expected = 0;
+            for(int k = 0; k < DEC_TAPS && k <= t; k++)
+                expected += dec_coef_dbl[k] * cic_out[t - k];
+            TEST_ASSERT_MESSAGE(fabs(ldexp(z.data[n], z.exp) - expected) <= ldexp(DEC_TAPS, z.exp),
+                                "Decimator output delta is too large");
+        }
+    }
+
+    // After the filters have settled, the outputs (normalized by the CIC's DC gain) follow the input signal
+    const double gain = pow(CIC_RATIO, CIC_ORDER);
+    for(int n = 2 * CIC_ORDER; n < BLOCKS * BLOCK_OUTPUTS; n++){
+        const int t = n * CIC_RATIO + CIC_RATIO - 1 - (CIC_ORDER * (CIC_RATIO - 1)) / 2;
+        TEST_ASSERT_MESSAGE(fabs(cic_out[n] / gain - signal[t]) < 0.05, "CIC output doesn't follow the input");
+    }
+}
+
+
+void test_bfp_filter_cic_s32()
+{
+    PRINTF("%s...\n", __func__);
+
+    // 28-bit samples with a fixed exponent, e.g. from a previous decimation stage
+    const unsigned N = 3;
+    const unsigned R = 5;
+    const unsigned L = 40;
+    const exponent_t x_exp = -27;
+
+    static double x_dbl[BLOCKS * 40];
+    double y_expected[BLOCKS * 40 / 5];
+
+    xs3_filter_cic_s32_t cic;
+    xs3_filter_cic_s32_init(&cic, N, R, 28);
+    TEST_ASSERT_EQUAL(4, cic.shift);
+
+    for(int t = 0; t < BLOCKS * L; t++)
+        x_dbl[t] = ldexp(pseudo_rand_int32(&seed) >> 4, x_exp);
+
+    cic_reference(y_expected, x_dbl, BLOCKS * L / R, N, R);
+
+    for(int b = 0; b < BLOCKS; b++){
+        int32_t x_data[40];
+        int32_t y_data[40 / 5];
+        bfp_s32_t x, y;
+
+        bfp_s32_init(&x, x_data, x_exp, L, 0);
+        for(int t = 0; t < L; t++)
+            x.data[t] = (int32_t) ldexp(x_dbl[b * L + t], -x_exp);
+        bfp_s32_headroom(&x);
+
+        y.data = y_data;
+        bfp_filter_cic_s32(&cic, &y, &x);
+
+        TEST_ASSERT_EQUAL(L / R, y.length);
+        TEST_ASSERT_EQUAL(x_exp + cic.shift, y.exp);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(y.data, y.length), y.hr);
+
+        // The shift is rounding
+        for(int n = 0; n < y.length; n++)
+            TEST_ASSERT_MESSAGE(fabs(ldexp(y.data[n], y.exp) - y_expected[b * L / R + n]) <= ldexp(0.5, y.exp),
+                                "CIC output delta is too large");
+    }
+}
+
+
+void test_bfp_filter_cic()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_filter_cic_s32_pdm);
+    RUN_TEST(test_bfp_filter_cic_s32);
+}
@@ -0,0 +1,269 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../tst_common.h"
+
+#include "unity.h"
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+
+#define MAX_TAPS        64
+#define MAX_BLOCK       32
+#define MAX_SAMPLES     (MAX_TAPS + 2000 * MAX_BLOCK)
+
+
+static unsigned seed = 666;
+
+
+/*
+    Fill x with L random samples with a random exponent and headroom, and put their values in x_dbl[].
+*/
+static void make_input_block(
+    bfp_s32_t* x,
+    double x_dbl[],
+    const unsigned L)
+{
+    const headroom_t hr = pseudo_rand_uint(&seed, 0, 4);
+
+    x->length = L;
+    x->exp = pseudo_rand_int(&seed, -33, -28);
+
+    for(unsigned n = 0; n < L; n++){
+        x->data[n] = pseudo_rand_int32(&seed) >> hr;
+        x_dbl[n] = ldexp(x->data[n], x->exp);
+    }
+
+    bfp_s32_headroom(x);
+}
+
+
+/*
+    Quantize the L values of d_dbl[] into d, with the smallest exponent which fits them all.
+*/
+static void make_desired_block(
+    bfp_s32_t* d,
+    const double d_dbl[],
+    const unsigned L)
+{
+    double max = 0;
+    for(unsigned n = 0; n < L; n++)
+        max = fmax(max, fabs(d_dbl[n]));
+
+    int e;
+    frexp(max, &e);
+
+    d->length = L;
+    d->exp = e - 30;
+
+    for(unsigned n = 0; n < L; n++)
+        d->data[n] = (int32_t) round(ldexp(d_dbl[n], -d->exp));
+
+    bfp_s32_headroom(d);
+}
+
+
+/*
+    An unknown system with a decaying impulse response, identified from its input and output.
+*/
+static void make_system(
+    double h[],
+    const unsigned M)
+{
+    for(unsigned k = 0; k < M; k++)
+        h[k] = ldexp(pseudo_rand_int32(&seed), -31) * pow(0.9, k);
+}
+
+
+static void test_system_identification(
+    const unsigned M,
+    const unsigned B,
+    const unsigned blocks,
+    const unsigned block_update,
+    const float_s32_t mu)
+{
+    int32_t weight_buff[MAX_TAPS];
+    int32_t history_buff[MAX_TAPS + MAX_BLOCK - 1];
+    int32_t scratch_buff[MAX_TAPS + MAX_BLOCK];
+    int32_t x_data[MAX_BLOCK];
+    int32_t d_data[MAX_BLOCK];
+    int32_t e_data[MAX_BLOCK];
+
+    // All input samples, with the M-1 samples before time 0 being zero
+    static double input[MAX_SAMPLES];
+
+    double h[MAX_TAPS];
+    double h_max = 0;
+
+    assert(M - 1 + blocks * B <= MAX_SAMPLES);
+
+    make_system(h, M);
+    for(unsigned k = 0; k < M; k++)
+        h_max = fmax(h_max, fabs(h[k]));
+
+    const float_s32_t delta = {0x40000000, -90};
+
+    bfp_filter_nlms_s32_t filter;
+    bfp_filter_nlms_s32_init(&filter, weight_buff, history_buff, scratch_buff, M, B, mu, delta);
+
+    TEST_ASSERT_EQUAL(M, filter.tap_count);
+    TEST_ASSERT_EQUAL(B, filter.block_length);
+    TEST_ASSERT_EQUAL(M, filter.weights.length);
+    TEST_ASSERT_EQUAL(31, filter.weights.hr);
+
+    for(unsigned n = 0; n < M-1; n++)
+        input[n] = 0;
+
+    bfp_s32_t x, d, e;
+    x.data = x_data;
+    d.data = d_data;
+    e.data = e_data;
+
+    double err_energy = 0;
+    double d_energy = 0;
+
+    for(unsigned t = 0; t < blocks; t++){
+        PRINTF("\tblock % 4u..\t(seed: 0x%08X)\n", t, seed);
+
+        double* block = &input[(M-1) + t*B];
+        double d_dbl[MAX_BLOCK];
+
+        make_input_block(&x, block, B);
+
+        for(unsigned n = 0; n < B; n++){
+            d_dbl[n] = 0;
+            for(unsigned k = 0; k < M; k++)
+                d_dbl[n] += h[k] * block[(int)n - (int)k];
+        }
+
+        make_desired_block(&d, d_dbl, B);
+
+        if(block_update)
+            bfp_filter_nlms_s32_block(&filter, &e, &x, &d);
+        else
+            bfp_filter_nlms_s32(&filter, &e, &x, &d);
+
+        TEST_ASSERT_EQUAL(B, e.length);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(e.data, B), e.hr);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(filter.weights.data, M), filter.weights.hr);
+
+        // Error energy over the last 10% of the blocks
+        if(t >= blocks - blocks/10){
+            for(unsigned n = 0; n < B; n++){
+                err_energy += pow(ldexp(e.data[n], e.exp), 2);
+                d_energy += pow(d_dbl[n], 2);
+            }
+        }
+    }
+
+    for(unsigned k = 0; k < M; k++){
+        const double w = ldexp(filter.weights.data[k], filter.weights.exp);
+        TEST_ASSERT_MESSAGE(fabs(w - h[k]) <= 1.0e-5 * h_max, "Weight delta is too large");
+    }
+
+    PRINTF("\terror energy: %e dB\n", 10 * log10(err_energy / d_energy));
+    TEST_ASSERT(err_energy < 1.0e-9 * d_energy);
+}
+
+
+static void test_bfp_filter_nlms_s32_sample()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x3A9F51C2;
+
+    const float_s32_t mu = {0x40000000, -31};
+
+    test_system_identification(24, 16, 120, 0, mu);
+    test_system_identification(1, 1, 200, 0, mu);
+    test_system_identification(MAX_TAPS, 5, 400, 0, mu);
+}
+
+
+static void test_bfp_filter_nlms_s32_block()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x7D04E6B9;
+
+    const float_s32_t mu = {0x40000000, -30};
+
+    test_system_identification(24, 16, 1000, 1, mu);
+    test_system_identification(7, 1, 600, 1, mu);
+    test_system_identification(MAX_TAPS, MAX_BLOCK, 2000, 1, mu);
+}
+
+
+static void test_bfp_filter_nlms_s32_initial()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x15C8B273;
+
+    const unsigned M = 16;
+    const unsigned B = 8;
+
+    int32_t weight_buff[MAX_TAPS];
+    int32_t history_buff[MAX_TAPS + MAX_BLOCK - 1];
+    int32_t scratch_buff[MAX_TAPS + MAX_BLOCK];
+    int32_t x_data[MAX_BLOCK];
+    int32_t d_data[MAX_BLOCK];
+    int32_t d_copy[MAX_BLOCK];
+    double x_dbl[MAX_BLOCK];
+
+    const float_s32_t mu = {0x40000000, -31};
+    const float_s32_t delta = {0x40000000, -90};
+
+    for(unsigned block_update = 0; block_update < 2; block_update++){
+
+        bfp_filter_nlms_s32_t filter;
+        bfp_filter_nlms_s32_init(&filter, weight_buff, history_buff, scratch_buff, M, B, mu, delta);
+
+        bfp_s32_t x, d;
+        x.data = x_data;
+        bfp_s32_init(&d, d_data, -30, B, 0);
+
+        make_input_block(&x, x_dbl, B);
+        for(unsigned n = 0; n < B; n++)
+            d_copy[n] = d.data[n] = pseudo_rand_int32(&seed) >> 2;
+        bfp_s32_headroom(&d);
+
+        const exponent_t d_exp = d.exp;
+
+        // With all-zero weights the first output is zero, so the error is the desired signal. In the block mode this is
+        // true of the whole first block. The error is computed in-place.
+        const unsigned exact = block_update? B : 1;
+
+        if(block_update)
+            bfp_filter_nlms_s32_block(&filter, &d, &x, &d);
+        else
+            bfp_filter_nlms_s32(&filter, &d, &x, &d);
+
+        for(unsigned n = 0; n < exact; n++)
+            TEST_ASSERT(ldexp(d_copy[n], d_exp) == ldexp(d.data[n], d.exp));
+
+        TEST_ASSERT(filter.weights.hr < 31);
+    }
+}
+
+
+void test_bfp_filter_nlms()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_filter_nlms_s32_sample);
+    RUN_TEST(test_bfp_filter_nlms_s32_block);
+    RUN_TEST(test_bfp_filter_nlms_s32_initial);
+}
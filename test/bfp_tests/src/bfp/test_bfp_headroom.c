@@ -92,6 +92,7 @@ static void test_bfp_s32_headroom()
         TEST_ASSERT_EQUAL(data, A.data);
         TEST_ASSERT_EQUAL(exponent, A.exp);
         TEST_ASSERT_EQUAL(0, A.hr);
+        TEST_ASSERT_FALSE(A.hr_exact);
 
         headroom_t got_hr = bfp_s32_headroom(&A);
 
@@ -99,6 +100,53 @@ static void test_bfp_s32_headroom()
         TEST_ASSERT_EQUAL(exponent, A.exp);
         TEST_ASSERT_EQUAL(exp_hr, A.hr);
         TEST_ASSERT_EQUAL(exp_hr, got_hr);
+        TEST_ASSERT_TRUE(A.hr_exact);
+    }
+}
+
+
+
+static void test_bfp_s32_headroom_exact()
+{
+    PRINTF("%s...\n", __func__);
+
+    unsigned seed = 0x3E6A90D1;
+    
+    int32_t WORD_ALIGNED data[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep %d..\n", r);
+
+        unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        int shr = pseudo_rand_uint32(&seed) % 10;
+
+        for(int i = 0; i < length; i++)
+            data[i] = pseudo_rand_int32(&seed) >> shr;
+        
+        headroom_t exp_hr = xs3_vect_s32_headroom(data, length);
+
+        bfp_s32_t A;
+
+        // A lower bound gets measured
+        bfp_s32_init(&A, data, 0, length, 0);
+        A.hr = pseudo_rand_uint(&seed, 0, exp_hr+1);
+
+        TEST_ASSERT_EQUAL(exp_hr, bfp_s32_headroom_exact(&A));
+        TEST_ASSERT_EQUAL(exp_hr, A.hr);
+        TEST_ASSERT_TRUE(A.hr_exact);
+
+        // An exact headroom doesn't
+        bfp_s32_init(&A, data, 0, length, 1);
+        data[0] = 0x7FFFFFFF;
+
+        TEST_ASSERT_EQUAL(exp_hr, bfp_s32_headroom_exact(&A));
+        TEST_ASSERT_EQUAL(exp_hr, A.hr);
+
+        // Operations which compute their output's headroom report it as exact
+        A.hr_exact = 0;
+        bfp_s32_shl(&A, &A, 0);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(data, length), A.hr);
+        TEST_ASSERT_TRUE(A.hr_exact);
     }
 }
 
@@ -186,6 +234,7 @@ static void test_bfp_complex_s32_headroom()
         TEST_ASSERT_EQUAL(data, A.data);
         TEST_ASSERT_EQUAL(exponent, A.exp);
         TEST_ASSERT_EQUAL(0, A.hr);
+        TEST_ASSERT_FALSE(A.hr_exact);
 
         headroom_t got_hr = bfp_complex_s32_headroom(&A);
 
@@ -193,6 +242,15 @@ static void test_bfp_complex_s32_headroom()
         TEST_ASSERT_EQUAL(exponent, A.exp);
         TEST_ASSERT_EQUAL(exp_hr, A.hr);
         TEST_ASSERT_EQUAL(exp_hr, got_hr);
+        TEST_ASSERT_TRUE(A.hr_exact);
+
+        // Once the headroom is exact, it isn't measured again
+        data[0].re = 0x7FFFFFFF;
+        TEST_ASSERT_EQUAL(exp_hr, bfp_complex_s32_headroom_exact(&A));
+
+        A.hr_exact = 0;
+        TEST_ASSERT_EQUAL(0, bfp_complex_s32_headroom_exact(&A));
+        TEST_ASSERT_TRUE(A.hr_exact);
     }
 }
 
@@ -294,6 +352,7 @@ void test_bfp_headroom_vect()
 
     RUN_TEST(test_bfp_s16_headroom);
     RUN_TEST(test_bfp_s32_headroom);
+    RUN_TEST(test_bfp_s32_headroom_exact);
     
     RUN_TEST(test_bfp_complex_s16_headroom);
     RUN_TEST(test_bfp_complex_s32_headroom);
@@ -0,0 +1,249 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../tst_common.h"
+
+#include "unity.h"
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+
+#define REPS        1000
+#define MAX_LEN     256
+
+
+static unsigned seed = 666;
+
+
+
+
+static void test_bfp_s16_macc()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x1D8B45A3;
+
+    int16_t dataA[MAX_LEN];
+    int16_t dataB[MAX_LEN];
+    int16_t dataC[MAX_LEN];
+    int16_t expA[MAX_LEN];
+    bfp_s16_t A, B, C;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+
+    double Af[MAX_LEN];
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s16(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s16(&C, MAX_LEN, &seed, &A, B.length);
+        test_random_bfp_s16(&A, MAX_LEN, &seed, NULL, B.length);
+
+        // Half of the time, make the accumulator and the products similar in magnitude
+        if(r & 1)
+            A.exp = B.exp + C.exp + 15 + pseudo_rand_int(&seed, -4, 5);
+
+        test_double_from_s16(Af, &A);
+        test_double_from_s16(Bf, &B);
+        test_double_from_s16(Cf, &C);
+
+        for(int i = 0; i < B.length; i++){
+            Af[i] = Af[i] + Bf[i] * Cf[i];
+        }
+
+        bfp_s16_macc(&A, &B, &C);
+
+        test_s16_from_double(expA, Af, MAX_LEN, A.exp);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s16_headroom(A.data, A.length), A.hr);
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT16_WITHIN(2, expA[i], A.data[i]);
+        }
+    }
+}
+
+
+static void test_bfp_s32_macc()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x8F21C06B;
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    int32_t dataC[MAX_LEN];
+    int32_t expA[MAX_LEN];
+    bfp_s32_t A, B, C;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+
+    double Af[MAX_LEN];
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s32(&C, MAX_LEN, &seed, &A, B.length);
+        test_random_bfp_s32(&A, MAX_LEN, &seed, NULL, B.length);
+
+        if(r & 1)
+            A.exp = B.exp + C.exp + 31 + pseudo_rand_int(&seed, -4, 5);
+
+        test_double_from_s32(Af, &A);
+        test_double_from_s32(Bf, &B);
+        test_double_from_s32(Cf, &C);
+
+        for(int i = 0; i < B.length; i++){
+            Af[i] = Af[i] + Bf[i] * Cf[i];
+        }
+
+        bfp_s32_macc(&A, &B, &C);
+
+        test_s32_from_double(expA, Af, MAX_LEN, A.exp);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(4, expA[i], A.data[i]);
+        }
+    }
+}
+
+
+static void test_bfp_s32_nmacc()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x04E7D259;
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    int32_t dataC[MAX_LEN];
+    int32_t expA[MAX_LEN];
+    bfp_s32_t A, B, C;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+
+    double Af[MAX_LEN];
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s32(&C, MAX_LEN, &seed, &A, B.length);
+        test_random_bfp_s32(&A, MAX_LEN, &seed, NULL, B.length);
+
+        if(r & 1)
+            A.exp = B.exp + C.exp + 31 + pseudo_rand_int(&seed, -4, 5);
+
+        test_double_from_s32(Af, &A);
+        test_double_from_s32(Bf, &B);
+        test_double_from_s32(Cf, &C);
+
+        for(int i = 0; i < B.length; i++){
+            Af[i] = Af[i] - Bf[i] * Cf[i];
+        }
+
+        bfp_s32_nmacc(&A, &B, &C);
+
+        test_s32_from_double(expA, Af, MAX_LEN, A.exp);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(4, expA[i], A.data[i]);
+        }
+    }
+}
+
+
+static void test_bfp_s32_add_scaled()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x6A3F0E97;
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    int32_t dataC[MAX_LEN];
+    int32_t expA[MAX_LEN];
+    bfp_s32_t A, B, C;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+
+    double Af[MAX_LEN];
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s32(&C, MAX_LEN, &seed, &A, B.length);
+
+        float_s32_t alpha = {
+            pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 12),
+            pseudo_rand_int(&seed, -40, 0) };
+
+        if(r & 1)
+            B.exp = C.exp + alpha.exp + 31 + pseudo_rand_int(&seed, -4, 5);
+
+        test_double_from_s32(Bf, &B);
+        test_double_from_s32(Cf, &C);
+
+        for(int i = 0; i < B.length; i++){
+            Af[i] = Bf[i] + Cf[i] * ldexp(alpha.mant, alpha.exp);
+        }
+
+        bfp_s32_add_scaled(&A, &B, &C, alpha);
+
+        test_s32_from_double(expA, Af, MAX_LEN, A.exp);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(4, expA[i], A.data[i]);
+        }
+    }
+}
+
+
+
+
+void test_bfp_macc_vect()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_s16_macc);
+    RUN_TEST(test_bfp_s32_macc);
+    RUN_TEST(test_bfp_s32_nmacc);
+    RUN_TEST(test_bfp_s32_add_scaled);
+}
@@ -0,0 +1,302 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "bfp_math.h"
+
+#include "../tst_common.h"
+
+#include "unity.h"
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+
+#define REPS        1000
+#define MAX_LEN     256
+
+
+static unsigned seed = 666;
+
+
+// Mantissa of x at exponent x_exp, saturated to the symmetric 8-bit range like the VPU
+static int8_t expected_s8(
+    const double x,
+    const exponent_t x_exp)
+{
+    double m = round(ldexp(x, -x_exp));
+    m = MIN(m, VPU_INT8_MAX);
+    m = MAX(m, VPU_INT8_MIN);
+    return (int8_t) m;
+}
+
+
+
+static void test_bfp_s8_headroom_shl()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x7C1E04B9;
+
+    int8_t dataA[MAX_LEN];
+    int8_t dataB[MAX_LEN];
+    bfp_s8_t A, B;
+
+    A.data = dataA;
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s8(&B, MAX_LEN, &seed, &A, 0);
+
+        headroom_t hr = B.hr;
+        TEST_ASSERT_EQUAL(hr, bfp_s8_headroom(&B));
+
+        const left_shift_t shl = pseudo_rand_int(&seed, -3, B.hr + 1);
+
+        bfp_s8_shl(&A, &B, shl);
+
+        TEST_ASSERT_EQUAL(B.exp, A.exp);
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A.data, A.length), A.hr);
+
+        for(int i = 0; i < A.length; i++){
+            int32_t expected = (shl >= 0)? B.data[i] * (1 << shl) : B.data[i] >> -shl;
+            TEST_ASSERT_INT8_WITHIN(1, expected, A.data[i]);
+        }
+    }
+}
+
+
+static void test_bfp_s8_add_sub()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x3B8F6E21;
+
+    int8_t dataA[MAX_LEN];
+    int8_t dataB[MAX_LEN];
+    int8_t dataC[MAX_LEN];
+    bfp_s8_t A, B, C;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s8(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s8(&C, MAX_LEN, &seed, &A, B.length);
+
+        // Keep the exponents close enough that the result isn't dominated by one operand
+        C.exp = B.exp + pseudo_rand_int(&seed, -2, 3);
+
+        test_double_from_s8(Bf, &B);
+        test_double_from_s8(Cf, &C);
+
+        bfp_s8_add(&A, &B, &C);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A.data, A.length), A.hr);
+        for(int i = 0; i < A.length; i++)
+            TEST_ASSERT_INT8_WITHIN(1, expected_s8(Bf[i] + Cf[i], A.exp), A.data[i]);
+
+        bfp_s8_sub(&A, &B, &C);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A.data, A.length), A.hr);
+        for(int i = 0; i < A.length; i++)
+            TEST_ASSERT_INT8_WITHIN(1, expected_s8(Bf[i] - Cf[i], A.exp), A.data[i]);
+    }
+}
+
+
+static void test_bfp_s8_mul()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x0F5CA398;
+
+    int8_t dataA[MAX_LEN];
+    int8_t dataB[MAX_LEN];
+    int8_t dataC[MAX_LEN];
+    bfp_s8_t A, B, C;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s8(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s8(&C, MAX_LEN, &seed, &A, B.length);
+
+        test_double_from_s8(Bf, &B);
+        test_double_from_s8(Cf, &C);
+
+        bfp_s8_mul(&A, &B, &C);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A.data, A.length), A.hr);
+        for(int i = 0; i < A.length; i++)
+            TEST_ASSERT_INT8_WITHIN(2, expected_s8(Bf[i] * Cf[i], A.exp), A.data[i]);
+    }
+}
+
+
+static void test_bfp_s8_scale()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0xA14D7F02;
+
+    int8_t dataA[MAX_LEN];
+    int8_t dataB[MAX_LEN];
+    bfp_s8_t A, B;
+
+    A.data = dataA;
+    B.data = dataB;
+
+    double Bf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s8(&B, MAX_LEN, &seed, &A, 0);
+
+        float_s16_t alpha;
+        alpha.mant = pseudo_rand_int16(&seed) >> pseudo_rand_uint(&seed, 0, 12);
+        alpha.exp = pseudo_rand_int(&seed, -20, 20);
+
+        // Only the top 8 bits of alpha are used
+        const right_shift_t alpha_shr = MAX(0, 8 - HR_S16(alpha.mant));
+        const double alpha_f = ldexp(alpha.mant >> alpha_shr, alpha.exp + alpha_shr);
+
+        test_double_from_s8(Bf, &B);
+
+        bfp_s8_scale(&A, &B, alpha);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A.data, A.length), A.hr);
+        for(int i = 0; i < A.length; i++)
+            TEST_ASSERT_INT8_WITHIN(2, expected_s8(Bf[i] * alpha_f, A.exp), A.data[i]);
+    }
+}
+
+
+static void test_bfp_s8_dot()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x66B02C5D;
+
+    int8_t dataB[MAX_LEN];
+    int8_t dataC[MAX_LEN];
+    bfp_s8_t B, C;
+
+    B.data = dataB;
+    C.data = dataC;
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        test_random_bfp_s8(&B, MAX_LEN, &seed, NULL, 0);
+        test_random_bfp_s8(&C, MAX_LEN, &seed, NULL, B.length);
+
+        int64_t expected = 0;
+        for(int i = 0; i < B.length; i++)
+            expected += ((int32_t)B.data[i]) * C.data[i];
+
+        float_s64_t result = bfp_s8_dot(&B, &C);
+
+        TEST_ASSERT_EQUAL(B.exp + C.exp, result.exp);
+        TEST_ASSERT_EQUAL(expected, result.mant);
+    }
+}
+
+
+static void test_bfp_s8_bitdepth_convert()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x52E9A7C1;
+
+    int8_t dataA8[MAX_LEN];
+    int16_t dataB16[MAX_LEN];
+    int32_t dataB32[MAX_LEN];
+    bfp_s8_t A8;
+    bfp_s16_t B16;
+    bfp_s32_t B32;
+
+    A8.data = dataA8;
+    B16.data = dataB16;
+    B32.data = dataB32;
+
+    double Bf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        PRINTF("\trep % 3d..\t(seed: 0x%08X)\n", r, seed);
+
+        // 16-bit -> 8-bit -> 16-bit
+        test_random_bfp_s16(&B16, MAX_LEN, &seed, NULL, 0);
+        A8.length = B16.length;
+        test_double_from_s16(Bf, &B16);
+
+        bfp_s16_to_s8(&A8, &B16);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A8.data, A8.length), A8.hr);
+        for(int i = 0; i < A8.length; i++)
+            TEST_ASSERT_INT8_WITHIN(1, expected_s8(Bf[i], A8.exp), A8.data[i]);
+
+        bfp_s8_to_s16(&B16, &A8);
+
+        TEST_ASSERT_EQUAL(A8.exp - 8, B16.exp);
+        TEST_ASSERT_EQUAL(xs3_vect_s16_headroom(B16.data, B16.length), B16.hr);
+        for(int i = 0; i < A8.length; i++)
+            TEST_ASSERT_EQUAL(((int16_t)A8.data[i]) * 0x100, B16.data[i]);
+
+        // 32-bit -> 8-bit -> 32-bit
+        test_random_bfp_s32(&B32, MAX_LEN, &seed, NULL, 0);
+        A8.length = B32.length;
+        test_double_from_s32(Bf, &B32);
+
+        bfp_s32_to_s8(&A8, &B32);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A8.data, A8.length), A8.hr);
+        for(int i = 0; i < A8.length; i++)
+            TEST_ASSERT_INT8_WITHIN(1, expected_s8(Bf[i], A8.exp), A8.data[i]);
+
+        bfp_s8_to_s32(&B32, &A8);
+
+        TEST_ASSERT_EQUAL(A8.exp - 24, B32.exp);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(B32.data, B32.length), B32.hr);
+        for(int i = 0; i < A8.length; i++)
+            TEST_ASSERT_EQUAL(((int32_t)A8.data[i]) * 0x1000000, B32.data[i]);
+    }
+}
+
+
+
+
+void test_bfp_s8()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_s8_headroom_shl);
+    RUN_TEST(test_bfp_s8_add_sub);
+    RUN_TEST(test_bfp_s8_mul);
+    RUN_TEST(test_bfp_s8_scale);
+    RUN_TEST(test_bfp_s8_dot);
+    RUN_TEST(test_bfp_s8_bitdepth_convert);
+}
@@ -13,20 +13,24 @@ int main(int argc, char** argv)
     UNITY_BEGIN();
 
     CALL(test_bfp_init_vect);
+    CALL(test_bfp_arena);
     CALL(test_bfp_set_vect);
     CALL(test_bfp_headroom_vect);
     CALL(test_bfp_shl_vect);
     CALL(test_bfp_add_sub_vect);
     CALL(test_bfp_mul_vect);
+    CALL(test_bfp_macc_vect);
     CALL(test_bfp_abs_clip_rect_vect);
     CALL(test_bfp_sum);
     CALL(test_bfp_dot);
     CALL(test_bfp_s32_to_s16);
     CALL(test_bfp_s16_to_s32);
+    CALL(test_bfp_s8);
     CALL(test_bfp_add_vect_complex);
     CALL(test_bfp_sub_vect_complex);
     CALL(test_bfp_mul_vect_complex);
     CALL(test_bfp_complex_mul_vect_complex);
+    CALL(test_bfp_macc_vect_complex);
     CALL(test_bfp_complex_conj_mul_vect_complex);
     CALL(test_bfp_scalar_mul_vect_complex);
     CALL(test_bfp_complex_scal_mul_vect_complex);
@@ -43,5 +47,10 @@ int main(int argc, char** argv)
     CALL(test_bfp_max_min);
     CALL(test_bfp_inverse_vect);
 
+    CALL(test_bfp_filter_nlms);
+    CALL(test_bfp_filter_cic);
+
+    CALL(test_bfp_expr_vect);
+
     return UNITY_END();
 }
@@ -11,6 +11,34 @@
 #include "bfp_math.h"
 
 
+void test_random_bfp_s8(
+    bfp_s8_t* B, 
+    unsigned max_len, 
+    unsigned* seed,
+    bfp_s8_t* A,
+    int length)
+{
+    if(length <= 0){
+        if(max_len != 1)
+            length = (pseudo_rand_uint32(seed) % (max_len-1)) + 1;
+        else
+            length = 1;
+    }
+
+    exponent_t exponent = (pseudo_rand_int32(seed) % 40) - 20;
+
+    int shr = (pseudo_rand_uint32(seed) % 5) + 1;
+
+    for(int i = 0; i < length; i++)
+        B->data[i] = pseudo_rand_int8(seed) >> shr;
+    
+    bfp_s8_init(B, B->data, exponent, length, 1);
+
+    if(A != NULL){
+        A->length = B->length;
+    }
+}
+
 void test_random_bfp_s16(
     bfp_s16_t* B, 
     unsigned max_len, 
@@ -193,6 +221,15 @@ void test_random_bfp_ch_pair_s32(
 
 
 
+void test_double_from_s8(
+    double* d_out,
+    bfp_s8_t* d_in)
+{
+    for(int i = 0; i < d_in->length; i++){
+        d_out[i] = ldexp(d_in->data[i], d_in->exp);
+    }
+}
+
 void test_double_from_s16(
     double* d_out,
     bfp_s16_t* d_in)
@@ -36,6 +36,10 @@
 #define INT16_MIN_NEG(HEADROOM)    (((int16_t)0x8000) >> ((int)(HEADROOM)))
 
 
+#if defined(__XC__) || defined(__cplusplus)
+extern "C" {
+#endif 
+
 int8_t   pseudo_rand_int8(unsigned *r);
 uint8_t  pseudo_rand_uint8(unsigned *r);
 int16_t  pseudo_rand_int16(unsigned *r);
@@ -50,11 +54,12 @@ uint32_t pseudo_rand_uint(unsigned *r, uint32_t min, uint32_t max);
 
 void pseudo_rand_bytes(unsigned *r, char* buffer, unsigned size);
 
-#if defined(__XC__) || defined(__CPLUSPLUS__)
-extern "C" {
-#endif 
-
-
+void test_random_bfp_s8(
+    bfp_s8_t* B, 
+    unsigned max_len, 
+    unsigned* seed,
+    bfp_s8_t* A,
+    int length);
 
 void test_random_bfp_s16(
     bfp_s16_t* B, 
@@ -94,6 +99,9 @@ void test_random_bfp_ch_pair_s32(
     bfp_ch_pair_s32_t* A,
     int length);
 
+void test_double_from_s8(
+    double* d_out,
+    bfp_s8_t* d_in);
 void test_double_from_s16(
     double* d_out,
     bfp_s16_t* d_in);
@@ -137,7 +145,7 @@ void test_complex_s32_from_double(
     unsigned length,
     exponent_t use_exp);
 
-#if defined(__XC__) || defined(__CPLUSPLUS__)
+#if defined(__XC__) || defined(__cplusplus)
 }   // extern "C"
 #endif
 
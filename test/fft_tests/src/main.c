@@ -25,8 +25,16 @@ int main(int argc, char** argv)
     test_xs3_fft_mono_adjust();
     test_xs3_fft_dit();
     test_xs3_fft_dif();
+    test_xs3_fft_twiddle_layout();
+    test_xs3_fft_s16();
+    test_xs3_fft_mixed();
+    test_xs3_filter_fir_block();
 
     test_bfp_fft();
+    test_bfp_stft();
+    test_bfp_filter_ols();
+    test_bfp_filter_partitioned();
+    test_bfp_filter_fdaf();
 
 #if WRITE_PERFORMANCE_INFO
     fclose(perf_file);
@@ -11,14 +11,19 @@
 #include "tst_common.h"
 #include "fft.h"
 #include "unity.h"
+#include "../src/vect/xs3_fft_lut.h"
 
+#include <math.h>
+#include <string.h>
 
-#define MAX_PROC_FRAME_LENGTH_LOG2 10
+
+#define MAX_PROC_FRAME_LENGTH_LOG2 (MAX_DIT_FFT_LOG2)
 #define MAX_PROC_FRAME_LENGTH (1<<MAX_PROC_FRAME_LENGTH_LOG2)
 
 #define EXPONENT_SIZE 5
 #define MAX_HEADROOM 5
 #define WIGGLE 20
+#define WIGGLE_S16 2
 
 #define MIN_FFT_N_LOG2  (2)
 
@@ -77,7 +82,7 @@ void test_bfp_fft_forward_complex()
             unsigned diff = abs_diff_vect_complex_s32(A.data, A.exp, ref, FFT_N, &error);
             if(diff > worst_error) worst_error = diff;
             TEST_ASSERT_CONVERSION(error);
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
         }
         
 #if PRINT_ERRORS
@@ -151,7 +156,7 @@ void test_bfp_fft_inverse_complex()
             unsigned diff = abs_diff_vect_complex_s32(A.data, A.exp, ref, FFT_N, &error);
             if(diff > worst_error) worst_error = diff;
             TEST_ASSERT_CONVERSION(error);
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
         }
         
 #if PRINT_ERRORS
@@ -228,7 +233,7 @@ void test_bfp_fft_forward_stereo()
             unsigned diff = abs_diff_vect_complex_s32((complex_s32_t*) A.data, A.exp, ref, FFT_N, &error);
             if(diff > worst_error) worst_error = diff;
 
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
             TEST_ASSERT_CONVERSION(error);
         }
         
@@ -307,7 +312,7 @@ void test_bfp_fft_inverse_stereo()
 
             unsigned diff = abs_diff_vect_complex_s32((complex_s32_t*) AB.data, AB.exp, ref, FFT_N, &error);
             if(diff > worst_error) worst_error = diff;
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
             TEST_ASSERT_CONVERSION(error);
         }
         
@@ -383,10 +388,18 @@ void test_bfp_fft_forward_mono()
             float timing = (ts2-ts1)/100.0;
             if(timing > worst_timing) worst_timing = timing;
 
+            // With lazy headroom, the spectrum's headroom is only a lower bound
+#if (XS3_BFP_LAZY_HEADROOM)
+            TEST_ASSERT_FALSE(A_fft->hr_exact);
+            TEST_ASSERT(A_fft->hr <= xs3_vect_complex_s32_headroom(A_fft->data, A_fft->length));
+#else
+            TEST_ASSERT_TRUE(A_fft->hr_exact);
+            TEST_ASSERT_EQUAL(xs3_vect_complex_s32_headroom(A_fft->data, A_fft->length), A_fft->hr);
+#endif
 
             unsigned diff = abs_diff_vect_complex_s32(A_fft->data, A_fft->exp, ref, A_fft->length, &error);
             if(diff > worst_error) worst_error = diff;
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
             TEST_ASSERT_CONVERSION(error);
         }
         
@@ -467,12 +480,620 @@ void test_bfp_fft_inverse_mono()
             float timing = (ts2-ts1)/100.0;
             if(timing > worst_timing) worst_timing = timing;
 
+            TEST_ASSERT_TRUE(A->hr_exact);
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A->data, A->length), A->hr);
+
             for(int i = 0; i < N; i++)
                 ref_real[i] = ref[i].re;
 
             unsigned diff = abs_diff_vect_s32(A->data, A->exp, ref_real, N, &error);
             if(diff > worst_error) worst_error = diff;
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
+            TEST_ASSERT_CONVERSION(error);
+        }
+        
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", __func__, FFT_N, worst_error);
+#endif
+
+#if TIME_FUNCS
+        printf("    %s (%u-point): %f us\n", __func__, FFT_N, worst_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "%s, %u, %u, %0.02f,\n", &(__func__[5]), FFT_N, worst_error, worst_timing);
+#endif
+    }
+}
+
+/*
+ * Benchmark of a typical spectral processing chain with and without lazy headroom (XS3_BFP_LAZY_HEADROOM).
+ *
+ * A real frame goes through a forward FFT, a multiplication by a fixed spectrum and an inverse FFT. Without lazy 
+ * headroom, the forward FFT reports the exact headroom of its spectrum, which on xcore costs a pass over the spectrum
+ * at the end of the mono adjustment. The reported figures are the time per frame of the whole chain in the mode the
+ * library was built with, and the time that headroom pass takes, which is what lazy headroom saves.
+ */
+#define MONO_LAZY_BENCH_FRAMES  (8)
+
+void test_bfp_fft_mono_lazy_headroom()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x1B7C3E95;
+
+    for(unsigned k = 4; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        const unsigned FFT_N = (1<<k);
+
+        int32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+        complex_s32_t DWORD_ALIGNED h_data[MAX_PROC_FRAME_LENGTH/2];
+
+        for(unsigned i = 0; i < FFT_N/2; i++){
+            h_data[i].re = pseudo_rand_int32(&r) >> 1;
+            h_data[i].im = pseudo_rand_int32(&r) >> 1;
+        }
+
+        bfp_complex_s32_t H;
+        bfp_complex_s32_init(&H, h_data, -31, FFT_N/2, 1);
+
+        unsigned chain_time = 0;
+        unsigned pass_time = 0;
+
+        for(unsigned t = 0; t < MONO_LAZY_BENCH_FRAMES; t++){
+            const headroom_t a_hr = pseudo_rand_uint32(&r) % 8;
+            for(unsigned i = 0; i < FFT_N; i++)
+                a[i] = pseudo_rand_int32(&r) >> a_hr;
+
+            bfp_s32_t A;
+            bfp_s32_init(&A, a, -31, FFT_N, 1);
+
+            unsigned ts1 = getTimestamp();
+            bfp_complex_s32_t* X = bfp_fft_forward_mono(&A);
+            bfp_complex_s32_mul(X, X, &H);
+            bfp_s32_t* y = bfp_fft_inverse_mono(X);
+            unsigned ts2 = getTimestamp();
+            chain_time += ts2 - ts1;
+
+            // The output's headroom is never over-reported
+            TEST_ASSERT(y->hr <= xs3_vect_s32_headroom(y->data, FFT_N));
+
+            ts1 = getTimestamp();
+            xs3_vect_complex_s32_headroom((complex_s32_t*) a, FFT_N/2);
+            ts2 = getTimestamp();
+            pass_time += ts2 - ts1;
+        }
+
+        const float chain_timing = chain_time/100.0 / MONO_LAZY_BENCH_FRAMES;
+        const float pass_timing = pass_time/100.0 / MONO_LAZY_BENCH_FRAMES;
+
+#if TIME_FUNCS
+        printf("    N=%u: %f us/frame (lazy headroom: %d), headroom pass %f us/frame\n",
+               FFT_N, chain_timing, XS3_BFP_LAZY_HEADROOM, pass_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "bfp_fft mono chain (lazy headroom: %d), %u,, %0.02f,\n",
+                XS3_BFP_LAZY_HEADROOM, FFT_N, chain_timing);
+        fprintf(perf_file, "bfp_fft mono chain headroom pass, %u,, %0.02f,\n", FFT_N, pass_timing);
+#endif
+    }
+}
+
+
+
+void test_bfp_fft_forward_complex_s16()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x7D0C3E91;
+
+    for(unsigned k = MIN_FFT_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+        unsigned FFT_N = (1<<k);
+        unsigned worst_error = 0;
+        float worst_timing = 0.0f;
+
+        double sine_table[(MAX_PROC_FRAME_LENGTH/2) + 1];
+
+        flt_make_sine_table_double(sine_table, FFT_N);
+        
+        for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){ 
+
+            int16_t a_real[MAX_PROC_FRAME_LENGTH];
+            int16_t a_imag[MAX_PROC_FRAME_LENGTH];
+            complex_s16_t a[MAX_PROC_FRAME_LENGTH];
+
+            bfp_complex_s16_t A;
+
+            complex_double_t DWORD_ALIGNED ref[MAX_PROC_FRAME_LENGTH];
+
+            conv_error_e error = 0;
+            const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % MAX_HEADROOM;
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                a_real[i] = pseudo_rand_int16(&r) >> shr;
+                a_imag[i] = pseudo_rand_int16(&r) >> shr;
+                ref[i].re = conv_s16_to_double(a_real[i], initial_exponent, &error);
+                ref[i].im = conv_s16_to_double(a_imag[i], initial_exponent, &error);
+            }
+            TEST_ASSERT_CONVERSION(error);
+
+            bfp_complex_s16_init(&A, a_real, a_imag, initial_exponent, FFT_N, 1);
+
+            flt_bit_reverse_indexes_double(ref, FFT_N);
+            flt_fft_forward_double(ref, FFT_N, sine_table);
+
+            unsigned ts1 = getTimestamp();
+            bfp_fft_forward_complex_s16(&A);
+            unsigned ts2 = getTimestamp();
+
+            float timing = (ts2-ts1)/100.0;
+            if(timing > worst_timing) worst_timing = timing;
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                a[i].re = A.real[i];
+                a[i].im = A.imag[i];
+            }
+
+            unsigned diff = abs_diff_vect_complex_s16(a, A.exp, ref, FFT_N, &error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_CONVERSION(error);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(2*k+WIGGLE_S16, k), diff, "Output delta is too large");
+            TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s16_headroom(A.real, A.imag, FFT_N), A.hr, "Reported headroom was incorrect.");
+        }
+        
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", __func__, FFT_N, worst_error);
+#endif
+
+#if TIME_FUNCS
+        printf("    %s (%u-point): %f us\n", __func__, FFT_N, worst_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "%s, %u, %u, %0.02f,\n", &(__func__[5]), FFT_N, worst_error, worst_timing);
+#endif
+    }
+}
+
+
+
+
+void test_bfp_fft_inverse_complex_s16()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x16E2A05B;
+
+    for(unsigned k = MIN_FFT_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+        unsigned FFT_N = (1<<k);
+        unsigned worst_error = 0;
+        float worst_timing = 0.0f;
+
+        double sine_table[(MAX_PROC_FRAME_LENGTH/2) + 1];
+
+        flt_make_sine_table_double(sine_table, FFT_N);
+        
+        for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){ 
+
+            int16_t a_real[MAX_PROC_FRAME_LENGTH];
+            int16_t a_imag[MAX_PROC_FRAME_LENGTH];
+            complex_s16_t a[MAX_PROC_FRAME_LENGTH];
+
+            bfp_complex_s16_t A;
+
+            complex_double_t DWORD_ALIGNED ref[MAX_PROC_FRAME_LENGTH];
+
+            conv_error_e error = 0;
+            const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % MAX_HEADROOM;
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                a_real[i] = pseudo_rand_int16(&r) >> shr;
+                a_imag[i] = pseudo_rand_int16(&r) >> shr;
+                ref[i].re = conv_s16_to_double(a_real[i], initial_exponent, &error);
+                ref[i].im = conv_s16_to_double(a_imag[i], initial_exponent, &error);
+            }
+            TEST_ASSERT_CONVERSION(error);
+
+            bfp_complex_s16_init(&A, a_real, a_imag, initial_exponent, FFT_N, 1);
+
+            flt_bit_reverse_indexes_double(ref, FFT_N);
+            flt_fft_inverse_double(ref, FFT_N, sine_table);
+
+            unsigned ts1 = getTimestamp();
+            bfp_fft_inverse_complex_s16(&A);
+            unsigned ts2 = getTimestamp();
+
+            float timing = (ts2-ts1)/100.0;
+            if(timing > worst_timing) worst_timing = timing;
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                a[i].re = A.real[i];
+                a[i].im = A.imag[i];
+            }
+
+            unsigned diff = abs_diff_vect_complex_s16(a, A.exp, ref, FFT_N, &error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_CONVERSION(error);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(2*k+WIGGLE_S16, k), diff, "Output delta is too large");
+            TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s16_headroom(A.real, A.imag, FFT_N), A.hr, "Reported headroom was incorrect.");
+        }
+        
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", __func__, FFT_N, worst_error);
+#endif
+
+#if TIME_FUNCS
+        printf("    %s (%u-point): %f us\n", __func__, FFT_N, worst_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "%s, %u, %u, %0.02f,\n", &(__func__[5]), FFT_N, worst_error, worst_timing);
+#endif
+    }
+}
+
+
+
+
+void test_bfp_fft_forward_mono_s16()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x4B19F27C;
+
+    for(unsigned k = MAX(MIN_FFT_N_LOG2, 4); k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        unsigned FFT_N = (1<<k);
+        unsigned worst_error = 0;
+        float worst_timing = 0.0f;
+
+        double sine_table[(MAX_PROC_FRAME_LENGTH/2) + 1];
+
+        flt_make_sine_table_double(sine_table, FFT_N);
+        
+        for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+        
+            int16_t a[MAX_PROC_FRAME_LENGTH];
+            complex_s16_t b[MAX_PROC_FRAME_LENGTH/2];
+            complex_double_t DWORD_ALIGNED ref[MAX_PROC_FRAME_LENGTH];
+
+            bfp_s16_t A;
+            bfp_complex_s16_t A_fft;
+
+            conv_error_e error = 0;
+            const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % MAX_HEADROOM;
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                a[i] = pseudo_rand_int16(&r) >> shr;
+                
+                ref[i].re = conv_s16_to_double(a[i], initial_exponent, &error);
+                ref[i].im = 0;
+            }
+            TEST_ASSERT_CONVERSION(error);
+
+            bfp_s16_init(&A, a, initial_exponent, FFT_N, 1);
+
+            flt_bit_reverse_indexes_double(ref, FFT_N);
+            flt_fft_forward_double(ref, FFT_N, sine_table);
+            ref[0].im = ref[FFT_N/2].re;
+
+            unsigned ts1 = getTimestamp();
+            bfp_fft_forward_mono_s16(&A_fft, &A);
+            unsigned ts2 = getTimestamp();
+            
+            float timing = (ts2-ts1)/100.0;
+            if(timing > worst_timing) worst_timing = timing;
+
+            TEST_ASSERT_EQUAL_PTR(&a[0], A_fft.real);
+            TEST_ASSERT_EQUAL_PTR(&a[FFT_N/2], A_fft.imag);
+            TEST_ASSERT_EQUAL(FFT_N/2, A_fft.length);
+
+            for(unsigned i = 0; i < FFT_N/2; i++){
+                b[i].re = A_fft.real[i];
+                b[i].im = A_fft.imag[i];
+            }
+
+            unsigned diff = abs_diff_vect_complex_s16(b, A_fft.exp, ref, FFT_N/2, &error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(2*k+WIGGLE_S16, k), diff, "Output delta is too large");
+            TEST_ASSERT_CONVERSION(error);
+            TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_s16_headroom(a, FFT_N), A_fft.hr, "Reported headroom was incorrect.");
+        }
+        
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", __func__, FFT_N, worst_error);
+#endif
+
+#if TIME_FUNCS
+        printf("    %s (%u-point): %f us\n", __func__, FFT_N, worst_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "%s, %u, %u, %0.02f,\n", &(__func__[5]), FFT_N, worst_error, worst_timing);
+#endif
+    }
+}
+
+
+
+
+void test_bfp_fft_inverse_mono_s16()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x39A6D0E5;
+
+    for(unsigned k = MAX(MIN_FFT_N_LOG2, 4); k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        unsigned FFT_N = (1<<k);
+        unsigned N = FFT_N;
+        unsigned worst_error = 0;
+        float worst_timing = 0.0f;
+
+        double sine_table[(MAX_PROC_FRAME_LENGTH/2) + 1];
+
+        flt_make_sine_table_double(sine_table, FFT_N);
+        
+        for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+            
+            int16_t a[MAX_PROC_FRAME_LENGTH];
+            complex_double_t DWORD_ALIGNED ref[MAX_PROC_FRAME_LENGTH];
+            double DWORD_ALIGNED ref_real[MAX_PROC_FRAME_LENGTH];
+
+            bfp_complex_s16_t A_fft;
+            bfp_s16_t A;
+
+            conv_error_e error = 0;
+            const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % MAX_HEADROOM;
+
+            for(unsigned i = 0; i < N/2; i++){
+                a[i] = pseudo_rand_int16(&r) >> shr;
+                a[N/2+i] = pseudo_rand_int16(&r) >> shr;
+                
+                ref[i].re = conv_s16_to_double(a[i], initial_exponent, &error);
+                ref[i].im = conv_s16_to_double(a[N/2+i], initial_exponent, &error);
+
+                if(i){
+                    ref[N-i].re =  ref[i].re;
+                    ref[N-i].im = -ref[i].im;
+                }
+            }
+            TEST_ASSERT_CONVERSION(error);
+            ref[N/2].re = ref[0].im;
+            ref[N/2].im = ref[0].im = 0;
+
+            bfp_complex_s16_init(&A_fft, &a[0], &a[N/2], initial_exponent, N/2, 1);
+
+            flt_bit_reverse_indexes_double(ref, FFT_N);
+            flt_fft_inverse_double(ref, FFT_N, sine_table);
+
+            unsigned ts1 = getTimestamp();
+            bfp_fft_inverse_mono_s16(&A, &A_fft);
+            unsigned ts2 = getTimestamp();
+            
+            float timing = (ts2-ts1)/100.0;
+            if(timing > worst_timing) worst_timing = timing;
+
+            TEST_ASSERT_EQUAL_PTR(a, A.data);
+            TEST_ASSERT_EQUAL(N, A.length);
+
+            for(int i = 0; i < N; i++)
+                ref_real[i] = ref[i].re;
+
+            unsigned diff = abs_diff_vect_s16(A.data, A.exp, ref_real, N, &error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(2*k+WIGGLE_S16, k), diff, "Output delta is too large");
+            TEST_ASSERT_CONVERSION(error);
+            TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_s16_headroom(A.data, N), A.hr, "Reported headroom was incorrect.");
+        }
+        
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", __func__, FFT_N, worst_error);
+#endif
+
+#if TIME_FUNCS
+        printf("    %s (%u-point): %f us\n", __func__, FFT_N, worst_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "%s, %u, %u, %0.02f,\n", &(__func__[5]), FFT_N, worst_error, worst_timing);
+#endif
+    }
+}
+
+
+
+// Mixed-radix lengths for the real FFTs (N/2 must be a supported mixed-radix length)
+static const unsigned mono_mixed_lengths[] = { 12, 20, 60, 120, 240, 480, 960 };
+
+#define MONO_MIXED_LOOPS_LOG2  (3)
+
+// Direct DFT of a real sequence, since the floating-point FFTs only handle power-of-2 lengths
+static void dft_real_double(
+    complex_double_t X[],
+    const double x[],
+    const unsigned N)
+{
+    for(unsigned f = 0; f < N; f++){
+        X[f].re = 0;
+        X[f].im = 0;
+        for(unsigned n = 0; n < N; n++){
+            const double theta = -2 * M_PI * ((f * n) % N) / N;
+            X[f].re += x[n] * cos(theta);
+            X[f].im += x[n] * sin(theta);
+        }
+    }
+}
+
+void test_bfp_fft_forward_mono_mixed()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x3B9E02D1;
+
+    for(unsigned j = 0; j < sizeof(mono_mixed_lengths)/sizeof(mono_mixed_lengths[0]); j++){
+
+        const unsigned FFT_N = mono_mixed_lengths[j];
+        const unsigned k = ceil_log2(FFT_N);
+        unsigned worst_error = 0;
+        float worst_timing = 0.0f;
+
+        if(FFT_N > MAX_PROC_FRAME_LENGTH)
+            continue;
+        
+        for(unsigned t = 0; t < (1<<MONO_MIXED_LOOPS_LOG2); t++){
+        
+            int32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+            double DWORD_ALIGNED ref_in[MAX_PROC_FRAME_LENGTH];
+            complex_double_t DWORD_ALIGNED ref[MAX_PROC_FRAME_LENGTH];
+
+            bfp_s32_t A;
+            bfp_complex_s32_t* A_fft;
+
+            conv_error_e error = 0;
+            const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % MAX_HEADROOM;
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                a[i] = pseudo_rand_int32(&r) >> shr;
+                ref_in[i] = conv_s32_to_double(a[i], initial_exponent, &error);
+            }
+            TEST_ASSERT_FALSE_MESSAGE(error, "Conversion error");
+
+            bfp_s32_init(&A, a, initial_exponent, FFT_N, 1);
+
+            dft_real_double(ref, ref_in, FFT_N);
+            ref[0].im = ref[FFT_N/2].re;
+
+            unsigned ts1 = getTimestamp();
+            A_fft = bfp_fft_forward_mono_mixed(&A);
+            unsigned ts2 = getTimestamp();
+            
+            float timing = (ts2-ts1)/100.0;
+            if(timing > worst_timing) worst_timing = timing;
+
+            TEST_ASSERT_EQUAL(FFT_N/2, A_fft->length);
+            TEST_ASSERT_EQUAL(xs3_vect_complex_s32_headroom(A_fft->data, A_fft->length), A_fft->hr);
+
+            unsigned diff = abs_diff_vect_complex_s32(A_fft->data, A_fft->exp, ref, A_fft->length, &error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(2*k+WIGGLE_S16, k), diff, "Output delta is too large");
+            TEST_ASSERT_CONVERSION(error);
+        }
+        
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", __func__, FFT_N, worst_error);
+#endif
+
+#if TIME_FUNCS
+        printf("    %s (%u-point): %f us\n", __func__, FFT_N, worst_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "%s, %u, %u, %0.02f,\n", &(__func__[5]), FFT_N, worst_error, worst_timing);
+#endif
+    }
+}
+
+
+
+
+void test_bfp_fft_inverse_mono_mixed()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x70C5A64E;
+
+    for(unsigned j = 0; j < sizeof(mono_mixed_lengths)/sizeof(mono_mixed_lengths[0]); j++){
+
+        const unsigned FFT_N = mono_mixed_lengths[j];
+        const unsigned k = ceil_log2(FFT_N);
+        unsigned worst_error = 0;
+        float worst_timing = 0.0f;
+
+        if(FFT_N > MAX_PROC_FRAME_LENGTH)
+            continue;
+        
+        for(unsigned t = 0; t < (1<<MONO_MIXED_LOOPS_LOG2); t++){
+            
+            int32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+            double DWORD_ALIGNED ref[MAX_PROC_FRAME_LENGTH];
+            complex_double_t DWORD_ALIGNED ref_fft[MAX_PROC_FRAME_LENGTH];
+
+            bfp_s32_t B;
+            bfp_complex_s32_t A_fft;
+            bfp_s32_t* A;
+
+            conv_error_e error = 0;
+            const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % MAX_HEADROOM;
+
+            // Build a valid (Hermitian) spectrum by transforming a real signal
+            for(unsigned i = 0; i < FFT_N; i++){
+                a[i] = pseudo_rand_int32(&r) >> shr;
+                ref[i] = conv_s32_to_double(a[i], initial_exponent, &error);
+            }
+            TEST_ASSERT_FALSE_MESSAGE(error, "Conversion error");
+
+            bfp_s32_init(&B, a, initial_exponent, FFT_N, 1);
+            bfp_fft_forward_mono_mixed(&B);
+
+            // The reference for the inverse is the spectrum as actually presented to it
+            for(unsigned i = 0; i < FFT_N/2; i++){
+                const complex_s32_t* X = (const complex_s32_t*) a;
+                ref_fft[i].re = ldexp(X[i].re, B.exp);
+                ref_fft[i].im = ldexp(X[i].im, B.exp);
+                if(i){
+                    ref_fft[FFT_N-i].re =  ref_fft[i].re;
+                    ref_fft[FFT_N-i].im = -ref_fft[i].im;
+                }
+            }
+            ref_fft[FFT_N/2].re = ref_fft[0].im;
+            ref_fft[FFT_N/2].im = ref_fft[0].im = 0;
+
+            for(unsigned n = 0; n < FFT_N; n++){
+                ref[n] = 0;
+                for(unsigned f = 0; f < FFT_N; f++){
+                    const double theta = 2 * M_PI * ((f * n) % FFT_N) / FFT_N;
+                    ref[n] += ref_fft[f].re * cos(theta) - ref_fft[f].im * sin(theta);
+                }
+                ref[n] /= FFT_N;
+            }
+
+            bfp_complex_s32_init(&A_fft, (complex_s32_t*) a, B.exp, FFT_N/2, 1);
+
+            unsigned ts1 = getTimestamp();
+            A = bfp_fft_inverse_mono_mixed(&A_fft);
+            unsigned ts2 = getTimestamp();
+            
+            float timing = (ts2-ts1)/100.0;
+            if(timing > worst_timing) worst_timing = timing;
+
+            TEST_ASSERT_EQUAL(FFT_N, A->length);
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A->data, A->length), A->hr);
+
+            unsigned diff = abs_diff_vect_s32(A->data, A->exp, ref, FFT_N, &error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(2*k+WIGGLE_S16, k), diff, "Output delta is too large");
             TEST_ASSERT_CONVERSION(error);
         }
         
@@ -490,6 +1111,100 @@ void test_bfp_fft_inverse_mono()
     }
 }
 
+
+
+void test_bfp_fft_plan()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x1F6C3B85;
+
+    for(unsigned k = MAX(MIN_FFT_N_LOG2, 4); k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        const unsigned FFT_N = (1<<k);
+        unsigned worst_error = 0;
+
+        uint16_t bitrev_buff[MAX_PROC_FRAME_LENGTH];
+        uint16_t bitrev_buff_mono[MAX_PROC_FRAME_LENGTH/2];
+        bfp_fft_plan_t plan, plan_mono;
+
+        bfp_fft_plan_init(&plan, bitrev_buff, FFT_N);
+        bfp_fft_plan_init(&plan_mono, bitrev_buff_mono, FFT_N/2);
+
+        TEST_ASSERT_EQUAL(FFT_N, plan.length);
+        TEST_ASSERT_EQUAL_PTR(bitrev_buff, plan.bitrev);
+        
+        for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+
+            complex_s32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+            complex_s32_t DWORD_ALIGNED b[MAX_PROC_FRAME_LENGTH];
+            double DWORD_ALIGNED ref[MAX_PROC_FRAME_LENGTH];
+
+            bfp_complex_s32_t A, B;
+            bfp_s32_t C, D;
+
+            conv_error_e error = 0;
+            const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % MAX_HEADROOM;
+
+            rand_vect_complex_s32(a, FFT_N, shr, &r);
+            memcpy(b, a, sizeof(a));
+
+            // Forward and inverse complex FFTs with a plan are identical to those without
+            bfp_complex_s32_init(&A, a, initial_exponent, FFT_N, 1);
+            bfp_complex_s32_init(&B, b, initial_exponent, FFT_N, 1);
+
+            bfp_fft_forward_complex(&A);
+            bfp_fft_forward_complex_plan(&plan, &B);
+
+            TEST_ASSERT_EQUAL(A.exp, B.exp);
+            TEST_ASSERT_EQUAL(A.hr, B.hr);
+            TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) a, (int32_t*) b, 2*FFT_N);
+
+            bfp_fft_inverse_complex(&A);
+            bfp_fft_inverse_complex_plan(&plan, &B);
+
+            TEST_ASSERT_EQUAL(A.exp, B.exp);
+            TEST_ASSERT_EQUAL(A.hr, B.hr);
+            TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) a, (int32_t*) b, 2*FFT_N);
+
+            // Real forward FFT with a plan is identical to that without
+            bfp_s32_init(&C, (int32_t*) a, initial_exponent, FFT_N, 1);
+            bfp_s32_init(&D, (int32_t*) b, initial_exponent, FFT_N, 1);
+
+            bfp_complex_s32_t* C_fft = bfp_fft_forward_mono(&C);
+            bfp_complex_s32_t* D_fft = bfp_fft_forward_mono_plan(&plan_mono, &D);
+
+            TEST_ASSERT_EQUAL(FFT_N/2, D_fft->length);
+            TEST_ASSERT_EQUAL(C_fft->exp, D_fft->exp);
+            TEST_ASSERT_EQUAL(C_fft->hr, D_fft->hr);
+            TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) a, (int32_t*) b, FFT_N);
+
+            // The real inverse FFT with a plan also measures the headroom after the mono adjustment, so the two 
+            // results may differ by rounding
+            bfp_s32_t* C_ifft = bfp_fft_inverse_mono(C_fft);
+            bfp_s32_t* D_ifft = bfp_fft_inverse_mono_plan(&plan_mono, D_fft);
+
+            TEST_ASSERT_EQUAL(FFT_N, D_ifft->length);
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(D_ifft->data, FFT_N), D_ifft->hr);
+
+            for(unsigned i = 0; i < FFT_N; i++)
+                ref[i] = ldexp(C_ifft->data[i], C_ifft->exp);
+
+            unsigned diff = abs_diff_vect_s32(D_ifft->data, D_ifft->exp, ref, FFT_N, &error);
+            TEST_ASSERT_CONVERSION(error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
+        }
+
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", __func__, FFT_N, worst_error);
+#endif
+    }
+}
+
 void test_bfp_fft()
 {
     SET_TEST_FILE();
@@ -502,5 +1217,17 @@ void test_bfp_fft()
     
     RUN_TEST(test_bfp_fft_forward_mono);
     RUN_TEST(test_bfp_fft_inverse_mono);
+    RUN_TEST(test_bfp_fft_mono_lazy_headroom);
+
+    RUN_TEST(test_bfp_fft_plan);
+
+    RUN_TEST(test_bfp_fft_forward_complex_s16);
+    RUN_TEST(test_bfp_fft_inverse_complex_s16);
+
+    RUN_TEST(test_bfp_fft_forward_mono_s16);
+    RUN_TEST(test_bfp_fft_inverse_mono_s16);
+
+    RUN_TEST(test_bfp_fft_forward_mono_mixed);
+    RUN_TEST(test_bfp_fft_inverse_mono_mixed);
 
 }
@@ -0,0 +1,308 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <xs1.h>
+#include <xclib.h>
+
+#include "bfp_math.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity.h"
+#include "../src/vect/xs3_fft_lut.h"
+
+#include <math.h>
+#include <string.h>
+
+
+#define MAX_PROC_FRAME_LENGTH_LOG2 (MAX_DIT_FFT_LOG2)
+#define MAX_PROC_FRAME_LENGTH (1<<MAX_PROC_FRAME_LENGTH_LOG2)
+
+#define FDAF_MAX_TAPS       (256)
+#define FDAF_MAX_B          (MIN(64, MAX_PROC_FRAME_LENGTH/2))
+#define FDAF_MAX_P          (16)
+#define FDAF_MAX_SAMPLES    (FDAF_MAX_TAPS + 200 * FDAF_MAX_B)
+
+
+static const struct {
+    unsigned taps;
+    unsigned block_length;
+    unsigned blocks;
+    unsigned constrained;
+    // Error energy over the last 10% of the blocks, relative to the desired energy
+    double max_error;
+    // Weight error relative to the largest tap (if constrained)
+    double max_weight_delta;
+} fdaf_configs[] = {
+    {    1,    8,   50,  1,  1.0e-9,  1.0e-5 },
+    {   32,   16,  100,  1,  1.0e-9,  1.0e-5 },
+    {  100,   16,  200,  1,  1.0e-9,  1.0e-5 },
+    {  256,   64,  150,  1,  1.0e-9,  1.0e-5 },
+    // The unconstrained filter converges to a biased solution
+    {   32,   16,  200,  0,  1.0e-2,  0      },
+    {  100,   16,  200,  0,  1.0e-2,  0      },
+};
+
+#define FDAF_CONFIG_COUNT   (sizeof(fdaf_configs)/sizeof(fdaf_configs[0]))
+
+
+static int32_t DWORD_ALIGNED weight_buff[FDAF_MAX_P * 2 * FDAF_MAX_B];
+static int32_t DWORD_ALIGNED fdl_buff[FDAF_MAX_P * 2 * FDAF_MAX_B];
+static int32_t DWORD_ALIGNED acc_buff[2 * FDAF_MAX_B];
+static int32_t DWORD_ALIGNED product_buff[2 * FDAF_MAX_B];
+static int32_t history_buff[FDAF_MAX_B];
+static int32_t power_buff[FDAF_MAX_B + 1];
+static int32_t step_buff[FDAF_MAX_B + 1];
+static bfp_complex_s32_t weight_parts[FDAF_MAX_P];
+static bfp_complex_s32_t fdl_parts[FDAF_MAX_P];
+
+
+/*
+    Fill x with B random samples with a random exponent and headroom, and put their values in x_dbl[].
+*/
+static void make_input_block(
+    bfp_s32_t* x,
+    double x_dbl[],
+    const unsigned B,
+    unsigned* r)
+{
+    bfp_s32_init(x, x->data, -31 + (pseudo_rand_uint32(r) % 4), B, 0);
+    const headroom_t x_hr = pseudo_rand_uint32(r) % 4;
+    for(unsigned n = 0; n < B; n++){
+        x->data[n] = pseudo_rand_int32(r) >> x_hr;
+        x_dbl[n] = ldexp(x->data[n], x->exp);
+    }
+    x->hr = xs3_vect_s32_headroom(x->data, B);
+}
+
+
+/*
+    Quantize the B values of d_dbl[] into d, with the smallest exponent which fits them all.
+*/
+static void make_desired_block(
+    bfp_s32_t* d,
+    const double d_dbl[],
+    const unsigned B)
+{
+    double max = 0;
+    for(unsigned n = 0; n < B; n++)
+        max = fmax(max, fabs(d_dbl[n]));
+
+    int e;
+    frexp(max, &e);
+
+    bfp_s32_init(d, d->data, e - 30, B, 0);
+    for(unsigned n = 0; n < B; n++)
+        d->data[n] = (int32_t) round(ldexp(d_dbl[n], -d->exp));
+    d->hr = xs3_vect_s32_headroom(d->data, B);
+}
+
+
+void test_bfp_filter_fdaf_s32()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x5E21C7A4;
+
+    const float_s32_t mu = {0x40000000, -30};
+    const float_s32_t beta = {0x73333333, -31};
+    const float_s32_t delta = {0x40000000, -90};
+
+    for(unsigned i = 0; i < FDAF_CONFIG_COUNT; i++){
+
+        const unsigned M = fdaf_configs[i].taps;
+        const unsigned B = fdaf_configs[i].block_length;
+        const unsigned N = 2*B;
+        const unsigned P = (M + B - 1) / B;
+        const unsigned blocks = fdaf_configs[i].blocks;
+
+        if(B > FDAF_MAX_B)
+            continue;
+
+        TEST_ASSERT(P <= FDAF_MAX_P);
+        TEST_ASSERT((M-1) + blocks * B <= FDAF_MAX_SAMPLES);
+
+        // All input samples (as doubles), with the M-1 samples before time 0 being zero
+        static double input[FDAF_MAX_SAMPLES];
+        double h[FDAF_MAX_TAPS];
+        double h_max = 0;
+
+        // An unknown system with a decaying impulse response, identified from its input and output
+        for(unsigned k = 0; k < M; k++){
+            h[k] = ldexp(pseudo_rand_int32(&r), -31) * pow(0.98, k);
+            h_max = fmax(h_max, fabs(h[k]));
+        }
+
+        bfp_filter_fdaf_s32_t fdaf;
+        bfp_filter_fdaf_s32_init(&fdaf, weight_parts, weight_buff, fdl_parts, fdl_buff, acc_buff, product_buff,
+                                 history_buff, power_buff, step_buff, M, B, mu, beta, delta,
+                                 fdaf_configs[i].constrained);
+
+        TEST_ASSERT_EQUAL(M, fdaf.tap_count);
+        TEST_ASSERT_EQUAL(B, fdaf.filter.block_length);
+        TEST_ASSERT_EQUAL(P, fdaf.filter.partition_count);
+        TEST_ASSERT_EQUAL(B+1, fdaf.power.length);
+        for(unsigned p = 0; p < P; p++){
+            TEST_ASSERT_EQUAL(N/2, fdaf.filter.coef[p].length);
+            TEST_ASSERT_EQUAL(31, fdaf.filter.coef[p].hr);
+        }
+
+        for(unsigned n = 0; n < M-1; n++)
+            input[n] = 0;
+
+        double err_energy = 0;
+        double d_energy = 0;
+
+        for(unsigned t = 0; t < blocks; t++){
+
+            int32_t x_data[FDAF_MAX_B];
+            int32_t d_data[FDAF_MAX_B];
+            double d_dbl[FDAF_MAX_B];
+            bfp_s32_t x, d;
+
+            double* block = &input[(M-1) + t*B];
+
+            x.data = x_data;
+            make_input_block(&x, block, B, &r);
+
+            for(unsigned n = 0; n < B; n++){
+                d_dbl[n] = 0;
+                for(unsigned k = 0; k < M; k++)
+                    d_dbl[n] += h[k] * block[(int)n - (int)k];
+            }
+
+            d.data = d_data;
+            make_desired_block(&d, d_dbl, B);
+
+            // The error is computed in-place
+            bfp_filter_fdaf_s32(&fdaf, &d, &x, &d);
+
+            TEST_ASSERT_EQUAL(B, d.length);
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(d.data, B), d.hr);
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(fdaf.power.data, B+1), fdaf.power.hr);
+            // With lazy headroom, the weights' headroom may only be a lower bound
+            for(unsigned p = 0; p < P; p++){
+                const headroom_t coef_hr = xs3_vect_complex_s32_headroom(fdaf.filter.coef[p].data, B);
+                TEST_ASSERT(fdaf.filter.coef[p].hr_exact || XS3_BFP_LAZY_HEADROOM);
+                TEST_ASSERT(fdaf.filter.coef[p].hr <= coef_hr);
+                if(fdaf.filter.coef[p].hr_exact)
+                    TEST_ASSERT_EQUAL(coef_hr, fdaf.filter.coef[p].hr);
+            }
+
+            // Error energy over the last 10% of the blocks
+            if(t >= blocks - blocks/10){
+                for(unsigned n = 0; n < B; n++){
+                    err_energy += pow(ldexp(d.data[n], d.exp), 2);
+                    d_energy += pow(d_dbl[n], 2);
+                }
+            }
+        }
+
+#if PRINT_ERRORS
+        printf("    %s error energy (M=%u, B=%u, P=%u, constrained=%u): %f dB\n", __func__, M, B, P,
+               fdaf_configs[i].constrained, 10 * log10(err_energy / d_energy));
+#endif
+
+        TEST_ASSERT_MESSAGE(err_energy < fdaf_configs[i].max_error * d_energy, "Error energy is too large");
+
+        if(!fdaf_configs[i].constrained)
+            continue;
+
+        // The constrained filter's weights are the impulse response, in the first B samples of each partition's IDFT
+        for(unsigned p = 0; p < P; p++){
+            int32_t DWORD_ALIGNED part_data[2 * FDAF_MAX_B];
+            bfp_complex_s32_t W = fdaf.filter.coef[p];
+            memcpy(part_data, W.data, N * sizeof(int32_t));
+            W.data = (complex_s32_t*) part_data;
+
+            bfp_s32_t* w = bfp_fft_inverse_mono(&W);
+
+            for(unsigned k = 0; k < N; k++){
+                const double expected = (k < B && p*B + k < M)? h[p*B + k] : 0;
+                TEST_ASSERT_MESSAGE(fabs(ldexp(w->data[k], w->exp) - expected)
+                                        <= fdaf_configs[i].max_weight_delta * h_max, "Weight delta is too large");
+            }
+        }
+    }
+}
+
+
+void test_bfp_filter_fdaf_s32_initial()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x903B6E1F;
+
+    const unsigned M = 40;
+    const unsigned B = MIN(16, FDAF_MAX_B);
+    const unsigned P = (M + B - 1) / B;
+
+    const float_s32_t mu = {0x40000000, -31};
+    const float_s32_t beta = {0x73333333, -31};
+    const float_s32_t delta = {0x40000000, -90};
+
+    for(unsigned constrained = 0; constrained < 2; constrained++){
+
+        bfp_filter_fdaf_s32_t fdaf;
+        bfp_filter_fdaf_s32_init(&fdaf, weight_parts, weight_buff, fdl_parts, fdl_buff, acc_buff, product_buff,
+                                 history_buff, power_buff, step_buff, M, B, mu, beta, delta, constrained);
+
+        int32_t x_data[FDAF_MAX_B];
+        int32_t d_data[FDAF_MAX_B];
+        int32_t e_data[FDAF_MAX_B];
+        double x_dbl[FDAF_MAX_B];
+        double d_dbl[FDAF_MAX_B];
+        bfp_s32_t x, d, e;
+
+        // A silent block leaves the filter untouched
+        bfp_s32_init(&x, x_data, -31, B, 0);
+        memset(x_data, 0, sizeof(x_data));
+        x.hr = 31;
+        bfp_s32_init(&d, d_data, -31, B, 0);
+        memset(d_data, 0, sizeof(d_data));
+        d.hr = 31;
+        e.data = e_data;
+
+        bfp_filter_fdaf_s32(&fdaf, &e, &x, &d);
+
+        TEST_ASSERT_EQUAL(B, e.length);
+        TEST_ASSERT_EQUAL(31, e.hr);
+        TEST_ASSERT_EQUAL(31, fdaf.power.hr);
+        for(unsigned p = 0; p < P; p++)
+            TEST_ASSERT_EQUAL(31, fdaf.filter.coef[p].hr);
+
+        // With all-zero weights the output is zero, so the error is the desired signal
+        x.data = x_data;
+        make_input_block(&x, x_dbl, B, &r);
+        for(unsigned n = 0; n < B; n++)
+            d_dbl[n] = ldexp(pseudo_rand_int32(&r) >> 2, -30);
+        d.data = d_data;
+        make_desired_block(&d, d_dbl, B);
+
+        bfp_filter_fdaf_s32(&fdaf, &e, &x, &d);
+
+        conv_error_e error = 0;
+        unsigned diff = abs_diff_vect_s32(e.data, e.exp, d_dbl, B, &error);
+        TEST_ASSERT_CONVERSION(error);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(1, diff, "Error delta is too large");
+
+        // Only the first partition sees the input, so only it adapts
+        TEST_ASSERT(fdaf.power.hr < 31);
+        TEST_ASSERT(fdaf.filter.coef[0].hr < 31);
+        for(unsigned p = 1; p < P; p++)
+            TEST_ASSERT_EQUAL(31, fdaf.filter.coef[p].hr);
+    }
+}
+
+
+void test_bfp_filter_fdaf()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_filter_fdaf_s32);
+    RUN_TEST(test_bfp_filter_fdaf_s32_initial);
+}
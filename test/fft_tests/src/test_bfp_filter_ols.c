@@ -0,0 +1,365 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <xs1.h>
+#include <xclib.h>
+
+#include "bfp_math.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity.h"
+#include "../src/vect/xs3_fft_lut.h"
+
+#include <math.h>
+#include <string.h>
+
+
+#define MAX_PROC_FRAME_LENGTH_LOG2 (MAX_DIT_FFT_LOG2)
+#define MAX_PROC_FRAME_LENGTH (1<<MAX_PROC_FRAME_LENGTH_LOG2)
+
+#define OLS_MAX_N       (MIN(1024, MAX_PROC_FRAME_LENGTH))
+#define OLS_BLOCKS      (12)
+
+// Output error bound (in LSbs at the output exponent)
+#define OLS_ERROR_BOUND (32)
+
+
+static const struct {
+    unsigned taps;
+    unsigned frame_length;
+    unsigned block_length;
+} ols_configs[] = {
+    {    1,   16,   16 },
+    {    9,   16,    8 },
+    {   32,   64,   33 },
+    {   48,   64,   16 },
+    {  100,  256,  157 },
+    {  256,  512,  257 },
+    {  513, 1024,  512 },
+};
+
+#define OLS_CONFIG_COUNT   (sizeof(ols_configs)/sizeof(ols_configs[0]))
+
+
+void test_bfp_filter_ols_s32()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x7C2E9A41;
+
+    for(unsigned i = 0; i < OLS_CONFIG_COUNT; i++){
+
+        const unsigned M = ols_configs[i].taps;
+        const unsigned N = ols_configs[i].frame_length;
+        const unsigned B = ols_configs[i].block_length;
+
+        if(N > OLS_MAX_N)
+            continue;
+
+        static int32_t DWORD_ALIGNED coef_buff[OLS_MAX_N];
+        static int32_t DWORD_ALIGNED frame_buff[OLS_MAX_N];
+        static int32_t history_buff[OLS_MAX_N];
+        static int32_t coef_data[OLS_MAX_N];
+
+        // All input samples (as doubles), with the M-1 samples before time 0 being zero
+        static double input[OLS_MAX_N + OLS_BLOCKS * OLS_MAX_N];
+        static double coef_dbl[OLS_MAX_N];
+
+        bfp_s32_t coef;
+        bfp_s32_init(&coef, coef_data, sext(pseudo_rand_int32(&r), 4) - 30, M, 0);
+        for(unsigned k = 0; k < M; k++)
+            coef.data[k] = pseudo_rand_int32(&r) >> (pseudo_rand_uint32(&r) % 4);
+        coef.hr = xs3_vect_s32_headroom(coef.data, M);
+
+        for(unsigned k = 0; k < M; k++)
+            coef_dbl[k] = ldexp(coef.data[k], coef.exp);
+
+        bfp_filter_ols_s32_t filter;
+        bfp_filter_ols_s32_init(&filter, coef_buff, frame_buff, history_buff, &coef, N, B);
+
+        TEST_ASSERT_EQUAL(N, filter.frame_length);
+        TEST_ASSERT_EQUAL(B, filter.block_length);
+        TEST_ASSERT_EQUAL(N/2, filter.coef.length);
+
+        for(unsigned n = 0; n < M-1; n++)
+            input[n] = 0;
+
+        unsigned worst_error = 0;
+
+        for(unsigned t = 0; t < OLS_BLOCKS; t++){
+
+            int32_t x_data[OLS_MAX_N];
+            int32_t y_data[OLS_MAX_N];
+            double expected[OLS_MAX_N];
+            bfp_s32_t x, y;
+
+            // Each block gets its own exponent and headroom
+            bfp_s32_init(&x, x_data, -31 + (pseudo_rand_uint32(&r) % 4), B, 0);
+            const headroom_t x_hr = pseudo_rand_uint32(&r) % 4;
+            for(unsigned n = 0; n < B; n++)
+                x.data[n] = pseudo_rand_int32(&r) >> x_hr;
+            x.hr = xs3_vect_s32_headroom(x.data, B);
+
+            double* block = &input[(M-1) + t*B];
+            for(unsigned n = 0; n < B; n++)
+                block[n] = ldexp(x.data[n], x.exp);
+
+            for(unsigned n = 0; n < B; n++){
+                expected[n] = 0;
+                for(unsigned k = 0; k < M; k++)
+                    expected[n] += coef_dbl[k] * block[(int)n - (int)k];
+            }
+
+            y.data = y_data;
+            bfp_filter_ols_s32(&filter, &y, &x);
+
+            TEST_ASSERT_EQUAL(B, y.length);
+            // With lazy headroom, y.hr may only be a lower bound
+            TEST_ASSERT(y.hr_exact || XS3_BFP_LAZY_HEADROOM);
+            TEST_ASSERT(y.hr <= xs3_vect_s32_headroom(y.data, B));
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(y.data, B), bfp_s32_headroom_exact(&y));
+
+            conv_error_e error = 0;
+            unsigned diff = abs_diff_vect_s32(y.data, y.exp, expected, B, &error);
+            TEST_ASSERT_CONVERSION(error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(OLS_ERROR_BOUND, diff, "Output delta is too large");
+        }
+
+#if PRINT_ERRORS
+        printf("    %s worst error (M=%u, N=%u, B=%u): %u\n", __func__, M, N, B, worst_error);
+#endif
+    }
+}
+
+
+void test_bfp_filter_ols_s32_in_place()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x2D5B0C93;
+
+    // An impulse response which is a pure delay of D samples
+    const unsigned N = MIN(64, OLS_MAX_N);
+    const unsigned M = N/4;
+    const unsigned B = N - M + 1;
+    const unsigned D = M - 1;
+
+    int32_t DWORD_ALIGNED coef_buff[OLS_MAX_N];
+    int32_t DWORD_ALIGNED frame_buff[OLS_MAX_N];
+    int32_t history_buff[OLS_MAX_N];
+    int32_t coef_data[OLS_MAX_N] = {0};
+
+    bfp_s32_t coef;
+    coef_data[D] = 0x40000000;
+    bfp_s32_init(&coef, coef_data, -30, M, 1);
+
+    bfp_filter_ols_s32_t filter;
+    bfp_filter_ols_s32_init(&filter, coef_buff, frame_buff, history_buff, &coef, N, B);
+
+    // The last D samples of the previous block
+    int32_t prev[OLS_MAX_N] = {0};
+
+    for(unsigned t = 0; t < 6; t++){
+        int32_t data[OLS_MAX_N];
+        int32_t block[OLS_MAX_N];
+        bfp_s32_t x;
+
+        for(unsigned n = 0; n < B; n++)
+            block[n] = data[n] = pseudo_rand_int32(&r) >> 1;
+        bfp_s32_init(&x, data, -31, B, 1);
+
+        bfp_filter_ols_s32(&filter, &x, &x);
+
+        double expected[OLS_MAX_N];
+        for(unsigned n = 0; n < B; n++)
+            expected[n] = ldexp((n < D)? prev[n] : block[n - D], -31);
+
+        conv_error_e error = 0;
+        unsigned diff = abs_diff_vect_s32(x.data, x.exp, expected, B, &error);
+        TEST_ASSERT_CONVERSION(error);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(OLS_ERROR_BOUND, diff, "Output delta is too large");
+
+        for(unsigned n = 0; n < D; n++)
+            prev[n] = block[B - D + n];
+    }
+}
+
+
+/*
+ * Crossover benchmark of the overlap-save filter against the direct-form FIR filter.
+ *
+ * For each tap count M, the overlap-save filter is run with N = 2M and B = M+1, and the direct-form filter
+ * xs3_filter_fir_s32() is run on the same coefficients. The reported figures are the time per output sample of each. The
+ * direct form's cost grows linearly with M, while the overlap-save filter's grows only logarithmically, so the tap
+ * count at which the two rows cross over is the point above which the overlap-save filter should be preferred.
+ */
+#define OLS_BENCH_MIN_TAPS  (16)
+#define OLS_BENCH_MAX_TAPS  (MIN(2048, MAX_PROC_FRAME_LENGTH/2))
+#define OLS_BENCH_FIR_SAMPLES   (32)
+
+void test_bfp_filter_ols_s32_crossover()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x1F0C3B57;
+
+    for(unsigned M = OLS_BENCH_MIN_TAPS; M <= OLS_BENCH_MAX_TAPS; M <<= 1){
+
+        const unsigned N = 2*M;
+        const unsigned B = M + 1;
+
+        static int32_t DWORD_ALIGNED coef_buff[MAX_PROC_FRAME_LENGTH];
+        static int32_t DWORD_ALIGNED frame_buff[MAX_PROC_FRAME_LENGTH];
+        static int32_t history_buff[MAX_PROC_FRAME_LENGTH];
+        static int32_t fir_state[MAX_PROC_FRAME_LENGTH] = {0};
+        static int32_t coef_data[MAX_PROC_FRAME_LENGTH];
+        static int32_t x_data[MAX_PROC_FRAME_LENGTH];
+        static int32_t y_data[MAX_PROC_FRAME_LENGTH];
+
+        for(unsigned k = 0; k < M; k++)
+            coef_data[k] = pseudo_rand_int32(&r) >> 8;
+        for(unsigned n = 0; n < B; n++)
+            x_data[n] = pseudo_rand_int32(&r) >> 1;
+
+        bfp_s32_t coef, x, y;
+        bfp_s32_init(&coef, coef_data, -31, M, 1);
+        bfp_s32_init(&x, x_data, -31, B, 1);
+        y.data = y_data;
+
+        bfp_filter_ols_s32_t ols;
+        bfp_filter_ols_s32_init(&ols, coef_buff, frame_buff, history_buff, &coef, N, B);
+
+        xs3_filter_fir_s32_t fir;
+        xs3_filter_fir_s32_init(&fir, fir_state, M, coef_data, 0);
+
+        unsigned ts1 = getTimestamp();
+        bfp_filter_ols_s32(&ols, &y, &x);
+        unsigned ts2 = getTimestamp();
+
+        const float ols_timing = (ts2-ts1)/100.0 / B;
+
+        ts1 = getTimestamp();
+        for(unsigned n = 0; n < OLS_BENCH_FIR_SAMPLES; n++)
+            y_data[n] = xs3_filter_fir_s32(&fir, x_data[n]);
+        ts2 = getTimestamp();
+
+        const float fir_timing = (ts2-ts1)/100.0 / OLS_BENCH_FIR_SAMPLES;
+
+#if TIME_FUNCS
+        printf("    %u taps: direct %f us/sample, overlap-save %f us/sample (N=%u, B=%u)\n",
+               M, fir_timing, ols_timing, N, B);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "xs3_filter_fir_s32 (per sample), %u,, %0.02f,\n", M, fir_timing);
+        fprintf(perf_file, "bfp_filter_ols_s32 (per sample), %u,, %0.02f, N=%u B=%u\n", M, ols_timing, N, B);
+#endif
+    }
+}
+
+
+/*
+ * Benchmark of the overlap-save filter's processing chain with and without lazy headroom (XS3_BFP_LAZY_HEADROOM).
+ *
+ * Each block goes through the frame load, a forward FFT, the spectrum product, an inverse FFT and the extraction of the
+ * output block. Without lazy headroom, the history (when the block length differs from the history length) and the
+ * output block each need a pass just to measure their headroom. The reported figures are the time per block of the
+ * whole chain in the mode the library was built with, and the time those headroom passes take, which is what lazy
+ * headroom saves.
+ */
+#define OLS_LAZY_BENCH_BLOCKS   (8)
+
+void test_bfp_filter_ols_s32_lazy_headroom()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x5C2E8A41;
+
+    for(unsigned i = 0; i < OLS_CONFIG_COUNT; i++){
+
+        const unsigned M = ols_configs[i].taps;
+        const unsigned N = ols_configs[i].frame_length;
+        const unsigned B = ols_configs[i].block_length;
+        const unsigned L = N - B;
+
+        if(N > MAX_PROC_FRAME_LENGTH)
+            continue;
+
+        static int32_t DWORD_ALIGNED coef_buff[MAX_PROC_FRAME_LENGTH];
+        static int32_t DWORD_ALIGNED frame_buff[MAX_PROC_FRAME_LENGTH];
+        static int32_t history_buff[MAX_PROC_FRAME_LENGTH];
+        static int32_t coef_data[MAX_PROC_FRAME_LENGTH];
+        static int32_t x_data[MAX_PROC_FRAME_LENGTH];
+        static int32_t y_data[MAX_PROC_FRAME_LENGTH];
+
+        for(unsigned k = 0; k < M; k++)
+            coef_data[k] = pseudo_rand_int32(&r) >> 8;
+
+        bfp_s32_t coef, x, y;
+        bfp_s32_init(&coef, coef_data, -31, M, 1);
+        y.data = y_data;
+
+        bfp_filter_ols_s32_t ols;
+        bfp_filter_ols_s32_init(&ols, coef_buff, frame_buff, history_buff, &coef, N, B);
+
+        unsigned chain_time = 0;
+        unsigned pass_time = 0;
+
+        for(unsigned t = 0; t < OLS_LAZY_BENCH_BLOCKS; t++){
+            const headroom_t x_hr = pseudo_rand_uint32(&r) % 8;
+            for(unsigned n = 0; n < B; n++)
+                x_data[n] = pseudo_rand_int32(&r) >> x_hr;
+            bfp_s32_init(&x, x_data, -31, B, 1);
+
+            unsigned ts1 = getTimestamp();
+            bfp_filter_ols_s32(&ols, &y, &x);
+            unsigned ts2 = getTimestamp();
+            chain_time += ts2 - ts1;
+
+            // The output's headroom is never over-reported
+            TEST_ASSERT(y.hr <= xs3_vect_s32_headroom(y.data, B));
+
+            ts1 = getTimestamp();
+            if(B != L)
+                xs3_vect_s32_headroom(history_buff, L);
+            xs3_vect_s32_headroom(y.data, B);
+            ts2 = getTimestamp();
+            pass_time += ts2 - ts1;
+        }
+
+        const float chain_timing = chain_time/100.0 / OLS_LAZY_BENCH_BLOCKS;
+        const float pass_timing = pass_time/100.0 / OLS_LAZY_BENCH_BLOCKS;
+
+#if TIME_FUNCS
+        printf("    N=%u, B=%u: %f us/block (lazy headroom: %d), headroom passes %f us/block\n",
+               N, B, chain_timing, XS3_BFP_LAZY_HEADROOM, pass_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "bfp_filter_ols_s32 (lazy headroom: %d), %u,, %0.02f, B=%u\n",
+                XS3_BFP_LAZY_HEADROOM, N, chain_timing, B);
+        fprintf(perf_file, "bfp_filter_ols_s32 headroom passes, %u,, %0.02f, B=%u\n", N, pass_timing, B);
+#endif
+    }
+}
+
+
+void test_bfp_filter_ols()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_filter_ols_s32);
+    RUN_TEST(test_bfp_filter_ols_s32_in_place);
+    RUN_TEST(test_bfp_filter_ols_s32_crossover);
+    RUN_TEST(test_bfp_filter_ols_s32_lazy_headroom);
+}
@@ -0,0 +1,158 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <xs1.h>
+#include <xclib.h>
+
+#include "bfp_math.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity.h"
+#include "../src/vect/xs3_fft_lut.h"
+
+#include <math.h>
+#include <string.h>
+
+
+#define MAX_PROC_FRAME_LENGTH_LOG2 (MAX_DIT_FFT_LOG2)
+#define MAX_PROC_FRAME_LENGTH (1<<MAX_PROC_FRAME_LENGTH_LOG2)
+
+#define UPC_MAX_TAPS        (2048)
+#define UPC_MAX_B           (MIN(256, MAX_PROC_FRAME_LENGTH/2))
+#define UPC_MAX_P           (64)
+#define UPC_EXTRA_BLOCKS    (4)
+#define UPC_MAX_SAMPLES     (4608)
+
+// Output error bound (in LSbs at the output exponent) for P partitions. Each partition product adds its own rounding
+// error to the accumulator.
+// A lazy (lower bound) spectrum headroom can cost the products a bit of precision
+#define UPC_ERROR_BOUND(P)  ((32 + 2*(P)) << (XS3_BFP_LAZY_HEADROOM? 1 : 0))
+
+
+static const struct {
+    unsigned taps;
+    unsigned block_length;
+} upc_configs[] = {
+    {    1,    8 },
+    {   37,    8 },
+    {  100,   16 },
+    {  513,   64 },
+    { 2000,   32 },
+    { 1024,  256 },
+};
+
+#define UPC_CONFIG_COUNT   (sizeof(upc_configs)/sizeof(upc_configs[0]))
+
+
+void test_bfp_filter_partitioned_s32()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x4B19E3D6;
+
+    for(unsigned i = 0; i < UPC_CONFIG_COUNT; i++){
+
+        const unsigned M = upc_configs[i].taps;
+        const unsigned B = upc_configs[i].block_length;
+        const unsigned N = 2*B;
+        const unsigned P = (M + B - 1) / B;
+        const unsigned blocks = P + UPC_EXTRA_BLOCKS;
+
+        if(B > UPC_MAX_B)
+            continue;
+
+        TEST_ASSERT(P <= UPC_MAX_P);
+        TEST_ASSERT((M-1) + blocks * B <= UPC_MAX_SAMPLES);
+
+        static bfp_complex_s32_t coef_parts[UPC_MAX_P];
+        static bfp_complex_s32_t fdl_parts[UPC_MAX_P];
+        static int32_t DWORD_ALIGNED coef_buff[UPC_MAX_P * 2 * UPC_MAX_B];
+        static int32_t DWORD_ALIGNED fdl_buff[UPC_MAX_P * 2 * UPC_MAX_B];
+        static int32_t DWORD_ALIGNED acc_buff[2 * UPC_MAX_B];
+        static int32_t history_buff[UPC_MAX_B];
+        static int32_t coef_data[UPC_MAX_TAPS];
+
+        // All input samples (as doubles), with the M-1 samples before time 0 being zero
+        static double input[UPC_MAX_SAMPLES];
+        static double coef_dbl[UPC_MAX_TAPS];
+
+        // A decaying impulse response, so later partitions have smaller exponents
+        bfp_s32_t coef;
+        bfp_s32_init(&coef, coef_data, sext(pseudo_rand_int32(&r), 4) - 30, M, 0);
+        for(unsigned k = 0; k < M; k++)
+            coef.data[k] = pseudo_rand_int32(&r) >> (1 + (pseudo_rand_uint32(&r) % 4) + (k / 256));
+        coef.hr = xs3_vect_s32_headroom(coef.data, M);
+
+        for(unsigned k = 0; k < M; k++)
+            coef_dbl[k] = ldexp(coef.data[k], coef.exp);
+
+        bfp_filter_partitioned_s32_t filter;
+        bfp_filter_partitioned_s32_init(&filter, coef_parts, coef_buff, fdl_parts, fdl_buff, acc_buff, history_buff,
+                                        &coef, B);
+
+        TEST_ASSERT_EQUAL(B, filter.block_length);
+        TEST_ASSERT_EQUAL(P, filter.partition_count);
+        for(unsigned p = 0; p < P; p++)
+            TEST_ASSERT_EQUAL(N/2, filter.coef[p].length);
+
+        for(unsigned n = 0; n < M-1; n++)
+            input[n] = 0;
+
+        unsigned worst_error = 0;
+
+        for(unsigned t = 0; t < blocks; t++){
+
+            int32_t x_data[UPC_MAX_B];
+            int32_t y_data[UPC_MAX_B];
+            double expected[UPC_MAX_B];
+            bfp_s32_t x, y;
+
+            // Each block gets its own exponent and headroom. The first block is silent.
+            bfp_s32_init(&x, x_data, -31 + (pseudo_rand_uint32(&r) % 4), B, 0);
+            const headroom_t x_hr = pseudo_rand_uint32(&r) % 4;
+            for(unsigned n = 0; n < B; n++)
+                x.data[n] = (t == 0)? 0 : pseudo_rand_int32(&r) >> x_hr;
+            x.hr = xs3_vect_s32_headroom(x.data, B);
+
+            double* block = &input[(M-1) + t*B];
+            for(unsigned n = 0; n < B; n++)
+                block[n] = ldexp(x.data[n], x.exp);
+
+            for(unsigned n = 0; n < B; n++){
+                expected[n] = 0;
+                for(unsigned k = 0; k < M; k++)
+                    expected[n] += coef_dbl[k] * block[(int)n - (int)k];
+            }
+
+            y.data = y_data;
+            bfp_filter_partitioned_s32(&filter, &y, &x);
+
+            TEST_ASSERT_EQUAL(B, y.length);
+            // With lazy headroom, y.hr may only be a lower bound
+            TEST_ASSERT(y.hr_exact || XS3_BFP_LAZY_HEADROOM);
+            TEST_ASSERT(y.hr <= xs3_vect_s32_headroom(y.data, B));
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(y.data, B), bfp_s32_headroom_exact(&y));
+
+            conv_error_e error = 0;
+            unsigned diff = abs_diff_vect_s32(y.data, y.exp, expected, B, &error);
+            TEST_ASSERT_CONVERSION(error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(UPC_ERROR_BOUND(P), diff, "Output delta is too large");
+        }
+
+#if PRINT_ERRORS
+        printf("    %s worst error (M=%u, B=%u, P=%u): %u\n", __func__, M, B, P, worst_error);
+#endif
+    }
+}
+
+
+void test_bfp_filter_partitioned()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_filter_partitioned_s32);
+}
@@ -0,0 +1,200 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <xs1.h>
+#include <xclib.h>
+
+#include "bfp_math.h"
+#include "testing.h"
+#include "floating_fft.h"
+#include "tst_common.h"
+#include "unity.h"
+#include "../src/vect/xs3_fft_lut.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+
+#define MAX_PROC_FRAME_LENGTH_LOG2 (MAX_DIT_FFT_LOG2)
+#define MAX_PROC_FRAME_LENGTH (1<<MAX_PROC_FRAME_LENGTH_LOG2)
+
+#define STFT_MAX_N      (MIN(512, MAX_PROC_FRAME_LENGTH))
+#define STFT_FRAMES     (24)
+
+// Round trip error bound (in LSbs at the sample exponent)
+#define STFT_ERROR_BOUND    (32)
+
+
+static const struct {
+    unsigned frame_length;
+    unsigned hop;
+} stft_configs[] = {
+    {  16,   8 },
+    {  64,  32 },
+    { 256, 128 },
+    { 256,  64 },
+    { 512, 128 },
+};
+
+#define STFT_CONFIG_COUNT   (sizeof(stft_configs)/sizeof(stft_configs[0]))
+
+
+// Square root of a periodic Hann window, scaled so that the product of analysis and synthesis windows satisfies the
+// constant overlap-add condition for the given hop.
+static void make_sqrt_hann_window(
+    int32_t window[],
+    double window_dbl[],
+    const unsigned N,
+    const unsigned hop)
+{
+    const double scale = sqrt(2.0 * hop / N);
+    for(unsigned n = 0; n < N; n++){
+        window_dbl[n] = scale * sqrt(0.5 - 0.5 * cos(2 * M_PI * n / N));
+        window[n] = (int32_t) round(ldexp(window_dbl[n], 30));
+    }
+}
+
+
+void test_bfp_stft_round_trip()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x51D3A7E2;
+
+    for(unsigned i = 0; i < STFT_CONFIG_COUNT; i++){
+
+        const unsigned N = stft_configs[i].frame_length;
+        const unsigned H = stft_configs[i].hop;
+        const unsigned L = N - H;
+
+        if(N > STFT_MAX_N)
+            continue;
+
+        int32_t DWORD_ALIGNED frame_buff[STFT_MAX_N];
+        int32_t history_buff[STFT_MAX_N];
+        int32_t overlap_buff[STFT_MAX_N];
+        int32_t window[STFT_MAX_N];
+        double window_dbl[STFT_MAX_N];
+        double sine_table[(STFT_MAX_N/2) + 1];
+
+        // All input samples, with the L samples before time 0 being zero
+        static int32_t input[STFT_MAX_N + STFT_FRAMES * STFT_MAX_N];
+
+        make_sqrt_hann_window(window, window_dbl, N, H);
+        flt_make_sine_table_double(sine_table, N);
+
+        const exponent_t sample_exp = sext(pseudo_rand_int32(&r), 5) - 31;
+
+        bfp_stft_t stft;
+        bfp_stft_init(&stft, frame_buff, history_buff, overlap_buff, window, window, N, H, sample_exp);
+
+        TEST_ASSERT_EQUAL(N, stft.frame_length);
+        TEST_ASSERT_EQUAL(H, stft.hop);
+
+        for(unsigned n = 0; n < L; n++)
+            input[n] = 0;
+
+        unsigned worst_error = 0;
+        unsigned worst_spec_error = 0;
+
+        for(unsigned t = 0; t < STFT_FRAMES; t++){
+
+            int32_t* block = &input[L + t*H];
+            int32_t output[STFT_MAX_N];
+
+            for(unsigned n = 0; n < H; n++)
+                block[n] = pseudo_rand_int32(&r) >> 2;
+
+            // The spectrum should be the DFT of the windowed frame
+            complex_double_t ref[STFT_MAX_N];
+            conv_error_e error = 0;
+
+            for(unsigned n = 0; n < N; n++){
+                ref[n].re = ldexp(input[t*H + n], sample_exp) * window_dbl[n];
+                ref[n].im = 0;
+            }
+            flt_bit_reverse_indexes_double(ref, N);
+            flt_fft_forward_double(ref, N, sine_table);
+            ref[0].im = ref[N/2].re;
+
+            bfp_complex_s32_t* X = bfp_stft_forward(&stft, block);
+
+            TEST_ASSERT_EQUAL(N/2, X->length);
+
+            unsigned spec_diff = abs_diff_vect_complex_s32(X->data, X->exp, ref, N/2, &error);
+            TEST_ASSERT_CONVERSION(error);
+            if(spec_diff > worst_spec_error) worst_spec_error = spec_diff;
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(STFT_ERROR_BOUND, spec_diff, "Spectrum delta is too large");
+
+            bfp_stft_inverse(&stft, output, X);
+
+            // Output is the input delayed by L samples
+            for(unsigned n = 0; n < H; n++){
+                const int32_t expected = input[t*H + n];
+                const unsigned diff = abs(output[n] - expected);
+                if(diff > worst_error) worst_error = diff;
+                TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(STFT_ERROR_BOUND, diff, "Output delta is too large");
+            }
+        }
+
+#if PRINT_ERRORS
+        printf("    %s worst error (N=%u, H=%u): %u (spectrum: %u)\n", __func__, N, H, worst_error, worst_spec_error);
+#endif
+    }
+}
+
+
+void test_bfp_stft_no_window()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x0E6B93C5;
+
+    // With a rectangular analysis window and a synthesis window that's 1/2 everywhere, 50% overlap reconstructs the
+    // input
+    const unsigned N = MIN(64, STFT_MAX_N);
+    const unsigned H = N/2;
+
+    int32_t DWORD_ALIGNED frame_buff[STFT_MAX_N];
+    int32_t history_buff[STFT_MAX_N];
+    int32_t overlap_buff[STFT_MAX_N];
+    int32_t window[STFT_MAX_N];
+
+    for(unsigned n = 0; n < N; n++)
+        window[n] = 0x20000000;
+
+    bfp_stft_t stft;
+    bfp_stft_init(&stft, frame_buff, history_buff, overlap_buff, NULL, window, N, H, -31);
+
+    int32_t prev[STFT_MAX_N] = {0};
+
+    for(unsigned t = 0; t < 8; t++){
+        int32_t block[STFT_MAX_N];
+        int32_t output[STFT_MAX_N];
+
+        for(unsigned n = 0; n < H; n++)
+            block[n] = pseudo_rand_int32(&r) >> 1;
+
+        bfp_stft_inverse(&stft, output, bfp_stft_forward(&stft, block));
+
+        for(unsigned n = 0; n < H; n++)
+            TEST_ASSERT_INT32_WITHIN(STFT_ERROR_BOUND, prev[n], output[n]);
+
+        for(unsigned n = 0; n < H; n++)
+            prev[n] = block[n];
+    }
+}
+
+
+void test_bfp_stft()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_bfp_stft_round_trip);
+    RUN_TEST(test_bfp_stft_no_window);
+}
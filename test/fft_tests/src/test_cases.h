@@ -8,8 +8,16 @@ void test_xs3_fft_helpers();
 void test_xs3_fft_dit();
 void test_xs3_fft_dif();
 void test_xs3_fft_mono_adjust();
+void test_xs3_fft_twiddle_layout();
+void test_xs3_fft_s16();
+void test_xs3_fft_mixed();
+void test_xs3_filter_fir_block();
 
 void test_bfp_fft();
+void test_bfp_stft();
+void test_bfp_filter_ols();
+void test_bfp_filter_partitioned();
+void test_bfp_filter_fdaf();
 
 
 #endif //TEST_CASES_H_
\ No newline at end of file
@@ -77,13 +77,13 @@ void test_xs3_fft_dif_forward_complete()
             TEST_ASSERT_CONVERSION(error);
 
             if(diff > worst_case) { worst_case = diff;  }
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
 
             if(diff > worst_case) { worst_case = diff;  }
             diff = abs_diff_vect_complex_s32(a, exponent, A, FFT_N, &error);
             TEST_ASSERT_CONVERSION(error);
 
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
 
             TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s32_headroom(a, FFT_N), headroom, "Reported headroom was incorrect.");
         }
@@ -154,7 +154,7 @@ void test_xs3_fft_dif_inverse_complete()
             TEST_ASSERT_CONVERSION(error);
             
             if(diff > worst_case) { worst_case = diff;  }
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
             TEST_ASSERT_CONVERSION(error);
 
             for(unsigned i = 0; i < FFT_N; i++){
@@ -166,7 +166,7 @@ void test_xs3_fft_dif_inverse_complete()
             TEST_ASSERT_CONVERSION(error);
 
             if(diff > worst_case) { worst_case = diff;  }
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
 
             TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s32_headroom(a, FFT_N), headroom, "Reported headroom was incorrect.");
         }
@@ -237,7 +237,7 @@ void test_xs3_fft_dif_forward()
 
             unsigned diff = abs_diff_vect_complex_s32(a, exponent, A, FFT_N, &error);
             TEST_ASSERT_CONVERSION(error);
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
 
             TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s32_headroom(a, FFT_N), headroom, "Reported headroom was incorrect.");
         }
@@ -304,7 +304,7 @@ void test_xs3_fft_dif_inverse()
 
             unsigned diff = abs_diff_vect_complex_s32(a, exponent, A, FFT_N, &error);
             TEST_ASSERT_CONVERSION(error);
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+WIGGLE, k), diff, "Output delta is too large");
 
             TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s32_headroom(a, FFT_N), headroom, "Reported headroom was incorrect.");
         }
@@ -80,6 +80,64 @@ void test_xs3_fft_index_bit_reversal()
 }
 
 
+void test_xs3_fft_index_bit_reversal_shr()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x4A1D7E93;
+
+    for(unsigned k = MIN_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        unsigned N = (1<<k);
+        float worst_timing = 0.0f;
+
+        uint16_t bitrev[MAX_PROC_FRAME_LENGTH];
+        xs3_fft_bit_reversal_table(bitrev, N);
+
+        for(unsigned i = 0; i < N; i++)
+            TEST_ASSERT_EQUAL(flt_bitrev(i, k), bitrev[i]);
+        
+        for(unsigned t = 0; t <= (1<<LOOPS_LOG2); t++){
+
+            complex_s32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+            complex_s32_t DWORD_ALIGNED expected[MAX_PROC_FRAME_LENGTH];
+
+            headroom_t hr = pseudo_rand_uint32(&r) % 4;
+            right_shift_t shr = ((int) (pseudo_rand_uint32(&r) % 3)) - hr;
+
+            rand_vect_complex_s32(a, N, hr, &r);
+
+            for(unsigned i = 0; i < N; i++)
+                expected[i] = a[i];
+
+            headroom_t exp_hr = xs3_vect_s32_shl((int32_t*) expected, (int32_t*) expected, 2*N, -shr);
+            xs3_fft_index_bit_reversal(expected, N);
+
+            unsigned ts1 = getTimestamp();
+            headroom_t res_hr = xs3_fft_index_bit_reversal_shr(a, N, shr, bitrev);
+            unsigned ts2 = getTimestamp();
+
+            float timing = (ts2-ts1)/100.0;
+            if(timing > worst_timing) worst_timing = timing;
+
+            TEST_ASSERT_EQUAL(exp_hr, res_hr);
+            TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) expected, (int32_t*) a, 2*N);
+        }
+
+#if TIME_FUNCS
+        printf("    %s (%u-point): %f us\n", __func__, N, worst_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "%s, %u, 0, %0.02f,\n", &(__func__[5]), N, worst_timing);
+#endif
+    }
+}
+
+
+
 void test_xs3_vect_complex_s32_tail_reverse()
 {
 #if PRINT_FUNC_NAMES
@@ -252,6 +310,7 @@ void test_xs3_fft_helpers()
     SET_TEST_FILE();
 
     RUN_TEST(test_xs3_fft_index_bit_reversal);
+    RUN_TEST(test_xs3_fft_index_bit_reversal_shr);
     RUN_TEST(test_xs3_vect_complex_s32_tail_reverse);
     RUN_TEST(test_xs3_fft_spectra_split);
     RUN_TEST(test_xs3_fft_spectra_merge);
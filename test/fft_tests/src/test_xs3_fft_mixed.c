@@ -0,0 +1,261 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <xs1.h>
+#include <xclib.h>
+
+#include "xs3_math.h"
+#include "testing.h"
+#include "floating_fft.h"
+#include "tst_common.h"
+#include "unity.h"
+#include "../src/vect/xs3_fft_lut.h"
+
+#include <math.h>
+
+
+#define MAX_PROC_FRAME_LENGTH_LOG2 (MAX_DIT_FFT_LOG2)
+#define MAX_PROC_FRAME_LENGTH (1<<MAX_PROC_FRAME_LENGTH_LOG2)
+
+
+#define EXPONENT_SIZE 5
+#define MAX_HEADROOM 5
+#define WIGGLE 4
+
+#define LOOPS_LOG2 3
+
+
+static const unsigned mixed_lengths[] = {
+    2, 3, 4, 5, 6, 9, 10, 12, 15, 16, 25, 30, 45, 60, 64, 75, 96, 120, 240, 480, 960
+};
+
+#define MIXED_LENGTH_COUNT  (sizeof(mixed_lengths)/sizeof(mixed_lengths[0]))
+
+// Largest supported mixed-radix FFT length
+#define MIXED_MAX_N         (1<<17)
+
+
+// Direct DFT reference, since Fft_transform() only handles power-of-2 lengths. The inverse is scaled by 1/N.
+static void dft_double(
+    complex_double_t X[],
+    const double real[],
+    const double imag[],
+    const unsigned N,
+    const unsigned inverse)
+{
+    const double sgn = inverse? 1.0 : -1.0;
+
+    for(unsigned f = 0; f < N; f++){
+        double acc_re = 0, acc_im = 0;
+        for(unsigned n = 0; n < N; n++){
+            const double theta = sgn * 2 * M_PI * ((f * n) % N) / N;
+            acc_re += real[n] * cos(theta) - imag[n] * sin(theta);
+            acc_im += real[n] * sin(theta) + imag[n] * cos(theta);
+        }
+        X[f].re = inverse? acc_re / N : acc_re;
+        X[f].im = inverse? acc_im / N : acc_im;
+    }
+}
+
+
+void test_xs3_fft_mixed_is_supported()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    for(unsigned i = 0; i < MIXED_LENGTH_COUNT; i++)
+        TEST_ASSERT_TRUE(xs3_fft_mixed_is_supported(mixed_lengths[i]));
+
+    TEST_ASSERT_FALSE(xs3_fft_mixed_is_supported(0));
+    TEST_ASSERT_FALSE(xs3_fft_mixed_is_supported(1));
+    TEST_ASSERT_FALSE(xs3_fft_mixed_is_supported(7));
+    TEST_ASSERT_FALSE(xs3_fft_mixed_is_supported(14));
+    TEST_ASSERT_FALSE(xs3_fft_mixed_is_supported(480*11));
+
+    // Lengths are limited to 2^17
+    TEST_ASSERT_TRUE(xs3_fft_mixed_is_supported(MIXED_MAX_N));
+    TEST_ASSERT_TRUE(xs3_fft_mixed_is_supported(3*5*5*5*5*5*5));
+    TEST_ASSERT_FALSE(xs3_fft_mixed_is_supported(2*MIXED_MAX_N));
+    TEST_ASSERT_FALSE(xs3_fft_mixed_is_supported(3*MIXED_MAX_N/2));
+    TEST_ASSERT_FALSE(xs3_fft_mixed_is_supported(3*5*5*5*5*5*5*5));
+}
+
+
+static void test_fft_mixed(
+    const char* func_name,
+    const unsigned inverse,
+    unsigned r)
+{
+    conv_error_e error = 0;
+
+    for(unsigned i = 0; i < MIXED_LENGTH_COUNT; i++){
+        const unsigned FFT_N = mixed_lengths[i];
+        const unsigned k = ceil_log2(FFT_N);
+        unsigned worst_case = 0;
+        float worst_timing = 0.0f;
+
+        if(FFT_N > MAX_PROC_FRAME_LENGTH)
+            continue;
+
+        for(unsigned t = 0; t < (1 << LOOPS_LOG2); t++){
+
+            complex_s32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+            complex_double_t DWORD_ALIGNED A[MAX_PROC_FRAME_LENGTH];
+            double real[MAX_PROC_FRAME_LENGTH], imag[MAX_PROC_FRAME_LENGTH];
+
+            exponent_t exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t hr = pseudo_rand_uint32(&r) % (MAX_HEADROOM+1);
+
+            rand_vect_complex_s32(a, FFT_N, hr, &r);
+            conv_vect_complex_s32_to_complex_double_v2(real, imag, a, FFT_N, exponent, &error);
+            TEST_ASSERT_CONVERSION(error);
+
+            headroom_t headroom = xs3_vect_complex_s32_headroom(a, FFT_N);
+
+            dft_double(A, real, imag, FFT_N, inverse);
+
+            unsigned ts1 = getTimestamp();
+            xs3_fft_index_digit_reversal(a, FFT_N);
+            if(inverse)
+                xs3_fft_mixed_inverse(a, FFT_N, &headroom, &exponent);
+            else
+                xs3_fft_mixed_forward(a, FFT_N, &headroom, &exponent);
+            unsigned ts2 = getTimestamp();
+
+            float timing = (ts2-ts1)/100.0;
+            if(timing > worst_timing) worst_timing = timing;
+
+            unsigned diff = abs_diff_vect_complex_s32(a, exponent, A, FFT_N, &error);
+            TEST_ASSERT_CONVERSION(error);
+
+            if(diff > worst_case) { worst_case = diff;  }
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(2*k+WIGGLE, k), diff, "Output delta is too large");
+
+            TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s32_headroom(a, FFT_N), headroom, "Reported headroom was incorrect.");
+        }
+
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", func_name, FFT_N, worst_case);
+#endif
+
+#if TIME_FUNCS
+        printf("    %s (%u-point): %f us\n", func_name, FFT_N, worst_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "%s, %u, %u, %0.02f,\n", func_name, FFT_N, worst_case, worst_timing);
+#endif
+    }
+}
+
+
+void test_xs3_fft_mixed_forward()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    test_fft_mixed("xs3_fft_mixed_forward", 0, 0x28D1C3A7);
+}
+
+
+void test_xs3_fft_mixed_inverse()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    test_fft_mixed("xs3_fft_mixed_inverse", 1, 0x6F04B95E);
+}
+
+
+
+
+/*
+    Real FFT and IFFT at the largest supported length, 2*MIXED_MAX_N, whose mono adjustment needs twiddle factors for
+    angles of up to 2^18 steps. The input is a pair of tones, so the expected spectrum is known without a (far too
+    slow) direct DFT. The buffers don't fit in xcore memory, so this only runs on other platforms.
+*/
+#if !defined(__xcore__)
+void test_xs3_fft_mono_adjust_mixed_max_length()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    const unsigned FFT_N = 2*MIXED_MAX_N;
+    const unsigned k = ceil_log2(FFT_N);
+
+    // Tone frequencies (bins), where the twiddle angle is large
+    const unsigned f0 = 98765;
+    const unsigned f1 = 121000;
+    const double amp = ldexp(1, 28);
+
+    static int32_t DWORD_ALIGNED a[2*MIXED_MAX_N];
+    static double ref_in[2*MIXED_MAX_N];
+    static complex_double_t ref[MIXED_MAX_N];
+
+    conv_error_e error = 0;
+
+    for(unsigned n = 0; n < FFT_N; n++){
+        a[n] = (int32_t) round(amp * cos(2 * M_PI * (((uint64_t) f0 * n) % FFT_N) / FFT_N)
+                             + amp * sin(2 * M_PI * (((uint64_t) f1 * n) % FFT_N) / FFT_N));
+        ref_in[n] = a[n];
+    }
+
+    // cos -> N/2 at f0, sin -> -j*N/2 at f1
+    for(unsigned f = 0; f < FFT_N/2; f++)
+        ref[f].re = ref[f].im = 0;
+    ref[f0].re = amp * FFT_N / 2;
+    ref[f1].im = -amp * FFT_N / 2;
+
+    complex_s32_t* X = (complex_s32_t*) a;
+    exponent_t exponent = 0;
+    headroom_t headroom = xs3_vect_s32_headroom(a, FFT_N);
+
+    xs3_fft_index_digit_reversal(X, FFT_N/2);
+    xs3_fft_mixed_forward(X, FFT_N/2, &headroom, &exponent);
+    xs3_fft_mono_adjust_mixed(X, FFT_N, 0, &headroom, &exponent);
+
+    TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_s32_headroom(a, FFT_N), headroom, "Reported headroom was incorrect.");
+
+    unsigned diff = abs_diff_vect_complex_s32(X, exponent, ref, FFT_N/2, &error);
+    TEST_ASSERT_CONVERSION(error);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(2*k+WIGGLE, k), diff, "Forward output delta is too large");
+
+#if PRINT_ERRORS
+    printf("    %s worst error (forward): %u\n", __func__, diff);
+#endif
+
+    xs3_fft_mono_adjust_mixed(X, FFT_N, 1, &headroom, &exponent);
+    xs3_fft_index_digit_reversal(X, FFT_N/2);
+    xs3_fft_mixed_inverse(X, FFT_N/2, &headroom, &exponent);
+
+    TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_s32_headroom(a, FFT_N), headroom, "Reported headroom was incorrect.");
+
+    diff = abs_diff_vect_s32(a, exponent, ref_in, FFT_N, &error);
+    TEST_ASSERT_CONVERSION(error);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(2*k+WIGGLE, k), diff, "Inverse output delta is too large");
+
+#if PRINT_ERRORS
+    printf("    %s worst error (inverse): %u\n", __func__, diff);
+#endif
+}
+#endif
+
+
+
+
+void test_xs3_fft_mixed()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_xs3_fft_mixed_is_supported);
+    RUN_TEST(test_xs3_fft_mixed_forward);
+    RUN_TEST(test_xs3_fft_mixed_inverse);
+#if !defined(__xcore__)
+    RUN_TEST(test_xs3_fft_mono_adjust_mixed_max_length);
+#endif
+}
@@ -73,7 +73,7 @@ void test_xs3_fft_mono_adjust_forward()
 
             diff = abs_diff_vect_complex_s32((complex_s32_t*)a, exponent, (complex_double_t*) ref1, N/2, &error);
             TEST_ASSERT_CONVERSION(error);
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+2, diff, "Test init failed.");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+2, k), diff, "Test init failed.");
 
             flt_bit_reverse_indexes_double((complex_double_t*) ref1, N/2);
             flt_fft_forward_double((complex_double_t*) ref1, N/2, sine_tableA);
@@ -92,12 +92,14 @@ void test_xs3_fft_mono_adjust_forward()
 
             diff = abs_diff_vect_complex_s32((complex_s32_t*)a, exponent, (complex_double_t*) ref1, N/2, &error);
             TEST_ASSERT_CONVERSION(error);
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+2, diff, "Test setup failed.");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+2, k), diff, "Test setup failed.");
 
             unsigned ts1 = getTimestamp();
-            xs3_fft_mono_adjust((complex_s32_t*) a, N, 0);
+            headroom_t adj_hr = xs3_fft_mono_adjust((complex_s32_t*) a, N, 0);
             unsigned ts2 = getTimestamp();
 
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(a, N), adj_hr);
+
             float timing = (ts2-ts1)/100.0;
             if(timing > worst_timing) worst_timing = timing;
 
@@ -105,7 +107,7 @@ void test_xs3_fft_mono_adjust_forward()
             TEST_ASSERT_CONVERSION(error);
 
             if(diff > worst_error) { worst_error = diff; }
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+3, diff, "Output delta is too large");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+3, k), diff, "Output delta is too large");
         }
         
 #if PRINT_ERRORS
@@ -158,21 +160,23 @@ void test_xs3_fft_mono_adjust_inverse()
 
             diff = abs_diff_vect_complex_s32(a, exponent, (complex_double_t*) ref, N/2, &error);
             TEST_ASSERT_CONVERSION(error);
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+2, diff, "Test setup failed.");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+2, k), diff, "Test setup failed.");
 
 
             xs3_fft_mono_adjust(a, N, 0);
 
             unsigned ts1 = getTimestamp();
-            xs3_fft_mono_adjust(a, N, 1);
+            headroom_t adj_hr = xs3_fft_mono_adjust(a, N, 1);
             unsigned ts2 = getTimestamp();
 
+            TEST_ASSERT_EQUAL(xs3_vect_complex_s32_headroom(a, N/2), adj_hr);
+
             float timing = (ts2-ts1)/100.0;
             if(timing > worst_timing) worst_timing = timing;
             
             diff = abs_diff_vect_complex_s32(a, exponent, ref, N/2, &error);
             TEST_ASSERT_CONVERSION(error);
-            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+2, diff, "Output delta is too large.");
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(k+2, k), diff, "Output delta is too large.");
 
             if(diff > worst_error) { worst_error = diff; }
         }
@@ -0,0 +1,166 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <xs1.h>
+#include <xclib.h>
+
+#include "xs3_math.h"
+#include "testing.h"
+#include "floating_fft.h"
+#include "tst_common.h"
+#include "fft.h"
+#include "unity.h"
+#include "../src/vect/xs3_fft_lut.h"
+
+
+#define MAX_PROC_FRAME_LENGTH_LOG2 (MAX_DIT_FFT_LOG2)
+#define MAX_PROC_FRAME_LENGTH (1<<MAX_PROC_FRAME_LENGTH_LOG2)
+
+
+#define EXPONENT_SIZE 5
+#define MAX_HEADROOM 4
+#define WIGGLE 2
+
+#define MIN_FFT_N_LOG2  (2)
+
+#define LOOPS_LOG2 8
+
+
+typedef void (*fft_s16_func_t)(int16_t*, int16_t*, const unsigned, headroom_t*, exponent_t*);
+
+
+static void test_fft_s16(
+    const char* func_name,
+    fft_s16_func_t fft_func,
+    const unsigned is_dif,
+    const unsigned inverse,
+    unsigned r)
+{
+    conv_error_e error = 0;
+
+    for(unsigned k = MIN_FFT_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+        const unsigned FFT_N = (1<<k);
+        unsigned worst_case = 0;
+
+        double sine_table[(MAX_PROC_FRAME_LENGTH/2) + 1];
+
+        flt_make_sine_table_double(sine_table, FFT_N);
+
+        for(unsigned t = 0; t < (1 << LOOPS_LOG2); t++){
+
+            int16_t a_real[MAX_PROC_FRAME_LENGTH];
+            int16_t a_imag[MAX_PROC_FRAME_LENGTH];
+            complex_double_t A[MAX_PROC_FRAME_LENGTH];
+            complex_s16_t a[MAX_PROC_FRAME_LENGTH];
+
+            exponent_t exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % (MAX_HEADROOM+1);
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                a_real[i] = pseudo_rand_int16(&r) >> shr;
+                a_imag[i] = pseudo_rand_int16(&r) >> shr;
+                A[i].re = conv_s16_to_double(a_real[i], exponent, &error);
+                A[i].im = conv_s16_to_double(a_imag[i], exponent, &error);
+            }
+            TEST_ASSERT_CONVERSION(error);
+
+            headroom_t headroom = xs3_vect_complex_s16_headroom(a_real, a_imag, FFT_N);
+
+            flt_bit_reverse_indexes_double(A, FFT_N);
+            if(inverse)
+                flt_fft_inverse_double(A, FFT_N, sine_table);
+            else
+                flt_fft_forward_double(A, FFT_N, sine_table);
+
+            if(!is_dif){
+                xs3_fft_index_bit_reversal_s16(a_real, FFT_N);
+                xs3_fft_index_bit_reversal_s16(a_imag, FFT_N);
+            }
+
+            fft_func(a_real, a_imag, FFT_N, &headroom, &exponent);
+
+            if(is_dif){
+                xs3_fft_index_bit_reversal_s16(a_real, FFT_N);
+                xs3_fft_index_bit_reversal_s16(a_imag, FFT_N);
+            }
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                a[i].re = a_real[i];
+                a[i].im = a_imag[i];
+            }
+
+            unsigned diff = abs_diff_vect_complex_s16(a, exponent, A, FFT_N, &error);
+            TEST_ASSERT_CONVERSION(error);
+
+            if(diff > worst_case) { worst_case = diff;  }
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(FFT_ERROR_BOUND(2*k+WIGGLE, k), diff, "Output delta is too large");
+
+            TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s16_headroom(a_real, a_imag, FFT_N), headroom,
+                                      "Reported headroom was incorrect.");
+        }
+
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", func_name, FFT_N, worst_case);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "%s, %u, %u, -,\n", func_name, FFT_N, worst_case);
+#endif
+    }
+}
+
+
+
+
+void test_xs3_fft_dit_forward_s16()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    test_fft_s16("xs3_fft_dit_forward_s16", xs3_fft_dit_forward_s16, 0, 0, 0x5C3A19D7);
+}
+
+
+void test_xs3_fft_dit_inverse_s16()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    test_fft_s16("xs3_fft_dit_inverse_s16", xs3_fft_dit_inverse_s16, 0, 1, 0x2E8F0B41);
+}
+
+
+void test_xs3_fft_dif_forward_s16()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    test_fft_s16("xs3_fft_dif_forward_s16", xs3_fft_dif_forward_s16, 1, 0, 0x93D0E6A2);
+}
+
+
+void test_xs3_fft_dif_inverse_s16()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    test_fft_s16("xs3_fft_dif_inverse_s16", xs3_fft_dif_inverse_s16, 1, 1, 0x0B7C54F8);
+}
+
+
+
+
+void test_xs3_fft_s16()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_xs3_fft_dit_forward_s16);
+    RUN_TEST(test_xs3_fft_dit_inverse_s16);
+    RUN_TEST(test_xs3_fft_dif_forward_s16);
+    RUN_TEST(test_xs3_fft_dif_inverse_s16);
+}
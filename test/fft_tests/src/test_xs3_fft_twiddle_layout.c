@@ -0,0 +1,200 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <xs1.h>
+#include <xclib.h>
+
+#include "xs3_math.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity.h"
+#include "../src/vect/xs3_fft_lut.h"
+#include "../src/vect/xs3_fft_ext.h"
+
+/*
+ * Benchmark comparing the FFT twiddle factor layouts (see XS3_MATH_FFT_COMPACT_TWIDDLES).
+ *
+ * For each FFT length, reports the time per transform of the DIT and DIF FFTs with
+ *  - the expanded layout: the library's xs3_fft_dit_forward() / xs3_fft_dif_forward(), which compute every stage of
+ *    FFTs covered by the expanded look-up tables in the FFT kernels, and
+ *  - the compact layout: only the 16-point stages are computed by the FFT kernels, and every larger stage is computed
+ *    in C by xs3_fft_dit_ext() / xs3_fft_dif_ext() with twiddle factors from a quarter-wave sine table,
+ * along with the ratio between them and the memory used by each layout's tables. The whole transform is timed, as
+ * the two layouts split the work between the kernels and the C stages differently.
+ *
+ * The compact layout is run with a sine table built here, so both layouts are measured in the default build. Every
+ * compact result is checked against the library's FFT of the same input. The expanded layout is only timed for FFT
+ * lengths covered by the expanded tables that were compiled in (so not at all when the library is itself built with
+ * compact twiddles).
+ */
+
+#define MAX_PROC_FRAME_LENGTH_LOG2 (MAX_DIT_FFT_LOG2)
+#define MAX_PROC_FRAME_LENGTH (1<<MAX_PROC_FRAME_LENGTH_LOG2)
+
+#define BASIC_HEADROOM 2
+#define WIGGLE 4
+#define MIN_FFT_N_LOG2  (4)
+#define LOOPS_LOG2 4
+
+// Largest FFT (log2) computed entirely from the expanded tables
+#define EXPANDED_MAX_LOG2   ((XS3_MATH_FFT_COMPACT_TWIDDLES)? 0 : MAX_DIT_FFT_LUT_LOG2)
+
+// Twiddle factor memory for FFTs of up to 2^P points
+#define EXPANDED_BYTES(P)   (2 * 8 * ((1<<(P)) - 4))
+#define COMPACT_BYTES(P)    (EXPANDED_BYTES(MIN_FFT_N_LOG2) + 4 * ((1<<((P)-2)) + 1))
+
+
+typedef void (*fft_func_t)(complex_s32_t*, const unsigned, headroom_t*, exponent_t*);
+typedef void (*fft_ext_func_t)(complex_s32_t*, const unsigned, const unsigned, const int32_t*, const unsigned,
+                               headroom_t*, exponent_t*);
+
+
+static int32_t sine_lut[XS3_FFT_SINE_LUT_SIZE];
+
+// Q30 quarter-wave sine table in the layout of xs3_fft_sine_lut[]
+static void build_sine_lut()
+{
+    const unsigned P = MAX_PROC_FRAME_LENGTH_LOG2;
+
+    for(unsigned i = 0; i <= (1<<(P-2)); i++)
+        sine_lut[xs3_fft_sine_lut_index(i, P)] = (int32_t) round(ldexp(sin(2 * M_PI * i / (1<<P)), 30));
+}
+
+
+/*
+    Time (us per transform) an FFT_N-point FFT with each layout, checking that the compact layout's output matches
+    the output of fft_func.
+*/
+static void time_layouts(
+    const unsigned FFT_N_LOG2,
+    fft_func_t fft_func,
+    fft_ext_func_t fft_ext_func,
+    float* expanded_timing,
+    float* compact_timing)
+{
+    unsigned r = 0x3A1F76C2;
+    conv_error_e error = 0;
+
+    const unsigned FFT_N = (1<<FFT_N_LOG2);
+    float expanded_total = 0.0f;
+    float compact_total = 0.0f;
+
+    for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+
+        complex_s32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+        complex_s32_t DWORD_ALIGNED b[MAX_PROC_FRAME_LENGTH];
+        complex_double_t DWORD_ALIGNED B[MAX_PROC_FRAME_LENGTH];
+
+        exponent_t a_exp = 0;
+        rand_vect_complex_s32(a, FFT_N, BASIC_HEADROOM, &r);
+        headroom_t a_hr = xs3_vect_complex_s32_headroom(a, FFT_N);
+
+        exponent_t b_exp = a_exp;
+        headroom_t b_hr = a_hr;
+        for(unsigned i = 0; i < FFT_N; i++)
+            b[i] = a[i];
+
+        unsigned ts1 = getTimestamp();
+        fft_ext_func(a, FFT_N, MIN_FFT_N_LOG2, sine_lut, 0, &a_hr, &a_exp);
+        unsigned ts2 = getTimestamp();
+        fft_func(b, FFT_N, &b_hr, &b_exp);
+        unsigned ts3 = getTimestamp();
+
+        compact_total += (ts2-ts1)/100.0;
+        expanded_total += (ts3-ts2)/100.0;
+
+        TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s32_headroom(a, FFT_N), a_hr, "Reported headroom was incorrect.");
+        TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s32_headroom(b, FFT_N), b_hr, "Reported headroom was incorrect.");
+
+        // Each result may be off from the true DFT by up to the error bound, so (in LSBs of whichever has the larger
+        // exponent) they may differ by twice that
+        unsigned diff;
+        if(a_exp >= b_exp){
+            conv_vect_complex_s32_to_complex_double(B, b, FFT_N, b_exp, &error);
+            TEST_ASSERT_CONVERSION(error);
+            diff = abs_diff_vect_complex_s32(a, a_exp, B, FFT_N, &error);
+        } else {
+            conv_vect_complex_s32_to_complex_double(B, a, FFT_N, a_exp, &error);
+            TEST_ASSERT_CONVERSION(error);
+            diff = abs_diff_vect_complex_s32(b, b_exp, B, FFT_N, &error);
+        }
+        TEST_ASSERT_CONVERSION(error);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(2*FFT_ERROR_BOUND(FFT_N_LOG2+WIGGLE, FFT_N_LOG2), diff,
+                                                 "Compact and expanded layouts disagree.");
+    }
+
+    *expanded_timing = expanded_total / (1<<LOOPS_LOG2);
+    *compact_timing = compact_total / (1<<LOOPS_LOG2);
+}
+
+
+static void compare_layouts(
+    const char* func_name,
+    fft_func_t fft_func,
+    fft_ext_func_t fft_ext_func)
+{
+    build_sine_lut();
+
+    for(unsigned k = MIN_FFT_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        const unsigned FFT_N = (1<<k);
+
+        float expanded_timing, compact_timing;
+        time_layouts(k, fft_func, fft_ext_func, &expanded_timing, &compact_timing);
+
+        if(k <= EXPANDED_MAX_LOG2){
+#if TIME_FUNCS
+            printf("    %s (%u-point): %f us expanded (%u bytes), %f us compact (%u bytes), x%0.02f\n",
+                    func_name, FFT_N, expanded_timing, (unsigned) EXPANDED_BYTES(k),
+                    compact_timing, (unsigned) COMPACT_BYTES(k), compact_timing / expanded_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+            fprintf(perf_file, "%s, %u,, %0.02f, expanded twiddles (%u bytes)\n",
+                    func_name, FFT_N, expanded_timing, (unsigned) EXPANDED_BYTES(k));
+#endif
+        } else {
+#if TIME_FUNCS
+            printf("    %s (%u-point): %f us compact (%u bytes)\n",
+                    func_name, FFT_N, compact_timing, (unsigned) COMPACT_BYTES(k));
+#endif
+        }
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "%s, %u,, %0.02f, compact twiddles (%u bytes)\n",
+                func_name, FFT_N, compact_timing, (unsigned) COMPACT_BYTES(k));
+#endif
+    }
+}
+
+
+void test_xs3_fft_twiddle_layout_dit()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    compare_layouts("xs3_fft_dit_forward", xs3_fft_dit_forward, xs3_fft_dit_ext);
+}
+
+
+void test_xs3_fft_twiddle_layout_dif()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    compare_layouts("xs3_fft_dif_forward", xs3_fft_dif_forward, xs3_fft_dif_ext);
+}
+
+
+
+
+void test_xs3_fft_twiddle_layout()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_xs3_fft_twiddle_layout_dit);
+    RUN_TEST(test_xs3_fft_twiddle_layout_dif);
+}
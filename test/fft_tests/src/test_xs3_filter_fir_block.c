@@ -0,0 +1,159 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <xs1.h>
+#include <xclib.h>
+
+#include "bfp_math.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity.h"
+
+#include <string.h>
+
+
+/*
+ * Throughput benchmark of the block FIR filter functions against the per-sample ones.
+ *
+ * For each tap count, a block of FIR_BENCH_SAMPLES samples is processed once by calling the per-sample function for
+ * each sample, and once with a single call to the block function, using two filters with the same coefficients. The
+ * outputs must be identical. The reported figures are the time per output sample of each.
+ */
+#define FIR_BENCH_MIN_TAPS  (16)
+#define FIR_BENCH_MAX_TAPS  (512)
+#define FIR_BENCH_SAMPLES   (64)
+
+void test_xs3_filter_fir_s32_block_throughput()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x6A3F0E29;
+
+    for(unsigned N = FIR_BENCH_MIN_TAPS; N <= FIR_BENCH_MAX_TAPS; N <<= 1){
+
+        static int32_t coef[FIR_BENCH_MAX_TAPS];
+        static int32_t state[FIR_BENCH_MAX_TAPS];
+        static int32_t state_block[FIR_BENCH_MAX_TAPS];
+        int32_t x[FIR_BENCH_SAMPLES];
+        int32_t y[FIR_BENCH_SAMPLES];
+        int32_t y_block[FIR_BENCH_SAMPLES];
+
+        for(unsigned k = 0; k < N; k++)
+            coef[k] = pseudo_rand_int32(&r) >> 8;
+        for(unsigned n = 0; n < FIR_BENCH_SAMPLES; n++)
+            x[n] = pseudo_rand_int32(&r) >> 1;
+
+        memset(state, 0, sizeof(state));
+        memset(state_block, 0, sizeof(state_block));
+
+        xs3_filter_fir_s32_t filter, filter_block;
+        xs3_filter_fir_s32_init(&filter, state, N, coef, 8);
+        xs3_filter_fir_s32_init(&filter_block, state_block, N, coef, 8);
+
+        unsigned ts1 = getTimestamp();
+        for(unsigned n = 0; n < FIR_BENCH_SAMPLES; n++)
+            y[n] = xs3_filter_fir_s32(&filter, x[n]);
+        unsigned ts2 = getTimestamp();
+
+        const float sample_timing = (ts2-ts1)/100.0 / FIR_BENCH_SAMPLES;
+
+        ts1 = getTimestamp();
+        xs3_filter_fir_s32_block(&filter_block, y_block, x, FIR_BENCH_SAMPLES);
+        ts2 = getTimestamp();
+
+        const float block_timing = (ts2-ts1)/100.0 / FIR_BENCH_SAMPLES;
+
+        TEST_ASSERT_EQUAL_INT32_ARRAY(y, y_block, FIR_BENCH_SAMPLES);
+
+#if TIME_FUNCS
+        printf("    %u taps: per-sample %f us/sample, block %f us/sample\n", N, sample_timing, block_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+        fprintf(perf_file, "xs3_filter_fir_s32 (per sample), %u,, %0.02f,\n", N, sample_timing);
+        fprintf(perf_file, "xs3_filter_fir_s32_block (per sample), %u,, %0.02f, block=%u\n", 
+                N, block_timing, FIR_BENCH_SAMPLES);
+#endif
+    }
+}
+
+
+void test_xs3_filter_fir_s16_block_throughput()
+{
+#if PRINT_FUNC_NAMES
+    printf("%s..\n", __func__);
+#endif
+
+    unsigned r = 0x13C8B5F0;
+
+    for(unsigned N = FIR_BENCH_MIN_TAPS; N <= FIR_BENCH_MAX_TAPS; N <<= 1){
+
+        static int16_t coef[FIR_BENCH_MAX_TAPS];
+        static int16_t WORD_ALIGNED state[4*FIR_BENCH_MAX_TAPS];
+        static int16_t WORD_ALIGNED state_block[4*FIR_BENCH_MAX_TAPS];
+        int16_t x[FIR_BENCH_SAMPLES];
+        int16_t y[FIR_BENCH_SAMPLES];
+        int16_t y_block[FIR_BENCH_SAMPLES];
+
+        for(unsigned k = 0; k < N; k++)
+            coef[k] = pseudo_rand_int16(&r) >> 8;
+        for(unsigned n = 0; n < FIR_BENCH_SAMPLES; n++)
+            x[n] = pseudo_rand_int16(&r) >> 1;
+
+        // Both state modes
+        for(unsigned circular = 0; circular < 2; circular++){
+
+            memset(state, 0, sizeof(state));
+            memset(state_block, 0, sizeof(state_block));
+
+            xs3_filter_fir_s16_t filter, filter_block;
+            if(circular){
+                xs3_filter_fir_s16_init_circular(&filter, state, N, coef, 8);
+                xs3_filter_fir_s16_init_circular(&filter_block, state_block, N, coef, 8);
+            } else {
+                xs3_filter_fir_s16_init(&filter, state, N, coef, 8);
+                xs3_filter_fir_s16_init(&filter_block, state_block, N, coef, 8);
+            }
+
+            unsigned ts1 = getTimestamp();
+            for(unsigned n = 0; n < FIR_BENCH_SAMPLES; n++)
+                y[n] = xs3_filter_fir_s16(&filter, x[n]);
+            unsigned ts2 = getTimestamp();
+
+            const float sample_timing = (ts2-ts1)/100.0 / FIR_BENCH_SAMPLES;
+
+            ts1 = getTimestamp();
+            xs3_filter_fir_s16_block(&filter_block, y_block, x, FIR_BENCH_SAMPLES);
+            ts2 = getTimestamp();
+
+            const float block_timing = (ts2-ts1)/100.0 / FIR_BENCH_SAMPLES;
+
+            TEST_ASSERT_EQUAL_INT16_ARRAY(y, y_block, FIR_BENCH_SAMPLES);
+
+            const char* mode = circular? "circular" : "push";
+
+#if TIME_FUNCS
+            printf("    %u taps (%s): per-sample %f us/sample, block %f us/sample\n", 
+                   N, mode, sample_timing, block_timing);
+#endif
+
+#if WRITE_PERFORMANCE_INFO
+            fprintf(perf_file, "xs3_filter_fir_s16 (per sample), %u,, %0.02f, %s\n", N, sample_timing, mode);
+            fprintf(perf_file, "xs3_filter_fir_s16_block (per sample), %u,, %0.02f, %s block=%u\n", 
+                    N, block_timing, mode, FIR_BENCH_SAMPLES);
+#endif
+        }
+    }
+}
+
+
+void test_xs3_filter_fir_block()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_xs3_filter_fir_s32_block_throughput);
+    RUN_TEST(test_xs3_filter_fir_s16_block_throughput);
+}
@@ -37,6 +37,12 @@
 #define PERFORMANCE_INFO_FILENAME  "perf_info.csv"
 #endif
 
+/*
+ * Error bounds in the FFT tests were chosen for FFTs of up to 1024 points. The rounding error of the FFT grows roughly
+ * with sqrt(N), so for larger FFTs (see XS3_MATH_FFT_MAX_LOG2) the bound is scaled accordingly.
+ */
+#define FFT_ERROR_BOUND(BOUND, N_LOG2)  (((N_LOG2) <= 10)? (BOUND) : ((BOUND) << (((N_LOG2)-9)>>1)))
+
 #define TEST_ASSERT_CONVERSION(V) do{ \
     char qwe[100];  if((V)){ sprintf(qwe, "Conversion failure (0x%X)", (V)); \
         TEST_ASSERT_FALSE_MESSAGE(V, qwe); }} while(0)
@@ -5,7 +5,7 @@
 #include "xs3_math_conf.h"
 #include "xs3_math_types.h"
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -141,6 +141,6 @@ void print_vect_double(double * B, unsigned length, conv_error_e* error);
         A; printf(" - \n"); B; printf("]]\n"); } while(0)
         
 
-#ifdef __XC__
+#if defined(__XC__) || defined(__cplusplus)
 }
 #endif
\ No newline at end of file
@@ -30,10 +30,12 @@ int main(int argc, char** argv)
     CALL(test_xs3_shr_shl_vect);
     CALL(test_xs3_add_sub_vect);
     CALL(test_xs3_mul_vect);
+    CALL(test_xs3_macc_vect);
     CALL(test_xs3_abs_clip_rect_vect);
     CALL(test_xs3_sum);
     CALL(test_xs3_dot);
     CALL(test_xs3_bitdepth_convert);
+    CALL(test_xs3_vect_s8);
     CALL(test_xs3_add_sub_vect_complex);
     CALL(test_xs3_mul_vect_complex);
     CALL(test_xs3_complex_mul_vect_complex);
@@ -46,6 +48,10 @@ int main(int argc, char** argv)
     CALL(test_xs3_vect_complex_s32_to_complex_s16);
     CALL(test_xs3_vect_complex_s16_to_complex_s32);
     CALL(test_xs3_filter_fir_s32);
+    CALL(test_xs3_filter_fir_s16);
+    CALL(test_xs3_filter_fir_sym);
+    CALL(test_xs3_filter_polyphase);
+    CALL(test_xs3_filter_cic);
     CALL(test_xs3_push_sample_s16);
     CALL(test_xs3_filter_biquad_s32);
     CALL(test_xs3_abs_sum);
@@ -171,6 +171,182 @@ void test_xs3_filter_biquad_s32_case3()
 
 
 
+/*
+    A cascade of any number of sections initialized from a flat coefficient array must pack the sections into as few
+    blocks as possible, and block processing must give exactly the same outputs as per-sample processing.
+*/
+#define MAX_SECTIONS    20
+#define MAX_BLOCKS      XS3_BIQUAD_BLOCK_COUNT(MAX_SECTIONS)
+#define MAX_LEN         64
+#define REPS            (MAX_SECTIONS)
+#define FRAMES          4
+void test_xs3_filter_biquads_s32_block()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x6F1B2C83;
+
+    int32_t coef[MAX_SECTIONS][5];
+    xs3_biquad_filter_s32_t biquads[MAX_BLOCKS];
+    xs3_biquad_filter_s32_t biquads_block[MAX_BLOCKS];
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+        const unsigned S = v + 1;
+
+        PRINTF("\trep %d... (%u sections)\t(seed: 0x%08X)\n", v, S, old_seed);
+
+        // Small, (probably) stable sections
+        for(int k = 0; k < S; k++){
+            coef[k][0] = 0x20000000 + (pseudo_rand_int32(&seed) >> 4);
+            coef[k][1] = pseudo_rand_int32(&seed) >> 4;
+            coef[k][2] = pseudo_rand_int32(&seed) >> 4;
+            coef[k][3] = pseudo_rand_int32(&seed) >> 5;
+            coef[k][4] = pseudo_rand_int32(&seed) >> 5;
+        }
+
+        memset(biquads, 0xAA, sizeof(biquads));
+
+        const unsigned B = xs3_filter_biquads_s32_init(biquads, coef, S);
+        
+        TEST_ASSERT_EQUAL(XS3_BIQUAD_BLOCK_COUNT(S), B);
+
+        for(int b = 0; b < B; b++){
+            TEST_ASSERT_EQUAL((b == B-1)? S - 8*b : 8, biquads[b].biquad_count);
+            for(int k = 0; k < 8; k++){
+                for(int j = 0; j < 5; j++)
+                    TEST_ASSERT_EQUAL((8*b + k < S)? coef[8*b + k][j] : 0, biquads[b].coef[j][k]);
+            }
+            for(int k = 0; k < 9; k++){
+                TEST_ASSERT_EQUAL(0, biquads[b].state[0][k]);
+                TEST_ASSERT_EQUAL(0, biquads[b].state[1][k]);
+            }
+        }
+
+        memcpy(biquads_block, biquads, sizeof(biquads));
+
+        for(int f = 0; f < FRAMES; f++){
+            int32_t input[MAX_LEN];
+            int32_t expected[MAX_LEN];
+            int32_t res[MAX_LEN];
+
+            const unsigned len = pseudo_rand_uint32(&seed) % (MAX_LEN + 1);
+
+            for(int i = 0; i < len; i++){
+                input[i] = pseudo_rand_int32(&seed) >> 8;
+                expected[i] = xs3_filter_biquads_s32(biquads, B, input[i]);
+            }
+
+            // Alternate between separate and in-place outputs
+            int32_t* output = (f & 1)? input : res;
+
+            xs3_filter_biquads_s32_block(biquads_block, B, output, input, len);
+
+            sprintf(msg_buff, "(rep %d;   %u sections;   frame %d;   seed 0x%08X)", v, S, f, old_seed);
+            for(int i = 0; i < len; i++)
+                TEST_ASSERT_EQUAL_MESSAGE(expected[i], output[i], msg_buff);
+            for(int b = 0; b < B; b++)
+                TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE(&biquads[b].state[0][0], &biquads_block[b].state[0][0], 2*9, 
+                                                      msg_buff);
+        }
+    }
+}
+#undef MAX_SECTIONS
+#undef MAX_BLOCKS
+#undef MAX_LEN
+#undef REPS
+#undef FRAMES
+
+
+
+/*
+    Each channel of a biquad bank must give exactly the same outputs as a cascade of the same sections processed with 
+    xs3_filter_biquads_s32().
+*/
+#define MAX_STAGES      20
+#define MAX_BLOCKS      XS3_BIQUAD_BLOCK_COUNT(MAX_STAGES)
+#define REPS            40
+#define SAMPLES         50
+void test_xs3_filter_biquad_bank_s32()
+{
+    PRINTF("%s...\n", __func__);
+
+    seed = 0x19E4A07D;
+
+    int32_t WORD_ALIGNED coef[MAX_STAGES][5][8];
+    int32_t WORD_ALIGNED state[MAX_STAGES+1][2][8];
+    int32_t section_coef[MAX_STAGES][5];
+    xs3_biquad_filter_s32_t biquads[8][MAX_BLOCKS];
+    xs3_filter_biquad_bank_s32_t bank;
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+        const unsigned C = (pseudo_rand_uint32(&seed) % 8) + 1;
+        const unsigned S = (v == 0)? 0 : (pseudo_rand_uint32(&seed) % MAX_STAGES) + 1;
+
+        PRINTF("\trep %d... (%u channels, %u stages)\t(seed: 0x%08X)\n", v, C, S, old_seed);
+
+        memset(coef, 0, sizeof(coef));
+        memset(state, 0xAA, sizeof(state));
+
+        // Small, (probably) stable sections
+        for(int s = 0; s < S; s++){
+            for(int c = 0; c < C; c++){
+                coef[s][0][c] = 0x20000000 + (pseudo_rand_int32(&seed) >> 4);
+                coef[s][1][c] = pseudo_rand_int32(&seed) >> 4;
+                coef[s][2][c] = pseudo_rand_int32(&seed) >> 4;
+                coef[s][3][c] = pseudo_rand_int32(&seed) >> 5;
+                coef[s][4][c] = pseudo_rand_int32(&seed) >> 5;
+            }
+        }
+
+        xs3_filter_biquad_bank_s32_init(&bank, state, coef, S, C);
+
+        TEST_ASSERT_EQUAL(C, bank.channel_count);
+        TEST_ASSERT_EQUAL(S, bank.stage_count);
+        for(int s = 0; s <= S; s++)
+            for(int c = 0; c < 8; c++)
+                TEST_ASSERT_EQUAL(0, state[s][0][c] | state[s][1][c]);
+
+        for(int c = 0; c < C; c++){
+            for(int s = 0; s < S; s++)
+                for(int j = 0; j < 5; j++)
+                    section_coef[s][j] = coef[s][j][c];
+            xs3_filter_biquads_s32_init(biquads[c], section_coef, S);
+        }
+
+        for(int i = 0; i < SAMPLES; i++){
+            int32_t WORD_ALIGNED input[8];
+            int32_t WORD_ALIGNED res[8];
+            int32_t expected[8];
+
+            for(int c = 0; c < C; c++){
+                input[c] = pseudo_rand_int32(&seed) >> 8;
+                expected[c] = xs3_filter_biquads_s32(biquads[c], XS3_BIQUAD_BLOCK_COUNT(S), input[c]);
+            }
+
+            // Alternate between separate and in-place outputs. Lanes past the last channel must not be written.
+            int32_t* output = (i & 1)? input : res;
+            for(int c = C; c < 8; c++)
+                output[c] = 0x5A5A5A5A;
+
+            xs3_filter_biquad_bank_s32(&bank, output, input);
+
+            sprintf(msg_buff, "(rep %d;   %u channels;   %u stages;   sample %d;   seed 0x%08X)", v, C, S, i, old_seed);
+            TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE(expected, output, C, msg_buff);
+            for(int c = C; c < 8; c++)
+                TEST_ASSERT_EQUAL_MESSAGE(0x5A5A5A5A, output[c], msg_buff);
+        }
+    }
+}
+#undef MAX_STAGES
+#undef MAX_BLOCKS
+#undef REPS
+#undef SAMPLES
+
+
 
 void test_xs3_filter_biquad_s32()
 {
@@ -180,5 +356,7 @@ void test_xs3_filter_biquad_s32()
     RUN_TEST(test_xs3_filter_biquad_s32_case1);
     RUN_TEST(test_xs3_filter_biquad_s32_case2);
     RUN_TEST(test_xs3_filter_biquad_s32_case3);
+    RUN_TEST(test_xs3_filter_biquads_s32_block);
+    RUN_TEST(test_xs3_filter_biquad_bank_s32);
 
 }
\ No newline at end of file
@@ -0,0 +1,258 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xs3_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+#include "../src/vect/vpu_helper.h"
+
+#include "../../tst_common.h"
+
+#include "unity.h"
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+static unsigned seed = 0x61C4E09B;
+static char msg_buff[200];
+
+
+#define MAX_RATIO       64
+#define MAX_OUTPUTS     24
+#define MAX_INPUTS      (MAX_RATIO * MAX_OUTPUTS)
+#define MAX_RESPONSE    (XS3_FILTER_CIC_MAX_ORDER * (MAX_RATIO - 1) + 1)
+#define REPS            100
+
+
+/*
+    Get the impulse response of an order-N, ratio-R CIC filter, which is N moving sums of R samples in cascade.
+*/
+static unsigned cic_response(
+    int64_t h[],
+    const unsigned N,
+    const unsigned R)
+{
+    unsigned len = 1;
+    h[0] = 1;
+
+    for(int s = 0; s < N; s++){
+        for(int k = len + R - 2; k >= 0; k--){
+            int64_t acc = 0;
+            for(int j = 0; j < R; j++)
+                if(k - j >= 0 && k - j < len)
+                    acc += h[k - j];
+            h[k] = acc;
+        }
+        len += R - 1;
+    }
+
+    return len;
+}
+
+
+/*
+    Compute the CIC filter's output for the last of the R input samples of each output, from its impulse response, with
+    the samples before time 0 being zero.
+*/
+static int32_t cic_expected(
+    const int64_t h[],
+    const unsigned h_len,
+    const int32_t x[],
+    const unsigned t,
+    const right_shift_t shift)
+{
+    int64_t acc = 0;
+    for(int k = 0; k < h_len && k <= t; k++)
+        acc += h[k] * x[t - k];
+
+    if(shift == 0)
+        return (int32_t) acc;
+
+    return (int32_t) ((acc + (((int64_t) 1) << (shift - 1))) >> shift);
+}
+
+
+static unsigned growth_bits(
+    const unsigned N,
+    const unsigned R)
+{
+    uint64_t gain = 1;
+    for(int k = 0; k < N; k++)
+        gain *= R;
+
+    unsigned growth = 0;
+    while((((uint64_t) 1) << growth) < gain)
+        growth++;
+
+    return growth;
+}
+
+
+void test_xs3_filter_cic_s32()
+{
+    PRINTF("%s...\n", __func__);
+
+    static int32_t input[MAX_INPUTS];
+    int32_t output[MAX_OUTPUTS];
+    int64_t h[MAX_RESPONSE];
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        const unsigned N = (pseudo_rand_uint32(&seed) % XS3_FILTER_CIC_MAX_ORDER) + 1;
+        const unsigned R = (pseudo_rand_uint32(&seed) % MAX_RATIO) + 1;
+        const unsigned G = growth_bits(N, R);
+        const unsigned input_bits = MIN(32, 64 - G) - (pseudo_rand_uint32(&seed) % 8);
+
+        PRINTF("\trep %d... (N = %u, R = %u, input_bits = %u)\t(seed: 0x%08X)\n", v, N, R, input_bits, old_seed);
+
+        xs3_filter_cic_s32_t cic;
+        xs3_filter_cic_s32_init(&cic, N, R, input_bits);
+
+        TEST_ASSERT_EQUAL(N, cic.order);
+        TEST_ASSERT_EQUAL(R, cic.ratio);
+        TEST_ASSERT_EQUAL(MAX(0, (int) (G + input_bits) - 31), cic.shift);
+
+        const unsigned h_len = cic_response(h, N, R);
+
+        // Full-scale samples, including the extremes, exercise the wrapping of the integrators
+        const int64_t max = MIN(((int64_t) 1) << (input_bits - 1), INT32_MAX);
+        for(int i = 0; i < MAX_OUTPUTS * R; i++){
+            const unsigned pick = pseudo_rand_uint32(&seed) % 8;
+            input[i] = (pick == 0)? (int32_t) -max
+                     : (pick == 1)? (int32_t) max
+                     : (int32_t) (pseudo_rand_int64(&seed) % (max + 1));
+        }
+
+        // Process in two blocks, to check that the state carries over
+        const unsigned first = pseudo_rand_uint32(&seed) % (MAX_OUTPUTS + 1);
+
+        headroom_t hr = xs3_filter_cic_s32(&cic, &output[0], &input[0], first);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(&output[0], first), hr);
+        hr = xs3_filter_cic_s32(&cic, &output[first], &input[first * R], MAX_OUTPUTS - first);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(&output[first], MAX_OUTPUTS - first), hr);
+
+        for(int n = 0; n < MAX_OUTPUTS; n++){
+            const int32_t expected = cic_expected(h, h_len, input, n*R + R - 1, cic.shift);
+            sprintf(msg_buff, "(rep %d, n = %d)", v, n);
+            TEST_ASSERT_EQUAL_INT32_MESSAGE(expected, output[n], msg_buff);
+            // Outputs always have headroom
+            TEST_ASSERT(HR_S32(output[n]) >= 1);
+        }
+    }
+}
+
+
+void test_xs3_filter_cic_s32_pdm()
+{
+    PRINTF("%s...\n", __func__);
+
+    static int32_t input[MAX_INPUTS];
+    uint32_t bits[MAX_INPUTS / 32];
+    int32_t output[MAX_OUTPUTS];
+    int32_t output_s32[MAX_OUTPUTS];
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        const unsigned N = (pseudo_rand_uint32(&seed) % XS3_FILTER_CIC_MAX_ORDER) + 1;
+        // The outputs must be whole numbers of words of input
+        const unsigned R = 8 * ((pseudo_rand_uint32(&seed) % (MAX_RATIO/8)) + 1);
+        const unsigned outputs = 4 * ((pseudo_rand_uint32(&seed) % (MAX_OUTPUTS/4)) + 1);
+
+        PRINTF("\trep %d... (N = %u, R = %u)\t(seed: 0x%08X)\n", v, N, R, old_seed);
+
+        // Pack the signs of random samples with the semantics of VDEPTH1
+        memset(bits, 0, sizeof(bits));
+        for(int i = 0; i < outputs * R; i++){
+            const int32_t s = pseudo_rand_int32(&seed);
+            bits[i / 32] |= vdepth1_32(s) << (i % 32);
+            input[i] = (s >= 0)? 1 : -1;
+        }
+
+        xs3_filter_cic_s32_t cic, cic_s32;
+        xs3_filter_cic_s32_init(&cic, N, R, 1);
+        xs3_filter_cic_s32_init(&cic_s32, N, R, 1);
+
+        headroom_t hr = xs3_filter_cic_s32_pdm(&cic, output, bits, outputs);
+        xs3_filter_cic_s32(&cic_s32, output_s32, input, outputs);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(output, outputs), hr);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(output_s32, output, outputs);
+    }
+
+    // Ratios which aren't a multiple of 8 leave bytes of samples split between outputs. Each block is a whole number
+    // of words, and the samples are processed in two blocks to check that the state carries over.
+    {
+        static int32_t input_b[2 * 32 * MAX_RATIO];
+        static uint32_t bits_b[2 * MAX_RATIO];
+        static int32_t output_b[2 * 32];
+        static int32_t output_b_s32[2 * 32];
+
+        for(int v = 0; v < REPS; v++){
+
+            const unsigned old_seed = seed;
+
+            const unsigned N = (pseudo_rand_uint32(&seed) % XS3_FILTER_CIC_MAX_ORDER) + 1;
+            const unsigned R = (pseudo_rand_uint32(&seed) % MAX_RATIO) + 1;
+
+            unsigned block = 32;
+            while((block > 1) && (((block * R) % 64) == 0))
+                block >>= 1;
+
+            PRINTF("\trep %d... (N = %u, R = %u, block = %u)\t(seed: 0x%08X)\n", v, N, R, block, old_seed);
+
+            memset(bits_b, 0, sizeof(bits_b));
+            for(int i = 0; i < 2 * block * R; i++){
+                const int32_t s = pseudo_rand_int32(&seed);
+                bits_b[i / 32] |= vdepth1_32(s) << (i % 32);
+                input_b[i] = (s >= 0)? 1 : -1;
+            }
+
+            xs3_filter_cic_s32_t cic, cic_s32;
+            xs3_filter_cic_s32_init(&cic, N, R, 1);
+            xs3_filter_cic_s32_init(&cic_s32, N, R, 1);
+
+            xs3_filter_cic_s32_pdm(&cic, &output_b[0], &bits_b[0], block);
+            headroom_t hr = xs3_filter_cic_s32_pdm(&cic, &output_b[block], &bits_b[block * R / 32], block);
+            xs3_filter_cic_s32(&cic_s32, output_b_s32, input_b, 2 * block);
+
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(&output_b[block], block), hr);
+            TEST_ASSERT_EQUAL_INT32_ARRAY(output_b_s32, output_b, 2 * block);
+        }
+    }
+
+    // All zero bits are a full-scale positive DC input, so after the first N outputs the output is the DC gain
+    const unsigned N = 5;
+    const unsigned R = 64;
+
+    memset(bits, 0, sizeof(bits));
+
+    xs3_filter_cic_s32_t cic;
+    xs3_filter_cic_s32_init(&cic, N, R, 1);
+    TEST_ASSERT_EQUAL(0, cic.shift);
+
+    xs3_filter_cic_s32_pdm(&cic, output, bits, 8);
+
+    for(int n = N; n < 8; n++)
+        TEST_ASSERT_EQUAL_INT32(1 << (6*N), output[n]);
+}
+
+
+void test_xs3_filter_cic()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_xs3_filter_cic_s32);
+    RUN_TEST(test_xs3_filter_cic_s32_pdm);
+}
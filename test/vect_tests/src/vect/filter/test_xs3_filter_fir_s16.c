@@ -192,6 +192,145 @@ void test_xs3_filter_fir_s16_case2()
 #undef REPS
 
 
+/*
+    Circular state must give exactly the same outputs as the default state.
+*/
+#define MAX_TAPS    128
+#define REPS        (MAX_TAPS)
+#define SAMPLES     300
+void test_xs3_filter_fir_s16_circular()
+{
+    PRINTF("%s...\n", __func__);
+    
+    int16_t coefs[MAX_TAPS];
+    int16_t WORD_ALIGNED state[MAX_TAPS];
+    int16_t WORD_ALIGNED state_circ[4*MAX_TAPS];
+
+    xs3_filter_fir_s16_t filter;
+    xs3_filter_fir_s16_t filter_circ;
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        // Number of filter taps
+        const unsigned N = v + 1;
+        const unsigned log2_N = ceil_log2(N);
+
+        PRINTF("\trep %d... (%u taps)\t(seed: 0x%08X)\n", v, N, old_seed);
+
+        for(int i = 0; i < N; i++)
+            coefs[i] = pseudo_rand_int16(&seed) >> log2_N;
+
+        memset(state, 0, sizeof(state));
+        memset(state_circ, 0xAA, sizeof(state_circ));
+
+        const right_shift_t shift = 15 - log2_N;
+
+        xs3_filter_fir_s16_init(&filter, state, N, coefs, shift);
+        xs3_filter_fir_s16_init_circular(&filter_circ, state_circ, N, coefs, shift);
+
+        for(int i = 0; i < SAMPLES; i++){
+            const int16_t new_sample = pseudo_rand_int16(&seed) >> 1;
+
+            if(i % 7 == 0){
+                xs3_filter_fir_s16_add_sample(&filter, new_sample);
+                xs3_filter_fir_s16_add_sample(&filter_circ, new_sample);
+            } else {
+                int16_t expected = xs3_filter_fir_s16(&filter, new_sample);
+                int16_t res = xs3_filter_fir_s16(&filter_circ, new_sample);
+
+                sprintf(msg_buff, "(rep %d;   %u taps;   sample %d;   seed 0x%08X)", v, N, i, old_seed);
+                TEST_ASSERT_EQUAL_MESSAGE(expected, res, msg_buff);
+            }
+
+            // The window must always be word-aligned
+            TEST_ASSERT_EQUAL(0, (filter_circ.window - filter_circ.state) % 2);
+            TEST_ASSERT_EQUAL_INT16_ARRAY(state, filter_circ.window, N);
+        }
+    }
+}
+#undef MAX_TAPS
+#undef REPS
+#undef SAMPLES
+
+
+
+/*
+    Block processing must give exactly the same outputs as processing one sample at a time, in both state modes.
+*/
+#define MAX_TAPS    128
+#define REPS        100
+#define MAX_BLOCK   37
+#define BLOCKS      8
+void test_xs3_filter_fir_s16_block()
+{
+    PRINTF("%s...\n", __func__);
+    
+    int16_t coefs[MAX_TAPS];
+    int16_t WORD_ALIGNED state[4*MAX_TAPS];
+    int16_t WORD_ALIGNED state_block[4*MAX_TAPS];
+
+    xs3_filter_fir_s16_t filter;
+    xs3_filter_fir_s16_t filter_block;
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        // Number of filter taps
+        const unsigned N = (pseudo_rand_uint32(&seed) % MAX_TAPS) + 1;
+        const unsigned log2_N = ceil_log2(N);
+        const unsigned circular = v & 1;
+
+        PRINTF("\trep %d... (%u taps)\t(seed: 0x%08X)\n", v, N, old_seed);
+
+        for(int i = 0; i < N; i++)
+            coefs[i] = pseudo_rand_int16(&seed) >> log2_N;
+
+        memset(state, 0, sizeof(state));
+        memset(state_block, 0, sizeof(state_block));
+
+        const right_shift_t shift = 15 - log2_N;
+
+        if(circular){
+            xs3_filter_fir_s16_init_circular(&filter, state, N, coefs, shift);
+            xs3_filter_fir_s16_init_circular(&filter_block, state_block, N, coefs, shift);
+        } else {
+            xs3_filter_fir_s16_init(&filter, state, N, coefs, shift);
+            xs3_filter_fir_s16_init(&filter_block, state_block, N, coefs, shift);
+        }
+
+        for(int b = 0; b < BLOCKS; b++){
+            int16_t input[MAX_BLOCK];
+            int16_t expected[MAX_BLOCK];
+            int16_t res[MAX_BLOCK];
+
+            const unsigned len = pseudo_rand_uint32(&seed) % (MAX_BLOCK + 1);
+
+            for(int i = 0; i < len; i++){
+                input[i] = pseudo_rand_int16(&seed) >> 1;
+                expected[i] = xs3_filter_fir_s16(&filter, input[i]);
+            }
+
+            // Alternate between separate and in-place outputs
+            int16_t* output = (b & 1)? input : res;
+
+            xs3_filter_fir_s16_block(&filter_block, output, input, len);
+
+            sprintf(msg_buff, "(rep %d;   %u taps;   block %d;   seed 0x%08X)", v, N, b, old_seed);
+            for(int i = 0; i < len; i++)
+                TEST_ASSERT_EQUAL_MESSAGE(expected[i], output[i], msg_buff);
+            TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE(filter.window, filter_block.window, N, msg_buff);
+        }
+    }
+}
+#undef MAX_TAPS
+#undef REPS
+#undef MAX_BLOCK
+#undef BLOCKS
+
+
 
 
 void test_xs3_filter_fir_s16()
@@ -201,5 +340,7 @@ void test_xs3_filter_fir_s16()
     RUN_TEST(test_xs3_filter_fir_s16_case0);
     RUN_TEST(test_xs3_filter_fir_s16_case1);
     RUN_TEST(test_xs3_filter_fir_s16_case2);
+    RUN_TEST(test_xs3_filter_fir_s16_circular);
+    RUN_TEST(test_xs3_filter_fir_s16_block);
 
 }
\ No newline at end of file
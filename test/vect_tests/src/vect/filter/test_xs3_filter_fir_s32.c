@@ -232,6 +232,77 @@ void test_xs3_filter_fir_s32_case3()
 #undef REPS
 
 
+/*
+    Block processing must give exactly the same outputs as processing one sample at a time.
+*/
+#define MAX_TAPS    128
+#define REPS        100
+#define MAX_BLOCK   37
+#define BLOCKS      8
+void test_xs3_filter_fir_s32_block()
+{
+    PRINTF("%s...\n", __func__);
+    
+    int32_t coefs[MAX_TAPS];
+    int32_t state[MAX_TAPS];
+    int32_t state_block[MAX_TAPS];
+
+    seed = 0x2E81D4A7;
+
+    xs3_filter_fir_s32_t filter;
+    xs3_filter_fir_s32_t filter_block;
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        // Number of filter taps
+        const unsigned N = (pseudo_rand_uint32(&seed) % MAX_TAPS) + 1;
+
+        PRINTF("\trep %d... (%u taps)\t(seed: 0x%08X)\n", v, N, old_seed);
+
+        for(int i = 0; i < N; i++)
+            coefs[i] = pseudo_rand_int32(&seed) >> 2;
+
+        memset(state, 0, sizeof(state));
+        memset(state_block, 0, sizeof(state_block));
+
+        const right_shift_t shift = pseudo_rand_uint32(&seed) % 8;
+
+        xs3_filter_fir_s32_init(&filter, state, N, coefs, shift);
+        xs3_filter_fir_s32_init(&filter_block, state_block, N, coefs, shift);
+
+        for(int b = 0; b < BLOCKS; b++){
+            int32_t input[MAX_BLOCK];
+            int32_t expected[MAX_BLOCK];
+            int32_t res[MAX_BLOCK];
+
+            const unsigned len = pseudo_rand_uint32(&seed) % (MAX_BLOCK + 1);
+
+            for(int i = 0; i < len; i++){
+                input[i] = pseudo_rand_int32(&seed) >> 1;
+                expected[i] = xs3_filter_fir_s32(&filter, input[i]);
+            }
+
+            // Alternate between separate and in-place outputs
+            int32_t* output = (b & 1)? input : res;
+
+            xs3_filter_fir_s32_block(&filter_block, output, input, len);
+
+            sprintf(msg_buff, "(rep %d;   %u taps;   block %d;   seed 0x%08X)", v, N, b, old_seed);
+            TEST_ASSERT_EQUAL_MESSAGE(filter.head, filter_block.head, msg_buff);
+            for(int i = 0; i < len; i++)
+                TEST_ASSERT_EQUAL_MESSAGE(expected[i], output[i], msg_buff);
+            TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE(state, state_block, N, msg_buff);
+        }
+    }
+}
+#undef MAX_TAPS
+#undef REPS
+#undef MAX_BLOCK
+#undef BLOCKS
+
+
 
 
 void test_xs3_filter_fir_s32()
@@ -242,5 +313,6 @@ void test_xs3_filter_fir_s32()
     RUN_TEST(test_xs3_filter_fir_s32_case1);
     RUN_TEST(test_xs3_filter_fir_s32_case2);
     RUN_TEST(test_xs3_filter_fir_s32_case3);
+    RUN_TEST(test_xs3_filter_fir_s32_block);
 
 }
\ No newline at end of file
@@ -0,0 +1,160 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xs3_math.h"
+
+#include "../src/vect/vpu_helper.h"
+
+#include "../../tst_common.h"
+
+#include "unity.h"
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+static unsigned seed = 0x0D3E8B51;
+static char msg_buff[200];
+
+
+/*
+    The symmetric filter must agree with the full filter with mirrored coefficients. The products of the 32-bit filter
+    are rounded once per pair rather than once per tap, so its accumulator may differ by up to 1 per pair.
+*/
+#define MAX_TAPS    128
+#define REPS        100
+#define SAMPLES     300
+void test_xs3_filter_fir_sym_s32()
+{
+    PRINTF("%s...\n", __func__);
+    
+    int32_t coefs[MAX_TAPS];
+    int32_t state[MAX_TAPS];
+    int32_t state_sym[XS3_FILTER_FIR_SYM_S32_STATE_LEN(MAX_TAPS)];
+
+    xs3_filter_fir_s32_t filter;
+    xs3_filter_fir_sym_s32_t filter_sym;
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        // Make sure the smallest tap counts are covered
+        const unsigned N = (v < 4)? v + 1 : (pseudo_rand_uint32(&seed) % MAX_TAPS) + 1;
+        const unsigned M = (N + 1) / 2;
+        const right_shift_t shift = pseudo_rand_uint32(&seed) % 8;
+
+        PRINTF("\trep %d... (%u taps)\t(seed: 0x%08X)\n", v, N, old_seed);
+
+        for(int k = 0; k < M; k++){
+            coefs[k] = pseudo_rand_int32(&seed) >> 8;
+            coefs[N-1-k] = coefs[k];
+        }
+
+        memset(state, 0, sizeof(state));
+        memset(state_sym, 0xAA, sizeof(state_sym));
+
+        xs3_filter_fir_s32_init(&filter, state, N, coefs, shift);
+        xs3_filter_fir_sym_s32_init(&filter_sym, state_sym, N, coefs, shift);
+
+        const int32_t max_diff = ((N/2) >> shift) + 1;
+
+        for(int i = 0; i < SAMPLES; i++){
+            const int32_t new_sample = pseudo_rand_int32(&seed) >> 1;
+
+            if(i % 7 == 0){
+                xs3_filter_fir_s32_add_sample(&filter, new_sample);
+                xs3_filter_fir_sym_s32_add_sample(&filter_sym, new_sample);
+            } else {
+                int32_t expected = xs3_filter_fir_s32(&filter, new_sample);
+                int32_t res = xs3_filter_fir_sym_s32(&filter_sym, new_sample);
+
+                sprintf(msg_buff, "(rep %d;   %u taps;   sample %d;   seed 0x%08X)", v, N, i, old_seed);
+                TEST_ASSERT_INT32_WITHIN_MESSAGE(max_diff, expected, res, msg_buff);
+            }
+        }
+    }
+}
+#undef MAX_TAPS
+#undef REPS
+#undef SAMPLES
+
+
+/*
+    The symmetric 16-bit filter must be bit-exact with the full filter with mirrored coefficients.
+*/
+#define MAX_TAPS    128
+#define REPS        100
+#define SAMPLES     300
+void test_xs3_filter_fir_sym_s16()
+{
+    PRINTF("%s...\n", __func__);
+    
+    int16_t WORD_ALIGNED coefs[MAX_TAPS];
+    int16_t WORD_ALIGNED state[MAX_TAPS];
+    int16_t WORD_ALIGNED state_sym[XS3_FILTER_FIR_SYM_S16_STATE_LEN(MAX_TAPS)];
+
+    xs3_filter_fir_s16_t filter;
+    xs3_filter_fir_sym_s16_t filter_sym;
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        // Make sure the smallest tap counts are covered
+        const unsigned N = (v < 4)? v + 1 : (pseudo_rand_uint32(&seed) % MAX_TAPS) + 1;
+        const unsigned M = (N + 1) / 2;
+        const unsigned log2_N = ceil_log2(N);
+        // Large enough that the output can't overflow, where the reference full filter wraps
+        const right_shift_t shift = 15;
+
+        PRINTF("\trep %d... (%u taps)\t(seed: 0x%08X)\n", v, N, old_seed);
+
+        for(int k = 0; k < M; k++){
+            coefs[k] = pseudo_rand_int16(&seed) >> log2_N;
+            coefs[N-1-k] = coefs[k];
+        }
+
+        memset(state, 0, sizeof(state));
+        memset(state_sym, 0xAA, sizeof(state_sym));
+
+        xs3_filter_fir_s16_init(&filter, state, N, coefs, shift);
+        xs3_filter_fir_sym_s16_init(&filter_sym, state_sym, N, coefs, shift);
+
+        for(int i = 0; i < SAMPLES; i++){
+            const int16_t new_sample = pseudo_rand_int16(&seed) >> 1;
+
+            if(i % 7 == 0){
+                xs3_filter_fir_s16_add_sample(&filter, new_sample);
+                xs3_filter_fir_sym_s16_add_sample(&filter_sym, new_sample);
+            } else {
+                int16_t expected = xs3_filter_fir_s16(&filter, new_sample);
+                int16_t res = xs3_filter_fir_sym_s16(&filter_sym, new_sample);
+
+                sprintf(msg_buff, "(rep %d;   %u taps;   sample %d;   seed 0x%08X)", v, N, i, old_seed);
+                TEST_ASSERT_EQUAL_MESSAGE(expected, res, msg_buff);
+            }
+        }
+    }
+}
+#undef MAX_TAPS
+#undef REPS
+#undef SAMPLES
+
+
+
+
+void test_xs3_filter_fir_sym()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_xs3_filter_fir_sym_s32);
+    RUN_TEST(test_xs3_filter_fir_sym_s16);
+}
@@ -0,0 +1,377 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xs3_math.h"
+
+#include "../src/vect/vpu_helper.h"
+
+#include "../../tst_common.h"
+
+#include "unity.h"
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+static unsigned seed = 0x5B7D20C4;
+static char msg_buff[200];
+
+
+/*
+    The decimator must give exactly every `factor`th output of the full-rate filter.
+*/
+#define MAX_TAPS    128
+#define MAX_FACTOR  6
+#define REPS        60
+#define OUTPUTS     40
+void test_xs3_filter_decimator_s32()
+{
+    PRINTF("%s...\n", __func__);
+    
+    int32_t coefs[MAX_TAPS];
+    int32_t state[MAX_TAPS];
+    int32_t state_dec[MAX_TAPS];
+
+    xs3_filter_fir_s32_t filter;
+    xs3_filter_decimator_s32_t decimator;
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        const unsigned N = (pseudo_rand_uint32(&seed) % MAX_TAPS) + 1;
+        const unsigned R = (pseudo_rand_uint32(&seed) % MAX_FACTOR) + 1;
+        const right_shift_t shift = pseudo_rand_uint32(&seed) % 8;
+
+        PRINTF("\trep %d... (%u taps, factor %u)\t(seed: 0x%08X)\n", v, N, R, old_seed);
+
+        for(int i = 0; i < N; i++)
+            coefs[i] = pseudo_rand_int32(&seed) >> 2;
+
+        memset(state, 0, sizeof(state));
+        memset(state_dec, 0, sizeof(state_dec));
+
+        xs3_filter_fir_s32_init(&filter, state, N, coefs, shift);
+        xs3_filter_decimator_s32_init(&decimator, state_dec, N, coefs, shift, R);
+
+        for(int i = 0; i < OUTPUTS; i++){
+            int32_t input[MAX_FACTOR];
+            int32_t expected;
+
+            for(int k = 0; k < R; k++){
+                input[k] = pseudo_rand_int32(&seed) >> 1;
+                expected = xs3_filter_fir_s32(&filter, input[k]);
+            }
+
+            int32_t res = xs3_filter_decimator_s32(&decimator, input);
+
+            sprintf(msg_buff, "(rep %d;   %u taps;   factor %u;   output %d;   seed 0x%08X)", v, N, R, i, old_seed);
+            TEST_ASSERT_EQUAL_MESSAGE(expected, res, msg_buff);
+        }
+    }
+}
+#undef MAX_TAPS
+#undef MAX_FACTOR
+#undef REPS
+#undef OUTPUTS
+
+
+#define MAX_TAPS    128
+#define MAX_FACTOR  6
+#define REPS        60
+#define OUTPUTS     40
+void test_xs3_filter_decimator_s16()
+{
+    PRINTF("%s...\n", __func__);
+    
+    int16_t coefs[MAX_TAPS];
+    int16_t WORD_ALIGNED state[MAX_TAPS];
+    int16_t WORD_ALIGNED state_dec[4*MAX_TAPS];
+
+    xs3_filter_fir_s16_t filter;
+    xs3_filter_decimator_s16_t decimator;
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        const unsigned N = (pseudo_rand_uint32(&seed) % MAX_TAPS) + 1;
+        const unsigned R = (pseudo_rand_uint32(&seed) % MAX_FACTOR) + 1;
+        const unsigned log2_N = ceil_log2(N);
+        const right_shift_t shift = 15 - log2_N;
+
+        PRINTF("\trep %d... (%u taps, factor %u)\t(seed: 0x%08X)\n", v, N, R, old_seed);
+
+        for(int i = 0; i < N; i++)
+            coefs[i] = pseudo_rand_int16(&seed) >> log2_N;
+
+        memset(state, 0, sizeof(state));
+
+        xs3_filter_fir_s16_init(&filter, state, N, coefs, shift);
+        xs3_filter_decimator_s16_init(&decimator, state_dec, N, coefs, shift, R);
+
+        for(int i = 0; i < OUTPUTS; i++){
+            int16_t input[MAX_FACTOR];
+            int16_t expected;
+
+            for(int k = 0; k < R; k++){
+                input[k] = pseudo_rand_int16(&seed) >> 1;
+                expected = xs3_filter_fir_s16(&filter, input[k]);
+            }
+
+            int16_t res = xs3_filter_decimator_s16(&decimator, input);
+
+            sprintf(msg_buff, "(rep %d;   %u taps;   factor %u;   output %d;   seed 0x%08X)", v, N, R, i, old_seed);
+            TEST_ASSERT_EQUAL_MESSAGE(expected, res, msg_buff);
+        }
+    }
+}
+#undef MAX_TAPS
+#undef MAX_FACTOR
+#undef REPS
+#undef OUTPUTS
+
+
+/*
+    The interpolator must give exactly the outputs of the full-rate prototype filter applied to the input with 
+    `factor-1` zeros inserted after each sample.
+*/
+#define MAX_TAPS    128
+#define MAX_FACTOR  6
+#define MAX_PHASE   XS3_FILTER_POLYPHASE_TAPS(MAX_TAPS, 1)
+#define REPS        60
+#define INPUTS      40
+void test_xs3_filter_interpolator_s32()
+{
+    PRINTF("%s...\n", __func__);
+    
+    int32_t coefs[MAX_TAPS];
+    int32_t state[MAX_TAPS];
+    int32_t state_int[MAX_PHASE];
+    int32_t coef_int[MAX_FACTOR * MAX_PHASE];
+
+    xs3_filter_fir_s32_t filter;
+    xs3_filter_interpolator_s32_t interpolator;
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        const unsigned N = (pseudo_rand_uint32(&seed) % MAX_TAPS) + 1;
+        const unsigned L = (pseudo_rand_uint32(&seed) % MAX_FACTOR) + 1;
+        const right_shift_t shift = pseudo_rand_uint32(&seed) % 8;
+        const unsigned M = XS3_FILTER_POLYPHASE_TAPS(N, L);
+
+        PRINTF("\trep %d... (%u taps, factor %u)\t(seed: 0x%08X)\n", v, N, L, old_seed);
+
+        for(int i = 0; i < N; i++)
+            coefs[i] = pseudo_rand_int32(&seed) >> 2;
+
+        memset(state, 0, sizeof(state));
+        memset(state_int, 0xAA, sizeof(state_int));
+
+        xs3_filter_fir_s32_init(&filter, state, N, coefs, shift);
+        xs3_filter_interpolator_s32_init(&interpolator, state_int, coef_int, N, coefs, shift, L);
+
+        TEST_ASSERT_EQUAL(M, interpolator.filter.num_taps);
+        TEST_ASSERT_EQUAL(0, M % 2);
+        TEST_ASSERT(M * L >= N);
+
+        for(int i = 0; i < INPUTS; i++){
+            int32_t expected[MAX_FACTOR];
+            int32_t res[MAX_FACTOR];
+
+            const int32_t new_sample = pseudo_rand_int32(&seed) >> 1;
+
+            for(int p = 0; p < L; p++)
+                expected[p] = xs3_filter_fir_s32(&filter, (p == 0)? new_sample : 0);
+
+            xs3_filter_interpolator_s32(&interpolator, res, new_sample);
+
+            sprintf(msg_buff, "(rep %d;   %u taps;   factor %u;   input %d;   seed 0x%08X)", v, N, L, i, old_seed);
+            TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE(expected, res, L, msg_buff);
+        }
+    }
+}
+#undef MAX_TAPS
+#undef MAX_FACTOR
+#undef MAX_PHASE
+#undef REPS
+#undef INPUTS
+
+
+#define MAX_TAPS    128
+#define MAX_FACTOR  6
+#define MAX_PHASE   XS3_FILTER_POLYPHASE_TAPS(MAX_TAPS, 1)
+#define REPS        60
+#define INPUTS      40
+void test_xs3_filter_interpolator_s16()
+{
+    PRINTF("%s...\n", __func__);
+    
+    int16_t coefs[MAX_TAPS];
+    int16_t WORD_ALIGNED state[MAX_TAPS];
+    int16_t WORD_ALIGNED state_int[4*MAX_PHASE];
+    int16_t WORD_ALIGNED coef_int[MAX_FACTOR * MAX_PHASE];
+
+    xs3_filter_fir_s16_t filter;
+    xs3_filter_interpolator_s16_t interpolator;
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned old_seed = seed;
+
+        const unsigned N = (pseudo_rand_uint32(&seed) % MAX_TAPS) + 1;
+        const unsigned L = (pseudo_rand_uint32(&seed) % MAX_FACTOR) + 1;
+        const unsigned log2_N = ceil_log2(N);
+        const right_shift_t shift = 15 - log2_N;
+        const unsigned M = XS3_FILTER_POLYPHASE_TAPS(N, L);
+
+        PRINTF("\trep %d... (%u taps, factor %u)\t(seed: 0x%08X)\n", v, N, L, old_seed);
+
+        for(int i = 0; i < N; i++)
+            coefs[i] = pseudo_rand_int16(&seed) >> log2_N;
+
+        memset(state, 0, sizeof(state));
+
+        xs3_filter_fir_s16_init(&filter, state, N, coefs, shift);
+        xs3_filter_interpolator_s16_init(&interpolator, state_int, coef_int, N, coefs, shift, L);
+
+        TEST_ASSERT_EQUAL(M, interpolator.filter.num_taps);
+
+        for(int i = 0; i < INPUTS; i++){
+            int16_t expected[MAX_FACTOR];
+            int16_t res[MAX_FACTOR];
+
+            const int16_t new_sample = pseudo_rand_int16(&seed) >> 1;
+
+            for(int p = 0; p < L; p++)
+                expected[p] = xs3_filter_fir_s16(&filter, (p == 0)? new_sample : 0);
+
+            xs3_filter_interpolator_s16(&interpolator, res, new_sample);
+
+            sprintf(msg_buff, "(rep %d;   %u taps;   factor %u;   input %d;   seed 0x%08X)", v, N, L, i, old_seed);
+            TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE(expected, res, L, msg_buff);
+
+            // Each phase's coefficients must be word-aligned
+            for(int p = 0; p < L; p++)
+                TEST_ASSERT_EQUAL(0, ((uintptr_t) &interpolator.coef[p * M]) % 4);
+        }
+    }
+}
+#undef MAX_TAPS
+#undef MAX_FACTOR
+#undef MAX_PHASE
+#undef REPS
+#undef INPUTS
+
+
+
+/*
+    The sample rate converter must give exactly every M'th output of the full-rate prototype filter applied to the input
+    with L-1 zeros inserted after each sample, regardless of how the input is split into blocks.
+*/
+#define MAX_TAPS        1280
+#define MAX_BLOCK       40
+#define BLOCKS          12
+void test_xs3_filter_src_s32()
+{
+    PRINTF("%s...\n", __func__);
+
+    static const struct { unsigned up; unsigned down; unsigned taps; } configs[] = {
+        {   1,   1,   16 },
+        {   3,   2,   48 },
+        {   2,   3,   37 },
+        {   1,   4,   20 },
+        {   5,   7,   64 },
+        { 160, 147, 1280 },
+        { 147, 160, 1176 },
+    };
+
+    static int32_t coefs[MAX_TAPS];
+    static int32_t state[MAX_TAPS];
+    static int32_t state_src[MAX_TAPS];
+    static int32_t coef_src[2 * MAX_TAPS];
+
+    seed = 0x3C90A1E5;
+
+    xs3_filter_fir_s32_t filter;
+    xs3_filter_src_s32_t src;
+
+    for(int v = 0; v < sizeof(configs)/sizeof(configs[0]); v++){
+
+        const unsigned L = configs[v].up;
+        const unsigned M = configs[v].down;
+        const unsigned N = configs[v].taps;
+        const right_shift_t shift = pseudo_rand_uint32(&seed) % 8;
+
+        PRINTF("\tconfig %d... (L = %u, M = %u, %u taps)\n", v, L, M, N);
+
+        TEST_ASSERT(L * XS3_FILTER_POLYPHASE_TAPS(N, L) <= 2 * MAX_TAPS);
+
+        for(int i = 0; i < N; i++)
+            coefs[i] = pseudo_rand_int32(&seed) >> 8;
+
+        memset(state, 0, sizeof(state));
+
+        xs3_filter_fir_s32_init(&filter, state, N, coefs, shift);
+        xs3_filter_src_s32_init(&src, state_src, coef_src, N, coefs, shift, L, M);
+
+        // Position in the upsampled signal of the next sample to keep
+        unsigned next = 0;
+
+        for(int b = 0; b < BLOCKS; b++){
+            int32_t input[MAX_BLOCK];
+            static int32_t expected[MAX_BLOCK * 160];
+            static int32_t res[MAX_BLOCK * 160];
+            unsigned expected_length = 0;
+            unsigned res_length;
+
+            const unsigned len = pseudo_rand_uint32(&seed) % (MAX_BLOCK + 1);
+
+            for(int i = 0; i < len; i++){
+                input[i] = pseudo_rand_int32(&seed) >> 1;
+
+                for(int p = 0; p < L; p++, next--){
+                    int32_t y = xs3_filter_fir_s32(&filter, (p == 0)? input[i] : 0);
+                    if(next == 0){
+                        expected[expected_length++] = y;
+                        next = M;
+                    }
+                }
+            }
+
+            headroom_t hr = xs3_filter_src_s32(&src, res, &res_length, input, len);
+
+            sprintf(msg_buff, "(config %d;   block %d)", v, b);
+            TEST_ASSERT_EQUAL_MESSAGE(expected_length, res_length, msg_buff);
+            TEST_ASSERT(res_length <= (len * L + M - 1) / M);
+            if(res_length > 0)
+                TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE(expected, res, res_length, msg_buff);
+            TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_s32_headroom(res, res_length), hr, msg_buff);
+        }
+    }
+}
+#undef MAX_TAPS
+#undef MAX_BLOCK
+#undef BLOCKS
+
+
+
+void test_xs3_filter_polyphase()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_xs3_filter_decimator_s32);
+    RUN_TEST(test_xs3_filter_decimator_s16);
+    RUN_TEST(test_xs3_filter_interpolator_s32);
+    RUN_TEST(test_xs3_filter_interpolator_s16);
+    RUN_TEST(test_xs3_filter_src_s32);
+}
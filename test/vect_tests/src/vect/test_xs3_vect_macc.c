@@ -0,0 +1,354 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xs3_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+#include "../tst_common.h"
+
+#include "unity.h"
+
+
+static unsigned seed = 0x3C6EF372;
+static char msg_buff[200];
+
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+
+#define MAX_LEN     67
+#define REPS        1000
+
+
+/*
+    The prepare functions must choose shifts which can't saturate even for the largest-magnitude mantissas allowed by
+    the headrooms, and must choose the smallest exponent for which that's true.
+*/
+static void test_xs3_vect_s32_macc_prepare()
+{
+    PRINTF("%s...\n", __func__);
+
+    for(int v = 0; v < REPS; v++){
+
+        PRINTF("\trep %d..\t(seed: 0x%08X)\n", v, seed);
+
+        const exponent_t acc_exp = pseudo_rand_int(&seed, -40, 40);
+        const exponent_t b_exp = pseudo_rand_int(&seed, -40, 40);
+        const exponent_t c_exp = pseudo_rand_int(&seed, -40, 40);
+        const headroom_t acc_hr = pseudo_rand_uint(&seed, 0, 29);
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 29);
+        const headroom_t c_hr = pseudo_rand_uint(&seed, 0, 29);
+
+        exponent_t new_acc_exp;
+        right_shift_t acc_shr, b_shr, c_shr;
+
+        xs3_vect_s32_macc_prepare(&new_acc_exp, &acc_shr, &b_shr, &c_shr,
+                                  acc_exp, b_exp, c_exp, acc_hr, b_hr, c_hr);
+
+        TEST_ASSERT_EQUAL(new_acc_exp, acc_exp + acc_shr);
+        TEST_ASSERT_EQUAL(new_acc_exp, b_exp + c_exp + b_shr + c_shr + 30);
+
+        // Shifted inputs don't saturate
+        TEST_ASSERT(b_hr + b_shr >= 0);
+        TEST_ASSERT(c_hr + c_shr >= 0);
+
+        // Neither the shifted accumulator nor the product exceeds 2^30
+        TEST_ASSERT(acc_hr + acc_shr >= 1);
+        TEST_ASSERT(b_hr + b_shr + c_hr + c_shr >= 2);
+
+        // One of them can reach 2^30
+        TEST_ASSERT((acc_hr + acc_shr == 1) || (b_hr + b_shr + c_hr + c_shr == 2));
+    }
+}
+
+
+static void test_xs3_vect_s16_macc_prepare()
+{
+    PRINTF("%s...\n", __func__);
+
+    for(int v = 0; v < REPS; v++){
+
+        PRINTF("\trep %d..\t(seed: 0x%08X)\n", v, seed);
+
+        const exponent_t acc_exp = pseudo_rand_int(&seed, -10, 10);
+        const exponent_t b_exp = pseudo_rand_int(&seed, -10, 10);
+        const exponent_t c_exp = pseudo_rand_int(&seed, -10, 10);
+        const headroom_t acc_hr = pseudo_rand_uint(&seed, 0, 14);
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 14);
+        const headroom_t c_hr = pseudo_rand_uint(&seed, 0, 14);
+
+        exponent_t new_acc_exp;
+        right_shift_t acc_shr, bc_sat;
+
+        xs3_vect_s16_macc_prepare(&new_acc_exp, &acc_shr, &bc_sat,
+                                  acc_exp, b_exp, c_exp, acc_hr, b_hr, c_hr);
+
+        TEST_ASSERT_EQUAL(new_acc_exp, acc_exp + acc_shr);
+        TEST_ASSERT_EQUAL(new_acc_exp, b_exp + c_exp + bc_sat);
+
+        // Neither the shifted accumulator nor the product exceeds 2^14
+        TEST_ASSERT(bc_sat >= 0);
+        TEST_ASSERT(acc_hr + acc_shr >= 1);
+        TEST_ASSERT(b_hr + c_hr + bc_sat >= 16);
+
+        // One of them can reach 2^14, or the product isn't shifted at all
+        TEST_ASSERT((acc_hr + acc_shr == 1) || (b_hr + c_hr + bc_sat == 16) || (bc_sat == 0));
+    }
+}
+
+
+static void test_xs3_vect_complex_s32_macc_prepare()
+{
+    PRINTF("%s...\n", __func__);
+
+    for(int v = 0; v < REPS; v++){
+
+        PRINTF("\trep %d..\t(seed: 0x%08X)\n", v, seed);
+
+        const exponent_t acc_exp = pseudo_rand_int(&seed, -40, 40);
+        const exponent_t b_exp = pseudo_rand_int(&seed, -40, 40);
+        const exponent_t c_exp = pseudo_rand_int(&seed, -40, 40);
+        const headroom_t acc_hr = pseudo_rand_uint(&seed, 0, 29);
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 29);
+        const headroom_t c_hr = pseudo_rand_uint(&seed, 0, 29);
+
+        exponent_t new_acc_exp;
+        right_shift_t acc_shr, b_shr, c_shr;
+
+        xs3_vect_complex_s32_macc_prepare(&new_acc_exp, &acc_shr, &b_shr, &c_shr,
+                                          acc_exp, b_exp, c_exp, acc_hr, b_hr, c_hr);
+
+        TEST_ASSERT_EQUAL(new_acc_exp, acc_exp + acc_shr);
+        TEST_ASSERT_EQUAL(new_acc_exp, b_exp + c_exp + b_shr + c_shr + 30);
+
+        TEST_ASSERT(b_hr + b_shr >= 0);
+        TEST_ASSERT(c_hr + c_shr >= 0);
+
+        // The parts of the complex product are each the sum of two real products
+        TEST_ASSERT(acc_hr + acc_shr >= 1);
+        TEST_ASSERT(b_hr + b_shr + c_hr + c_shr >= 3);
+
+        TEST_ASSERT((acc_hr + acc_shr == 1) || (b_hr + b_shr + c_hr + c_shr == 3));
+    }
+}
+
+
+static void test_xs3_vect_s32_macc()
+{
+    PRINTF("%s...\n", __func__);
+
+    int32_t acc[MAX_LEN];
+    int32_t b[MAX_LEN];
+    int32_t c[MAX_LEN];
+    int32_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        PRINTF("\trep %d..\t(seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const unsigned negate = v & 1;
+
+        const headroom_t acc_hr = pseudo_rand_uint(&seed, 0, 20);
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 20);
+        const headroom_t c_hr = pseudo_rand_uint(&seed, 0, 20);
+
+        for(int k = 0; k < len; k++){
+            acc[k] = pseudo_rand_int32(&seed) >> acc_hr;
+            b[k] = pseudo_rand_int32(&seed) >> b_hr;
+            c[k] = pseudo_rand_int32(&seed) >> c_hr;
+        }
+
+        exponent_t new_acc_exp;
+        right_shift_t acc_shr, b_shr, c_shr;
+
+        xs3_vect_s32_macc_prepare(&new_acc_exp, &acc_shr, &b_shr, &c_shr,
+                                  pseudo_rand_int(&seed, -20, 20), pseudo_rand_int(&seed, -20, 20),
+                                  pseudo_rand_int(&seed, -20, 20), acc_hr, b_hr, c_hr);
+
+        for(int k = 0; k < len; k++){
+            const int32_t prod = vlmul32(vlashr32(b[k], b_shr), vlashr32(c[k], c_shr));
+            const int32_t acc_k = vlashr32(acc[k], acc_shr);
+            expected[k] = negate? vlsub32(acc_k, prod) : vladd32(acc_k, prod);
+        }
+
+        headroom_t hr = negate? xs3_vect_s32_nmacc(acc, b, c, len, acc_shr, b_shr, c_shr)
+                              : xs3_vect_s32_macc(acc, b, c, len, acc_shr, b_shr, c_shr);
+
+        sprintf(msg_buff, "(rep %d, negate %u)", v, negate);
+        TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE(expected, acc, len, msg_buff);
+        TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_s32_headroom(acc, len), hr, msg_buff);
+    }
+}
+
+
+static void test_xs3_vect_s32_add_scaled()
+{
+    PRINTF("%s...\n", __func__);
+
+    int32_t a[MAX_LEN];
+    int32_t b[MAX_LEN];
+    int32_t c[MAX_LEN];
+    int32_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        PRINTF("\trep %d..\t(seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 20);
+        const headroom_t c_hr = pseudo_rand_uint(&seed, 0, 20);
+
+        for(int k = 0; k < len; k++){
+            b[k] = pseudo_rand_int32(&seed) >> b_hr;
+            c[k] = pseudo_rand_int32(&seed) >> c_hr;
+        }
+
+        const int32_t alpha = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 20);
+
+        exponent_t a_exp;
+        right_shift_t b_shr, c_shr, alpha_shr;
+
+        xs3_vect_s32_macc_prepare(&a_exp, &b_shr, &c_shr, &alpha_shr,
+                                  pseudo_rand_int(&seed, -20, 20), pseudo_rand_int(&seed, -20, 20),
+                                  pseudo_rand_int(&seed, -20, 20), b_hr, c_hr, HR_S32(alpha));
+
+        const int32_t alpha_k = vlashr32(alpha, alpha_shr);
+        for(int k = 0; k < len; k++)
+            expected[k] = vladd32(vlashr32(b[k], b_shr), vlmul32(vlashr32(c[k], c_shr), alpha_k));
+
+        // In-place on b[]
+        headroom_t hr = xs3_vect_s32_add_scaled(b, b, c, len, alpha, b_shr, c_shr, alpha_shr);
+
+        sprintf(msg_buff, "(rep %d)", v);
+        TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE(expected, b, len, msg_buff);
+        TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_s32_headroom(b, len), hr, msg_buff);
+
+        // And out-of-place
+        memcpy(a, c, sizeof(c));
+        hr = xs3_vect_s32_add_scaled(a, expected, c, len, alpha, b_shr, c_shr, alpha_shr);
+        TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_s32_headroom(a, len), hr, msg_buff);
+    }
+}
+
+
+static void test_xs3_vect_s16_macc()
+{
+    PRINTF("%s...\n", __func__);
+
+    int16_t acc[MAX_LEN];
+    int16_t b[MAX_LEN];
+    int16_t c[MAX_LEN];
+    int16_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        PRINTF("\trep %d..\t(seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+        const headroom_t acc_hr = pseudo_rand_uint(&seed, 0, 10);
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 10);
+        const headroom_t c_hr = pseudo_rand_uint(&seed, 0, 10);
+
+        for(int k = 0; k < len; k++){
+            acc[k] = pseudo_rand_int16(&seed) >> acc_hr;
+            b[k] = pseudo_rand_int16(&seed) >> b_hr;
+            c[k] = pseudo_rand_int16(&seed) >> c_hr;
+        }
+
+        exponent_t new_acc_exp;
+        right_shift_t acc_shr, bc_sat;
+
+        xs3_vect_s16_macc_prepare(&new_acc_exp, &acc_shr, &bc_sat,
+                                  pseudo_rand_int(&seed, -10, 10), pseudo_rand_int(&seed, -10, 10),
+                                  pseudo_rand_int(&seed, -10, 10), acc_hr, b_hr, c_hr);
+
+        for(int k = 0; k < len; k++){
+            const int16_t prod = vlsat16(vlmacc16(0, b[k], c[k]), bc_sat);
+            expected[k] = vladd16(vlashr16(acc[k], acc_shr), prod);
+        }
+
+        headroom_t hr = xs3_vect_s16_macc(acc, b, c, len, acc_shr, bc_sat);
+
+        sprintf(msg_buff, "(rep %d)", v);
+        TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE(expected, acc, len, msg_buff);
+        TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_s16_headroom(acc, len), hr, msg_buff);
+    }
+}
+
+
+static void test_xs3_vect_complex_s32_macc()
+{
+    PRINTF("%s...\n", __func__);
+
+    complex_s32_t acc[MAX_LEN];
+    complex_s32_t b[MAX_LEN];
+    complex_s32_t c[MAX_LEN];
+    complex_s32_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        PRINTF("\trep %d..\t(seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+        const headroom_t acc_hr = pseudo_rand_uint(&seed, 0, 20);
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 20);
+        const headroom_t c_hr = pseudo_rand_uint(&seed, 0, 20);
+
+        for(int k = 0; k < len; k++){
+            acc[k].re = pseudo_rand_int32(&seed) >> acc_hr;
+            acc[k].im = pseudo_rand_int32(&seed) >> acc_hr;
+            b[k].re = pseudo_rand_int32(&seed) >> b_hr;
+            b[k].im = pseudo_rand_int32(&seed) >> b_hr;
+            c[k].re = pseudo_rand_int32(&seed) >> c_hr;
+            c[k].im = pseudo_rand_int32(&seed) >> c_hr;
+        }
+
+        exponent_t new_acc_exp;
+        right_shift_t acc_shr, b_shr, c_shr;
+
+        xs3_vect_complex_s32_macc_prepare(&new_acc_exp, &acc_shr, &b_shr, &c_shr,
+                                          pseudo_rand_int(&seed, -20, 20), pseudo_rand_int(&seed, -20, 20),
+                                          pseudo_rand_int(&seed, -20, 20), acc_hr, b_hr, c_hr);
+
+        for(int k = 0; k < len; k++){
+            const complex_s32_t B = { vlashr32(b[k].re, b_shr), vlashr32(b[k].im, b_shr) };
+            const complex_s32_t C = { vlashr32(c[k].re, c_shr), vlashr32(c[k].im, c_shr) };
+            expected[k].re = vladd32(vlashr32(acc[k].re, acc_shr), vcmr32(B, C));
+            expected[k].im = vladd32(vlashr32(acc[k].im, acc_shr), vcmi32(B, C));
+        }
+
+        headroom_t hr = xs3_vect_complex_s32_macc(acc, b, c, len, acc_shr, b_shr, c_shr);
+
+        sprintf(msg_buff, "(rep %d)", v);
+        TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE((int32_t*) expected, (int32_t*) acc, 2*len, msg_buff);
+        TEST_ASSERT_EQUAL_MESSAGE(xs3_vect_complex_s32_headroom(acc, len), hr, msg_buff);
+    }
+}
+
+
+void test_xs3_macc_vect()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_xs3_vect_s32_macc_prepare);
+    RUN_TEST(test_xs3_vect_s16_macc_prepare);
+    RUN_TEST(test_xs3_vect_complex_s32_macc_prepare);
+
+    RUN_TEST(test_xs3_vect_s32_macc);
+    RUN_TEST(test_xs3_vect_s32_add_scaled);
+    RUN_TEST(test_xs3_vect_s16_macc);
+    RUN_TEST(test_xs3_vect_complex_s32_macc);
+}
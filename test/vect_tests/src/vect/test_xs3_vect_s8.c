@@ -0,0 +1,376 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdarg.h>
+
+#include "xs3_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+#include "../tst_common.h"
+
+#include "unity.h"
+
+static unsigned seed = 2314567;
+
+#if DEBUG_ON || 0
+#undef DEBUG_ON
+#define DEBUG_ON    (1)
+#endif
+
+
+#define MAX_LEN     300
+#define REPS        1000
+
+
+static void test_xs3_vect_s8_headroom()
+{
+    PRINTF("%s...\n", __func__);
+    seed = 0x4A1B72C3;
+
+    int8_t WORD_ALIGNED B[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        PRINTF("\trepetition %d.. (seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const unsigned shr = pseudo_rand_uint(&seed, 0, 8);
+
+        headroom_t expected = 7;
+
+        for(int i = 0; i < len; i++){
+            B[i] = pseudo_rand_int8(&seed) >> shr;
+            expected = MIN(expected, HR_S8(B[i]));
+        }
+
+        TEST_ASSERT_EQUAL(expected, xs3_vect_s8_headroom(B, len));
+    }
+}
+
+
+static void test_xs3_vect_s8_shl()
+{
+    PRINTF("%s...\n", __func__);
+    seed = 0x1C73E0AA;
+
+    int8_t WORD_ALIGNED A[MAX_LEN];
+    int8_t WORD_ALIGNED B[MAX_LEN];
+    int8_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        PRINTF("\trepetition %d.. (seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const left_shift_t b_shl = pseudo_rand_int(&seed, -8, 8);
+
+        for(int i = 0; i < len; i++){
+            B[i] = pseudo_rand_int8(&seed) >> pseudo_rand_uint(&seed, 0, 8);
+            expected[i] = vlashr8(B[i], -b_shl);
+        }
+
+        headroom_t hr = xs3_vect_s8_shl(A, B, len, b_shl);
+
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected, A, len);
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A, len), hr);
+
+        hr = xs3_vect_s8_shr(B, B, len, -b_shl);
+
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected, B, len);
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(B, len), hr);
+    }
+}
+
+
+static void test_xs3_vect_s8_add_sub()
+{
+    PRINTF("%s...\n", __func__);
+    seed = 0x7D0E5A13;
+
+    int8_t WORD_ALIGNED A[MAX_LEN];
+    int8_t WORD_ALIGNED B[MAX_LEN];
+    int8_t WORD_ALIGNED C[MAX_LEN];
+    int8_t expected_add[MAX_LEN];
+    int8_t expected_sub[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        PRINTF("\trepetition %d.. (seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const right_shift_t b_shr = pseudo_rand_int(&seed, -2, 8);
+        const right_shift_t c_shr = pseudo_rand_int(&seed, -2, 8);
+
+        for(int i = 0; i < len; i++){
+            B[i] = pseudo_rand_int8(&seed);
+            C[i] = pseudo_rand_int8(&seed);
+            expected_add[i] = vladd8(vlashr8(B[i], b_shr), vlashr8(C[i], c_shr));
+            expected_sub[i] = vlsub8(vlashr8(B[i], b_shr), vlashr8(C[i], c_shr));
+        }
+
+        headroom_t hr = xs3_vect_s8_add(A, B, C, len, b_shr, c_shr);
+
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected_add, A, len);
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A, len), hr);
+
+        hr = xs3_vect_s8_sub(A, B, C, len, b_shr, c_shr);
+
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected_sub, A, len);
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A, len), hr);
+
+        // In-place
+        hr = xs3_vect_s8_add(B, B, C, len, b_shr, c_shr);
+
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected_add, B, len);
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(B, len), hr);
+    }
+}
+
+
+static void test_xs3_vect_s8_mul()
+{
+    PRINTF("%s...\n", __func__);
+    seed = 0x3309BE51;
+
+    int8_t WORD_ALIGNED A[MAX_LEN];
+    int8_t WORD_ALIGNED B[MAX_LEN];
+    int8_t WORD_ALIGNED C[MAX_LEN];
+    int8_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        PRINTF("\trepetition %d.. (seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const right_shift_t b_shr = pseudo_rand_int(&seed, -2, 4);
+        const right_shift_t c_shr = pseudo_rand_int(&seed, -2, 4);
+
+        for(int i = 0; i < len; i++){
+            B[i] = pseudo_rand_int8(&seed);
+            C[i] = pseudo_rand_int8(&seed);
+            expected[i] = vlmul8(vlashr8(B[i], b_shr), vlashr8(C[i], c_shr));
+        }
+
+        headroom_t hr = xs3_vect_s8_mul(A, B, C, len, b_shr, c_shr);
+
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected, A, len);
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A, len), hr);
+    }
+}
+
+
+static void test_xs3_vect_s8_mul_prepare()
+{
+    PRINTF("%s...\n", __func__);
+    seed = 0x56E1F3A2;
+
+    int8_t WORD_ALIGNED A[MAX_LEN];
+    int8_t WORD_ALIGNED B[MAX_LEN];
+    int8_t WORD_ALIGNED C[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        PRINTF("\trepetition %d.. (seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+        const exponent_t b_exp = pseudo_rand_int(&seed, -30, 30);
+        const exponent_t c_exp = pseudo_rand_int(&seed, -30, 30);
+
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 7);
+        const headroom_t c_hr = pseudo_rand_uint(&seed, 0, 7);
+
+        for(int i = 0; i < len; i++){
+            B[i] = -(0x7F >> b_hr);
+            C[i] = -(0x7F >> c_hr);
+        }
+
+        exponent_t a_exp;
+        right_shift_t b_shr, c_shr;
+
+        xs3_vect_s8_mul_prepare(&a_exp, &b_shr, &c_shr, b_exp, c_exp, b_hr, c_hr);
+
+        headroom_t hr = xs3_vect_s8_mul(A, B, C, len, b_shr, c_shr);
+
+        // The product of the largest-magnitude inputs should neither saturate nor lose more than a couple bits.
+        TEST_ASSERT(hr <= 2);
+
+        const double expected = ldexp(B[0], b_exp) * ldexp(C[0], c_exp);
+
+        for(int i = 0; i < len; i++){
+            TEST_ASSERT(A[i] != VPU_INT8_MAX && A[i] != VPU_INT8_MIN);
+            TEST_ASSERT( fabs((expected - ldexp(A[i], a_exp)) / expected) < ldexp(1, -4) );
+        }
+    }
+}
+
+
+static void test_xs3_vect_s8_scale()
+{
+    PRINTF("%s...\n", __func__);
+    seed = 0x9A07F2C6;
+
+    int8_t WORD_ALIGNED A[MAX_LEN];
+    int8_t WORD_ALIGNED B[MAX_LEN];
+    int8_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        PRINTF("\trepetition %d.. (seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const right_shift_t b_shr = pseudo_rand_int(&seed, -2, 4);
+        const right_shift_t c_shr = pseudo_rand_int(&seed, -2, 4);
+        const int8_t c = pseudo_rand_int8(&seed);
+
+        for(int i = 0; i < len; i++){
+            B[i] = pseudo_rand_int8(&seed);
+            expected[i] = vlmul8(vlashr8(B[i], b_shr), vlashr8(c, c_shr));
+        }
+
+        headroom_t hr = xs3_vect_s8_scale(A, B, len, c, b_shr, c_shr);
+
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected, A, len);
+        TEST_ASSERT_EQUAL(xs3_vect_s8_headroom(A, len), hr);
+    }
+}
+
+
+static void test_xs3_vect_s8_dot()
+{
+    PRINTF("%s...\n", __func__);
+    seed = 0x2F6D1E84;
+
+    int8_t WORD_ALIGNED B[MAX_LEN];
+    int8_t WORD_ALIGNED C[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        PRINTF("\trepetition %d.. (seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+        int64_t expected = 0;
+
+        for(int i = 0; i < len; i++){
+            B[i] = pseudo_rand_int8(&seed);
+            C[i] = pseudo_rand_int8(&seed);
+            expected += ((int32_t)B[i]) * C[i];
+        }
+
+        TEST_ASSERT_EQUAL(expected, xs3_vect_s8_dot(B, C, len));
+    }
+
+    // All products of the same sign, to exercise the full width of the accumulators
+    for(int i = 0; i < MAX_LEN; i++){
+        B[i] = -0x7F;
+        C[i] = 0x7F;
+    }
+
+    TEST_ASSERT_EQUAL(-((int64_t)MAX_LEN) * 0x7F * 0x7F, xs3_vect_s8_dot(B, C, MAX_LEN));
+}
+
+
+static void test_xs3_vect_s16_to_s8()
+{
+    PRINTF("%s...\n", __func__);
+    seed = 0x0B4C9D71;
+
+    int16_t WORD_ALIGNED B[MAX_LEN];
+    int8_t WORD_ALIGNED A[MAX_LEN+4];
+    int8_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        PRINTF("\trepetition %d.. (seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const right_shift_t b_shr = pseudo_rand_int(&seed, 0, 12);
+
+        for(int i = 0; i < len; i++){
+            B[i] = pseudo_rand_int16(&seed) >> pseudo_rand_uint(&seed, 0, 16);
+            expected[i] = vdepth8_16(vlashr16(B[i], b_shr - 8));
+        }
+
+        memset(A, 0xCC, sizeof(A));
+
+        xs3_vect_s16_to_s8(A, B, len, b_shr);
+
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected, A, len);
+        for(int k = len; k < MAX_LEN+4; k++)
+            TEST_ASSERT_EQUAL_INT8((int8_t)0xCC, A[k]);
+    }
+}
+
+
+static void test_xs3_vect_s32_to_s8()
+{
+    PRINTF("%s...\n", __func__);
+    seed = 0xC6A2F390;
+
+    int32_t WORD_ALIGNED B[MAX_LEN];
+    int8_t WORD_ALIGNED A[MAX_LEN+4];
+    int8_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        PRINTF("\trepetition %d.. (seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const right_shift_t b_shr = pseudo_rand_int(&seed, 0, 28);
+
+        for(int i = 0; i < len; i++){
+            B[i] = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 32);
+            expected[i] = vdepth8_32(vlashr32(B[i], b_shr - 24));
+        }
+
+        memset(A, 0xCC, sizeof(A));
+
+        xs3_vect_s32_to_s8(A, B, len, b_shr);
+
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected, A, len);
+        for(int k = len; k < MAX_LEN+4; k++)
+            TEST_ASSERT_EQUAL_INT8((int8_t)0xCC, A[k]);
+    }
+}
+
+
+static void test_xs3_vect_s8_to_s16_s32()
+{
+    PRINTF("%s...\n", __func__);
+    seed = 0x618F0E27;
+
+    int8_t WORD_ALIGNED B[MAX_LEN];
+    int16_t WORD_ALIGNED A16[MAX_LEN];
+    int32_t WORD_ALIGNED A32[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        PRINTF("\trepetition %d.. (seed: 0x%08X)\n", v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int8(&seed);
+
+        xs3_vect_s8_to_s16(A16, B, len);
+        xs3_vect_s8_to_s32(A32, B, len);
+
+        for(int i = 0; i < len; i++){
+            TEST_ASSERT_EQUAL_INT16(B[i] * 0x100, A16[i]);
+            TEST_ASSERT_EQUAL_INT32(B[i] * 0x1000000, A32[i]);
+        }
+    }
+}
+
+
+void test_xs3_vect_s8()
+{
+    SET_TEST_FILE();
+
+    RUN_TEST(test_xs3_vect_s8_headroom);
+    RUN_TEST(test_xs3_vect_s8_shl);
+    RUN_TEST(test_xs3_vect_s8_add_sub);
+    RUN_TEST(test_xs3_vect_s8_mul);
+    RUN_TEST(test_xs3_vect_s8_mul_prepare);
+    RUN_TEST(test_xs3_vect_s8_scale);
+    RUN_TEST(test_xs3_vect_s8_dot);
+    RUN_TEST(test_xs3_vect_s16_to_s8);
+    RUN_TEST(test_xs3_vect_s32_to_s8);
+    RUN_TEST(test_xs3_vect_s8_to_s16_s32);
+}